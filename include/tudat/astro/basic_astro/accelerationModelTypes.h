@@ -18,6 +18,7 @@
 #include "tudat/astro/gravitation/mutualSphericalHarmonicGravityModel.h"
 #include "tudat/astro/gravitation/thirdBodyPerturbation.h"
 #include "tudat/astro/gravitation/directTidalDissipationAcceleration.h"
+#include "tudat/astro/gravitation/griddedGravityModel.h"
 #include "tudat/astro/aerodynamics/aerodynamicAcceleration.h"
 #include "tudat/astro/basic_astro/massRateModel.h"
 #include "tudat/astro/propulsion/thrustAccelerationModel.h"
@@ -64,7 +65,8 @@ enum AvailableAcceleration
     radiation_pressure,
     momentum_wheel_desaturation_acceleration,
     custom_acceleration,
-    yarkovsky_acceleration
+    yarkovsky_acceleration,
+    gridded_gravity
 };
 
 // Function to get a string representing a 'named identification' of an acceleration type
@@ -52,7 +52,10 @@ public:
      *  Function to calculate the altitude above the body from a body fixed position.
      *  Function first evaluates the altitude with the low-resolution model. If the computed altitude is above the
      *  selected switchover altitude, then the function return the low-resolution altitude. If the computed altitude
-     *  is below the switchover altitude, the function computes and returns the high-resolution altitude.
+     *  is below the switchover altitude, the function computes and returns the high-resolution altitude. For
+     *  polyhedron models (low- or high-resolution), the altitude is found with the bounding volume hierarchy of the
+     *  polyhedron (see PolyhedronBodyShapeModel), so the cost of the high-resolution evaluation scales with the
+     *  logarithm of its number of facets.
      *  \param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
      *  \return Altitude above the polyhedron.
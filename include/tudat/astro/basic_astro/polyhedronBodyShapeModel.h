@@ -11,6 +11,8 @@
  *       "EXTERIOR GRAVITATION OF A POLYHEDRON DERIVED AND COMPARED WITH HARMONIC AND MASCON GRAVITATION REPRESENTATIONS
  *          OF ASTEROID 4769 CASTALIA", Werner and Scheeres (1997), Celestial Mechanics and Dynamical Astronomy
  *       Avillez (2022), MSc thesis (TU Delft) - TODO: add proper reference
+ *       "Signed distance computation using the angle weighted pseudonormal", Baerentzen and Aanaes (2005), IEEE
+ *          Transactions on Visualization and Computer Graphics, 11(3), pp. 243-253
  */
 
 #ifndef TUDAT_POLYHEDRONBODYSHAPEMODEL_H
@@ -20,6 +22,7 @@
 #include "tudat/astro/basic_astro/bodyShapeModel.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
+#include "tudat/math/basic/polyhedronBoundingVolumeHierarchy.h"
 #include <iostream>
 
 namespace tudat
@@ -58,11 +61,9 @@ public:
         // Check if provided settings are valid
         basic_mathematics::checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
 
-        // If necessary, get list with vertices defining each edge
-        if ( !justComputeDistanceToVertices_ )
-        {
-            computeVerticesDefiningEachEdge();
-        }
+        // Build bounding volume hierarchy used for distance queries
+        boundingVolumeHierarchy_ = std::make_shared< basic_mathematics::PolyhedronBoundingVolumeHierarchy >(
+                    verticesCoordinates_, verticesDefiningEachFacet_ );
     }
 
     //! Destructor
@@ -71,8 +72,11 @@ public:
     //! Calculates the altitude above the polyhedron
     /*!
      *  Function to calculate the altitude above the polyhedron from a body fixed position.
-     *  Function computes the minimum distance to each of the polyhedron features (vertices, edges and facets); the
-     *  distance is only computed wrt to the edges and facets around the closest vertex. See Avillez (2022).
+     *  Function computes the minimum distance to each of the polyhedron features (vertices, edges and facets), or
+     *  only to the vertices, see Avillez (2022). The closest feature is found with a bounding volume hierarchy of the
+     *  facets, which is built on construction, such that the cost of the function scales with the logarithm of the
+     *  number of facets. If the altitude is computed with sign, the point is identified as inside the polyhedron
+     *  using the pseudonormal at the closest point on the surface (Baerentzen and Aanaes, 2005).
      *  \param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
      *  \return Altitude above the polyhedron.
@@ -118,50 +122,13 @@ public:
         return justComputeDistanceToVertices_;
     }
 
-private:
-
-    /*! Computes the distance to the vertex closest to the field point.
-     *
-     * Computes the distance to the vertex closest to the field point.
-     * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
-     *  is to be determined.
-     * @return Distance to the vertex closest to the field point.
-     */
-    double computeDistanceToClosestVertex( const Eigen::Vector3d& bodyFixedPosition,
-                                           unsigned int& closestVertexId);
-
-    /*! Computes the distance to the facet closest to the field point.
-     *
-     * Computes the distance to the facet closest to the field point, according to Avillez (2022). The distance is
-     * computed only wrt to the limited set of facets provided as argument. If no valid distance is computed, the
-     * function returns NAN. The returned distance is unsigned.
-     * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
-     *  is to be determined.
-     * @param verticesDefiningEachFacetToEvaluate Facets wrt which the distance is to be computed.
-     * @return Distance to closest facet.
-     */
-    double computeDistanceToClosestFacet ( const Eigen::Vector3d& bodyFixedPosition,
-                                           const Eigen::MatrixXi& verticesDefiningEachFacetToEvaluate );
-
-    /*! Computes the distance to the edge closest to the field point.
-     *
-     * Computes the distance to the edge closest to the field point, according to Avillez (2022). The distance is
-     * computed only wrt to the limited set of edges provided as argument. If no valid distance is computed, the
-     * function returns NAN. The returned distance is unsigned.
-     * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
-     *  is to be determined.
-     * @param verticesDefiningEachEdgeToEvaluate Edges wrt which the distance is to be computed.
-     * @return Distance to closest edge.
-     */
-    double computeDistanceToClosestEdge ( const Eigen::Vector3d& bodyFixedPosition,
-                                          const Eigen::MatrixXi& verticesDefiningEachEdgeToEvaluate );
-
-    /*! Computes the matrix with the indices of the vertices defining each edge.
-     *
-     * Computes the matrix with the indices of the vertices defining each edge; saves the list to verticesDefiningEachEdge_.
-     */
-    void computeVerticesDefiningEachEdge( );
+    // Function to return the bounding volume hierarchy used for distance queries.
+    std::shared_ptr< basic_mathematics::PolyhedronBoundingVolumeHierarchy > getBoundingVolumeHierarchy( )
+    {
+        return boundingVolumeHierarchy_;
+    }
 
+private:
 
     // Matrix with coordinates of the polyhedron vertices.
     Eigen::MatrixXd verticesCoordinates_;
@@ -169,8 +136,8 @@ private:
     // Matrix with the indices (0 indexed) of the vertices defining each facet.
     Eigen::MatrixXi verticesDefiningEachFacet_;
 
-    // Matrix with the indices (0 indexed) of the vertices defining each edge.
-    Eigen::MatrixXi verticesDefiningEachEdge_;
+    // Bounding volume hierarchy of the polyhedron facets, used for distance queries.
+    std::shared_ptr< basic_mathematics::PolyhedronBoundingVolumeHierarchy > boundingVolumeHierarchy_;
 
     // Flag indicating whether the altitude should be computed with sign (i.e. >0 if above surface, <0 otherwise) or
     // having always a positive value
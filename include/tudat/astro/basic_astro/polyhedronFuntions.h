@@ -11,6 +11,8 @@
  *      A. Dobrovolskis (1996), "Inertia of Any Polyhedron", Icarus, 124 (243), 698-704
  *      D.J. Scheeres (2012), "Orbital Motion in Strongly Perturbed Environments: Applications to Asteroid, Comet and
  *          Planetary Satellite Orbiters", Springer-Praxis.
+ *      R.A. Werner (1997), "Spherical harmonic coefficients for the potential of a constant-density polyhedron",
+ *          Computers & Geosciences, 23 (10), 1071-1077.
  */
 
 #ifndef TUDAT_POLYHEDRONFUNTIONS_H
@@ -116,6 +118,40 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
                                                 const double gravitationalParameter,
                                                 const double gravitationalConstant );
 
+/*! Computes the brillouin radius of a polyhedron.
+ *
+ * Computes the brillouin radius of a polyhedron, i.e. the radius of the smallest sphere centered at the origin that
+ * encloses the polyhedron, which is the maximum distance from the origin to any of the vertices.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @return Brillouin radius.
+ */
+double computePolyhedronBrillouinRadius( const Eigen::MatrixXd& verticesCoordinates );
+
+/*! Computes the spherical harmonic coefficients of a constant-density polyhedron.
+ *
+ * Computes the (geodesy-normalized) spherical harmonic coefficients of the exterior gravity field of a constant-density
+ * polyhedron, with respect to the origin of the frame in which the vertices are defined. The coefficients are obtained
+ * from the volume integral of the solid spherical harmonics over the polyhedron (see Werner, 1997), which is split into
+ * the (signed) tetrahedra formed by the origin and each facet. Since the solid harmonics of degree n are homogeneous
+ * polynomials of degree n, the integral over each tetrahedron reduces to a surface integral over the facet (scaled by
+ * h/(n+3), with h the signed distance of the facet plane to the origin), which is evaluated exactly using a Gauss
+ * quadrature rule on the facet.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @param maximumDegree Maximum degree (and order) of the coefficients.
+ * @param referenceRadius Reference radius of the spherical harmonic expansion.
+ * @param cosineCoefficients Cosine spherical harmonic coefficients (returned by reference).
+ * @param sineCoefficients Sine spherical harmonic coefficients (returned by reference).
+ */
+void computePolyhedronSphericalHarmonicCoefficients( const Eigen::MatrixXd& verticesCoordinates,
+                                                     const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                     const int maximumDegree,
+                                                     const double referenceRadius,
+                                                     Eigen::MatrixXd& cosineCoefficients,
+                                                     Eigen::MatrixXd& sineCoefficients );
+
 } // namespace basic_astrodynamics
 } // namespace tudat
 
@@ -13,6 +13,7 @@
 #define TUDAT_SHORTPERIODEARTHORIENTATIONCORRECTIONCALCULATOR_H
 
 
+#include <cmath>
 #include <string>
 
 #include <functional>
@@ -22,6 +23,7 @@
 #include <Eigen/Core>
 
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/basic_astro/timeConversions.h"
@@ -67,7 +69,13 @@ public:
             const std::function< Eigen::Vector6d( const double )  > argumentFunction =
             std::bind( &sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ),
             const std::shared_ptr< interpolators::InterpolatorGenerationSettings< double > > shortTermInterpolatorSettings = nullptr ):
-        argumentFunction_( argumentFunction )
+        argumentFunction_( argumentFunction ),
+        useIncrementalEvaluation_( false ),
+        maximumIncrementalTimeStep_( 0.0 ),
+        maximumNumberOfIncrementalSteps_( 0 ),
+        numberOfIncrementalSteps_( 0 ),
+        numberOfIncrementalEvaluations_( 0 ),
+        previousTime_( TUDAT_NAN )
     {
         if( amplitudesFiles.size( ) != argumentMultipliersFile.size( ) )
         {
@@ -75,14 +83,62 @@ public:
         }
 
         // Read data from files
+        std::vector< Eigen::MatrixXd > amplitudesPerFile;
+        std::vector< Eigen::MatrixXd > argumentMultipliersPerFile;
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd > dataFromFile;
+        int numberOfTerms = 0;
+        const int numberOfComponents = getNumberOfCorrectionComponents( );
         for( unsigned int i = 0; i < amplitudesFiles.size( ); i++ )
         {
             dataFromFile = readAmplitudesAndFundamentalArgumentMultipliers(
                         amplitudesFiles.at( i ), argumentMultipliersFile.at( i ), minimumAmplitude );
-            argumentAmplitudes_.push_back( conversionFactor * dataFromFile.first );
-            argumentMultipliers_.push_back( dataFromFile.second );
+            if( dataFromFile.first.rows( ) > 0 && dataFromFile.first.cols( ) < 2 * numberOfComponents )
+            {
+                throw std::runtime_error( "Error when calling ShortPeriodEarthOrientationCorrectionCalculator, file " +
+                                          amplitudesFiles.at( i ) + " contains " +
+                                          std::to_string( dataFromFile.first.cols( ) ) + " amplitude columns, expected " +
+                                          std::to_string( 2 * numberOfComponents ) );
+            }
+            amplitudesPerFile.push_back( conversionFactor * dataFromFile.first );
+            argumentMultipliersPerFile.push_back( dataFromFile.second );
+
+            termBlockStartIndices_.push_back( numberOfTerms );
+            numberOfTerms += dataFromFile.first.rows( );
+        }
+        termBlockStartIndices_.push_back( numberOfTerms );
+
+        // Store all terms in a single table, with (for each quantity) the values of all terms contiguous in memory
+        termArgumentMultipliers_.resize( numberOfTerms, 6 );
+        termSineAmplitudes_.resize( numberOfTerms, numberOfComponents );
+        termCosineAmplitudes_.resize( numberOfTerms, numberOfComponents );
+        for( unsigned int i = 0; i < amplitudesPerFile.size( ); i++ )
+        {
+            int blockStartIndex = termBlockStartIndices_.at( i );
+            int blockSize = amplitudesPerFile.at( i ).rows( );
+            if( blockSize == 0 )
+            {
+                continue;
+            }
+            termArgumentMultipliers_.block( blockStartIndex, 0, blockSize, 6 ) =
+                    argumentMultipliersPerFile.at( i ).block( 0, 0, blockSize, 6 );
+            for( int j = 0; j < numberOfComponents; j++ )
+            {
+                termSineAmplitudes_.block( blockStartIndex, j, blockSize, 1 ) = amplitudesPerFile.at( i ).col( 2 * j );
+                termCosineAmplitudes_.block( blockStartIndex, j, blockSize, 1 ) =
+                        amplitudesPerFile.at( i ).col( 2 * j + 1 );
+            }
         }
+        termSines_.resize( numberOfTerms );
+        termCosines_.resize( numberOfTerms );
+
+        termArgumentChanges_.resize( numberOfTerms );
+        termArgumentChangeSines_.resize( numberOfTerms );
+        termArgumentChangeCosines_.resize( numberOfTerms );
+        updatedTermSines_.resize( numberOfTerms );
+
+        // Check if multipliers are integers, in which case full revolutions of fundamental arguments may be ignored
+        areArgumentMultipliersIntegers_ = ( termArgumentMultipliers_.array( ) ==
+                                            termArgumentMultipliers_.array( ).round( ) ).all( );
 
         if( shortTermInterpolatorSettings != nullptr )
         {
@@ -107,13 +163,17 @@ public:
      */
     OutputType getCorrections( const double& ephemerisTime )
     {
-        if( correctionInterpolator_ == nullptr )
+        if( correctionInterpolator_ != nullptr )
         {
-            return sumCorrectionTerms( argumentFunction_( ephemerisTime ));
+            return correctionInterpolator_->interpolate( ephemerisTime );
+        }
+        else if( useIncrementalEvaluation_ )
+        {
+            return getCorrectionsIncrementally( ephemerisTime );
         }
         else
         {
-            return correctionInterpolator_->interpolate( ephemerisTime );
+            return sumCorrectionTerms( argumentFunction_( ephemerisTime ) );
         }
     }
 
@@ -129,29 +189,286 @@ public:
         return sumCorrectionTerms( fundamentalArguments );
     }
 
+    //! Function to set whether the corrections are evaluated incrementally for closely spaced times
+    /*!
+     *  Function to set whether the corrections are evaluated incrementally for closely spaced times. In incremental
+     *  evaluation, the sine and cosine of each term argument are not recomputed, but are propagated from those at the
+     *  previous time by angle-addition relations. The sine and cosine of the (small) change in each term argument are
+     *  computed from a truncated power series, so that no trigonometric functions need to be evaluated per term.
+     *  Incremental evaluation is used when the time differs by at most maximumIncrementalTimeStep from that of the
+     *  previous call, and the change of all term arguments is at most 0.05 rad (for which the series is accurate to
+     *  machine precision). After maximumNumberOfIncrementalSteps successive incremental evaluations, the terms are
+     *  recomputed directly, to limit the accumulation of rounding errors. Whereas direct evaluation does not modify the
+     *  object, incremental evaluation stores the terms of the previous call, so that a calculator for which it is
+     *  enabled must not be used from multiple threads concurrently (nor be shared with the process-wide
+     *  defaultTimeConverter).
+     *  \param useIncrementalEvaluation Boolean denoting whether incremental evaluation is to be used
+     *  \param maximumIncrementalTimeStep Maximum time difference w.r.t. previous call for which incremental evaluation is used
+     *  \param maximumNumberOfIncrementalSteps Maximum number of successive incremental evaluations
+     */
+    void setIncrementalEvaluation( const bool useIncrementalEvaluation,
+                                   const double maximumIncrementalTimeStep = 60.0,
+                                   const unsigned int maximumNumberOfIncrementalSteps = 100 )
+    {
+        useIncrementalEvaluation_ = useIncrementalEvaluation;
+        maximumIncrementalTimeStep_ = maximumIncrementalTimeStep;
+        maximumNumberOfIncrementalSteps_ = maximumNumberOfIncrementalSteps;
+        numberOfIncrementalEvaluations_ = 0;
+        previousTime_ = TUDAT_NAN;
+    }
+
+    //! Function to retrieve whether the corrections are evaluated incrementally for closely spaced times
+    /*!
+     *  Function to retrieve whether the corrections are evaluated incrementally for closely spaced times
+     *  \return Boolean denoting whether incremental evaluation is used
+     */
+    bool getUseIncrementalEvaluation( )
+    {
+        return useIncrementalEvaluation_;
+    }
+
+    //! Function to retrieve the total number of correction terms
+    /*!
+     *  Function to retrieve the total number of correction terms
+     *  \return Total number of correction terms
+     */
+    int getNumberOfTerms( )
+    {
+        return termArgumentMultipliers_.rows( );
+    }
+
+    //! Function to retrieve the number of evaluations in which the terms were updated incrementally
+    /*!
+     *  Function to retrieve the total number of evaluations in which the terms were updated incrementally (rather than
+     *  computed directly), since the incremental evaluation was last set.
+     *  \return Number of incremental evaluations
+     */
+    unsigned int getNumberOfIncrementalEvaluations( )
+    {
+        return numberOfIncrementalEvaluations_;
+    }
+
 private:
 
     //! Function to sum all the corrcetion terms.
     /*!
-     *  Function to sum all the corrcetion terms.
+     *  Function to sum all the corrcetion terms, computing the sines and cosines of the term arguments directly (without
+     *  modifying the object).
      * \param arguments Values of fundamental arguments
      * \return Total correction at current fundamental arguments
      */
-    OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments );
+    OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments )
+    {
+        Eigen::VectorXd termArguments = termArgumentMultipliers_ * arguments;
+        return sumTrigonometricTerms( termArguments.array( ).sin( ).matrix( ), termArguments.array( ).cos( ).matrix( ) );
+    }
+
+    //! Function to obtain short period corrections, using incremental evaluation when possible
+    /*!
+     *  Function to obtain short period corrections, using incremental evaluation if the time is sufficiently close to
+     *  that of the previous call (see setIncrementalEvaluation).
+     *  \param ephemerisTime Time (TDB seconds since J2000) at which corretions are to be determined
+     *  \return Short period corrections
+     */
+    OutputType getCorrectionsIncrementally( const double ephemerisTime )
+    {
+        Eigen::Vector6d arguments = argumentFunction_( ephemerisTime );
+        if( !( std::fabs( ephemerisTime - previousTime_ ) <= maximumIncrementalTimeStep_ &&
+               numberOfIncrementalSteps_ < maximumNumberOfIncrementalSteps_ &&
+               updateTrigonometricTermsIncrementally( arguments ) ) )
+        {
+            computeTrigonometricTerms( arguments );
+            numberOfIncrementalSteps_ = 0;
+        }
+        else
+        {
+            numberOfIncrementalSteps_++;
+            numberOfIncrementalEvaluations_++;
+        }
+        previousArguments_ = arguments;
+        previousTime_ = ephemerisTime;
 
-    //! Amplitudes of libration-induced variations
-    std::vector< Eigen::MatrixXd > argumentAmplitudes_;
+        return sumTrigonometricTerms( termSines_, termCosines_ );
+    }
 
-    //! Fundamental argument multipliers of libration-induced variations.
-    std::vector< Eigen::MatrixXd > argumentMultipliers_;
+    //! Function to directly compute the stored sine and cosine of the arguments of all terms (for incremental evaluation)
+    /*!
+     *  Function to directly compute the stored sine and cosine of the arguments of all terms, from the fundamental
+     *  arguments, as the starting point of subsequent incremental updates.
+     * \param arguments Values of fundamental arguments
+     */
+    void computeTrigonometricTerms( const Eigen::Vector6d& arguments )
+    {
+        termArgumentChanges_.noalias( ) = termArgumentMultipliers_ * arguments;
+        termSines_ = termArgumentChanges_.array( ).sin( );
+        termCosines_ = termArgumentChanges_.array( ).cos( );
+    }
+
+    //! Function to update the sine and cosine of the arguments of all terms, from their values at the previous arguments
+    /*!
+     *  Function to update the sine and cosine of the arguments of all terms, from their values at the previous arguments,
+     *  using angle-addition relations (see setIncrementalEvaluation). No update is performed if the change in any
+     *  of the term arguments is too large.
+     * \param arguments Values of fundamental arguments
+     * \return True if the update was performed, false if the terms are to be computed directly
+     */
+    bool updateTrigonometricTermsIncrementally( const Eigen::Vector6d& arguments )
+    {
+        // Compute change in term arguments, removing full revolutions of fundamental arguments if possible
+        Eigen::Vector6d argumentChanges = arguments - previousArguments_;
+        if( areArgumentMultipliersIntegers_ )
+        {
+            argumentChanges -= 2.0 * mathematical_constants::PI *
+                    ( argumentChanges / ( 2.0 * mathematical_constants::PI ) ).array( ).round( ).matrix( );
+        }
+        termArgumentChanges_.noalias( ) = termArgumentMultipliers_ * argumentChanges;
+
+        bool isUpdatePerformed = false;
+        if( termArgumentChanges_.rows( ) == 0 || termArgumentChanges_.cwiseAbs( ).maxCoeff( ) <= 0.05 )
+        {
+            // Compute sine and cosine of term argument changes from power series (truncation error < 1.0E-17)
+            termArgumentChangeCosines_ = termArgumentChanges_.array( ).square( );
+            termArgumentChangeSines_ = termArgumentChanges_.array( ) * (
+                        1.0 - termArgumentChangeCosines_ * ( 1.0 / 6.0 ) * (
+                            1.0 - termArgumentChangeCosines_ * ( 1.0 / 20.0 ) * (
+                                1.0 - termArgumentChangeCosines_ * ( 1.0 / 42.0 ) ) ) );
+            termArgumentChangeCosines_ = 1.0 - termArgumentChangeCosines_ * ( 1.0 / 2.0 ) * (
+                        1.0 - termArgumentChangeCosines_ * ( 1.0 / 12.0 ) * (
+                            1.0 - termArgumentChangeCosines_ * ( 1.0 / 30.0 ) * (
+                                1.0 - termArgumentChangeCosines_ * ( 1.0 / 56.0 ) ) ) );
+
+            // Rotate sine and cosine of each term argument by its change
+            updatedTermSines_ = termSines_.array( ) * termArgumentChangeCosines_ +
+                    termCosines_.array( ) * termArgumentChangeSines_;
+            termCosines_.array( ) = termCosines_.array( ) * termArgumentChangeCosines_ -
+                    termSines_.array( ) * termArgumentChangeSines_;
+            termSines_.swap( updatedTermSines_ );
+            isUpdatePerformed = true;
+        }
+        return isUpdatePerformed;
+    }
+
+    //! Function to sum the contributions of all terms to each correction component, from sines and cosines of arguments
+    /*!
+     *  Function to sum the contributions of all terms to each correction component, from the sines and cosines of the
+     *  term arguments. Terms are summed per correction file, and the results added in order.
+     * \param termSines Sines of the arguments of all terms
+     * \param termCosines Cosines of the arguments of all terms
+     * \return Total correction for each component
+     */
+    Eigen::VectorXd sumTrigonometricTermComponents( const Eigen::VectorXd& termSines, const Eigen::VectorXd& termCosines )
+    {
+        Eigen::VectorXd correctionComponents = Eigen::VectorXd::Zero( termSineAmplitudes_.cols( ) );
+        for( unsigned int i = 0; i + 1 < termBlockStartIndices_.size( ); i++ )
+        {
+            int blockStartIndex = termBlockStartIndices_.at( i );
+            int blockSize = termBlockStartIndices_.at( i + 1 ) - blockStartIndex;
+            correctionComponents +=
+                    termSineAmplitudes_.middleRows( blockStartIndex, blockSize ).transpose( ) *
+                    termSines.segment( blockStartIndex, blockSize ) +
+                    termCosineAmplitudes_.middleRows( blockStartIndex, blockSize ).transpose( ) *
+                    termCosines.segment( blockStartIndex, blockSize );
+        }
+        return correctionComponents;
+    }
+
+    //! Function to retrieve the number of components of the correction (1 for UT1, 2 for polar motion)
+    /*!
+     *  Function to retrieve the number of components of the correction, as defined by the output type (1 for UT1, 2 for
+     *  polar motion). The term tables always have this number of columns, so that a calculator without any terms
+     *  returns a zero correction.
+     *  \return Number of components of the correction
+     */
+    static int getNumberOfCorrectionComponents( );
+
+    //! Function to sum all the correction terms, from sines and cosines of the term arguments
+    /*!
+     *  Function to sum all the correction terms, from sines and cosines of the term arguments
+     * \param termSines Sines of the arguments of all terms
+     * \param termCosines Cosines of the arguments of all terms
+     * \return Total correction at current fundamental arguments
+     */
+    OutputType sumTrigonometricTerms( const Eigen::VectorXd& termSines, const Eigen::VectorXd& termCosines );
+
+    //! Fundamental argument multipliers of all terms (one row per term)
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > termArgumentMultipliers_;
+
+    //! Sine amplitudes of all terms (one row per term, one column per correction component)
+    Eigen::MatrixXd termSineAmplitudes_;
+
+    //! Cosine amplitudes of all terms (one row per term, one column per correction component)
+    Eigen::MatrixXd termCosineAmplitudes_;
+
+    //! Index of first term from each correction file in term tables, with total number of terms as final entry
+    std::vector< int > termBlockStartIndices_;
+
+    //! Sines of the arguments of all terms at previous evaluation (incremental evaluation only)
+    Eigen::VectorXd termSines_;
+
+    //! Cosines of the arguments of all terms at previous evaluation (incremental evaluation only)
+    Eigen::VectorXd termCosines_;
 
     //! Fundamental argument functions associated with multipliers.
     std::function< Eigen::Vector6d( const double ) > argumentFunction_;
 
+    //! Boolean denoting whether all fundamental argument multipliers are integers
+    bool areArgumentMultipliersIntegers_;
+
+    //! Boolean denoting whether the corrections are evaluated incrementally for closely spaced times
+    bool useIncrementalEvaluation_;
+
+    //! Maximum time difference w.r.t. previous call for which incremental evaluation is used
+    double maximumIncrementalTimeStep_;
+
+    //! Maximum number of successive incremental evaluations
+    unsigned int maximumNumberOfIncrementalSteps_;
+
+    //! Number of successive incremental evaluations since last direct evaluation
+    unsigned int numberOfIncrementalSteps_;
+
+    //! Total number of incremental evaluations since incremental evaluation was last set
+    unsigned int numberOfIncrementalEvaluations_;
+
+    //! Time of previous evaluation (NaN if sines and cosines do not correspond to a known time)
+    double previousTime_;
+
+    //! Fundamental arguments at previous evaluation
+    Eigen::Vector6d previousArguments_;
+
+    //! Changes in arguments of all terms w.r.t. previous evaluation (or arguments of all terms, when set directly)
+    Eigen::VectorXd termArgumentChanges_;
+
+    //! Sines of argument changes of all terms
+    Eigen::ArrayXd termArgumentChangeSines_;
+
+    //! Cosines of argument changes of all terms
+    Eigen::ArrayXd termArgumentChangeCosines_;
+
+    //! Pre-allocated vector for updated sines of the arguments of all terms
+    Eigen::VectorXd updatedTermSines_;
+
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, OutputType > > correctionInterpolator_;
 
 };
 
+//! Function to retrieve the number of components of the correction (1 for UT1, 2 for polar motion)
+template< >
+int ShortPeriodEarthOrientationCorrectionCalculator< double >::getNumberOfCorrectionComponents( );
+
+//! Function to retrieve the number of components of the correction (1 for UT1, 2 for polar motion)
+template< >
+int ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d >::getNumberOfCorrectionComponents( );
+
+//! Function to sum all the correction terms, from sines and cosines of the term arguments
+template< >
+double ShortPeriodEarthOrientationCorrectionCalculator< double >::sumTrigonometricTerms(
+        const Eigen::VectorXd& termSines, const Eigen::VectorXd& termCosines );
+
+//! Function to sum all the correction terms, from sines and cosines of the term arguments
+template< >
+Eigen::Vector2d ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d >::sumTrigonometricTerms(
+        const Eigen::VectorXd& termSines, const Eigen::VectorXd& termCosines );
+
 //! Function to retrieve the default UT1 short-period correction calculator
 /*!
  * Function to retrieve the default UT1 short-period correction calculator, from Tables  5.1, 8.2 and 8.2. of IERS 2010
@@ -0,0 +1,188 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that determines an ephemeris from a set of Chebyshev polynomial granules.
+/*!
+ *  Class that determines an ephemeris from a set of Chebyshev polynomial granules, each of which represents the position
+ *  of the body on a (variable-length) time interval, in the same manner as a record of an SPK type 2 segment. The
+ *  velocity is computed from the analytical derivative of the position polynomials, so that position and velocity are
+ *  mutually consistent. The granule containing a given epoch is found in constant time from a uniform bucket table.
+ *  Compared to a TabulatedCartesianEphemeris, which stores every state of the data from which it is created, this
+ *  representation is typically orders of magnitude more compact for smooth orbits. An object of this type is typically
+ *  created from a state history by the createChebyshevEphemerisFromStateHistory function, and may be stored to/read
+ *  from a compact binary file by the writeChebyshevEphemerisToFile/readChebyshevEphemerisFromFile functions.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor, from granule data
+    /*!
+     *  Constructor, from granule data
+     *  \param granuleBoundaries Boundaries of the time intervals of the granules (size: number of granules + 1), in
+     *  strictly increasing order.
+     *  \param granuleCoefficients Chebyshev coefficients of the granules, stored per granule as the coefficients of
+     *  degree 0 to polynomialDegree for x, y and z (size: number of granules * 3 * ( polynomialDegree + 1 ) ).
+     *  \param polynomialDegree Degree of the Chebyshev polynomials of each granule
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     */
+    ChebyshevEphemeris( const std::vector< double >& granuleBoundaries,
+                        const std::vector< double >& granuleCoefficients,
+                        const int polynomialDegree,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Destructor
+    ~ChebyshevEphemeris( ){ }
+
+    //! Get cartesian state from ephemeris.
+    /*!
+     *  Returns cartesian state from ephemeris, evaluated from the granule containing the requested time. An exception is
+     *  thrown if the time is outside of the interval covered by the granules.
+     *  \param secondsSinceEpoch Seconds since epoch.
+     *  \return State in Cartesian elements from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to retrieve the index of the granule containing a given time
+    /*!
+     *  Function to retrieve the index of the granule containing a given time, using the bucket table. At a boundary
+     *  between two granules, the later granule is used. An exception is thrown if the time is outside of the interval
+     *  covered by the granules.
+     *  \param secondsSinceEpoch Time for which the granule is to be retrieved
+     *  \return Index of the granule containing the requested time.
+     */
+    int getGranuleIndex( const double secondsSinceEpoch ) const;
+
+    //! Function to retrieve the boundaries of the time intervals of the granules
+    const std::vector< double >& getGranuleBoundaries( ) const
+    {
+        return granuleBoundaries_;
+    }
+
+    //! Function to retrieve the Chebyshev coefficients of the granules
+    const std::vector< double >& getGranuleCoefficients( ) const
+    {
+        return granuleCoefficients_;
+    }
+
+    //! Function to retrieve the degree of the Chebyshev polynomials of each granule
+    int getPolynomialDegree( ) const
+    {
+        return polynomialDegree_;
+    }
+
+    //! Function to retrieve the number of granules
+    int getNumberOfGranules( ) const
+    {
+        return static_cast< int >( granuleBoundaries_.size( ) ) - 1;
+    }
+
+    //! Function to retrieve the interval of time covered by the granules
+    std::pair< double, double > getValidityInterval( ) const
+    {
+        return std::make_pair( granuleBoundaries_.front( ), granuleBoundaries_.back( ) );
+    }
+
+private:
+
+    //! Boundaries of the time intervals of the granules (size: number of granules + 1)
+    std::vector< double > granuleBoundaries_;
+
+    //! Chebyshev coefficients of the granules, stored per granule as coefficients for x, y and z
+    std::vector< double > granuleCoefficients_;
+
+    //! Degree of the Chebyshev polynomials of each granule
+    int polynomialDegree_;
+
+    //! Number of coefficients per granule (3 * ( polynomialDegree_ + 1 ) )
+    int coefficientsPerGranule_;
+
+    //! Width of the buckets of the granule lookup table
+    double bucketWidth_;
+
+    //! Index of the granule containing the start of each bucket of the lookup table
+    std::vector< int > bucketGranuleIndices_;
+};
+
+//! Function to fit a Chebyshev ephemeris to a state history, with adaptive granule length
+/*!
+ *  Function to fit a Chebyshev ephemeris to a state history, with adaptive granule length. Each granule is fitted to
+ *  the positions and velocities of the state history in its interval, in a least-squares sense, with the velocity
+ *  constraints derived from the same polynomials as the positions. Starting from granules of at most
+ *  maximumGranuleDuration, a granule for which the position (or velocity) residual at any of the states in its interval
+ *  exceeds the tolerance is bisected, until the tolerance is met, or until the granule contains too few states to be
+ *  bisected further (in which case a warning is printed).
+ *  \param stateHistory State history (time as key, Cartesian state as values) to which the ephemeris is to be fitted.
+ *  The states should be sampled densely enough to resolve the dynamics (as is the case for numerical propagation
+ *  results).
+ *  \param positionTolerance Maximum position residual of the fit at the states of the history
+ *  \param velocityTolerance Maximum velocity residual of the fit at the states of the history (not checked if NaN)
+ *  \param polynomialDegree Degree of the Chebyshev polynomials of each granule
+ *  \param maximumGranuleDuration Maximum duration of a single granule (no maximum if NaN)
+ *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ *  \return Chebyshev ephemeris fitted to the state history
+ */
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemerisFromStateHistory(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const double positionTolerance,
+        const double velocityTolerance = TUDAT_NAN,
+        const int polynomialDegree = 13,
+        const double maximumGranuleDuration = TUDAT_NAN,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+//! Function to write a Chebyshev ephemeris to a binary file
+/*!
+ *  Function to write a Chebyshev ephemeris to a binary file. The file consists of a header (identifier, format version,
+ *  polynomial degree, number of granules and frame origin/orientation), the granule boundaries, and one fixed-size
+ *  record per granule with (as in an SPK type 2 segment) the coefficients for x, y and z. The boundaries are stored
+ *  instead of the midpoint and half-length of each interval, so that an ephemeris read from file reproduces the
+ *  original one exactly. Data is written in the native byte order of the machine.
+ *  \param ephemeris Ephemeris that is to be written to file
+ *  \param fileName Name of the file to which the ephemeris is to be written
+ */
+void writeChebyshevEphemerisToFile( const std::shared_ptr< ChebyshevEphemeris > ephemeris,
+                                    const std::string& fileName );
+
+//! Function to read a Chebyshev ephemeris from a binary file
+/*!
+ *  Function to read a Chebyshev ephemeris from a binary file, as written by writeChebyshevEphemerisToFile.
+ *  \param fileName Name of the file from which the ephemeris is to be read
+ *  \return Chebyshev ephemeris read from the file
+ */
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFromFile( const std::string& fileName );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
@@ -0,0 +1,199 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_NATIVESPICEEPHEMERIS_H
+#define TUDAT_NATIVESPICEEPHEMERIS_H
+
+#include <memory>
+#include <string>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/astro/ephemerides/rotationalEphemeris.h"
+#include "tudat/io/spiceKernelReader.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class to calculate the state of a body directly from SPK kernel(s), without use of CSPICE
+/*!
+ *  Class to calculate the state of a body directly from SPK kernel(s), without use of CSPICE. The kernel data is read
+ *  by the native SpiceKernelCollection reader, so that (unlike the SpiceEphemeris) this ephemeris may be used
+ *  concurrently from multiple threads, and avoids the overhead of the segment search and frame resolution of CSPICE.
+ *  Only geometric states (without aberration corrections), in the J2000 or ECLIPJ2000 frame, are supported.
+ */
+class NativeSpiceEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param kernelCollection Collection of SPICE kernels from which the state is to be retrieved
+     *  \param targetBodyId NAIF integer code of the body of which the state is to be retrieved
+     *  \param observerBodyId NAIF integer code of the body w.r.t. which the state is to be retrieved
+     *  \param referenceFrameOrigin Name of the body w.r.t. which the state is to be retrieved
+     *  \param referenceFrameOrientation Name of the frame in which the state is to be retrieved (J2000 or ECLIPJ2000)
+     */
+    NativeSpiceEphemeris( const std::shared_ptr< input_output::SpiceKernelCollection > kernelCollection,
+                          const int targetBodyId,
+                          const int observerBodyId,
+                          const std::string& referenceFrameOrigin = "SSB",
+                          const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Function to calculate the Cartesian state of the body
+    /*!
+     *  Function to calculate the Cartesian state of the body, from the SPK kernel(s)
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Cartesian state of the body (in m and m/s)
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to retrieve the collection of SPICE kernels from which the state is retrieved
+    std::shared_ptr< input_output::SpiceKernelCollection > getKernelCollection( )
+    {
+        return kernelCollection_;
+    }
+
+    //! Function to retrieve the NAIF integer code of the body of which the state is retrieved
+    int getTargetBodyId( )
+    {
+        return targetBodyId_;
+    }
+
+    //! Function to retrieve the NAIF integer code of the body w.r.t. which the state is retrieved
+    int getObserverBodyId( )
+    {
+        return observerBodyId_;
+    }
+
+private:
+
+    //! Collection of SPICE kernels from which the state is retrieved
+    std::shared_ptr< input_output::SpiceKernelCollection > kernelCollection_;
+
+    //! NAIF integer code of the body of which the state is retrieved
+    int targetBodyId_;
+
+    //! NAIF integer code of the body w.r.t. which the state is retrieved
+    int observerBodyId_;
+
+    //! NAIF integer code of the frame in which the state is retrieved
+    int frameId_;
+};
+
+//! Class to calculate the rotational state of a body directly from binary PCK kernel(s), without use of CSPICE
+/*!
+ *  Class to calculate the rotational state of a body directly from binary PCK kernel(s), without use of CSPICE. The
+ *  kernel data is read by the native SpiceKernelCollection reader, so that (unlike the SpiceRotationalEphemeris) this
+ *  rotational ephemeris may be used concurrently from multiple threads. The base frame must be J2000 or ECLIPJ2000.
+ */
+class NativeSpiceRotationalEphemeris : public RotationalEphemeris
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param kernelCollection Collection of SPICE kernels from which the orientation is to be retrieved
+     *  \param frameClassId NAIF integer code of the body-fixed frame class in the binary PCK kernel(s) (e.g. 3000 for
+     *  ITRF93)
+     *  \param baseFrameOrientation Base frame identifier (J2000 or ECLIPJ2000)
+     *  \param targetFrameOrientation Target frame identifier
+     */
+    NativeSpiceRotationalEphemeris( const std::shared_ptr< input_output::SpiceKernelCollection > kernelCollection,
+                                    const int frameClassId,
+                                    const std::string& baseFrameOrientation,
+                                    const std::string& targetFrameOrientation );
+
+    //! Function to calculate the rotation quaternion from target frame to base frame.
+    /*!
+     *  Function to calculate the rotation quaternion from target frame to base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Rotation from target (typically local) to base (typically global) frame at specified time.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        return getRotationToTargetFrame( secondsSinceEpoch ).inverse( );
+    }
+
+    //! Function to calculate the rotation quaternion from base frame to target frame.
+    /*!
+     *  Function to calculate the rotation quaternion from base frame to target frame at specified time.
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Rotation from base (typically global) to target (typically local) frame at specified time.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to base frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from target (typically local) to base (typically global) frame at specified
+     *  time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch ).transpose( );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from base frame to target frame at specified time.
+     *  \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from base (typically global) to target (typically local) frame at specified
+     *  time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     * Function to calculate the full rotational state at given time (rotation matrix, derivative of
+     * rotation matrix and angular velocity vector), using a single evaluation of the kernel data.
+     * \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     * \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local
+     * frame (returned by reference)
+     * \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed
+     * in global frame (returned by reference)
+     * \param secondsSinceEpoch Seconds since J2000 (TDB) at which ephemeris is to be evaluated.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch );
+
+    //! Function to retrieve the NAIF integer code of the body-fixed frame class
+    int getFrameClassId( )
+    {
+        return frameClassId_;
+    }
+
+private:
+
+    //! Collection of SPICE kernels from which the orientation is retrieved
+    std::shared_ptr< input_output::SpiceKernelCollection > kernelCollection_;
+
+    //! NAIF integer code of the body-fixed frame class
+    int frameClassId_;
+
+    //! NAIF integer code of the base frame
+    int baseFrameId_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_NATIVESPICEEPHEMERIS_H
@@ -0,0 +1,284 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PRECOMPUTEDROTATIONALEPHEMERIS_H
+#define TUDAT_PRECOMPUTEDROTATIONALEPHEMERIS_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tudat/astro/ephemerides/rotationalEphemeris.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Rotation rate of the Earth rotation angle (in rad/s of UT1), as defined by the IERS 2010 conventions
+const double EARTH_ROTATION_ANGLE_RATE = 2.0 * mathematical_constants::PI * 1.00273781191135448 / 86400.0;
+
+//! Class that determines the rotation of a body from a precomputed table, using Hermite interpolation
+/*!
+ *  Class that determines the rotation of a body from a precomputed table on an equidistant time grid, which is typically
+ *  created from a computationally expensive rotation model (such as the GcrsToItrsRotationModel) by the
+ *  createPrecomputedRotationalEphemeris function. The rotation R(t) from base to target frame is split into a nominal
+ *  rotation about the z-axis of the target frame, with constant rate w (e.g. the rate of the Earth rotation angle), and
+ *  a slowly varying residual rotation M(t):
+ *
+ *  R(t) = Rz(w (t - t0)) M(t)
+ *
+ *  with Rz the frame rotation about the z-axis, and t0 the start of the table. The quaternion of M, and its time
+ *  derivative, are stored at each node of the table, and M is computed between the nodes by cubic Hermite interpolation
+ *  of the quaternion, followed by normalization. The derivative of the rotation is computed analytically from the
+ *  interpolating polynomials, so that it is exactly the time derivative of the interpolated rotation.
+ *
+ *  Error budget: the interpolation error of the quaternion of M is bounded by ( h^4 / 384 ) max| d^4 q / dt^4 |, with h
+ *  the time step of the table. For the GCRS->ITRS rotation, with w the rate of the Earth rotation angle, the dominant
+ *  contribution to the fourth derivative comes from the polar motion (amplitude ~ 1.5E-6 rad), which appears in M as a
+ *  diurnal signal. This results in a rotation error of ~2E-11 rad (0.1 mm at the Earth's surface) for h = 1 hour,
+ *  and ~3E-10 rad (2 mm) for h = 2 hours. The error in the rotation rate is of order w times the rotation error. The
+ *  maximum error at the midpoints of the table intervals (where the error of the interpolation is largest) is
+ *  computed when creating the table, and compared to a user-defined tolerance.
+ */
+class PrecomputedRotationalEphemeris : public RotationalEphemeris
+{
+public:
+
+    //! Constructor, from table data
+    /*!
+     *  Constructor, from table data
+     *  \param tableStartTime Time of the first node of the table
+     *  \param tableTimeStep Time step between the nodes of the table
+     *  \param nodeData Data of the nodes of the table, stored per node as the quaternion (w, x, y, z) of the residual
+     *  rotation M, followed by its time derivative (size: number of nodes * 8, with at least 2 nodes).
+     *  \param nominalRotationRate Rate of the nominal rotation about the z-axis of the target frame
+     *  \param baseFrameOrientation Base frame identifier
+     *  \param targetFrameOrientation Target frame identifier
+     *  \param maximumInterpolationError Maximum rotation error (in rad) of the table at the midpoints of its intervals,
+     *  as determined when creating the table (NaN if unknown)
+     */
+    PrecomputedRotationalEphemeris( const double tableStartTime,
+                                    const double tableTimeStep,
+                                    const std::vector< double >& nodeData,
+                                    const double nominalRotationRate,
+                                    const std::string& baseFrameOrientation,
+                                    const std::string& targetFrameOrientation,
+                                    const double maximumInterpolationError = TUDAT_NAN );
+
+    //! Function to calculate the rotation quaternion from target frame to base frame.
+    /*!
+     *  Function to calculate the rotation quaternion from target frame to base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Rotation from target (typically local) to base (typically global) frame at specified time.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        return getRotationToTargetFrame( secondsSinceEpoch ).inverse( );
+    }
+
+    //! Function to calculate the rotation quaternion from base frame to target frame.
+    /*!
+     *  Function to calculate the rotation quaternion from base frame to target frame at specified time. An exception
+     *  is thrown if the time is outside of the interval covered by the table.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Rotation from base (typically global) to target (typically local) frame at specified time.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to base frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from target (typically local) to base (typically global) frame at specified
+     *  time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch ).transpose( );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from base frame to target frame at specified time.
+     *  An exception is thrown if the time is outside of the interval covered by the table.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Derivative of rotation from base (typically global) to target (typically local) frame at specified
+     *  time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     * Function to calculate the full rotational state at given time (rotation matrix, derivative of
+     * rotation matrix and angular velocity vector), using a single interpolation of the table.
+     * \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     * \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local
+     * frame (returned by reference)
+     * \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed
+     * in global frame (returned by reference)
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch );
+
+    //! Function to retrieve the time of the first node of the table
+    double getTableStartTime( ) const
+    {
+        return tableStartTime_;
+    }
+
+    //! Function to retrieve the time of the last node of the table
+    double getTableEndTime( ) const
+    {
+        return tableStartTime_ + static_cast< double >( getNumberOfNodes( ) - 1 ) * tableTimeStep_;
+    }
+
+    //! Function to retrieve the time step between the nodes of the table
+    double getTableTimeStep( ) const
+    {
+        return tableTimeStep_;
+    }
+
+    //! Function to retrieve the number of nodes of the table
+    int getNumberOfNodes( ) const
+    {
+        return static_cast< int >( nodeData_.size( ) / 8 );
+    }
+
+    //! Function to retrieve the data of the nodes of the table (quaternion and its derivative per node)
+    const std::vector< double >& getNodeData( ) const
+    {
+        return nodeData_;
+    }
+
+    //! Function to retrieve the rate of the nominal rotation about the z-axis of the target frame
+    double getNominalRotationRate( ) const
+    {
+        return nominalRotationRate_;
+    }
+
+    //! Function to retrieve the maximum rotation error of the table at the midpoints of its intervals (NaN if unknown)
+    double getMaximumInterpolationError( ) const
+    {
+        return maximumInterpolationError_;
+    }
+
+private:
+
+    //! Function to compute the interpolated rotation, and (optionally) its derivative, from base to target frame
+    /*!
+     *  Function to compute the interpolated rotation, and (optionally) its derivative, from base to target frame
+     *  \param secondsSinceEpoch Time at which the rotation is to be computed
+     *  \param rotationToTargetFrame Rotation from base to target frame (returned by reference)
+     *  \param rotationToTargetFrameDerivative Derivative of rotation matrix from base to target frame (returned by
+     *  reference; not computed if nullptr)
+     */
+    void computeRotationToTargetFrame( const double secondsSinceEpoch,
+                                       Eigen::Quaterniond& rotationToTargetFrame,
+                                       Eigen::Matrix3d* rotationToTargetFrameDerivative );
+
+    //! Time of the first node of the table
+    double tableStartTime_;
+
+    //! Time step between the nodes of the table
+    double tableTimeStep_;
+
+    //! Data of the nodes of the table, stored per node as quaternion (w, x, y, z) of M followed by its derivative
+    std::vector< double > nodeData_;
+
+    //! Rate of the nominal rotation about the z-axis of the target frame
+    double nominalRotationRate_;
+
+    //! Maximum rotation error of the table at the midpoints of its intervals (NaN if unknown)
+    double maximumInterpolationError_;
+};
+
+//! Function to create a precomputed rotational ephemeris from a (computationally expensive) rotation model
+/*!
+ *  Function to create a precomputed rotational ephemeris from a (computationally expensive) rotation model. The residual
+ *  rotation (see PrecomputedRotationalEphemeris) is computed at the nodes of the table from the source rotation model,
+ *  with its derivative obtained from a fourth-order central difference of the residual rotation (which does not rely
+ *  on the accuracy of the rotation rate provided by the source model). Subsequently, the error of the table at the
+ *  midpoints of its intervals is computed by comparison to the source model. If it exceeds the provided tolerance, an
+ *  exception is thrown. The nodes are computed concurrently by the requested number of threads, each of which uses its
+ *  own source rotation model (as the source models are typically not thread-safe).
+ *  \param sourceRotationModelCreationFunction Function that creates a source rotation model (called once per thread).
+ *  The source rotation model should depend only on time (and not on the state of the environment).
+ *  \param startTime Start of the interval that is to be covered by the table
+ *  \param endTime End of the interval that is to be covered by the table
+ *  \param timeStep Time step between the nodes of the table
+ *  \param maximumInterpolationError Maximum rotation error (in rad) of the table at the midpoints of its intervals (not
+ *  checked if NaN)
+ *  \param numberOfThreads Number of threads used to compute the table
+ *  \param nominalRotationRate Rate of the nominal rotation about the z-axis of the target frame, which is factored out
+ *  of the tabulated rotation (if NaN, it is set to the z-component of the angular velocity of the source rotation model,
+ *  in the target frame, at the start time).
+ *  \return Precomputed rotational ephemeris
+ */
+std::shared_ptr< PrecomputedRotationalEphemeris > createPrecomputedRotationalEphemeris(
+        const std::function< std::shared_ptr< RotationalEphemeris >( ) > sourceRotationModelCreationFunction,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const double maximumInterpolationError = 1.0E-10,
+        const unsigned int numberOfThreads = 1,
+        const double nominalRotationRate = TUDAT_NAN );
+
+//! Function to write a precomputed rotational ephemeris to a binary file
+/*!
+ *  Function to write a precomputed rotational ephemeris to a binary file. The file consists of a header (identifier,
+ *  format version, number of nodes, start time, time step, nominal rotation rate, maximum interpolation error, frame
+ *  identifiers and an identifier of the source rotation model), followed by the node data. Data is written in the
+ *  native byte order of the machine.
+ *  \param rotationalEphemeris Rotational ephemeris that is to be written to file
+ *  \param fileName Name of the file to which the rotational ephemeris is to be written
+ *  \param sourceIdentifier Identifier of the settings of the source rotation model from which the table was computed,
+ *  used to check whether a table read from file is applicable.
+ */
+void writePrecomputedRotationalEphemerisToFile(
+        const std::shared_ptr< PrecomputedRotationalEphemeris > rotationalEphemeris,
+        const std::string& fileName,
+        const std::string& sourceIdentifier = "" );
+
+//! Function to read a precomputed rotational ephemeris from a binary file
+/*!
+ *  Function to read a precomputed rotational ephemeris from a binary file, as written by
+ *  writePrecomputedRotationalEphemerisToFile.
+ *  \param fileName Name of the file from which the rotational ephemeris is to be read
+ *  \param sourceIdentifier Identifier of the settings of the source rotation model from which the table was computed, as
+ *  stored in the file (returned by reference)
+ *  \return Precomputed rotational ephemeris read from the file
+ */
+std::shared_ptr< PrecomputedRotationalEphemeris > readPrecomputedRotationalEphemerisFromFile(
+        const std::string& fileName,
+        std::string& sourceIdentifier );
+
+//! Function to read a precomputed rotational ephemeris from a binary file
+/*!
+ *  Function to read a precomputed rotational ephemeris from a binary file, as written by
+ *  writePrecomputedRotationalEphemerisToFile.
+ *  \param fileName Name of the file from which the rotational ephemeris is to be read
+ *  \return Precomputed rotational ephemeris read from the file
+ */
+std::shared_ptr< PrecomputedRotationalEphemeris > readPrecomputedRotationalEphemerisFromFile(
+        const std::string& fileName );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_PRECOMPUTEDROTATIONALEPHEMERIS_H
@@ -0,0 +1,347 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_GRAVITY_FIELD_GRID_H
+#define TUDAT_GRAVITY_FIELD_GRID_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/interpolators/lookupScheme.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Class holding a single radial layer of a precomputed gravity field grid.
+/*!
+ *  Class holding a single radial layer of a precomputed gravity field grid. The nodes of the layer are equispaced in the
+ *  logarithm of the radius, in latitude (including both poles) and in longitude (periodic). At each node, the Cartesian
+ *  body-fixed components of the acceleration minus the point-mass acceleration are stored.
+ */
+struct GravityFieldGridLayer
+{
+    //! Constructor, sets grid dimensions and allocates memory for the node values.
+    /*!
+     *  Constructor, sets grid dimensions and allocates memory for the node values.
+     *  \param minimumRadius Inner radius of layer.
+     *  \param maximumRadius Outer radius of layer.
+     *  \param numberOfRadialNodes Number of nodes in radial direction.
+     *  \param numberOfLatitudeNodes Number of nodes in latitude direction (including the poles).
+     *  \param numberOfLongitudeNodes Number of nodes in longitude direction.
+     */
+    GravityFieldGridLayer( const double minimumRadius,
+                           const double maximumRadius,
+                           const int numberOfRadialNodes,
+                           const int numberOfLatitudeNodes,
+                           const int numberOfLongitudeNodes );
+
+    //! Function to retrieve the body-fixed position of a grid node.
+    /*!
+     *  Function to retrieve the body-fixed position of a grid node.
+     *  \param radialIndex Index of node in radial direction.
+     *  \param latitudeIndex Index of node in latitude direction.
+     *  \param longitudeIndex Index of node in longitude direction.
+     *  \return Body-fixed Cartesian position of grid node.
+     */
+    Eigen::Vector3d getNodePosition( const double radialIndex,
+                                     const double latitudeIndex,
+                                     const double longitudeIndex ) const;
+
+    //! Function to retrieve the index in the node value vector of the first component of a node.
+    int getNodeValueIndex( const int radialIndex, const int latitudeIndex, const int longitudeIndex ) const
+    {
+        return 3 * ( ( radialIndex * numberOfLatitudeNodes_ + latitudeIndex ) * numberOfLongitudeNodes_ + longitudeIndex );
+    }
+
+    //! Function to retrieve the total number of nodes in the layer.
+    int getNumberOfNodes( ) const
+    {
+        return numberOfRadialNodes_ * numberOfLatitudeNodes_ * numberOfLongitudeNodes_;
+    }
+
+    //! Inner radius of layer.
+    double minimumRadius_;
+
+    //! Outer radius of layer.
+    double maximumRadius_;
+
+    //! Number of nodes in radial direction.
+    int numberOfRadialNodes_;
+
+    //! Number of nodes in latitude direction (including the poles).
+    int numberOfLatitudeNodes_;
+
+    //! Number of nodes in longitude direction.
+    int numberOfLongitudeNodes_;
+
+    //! Step size in logarithm of radius between nodes.
+    double logarithmicRadiusStep_;
+
+    //! Step size in latitude between nodes.
+    double latitudeStep_;
+
+    //! Step size in longitude between nodes.
+    double longitudeStep_;
+
+    //! Acceleration minus point-mass acceleration at the nodes, ordered radius-latitude-longitude-component.
+    std::vector< double > residualAccelerations_;
+
+    //! Maximum difference between interpolated and source acceleration at check points [m/s^2].
+    double maximumAbsoluteError_;
+
+    //! Maximum difference between interpolated and source acceleration at check points, relative to point-mass
+    //! acceleration at the check point.
+    double maximumRelativeError_;
+};
+
+//! Class for a precomputed gravity field grid, from which the acceleration is retrieved by interpolation
+/*!
+ *  Class for a precomputed gravity field grid, from which the acceleration is retrieved by interpolation. The grid is
+ *  built around a body, between a minimum and maximum radius, from an arbitrary source gravity field (typically a
+ *  high-degree spherical harmonic or polyhedron field). The radial range is split into layers of constant
+ *  radius ratio, and the resolution of each layer (in radius and in latitude/longitude) is refined independently until
+ *  the interpolation error at a set of check points between the nodes is below a user-defined tolerance, relative to the
+ *  point-mass acceleration. As a result, layers close to the body use a fine angular grid, and layers far away (where
+ *  the higher-degree signal is attenuated) a coarse one. The point-mass term is computed analytically, so that only the
+ *  (smooth and small) remainder is interpolated, using tensor-product Lagrange interpolation in the logarithm of the
+ *  radius, latitude and longitude. The maximum errors found at the check points are stored per layer, as an estimate of
+ *  the error bound with respect to the source field. Outside of the grid's radial range, the source field is evaluated
+ *  directly.
+ */
+class GravityFieldGrid
+{
+public:
+
+    //! Constructor, generates the grid from the source gravity field.
+    /*!
+     *  Constructor, generates the grid from the source gravity field.
+     *  \param sourceAccelerationFunction Function returning the acceleration of the source field as a function of
+     *  body-fixed position.
+     *  \param gravitationalParameter Gravitational parameter of the source field, used for the point-mass term.
+     *  \param minimumRadius Inner radius of the grid.
+     *  \param maximumRadius Outer radius of the grid.
+     *  \param relativeTolerance Tolerance on interpolation error, relative to the point-mass acceleration.
+     *  \param numberOfInterpolationPoints Number of nodes per dimension used in interpolation (e.g. 4 for tricubic).
+     *  \param layerRadiusRatio Ratio of outer and inner radius of each of the layers.
+     *  \param maximumNumberOfNodesPerLayer Maximum number of nodes per layer; if the tolerance is not met when this
+     *  number is reached, refinement of the layer is stopped and a warning is printed.
+     *  \param numberOfErrorCheckPoints Number of check points per layer at which the interpolation error is evaluated.
+     */
+    GravityFieldGrid( const std::function< Eigen::Vector3d( const Eigen::Vector3d& ) > sourceAccelerationFunction,
+                      const double gravitationalParameter,
+                      const double minimumRadius,
+                      const double maximumRadius,
+                      const double relativeTolerance,
+                      const int numberOfInterpolationPoints = 6,
+                      const double layerRadiusRatio = 1.2,
+                      const int maximumNumberOfNodesPerLayer = 4000000,
+                      const int numberOfErrorCheckPoints = 1000 );
+
+    //! Function to compute the acceleration at a given body-fixed position.
+    /*!
+     *  Function to compute the acceleration at a given body-fixed position, by interpolation if the position is inside
+     *  the grid, and from the source field otherwise.
+     *  \param bodyFixedPosition Body-fixed position at which acceleration is to be computed.
+     *  \return Acceleration at the given position, in body-fixed frame.
+     */
+    Eigen::Vector3d getAcceleration( const Eigen::Vector3d& bodyFixedPosition );
+
+    //! Function to compute the acceleration, and its gradient w.r.t. the position, at a given body-fixed position.
+    /*!
+     *  Function to compute the acceleration, and its gradient w.r.t. the position, at a given body-fixed position. The
+     *  gradient is the exact derivative of the interpolant (plus the point-mass gradient). Exactly on the polar axis,
+     *  the derivatives w.r.t. latitude and longitude are omitted from the gradient. The position must be inside the
+     *  grid, since the source field does not provide a gradient.
+     *  \param bodyFixedPosition Body-fixed position at which acceleration is to be computed.
+     *  \param acceleration Acceleration at the given position, in body-fixed frame (returned by reference).
+     *  \param accelerationGradient Partial derivative of acceleration w.r.t. position (returned by reference).
+     */
+    void getAccelerationAndGradient( const Eigen::Vector3d& bodyFixedPosition,
+                                     Eigen::Vector3d& acceleration,
+                                     Eigen::Matrix3d& accelerationGradient );
+
+    //! Function to compute the difference between the interpolated and source acceleration at a given position.
+    /*!
+     *  Function to compute the difference between the interpolated and source acceleration at a given position,
+     *  relative to the point-mass acceleration at that position. Can be used to verify the grid along a trajectory.
+     *  \param bodyFixedPosition Body-fixed position at which error is to be computed.
+     *  \return Norm of the interpolation error, relative to the point-mass acceleration.
+     */
+    double computeRelativeInterpolationError( const Eigen::Vector3d& bodyFixedPosition );
+
+    //! Function to check whether a position is inside the radial range of the grid.
+    bool isPositionInsideGrid( const Eigen::Vector3d& bodyFixedPosition ) const
+    {
+        double radius = bodyFixedPosition.norm( );
+        return ( radius >= minimumRadius_ && radius <= maximumRadius_ );
+    }
+
+    //! Function to retrieve the gravitational parameter of the source field.
+    double getGravitationalParameter( ) const
+    {
+        return gravitationalParameter_;
+    }
+
+    //! Function to retrieve the inner radius of the grid.
+    double getMinimumRadius( ) const
+    {
+        return minimumRadius_;
+    }
+
+    //! Function to retrieve the outer radius of the grid.
+    double getMaximumRadius( ) const
+    {
+        return maximumRadius_;
+    }
+
+    //! Function to retrieve the tolerance on interpolation error, relative to the point-mass acceleration.
+    double getRelativeTolerance( ) const
+    {
+        return relativeTolerance_;
+    }
+
+    //! Function to retrieve the radial layers of the grid.
+    const std::vector< GravityFieldGridLayer >& getLayers( ) const
+    {
+        return layers_;
+    }
+
+    //! Function to retrieve the total number of nodes in the grid.
+    int getNumberOfNodes( ) const;
+
+    //! Function to retrieve the maximum relative error at the check points, over all layers.
+    double getMaximumRelativeError( ) const;
+
+    //! Function to retrieve the maximum absolute error (in m/s^2) at the check points, over all layers.
+    double getMaximumAbsoluteError( ) const;
+
+    //! Function to retrieve the number of calls for which the position was outside the grid.
+    int getNumberOfEvaluationsOutsideGrid( ) const
+    {
+        return numberOfEvaluationsOutsideGrid_;
+    }
+
+private:
+
+    //! Function to generate a single layer, refining it until the tolerance is met.
+    /*!
+     *  Function to generate a single layer, refining it until the tolerance is met. The radial and angular resolutions
+     *  are refined separately, based on the interpolation error at check points midway between nodes in only the radial
+     *  or only the angular directions. Upon completion, the error at the centres of the grid cells is stored as error
+     *  estimate of the layer.
+     *  \param minimumRadius Inner radius of layer.
+     *  \param maximumRadius Outer radius of layer.
+     *  \return Generated layer.
+     */
+    GravityFieldGridLayer createLayer( const double minimumRadius, const double maximumRadius );
+
+    //! Function to fill the node values of a layer from the source field.
+    void computeLayerNodeValues( GravityFieldGridLayer& layer );
+
+    //! Function to compute the maximum interpolation error at a set of check points in a layer.
+    /*!
+     *  Function to compute the maximum interpolation error at a set of check points in a layer. The check points are
+     *  distributed over the grid cells using a low-discrepancy sequence, and are located at a (fractional) offset
+     *  w.r.t. the cell's lower node, given separately per dimension.
+     *  \param layer Layer for which the error is to be computed.
+     *  \param nodeOffsets Offsets (as fraction of the node spacing) of check points in radius, latitude and longitude.
+     *  \param maximumAbsoluteError Maximum absolute error found at the check points (returned by reference).
+     *  \return Maximum relative error found at the check points.
+     */
+    double computeLayerInterpolationError( const GravityFieldGridLayer& layer,
+                                           const Eigen::Vector3d& nodeOffsets,
+                                           double& maximumAbsoluteError );
+
+    //! Function to interpolate the residual acceleration (and optionally its gradient) in a layer.
+    /*!
+     *  Function to interpolate the residual acceleration (and optionally its gradient) in a layer.
+     *  \param layer Layer in which interpolation is to be performed.
+     *  \param bodyFixedPosition Body-fixed position at which acceleration is to be computed.
+     *  \param residualAcceleration Interpolated acceleration minus point-mass acceleration (returned by reference).
+     *  \param residualGradient Gradient of interpolated residual acceleration (returned by reference if not nullptr).
+     */
+    void interpolateResidualAcceleration( const GravityFieldGridLayer& layer,
+                                          const Eigen::Vector3d& bodyFixedPosition,
+                                          Eigen::Vector3d& residualAcceleration,
+                                          Eigen::Matrix3d* residualGradient = nullptr ) const;
+
+    //! Function to compute the Lagrange interpolation weights (and their derivatives) of a single dimension.
+    /*!
+     *  Function to compute the Lagrange interpolation weights (and their derivatives) of a single dimension, for a
+     *  stencil of equispaced nodes.
+     *  \param nodeCoordinate Coordinate of the interpolation point, in units of node spacing.
+     *  \param numberOfNodes Number of nodes in this dimension.
+     *  \param isPeriodic Boolean denoting whether the dimension is periodic (wraps around) or not (stencil is clamped).
+     *  \param firstNodeIndex Index of the first node of the stencil (returned by reference).
+     *  \param weights Interpolation weights of the stencil nodes (returned by reference).
+     *  \param weightDerivatives Derivatives of the weights w.r.t. the node coordinate (returned by reference).
+     */
+    void computeInterpolationWeights( const double nodeCoordinate,
+                                      const int numberOfNodes,
+                                      const bool isPeriodic,
+                                      int& firstNodeIndex,
+                                      double* weights,
+                                      double* weightDerivatives ) const;
+
+    //! Function to find the layer in which a given radius is located.
+    int findLayerIndex( const double radius );
+
+    //! Function returning the acceleration of the source field as a function of body-fixed position.
+    std::function< Eigen::Vector3d( const Eigen::Vector3d& ) > sourceAccelerationFunction_;
+
+    //! Gravitational parameter of the source field, used for the point-mass term.
+    double gravitationalParameter_;
+
+    //! Inner radius of the grid.
+    double minimumRadius_;
+
+    //! Outer radius of the grid.
+    double maximumRadius_;
+
+    //! Tolerance on interpolation error, relative to the point-mass acceleration.
+    double relativeTolerance_;
+
+    //! Number of nodes per dimension used in interpolation.
+    int numberOfInterpolationPoints_;
+
+    //! Maximum number of nodes per layer.
+    int maximumNumberOfNodesPerLayer_;
+
+    //! Number of check points per layer at which the interpolation error is evaluated.
+    int numberOfErrorCheckPoints_;
+
+    //! Denominators of the Lagrange basis polynomials, for equispaced nodes.
+    std::vector< double > lagrangeDenominators_;
+
+    //! Radial layers of the grid.
+    std::vector< GravityFieldGridLayer > layers_;
+
+    //! Inner radii of the layers, followed by the outer radius of the grid.
+    std::vector< double > layerBoundaries_;
+
+    //! Look-up scheme for the layer in which a given radius is located.
+    std::shared_ptr< interpolators::LookUpScheme< double > > layerLookUpScheme_;
+
+    //! Number of calls for which the position was outside the grid.
+    int numberOfEvaluationsOutsideGrid_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_GRAVITY_FIELD_GRID_H
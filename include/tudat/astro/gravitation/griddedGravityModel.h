@@ -0,0 +1,173 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_GRIDDED_GRAVITY_MODEL_H
+#define TUDAT_GRIDDED_GRAVITY_MODEL_H
+
+#include <functional>
+#include <memory>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/astro/gravitation/gravityFieldGrid.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Class for the gravitational acceleration retrieved from a precomputed gravity field grid.
+/*!
+ *  Class for the gravitational acceleration retrieved from a precomputed gravity field grid (see GravityFieldGrid), to
+ *  replace the repeated evaluation of an expensive gravity field model (e.g. high-degree spherical harmonics, or a
+ *  polyhedron) for long propagations in a limited radial range around a body. The grid is defined in the body-fixed
+ *  frame of the body exerting the acceleration. The acceleration from the grid is scaled with the ratio of the
+ *  current gravitational parameter and the one used to generate the grid, so that mutual attraction (and changes in the
+ *  gravitational parameter) are taken into account.
+ */
+class GriddedGravitationalAccelerationModel: public basic_astrodynamics::AccelerationModel< Eigen::Vector3d >
+{
+protected:
+    //! Typedef for a position-returning function.
+    typedef std::function< void( Eigen::Vector3d& ) > StateFunction;
+
+public:
+
+    //! Constructor taking position-functions for bodies, and the precomputed gravity field grid.
+    /*!
+     * Constructor taking position-functions for bodies, and the precomputed gravity field grid.
+     * \param positionOfBodySubjectToAccelerationFunction Pointer to function returning position of
+     *          body subject to gravitational acceleration.
+     * \param gravitationalParameterFunction Pointer to function returning the gravitational parameter.
+     * \param gravityFieldGrid Precomputed gravity field grid, in the body-fixed frame of the body exerting acceleration.
+     * \param positionOfBodyExertingAccelerationFunction Pointer to function returning position of
+     *          body exerting gravitational acceleration (default = (0,0,0)).
+     * \param rotationFromBodyFixedToIntegrationFrameFunction Function providing the rotation from
+     * body-fixes from to the frame in which the numerical integration is performed.
+     * \param isMutualAttractionUsed Variable denoting whether attraction from body undergoing acceleration on
+     * body exerting acceleration is included.
+     */
+    GriddedGravitationalAccelerationModel(
+            const StateFunction positionOfBodySubjectToAccelerationFunction,
+            const std::function< double( ) > gravitationalParameterFunction,
+            const std::shared_ptr< GravityFieldGrid > gravityFieldGrid,
+            const StateFunction positionOfBodyExertingAccelerationFunction =
+                    [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+            const std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToIntegrationFrameFunction =
+                    [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); },
+            const bool isMutualAttractionUsed = false )
+        : subjectPositionFunction_( positionOfBodySubjectToAccelerationFunction ),
+          gravitationalParameterFunction_( gravitationalParameterFunction ),
+          gravityFieldGrid_( gravityFieldGrid ),
+          sourcePositionFunction_( positionOfBodyExertingAccelerationFunction ),
+          rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
+          isMutualAttractionUsed_( isMutualAttractionUsed )
+    { }
+
+    //! Update class members.
+    /*!
+     * Updates all the base class members to their current values and also updates the class members of this class.
+     * \param currentTime Time at which acceleration model is to be updated.
+     */
+    void updateMembers( const double currentTime = TUDAT_NAN );
+
+    //! Function to return current position vector from body exerting acceleration to body undergoing acceleration, in
+    //! frame fixed to body exerting acceleration
+    Eigen::Vector3d getCurrentRelativePosition( )
+    {
+        return currentRelativePosition_;
+    }
+
+    //! Function to return current position vector from body exerting acceleration to body undergoing acceleration, in
+    //! inertial frame
+    Eigen::Vector3d getCurrentInertialRelativePosition( )
+    {
+        return currentInertialRelativePosition_;
+    }
+
+    //! Function to retrieve the current rotation from body-fixed frame to integration frame, in the form of a quaternion.
+    Eigen::Quaterniond getCurrentRotationToIntegrationFrame( )
+    {
+        return rotationToIntegrationFrame_;
+    }
+
+    //! Function to return the function returning the relevant gravitational parameter.
+    std::function< double( ) > getGravitationalParameterFunction( )
+    {
+        return gravitationalParameterFunction_;
+    }
+
+    //! Function to return the precomputed gravity field grid.
+    std::shared_ptr< GravityFieldGrid > getGravityFieldGrid( )
+    {
+        return gravityFieldGrid_;
+    }
+
+    //! Function to return whether mutual attraction is used.
+    bool getIsMutualAttractionUsed( )
+    {
+        return isMutualAttractionUsed_;
+    }
+
+    //! Function to return the function returning position of body exerting acceleration.
+    StateFunction getStateFunctionOfBodyExertingAcceleration( )
+    { return sourcePositionFunction_; }
+
+    //! Function to return the function returning position of body subject to acceleration.
+    StateFunction getStateFunctionOfBodyUndergoingAcceleration( )
+    { return subjectPositionFunction_; }
+
+private:
+
+    //! Pointer to function returning position of body subject to acceleration.
+    const StateFunction subjectPositionFunction_;
+
+    //! Function returning a gravitational parameter [m^3 s^-2].
+    const std::function< double( ) > gravitationalParameterFunction_;
+
+    //! Precomputed gravity field grid, in the body-fixed frame of the body exerting acceleration.
+    std::shared_ptr< GravityFieldGrid > gravityFieldGrid_;
+
+    //! Pointer to function returning position of body exerting acceleration.
+    const StateFunction sourcePositionFunction_;
+
+    //! Function returning the current rotation from body-fixed frame to integration frame.
+    std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToIntegrationFrameFunction_;
+
+    //! Variable denoting whether mutual acceleration between bodies is included.
+    bool isMutualAttractionUsed_;
+
+    //! Current rotation from body-fixed frame to integration frame.
+    Eigen::Quaterniond rotationToIntegrationFrame_;
+
+    //! Current position vector from body exerting acceleration to body undergoing acceleration, in inertial frame
+    Eigen::Vector3d currentInertialRelativePosition_;
+
+    //! Current position vector from body exerting acceleration to body undergoing acceleration, in frame fixed to body
+    //! exerting acceleration
+    Eigen::Vector3d currentRelativePosition_;
+
+    //! Position of body subject to acceleration.
+    Eigen::Vector3d positionOfBodySubjectToAcceleration_;
+
+    //! Position of body exerting acceleration.
+    Eigen::Vector3d positionOfBodyExertingAcceleration_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_GRIDDED_GRAVITY_MODEL_H
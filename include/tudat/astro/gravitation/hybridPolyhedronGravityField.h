@@ -0,0 +1,164 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *       "Spherical harmonic coefficients for the potential of a constant-density polyhedron", Werner (1997),
+ *          Computers & Geosciences
+ */
+
+#ifndef TUDAT_HYBRIDPOLYHEDRONGRAVITYFIELD_H
+#define TUDAT_HYBRIDPOLYHEDRONGRAVITYFIELD_H
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+/*! Function to compute the weight of the polyhedron in a hybrid polyhedron/spherical harmonic gravity field.
+ *
+ * Function to compute the weight of the polyhedron in a hybrid polyhedron/spherical harmonic gravity field. The weight
+ * is 1 inside the inner switch radius, 0 outside the outer switch radius, and varies smoothly (with continuous first
+ * derivative) in between. The weight of the spherical harmonic gravity field is 1 minus the returned value.
+ * @param radius Distance from the origin of the body-fixed frame.
+ * @param innerSwitchRadius Radius inside of which only the polyhedron is used.
+ * @param outerSwitchRadius Radius outside of which only the spherical harmonic expansion is used.
+ * @return Weight of the polyhedron gravity field.
+ */
+double computeHybridGravityFieldPolyhedronWeight(
+        const double radius, const double innerSwitchRadius, const double outerSwitchRadius );
+
+/*! Function to compute the derivative of the weight of the polyhedron in a hybrid gravity field w.r.t. the radius.
+ *
+ * Function to compute the derivative of the weight of the polyhedron in a hybrid polyhedron/spherical harmonic gravity
+ * field (see computeHybridGravityFieldPolyhedronWeight) w.r.t. the radius.
+ * @param radius Distance from the origin of the body-fixed frame.
+ * @param innerSwitchRadius Radius inside of which only the polyhedron is used.
+ * @param outerSwitchRadius Radius outside of which only the spherical harmonic expansion is used.
+ * @return Derivative of the weight of the polyhedron gravity field w.r.t. the radius.
+ */
+double computeHybridGravityFieldPolyhedronWeightDerivative(
+        const double radius, const double innerSwitchRadius, const double outerSwitchRadius );
+
+//! Class to represent the gravity field of a constant density polyhedron, using an equivalent spherical harmonic
+//! expansion far from the body.
+/*!
+ * Class to represent the gravity field of a constant density polyhedron, using an equivalent spherical harmonic
+ * expansion far from the body. The polyhedron gravity field is exact, but its evaluation cost scales with the number of
+ * facets, whereas far from the body a low-degree spherical harmonic expansion is indistinguishable from it. On
+ * construction, the exterior spherical harmonic coefficients of the polyhedron are computed once (see
+ * computePolyhedronSphericalHarmonicCoefficients), with the brillouin radius of the polyhedron as reference radius.
+ * Inside the brillouin sphere plus a margin, the polyhedron is used; outside a switching layer beyond this, the
+ * spherical harmonic expansion is used. In the switching layer, the two are combined with a smooth weight. The
+ * hessian of the potential is always computed from the polyhedron.
+ */
+class HybridPolyhedronGravityField: public PolyhedronGravityField
+{
+public:
+
+    /*! Constructor.
+     *
+     * Constructor.
+     * @param gravitationalParameter Gravitational parameter of the polyhedron.
+     * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+     * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+     * @param maximumDegree Maximum degree (and order) of the exterior spherical harmonic expansion.
+     * @param brillouinSphereMargin Margin outside the brillouin sphere in which the polyhedron is used, relative to the
+     * brillouin radius.
+     * @param switchLayerWidth Width of the layer in which the polyhedron and spherical harmonic expansion are combined,
+     * relative to the inner radius of the layer.
+     * @param fixedReferenceFrame Identifier for body-fixed reference frame to which the field is fixed (optional).
+     * @param updateInertiaTensor Function that is to be called to update the inertia tensor (typicaly in Body class;
+     * default empty)
+     */
+    HybridPolyhedronGravityField(
+            const double gravitationalParameter,
+            const Eigen::MatrixXd& verticesCoordinates,
+            const Eigen::MatrixXi& verticesDefiningEachFacet,
+            const int maximumDegree,
+            const double brillouinSphereMargin = 0.1,
+            const double switchLayerWidth = 0.2,
+            const std::string& fixedReferenceFrame = "",
+            const std::function< void( ) > updateInertiaTensor = std::function< void( ) > ( ) );
+
+    /*! Function to calculate the gravitational potential.
+     *
+     * Function to calculate the gravitational potential, from the polyhedron and/or the exterior spherical harmonic
+     * expansion, depending on the distance to the origin.
+     * @param bodyFixedPosition Position of point at which potential is to be calculated, in body-fixed frame.
+     * @return Gravitational potential.
+     */
+    double getGravitationalPotential( const Eigen::Vector3d& bodyFixedPosition );
+
+    /*! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
+     *
+     * Function to calculate the gradient of the gravitational potential, from the polyhedron and/or the exterior
+     * spherical harmonic expansion, depending on the distance to the origin.
+     * @param bodyFixedPosition Position of point at which potential is to be calculated, in body-fixed frame.
+     * @return Gradient of the gravitational potential.
+     */
+    Eigen::Vector3d getGradientOfPotential( const Eigen::Vector3d& bodyFixedPosition );
+
+    /*! Function to calculate the laplacian of the gravitational potential.
+     *
+     * Function to calculate the laplacian of the gravitational potential, which is zero outside the brillouin sphere.
+     * @param bodyFixedPosition Position of point at which potential is to be calculated, in body-fixed frame.
+     * @return Laplacian of the gravitational potential.
+     */
+    double getLaplacianOfPotential( const Eigen::Vector3d& bodyFixedPosition );
+
+    //! Function to return the exterior spherical harmonic gravity field of the polyhedron.
+    std::shared_ptr< SphericalHarmonicsGravityField > getExteriorGravityField( )
+    { return exteriorGravityField_; }
+
+    //! Function to return the brillouin radius of the polyhedron (reference radius of the exterior field).
+    double getBrillouinRadius( )
+    { return brillouinRadius_; }
+
+    //! Function to return the radius inside of which only the polyhedron is used.
+    double getInnerSwitchRadius( )
+    { return innerSwitchRadius_; }
+
+    //! Function to return the radius outside of which only the spherical harmonic expansion is used.
+    double getOuterSwitchRadius( )
+    { return outerSwitchRadius_; }
+
+private:
+
+    //! Function to compute the ratio of the current gravitational parameter and that of the exterior field.
+    double getExteriorGravityFieldScaling( )
+    {
+        return getGravitationalParameter( ) / exteriorGravityField_->getGravitationalParameter( );
+    }
+
+    //! Brillouin radius of the polyhedron.
+    double brillouinRadius_;
+
+    //! Radius inside of which only the polyhedron is used.
+    double innerSwitchRadius_;
+
+    //! Radius outside of which only the spherical harmonic expansion is used.
+    double outerSwitchRadius_;
+
+    //! Exterior spherical harmonic gravity field of the polyhedron.
+    std::shared_ptr< SphericalHarmonicsGravityField > exteriorGravityField_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_HYBRIDPOLYHEDRONGRAVITYFIELD_H
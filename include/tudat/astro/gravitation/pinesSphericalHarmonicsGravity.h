@@ -0,0 +1,277 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Pines, S. Uniform representation of the gravitational potential and its derivatives.
+ *        AIAA Journal, 11(11):1508-1511, 1973.
+ *      Lundberg, J.B., Schutz, B.E. Recursion formulas of Legendre functions for use with
+ *        nonsingular geopotential models. Journal of Guidance, Control, and Dynamics, 11(1):31-38, 1988.
+ *      Fantino, E., Casotto, S. Methods of harmonic synthesis for global geopotential models and
+ *        their first-, second- and third-order gradients. Journal of Geodesy, 83(7):595-619, 2009.
+ *
+ *    Notes
+ *      In the Pines formulation, the potential is expressed in the direction cosines (s,t,u) = (x,y,z)/r
+ *      of the position. The longitude dependency is captured by r_m + i i_m = (s + i t)^m, and the latitude
+ *      dependency by the derived Legendre functions A_nm(u) (the m-th derivative of the Legendre polynomial
+ *      of degree n). Unlike the spherical formulation, no division by cos(latitude) occurs, so that the
+ *      acceleration and its partial derivatives are regular everywhere outside the origin, including on the
+ *      polar axis. All derived Legendre functions in this file are geodesy-normalized, with the same
+ *      normalization as the spherical harmonic coefficients.
+ *
+ */
+
+#ifndef TUDAT_PINES_SPHERICAL_HARMONICS_GRAVITY_H
+#define TUDAT_PINES_SPHERICAL_HARMONICS_GRAVITY_H
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/gravitation/vectorizedSphericalHarmonicsGravity.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Cache object for the singularity-free (Pines) evaluation of spherical harmonic accelerations and their partials.
+/*!
+ *  Cache object for the singularity-free (Pines) evaluation of spherical harmonic accelerations and their partials.
+ *  Upon construction (or resetting of the maximum degree/order) all recursion multipliers are computed. Upon calling
+ *  the update function with a body-fixed position, the geodesy-normalized derived Legendre functions, the real and
+ *  imaginary parts of (s + i t)^m and the powers of the radius ratio are computed, and stored column-major. These
+ *  quantities are shared by the acceleration, gravity gradient and coefficient partial evaluations, so that the
+ *  recursions are performed only once per state. Since the gravity gradient requires the derived Legendre functions up
+ *  to one degree and two orders above those of the coefficients, the cache stores these additional terms.
+ */
+class PinesSphericalHarmonicsCache
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree of coefficients for which cache is to be used
+     * \param maximumOrder Maximum order of coefficients for which cache is to be used
+     */
+    PinesSphericalHarmonicsCache( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Update maximum degree and order of cache, and recompute all recursion multipliers.
+    /*!
+     * Update maximum degree and order of cache, and recompute all recursion multipliers.
+     * \param maximumDegree Maximum degree of coefficients for which cache is to be used
+     * \param maximumOrder Maximum order of coefficients for which cache is to be used
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Update cache to the current body-fixed position.
+    /*!
+     * Update cache to the current body-fixed position. The derived Legendre functions, the terms (s + i t)^m and the
+     * powers of the radius ratio are recomputed, unless the input is equal to that of the previous call.
+     * \param bodyFixedPosition Position w.r.t. the body-fixed frame in which the coefficients are defined
+     * \param referenceRadius Reference radius of the spherical harmonic expansion
+     */
+    void update( const Eigen::Vector3d& bodyFixedPosition, const double referenceRadius );
+
+    //! Function to get the maximum degree of cache.
+    /*!
+     * Function to get the maximum degree of cache
+     * \return Maximum degree of cache.
+     */
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order of cache.
+    /*!
+     * Function to get the maximum order of cache
+     * \return Maximum order of cache.
+     */
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+    //! Function to get the body-fixed position to which the cache was last updated.
+    /*!
+     * Function to get the body-fixed position to which the cache was last updated.
+     * \return Body-fixed position to which the cache was last updated.
+     */
+    Eigen::Vector3d getCurrentPosition( )
+    {
+        return currentPosition_;
+    }
+
+    //! Function to get the distance from the origin at which the cache was last updated.
+    /*!
+     * Function to get the distance from the origin at which the cache was last updated.
+     * \return Distance from the origin at which the cache was last updated.
+     */
+    double getCurrentRadius( )
+    {
+        return currentRadius_;
+    }
+
+    //! Function to get the unit vector (s,t,u) along the position at which the cache was last updated.
+    /*!
+     * Function to get the unit vector (s,t,u) along the position at which the cache was last updated.
+     * \return Unit vector along the position at which the cache was last updated.
+     */
+    Eigen::Vector3d getCurrentUnitPosition( )
+    {
+        return currentUnitPosition_;
+    }
+
+    //! Multipliers of A_{n-1,m} in the column (fixed-order) recursion, stored as (degree, order)
+    Eigen::MatrixXd firstColumnMultipliers_;
+
+    //! Multipliers of A_{n-2,m} in the column (fixed-order) recursion, stored as (degree, order)
+    Eigen::MatrixXd secondColumnMultipliers_;
+
+    //! Multipliers of A_{n,m+1} in the derivative of A_{n,m} w.r.t. u, stored as (degree, order)
+    Eigen::MatrixXd derivativeMultipliers_;
+
+    //! Multipliers of A_{n+1,m+1} in the radial component of the acceleration, stored as (degree, order)
+    Eigen::MatrixXd radialMultipliers_;
+
+    //! Multipliers of A_{m-1,m-1} in the sectoral recursion, entry m corresponds to A_{m,m}
+    Eigen::VectorXd sectoralMultipliers_;
+
+    //! Degree plus two, as double (entry n is n + 2)
+    Eigen::VectorXd degreePlusTwo_;
+
+    //! Reference radius ratio to the power degree plus one (entry n is (R/r)^(n+1))
+    Eigen::VectorXd radiusRatioPowers_;
+
+    //! Real parts of (s + i t)^m (entry m)
+    Eigen::VectorXd realTerms_;
+
+    //! Imaginary parts of (s + i t)^m (entry m)
+    Eigen::VectorXd imaginaryTerms_;
+
+    //! Geodesy-normalized derived Legendre functions, stored as (degree, order)
+    Eigen::MatrixXd derivedLegendreFunctions_;
+
+    //! Work buffers for products of radius ratio powers, multipliers and derived Legendre functions of a single order
+    std::vector< Eigen::VectorXd > workBuffers_;
+
+private:
+
+    //! Maximum degree of cache.
+    int maximumDegree_;
+
+    //! Maximum order of cache.
+    int maximumOrder_;
+
+    //! Body-fixed position to which the cache was last updated.
+    Eigen::Vector3d currentPosition_;
+
+    //! Reference radius with which the cache was last updated.
+    double currentReferenceRadius_;
+
+    //! Distance from the origin at which the cache was last updated.
+    double currentRadius_;
+
+    //! Unit vector (s,t,u) along the position at which the cache was last updated.
+    Eigen::Vector3d currentUnitPosition_;
+};
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, using the Pines formulation.
+/*!
+ * Compute gravitational acceleration due to multiple spherical harmonics terms, defined using geodesy-normalization.
+ * This function computes the same quantity as computeGeodesyNormalizedGravitationalAccelerationSum (see that function
+ * for a definition of the input), but uses the Pines formulation, which is free of singularities on the polar axis. As
+ * for computeGeodesyNormalizedGravitationalAccelerationSumColumnWise, the contributions of all degrees of a single
+ * order are obtained from dot products with the contiguous column of the coefficient matrices.
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the
+ *          reference frame that is associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic
+ *          coefficients. The row index indicates the degree and the column index indicates the order
+ *          of coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ *          The matrix must be equal in size to cosineHarmonicCoefficients.
+ * \param pinesCache Cache object for the Pines formulation, updated to the current position by this function. Its
+ *          maximum degree and order must be at least equal to those of the coefficient matrices.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumPines(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::Ref< const Eigen::MatrixXd >& cosineHarmonicCoefficients,
+        const Eigen::Ref< const Eigen::MatrixXd >& sineHarmonicCoefficients,
+        PinesSphericalHarmonicsCache& pinesCache,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
+
+//! Compute the partial derivative of a spherical harmonic acceleration w.r.t. position, using the Pines formulation.
+/*!
+ * Compute the partial derivative of the body-fixed spherical harmonic acceleration w.r.t. the body-fixed position
+ * (i.e. the gravity gradient tensor), using the Pines formulation. This function computes the same quantity as
+ * computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration, but is free of singularities on the polar axis.
+ * The cache must have been updated to the current position before calling this function (for instance by a call to
+ * computeGeodesyNormalizedGravitationalAccelerationSumPines or PinesSphericalHarmonicsCache::update).
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ * \param pinesCache Cache object for the Pines formulation, updated to the current position.
+ * \return Partial derivative of body-fixed acceleration w.r.t. body-fixed position.
+ */
+Eigen::Matrix3d computePartialDerivativeOfBodyFixedSphericalHarmonicAccelerationPines(
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        PinesSphericalHarmonicsCache& pinesCache );
+
+//! Compute the partials of a spherical harmonic acceleration w.r.t. a set of coefficients, using the Pines formulation.
+/*!
+ * Compute the partial derivatives of a spherical harmonic acceleration w.r.t. a set of geodesy-normalized cosine or
+ * sine coefficients, using the Pines formulation. The cache must have been updated to the current position before
+ * calling this function.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param pinesCache Cache object for the Pines formulation, updated to the current position.
+ * \param blockIndices List of (degree, order) of coefficients w.r.t. which partials are to be computed.
+ * \param computeSinePartials Boolean denoting whether partials w.r.t. sine (if true) or cosine (if false) coefficients
+ *          are to be computed.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to frame in which
+ *          partials are to be returned.
+ * \param partialsMatrix Partials of acceleration w.r.t. coefficients, with column i corresponding to entry i of
+ *          blockIndices (returned by reference).
+ * \param maximumAccelerationDegree Maximum degree of the acceleration model; partials w.r.t. coefficients of higher
+ *          degree are zero.
+ * \param maximumAccelerationOrder Maximum order of the acceleration model; partials w.r.t. coefficients of higher
+ *          order are zero.
+ */
+void computeSphericalHarmonicGravityWrtCoefficientsPines(
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        PinesSphericalHarmonicsCache& pinesCache,
+        const std::vector< std::pair< int, int > >& blockIndices,
+        const bool computeSinePartials,
+        const Eigen::Matrix3d& accelerationRotation,
+        Eigen::MatrixXd& partialsMatrix,
+        const int maximumAccelerationDegree,
+        const int maximumAccelerationOrder );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_PINES_SPHERICAL_HARMONICS_GRAVITY_H
@@ -35,6 +35,19 @@ namespace gravitation
 {
 
 //! Cache object in which variables that are required for the computation of polyhedron gravity field are stored.
+/*!
+ * Cache object in which variables that are required for the computation of polyhedron gravity field are stored. The
+ * facet and edge properties are stored as structure-of-arrays: the field-point-independent terms (facet normals, from
+ * which the facet dyads follow as the outer product, the independent components of the symmetric edge dyads, and the
+ * edge lengths) are precomputed once on construction, and each column of the (column-major) matrices in which they are
+ * stored is contiguous in memory. On each update, the per-facet and per-edge factors, as well as the (unscaled) sums
+ * required for the potential, its gradient and its laplacian, are computed in a single pass over these arrays, without
+ * any memory allocation. The passes over the facets and edges are written such that the compiler can vectorize them
+ * (the transcendental functions excepted), and can optionally be split over multiple threads. Since the threads are
+ * started on each update, a thread is only used if at least MINIMUM_NUMBER_OF_FACETS_PER_THREAD facets can be assigned
+ * to it, so that small shape models are always evaluated on the calling thread. The partial sums of the threads are
+ * combined in a fixed order, so that the results are deterministic for a given shape model and number of threads.
+ */
 class PolyhedronGravityCache
 {
 public:
@@ -48,17 +61,15 @@ public:
      * row contains 3 indices, which must be provided in counterclockwise order when seen from outise the polyhedron.
      * @param verticesDefiningEachEdge Matrix with the indices (0 indexed) of the vertices defining each facet. Each
      * row contains 2 indices.
+     * @param edgeDyads Vector with the edge dyad of each edge (in the same order as verticesDefiningEachEdge).
+     * @param numberOfThreads Number of threads over which the facets and edges are distributed on each update.
      */
     PolyhedronGravityCache(
             const Eigen::MatrixXd& verticesCoordinates,
             const Eigen::MatrixXi& verticesDefiningEachFacet,
-            const Eigen::MatrixXi& verticesDefiningEachEdge)
-            : verticesCoordinates_( verticesCoordinates ),
-              verticesDefiningEachFacet_( verticesDefiningEachFacet ),
-              verticesDefiningEachEdge_( verticesDefiningEachEdge )
-    {
-        currentBodyFixedPosition_ = (Eigen::Vector3d() << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN).finished();
-    }
+            const Eigen::MatrixXi& verticesDefiningEachEdge,
+            const std::vector< Eigen::MatrixXd >& edgeDyads,
+            const unsigned int numberOfThreads = 1 );
 
     /*! Update cached variables to current state.
      *
@@ -91,11 +102,103 @@ public:
     Eigen::VectorXd& getPerEdgeFactor ( )
     { return currentPerEdgeFactor_; }
 
+    /*! Function to compute the gravitational potential at the field point of the last update.
+     *
+     * Function to compute the gravitational potential at the field point of the last update, according to Eq. 10 of
+     * Werner and Scheeres (1997).
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Gravitational potential.
+     */
+    double getGravitationalPotential( const double gravitationalConstantTimesDensity )
+    {
+        return 0.5 * gravitationalConstantTimesDensity * currentPotentialSum_;
+    }
+
+    /*! Function to compute the gradient of the gravitational potential at the field point of the last update.
+     *
+     * Function to compute the gradient of the gravitational potential at the field point of the last update,
+     * according to Eq. 15 of Werner and Scheeres (1997).
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Gradient of the gravitational potential.
+     */
+    Eigen::Vector3d getGradientOfPotential( const double gravitationalConstantTimesDensity )
+    {
+        return -gravitationalConstantTimesDensity * currentGradientSum_;
+    }
+
+    /*! Function to compute the laplacian of the gravitational potential at the field point of the last update.
+     *
+     * Function to compute the laplacian of the gravitational potential at the field point of the last update.
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Laplacian of the gravitational potential.
+     */
+    double getLaplacianOfPotential( const double gravitationalConstantTimesDensity )
+    {
+        return -gravitationalConstantTimesDensity * currentPerFacetFactorSum_;
+    }
+
+    /*! Function to compute the hessian of the gravitational potential at the field point of the last update.
+     *
+     * Function to compute the hessian of the gravitational potential at the field point of the last update, according
+     * to Eq. 16 of Werner and Scheeres (1997). Throws an exception if the field point lies on one of the edges.
+     * @param gravitationalConstantTimesDensity Product of the gravitational constant and density.
+     * @return Hessian of the gravitational potential.
+     */
+    Eigen::Matrix3d getHessianOfPotential( const double gravitationalConstantTimesDensity );
+
+    /*! Function to retrieve the number of threads over which the facets and edges are distributed.
+     *
+     * Function to retrieve the number of threads over which the facets and edges are distributed.
+     * @return Number of threads.
+     */
+    unsigned int getNumberOfThreads( )
+    { return numberOfThreads_; }
+
+    /*! Function to reset the number of threads over which the facets and edges are distributed.
+     *
+     * Function to reset the number of threads over which the facets and edges are distributed.
+     * @param numberOfThreads Number of threads (at least 1).
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads );
+
+    /*! Function to retrieve the number of threads that is actually used on each update.
+     *
+     * Function to retrieve the number of threads that is actually used on each update, which is the number of threads
+     * set by the user, limited such that each thread is assigned at least MINIMUM_NUMBER_OF_FACETS_PER_THREAD facets.
+     * @return Number of threads used on each update.
+     */
+    unsigned int getNumberOfActiveThreads( )
+    { return numberOfActiveThreads_; }
+
+    //! Minimum number of facets for which an additional thread is used on each update.
+    static constexpr long MINIMUM_NUMBER_OF_FACETS_PER_THREAD = 5000;
 
 protected:
 
 private:
 
+    //! Partial sums over a range of facets and edges, as computed by a single thread.
+    struct PartialSums
+    {
+        double potentialSum = 0.0;
+        Eigen::Vector3d gradientSum = Eigen::Vector3d::Zero( );
+        double perFacetFactorSum = 0.0;
+    };
+
+    /*! Function to compute the per-facet and per-edge factors, and the associated sums, for a range of facets and edges.
+     *
+     * Function to compute the per-facet and per-edge factors, and the associated sums, for a range of facets and
+     * edges. The relative vertex coordinates and distances must have been updated before calling this function.
+     * @param firstFacet Index of the first facet in the range.
+     * @param endFacet Index one past the last facet in the range.
+     * @param firstEdge Index of the first edge in the range.
+     * @param endEdge Index one past the last edge in the range.
+     * @param partialSums Sums over the facets and edges in the range (returned by reference).
+     */
+    void computeFactorsAndSums(
+            const int firstFacet, const int endFacet, const int firstEdge, const int endEdge,
+            PartialSums& partialSums );
+
     // Current body fixed position.
     Eigen::Vector3d currentBodyFixedPosition_;
 
@@ -108,14 +211,45 @@ private:
     // Matrix with the indices (0 indexed) of the vertices defining each facet.
     const Eigen::MatrixXi verticesDefiningEachEdge_;
 
+    // Outward-pointing unit normal of each facet (one row per facet); the facet dyad is its outer product.
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > facetNormals_;
+
+    // Independent components (xx, yy, zz, xy, xz, yz) of the edge dyad of each edge (one row per edge).
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > edgeDyadComponents_;
+
+    // Length of each edge.
+    Eigen::VectorXd edgeLengths_;
+
+    // Number of threads over which the facets and edges are distributed.
+    unsigned int numberOfThreads_;
+
+    // Number of threads that is used on each update.
+    unsigned int numberOfActiveThreads_;
+
     // Current vertices coordinates wrt body fixed position.
     Eigen::MatrixXd currentVerticesCoordinatesRelativeToFieldPoint_;
 
+    // Current distance from the field point to each vertex.
+    Eigen::VectorXd currentVerticesDistanceToFieldPoint_;
+
     // Current value of the per-facet factors.
     Eigen::VectorXd currentPerFacetFactor_;
 
     // Current value of the per-edge factors.
     Eigen::VectorXd currentPerEdgeFactor_;
+
+    // Current sum of the edge and facet terms of the potential (not scaled by the gravitational constant and density).
+    double currentPotentialSum_;
+
+    // Current sum of the edge and facet terms of the potential gradient (not scaled by the gravitational constant and
+    // density).
+    Eigen::Vector3d currentGradientSum_;
+
+    // Current sum of the per-facet factors.
+    double currentPerFacetFactorSum_;
+
+    // Partial sums of each thread.
+    std::vector< PartialSums > threadPartialSums_;
 };
 
 
@@ -165,7 +299,7 @@ public:
 
         // Create cache object
         polyhedronGravityCache_ = std::make_shared< PolyhedronGravityCache >(
-                verticesCoordinates_, verticesDefiningEachFacet_, verticesDefiningEachEdge_);
+                verticesCoordinates_, verticesDefiningEachFacet_, verticesDefiningEachEdge_, edgeDyads_ );
 
         inertiaTensor_ = basic_astrodynamics::computePolyhedronInertiaTensor(
                 verticesCoordinates_, verticesDefiningEachFacet_, density_ );
@@ -181,15 +315,7 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                verticesDefiningEachFacet_,
-                verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+        return polyhedronGravityCache_->getGravitationalPotential( gravitationalParameter_ / volume_ );
     }
 
     /*! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
@@ -202,15 +328,7 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                verticesDefiningEachFacet_,
-                verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+        return polyhedronGravityCache_->getGradientOfPotential( gravitationalParameter_ / volume_ );
     }
 
     /*! Function to calculate the hessian matrix of the gravitational potential.
@@ -223,12 +341,7 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor(),
-                polyhedronGravityCache_->getPerEdgeFactor() );
+        return polyhedronGravityCache_->getHessianOfPotential( gravitationalParameter_ / volume_ );
     }
 
     /*! Function to calculate the laplacian of the gravitational potential.
@@ -241,11 +354,27 @@ public:
     {
         polyhedronGravityCache_->update(bodyFixedPosition);
 
-        return basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getPerFacetFactor() );
+        return polyhedronGravityCache_->getLaplacianOfPotential( gravitationalParameter_ / volume_ );
     }
 
+    /*! Function to reset the number of threads used to evaluate the gravity field.
+     *
+     * Function to reset the number of threads over which the facets and edges are distributed when evaluating the
+     * gravity field.
+     * @param numberOfThreads Number of threads (at least 1).
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads )
+    { polyhedronGravityCache_->setNumberOfThreads( numberOfThreads ); }
+
+    /*! Function to retrieve the number of threads that is actually used to evaluate the gravity field.
+     *
+     * Function to retrieve the number of threads that is actually used to evaluate the gravity field, see
+     * PolyhedronGravityCache::getNumberOfActiveThreads.
+     * @return Number of threads used to evaluate the gravity field.
+     */
+    unsigned int getNumberOfActiveThreads( )
+    { return polyhedronGravityCache_->getNumberOfActiveThreads( ); }
+
     //! Function to retrieve the identifier for the body-fixed reference frame.
     std::string getFixedReferenceFrame( )
     { return fixedReferenceFrame_; }
@@ -21,6 +21,7 @@
 
 #include "tudat/astro/basic_astro/accelerationModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
 #include "tudat/math/basic/polyhedron.h"
 
 namespace tudat
@@ -69,6 +70,8 @@ public:
      * the updateMembers function.
      * \param updateLaplacianOfPotential Flag indicating whether to update the laplacian of the
      * gravitational potential when calling the updateMembers function.
+     * \param numberOfThreads Number of threads over which the facets and edges are distributed when evaluating the
+     * acceleration (default 1).
      */
     PolyhedronGravitationalAccelerationModel (
             const StateFunction positionOfBodySubjectToAccelerationFunction,
@@ -85,7 +88,8 @@ public:
                     [ ] ( ) { return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); },
             const bool isMutualAttractionUsed = 0,
             const bool updateGravitationalPotential = false,
-            const bool updateLaplacianOfGravitationalPotential = false)
+            const bool updateLaplacianOfGravitationalPotential = false,
+            const unsigned int numberOfThreads = 1 )
         : subjectPositionFunction_( positionOfBodySubjectToAccelerationFunction ),
           gravitationalParameterFunction_( [ = ]( ){ return aGravitationalParameter; } ),
           volumeFunction_( [ = ]( ){ return aVolume; } ),
@@ -98,7 +102,11 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           isMutualAttractionUsed_( isMutualAttractionUsed ),
           polyhedronCache_( std::make_shared< PolyhedronGravityCache >(
-                 aVerticesCoordinatesMatrix, aVerticesDefiningEachFacetMatrix, aVerticesDefiningEachEdgeMatrix) ),
+                 aVerticesCoordinatesMatrix, aVerticesDefiningEachFacetMatrix, aVerticesDefiningEachEdgeMatrix,
+                 aEdgeDyadsVector, numberOfThreads ) ),
+          innerSwitchRadius_( TUDAT_NAN ),
+          outerSwitchRadius_( TUDAT_NAN ),
+          currentPolyhedronWeight_( 1.0 ),
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
@@ -129,6 +137,8 @@ public:
      * the updateMembers function.
      * \param updateLaplacianOfPotential Flag indicating whether to update the laplacian of the
      * gravitational potential when calling the updateMembers function.
+     * \param numberOfThreads Number of threads over which the facets and edges are distributed when evaluating the
+     * acceleration (default 1).
      */
     PolyhedronGravitationalAccelerationModel(
             const StateFunction positionOfBodySubjectToAccelerationFunction,
@@ -145,7 +155,8 @@ public:
                 [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); },
             const bool isMutualAttractionUsed = 0,
             const bool updateGravitationalPotential = false,
-            const bool updateLaplacianOfGravitationalPotential = false)
+            const bool updateLaplacianOfGravitationalPotential = false,
+            const unsigned int numberOfThreads = 1 )
         : subjectPositionFunction_( positionOfBodySubjectToAccelerationFunction ),
           gravitationalParameterFunction_( gravitationalParameterFunction ),
           volumeFunction_( volumeFunction ),
@@ -159,7 +170,10 @@ public:
           isMutualAttractionUsed_( isMutualAttractionUsed ),
           polyhedronCache_( std::make_shared< PolyhedronGravityCache >(
                  verticesCoordinatesFunction(), verticesDefiningEachFacetFunction(),
-                 verticesDefiningEachEdgeFunction() ) ),
+                 verticesDefiningEachEdgeFunction(), edgeDyadsFunction(), numberOfThreads ) ),
+          innerSwitchRadius_( TUDAT_NAN ),
+          outerSwitchRadius_( TUDAT_NAN ),
+          currentPolyhedronWeight_( 1.0 ),
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
@@ -258,6 +272,58 @@ public:
         return polyhedronCache_;
     }
 
+    //! Function to set an exterior spherical harmonic gravity field, to be used far from the polyhedron.
+    /*!
+     * Function to set an exterior spherical harmonic gravity field, equivalent to the polyhedron outside its brillouin
+     * sphere (see HybridPolyhedronGravityField), to be used far from the polyhedron. Inside the inner switch radius,
+     * only the polyhedron is used, outside the outer switch radius only the spherical harmonic expansion, and in
+     * between the two are combined with a smooth weight (see computeHybridGravityFieldPolyhedronWeight). The
+     * acceleration from the exterior field is scaled with the ratio of the current gravitational parameter and that of
+     * the exterior field.
+     * \param exteriorGravityField Exterior spherical harmonic gravity field of the polyhedron.
+     * \param innerSwitchRadius Radius inside of which only the polyhedron is used.
+     * \param outerSwitchRadius Radius outside of which only the spherical harmonic expansion is used.
+     */
+    void setExteriorGravityField( const std::shared_ptr< SphericalHarmonicsGravityField > exteriorGravityField,
+                                  const double innerSwitchRadius,
+                                  const double outerSwitchRadius )
+    {
+        if( !( innerSwitchRadius < outerSwitchRadius ) )
+        {
+            throw std::runtime_error( "Error when setting exterior gravity field of polyhedron acceleration, inner switch "
+                                      "radius must be smaller than outer switch radius." );
+        }
+        exteriorGravityField_ = exteriorGravityField;
+        innerSwitchRadius_ = innerSwitchRadius;
+        outerSwitchRadius_ = outerSwitchRadius;
+    }
+
+    //! Function to return the exterior spherical harmonic gravity field (nullptr if none is used).
+    std::shared_ptr< SphericalHarmonicsGravityField > getExteriorGravityField( )
+    { return exteriorGravityField_; }
+
+    //! Function to return the radius inside of which only the polyhedron is used.
+    double getInnerSwitchRadius( )
+    { return innerSwitchRadius_; }
+
+    //! Function to return the radius outside of which only the exterior spherical harmonic expansion is used.
+    double getOuterSwitchRadius( )
+    { return outerSwitchRadius_; }
+
+    //! Function to return the weight of the polyhedron in the current acceleration (1 if no exterior field is used).
+    double getCurrentPolyhedronWeight( )
+    { return currentPolyhedronWeight_; }
+
+    //! Function to return the current acceleration due to the polyhedron, in the body-fixed frame (only updated if the
+    //! polyhedron weight is larger than 0).
+    Eigen::Vector3d getCurrentPolyhedronAccelerationInBodyFixedFrame( )
+    { return currentPolyhedronAccelerationInBodyFixedFrame_; }
+
+    //! Function to return the current acceleration due to the exterior spherical harmonic expansion, in the body-fixed
+    //! frame (only updated if the polyhedron weight is smaller than 1).
+    Eigen::Vector3d getCurrentExteriorAccelerationInBodyFixedFrame( )
+    { return currentExteriorAccelerationInBodyFixedFrame_; }
+
     //! Function to return the value of the current gravitational potential.
     double getCurrentPotential ( )
     { return currentPotential_; }
@@ -339,6 +405,24 @@ private:
     //! Position of body exerting acceleration.
     Eigen::Vector3d positionOfBodyExertingAcceleration_;
 
+    //! Exterior spherical harmonic gravity field of the polyhedron (nullptr if not used).
+    std::shared_ptr< SphericalHarmonicsGravityField > exteriorGravityField_;
+
+    //! Radius inside of which only the polyhedron is used.
+    double innerSwitchRadius_;
+
+    //! Radius outside of which only the exterior spherical harmonic expansion is used.
+    double outerSwitchRadius_;
+
+    //! Current weight of the polyhedron in the acceleration.
+    double currentPolyhedronWeight_;
+
+    //! Current acceleration due to the polyhedron, in the body-fixed frame.
+    Eigen::Vector3d currentPolyhedronAccelerationInBodyFixedFrame_;
+
+    //! Current acceleration due to the exterior spherical harmonic expansion, in the body-fixed frame.
+    Eigen::Vector3d currentExteriorAccelerationInBodyFixedFrame_;
+
     //! Current gravitational potential acting on the body undergoing acceleration, as computed by last call to
     //! updateMembers function
     double currentPotential_;
@@ -89,8 +89,8 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
         const double gravitationalParameter,
         const double equatorialRadius,
-        const Eigen::MatrixXd& cosineHarmonicCoefficients,
-        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        const Eigen::Ref< const Eigen::MatrixXd >& cosineHarmonicCoefficients,
+        const Eigen::Ref< const Eigen::MatrixXd >& sineHarmonicCoefficients,
         std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
         std::map< std::pair< int, int >, Eigen::Vector3d >& accelerationPerTerm,
         const bool saveSeparateTerms = 0,
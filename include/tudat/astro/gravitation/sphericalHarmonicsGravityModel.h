@@ -28,12 +28,47 @@
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityModelBase.h"
 #include "tudat/math/basic/sphericalHarmonics.h"
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+#include "tudat/astro/gravitation/vectorizedSphericalHarmonicsGravity.h"
+#include "tudat/astro/gravitation/pinesSphericalHarmonicsGravity.h"
 
 namespace tudat
 {
 namespace gravitation
 {
 
+//! Function to compute the degree amplitude spectrum of a spherical harmonic gravity field.
+/*!
+ * Function to compute the degree amplitude spectrum of a spherical harmonic gravity field, with entry n equal to
+ * sqrt( sum_m ( C_nm^2 + S_nm^2 ) ), the root of the degree variance of the geodesy-normalized coefficients.
+ * \param cosineHarmonicCoefficients Matrix with geodesy-normalized cosine harmonic coefficients.
+ * \param sineHarmonicCoefficients Matrix with geodesy-normalized sine harmonic coefficients.
+ * \return Degree amplitude spectrum (entry n for degree n)
+ */
+Eigen::VectorXd computeDegreeAmplitudeSpectrum(
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients );
+
+//! Function to compute the degree to which a spherical harmonic expansion can be truncated at a given distance.
+/*!
+ * Function to compute the degree to which a spherical harmonic expansion can be truncated at a given distance, for a
+ * given tolerance. The magnitude of the acceleration due to all terms of degree n, relative to the point-mass
+ * acceleration, is estimated as (n+1)(R/r)^n sigma_n, with sigma_n the degree amplitude (see
+ * computeDegreeAmplitudeSpectrum). The lowest degree N for which the sum of these estimates over all degrees above N is
+ * below the tolerance is returned.
+ * \param degreeAmplitudes Degree amplitude spectrum of the gravity field (entry n for degree n).
+ * \param radiusRatio Reference radius divided by current distance (R/r).
+ * \param tolerance Tolerance for the (estimated) acceleration due to all truncated terms, relative to the point-mass
+ * acceleration.
+ * \param degreeContributions Work buffer for the estimated contributions per degree, resized if needed (returned by
+ * reference).
+ * \return Degree to which spherical harmonic expansion can be truncated.
+ */
+int computeAdaptiveTruncationDegree(
+        const Eigen::VectorXd& degreeAmplitudes,
+        const double radiusRatio,
+        const double tolerance,
+        Eigen::VectorXd& degreeContributions );
+
 //! Template class for general spherical harmonics gravitational acceleration model.
 /*!
  * This templated class implements a general spherical harmonics gravitational acceleration model.
@@ -217,16 +252,26 @@ public:
             currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
                         currentInertialRelativePosition_ );
 
-            currentAcceleration_ =
-                    computeGeodesyNormalizedGravitationalAccelerationSum(
-                        currentRelativePosition_,
-                        gravitationalParameter,
-                        equatorialRadius,
-                        cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients, sphericalHarmonicsCache_,
-                        accelerationPerTerm_,
-                        saveSphericalHarmonicTermsSeparately_,
-                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+            currentTruncationDegree_ = static_cast< int >( cosineHarmonicCoefficients.rows( ) ) - 1;
+            currentTruncationOrder_ = static_cast< int >( cosineHarmonicCoefficients.cols( ) ) - 1;
+            if( degreeTruncationTolerance_ > 0.0 && !saveSphericalHarmonicTermsSeparately_ )
+            {
+                updateTruncationDegree( );
+            }
+
+            if( currentTruncationDegree_ < cosineHarmonicCoefficients.rows( ) - 1 )
+            {
+                currentAcceleration_ = computeAccelerationSum(
+                            cosineHarmonicCoefficients.topLeftCorner( currentTruncationDegree_ + 1, currentTruncationOrder_ + 1 ),
+                            sineHarmonicCoefficients.topLeftCorner( currentTruncationDegree_ + 1, currentTruncationOrder_ + 1 ),
+                            accelerationPerTerm_, false );
+            }
+            else
+            {
+                currentAcceleration_ = computeAccelerationSum(
+                            cosineHarmonicCoefficients, sineHarmonicCoefficients,
+                            accelerationPerTerm_, saveSphericalHarmonicTermsSeparately_ );
+            }
             currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
 
             if ( this->updatePotential_ )
@@ -254,15 +299,7 @@ public:
             const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients)
     {
         std::map< std::pair< int, int >, Eigen::Vector3d > dummy;
-        return computeGeodesyNormalizedGravitationalAccelerationSum(
-                    currentRelativePosition_,
-                    gravitationalParameter,
-                    equatorialRadius,
-                    cosineCoefficients,
-                    sineCoefficients, sphericalHarmonicsCache_,
-                    dummy,
-                    false,
-                    rotationToIntegrationFrame_.toRotationMatrix( ) );
+        return computeAccelerationSum( cosineCoefficients, sineCoefficients, dummy, false );
     }
 
     //! Function to retrieve spherical harmonic acceleration in inertial frame, with alternative coefficients, per term
@@ -452,6 +489,108 @@ public:
         return returnVector;
     }
 
+    //! Function to set the algorithm with which the spherical harmonic expansion is evaluated
+    /*!
+     * Function to set the algorithm with which the spherical harmonic expansion is evaluated. For the
+     * column_wise_spherical_harmonics_evaluation and pines_spherical_harmonics_evaluation options, the required cache is
+     * (re)sized to the current maximum degree and order. The Pines cache is removed when another algorithm is selected.
+     * Associated partial objects retrieve the Pines cache through getPinesCache at each update. Note that the
+     * term-wise evaluation is always used when the separate terms of the acceleration are to be saved.
+     * \param evaluationAlgorithm Algorithm with which the spherical harmonic expansion is to be evaluated
+     */
+    void setEvaluationAlgorithm( const SphericalHarmonicsEvaluationAlgorithm evaluationAlgorithm )
+    {
+        evaluationAlgorithm_ = evaluationAlgorithm;
+        if( evaluationAlgorithm_ == column_wise_spherical_harmonics_evaluation )
+        {
+            columnWiseCache_.resetMaximumDegreeAndOrder( maximumDegree_ - 1, maximumOrder_ - 1 );
+        }
+
+        if( evaluationAlgorithm_ != pines_spherical_harmonics_evaluation )
+        {
+            pinesCache_ = nullptr;
+        }
+        else if( pinesCache_ == nullptr )
+        {
+            pinesCache_ = std::make_shared< PinesSphericalHarmonicsCache >( maximumDegree_ - 1, maximumOrder_ - 1 );
+        }
+        else if( pinesCache_->getMaximumDegree( ) < maximumDegree_ - 1 ||
+                 pinesCache_->getMaximumOrder( ) < maximumOrder_ - 1 )
+        {
+            pinesCache_->resetMaximumDegreeAndOrder( maximumDegree_ - 1, maximumOrder_ - 1 );
+        }
+    }
+
+    //! Function to retrieve the algorithm with which the spherical harmonic expansion is evaluated
+    /*!
+     * Function to retrieve the algorithm with which the spherical harmonic expansion is evaluated
+     * \return Algorithm with which the spherical harmonic expansion is evaluated
+     */
+    SphericalHarmonicsEvaluationAlgorithm getEvaluationAlgorithm( )
+    {
+        return evaluationAlgorithm_;
+    }
+
+    //! Function to retrieve the cache used for the Pines evaluation of the spherical harmonic expansion
+    /*!
+     * Function to retrieve the cache used for the Pines evaluation of the spherical harmonic expansion. The cache is
+     * only created if the pines_spherical_harmonics_evaluation algorithm is selected (nullptr otherwise).
+     * \return Cache used for the Pines evaluation of the spherical harmonic expansion
+     */
+    std::shared_ptr< PinesSphericalHarmonicsCache > getPinesCache( )
+    {
+        return pinesCache_;
+    }
+
+    //! Function to set the tolerance for the altitude-adaptive truncation of the spherical harmonic expansion
+    /*!
+     * Function to set the tolerance for the altitude-adaptive truncation of the spherical harmonic expansion. If a
+     * positive tolerance is set, the degree to which the expansion is evaluated is determined at each call to
+     * updateMembers, from the current distance and the degree amplitude spectrum of the coefficients (see
+     * computeAdaptiveTruncationDegree). The order is truncated to the same value. The tolerance is defined w.r.t. the
+     * point-mass acceleration. The spectrum is computed from the coefficients at the first evaluation after calling this
+     * function, and is not recomputed for (small) time-variations of the coefficients. No truncation is performed if the
+     * separate terms of the acceleration are to be saved.
+     * \param degreeTruncationTolerance Tolerance for the altitude-adaptive truncation (no truncation if not positive)
+     */
+    void setDegreeTruncationTolerance( const double degreeTruncationTolerance )
+    {
+        degreeTruncationTolerance_ = degreeTruncationTolerance;
+        degreeAmplitudes_.resize( 0 );
+    }
+
+    //! Function to retrieve the tolerance for the altitude-adaptive truncation of the spherical harmonic expansion
+    /*!
+     * Function to retrieve the tolerance for the altitude-adaptive truncation of the spherical harmonic expansion
+     * \return Tolerance for the altitude-adaptive truncation (no truncation if not positive)
+     */
+    double getDegreeTruncationTolerance( )
+    {
+        return degreeTruncationTolerance_;
+    }
+
+    //! Function to retrieve the degree to which the expansion was evaluated at the last call to updateMembers
+    /*!
+     * Function to retrieve the degree to which the expansion was evaluated at the last call to updateMembers, which is
+     * lower than the maximum degree of the coefficients if the altitude-adaptive truncation is used.
+     * \return Degree to which the expansion was evaluated at the last call to updateMembers
+     */
+    int getCurrentTruncationDegree( )
+    {
+        return currentTruncationDegree_;
+    }
+
+    //! Function to retrieve the order to which the expansion was evaluated at the last call to updateMembers
+    /*!
+     * Function to retrieve the order to which the expansion was evaluated at the last call to updateMembers, which is
+     * lower than the maximum order of the coefficients if the altitude-adaptive truncation is used.
+     * \return Order to which the expansion was evaluated at the last call to updateMembers
+     */
+    int getCurrentTruncationOrder( )
+    {
+        return currentTruncationOrder_;
+    }
+
     //! Function to retrieve maximum degree of gravity field expansion
     /*!
      * Function to retrieve maximum degree of gravity field expansion
@@ -477,6 +616,83 @@ protected:
 
 private:
 
+    //! Function to update the degree and order to which the expansion is evaluated, for altitude-adaptive truncation
+    void updateTruncationDegree( )
+    {
+        if( degreeAmplitudes_.rows( ) != cosineHarmonicCoefficients.rows( ) )
+        {
+            degreeAmplitudes_ = computeDegreeAmplitudeSpectrum( cosineHarmonicCoefficients, sineHarmonicCoefficients );
+        }
+
+        currentTruncationDegree_ = computeAdaptiveTruncationDegree(
+                    degreeAmplitudes_, equatorialRadius / currentRelativePosition_.norm( ),
+                    degreeTruncationTolerance_, degreeContributions_ );
+        currentTruncationOrder_ = std::min( currentTruncationOrder_, currentTruncationDegree_ );
+    }
+
+    //! Function to compute the acceleration in the integration frame at the current relative position
+    /*!
+     * Function to compute the acceleration in the integration frame at the current relative position, using the
+     * algorithm defined by evaluationAlgorithm_.
+     * \param cosineCoefficients Cosine coefficients to use
+     * \param sineCoefficients Sine coefficients to use
+     * \param accelerationPerTerm List of contributions to accelerations at given degrees/orders (returned by reference
+     * if saveSeparateTerms is true)
+     * \param saveSeparateTerms Boolean to denote whether the separate terms in the acceleration are to be saved
+     * \return Spherical harmonic acceleration in integration frame
+     */
+    Eigen::Vector3d computeAccelerationSum(
+            const Eigen::Ref< const Eigen::MatrixXd >& cosineCoefficients,
+            const Eigen::Ref< const Eigen::MatrixXd >& sineCoefficients,
+            std::map< std::pair< int, int >, Eigen::Vector3d >& accelerationPerTerm,
+            const bool saveSeparateTerms )
+    {
+        if( evaluationAlgorithm_ == column_wise_spherical_harmonics_evaluation && !saveSeparateTerms )
+        {
+            if( cosineCoefficients.rows( ) - 1 > columnWiseCache_.getMaximumDegree( ) ||
+                    cosineCoefficients.cols( ) - 1 > columnWiseCache_.getMaximumOrder( ) )
+            {
+                columnWiseCache_.resetMaximumDegreeAndOrder(
+                            cosineCoefficients.rows( ) - 1, cosineCoefficients.cols( ) - 1 );
+            }
+            return computeGeodesyNormalizedGravitationalAccelerationSumColumnWise(
+                        currentRelativePosition_,
+                        gravitationalParameter,
+                        equatorialRadius,
+                        cosineCoefficients,
+                        sineCoefficients, columnWiseCache_,
+                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+        }
+        else if( evaluationAlgorithm_ == pines_spherical_harmonics_evaluation && !saveSeparateTerms )
+        {
+            if( cosineCoefficients.rows( ) - 1 > pinesCache_->getMaximumDegree( ) ||
+                    cosineCoefficients.cols( ) - 1 > pinesCache_->getMaximumOrder( ) )
+            {
+                pinesCache_->resetMaximumDegreeAndOrder(
+                            cosineCoefficients.rows( ) - 1, cosineCoefficients.cols( ) - 1 );
+            }
+            return computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                        currentRelativePosition_,
+                        gravitationalParameter,
+                        equatorialRadius,
+                        cosineCoefficients,
+                        sineCoefficients, *pinesCache_,
+                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+        }
+        else
+        {
+            return computeGeodesyNormalizedGravitationalAccelerationSum(
+                        currentRelativePosition_,
+                        gravitationalParameter,
+                        equatorialRadius,
+                        cosineCoefficients,
+                        sineCoefficients, sphericalHarmonicsCache_,
+                        accelerationPerTerm,
+                        saveSeparateTerms,
+                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+        }
+    }
+
     //! Equatorial radius [m].
     /*!
      * Current value of equatorial (planetary) radius used for spherical harmonics expansion [m].
@@ -540,6 +756,30 @@ private:
     //! Maximum order of gravity field expansion
     int maximumOrder_;
 
+    //! Algorithm with which the spherical harmonic expansion is evaluated
+    SphericalHarmonicsEvaluationAlgorithm evaluationAlgorithm_ = term_wise_spherical_harmonics_evaluation;
+
+    //! Cache with recursion multipliers and work buffers for column-wise evaluation of spherical harmonic expansion
+    ColumnWiseSphericalHarmonicsCache columnWiseCache_;
+
+    //! Cache with derived Legendre functions and recursion multipliers for Pines evaluation of spherical harmonic expansion
+    std::shared_ptr< PinesSphericalHarmonicsCache > pinesCache_;
+
+    //! Tolerance for the altitude-adaptive truncation of the expansion (no truncation if not positive)
+    double degreeTruncationTolerance_ = 0.0;
+
+    //! Degree amplitude spectrum of the coefficients, used for altitude-adaptive truncation
+    Eigen::VectorXd degreeAmplitudes_;
+
+    //! Work buffer for estimated acceleration contributions per degree, used for altitude-adaptive truncation
+    Eigen::VectorXd degreeContributions_;
+
+    //! Degree to which the expansion was evaluated at the last call to updateMembers
+    int currentTruncationDegree_ = -1;
+
+    //! Order to which the expansion was evaluated at the last call to updateMembers
+    int currentTruncationOrder_ = -1;
+
 };
 
 
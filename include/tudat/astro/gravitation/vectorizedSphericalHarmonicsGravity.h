@@ -0,0 +1,210 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Heiskanen, W.A., Moritz, H. Physical geodesy. Freeman, 1967.
+ *      Holmes, S.A., Featherstone, W.E. A unified approach to the Clenshaw summation and the
+ *        recursive computation of very high degree and order normalised associated Legendre
+ *        functions. Journal of Geodesy, 76(5):279-299, 2002.
+ *
+ *    Notes
+ *      The column-wise evaluation in this file produces the same acceleration as
+ *      computeGeodesyNormalizedGravitationalAccelerationSum, but evaluates all degrees of a single
+ *      order in one pass over contiguous memory. Since Eigen matrices are stored column-major, a
+ *      single column of the coefficient matrices (all degrees at fixed order) is contiguous, so that
+ *      the summations in the kernel reduce to dot products that Eigen vectorizes.
+ *
+ */
+
+#ifndef TUDAT_VECTORIZED_SPHERICAL_HARMONICS_GRAVITY_H
+#define TUDAT_VECTORIZED_SPHERICAL_HARMONICS_GRAVITY_H
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Enum defining the algorithm used to evaluate a spherical harmonic gravitational acceleration.
+enum SphericalHarmonicsEvaluationAlgorithm
+{
+    term_wise_spherical_harmonics_evaluation,
+    column_wise_spherical_harmonics_evaluation,
+    pines_spherical_harmonics_evaluation
+};
+
+//! Function to compute the multipliers of the geodesy-normalized fixed-order Legendre recursions.
+/*!
+ * Function to compute the multipliers of the geodesy-normalized fixed-order Legendre recursions (Holmes & Featherstone,
+ * 2002), stored column-major as (degree, order). The same multipliers apply to the geodesy-normalized derived Legendre
+ * functions used in the Pines formulation, for which the sectoral recursion omits the cos(latitude) factor.
+ * \param maximumDegree Maximum degree for which multipliers are to be computed
+ * \param numberOfOrderColumns Number of orders (starting at 0) for which multipliers are to be computed
+ * \param firstColumnMultipliers Multipliers of P_{n-1,m} in the fixed-order recursion (returned by reference)
+ * \param secondColumnMultipliers Multipliers of P_{n-2,m} in the fixed-order recursion (returned by reference)
+ * \param derivativeMultipliers Multipliers of P_{n,m+1} in the derivative of P_{n,m} (returned by reference)
+ * \param sectoralMultipliers Multipliers of P_{m-1,m-1} in the sectoral recursion (returned by reference)
+ */
+void computeGeodesyNormalizedColumnRecursionMultipliers(
+        const int maximumDegree,
+        const int numberOfOrderColumns,
+        Eigen::MatrixXd& firstColumnMultipliers,
+        Eigen::MatrixXd& secondColumnMultipliers,
+        Eigen::MatrixXd& derivativeMultipliers,
+        Eigen::VectorXd& sectoralMultipliers );
+
+//! Cache object for the column-wise (order-by-order) evaluation of spherical harmonic accelerations.
+/*!
+ *  Cache object for the column-wise (order-by-order) evaluation of spherical harmonic accelerations. All degree- and
+ *  order-dependent multipliers of the geodesy-normalized Legendre recursions are computed once (upon construction or
+ *  resetting of the maximum degree/order), and stored column-major, so that the recursion for a single order
+ *  accesses contiguous memory. In addition, the object holds the work buffers in which the Legendre functions of a
+ *  single order, and the powers of the reference radius ratio are stored, so that no memory is allocated during the
+ *  evaluation of the acceleration.
+ */
+class ColumnWiseSphericalHarmonicsCache
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree to which to update cache
+     * \param maximumOrder Maximum order to which to update cache
+     */
+    ColumnWiseSphericalHarmonicsCache( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Update maximum degree and order of cache, and recompute all recursion multipliers.
+    /*!
+     * Update maximum degree and order of cache, and recompute all recursion multipliers.
+     * \param maximumDegree Maximum degree to which to update cache
+     * \param maximumOrder Maximum order to which to update cache
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Update the trigonometric functions of multiples of the longitude and the powers of the radius ratio.
+    /*!
+     * Update the trigonometric functions of multiples of the longitude and the powers of the radius ratio. Multiples of
+     * the longitude are computed by angle-addition recurrences, so that no trigonometric functions are evaluated.
+     * \param radiusRatio Reference radius divided by current distance
+     * \param cosineOfLongitude Cosine of the current longitude
+     * \param sineOfLongitude Sine of the current longitude
+     */
+    void update( const double radiusRatio,
+                 const double cosineOfLongitude,
+                 const double sineOfLongitude );
+
+    //! Function to get the maximum degree of cache.
+    /*!
+     * Function to get the maximum degree of cache
+     * \return Maximum degree of cache.
+     */
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order of cache.
+    /*!
+     * Function to get the maximum order of cache
+     * \return Maximum order of cache.
+     */
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+    //! Multipliers of P_{n-1,m} in the column (fixed-order) recursion, stored as (degree, order)
+    Eigen::MatrixXd firstColumnMultipliers_;
+
+    //! Multipliers of P_{n-2,m} in the column (fixed-order) recursion, stored as (degree, order)
+    Eigen::MatrixXd secondColumnMultipliers_;
+
+    //! Multipliers of P_{n,m+1} in the derivative of P_{n,m} w.r.t. latitude, stored as (degree, order)
+    Eigen::MatrixXd derivativeMultipliers_;
+
+    //! Multipliers of cos(latitude) P_{m-1,m-1} in the sectoral recursion, entry m corresponds to P_{m,m}
+    Eigen::VectorXd sectoralMultipliers_;
+
+    //! Degree plus one, as double (entry n is n + 1)
+    Eigen::VectorXd degreePlusOne_;
+
+    //! Reference radius ratio to the power degree plus one (entry n is (R/r)^(n+1))
+    Eigen::VectorXd radiusRatioPowers_;
+
+    //! Cosine of order times longitude (entry m is cos(m lambda))
+    Eigen::VectorXd cosinesOfLongitude_;
+
+    //! Sine of order times longitude (entry m is sin(m lambda))
+    Eigen::VectorXd sinesOfLongitude_;
+
+    //! Work buffer for Legendre functions of the current order, entry n is P_{n,m}
+    Eigen::VectorXd currentOrderLegendreFunctions_;
+
+    //! Work buffer for Legendre functions of the next order, entry n is P_{n,m+1}
+    Eigen::VectorXd nextOrderLegendreFunctions_;
+
+    //! Work buffer for products of radius ratio power and Legendre functions of current order
+    Eigen::VectorXd scaledLegendreFunctions_;
+
+    //! Work buffer for products of radius ratio power and latitude derivative of Legendre functions of current order
+    Eigen::VectorXd scaledLegendreDerivatives_;
+
+private:
+
+    //! Maximum degree of cache.
+    int maximumDegree_;
+
+    //! Maximum order of cache.
+    int maximumOrder_;
+};
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, using a column-wise evaluation.
+/*!
+ * Compute gravitational acceleration due to multiple spherical harmonics terms, defined using geodesy-normalization.
+ * This function computes the same quantity as computeGeodesyNormalizedGravitationalAccelerationSum (see that function
+ * for a definition of the input), but does not evaluate the expansion term-by-term. Instead, for each order m, the
+ * geodesy-normalized Legendre functions (and their latitude derivatives) of all degrees are generated into a
+ * contiguous buffer by the fixed-order recursion (Holmes & Featherstone, 2002), after which the contributions of all
+ * degrees at this order are obtained from dot products with the contiguous column m of the coefficient matrices. The
+ * latitude, longitude and their trigonometric functions are obtained directly from the Cartesian position, so that no
+ * trigonometric functions are evaluated.
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the
+ *          reference frame that is associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic
+ *          coefficients. The row index indicates the degree and the column index indicates the order
+ *          of coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ *          The matrix must be equal in size to cosineHarmonicCoefficients.
+ * \param columnWiseCache Cache object with precomputed recursion multipliers and work buffers. Its maximum degree and
+ *          order must be at least equal to those of the coefficient matrices.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumColumnWise(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::Ref< const Eigen::MatrixXd >& cosineHarmonicCoefficients,
+        const Eigen::Ref< const Eigen::MatrixXd >& sineHarmonicCoefficients,
+        ColumnWiseSphericalHarmonicsCache& columnWiseCache,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_VECTORIZED_SPHERICAL_HARMONICS_GRAVITY_H
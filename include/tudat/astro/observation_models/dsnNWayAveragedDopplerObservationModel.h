@@ -136,7 +136,10 @@ public:
         arcEndObservationModel_( arcEndObservationModel ),
         numberOfLinkEnds_( linkEnds.size( ) ),
         transmittingFrequencyCalculator_( transmittingFrequencyCalculator ),
-        turnaroundRatio_( turnaroundRatio )
+        turnaroundRatio_( turnaroundRatio ),
+        useIntervalChaining_( false ),
+        isIntervalEndCacheSet_( false ),
+        numberOfReusedIntervalLegs_( 0 )
     {
         if( !std::is_same< Time, TimeType >::value )
         {
@@ -225,13 +228,37 @@ public:
         TimeType receptionStartTime = time - integrationTime / 2.0;
         TimeType receptionEndTime = time + integrationTime / 2.0;
 
-        TimeType startLightTime = arcStartObservationModel_->computeIdealObservationsWithLinkEndData(
-                receptionStartTime, linkEndAssociatedWithTime, arcStartLinkEndTimes, arcStartLinkEndStates,
-                ancillarySettings )( 0, 0 ) / physical_constants::getSpeedOfLight< ObservationScalarType >( );
+        // If the current count interval starts exactly where the previous one ended, reuse the previous end leg as start
+        // leg (only exact equality is accepted, so that the observable is always computed over the requested interval)
+        TimeType startLightTime;
+        if( useIntervalChaining_ && isIntervalEndCacheSet_ && ( ancillarySettings == intervalEndAncillarySettings_ ) &&
+                ( receptionStartTime == intervalEndReceptionTime_ ) )
+        {
+            startLightTime = intervalEndLightTime_;
+            arcStartLinkEndTimes = intervalEndLinkEndTimes_;
+            arcStartLinkEndStates = intervalEndLinkEndStates_;
+            numberOfReusedIntervalLegs_++;
+        }
+        else
+        {
+            startLightTime = arcStartObservationModel_->computeIdealObservationsWithLinkEndData(
+                    receptionStartTime, linkEndAssociatedWithTime, arcStartLinkEndTimes, arcStartLinkEndStates,
+                    ancillarySettings )( 0, 0 ) / physical_constants::getSpeedOfLight< ObservationScalarType >( );
+        }
         TimeType endLightTime = arcEndObservationModel_->computeIdealObservationsWithLinkEndData(
                 receptionEndTime, linkEndAssociatedWithTime, arcEndLinkEndTimes, arcEndLinkEndStates,
                 ancillarySettings )( 0, 0 ) / physical_constants::getSpeedOfLight< ObservationScalarType >( );
 
+        if( useIntervalChaining_ )
+        {
+            isIntervalEndCacheSet_ = true;
+            intervalEndAncillarySettings_ = ancillarySettings;
+            intervalEndReceptionTime_ = receptionEndTime;
+            intervalEndLightTime_ = endLightTime;
+            intervalEndLinkEndTimes_ = arcEndLinkEndTimes;
+            intervalEndLinkEndStates_ = arcEndLinkEndStates;
+        }
+
         // Moyer (2000), eqs. 13-52 and 13-53
         TimeType transmissionStartTime = receptionStartTime - startLightTime;
         TimeType transmissionEndTime = receptionEndTime - endLightTime;
@@ -263,6 +290,44 @@ public:
         return observation;
     }
 
+    /*! Function to set whether light-time solutions are shared between adjacent count intervals.
+     *
+     * Function to set whether light-time solutions are shared between adjacent count intervals. If enabled, the
+     * solution for the end of the integration interval (reception time, link end times and states) is stored, and reused
+     * as the solution for the start of the next integration interval, provided that the new reception start time is
+     * exactly equal to the stored reception end time, and that the same ancillary settings are used. For
+     * back-to-back count intervals (as in DSN tracking data), this halves the number of light-time solutions. The stored
+     * solution is cleared by resetObservationCache, which is called before each observation set is evaluated. This
+     * option is normally set through the useIntervalChaining input of the DsnNWayAveragedDopplerObservationSettings, in
+     * which case the observation partials created for this model share their interval end/start values in the same way.
+     *
+     * @param useIntervalChaining Boolean denoting whether to share light-time solutions between adjacent intervals
+     */
+    void setIntervalChaining( const bool useIntervalChaining )
+    {
+        useIntervalChaining_ = useIntervalChaining;
+        resetObservationCache( );
+    }
+
+    //! Function to clear the light-time solution stored for the end of the previous count interval
+    void resetObservationCache( )
+    {
+        isIntervalEndCacheSet_ = false;
+        intervalEndAncillarySettings_ = nullptr;
+    }
+
+    //! Function to retrieve whether light-time solutions are shared between adjacent count intervals
+    bool getUseIntervalChaining( )
+    {
+        return useIntervalChaining_;
+    }
+
+    // Function to retrieve the number of interval start legs that were reused from a previous interval end
+    unsigned int getNumberOfReusedIntervalLegs( )
+    {
+        return numberOfReusedIntervalLegs_;
+    }
+
     // Function to retrieve the arc end observation model
     std::shared_ptr< NWayRangeObservationModel< ObservationScalarType, TimeType > > getArcEndObservationModel( )
     {
@@ -291,6 +356,30 @@ private:
 
     // Function returning the turnaround ratio for given uplink and downlink bands
     std::function< double ( FrequencyBands uplinkBand, FrequencyBands downlinkBand ) > turnaroundRatio_;
+
+    // Boolean denoting whether light-time solutions are shared between adjacent count intervals
+    bool useIntervalChaining_;
+
+    // Boolean denoting whether a solution for the end of the previous count interval is stored
+    bool isIntervalEndCacheSet_;
+
+    // Ancillary settings with which the stored end of the previous count interval was computed
+    std::shared_ptr< ObservationAncilliarySimulationSettings > intervalEndAncillarySettings_;
+
+    // Reception time at the end of the previous count interval
+    TimeType intervalEndReceptionTime_;
+
+    // Light time at the end of the previous count interval
+    TimeType intervalEndLightTime_;
+
+    // Link end times at the end of the previous count interval
+    std::vector< double > intervalEndLinkEndTimes_;
+
+    // Link end states at the end of the previous count interval
+    std::vector< Eigen::Matrix< double, 6, 1 > > intervalEndLinkEndStates_;
+
+    // Number of interval start legs that were reused from a previous interval end
+    unsigned int numberOfReusedIntervalLegs_;
 };
 
 
@@ -522,6 +522,10 @@ public:
         !std::isnan( static_cast< double >( linkEndsTimes.at( currentMultiLegReceiverIndex ) ) ) )
         {
             previousLightTimeCalculation = currentCorrection_ + currentIdealLightTime_;
+
+            return iterateLightTimeFromInitialGuess(
+                        linkEndsStates, linkEndsTimes, time, isTimeAtReception, currentMultiLegTransmitterIndex,
+                        ancillarySettings, computeLightTimeCorrections, previousLightTimeCalculation );
         }
         // If no link end times are provided, compute an initial guess for the light time without corrections
         else
@@ -532,8 +536,182 @@ public:
             currentCorrection_ = 0.0;
 
             previousLightTimeCalculation = calculateNewLightTimeEstimate( receiverState, transmitterState );
+
+            // Reuse state of link end at fixed time in iteration
+            return iterateLightTimeFromInitialGuess(
+                        linkEndsStates, linkEndsTimes, time, isTimeAtReception, currentMultiLegTransmitterIndex,
+                        ancillarySettings, computeLightTimeCorrections, previousLightTimeCalculation,
+                        isTimeAtReception ? receiverState : transmitterState );
+        }
+    }
+
+    //! Function to calculate the light times and link-ends states for a list of (sorted) times.
+    /*!
+     *  Function to calculate the transmitter state at transmission time, the receiver state at reception time, and the
+     *  light time, for each of a list of times sorted in non-decreasing order. The iterative solution for each time is
+     *  initialized by (up to quadratic) extrapolation of the light times at the preceding times, instead of from the
+     *  instantaneous geometric distance. For densely sampled data, this typically means that the initial guess is
+     *  accepted after a single evaluation of the link end states. A time equal to the preceding time reuses its solution.
+     *  If a time step exceeds four times the preceding time step (e.g. at the start of a new tracking pass), the solution
+     *  is initialized in the same manner as calculateLightTimeWithLinkEndsStates. If the states of the link end at which
+     *  the times are fixed have already been computed (e.g. by another observation model using the same link end and
+     *  times), they may be provided as input, in which case they are not recomputed.
+     *  \param receiverStatesOutput Output by reference of receiver states (one per entry of times).
+     *  \param transmitterStatesOutput Output by reference of transmitter states (one per entry of times).
+     *  \param times Times at reception or transmission, in non-decreasing order.
+     *  \param isTimeAtReception True if input times are at reception, false if at transmission.
+     *  \param ancillarySettings Ancilliary settings for the observations.
+     *  \param fixedLinkEndStates States of the receiver (if isTimeAtReception is true) or transmitter (if false) at the
+     *  given times, or empty (default) if these are to be computed.
+     *  \return The light times between the receiver and transmitter states (one per entry of times).
+     */
+    std::vector< ObservationScalarType > calculateLightTimesWithLinkEndsStates(
+            std::vector< StateType >& receiverStatesOutput,
+            std::vector< StateType >& transmitterStatesOutput,
+            const std::vector< TimeType >& times,
+            const bool isTimeAtReception = true,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings > ancillarySettings = nullptr,
+            const std::vector< StateType >& fixedLinkEndStates = std::vector< StateType >( ) )
+    {
+        if( fixedLinkEndStates.size( ) != 0 && fixedLinkEndStates.size( ) != times.size( ) )
+        {
+            throw std::runtime_error( "Error when calculating light times for list of times, number of provided link end states (" +
+                                      std::to_string( fixedLinkEndStates.size( ) ) + ") is inconsistent with number of times (" +
+                                      std::to_string( times.size( ) ) + ")." );
+        }
+
+        std::vector< ObservationScalarType > lightTimes( times.size( ) );
+        receiverStatesOutput.resize( times.size( ) );
+        transmitterStatesOutput.resize( times.size( ) );
+
+        std::vector< StateType > linkEndsStates( 2 );
+        std::vector< TimeType > linkEndsTimes( 2 );
+
+        // Preceding (distinct) times and associated light times, used to extrapolate initial guess (most recent last).
+        std::vector< TimeType > previousTimes;
+        std::vector< ObservationScalarType > previousLightTimes;
+
+        numberOfBatchIterations_ = 0;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            if( i > 0 )
+            {
+                if( times.at( i ) < times.at( i - 1 ) )
+                {
+                    throw std::runtime_error( "Error when calculating light times for list of times, times are not sorted." );
+                }
+                else if( times.at( i ) == times.at( i - 1 ) )
+                {
+                    lightTimes.at( i ) = lightTimes.at( i - 1 );
+                    receiverStatesOutput.at( i ) = receiverStatesOutput.at( i - 1 );
+                    transmitterStatesOutput.at( i ) = transmitterStatesOutput.at( i - 1 );
+                    continue;
+                }
+            }
+
+            // Discard preceding solutions if time step is irregular.
+            if( previousTimes.size( ) > 1 )
+            {
+                if( static_cast< double >( times.at( i ) - previousTimes.back( ) ) >
+                        4.0 * static_cast< double >( previousTimes.back( ) - previousTimes.at( previousTimes.size( ) - 2 ) ) )
+                {
+                    previousTimes.clear( );
+                    previousLightTimes.clear( );
+                }
+            }
+
+            // Extrapolate light time from preceding solutions (Lagrange polynomial through up to three points).
+            ObservationScalarType initialLightTimeGuess = mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+            if( previousTimes.size( ) > 0 )
+            {
+                for( unsigned int j = 0; j < previousTimes.size( ); j++ )
+                {
+                    ObservationScalarType lagrangeCoefficient = mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 );
+                    for( unsigned int k = 0; k < previousTimes.size( ); k++ )
+                    {
+                        if( k != j )
+                        {
+                            lagrangeCoefficient *= static_cast< ObservationScalarType >( times.at( i ) - previousTimes.at( k ) ) /
+                                    static_cast< ObservationScalarType >( previousTimes.at( j ) - previousTimes.at( k ) );
+                        }
+                    }
+                    initialLightTimeGuess += lagrangeCoefficient * previousLightTimes.at( j );
+                }
+            }
+
+            // Retrieve state of link end at fixed time, if provided
+            StateType fixedLinkEndState = ( fixedLinkEndStates.size( ) > 0 ) ?
+                        fixedLinkEndStates.at( i ) : StateType( StateType::Constant( TUDAT_NAN ) );
+
+            // If no extrapolated initial guess is available, compute initial guess without corrections
+            if( !( previousTimes.size( ) > 0 && initialLightTimeGuess > 0.0 ) )
+            {
+                if( std::isnan( static_cast< double >( fixedLinkEndState( 0 ) ) ) )
+                {
+                    fixedLinkEndState = isTimeAtReception ?
+                                stateFunctionOfReceivingBody_( times.at( i ) ) : stateFunctionOfTransmittingBody_( times.at( i ) );
+                }
+                StateType otherLinkEndState = isTimeAtReception ?
+                            stateFunctionOfTransmittingBody_( times.at( i ) ) : stateFunctionOfReceivingBody_( times.at( i ) );
+
+                currentCorrection_ = 0.0;
+                initialLightTimeGuess = isTimeAtReception ?
+                            calculateNewLightTimeEstimate( fixedLinkEndState, otherLinkEndState ) :
+                            calculateNewLightTimeEstimate( otherLinkEndState, fixedLinkEndState );
+            }
+
+            // Compute light time
+            lightTimes.at( i ) = iterateLightTimeFromInitialGuess(
+                        linkEndsStates, linkEndsTimes, times.at( i ), isTimeAtReception, 0, ancillarySettings, true,
+                        initialLightTimeGuess, fixedLinkEndState );
+            transmitterStatesOutput.at( i ) = linkEndsStates.at( 0 );
+            receiverStatesOutput.at( i ) = linkEndsStates.at( 1 );
+            numberOfBatchIterations_ += iterationCounter_;
+
+            // Update list of preceding solutions
+            if( previousTimes.size( ) == 3 )
+            {
+                previousTimes.erase( previousTimes.begin( ) );
+                previousLightTimes.erase( previousLightTimes.begin( ) );
+            }
+            previousTimes.push_back( times.at( i ) );
+            previousLightTimes.push_back( lightTimes.at( i ) );
         }
 
+        return lightTimes;
+    }
+
+    //! Function to calculate the light time and link-ends states, starting from a given initial guess for the light time.
+    /*!
+     *  Function to calculate the transmitter state at transmission time, the receiver state at reception time, and the
+     *  light time, with the iterative solution starting from a given initial guess of the light time.
+     *  \param linkEndsStates Output link end states over all legs of model.
+     *  \param linkEndsTimes Output link end times over all legs of model.
+     *  \param time Time at reception or transmission.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     *  \param currentMultiLegTransmitterIndex Index of current transmitter in multi-leg model
+     *  \param ancillarySettings Ancilliary settings for the observation.
+     *  \param computeLightTimeCorrections Boolean denoting whether light-time corrections are to be computed
+     *  \param initialLightTimeGuess Initial guess for the light time (including corrections)
+     *  \param fixedLinkEndState State of the receiver (if isTimeAtReception is true) or transmitter (if false) at the
+     *  input time, if already computed. If NaN (default), it is computed by this function.
+     *  \return The value of the light time between the reciever state and the transmitter state.
+     */
+    ObservationScalarType iterateLightTimeFromInitialGuess(
+        std::vector< StateType >& linkEndsStates,
+        std::vector< TimeType >& linkEndsTimes,
+        const TimeType time,
+        const bool isTimeAtReception,
+        const unsigned int currentMultiLegTransmitterIndex,
+        const std::shared_ptr< ObservationAncilliarySimulationSettings > ancillarySettings,
+        const bool computeLightTimeCorrections,
+        const ObservationScalarType initialLightTimeGuess,
+        const StateType& fixedLinkEndState = StateType::Constant( TUDAT_NAN ) )
+    {
+        TimeType receptionTime = time, transmissionTime = time;
+        StateType receiverState, transmitterState;
+        ObservationScalarType previousLightTimeCalculation = initialLightTimeGuess;
+
         // Set value of transmission and reception times based on initial guess for light time
         if ( isTimeAtReception ) // reference time is at reception
         {
@@ -543,9 +721,25 @@ public:
         {
             receptionTime = transmissionTime + previousLightTimeCalculation;
         }
-        // Set receiver and transmitter states to initial guess
-        receiverState = stateFunctionOfReceivingBody_( receptionTime );
-        transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+        // Set receiver and transmitter states to initial guess (reusing the state at the fixed link end, if provided)
+        const bool isFixedLinkEndStateProvided = !std::isnan( static_cast< double >( fixedLinkEndState( 0 ) ) );
+        if( isTimeAtReception && isFixedLinkEndStateProvided )
+        {
+            receiverState = fixedLinkEndState;
+        }
+        else
+        {
+            receiverState = stateFunctionOfReceivingBody_( receptionTime );
+        }
+
+        if( !isTimeAtReception && isFixedLinkEndStateProvided )
+        {
+            transmitterState = fixedLinkEndState;
+        }
+        else
+        {
+            transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+        }
 
         // Set variables for iteration of light time
         iterationCounter_ = 0;
@@ -678,6 +872,12 @@ public:
         return iterationCounter_;
     }
 
+    //! Function to get the total number of iterations in the last call to calculateLightTimesWithLinkEndsStates
+    unsigned int getNumberOfBatchIterations( )
+    {
+        return numberOfBatchIterations_;
+    }
+
     std::function< StateType( const TimeType ) > getStateFunctionOfTransmittingBody( )
     {
         return stateFunctionOfTransmittingBody_;
@@ -729,6 +929,9 @@ protected:
     // Number of iterations until light time convergence
     unsigned int iterationCounter_;
 
+    // Total number of iterations in last call to calculateLightTimesWithLinkEndsStates
+    unsigned int numberOfBatchIterations_ = 0;
+
     //! Function to calculate a new light-time estimate from the link-ends states.
     /*!
      *  Function to calculate a new light-time estimate from the states of the two ends of the
@@ -103,6 +103,33 @@ public:
      */
     virtual std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > getObservationSimulator( ) = 0;
 
+    //! Function to reset the object used to compute the state transition/sensitivity matrix at a given time
+    /*!
+     * Function to reset the object used to compute the state transition/sensitivity matrix at a given time
+     * \param stateTransitionMatrixInterface New object used to compute the state transition/sensitivity matrix
+     */
+    void resetStateTransitionMatrixInterface(
+            const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface )
+    {
+        stateTransitionMatrixInterface_ = stateTransitionMatrixInterface;
+        if( stateTransitionMatrixInterface_ != nullptr )
+        {
+            stateTransitionMatrixSize_ = stateTransitionMatrixInterface_->getStateTransitionMatrixSize( );
+        }
+        else
+        {
+            stateTransitionMatrixSize_ = 0;
+        }
+    }
+
+    //! Function to reset the object used to retrieve the propagated dependent variables at a given time
+    /*!
+     * Function (pure virtual) to reset the object used to retrieve the propagated dependent variables at a given time
+     * \param dependentVariablesInterface New object used to retrieve the propagated dependent variables
+     */
+    virtual void resetDependentVariablesInterface(
+            const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface ) = 0;
+
 
 protected:
 
@@ -110,12 +137,15 @@ protected:
     /*!
      *  Function to get the state transition matrix Phi and sensitivity matrix S at a given time as a single matrix [Phi;S]
      *  \param evaluationTime Time at which matrices are to be evaluated
-     *  \return Concatenated state transition and sensitivity matrices at given time.
+     *  \param combinedMatrix Concatenated state transition and sensitivity matrices at given time (returned by reference)
+     *  \param arcDefiningBodies List of bodies used to define the current arc (multi-arc only)
      */
-    Eigen::MatrixXd getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime,
-                                                                    const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) )
+    void getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime,
+                                                         Eigen::MatrixXd& combinedMatrix,
+                                                         const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) )
     {
-        return stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime, true, arcDefiningBodies );
+        stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, combinedMatrix, true, arcDefiningBodies );
     }
 
 
@@ -189,6 +219,17 @@ public:
     //! Virtual destructor
     virtual ~ObservationManager( ){ }
 
+    //! Function to reset the object used to retrieve the propagated dependent variables at a given time
+    /*!
+     * Function to reset the object used to retrieve the propagated dependent variables at a given time
+     * \param dependentVariablesInterface New object used to retrieve the propagated dependent variables
+     */
+    void resetDependentVariablesInterface(
+            const std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > dependentVariablesInterface )
+    {
+        dependentVariablesInterface_ = dependentVariablesInterface;
+    }
+
     //! Function to return the size of the observable for a given set of link ends
     /*!
      * Function to return the size of the observable for a given set of link ends
@@ -255,7 +296,18 @@ public:
 
         Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
 
-        // Iterate over all observation times
+        // Clear data stored for reuse between subsequent observations, as parameters or environment may have changed
+        selectedObservationModel->resetObservationCache( );
+        if( calculatePartials && observationPartials_.count( linkEnds ) > 0 )
+        {
+            for( auto partialIterator : observationPartials_.at( linkEnds ) )
+            {
+                partialIterator.second->resetPartialCache( );
+            }
+        }
+
+        // Iterate over all observation times. Each observation is computed directly before its partials, as some partials
+        // (e.g. of light-time corrections) use values stored by the observation model during the last computation.
         int currentObservationSize;
         for( unsigned int i = 0; i < times.size( ); i++ )
         {
@@ -433,8 +485,9 @@ protected:
                     // Evaluate [Phi;S] matrix at each time instant associated with partial, if not yet evaluated.
                     if( combinedStateTransitionMatrices.count( singlePartialSet[ i ].second ) == 0 )
                     {
-                        combinedStateTransitionMatrices[ singlePartialSet[ i ].second ] =
-                                this->getCombinedStateTransitionAndSensitivityMatrix( singlePartialSet[ i ].second, bodiesOfInterestInLinkEnds /*bodiesInLinkEnds*/ );
+                        this->getCombinedStateTransitionAndSensitivityMatrix(
+                                    singlePartialSet[ i ].second, combinedStateTransitionMatrices[ singlePartialSet[ i ].second ],
+                                    bodiesOfInterestInLinkEnds /*bodiesInLinkEnds*/ );
                     }
 
                     // Add partial of observation h w.r.t. initial state x_{0} (dh/dx_{0}=dh/dx*dx/dx_{0})
@@ -350,6 +350,15 @@ public:
         return linkEnds_;
     }
 
+    //! Function to reset any data that is cached between subsequent evaluations of the observation model
+    /*!
+     * Function to reset any data that is cached between subsequent evaluations of the observation model (e.g. light-time
+     * solutions shared between adjacent integration intervals). It is called before the observations of a single
+     * observation set are computed, so that no data cached for a different set (or for a previous state of the
+     * environment) is used. The default implementation does nothing.
+     */
+    virtual void resetObservationCache( ){ }
+
     //! Function to compute the observable without any corrections
     /*!
      * Function to compute the observable without any corrections, i.e. the ideal physical observable as computed
@@ -415,6 +424,96 @@ public:
         }
     }
 
+    //! Function to compute the observables without any corrections at a list of times
+    /*!
+     *  Function to compute the observables without any corrections at a list of times, see
+     *  computeIdealObservationsWithLinkEndData. The default implementation evaluates the observables one by one. This
+     *  function may be redefined in derived class for improved efficiency, e.g. by using the light-time solutions at
+     *  preceding times as initial guess for those at the next time.
+     *  \param times Times at which observables are to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid.
+     *  \param observations List of observables (returned by reference, one per entry of times).
+     *  \param linkEndTimes List of times at each link end, per observation (returned by reference).
+     *  \param linkEndStates List of states at each link end, per observation (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings for the observations.
+     */
+    virtual void computeIdealObservationSetWithLinkEndData(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings > ancilliarySetings = nullptr )
+    {
+        observations.resize( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            linkEndTimes[ i ].clear( );
+            linkEndStates[ i ].clear( );
+            observations[ i ] = computeIdealObservationsWithLinkEndData(
+                        times[ i ], linkEndAssociatedWithTime, linkEndTimes[ i ], linkEndStates[ i ], ancilliarySetings );
+        }
+    }
+
+    //! Function to compute full observations at a list of times.
+    /*!
+     *  Function to compute observations at a list of times (include any defined non-ideal corrections), using
+     *  computeIdealObservationSetWithLinkEndData. The times and states of the link ends are returned by reference.
+     *  Any values stored in the observation model (e.g. light-time corrections) only reflect the last entry of times
+     *  on return, so this function should not be used when observation partials are to be computed after each
+     *  observation (see ObservationManager::computeObservationsWithPartials).
+     *  \param times Times at which observations are to be simulated
+     *  \param linkEndAssociatedWithTime Link end at which current times are measured, i.e. reference link end for
+     *  observable.
+     *  \param observations List of observables (returned by reference, one per entry of times).
+     *  \param linkEndTimes List of times at each link end, per observation (returned by reference).
+     *  \param linkEndStates List of states at each link end, per observation (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings for the observations.
+     */
+    void computeObservationSetWithLinkEndData(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings > ancilliarySetings = nullptr )
+    {
+        // Add time bias if necessary
+        std::vector< TimeType > observationTimes( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            observationTimes[ i ] = computeBiasedObservationTime( times[ i ] );
+        }
+
+        // Check if any non-ideal models are set.
+        if( isBiasnullptr_ )
+        {
+            computeIdealObservationSetWithLinkEndData(
+                        observationTimes, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates,
+                        ancilliarySetings );
+        }
+        else
+        {
+            // Check that time biases are associated with the time reference time link.
+            checkReferenceLinkEndForTimeBiases( linkEndAssociatedWithTime );
+
+            // Compute ideal observables
+            computeIdealObservationSetWithLinkEndData(
+                        observationTimes, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates,
+                        ancilliarySetings );
+
+            // Add correction
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                observations[ i ] += this->observationBiasCalculator_->getObservationBias(
+                            linkEndTimes[ i ], linkEndStates[ i ], observations[ i ].template cast< double >( ) ).
+                        template cast< ObservationScalarType >( );
+            }
+        }
+    }
+
     //! Function to compute the observable without any corrections.
     /*!
      * Function to compute the observable without any corrections, i.e. the ideal physical observable as computed
@@ -151,31 +151,25 @@ public:
         std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
             this->getObservationModel( linkEnds );
 
-        // Initialize vectors of states and times of link ends to be used in calculations.
-        std::vector< Eigen::Vector6d > vectorOfStates;
-        std::vector< double > vectorOfTimes;
+        // Initialize vectors of observations, and states and times of link ends, to be used in calculations.
+        std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observationsList;
+        std::vector< std::vector< Eigen::Vector6d > > vectorsOfStates;
+        std::vector< std::vector< double > > vectorsOfTimes;
 
-        Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
+        // Compute observations at all observation times
+        selectedObservationModel->resetObservationCache( );
+        selectedObservationModel->computeObservationSetWithLinkEndData(
+            times, linkEndAssociatedWithTime, observationsList, vectorsOfTimes, vectorsOfStates, ancilliarySettings );
 
         // Iterate over all observation times
-//        int currentObservationSize;
         for( unsigned int i = 0; i < times.size( ); i++ )
         {
-            vectorOfTimes.clear( );
-            vectorOfStates.clear( );
-
-            // Compute observation
-            currentObservation = selectedObservationModel->computeObservationsWithLinkEndData(
-                times[ i ], linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates, ancilliarySettings );
             TimeType saveTime = times[ i ];
             while( observations.count( saveTime ) != 0 )
             {
                 saveTime += std::numeric_limits< double >::epsilon( ) * 10.0 * times[ i ];
             }
-
-            // Compute observation partial
-//            currentObservationSize = currentObservation.rows( );
-            observations[ saveTime ] = currentObservation;
+            observations[ saveTime ] = observationsList[ i ];
         }
 
         observationsVector = utilities::createConcatenatedEigenMatrixFromMapValues<TimeType, ObservationScalarType, ObservationSize, 1>( observations );
@@ -11,6 +11,7 @@
 #ifndef TUDAT_ONEWAYRANGEOBSERVATIONMODEL_H
 #define TUDAT_ONEWAYRANGEOBSERVATIONMODEL_H
 
+#include <algorithm>
 #include <map>
 
 #include <functional>
@@ -131,6 +132,70 @@ public:
         return ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) << observation ).finished( );
     }
 
+    //! Function to compute one-way range observables without any corrections at a list of times.
+    /*!
+     *  Function to compute one-way range observables without any corrections at a list of times, see
+     *  computeIdealObservationsWithLinkEndData. If the times are sorted, the light times are computed by
+     *  LightTimeCalculator::calculateLightTimesWithLinkEndsStates, which uses the light times at the preceding times as
+     *  initial guess for the light time at the next time. Otherwise, the observables are computed one by one.
+     *  \param times Times at which observables are to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid.
+     *  \param observations List of observables (returned by reference, one per entry of times).
+     *  \param linkEndTimes List of times at each link end, per observation (returned by reference).
+     *  \param linkEndStates List of states at each link end, per observation (returned by reference).
+     *  \param ancilliarySetings Ancilliary settings for the observations (none are supported).
+     */
+    void computeIdealObservationSetWithLinkEndData(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+            const std::shared_ptr< ObservationAncilliarySimulationSettings > ancilliarySetings = nullptr )
+    {
+        if( ancilliarySetings != nullptr )
+        {
+            throw std::runtime_error( "Error, calling one-way range observable with ancilliary settings, but none are supported." );
+        }
+
+        if( linkEndAssociatedWithTime != receiver && linkEndAssociatedWithTime != transmitter )
+        {
+            std::string errorMessage = "Error, cannot have link end type: " +
+                    std::to_string( linkEndAssociatedWithTime ) + "for one-way range";
+            throw std::runtime_error( errorMessage );
+        }
+
+        if( !std::is_sorted( times.begin( ), times.end( ) ) )
+        {
+            ObservationModel< 1, ObservationScalarType, TimeType >::computeIdealObservationSetWithLinkEndData(
+                        times, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates, ancilliarySetings );
+            return;
+        }
+
+        // Compute light times for all times
+        const bool isTimeAtReception = ( linkEndAssociatedWithTime == receiver );
+        std::vector< ObservationScalarType > lightTimes = lightTimeCalculator_->calculateLightTimesWithLinkEndsStates(
+                    receiverStates_, transmitterStates_, times, isTimeAtReception, ancilliarySetings );
+
+        // Convert light times to ranges, and set link end states and times.
+        observations.resize( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            observations[ i ] = ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) <<
+                                  lightTimes[ i ] * physical_constants::getSpeedOfLight< ObservationScalarType >( ) ).finished( );
+
+            linkEndTimes[ i ].resize( 2 );
+            linkEndTimes[ i ][ 0 ] = static_cast< double >( isTimeAtReception ? times[ i ] - lightTimes[ i ] : times[ i ] );
+            linkEndTimes[ i ][ 1 ] = static_cast< double >( isTimeAtReception ? times[ i ] : times[ i ] + lightTimes[ i ] );
+
+            linkEndStates[ i ].resize( 2 );
+            linkEndStates[ i ][ 0 ] = transmitterStates_[ i ].template cast< double >( );
+            linkEndStates[ i ][ 1 ] = receiverStates_[ i ].template cast< double >( );
+        }
+    }
+
     //! Function to get the object to calculate light time.
     /*!
      * Function to get the object to calculate light time.
@@ -157,6 +222,12 @@ private:
     //! Pre-declared transmitter state, to prevent many (de-)allocations
     StateType transmitterState;
 
+    //! Pre-declared list of receiver states, used when computing a list of observables
+    std::vector< StateType > receiverStates_;
+
+    //! Pre-declared list of transmitter states, used when computing a list of observables
+    std::vector< StateType > transmitterStates_;
+
 };
 
 } // namespace observation_models
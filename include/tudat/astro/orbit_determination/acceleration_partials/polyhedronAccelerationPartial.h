@@ -16,6 +16,7 @@
 #include "tudat/astro/orbit_determination/acceleration_partials/accelerationPartial.h"
 #include "tudat/astro/orbit_determination/observation_partials/rotationMatrixPartial.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/sphericalHarmonicPartialFunctions.h"
 
 #include "tudat/math/basic/coordinateConversions.h"
 
@@ -226,11 +227,13 @@ private:
     //!  Polyhedron cache for this acceleration
     std::shared_ptr< gravitation::PolyhedronGravityCache > polyhedronCache_;
 
-    //! Polyhedron facets dyads.
-    std::vector< Eigen::MatrixXd > facetDyads_;
+    //! Acceleration model for which partials are computed (used to retrieve the exterior spherical harmonic gravity
+    //! field, if any).
+    std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel > accelerationModel_;
 
-    //! Polyhedron edge dyads.
-    std::vector< Eigen::MatrixXd > edgeDyads_;
+    //! Spherical harmonics cache used to compute the partials of the exterior spherical harmonic gravity field (nullptr
+    //! if the acceleration model has no exterior gravity field).
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > exteriorSphericalHarmonicsCache_;
 
     //! Function returning position of body undergoing acceleration.
     std::function< Eigen::Vector3d( ) > positionFunctionOfAcceleratedBody_;
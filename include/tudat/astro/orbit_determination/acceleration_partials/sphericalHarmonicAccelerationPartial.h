@@ -33,7 +33,9 @@ namespace acceleration_partials
 //! Class for calculating partial derivatives of a spherical harmonic gravitational acceleration.
 /*!
  *  Class for calculating partial derivatives of a spherical harmonic gravitational acceleration, as calculated by the
- *  SphericalHarmonicsGravitationalAccelerationModel class.
+ *  SphericalHarmonicsGravitationalAccelerationModel class. If the acceleration model uses the Pines evaluation
+ *  algorithm (pines_spherical_harmonics_evaluation), the partials w.r.t. position and coefficients are computed using the
+ *  Pines formulation as well, which is free of singularities on the polar axis of the body exerting the acceleration.
  */
 class SphericalHarmonicsGravityPartial: public AccelerationPartial
 {
@@ -415,6 +417,14 @@ protected:
     //! calculations.
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicCache_;
 
+    //! Function returning the cache object for the Pines formulation of the acceleration model (nullptr if Pines
+    //! formulation is not used by acceleration model).
+    std::function< std::shared_ptr< gravitation::PinesSphericalHarmonicsCache >( ) > pinesCacheFunction_;
+
+    //! Cache object for Pines formulation of partials, shared with acceleration model and retrieved from it at each
+    //! update (nullptr if Pines formulation is not used by acceleration model).
+    std::shared_ptr< gravitation::PinesSphericalHarmonicsCache > pinesCache_;
+
     //! Function returning position of body undergoing acceleration.
     std::function< Eigen::Vector3d( ) > positionFunctionOfAcceleratedBody_;
 
@@ -435,6 +445,12 @@ protected:
      */
     std::function< void( const double ) > updateFunction_;
 
+    //! Function returning the degree to which the acceleration model evaluated the expansion at its last update.
+    std::function< int( ) > currentTruncationDegreeFunction_;
+
+    //! Function returning the order to which the acceleration model evaluated the expansion at its last update.
+    std::function< int( ) > currentTruncationOrderFunction_;
+
     //! Current cosine coefficients of the spherical harmonic gravity field.
     /*!
      *  Current cosine coefficients of the spherical harmonic gravity field, set by update( time ) function.
@@ -500,6 +516,17 @@ protected:
      */
     int maximumOrder_;
 
+    //! Degree to which the spherical harmonic expansion is evaluated at the current time.
+    /*!
+     *  Degree to which the spherical harmonic expansion is evaluated at the current time, which is lower than
+     *  maximumDegree_ if the acceleration model uses altitude-adaptive truncation. Partials w.r.t. coefficients of higher
+     *  degree are zero, and these coefficients are not used in the partials w.r.t. position.
+     */
+    int currentMaximumDegree_;
+
+    //! Order to which the spherical harmonic expansion is evaluated at the current time.
+    int currentMaximumOrder_;
+
     //! Map of RotationMatrixPartial, one for each relevant rotation parameter
     /*!
      *  Map of RotationMatrixPartial, one for each parameter representing a property of the rotation of the
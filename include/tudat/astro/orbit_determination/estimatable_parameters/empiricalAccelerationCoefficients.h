@@ -438,6 +438,16 @@ public:
         return empiricalAccelerationInterpolator_->getLookUpScheme( );
     }
 
+    //! Function to retrieve the times at which the arcs start
+    /*!
+     *  Function to retrieve the times at which the arcs start
+     *  \return Times at which the arcs start
+     */
+    std::vector< double > getArcStartTimes( )
+    {
+        return std::vector< double >( arcStartTimeList_.begin( ), arcStartTimeList_.end( ) - 1 );
+    }
+
 protected:
 
 private:
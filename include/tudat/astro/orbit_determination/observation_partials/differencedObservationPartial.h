@@ -178,6 +178,31 @@ public:
         return differencedPartials;
     }
 
+    //! Function to clear any partials stored by the arc start and end partial objects
+    void resetPartialCache( )
+    {
+        if( firstPartial_ != nullptr )
+        {
+            firstPartial_->resetPartialCache( );
+        }
+        if( secondPartial_ != nullptr )
+        {
+            secondPartial_->resetPartialCache( );
+        }
+    }
+
+    //! Function to retrieve the partial object for the arc start range observation
+    std::shared_ptr< ObservationPartial< ObservationSize > > getFirstPartial( )
+    {
+        return firstPartial_;
+    }
+
+    //! Function to retrieve the partial object for the arc end range observation
+    std::shared_ptr< ObservationPartial< ObservationSize > > getSecondPartial( )
+    {
+        return secondPartial_;
+    }
+
 protected:
 
     //! Partial object for arc start range observation
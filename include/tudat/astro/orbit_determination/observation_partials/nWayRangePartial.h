@@ -99,6 +99,59 @@ private:
 
 };
 
+//! Object storing the most recently computed n-way range partial, for reuse by (a set of) NWayRangePartial objects
+/*!
+ *  Object storing the most recently computed n-way range partial, with the input from which it was computed. When shared
+ *  between the partials of the start and end legs of an integrated observable (e.g. DSN averaged Doppler), the end leg
+ *  partial of one count interval is reused as the start leg partial of the next (back-to-back) count interval. The
+ *  input does not include the values of the estimated parameters and the environment, so the cache must be reset
+ *  (see ObservationPartial::resetPartialCache) whenever these may have changed; the observation manager does so before
+ *  evaluating each observation set.
+ */
+struct NWayRangePartialCache
+{
+    NWayRangePartialCache( ): isSet_( false ), numberOfReusedPartials_( 0 ){ }
+
+    //! Function to clear the cached partial
+    void reset( )
+    {
+        isSet_ = false;
+        ancillarySettings_ = nullptr;
+        partials_.clear( );
+    }
+
+    //! Function to check whether the cached partial was computed from the given input
+    bool isCachedInput( const std::vector< Eigen::Vector6d >& states,
+                        const std::vector< double >& times,
+                        const observation_models::LinkEndType linkEndOfFixedTime,
+                        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings )
+    {
+        return isSet_ && ( linkEndOfFixedTime == linkEndOfFixedTime_ ) && ( ancillarySettings == ancillarySettings_ ) &&
+                ( times == times_ ) && ( states == states_ );
+    }
+
+    //! Boolean denoting whether a partial has been stored
+    bool isSet_;
+
+    //! Link end states from which cached partial was computed
+    std::vector< Eigen::Vector6d > states_;
+
+    //! Link end times from which cached partial was computed
+    std::vector< double > times_;
+
+    //! Link end of fixed time with which cached partial was computed
+    observation_models::LinkEndType linkEndOfFixedTime_;
+
+    //! Ancillary settings with which cached partial was computed
+    std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings_;
+
+    //! Cached partials, with associated times
+    std::vector< std::pair< Eigen::Matrix< double, 1, Eigen::Dynamic >, double > > partials_;
+
+    //! Number of times the cached partial was reused
+    unsigned int numberOfReusedPartials_;
+};
+
 //! Class to compute the partial derivatives of an n-way range observation partial.
 class NWayRangePartial: public ObservationPartial< 1 >
 {
@@ -119,7 +172,7 @@ public:
                       const estimatable_parameters::EstimatebleParameterIdentifier parameterIdentifier,
                       const int numberOfLinkEnds ):
         ObservationPartial< 1 >( parameterIdentifier ), nWayRangeScaler_( nWayRangeScaler ), rangePartialList_( rangePartialList ),
-        numberOfLinkEnds_( numberOfLinkEnds ){ }
+        numberOfLinkEnds_( numberOfLinkEnds ), storePartialsInCache_( false ){ }
 
     //! Destructor
     ~NWayRangePartial( ) { }
@@ -142,6 +195,38 @@ public:
             const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings = nullptr,
             const Eigen::Vector1d& currentObservation = Eigen::Vector1d::Constant( TUDAT_NAN ) );
 
+    //! Function to set the object in which computed partials are stored, or from which they are reused
+    /*!
+     *  Function to set the object in which computed partials are stored, or from which they are reused. The cache is
+     *  shared between two NWayRangePartial objects w.r.t. the same parameter: the object for which storePartials is true
+     *  stores each partial it computes in the cache; the other object reuses (and removes) the stored partial if it is
+     *  requested for identical input (link end states, times, link end of fixed time and ancillary settings).
+     *  \param partialCache Object in which partials are cached (nullptr to disable caching)
+     *  \param storePartials Boolean denoting whether this object stores its partials in the cache (if true) or reuses
+     *  partials from the cache (if false)
+     */
+    void setPartialCache( const std::shared_ptr< NWayRangePartialCache > partialCache,
+                          const bool storePartials )
+    {
+        partialCache_ = partialCache;
+        storePartialsInCache_ = storePartials;
+    }
+
+    //! Function to clear the partial stored in the cache (if any)
+    void resetPartialCache( )
+    {
+        if( partialCache_ != nullptr )
+        {
+            partialCache_->reset( );
+        }
+    }
+
+    //! Function to retrieve the object in which the most recently computed partial is stored
+    std::shared_ptr< NWayRangePartialCache > getPartialCache( )
+    {
+        return partialCache_;
+    }
+
 protected:
 
     //! Scaling object used for mapping partials of one-way ranges to partials of observable
@@ -155,6 +240,12 @@ protected:
 
     //! Number of link ends in n-way observable
     int numberOfLinkEnds_;
+
+    //! Object in which the most recently computed partial is stored (nullptr if no caching is used)
+    std::shared_ptr< NWayRangePartialCache > partialCache_;
+
+    //! Boolean denoting whether computed partials are stored in (if true) or reused from (if false) partialCache_
+    bool storePartialsInCache_;
 };
 
 }
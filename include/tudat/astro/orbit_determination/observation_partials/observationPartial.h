@@ -180,6 +180,13 @@ public:
         return parameterIdentifier_;
     }
 
+    //! Function to clear any partials stored by the object for reuse in subsequent calls to calculatePartial
+    /*!
+     * Function to clear any partials stored by the object for reuse in subsequent calls to calculatePartial. Must be
+     * called whenever the estimated parameters or the environment may have changed (default: no partials are stored).
+     */
+    virtual void resetPartialCache( ){ }
+
 
 protected:
 
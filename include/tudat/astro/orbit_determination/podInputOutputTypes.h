@@ -46,7 +46,10 @@ public:
         reintegrateEquationsOnFirstIteration_( true ),
         reintegrateVariationalEquations_( true ),
         saveDesignMatrix_( true ),
-        printOutput_( true )
+        printOutput_( true ),
+        accumulateNormalEquations_( false ),
+        maximumObservationBlockSize_( 10000 ),
+        reduceArcWiseParameters_( false )
     {
         weightsMatrixDiagonals_ = Eigen::VectorXd::Zero( observationCollection->getTotalObservableSize( ) );
         setConstantWeightsMatrix( 1.0 );
@@ -501,6 +504,55 @@ public:
         this->limitConditionNumberForWarning_ = limitConditionNumberForWarning;
     }
 
+    //! Function to set whether the normal equations are to be accumulated per block of observations
+    /*!
+     * Function to set whether the normal equations are to be accumulated per block of observations, instead of being
+     * computed from the full design matrix. When accumulating the normal equations, the observation partials are computed
+     * for (at most) maximumObservationBlockSize observations at a time, and the memory required for the estimation is
+     * independent of the number of observations (unless the design matrix is to be saved, see defineCovarianceSettings).
+     * The normal equations are then solved using a Cholesky decomposition, instead of an SVD decomposition of the full
+     * design matrix. For a multi-arc estimation, the arc-wise parameters (arc initial states, and arc-wise empirical
+     * accelerations, drag/radiation pressure coefficients and observation biases with the same arcs) can be treated as local
+     * parameters of their arc. The normal equations are then stored in block-arrow form, and the local parameters are reduced
+     * per arc (Schur complement) when solving, so that the cost of the estimation is linear in the number of arcs. This is not
+     * supported for estimations with consider parameters or constraints.
+     * \param accumulateNormalEquations Boolean denoting whether the normal equations are to be accumulated per block of
+     * observations
+     * \param maximumObservationBlockSize Maximum number of observations (epochs) in a single block
+     * \param reduceArcWiseParameters Boolean denoting whether the arc-wise parameters are to be reduced per arc (only used
+     * if the normal equations are accumulated)
+     */
+    void setNormalEquationsAccumulation( const bool accumulateNormalEquations,
+                                         const int maximumObservationBlockSize = 10000,
+                                         const bool reduceArcWiseParameters = false )
+    {
+        if( maximumObservationBlockSize <= 0 )
+        {
+            throw std::runtime_error( "Error when setting normal equations accumulation, block size must be positive" );
+        }
+        accumulateNormalEquations_ = accumulateNormalEquations;
+        maximumObservationBlockSize_ = maximumObservationBlockSize;
+        reduceArcWiseParameters_ = reduceArcWiseParameters;
+    }
+
+    //! Function to return the boolean denoting whether the normal equations are to be accumulated per block of observations
+    bool getAccumulateNormalEquations( )
+    {
+        return accumulateNormalEquations_;
+    }
+
+    //! Function to return the maximum number of observations (epochs) in a single block, when accumulating normal equations
+    int getMaximumObservationBlockSize( )
+    {
+        return maximumObservationBlockSize_;
+    }
+
+    //! Function to return the boolean denoting whether the arc-wise parameters are reduced per arc, when accumulating normal equations
+    bool getReduceArcWiseParameters( )
+    {
+        return reduceArcWiseParameters_;
+    }
+
     bool areConsiderParametersIncluded( ) const
     {
         return considerParametersIncluded_;
@@ -537,6 +589,15 @@ protected:
 
     //! Boolean denoting whether consider parameters are included in the covariance analysis
     bool considerParametersIncluded_;
+
+    //! Boolean denoting whether the normal equations are to be accumulated per block of observations
+    bool accumulateNormalEquations_;
+
+    //! Maximum number of observations (epochs) in a single block, when accumulating normal equations
+    int maximumObservationBlockSize_;
+
+    //! Boolean denoting whether the arc-wise parameters are reduced per arc, when accumulating normal equations
+    bool reduceArcWiseParameters_;
 };
 
 
@@ -808,7 +869,7 @@ struct CovarianceAnalysisOutput
         exceptionDuringPropagation_( exceptionDuringPropagation )
     {
         considerParametersIncluded_ = false;
-        if ( designMatrixConsiderParameters.size( ) > 0 && considerNormalizationFactors.size( ) > 0 && considerCovarianceContribution.size( ) > 0 )
+        if ( considerNormalizationFactors.size( ) > 0 && considerCovarianceContribution.size( ) > 0 )
         {
             considerParametersIncluded_ = true;
         }
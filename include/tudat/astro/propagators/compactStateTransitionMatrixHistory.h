@@ -0,0 +1,214 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COMPACTSTATETRANSITIONMATRIXHISTORY_H
+#define TUDAT_COMPACTSTATETRANSITIONMATRIXHISTORY_H
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class storing a history of state transition and sensitivity matrices in contiguous memory, for interpolation
+/*!
+ *  Class storing a history of state transition and sensitivity matrices in contiguous memory, for interpolation. The
+ *  matrices at all epochs are stored (column-major) in a single buffer per matrix type, instead of as separate
+ *  dynamically allocated matrices, and the sensitivity matrices may optionally be stored in single precision.
+ *  Interpolation is performed with a Lagrange polynomial, using a fixed-size stencil of data points. Near the boundaries
+ *  of the data (and beyond them), the stencil is shifted so that it remains inside the data range, in place of the
+ *  cubic spline used by the LagrangeInterpolator. Evaluation writes the result directly into a preallocated
+ *  matrix, does not perform any heap allocation, and does not modify the object, so that a single object may be used
+ *  concurrently from multiple threads. This class is used for single-arc variational equations only (see
+ *  SingleArcVariationalEquationsSolver::setCompactMatrixHistorySettings); multi-arc and hybrid-arc matrix histories are
+ *  stored in Lagrange interpolators.
+ */
+class CompactStateTransitionMatrixHistory
+{
+public:
+
+    //! Maximum number of data points used for a single interpolation
+    static const int maximumNumberOfStages = 16;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param stateTransitionSolution History of state transition matrices (square)
+     *  \param sensitivitySolution History of sensitivity matrices, defined at the same epochs as the state transition
+     *  matrices (may have zero columns)
+     *  \param numberOfStages Number of data points used for a single interpolation (even number)
+     *  \param useSinglePrecisionSensitivity Boolean denoting whether to store the sensitivity matrices in single
+     *  precision
+     */
+    CompactStateTransitionMatrixHistory(
+            const std::map< double, Eigen::MatrixXd >& stateTransitionSolution,
+            const std::map< double, Eigen::MatrixXd >& sensitivitySolution,
+            const int numberOfStages = 4,
+            const bool useSinglePrecisionSensitivity = false );
+
+    //! Function to interpolate the state transition and sensitivity matrices at a given time
+    /*!
+     *  Function to interpolate the state transition and sensitivity matrices at a given time, writing the results into
+     *  existing matrices (or matrix blocks) of the correct size.
+     *  \param evaluationTime Time at which the matrices are to be interpolated
+     *  \param stateTransitionMatrix Interpolated state transition matrix (returned by reference)
+     *  \param sensitivityMatrix Interpolated sensitivity matrix (returned by reference)
+     */
+    void interpolate( const double evaluationTime,
+                      Eigen::Ref< Eigen::MatrixXd > stateTransitionMatrix,
+                      Eigen::Ref< Eigen::MatrixXd > sensitivityMatrix ) const
+    {
+        int firstStencilIndex;
+        double lagrangeWeights[ maximumNumberOfStages ];
+        computeLagrangeWeights( evaluationTime, findNearestLowerIndex( evaluationTime ), firstStencilIndex, lagrangeWeights );
+        interpolateWithWeights( firstStencilIndex, lagrangeWeights, stateTransitionMatrix, sensitivityMatrix );
+    }
+
+    //! Function to interpolate the concatenated state transition and sensitivity matrix at a given time
+    /*!
+     *  Function to interpolate the concatenated state transition and sensitivity matrix at a given time, writing the
+     *  result into an existing matrix (or matrix block) of the correct size.
+     *  \param evaluationTime Time at which the matrices are to be interpolated
+     *  \param combinedMatrix Interpolated concatenated state transition and sensitivity matrix (returned by reference)
+     */
+    void interpolateCombinedMatrix( const double evaluationTime,
+                                    Eigen::Ref< Eigen::MatrixXd > combinedMatrix ) const
+    {
+        interpolate( evaluationTime,
+                     combinedMatrix.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ),
+                     combinedMatrix.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) );
+    }
+
+    //! Function to interpolate the concatenated state transition and sensitivity matrix at a list of times
+    /*!
+     *  Function to interpolate the concatenated state transition and sensitivity matrix at a list of times. The search
+     *  for the data interval of each time starts from that of the preceding time, so that evaluation is most efficient
+     *  for sorted times. Matrices in the output list are only resized (and allocated) if they do not have the correct
+     *  size.
+     *  \param evaluationTimes Times at which the matrices are to be interpolated
+     *  \param combinedMatrices List of interpolated concatenated state transition and sensitivity matrices, one per
+     *  evaluation time (returned by reference)
+     */
+    void interpolateCombinedMatrices( const std::vector< double >& evaluationTimes,
+                                      std::vector< Eigen::MatrixXd >& combinedMatrices ) const;
+
+    //! Function to retrieve the epochs at which the matrices are stored
+    const std::vector< double >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the number of rows (and columns) of the state transition matrix
+    int getStateTransitionMatrixSize( ) const
+    {
+        return stateTransitionMatrixSize_;
+    }
+
+    //! Function to retrieve the number of columns of the sensitivity matrix
+    int getSensitivityMatrixSize( ) const
+    {
+        return sensitivityMatrixSize_;
+    }
+
+    //! Function to retrieve the number of data points used for a single interpolation
+    int getNumberOfStages( ) const
+    {
+        return numberOfStages_;
+    }
+
+    //! Function to retrieve whether the sensitivity matrices are stored in single precision
+    bool getUseSinglePrecisionSensitivity( ) const
+    {
+        return useSinglePrecisionSensitivity_;
+    }
+
+    //! Function to retrieve the total size (in bytes) of the stored matrix data
+    std::size_t getMatrixDataSize( ) const
+    {
+        return sizeof( double ) * ( stateTransitionData_.size( ) + sensitivityData_.size( ) ) +
+                sizeof( float ) * singlePrecisionSensitivityData_.size( );
+    }
+
+private:
+
+    //! Function to find the index of the last epoch before (or at) the given time, clipped to the data intervals
+    /*!
+     *  Function to find the index of the last epoch before (or at) the given time, clipped to the data intervals
+     *  \param evaluationTime Time for which the index is to be found
+     *  \param initialGuess Index from which the search is to be started (-1 to use a bisection over the full data)
+     *  \return Index of the last epoch before (or at) the given time.
+     */
+    int findNearestLowerIndex( const double evaluationTime, const int initialGuess = -1 ) const;
+
+    //! Function to compute the Lagrange polynomial weights for the data points in the interpolation stencil
+    /*!
+     *  Function to compute the Lagrange polynomial weights for the data points in the interpolation stencil
+     *  \param evaluationTime Time at which the matrices are to be interpolated
+     *  \param nearestLowerIndex Index of the last epoch before (or at) the evaluation time
+     *  \param firstStencilIndex Index of the first data point in the interpolation stencil (returned by reference)
+     *  \param lagrangeWeights Weights of the data points in the interpolation stencil (returned by reference)
+     */
+    void computeLagrangeWeights( const double evaluationTime,
+                                 const int nearestLowerIndex,
+                                 int& firstStencilIndex,
+                                 double* lagrangeWeights ) const;
+
+    //! Function to compute the weighted sum of the matrices in the interpolation stencil
+    /*!
+     *  Function to compute the weighted sum of the matrices in the interpolation stencil
+     *  \param firstStencilIndex Index of the first data point in the interpolation stencil
+     *  \param lagrangeWeights Weights of the data points in the interpolation stencil
+     *  \param stateTransitionMatrix Interpolated state transition matrix (returned by reference)
+     *  \param sensitivityMatrix Interpolated sensitivity matrix (returned by reference)
+     */
+    void interpolateWithWeights( const int firstStencilIndex,
+                                 const double* lagrangeWeights,
+                                 Eigen::Ref< Eigen::MatrixXd > stateTransitionMatrix,
+                                 Eigen::Ref< Eigen::MatrixXd > sensitivityMatrix ) const;
+
+    //! Epochs at which the matrices are stored
+    std::vector< double > times_;
+
+    //! Inverse denominators of the Lagrange polynomials for each stencil (numberOfStages_ entries per first stencil index)
+    std::vector< double > inverseLagrangeDenominators_;
+
+    //! Number of rows (and columns) of the state transition matrix
+    int stateTransitionMatrixSize_;
+
+    //! Number of columns of the sensitivity matrix
+    int sensitivityMatrixSize_;
+
+    //! Number of data points used for a single interpolation
+    int numberOfStages_;
+
+    //! Boolean denoting whether the sensitivity matrices are stored in single precision
+    bool useSinglePrecisionSensitivity_;
+
+    //! State transition matrices at all epochs, stored consecutively in column-major order
+    std::vector< double > stateTransitionData_;
+
+    //! Sensitivity matrices at all epochs, stored consecutively in column-major order (if double precision is used)
+    std::vector< double > sensitivityData_;
+
+    //! Sensitivity matrices at all epochs, stored consecutively in column-major order (if single precision is used)
+    std::vector< float > singlePrecisionSensitivityData_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_COMPACTSTATETRANSITIONMATRIXHISTORY_H
@@ -27,6 +27,7 @@
 #include "tudat/math/integrators/numericalIntegrator.h"
 #include "tudat/astro/basic_astro/timeConversions.h"
 #include "tudat/basics/timeType.h"
+#include "tudat/astro/propagators/propagationHistory.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
 #include "tudat/math/integrators/createNumericalIntegrator.h"
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
@@ -57,17 +58,29 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
         integrator,
         const std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition )
 {
-    // Perform integration step
-    integrator->performIntegrationStep( timeStep );
+    TimeStepType dependentVariableError;
+    if( integrator->isDenseOutputAvailable( ) )
+    {
+        // Interpolate state from the dense output of the last step, and retrieve value of dependent variable
+        const TimeType currentTime = integrator->getCurrentIndependentVariable( ) + timeStep;
+        integrator->getStateDerivativeFunction( )( currentTime, integrator->getDenseOutputState( currentTime ) );
+        dependentVariableError =
+                static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+    }
+    else
+    {
+        // Perform integration step
+        integrator->performIntegrationStep( timeStep );
 
-    // Retrieve value of dependent variable after time step
-    integrator->getStateDerivativeFunction( )(
-                integrator->getCurrentIndependentVariable( ), integrator->getCurrentState( ) );
-    TimeStepType dependentVariableError =
-            static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+        // Retrieve value of dependent variable after time step
+        integrator->getStateDerivativeFunction( )(
+                    integrator->getCurrentIndependentVariable( ), integrator->getCurrentState( ) );
+        dependentVariableError =
+                static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
 
-    // Undo step
-    integrator->rollbackToPreviousState( );
+        // Undo step
+        integrator->rollbackToPreviousState( );
+    }
 
     return dependentVariableError;
 }
@@ -136,8 +149,18 @@ void getFinalStateForExactDependentVariableTerminationCondition(
                     std::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >(
                         dependentVariableErrorFunction ), ( lastTime - secondToLastTime ) / 2.0 );
 
-        endState = integrator->performIntegrationStep( finalTimeStep );
-        endTime = integrator->getCurrentIndependentVariable( );
+        // Only use the interpolated final state if it is as accurate as the integrated one
+        if( integrator->isDenseOutputAvailable( ) && integrator->isDenseOutputOfIntegratorOrder( ) )
+        {
+            endTime = integrator->getCurrentIndependentVariable( ) + finalTimeStep;
+            endState = integrator->getDenseOutputState( endTime );
+            integrator->modifyCurrentIntegrationVariables( endState, endTime, true );
+        }
+        else
+        {
+            endState = integrator->performIntegrationStep( finalTimeStep );
+            endTime = integrator->getCurrentIndependentVariable( );
+        }
     }
     // If dependent variable has no root in given interval, set end time and state at NaN
     catch( std::runtime_error& caughtException )
@@ -304,8 +327,18 @@ bool getFinalStateForExactTerminationCondition(
         TimeStepType finalTimeStep = timeTerminationCondition->getStopTime( ) - secondToLastTime;
 
         integrator->rollbackToPreviousState( );
-        endState = integrator->performIntegrationStep( finalTimeStep );
-        endTime = integrator->getCurrentIndependentVariable( );
+        if( integrator->isDenseOutputAvailable( ) && integrator->isDenseOutputOfIntegratorOrder( ) )
+        {
+            // Interpolate final state from the last step, if it is as accurate as the integrated one
+            endTime = secondToLastTime + finalTimeStep;
+            endState = integrator->getDenseOutputState( endTime );
+            integrator->modifyCurrentIntegrationVariables( endState, endTime, true );
+        }
+        else
+        {
+            endState = integrator->performIntegrationStep( finalTimeStep );
+            endTime = integrator->getCurrentIndependentVariable( );
+        }
 
         break;
     }
@@ -364,10 +397,8 @@ bool getFinalStateForExactTerminationCondition(
  * \param timeStep Last time step taken by integrator.
  * \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  * derivative model).
- * \param solutionHistory History of state variables that are to be saved given as map
- * (time as key; returned by reference)
- * \param dependentVariableHistory History of dependent variables that are to be saved given as map
- * (time as key; returned by reference)
+ * \param solutionHistory History of state variables that are to be saved (returned by reference)
+ * \param dependentVariableHistory History of dependent variables that are to be saved (returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -376,10 +407,12 @@ void propagateToExactTerminationCondition(
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const TimeStepType timeStep,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        PropagationHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        PropagationHistory< TimeType, double >& dependentVariableHistory,
         const double currentCpuTime )
 {
+    TUDAT_UNUSED_PARAMETER( timeStep );
+
     // Turn off step size control
     integrator->setStepSizeControl( false );
 
@@ -399,37 +432,23 @@ void propagateToExactTerminationCondition(
         bool recomputeDependentVariables = false;
         if( dependentVariableHistory.size( ) > 0 )
         {
-            if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+            if( dependentVariableHistory.getLastTime( ) == solutionHistory.getLastTime( ) )
             {
-                if( timeStep > 0 )
-                {
-                    dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-                }
-                else
-                {
-                    dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-                }
+                dependentVariableHistory.removeLastEntry( );
                 recomputeDependentVariables = true;
             }
         }
 
-        // Remove state entry last added, and enter converged final state
-        if( timeStep > 0 )
-        {
-            solutionHistory.erase( std::prev( solutionHistory.end() ) );
-            solutionHistory[ endTime ] = endState;
-        }
-        else
-        {
-            solutionHistory.erase( solutionHistory.begin( ) );
-            solutionHistory[ endTime ] = endState;
-        }
+        // Remove state entry last added (last in time for forward propagation, first in time for backward
+        // propagation), and enter converged final state
+        solutionHistory.removeLastEntry( );
+        solutionHistory.append( endTime, endState );
 
         // Recompute final dependent variables, if required
         if( recomputeDependentVariables )
         {
             integrator->getStateDerivativeFunction( )( endTime, endState );
-            dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+            dependentVariableHistory.append( endTime, dependentVariableFunction( ) );
 
             // Check stopping conditions to be able to save details
             propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
@@ -468,9 +487,9 @@ void integrateEquationsFromIntegrator(
     int saveFrequency = 1;
 
     // Define structures that will contain with numerical results
-    std::map< TimeType, StateType > solutionHistory;
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
-    std::map< TimeType, double > cumulativeComputationTimeHistory;
+    PropagationHistory< TimeType, typename StateType::Scalar > solutionHistory;
+    PropagationHistory< TimeType, double > dependentVariableHistory;
+    PropagationHistory< TimeType, double > cumulativeComputationTimeHistory;
     std::shared_ptr< PropagationTerminationDetails > terminationDetails;
 
     // Initialize timer.
@@ -486,20 +505,20 @@ void integrateEquationsFromIntegrator(
 
     // Add results at initial state
     solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
+    solutionHistory.append( currentTime, newState );
     dependentVariableHistory.clear( );
     if( !( dependentVariableFunction == nullptr ) )
     {
         // If dependent variables are to be used, updated state derivative model and compute
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        dependentVariableHistory.append( currentTime, dependentVariableFunction( ) );
     }
 
     // Add CPU time after first saving step
     cumulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-    cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+    cumulativeComputationTimeHistory.append( currentTime, currentCPUTime );
 
     // Set initial time step
     TimeStepType timeStep = integrator->getNextStepSize( );
@@ -589,12 +608,12 @@ void integrateEquationsFromIntegrator(
                 if( processingSettings->saveCurrentStep( stepsSinceLastSave, std::fabs(
                         static_cast< double >( currentTime ) - timeOfLastSave ) ) )
                 {
-                    solutionHistory[ currentTime ] = newState;
+                    solutionHistory.append( currentTime, newState );
 
                     if( !( dependentVariableFunction == nullptr ) )
                     {
                         integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        dependentVariableHistory.append( currentTime, dependentVariableFunction( ) );
                     }
                     timeOfLastSave = currentTime;
                     stepsSinceLastSave = 0;
@@ -616,7 +635,7 @@ void integrateEquationsFromIntegrator(
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-            cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            cumulativeComputationTimeHistory.append( currentTime, currentCPUTime );
 
             if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
             {
@@ -682,7 +701,13 @@ void integrateEquationsFromIntegrator(
     }
 
 
-    simulationResults->reset( solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+    // Release storage reserved for entries that were not used
+    solutionHistory.shrinkToFit( );
+    dependentVariableHistory.shrinkToFit( );
+    cumulativeComputationTimeHistory.shrinkToFit( );
+
+    simulationResults->reset( std::move( solutionHistory ), std::move( dependentVariableHistory ),
+                              std::move( cumulativeComputationTimeHistory ),
                               std::map<TimeType, unsigned int>( ), propagationTerminationReason );
 }
 
@@ -0,0 +1,288 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONHISTORY_H
+#define TUDAT_PROPAGATIONHISTORY_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Contiguous (columnar) storage of a history of vector- or matrix-valued quantities, such as a propagation result.
+/*!
+ *  Contiguous (columnar) storage of a history of vector- or matrix-valued quantities, such as a propagation result. All
+ *  epochs are stored in a single array, and all values in a single row-major matrix (one row per epoch), so that
+ *  appending an entry requires no memory allocation (other than when the storage grows) and the full history can be
+ *  accessed without copying. This replaces the node-based std::map< TimeType, Eigen::Matrix > storage, which requires
+ *  a separate allocation for each map node and each value. Matrix-valued entries are stored per row in column-major
+ *  order. The storage grows in chunks, with the chunk size doubling up to the size of the current history.
+ *
+ *  Entries are stored in the order in which they are appended (i.e. in order of decreasing time for a backwards
+ *  propagation). The createMap functions provide the history as a (time-ordered) map, for compatibility with the
+ *  map-based interfaces.
+ */
+template< typename TimeType = double, typename ScalarType = double >
+class PropagationHistory
+{
+public:
+
+    //! Typedef for the (row-major) matrix containing all values of the history.
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > ValueMatrix;
+
+    //! Typedef for the type of a single (matrix) entry of the history.
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > EntryType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param entryRows Number of rows of each entry (0 to set from the first appended entry)
+     *  \param entryColumns Number of columns of each entry (0 to set from the first appended entry)
+     *  \param minimumChunkSize Minimum number of entries by which the storage is grown when full
+     */
+    PropagationHistory( const int entryRows = 0,
+                        const int entryColumns = 0,
+                        const unsigned int minimumChunkSize = 256 ):
+        entryRows_( entryRows ), entryColumns_( entryColumns ), minimumChunkSize_( std::max( minimumChunkSize, 1U ) )
+    { }
+
+    //! Function to add an entry to the end of the history
+    /*!
+     *  Function to add an entry to the end of the history. If the time of the entry is equal to that of the last entry,
+     *  the last entry is overwritten (consistent with assigning to a std::map).
+     *  \param time Time of the entry
+     *  \param value Value of the entry, with the same size as all other entries
+     */
+    template< typename Derived >
+    void append( const TimeType time, const Eigen::MatrixBase< Derived >& value )
+    {
+        if( entryRows_ == 0 && entryColumns_ == 0 )
+        {
+            entryRows_ = value.rows( );
+            entryColumns_ = value.cols( );
+        }
+        else if( value.rows( ) != entryRows_ || value.cols( ) != entryColumns_ )
+        {
+            throw std::runtime_error( "Error when adding entry to propagation history, entry size is (" +
+                                      std::to_string( value.rows( ) ) + ", " + std::to_string( value.cols( ) ) +
+                                      "), but history has entries of size (" + std::to_string( entryRows_ ) + ", " +
+                                      std::to_string( entryColumns_ ) + ")" );
+        }
+
+        if( times_.size( ) == 0 || !( times_.back( ) == time ) )
+        {
+            if( times_.size( ) == times_.capacity( ) )
+            {
+                reserve( times_.size( ) + std::max( static_cast< unsigned int >( times_.size( ) ), minimumChunkSize_ ) );
+            }
+            times_.push_back( time );
+            values_.resize( values_.size( ) + getEntrySize( ) );
+        }
+        Eigen::Map< EntryType >( values_.data( ) + ( times_.size( ) - 1 ) * getEntrySize( ),
+                                 entryRows_, entryColumns_ ) = value;
+    }
+
+    //! Function to add a scalar entry to the end of the history (for histories with entries of size 1x1)
+    /*!
+     *  Function to add a scalar entry to the end of the history (for histories with entries of size 1x1). If the time of
+     *  the entry is equal to that of the last entry, the last entry is overwritten.
+     *  \param time Time of the entry
+     *  \param value Value of the entry
+     */
+    void append( const TimeType time, const ScalarType value )
+    {
+        append( time, Eigen::Matrix< ScalarType, 1, 1 >::Constant( value ) );
+    }
+
+    //! Function to remove the last entry of the history.
+    void removeLastEntry( )
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when removing last entry of propagation history, history is empty" );
+        }
+        times_.pop_back( );
+        values_.resize( values_.size( ) - getEntrySize( ) );
+    }
+
+    //! Function to reserve storage for a given number of entries.
+    /*!
+     *  Function to reserve storage for a given number of entries, to prevent the storage from being grown (and copied)
+     *  when appending entries, if the number of entries is known in advance.
+     *  \param numberOfEntries Number of entries for which to reserve storage
+     */
+    void reserve( const unsigned int numberOfEntries )
+    {
+        times_.reserve( numberOfEntries );
+        values_.reserve( numberOfEntries * getEntrySize( ) );
+    }
+
+    //! Function to release the storage that is reserved, but not used.
+    void shrinkToFit( )
+    {
+        times_.shrink_to_fit( );
+        values_.shrink_to_fit( );
+    }
+
+    //! Function to remove all entries from the history (the entry size is retained).
+    void clear( )
+    {
+        times_.clear( );
+        values_.clear( );
+    }
+
+    //! Function to retrieve the number of entries in the history.
+    unsigned int size( ) const
+    {
+        return times_.size( );
+    }
+
+    //! Function to check whether the history is empty.
+    bool empty( ) const
+    {
+        return times_.size( ) == 0;
+    }
+
+    //! Function to retrieve the number of rows of each entry.
+    int getEntryRows( ) const
+    {
+        return entryRows_;
+    }
+
+    //! Function to retrieve the number of columns of each entry.
+    int getEntryColumns( ) const
+    {
+        return entryColumns_;
+    }
+
+    //! Function to retrieve the number of scalars in each entry.
+    int getEntrySize( ) const
+    {
+        return entryRows_ * entryColumns_;
+    }
+
+    //! Function to retrieve the times of all entries, in the order in which they were appended.
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the time of a single entry.
+    TimeType getTime( const unsigned int index ) const
+    {
+        return times_.at( index );
+    }
+
+    //! Function to retrieve the time of the last entry.
+    TimeType getLastTime( ) const
+    {
+        return times_.back( );
+    }
+
+    //! Function to retrieve (without copying) the values of all entries, with one (flattened) entry per row.
+    Eigen::Map< const ValueMatrix > getValues( ) const
+    {
+        return Eigen::Map< const ValueMatrix >( values_.data( ), times_.size( ), getEntrySize( ) );
+    }
+
+    //! Function to retrieve (without copying) the value of a single entry.
+    Eigen::Map< const EntryType > getValue( const unsigned int index ) const
+    {
+        if( index >= times_.size( ) )
+        {
+            throw std::runtime_error( "Error when retrieving entry " + std::to_string( index ) +
+                                      " of propagation history, history has " + std::to_string( times_.size( ) ) +
+                                      " entries" );
+        }
+        return Eigen::Map< const EntryType >( values_.data( ) + index * getEntrySize( ), entryRows_, entryColumns_ );
+    }
+
+    //! Function to retrieve (without copying) the value of the last entry.
+    Eigen::Map< const EntryType > getLastValue( ) const
+    {
+        return getValue( times_.size( ) - 1 );
+    }
+
+    //! Function to create a (time-ordered) map from the history, for compatibility with map-based interfaces.
+    /*!
+     *  Function to create a (time-ordered) map from the history, for compatibility with map-based interfaces.
+     *  \return Map with the entries of the history, with the time as key.
+     */
+    template< typename MapValueType = Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > >
+    std::map< TimeType, MapValueType > createMap( ) const
+    {
+        std::map< TimeType, MapValueType > historyMap;
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            historyMap.emplace_hint( historyMap.end( ), times_[ i ], getValue( i ) );
+        }
+        return historyMap;
+    }
+
+    //! Function to create a (time-ordered) map of scalars from the history (for histories with entries of size 1x1).
+    std::map< TimeType, ScalarType > createScalarMap( ) const
+    {
+        if( times_.size( ) > 0 && getEntrySize( ) != 1 )
+        {
+            throw std::runtime_error( "Error when creating scalar map from propagation history, entries are not scalars" );
+        }
+
+        std::map< TimeType, ScalarType > historyMap;
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            historyMap.emplace_hint( historyMap.end( ), times_[ i ], values_[ i ] );
+        }
+        return historyMap;
+    }
+
+    //! Function to append all entries of a map to the history, in order of increasing time.
+    template< typename MapValueType >
+    void appendMap( const std::map< TimeType, MapValueType >& historyMap )
+    {
+        reserve( times_.size( ) + historyMap.size( ) );
+        for( auto mapIterator: historyMap )
+        {
+            append( mapIterator.first, mapIterator.second );
+        }
+    }
+
+private:
+
+    //! Number of rows of each entry.
+    int entryRows_;
+
+    //! Number of columns of each entry.
+    int entryColumns_;
+
+    //! Minimum number of entries by which the storage is grown when full.
+    unsigned int minimumChunkSize_;
+
+    //! Times of all entries, in the order in which they were appended.
+    std::vector< TimeType > times_;
+
+    //! Values of all entries (one entry after the other, each in column-major order).
+    std::vector< ScalarType > values_;
+
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONHISTORY_H
@@ -19,6 +19,8 @@
 #include <Eigen/Core>
 
 #include "tudat/math/interpolators/oneDimensionalInterpolator.h"
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
+#include "tudat/astro/propagators/compactStateTransitionMatrixHistory.h"
 #include "tudat/astro/orbit_determination/estimatable_parameters/estimatableParameter.h"
 #include "tudat/astro/orbit_determination/estimatable_parameters/initialTranslationalState.h"
 #include "tudat/astro/orbit_determination/estimatable_parameters/estimatableParameterSet.h"
@@ -79,6 +81,70 @@ public:
                                                                                 const bool addCentralBodyDependency = true,
                                                                                 const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) ) = 0;
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, returned by reference.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, returned by reference.
+     *  Derived classes for which the matrix can be computed without temporary allocations override this function, so that
+     *  the memory of combinedMatrix is reused when it already has the correct size.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedMatrix Concatenated state transition and sensitivity matrices (returned by reference)
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the central body states is to be added
+     *  \param arcDefiningBodies List of bodies used to define the current arc (multi-arc only)
+     */
+    virtual void getCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime,
+            Eigen::MatrixXd& combinedMatrix,
+            const bool addCentralBodyDependency = true,
+            const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) )
+    {
+        combinedMatrix = getCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, addCentralBodyDependency, arcDefiningBodies );
+    }
+
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, which includes
+    //! zero values for parameters not active in current arc, returned by reference.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, which includes
+     *  zero values for parameters not active in current arc, returned by reference. Derived classes for which the matrix
+     *  can be computed without temporary allocations override this function.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedMatrix Concatenated state transition and sensitivity matrices, including inactive parameters at
+     *  evaluationTime (returned by reference)
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the central body states is to be added
+     *  \param arcDefiningBodies List of bodies used to define the current arc (multi-arc only)
+     */
+    virtual void getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime,
+            Eigen::MatrixXd& combinedMatrix,
+            const bool addCentralBodyDependency = true,
+            const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) )
+    {
+        combinedMatrix = getFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, addCentralBodyDependency, arcDefiningBodies );
+    }
+
+    //! Function to get the full concatenated state transition and sensitivity matrices at a list of times.
+    /*!
+     *  Function to get the full concatenated state transition and sensitivity matrices at a list of times, using the
+     *  by-reference getFullCombinedStateTransitionAndSensitivityMatrix function for each time.
+     *  \param evaluationTimes Times at which to evaluate the matrices (preferably sorted)
+     *  \param combinedMatrices Concatenated state transition and sensitivity matrices, one per evaluation time
+     *  (returned by reference)
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the central body states is to be added
+     */
+    virtual void getFullCombinedStateTransitionAndSensitivityMatrices(
+            const std::vector< double >& evaluationTimes,
+            std::vector< Eigen::MatrixXd >& combinedMatrices,
+            const bool addCentralBodyDependency = true )
+    {
+        combinedMatrices.resize( evaluationTimes.size( ) );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            getFullCombinedStateTransitionAndSensitivityMatrix(
+                        evaluationTimes.at( i ), combinedMatrices.at( i ), addCentralBodyDependency );
+        }
+    }
+
     //! Function to get the size of state transition matrix
     /*!
      * Function to get the size of state transition matrix
@@ -106,6 +172,15 @@ public:
      */
     virtual int getFullParameterVectorSize( ) = 0;
 
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with copies of the matrix interpolators and look-up schemes, so that it can
+     * be used concurrently with the original (e.g. for computing observation partials on multiple threads). The copy is not
+     * updated when the interpolators of the original are reset.
+     * \return Copy of this object that can be used independently of the original
+     */
+    virtual std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > createIndependentCopy( ) = 0;
+
 protected:
 
     //! Size of state transition matrix
@@ -155,6 +230,26 @@ public:
         }
     }
 
+    //! Constructor from compact matrix history
+    /*!
+     * Constructor from compact matrix history, which is used in place of the matrix interpolators
+     * \param compactMatrixHistory Object storing and interpolating the state transition and sensitivity matrices.
+     * \param numberOfInitialDynamicalParameters Size of the estimated initial state vector (and size of square
+     * state transition matrix.
+     * \param numberOfParameters Total number of estimated parameters (initial states and other parameters).
+     * \param statePartialAdditionIndices Vector of pair providing indices of column blocks of variational equations to add to other column blocks
+     */
+    SingleArcCombinedStateTransitionAndSensitivityMatrixInterface(
+            const std::shared_ptr< CompactStateTransitionMatrixHistory > compactMatrixHistory,
+            const int numberOfInitialDynamicalParameters,
+            const int numberOfParameters,
+            const std::vector< std::pair< int, int > >& statePartialAdditionIndices ):
+        SingleArcCombinedStateTransitionAndSensitivityMatrixInterface(
+            nullptr, nullptr, numberOfInitialDynamicalParameters, numberOfParameters, statePartialAdditionIndices )
+    {
+        compactMatrixHistory_ = compactMatrixHistory;
+    }
+
     //! Destructor.
     ~SingleArcCombinedStateTransitionAndSensitivityMatrixInterface( ){ }
 
@@ -172,6 +267,27 @@ public:
             sensitivityMatrixInterpolator,
             const std::vector< std::pair< int, int > >& statePartialAdditionIndices );
 
+    //! Function to reset the compact state transition and sensitivity matrix history
+    /*!
+     * Function to reset the compact state transition and sensitivity matrix history, which is used in place of the
+     * matrix interpolators (which are reset to nullptr)
+     * \param compactMatrixHistory New object storing and interpolating the state transition and sensitivity matrices.
+     * \param statePartialAdditionIndices Vector of pair providing indices of column blocks of variational equations to add to other column blocks
+     */
+    void updateCompactMatrixHistory(
+            const std::shared_ptr< CompactStateTransitionMatrixHistory > compactMatrixHistory,
+            const std::vector< std::pair< int, int > >& statePartialAdditionIndices )
+    {
+        updateMatrixInterpolators( nullptr, nullptr, statePartialAdditionIndices );
+        compactMatrixHistory_ = compactMatrixHistory;
+    }
+
+    //! Function to get the compact state transition and sensitivity matrix history (nullptr if interpolators are used)
+    std::shared_ptr< CompactStateTransitionMatrixHistory > getCompactMatrixHistory( )
+    {
+        return compactMatrixHistory_;
+    }
+
     //! Function to get the interpolator returning the state transition matrix as a function of time.
     /*!
      * Function to get the interpolator returning the state transition matrix as a function of time.
@@ -205,6 +321,37 @@ public:
             const bool addCentralBodyDependency = true,
             const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) );
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, returned by reference.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, returned by reference.
+     *  The matrix is only resized if it does not have the correct size. If a compact matrix history is used, no other
+     *  memory is allocated.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedMatrix Concatenated state transition and sensitivity matrices (returned by reference)
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the central body states is to be added
+     *  \param arcDefiningBodies List of bodies used to define the current arc (unused for single-arc)
+     */
+    void getCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime,
+            Eigen::MatrixXd& combinedMatrix,
+            const bool addCentralBodyDependency = true,
+            const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) );
+
+    //! Function to get the concatenated state transition and sensitivity matrices at a list of times.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrices at a list of times. Matrices in the
+     *  output list are only resized if they do not have the correct size. If a compact matrix history is used, no other
+     *  memory is allocated, and the search for the data interval of each time starts from that of the preceding time.
+     *  \param evaluationTimes Times at which to evaluate the matrices (preferably sorted)
+     *  \param combinedMatrices Concatenated state transition and sensitivity matrices, one per evaluation time
+     *  (returned by reference)
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the central body states is to be added
+     */
+    void getFullCombinedStateTransitionAndSensitivityMatrices(
+            const std::vector< double >& evaluationTimes,
+            std::vector< Eigen::MatrixXd >& combinedMatrices,
+            const bool addCentralBodyDependency = true );
+
     //! Function to get the concatenated state transition and sensitivity matrix at a given time.
     /*!
      *  Function to get the concatenated state transition and sensitivity matrix at a given time
@@ -219,6 +366,25 @@ public:
         return getCombinedStateTransitionAndSensitivityMatrix( evaluationTime, addCentralBodyDependency, arcDefiningBodies );
     }
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, returned by reference.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, returned by reference
+     *  (functionality equal to getCombinedStateTransitionAndSensitivityMatrix for single-arc case).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedMatrix Concatenated state transition and sensitivity matrices (returned by reference)
+     *  \param addCentralBodyDependency Boolean denoting whether the dependency on the central body states is to be added
+     *  \param arcDefiningBodies List of bodies used to define the current arc (unused for single-arc)
+     */
+    void getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime,
+            Eigen::MatrixXd& combinedMatrix,
+            const bool addCentralBodyDependency = true,
+            const std::vector< std::string >& arcDefiningBodies = std::vector< std::string >( ) )
+    {
+        getCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, combinedMatrix, addCentralBodyDependency, arcDefiningBodies );
+    }
+
     //! Function to get the size of the total parameter vector.
     /*!
      * Function to get the size of the total parameter vector. For single-arc, this is simply the combination of
@@ -235,8 +401,29 @@ public:
         return statePartialAdditionIndices_;
     }
 
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with copies of the matrix interpolators, so that it can be used
+     * concurrently with the original. The compact matrix history (if any) is not modified during evaluation, and is
+     * shared with the copy.
+     * \return Copy of this object that can be used independently of the original
+     */
+    std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > createIndependentCopy( )
+    {
+        std::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > interfaceCopy =
+                std::make_shared< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >( *this );
+        interfaceCopy->stateTransitionMatrixInterpolator_ =
+                interpolators::createIndependentLagrangeInterpolatorCopy( stateTransitionMatrixInterpolator_ );
+        interfaceCopy->sensitivityMatrixInterpolator_ =
+                interpolators::createIndependentLagrangeInterpolatorCopy( sensitivityMatrixInterpolator_ );
+        return interfaceCopy;
+    }
+
 private:
 
+    //! Function to add the dependency on the central body states to a concatenated state transition and sensitivity matrix.
+    void addCentralBodyDependencyToCombinedMatrix( Eigen::MatrixXd& combinedMatrix );
+
     //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
     Eigen::MatrixXd combinedStateTransitionMatrix_;
 
@@ -248,6 +435,9 @@ private:
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     sensitivityMatrixInterpolator_;
 
+    //! Object storing and interpolating the state transition and sensitivity matrices, used in place of the interpolators if set.
+    std::shared_ptr< CompactStateTransitionMatrixHistory > compactMatrixHistory_;
+
     std::vector< std::pair< int, int > > statePartialAdditionIndices_;
 
 };
@@ -259,6 +449,9 @@ class MultiArcCombinedStateTransitionAndSensitivityMatrixInterface: public Combi
 {
 public:
 
+    using CombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix;
+    using CombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrix;
+
     //! Constructor
     /*!
      * Constructor
@@ -684,6 +877,38 @@ public:
         return arcWiseAndFullSolutionInitialStateIndices_;
     }
 
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with copies of the matrix interpolators and arc look-up schemes, so that it
+     * can be used concurrently with the original.
+     * \return Copy of this object that can be used independently of the original
+     */
+    std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > createIndependentCopy( )
+    {
+        std::shared_ptr< MultiArcCombinedStateTransitionAndSensitivityMatrixInterface< StateScalarType > > interfaceCopy =
+                std::make_shared< MultiArcCombinedStateTransitionAndSensitivityMatrixInterface< StateScalarType > >( *this );
+        for( unsigned int i = 0; i < stateTransitionMatrixInterpolators_.size( ); i++ )
+        {
+            interfaceCopy->stateTransitionMatrixInterpolators_.at( i ) =
+                    interpolators::createIndependentLagrangeInterpolatorCopy( stateTransitionMatrixInterpolators_.at( i ) );
+            interfaceCopy->sensitivityMatrixInterpolators_.at( i ) =
+                    interpolators::createIndependentLagrangeInterpolatorCopy( sensitivityMatrixInterpolators_.at( i ) );
+        }
+
+        std::vector< double > arcSplitTimes = arcStartTimes_;
+        arcSplitTimes.push_back( std::numeric_limits< double >::max( ) );
+        interfaceCopy->lookUpscheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >( arcSplitTimes );
+        interfaceCopy->lookUpschemePerBody_.clear( );
+        for( auto itr : arcStartTimesPerBody_ )
+        {
+            std::vector< double > bodyArcSplitTimes = itr.second.first;
+            bodyArcSplitTimes.push_back( std::numeric_limits< double >::max( ) );
+            interfaceCopy->lookUpschemePerBody_[ itr.first ] =
+                    std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >( bodyArcSplitTimes );
+        }
+        return interfaceCopy;
+    }
+
 
 protected:
 
@@ -892,6 +1117,9 @@ class HybridArcCombinedStateTransitionAndSensitivityMatrixInterface: public Comb
 {
 public:
 
+    using CombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix;
+    using CombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrix;
+
     //! Constructor
     /*!
      * Constructor
@@ -1180,6 +1408,25 @@ public:
     }
 
 
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with independent copies of the single- and multi-arc interfaces, so that it
+     * can be used concurrently with the original.
+     * \return Copy of this object that can be used independently of the original
+     */
+    std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > createIndependentCopy( )
+    {
+        std::shared_ptr< HybridArcCombinedStateTransitionAndSensitivityMatrixInterface< StateScalarType > > interfaceCopy =
+                std::make_shared< HybridArcCombinedStateTransitionAndSensitivityMatrixInterface< StateScalarType > >( *this );
+        interfaceCopy->singleArcInterface_ =
+                std::dynamic_pointer_cast< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                    singleArcInterface_->createIndependentCopy( ) );
+        interfaceCopy->multiArcInterface_ =
+                std::dynamic_pointer_cast< MultiArcCombinedStateTransitionAndSensitivityMatrixInterface< StateScalarType > >(
+                    multiArcInterface_->createIndependentCopy( ) );
+        return interfaceCopy;
+    }
+
 private:
 
     //! Object to retrieve state transition/sensitivity matrices for single arc component
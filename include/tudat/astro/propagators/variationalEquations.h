@@ -33,6 +33,132 @@ namespace tudat
 namespace propagators
 {
 
+//! Function adding a partial derivative to a given block of a matrix of the variational equations
+/*!
+ *  Function adding a partial derivative to a given block of a matrix of the variational equations. The
+ *  function is stored with the location and size of the block to which it is to be added, so that the complete
+ *  list of partials can be evaluated in a single pass, without map look-ups.
+ */
+struct VariationalEquationsPartialBlock
+{
+    VariationalEquationsPartialBlock(
+            const int startRow, const int startColumn, const int numberOfRows, const int numberOfColumns,
+            const std::function< void( Eigen::Block< Eigen::MatrixXd > ) >& partialFunction ):
+        startRow_( startRow ), startColumn_( startColumn ), numberOfRows_( numberOfRows ),
+        numberOfColumns_( numberOfColumns ), partialFunction_( partialFunction ){ }
+
+    //! Start row of block in matrix
+    int startRow_;
+
+    //! Start column of block in matrix
+    int startColumn_;
+
+    //! Number of rows of block
+    int numberOfRows_;
+
+    //! Number of columns of block
+    int numberOfColumns_;
+
+    //! Function adding the partial derivative to the block
+    std::function< void( Eigen::Block< Eigen::MatrixXd > ) > partialFunction_;
+};
+
+//! Block of rows of the product of the state partial matrix and the state transition/sensitivity matrices
+/*!
+ *  Block of rows of the product of the state partial matrix and the state transition/sensitivity matrices, with the
+ *  (contiguous) ranges of columns of the state partial matrix that may be non-zero for these rows. Rows for which the
+ *  state partial matrix is an identity matrix (e.g. derivative of position w.r.t. velocity) are flagged, so that the
+ *  product reduces to a copy of the rows of the state transition/sensitivity matrices.
+ */
+struct VariationalMatrixProductBlock
+{
+    VariationalMatrixProductBlock( const int startRow, const int numberOfRows ):
+        startRow_( startRow ), numberOfRows_( numberOfRows ), identityStartColumn_( -1 ){ }
+
+    //! Start row of block
+    int startRow_;
+
+    //! Number of rows of block
+    int numberOfRows_;
+
+    //! Start column of identity matrix block, if rows of the state partial matrix are an identity block (-1 otherwise)
+    int identityStartColumn_;
+
+    //! List of (start column, number of columns) of state partial matrix that may be non-zero for this block of rows
+    std::vector< std::pair< int, int > > nonZeroColumnRanges_;
+};
+
+//! Function to determine the blocks in which the product of the state partial matrix and another matrix is evaluated
+/*!
+ *  Function to determine the blocks in which the product of the state partial matrix and another matrix (the state
+ *  transition and sensitivity matrices) is evaluated, from the structure of the state partial matrix. For each of the
+ *  input blocks of rows, the contiguous ranges of columns that may be non-zero are determined (with adjacent non-zero
+ *  columns merged into a single range). A block for which an identity start column is provided is retained as an
+ *  identity block only if its non-zero entries are exactly those of an identity matrix starting at that column. If
+ *  the input blocks do not cover each row of the matrix exactly once, a single dense block is returned.
+ *  \param rowBlocks Blocks of rows of the state partial matrix, with (optionally) the start column of the identity
+ *  matrix block that the rows are expected to consist of. Column ranges of the input are ignored.
+ *  \param nonZeroEntries Matrix denoting which entries of the (square) state partial matrix may be non-zero
+ *  \return Blocks of rows, with ranges of non-zero columns, from which the product is to be evaluated
+ */
+std::vector< VariationalMatrixProductBlock > createVariationalMatrixProductBlocks(
+        const std::vector< VariationalMatrixProductBlock >& rowBlocks,
+        const Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic >& nonZeroEntries );
+
+//! Function to evaluate the product of the state partial matrix and another matrix, from a list of product blocks
+/*!
+ *  Function to evaluate the product of the state partial matrix and another matrix (the state transition and
+ *  sensitivity matrices), only multiplying the structurally non-zero blocks of the state partial matrix, as determined
+ *  by the createVariationalMatrixProductBlocks function.
+ *  \param productBlocks Blocks of rows, with ranges of non-zero columns, from which the product is to be evaluated
+ *  \param statePartialMatrix State partial matrix (left-hand side of the product)
+ *  \param rightHandSideMatrix Matrix by which the state partial matrix is multiplied
+ *  \param product Matrix block in which the product is returned (by reference)
+ */
+template< typename StateScalarType >
+void multiplyStatePartialMatrixFromProductBlocks(
+        const std::vector< VariationalMatrixProductBlock >& productBlocks,
+        const Eigen::MatrixXd& statePartialMatrix,
+        const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >& rightHandSideMatrix,
+        Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > product )
+{
+    int numberOfColumns = rightHandSideMatrix.cols( );
+    for( unsigned int i = 0; i < productBlocks.size( ); i++ )
+    {
+        const VariationalMatrixProductBlock& currentBlock = productBlocks[ i ];
+        if( currentBlock.identityStartColumn_ >= 0 )
+        {
+            product.block( currentBlock.startRow_, 0, currentBlock.numberOfRows_, numberOfColumns ) =
+                    rightHandSideMatrix.block( currentBlock.identityStartColumn_, 0, currentBlock.numberOfRows_, numberOfColumns );
+        }
+        else if( currentBlock.nonZeroColumnRanges_.size( ) == 0 )
+        {
+            product.block( currentBlock.startRow_, 0, currentBlock.numberOfRows_, numberOfColumns ).setZero( );
+        }
+        else
+        {
+            for( unsigned int j = 0; j < currentBlock.nonZeroColumnRanges_.size( ); j++ )
+            {
+                const std::pair< int, int >& currentRange = currentBlock.nonZeroColumnRanges_[ j ];
+                if( j == 0 )
+                {
+                    product.block( currentBlock.startRow_, 0, currentBlock.numberOfRows_, numberOfColumns ).noalias( ) =
+                            statePartialMatrix.block( currentBlock.startRow_, currentRange.first,
+                                                      currentBlock.numberOfRows_, currentRange.second ).template cast< StateScalarType >( ) *
+                            rightHandSideMatrix.block( currentRange.first, 0, currentRange.second, numberOfColumns );
+                }
+                else
+                {
+                    product.block( currentBlock.startRow_, 0, currentBlock.numberOfRows_, numberOfColumns ).noalias( ) +=
+                            statePartialMatrix.block( currentBlock.startRow_, currentRange.first,
+                                                      currentBlock.numberOfRows_, currentRange.second ).template cast< StateScalarType >( ) *
+                            rightHandSideMatrix.block( currentRange.first, 0, currentRange.second, numberOfColumns );
+                }
+            }
+        }
+    }
+}
+
 //! Class from which the variational equations can be evaluated.
 /*!
  *  Class from which the variational equations can be evaluated. The time derivative of the state transition  and
@@ -116,6 +242,9 @@ public:
         }
         setRotationalStatePartialScalingFunctions( parametersToEstimate );
         setParameterPartialFunctionList( parametersToEstimate );
+
+        // Set flat lists of partial functions, and structure of state partial matrix
+        createEvaluationPlan( );
     }
 
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
@@ -136,14 +265,15 @@ public:
      */
     template< typename StateScalarType >
     void getBodyInitialStatePartialMatrix(
-            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+            const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >& stateTransitionAndSensitivityMatrices,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative )
     {
         setBodyStatePartialMatrix( );
 
-        // Add partials of body positions and velocities.
-        currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
-                ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+        // Add partials of body positions and velocities, only multiplying the structurally non-zero column blocks
+        multiplyStatePartialMatrixFromProductBlocks< StateScalarType >(
+                    productBlocks_, variationalMatrix_,
+                    stateTransitionAndSensitivityMatrices.leftCols( numberOfParameterValues_ ), currentMatrixDerivative );
 
         if( couplingEntriesToSuppress_ > 0 )
         {
@@ -173,31 +303,13 @@ public:
         // Initialize matrix to zeros
         variationalParameterMatrix_.setZero( );
 
-        // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
-        for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
-             std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator typeIterator =
-             parameterPartialList_.begin( ); typeIterator != parameterPartialList_.end( ); typeIterator++ )
+        // Evaluate all parameter partial functions determined by setParameterPartialFunctionList( )
+        for( unsigned int i = 0; i < parameterPartialBlocks_.size( ); i++ )
         {
-            int startIndex = stateTypeStartIndices_.at( typeIterator->first );
-            int currentStateSize = getSingleIntegrationSize( typeIterator->first );
-            int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
-
-            // Iterate over all bodies being estimated.
-            for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
-            {
-                // Iterate over all parameter partial functions determined by setParameterPartialFunctionList( )
-                for( functionIterator = typeIterator->second[ i ].begin( );
-                     functionIterator != typeIterator->second[ i ].end( );
-                     functionIterator++ )
-                {
-                    functionIterator->second(
-                                variationalParameterMatrix_.block(
-                                    startIndex + entriesToSkipPerEntry + currentStateSize * i,
-                                    functionIterator->first.first - totalDynamicalStateSize_,
-                                    currentStateSize - entriesToSkipPerEntry,
-                                    functionIterator->first.second ) );
-                }
-            }
+            parameterPartialBlocks_[ i ].partialFunction_(
+                        variationalParameterMatrix_.block(
+                            parameterPartialBlocks_[ i ].startRow_, parameterPartialBlocks_[ i ].startColumn_,
+                            parameterPartialBlocks_[ i ].numberOfRows_, parameterPartialBlocks_[ i ].numberOfColumns_ ) );
         }
 
         for( unsigned int i = 0; i < inertiaTensorsForMultiplication_.size( ); i++ )
@@ -229,7 +341,7 @@ public:
      */
     template< typename StateScalarType >
     void evaluateVariationalEquations(
-            const double time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >&
+            const double time, const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >&
             stateTransitionAndSensitivityMatrices,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative )
     {
@@ -261,7 +373,7 @@ public:
      */
     template< typename StateScalarType >
     void updatePartials( const double currentTime,
-                         const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
+                         const std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&
                          currentStatesPerTypeInConventionalRepresentation )
     {
         for( auto stateIterator = currentStatesPerTypeInConventionalRepresentation.begin( );
@@ -334,6 +446,14 @@ private:
      */
     void setStatePartialFunctionList( );
 
+    //! Function (called by constructor) to set up the flat lists of partial functions and the product blocks
+    /*!
+     * Function (called by constructor) to set up the flat lists of partial functions (statePartialBlocks_ and
+     * parameterPartialBlocks_) from the statePartialList_ and parameterPartialList_ members, and to determine the
+     * structurally non-zero blocks of the state partial matrix, stored in the productBlocks_ member.
+     */
+    void createEvaluationPlan( );
+
     //! Function to add parameter partial functions for single state derivative model, and set of parameter objects.
     /*!
      *  Function to add parameter partial functions for single state derivative model, and set of parameter objects.
@@ -618,6 +738,15 @@ private:
     std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > >
     ::iterator functionIterator;
 
+    //! List of all functions adding partial derivatives w.r.t. current states to variationalMatrix_ (from statePartialList_)
+    std::vector< VariationalEquationsPartialBlock > statePartialBlocks_;
+
+    //! List of all functions adding partial derivatives w.r.t. parameters to variationalParameterMatrix_ (from parameterPartialList_)
+    std::vector< VariationalEquationsPartialBlock > parameterPartialBlocks_;
+
+    //! Blocks of rows of variationalMatrix_, with their structurally non-zero columns, covering all rows of the matrix
+    std::vector< VariationalMatrixProductBlock > productBlocks_;
+
     //! Pre-declared iterator over all state types
     std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >
     ::iterator stateDerivativeTypeIterator_;
@@ -0,0 +1,89 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLEL_EXECUTION_H
+#define TUDAT_PARALLEL_EXECUTION_H
+
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to execute a list of independent tasks, distributed over a given number of threads
+/*!
+ *  Function to execute a list of independent tasks, distributed over a given number of threads. The tasks are assigned
+ *  to the threads in a fixed (round-robin) order, i.e. thread j executes tasks j, j + N, j + 2N, ... (with N the number
+ *  of threads), so that each task is always executed by the same thread. This allows each thread to operate on its own
+ *  (persistent) copy of any data that cannot be shared between threads. The calling thread is used as thread 0. If any
+ *  of the tasks throws an exception, the remaining tasks of that thread are skipped, and the exception is rethrown
+ *  (for the lowest thread index) once all threads have finished.
+ *  \param numberOfTasks Number of tasks that are to be executed
+ *  \param numberOfThreads Number of threads over which the tasks are to be distributed (at least 1)
+ *  \param taskFunction Function executing a single task, with the task index and thread index as input
+ */
+inline void executeTasksInParallel(
+        const unsigned int numberOfTasks,
+        const unsigned int numberOfThreads,
+        const std::function< void( const unsigned int, const unsigned int ) >& taskFunction )
+{
+    if( numberOfThreads == 0 )
+    {
+        throw std::runtime_error( "Error when executing tasks in parallel, at least one thread is required." );
+    }
+
+    std::vector< std::exception_ptr > threadExceptions( numberOfThreads );
+    auto executeThreadTasks = [ & ]( const unsigned int threadIndex )
+    {
+        try
+        {
+            for( unsigned int task = threadIndex; task < numberOfTasks; task += numberOfThreads )
+            {
+                taskFunction( task, threadIndex );
+            }
+        }
+        catch( ... )
+        {
+            threadExceptions.at( threadIndex ) = std::current_exception( );
+        }
+    };
+
+    std::vector< std::thread > threads;
+    threads.reserve( numberOfThreads - 1 );
+    for( unsigned int thread = 1; thread < numberOfThreads; thread++ )
+    {
+        threads.emplace_back( executeThreadTasks, thread );
+    }
+    executeThreadTasks( 0 );
+    for( unsigned int thread = 0; thread < threads.size( ); thread++ )
+    {
+        threads.at( thread ).join( );
+    }
+
+    for( unsigned int thread = 0; thread < numberOfThreads; thread++ )
+    {
+        if( threadExceptions.at( thread ) != nullptr )
+        {
+            std::rethrow_exception( threadExceptions.at( thread ) );
+        }
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLEL_EXECUTION_H
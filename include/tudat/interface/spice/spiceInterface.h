@@ -116,6 +116,25 @@ int convertBodyNameToNaifId(const std::string &bodyName);
 //! Convert a NAIF identification number to its body name.
 std::string convertNaifIdToBodyName( int bodyNaifId );
 
+//! Retrieve the NAIF identification number of a body, as used in SPK kernels.
+/*!
+ *  Retrieve the NAIF identification number of a body, as used in SPK kernels, throwing an error if the body name
+ *  is not recognized by Spice. Names that consist of an integer are converted directly.
+ *  \param bodyName Name of the body
+ *  \return NAIF identification number of the body
+ */
+int getSpkBodyIdFromName( const std::string& bodyName );
+
+//! Retrieve the NAIF identification number of a body-fixed frame class, as used in binary PCK kernels.
+/*!
+ *  Retrieve the NAIF identification number of a body-fixed frame class, as used in binary PCK kernels (e.g. 3000 for
+ *  the ITRF93 frame), throwing an error if the frame is not recognized by Spice, or is not a PCK frame. Names that
+ *  consist of an integer are converted directly.
+ *  \param frameName Name of the frame
+ *  \return NAIF identification number of the frame class
+ */
+int getPckFrameClassIdFromName( const std::string& frameName );
+
 //! @get_docstring(check_body_property_in_kernel_pool)
 bool checkBodyPropertyInKernelPool(const std::string &bodyName, const std::string &bodyProperty);
 
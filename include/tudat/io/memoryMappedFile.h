@@ -0,0 +1,95 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MEMORYMAPPEDFILE_H
+#define TUDAT_MEMORYMAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Class providing read-only access to the full contents of a file, mapped into memory
+/*!
+ *  Class providing read-only access to the full contents of a file, mapped into memory. The file contents are not
+ *  copied when the object is created, but are paged in by the operating system when accessed, and are shared between
+ *  all processes mapping the same file. On platforms where memory-mapping is not supported, the file contents are read
+ *  into a buffer owned by this object. The data remains valid for the lifetime of the object.
+ */
+class MemoryMappedFile
+{
+public:
+
+    //! Constructor, maps the file into memory
+    /*!
+     *  Constructor, maps the file into memory
+     *  \param fileName Name of the file that is to be mapped
+     */
+    MemoryMappedFile( const std::string& fileName );
+
+    //! Destructor, unmaps the file
+    ~MemoryMappedFile( );
+
+    MemoryMappedFile( const MemoryMappedFile& ) = delete;
+
+    MemoryMappedFile& operator=( const MemoryMappedFile& ) = delete;
+
+    //! Function to retrieve pointer to the start of the file contents
+    const char* getData( ) const
+    {
+        return data_;
+    }
+
+    //! Function to retrieve the size of the file (in bytes)
+    std::size_t getSize( ) const
+    {
+        return size_;
+    }
+
+    //! Function to retrieve the name of the mapped file
+    std::string getFileName( ) const
+    {
+        return fileName_;
+    }
+
+    //! Function to retrieve whether the file is memory-mapped (true) or read into a buffer (false)
+    bool isMapped( ) const
+    {
+        return isMapped_;
+    }
+
+private:
+
+    //! Name of the mapped file
+    std::string fileName_;
+
+    //! Pointer to the start of the file contents
+    const char* data_;
+
+    //! Size of the file (in bytes)
+    std::size_t size_;
+
+    //! Boolean denoting whether the file is memory-mapped (true) or read into a buffer (false)
+    bool isMapped_;
+
+    //! Buffer containing file contents, if memory-mapping is not supported
+    std::vector< char > buffer_;
+};
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_MEMORYMAPPEDFILE_H
@@ -11,6 +11,8 @@
 #ifndef TUDAT_READBINARYFILE_H
 #define TUDAT_READBINARYFILE_H
 
+#include <cstdint>
+
 namespace tudat
 {
 namespace input_output
@@ -326,6 +328,55 @@ void parseStringsBlockWrapper (std::bitset< NumberBlockBytes * 8 > dataBits,
             dataBits, 0, 0, arg, args ... );
 }
 
+//! Function to extract an unsigned integer from a segment of a big-endian byte array.
+/*!
+ * Function to extract an unsigned integer from a segment of a big-endian byte array, without converting the data to a
+ * bitset. Equivalent to extracting the segment with getBitsetSegment from a bitset read with readBinaryFileBlock, and
+ * converting it with to_ulong, but suitable for decoding large numbers of data blocks.
+ *
+ * @param data Byte array from which to extract the integer.
+ * @param startBit Index of the first bit of the integer. 0 corresponds to the most significant bit of the first byte.
+ * @param numberOfBits Number of bits of the integer. Should not exceed 32.
+ * @return Unsigned integer representation of the bit segment.
+ */
+inline uint32_t getUnsignedIntegerFromBytes(
+        const unsigned char* data, const unsigned int startBit, const unsigned int numberOfBits )
+{
+    const unsigned int startByte = startBit / 8;
+    const unsigned int endByte = ( startBit + numberOfBits - 1 ) / 8;
+
+    uint64_t bytes = 0;
+    for( unsigned int i = startByte; i <= endByte; i++ )
+    {
+        bytes = ( bytes << 8 ) | data[ i ];
+    }
+
+    const unsigned int trailingBits = 8 * ( endByte + 1 ) - startBit - numberOfBits;
+    return static_cast< uint32_t >( ( bytes >> trailingBits ) & ( ( static_cast< uint64_t >( 1 ) << numberOfBits ) - 1 ) );
+}
+
+//! Function to extract a signed (two's complement) integer from a segment of a big-endian byte array.
+/*!
+ * Function to extract a signed (two's complement) integer from a segment of a big-endian byte array, without converting
+ * the data to a bitset. Equivalent to extracting the segment with getBitsetSegment from a bitset read with
+ * readBinaryFileBlock, and converting it with convertBitsetToLong.
+ *
+ * @param data Byte array from which to extract the integer.
+ * @param startBit Index of the first bit of the integer. 0 corresponds to the most significant bit of the first byte.
+ * @param numberOfBits Number of bits of the integer. Should not exceed 32.
+ * @return Signed integer representation of the bit segment.
+ */
+inline int32_t getSignedIntegerFromBytes(
+        const unsigned char* data, const unsigned int startBit, const unsigned int numberOfBits )
+{
+    int64_t value = getUnsignedIntegerFromBytes( data, startBit, numberOfBits );
+    if( value >= ( static_cast< int64_t >( 1 ) << ( numberOfBits - 1 ) ) )
+    {
+        value -= ( static_cast< int64_t >( 1 ) << numberOfBits );
+    }
+    return static_cast< int32_t >( value );
+}
+
 } // namespace input_output
 
 } // namespace tudat
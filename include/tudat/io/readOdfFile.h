@@ -777,6 +777,138 @@ inline std::shared_ptr< OdfRawFileContents > readOdfFile( std::string fileName )
     return std::make_shared< OdfRawFileContents >( fileName );
 }
 
+//! Ramp data for a single ground station, extracted from the ramp groups of one or more ODF files, stored per column.
+struct OdfRampColumns
+{
+    // Ramp start times in UTC seconds since the reference time specified in the header.
+    std::vector< double > rampStartTimes_;
+
+    // Ramp end times in UTC seconds since the reference time specified in the header.
+    std::vector< double > rampEndTimes_;
+
+    // Ramp rates in Hz/s.
+    std::vector< double > rampRates_;
+
+    // Ramp start frequencies in Hz.
+    std::vector< double > rampStartFrequencies_;
+};
+
+// Class containing the raw data from an ODF file, according to TRK-2-18 (2018), with the data stored per column.
+/*!
+ * Class containing the raw data from an ODF file, according to TRK-2-18 (2018). In contrast to OdfRawFileContents, the
+ * file is memory-mapped, and its fixed-size (36 byte) records are decoded directly from the mapped bytes, storing each
+ * item of the orbit data, ramp and clock offset blocks in a separate vector (one entry per record). No objects are
+ * created per record. The observable-specific items of the orbit data blocks are stored according to the layout of
+ * the Doppler data blocks (table 3-4d of TRK-2-18 (2018)); for the other data types (which share this bit layout), the
+ * items at the same position have a different meaning, see the OdfDataSpecificBlock derived classes.
+ */
+class OdfColumnarFileContents
+{
+public:
+
+    /*!
+     * Constructor. Extracts all the data from an ODF file.
+     *
+     * @param odfFile File name/location of ODF file that is to be read
+     */
+    OdfColumnarFileContents( const std::string& odfFile );
+
+    // Returns the number of orbit data records
+    unsigned int getNumberOfDataRecords( ) const
+    {
+        return observableTimes_.size( );
+    }
+
+    // File label group, table 3.2 of TRK-2-18 (2018)
+    std::string systemId_;
+    std::string programId_;
+    uint32_t spacecraftId_;
+
+    uint32_t fileCreationDate_; // year, month, day (YYYMMDD): year from 1900
+    uint32_t fileCreationTime_; // hour, minute, second (HHMMSS)
+
+    uint32_t fileReferenceDate_; // year, month, day (YYYYMMDD)
+    uint32_t fileReferenceTime_; // hour, minute, second (HHMMSS)
+
+    // ODF file name
+    std::string fileName_;
+
+    // Identifier group, table 3.3 of TRK-2-18 (2018)
+    std::string identifierGroupStringA_;
+    std::string identifierGroupStringB_;
+    std::string identifierGroupStringC_;
+
+    // Boolean indicating whether the EOF header was found (header should be present in all ODF files)
+    bool eofHeaderFound_;
+
+    // Common portion of orbit data blocks, table 3-4a of TRK-2-18 (2018), one entry per record
+    std::vector< double > observableTimes_; // UTC seconds since the reference time specified in the header
+    std::vector< double > observableValues_; // SI units
+    std::vector< double > receivingStationDownlinkDelays_; // sec
+    std::vector< int > receivingStationIds_;
+    std::vector< int > transmittingStationIds_;
+    std::vector< int > transmittingStationNetworkIds_;
+    std::vector< int > dataTypes_;
+    std::vector< int > downlinkBandIds_;
+    std::vector< int > uplinkBandIds_;
+    std::vector< int > referenceBandIds_;
+    std::vector< int > validities_;
+
+    // Observable-specific portion of orbit data blocks, according to table 3-4d of TRK-2-18 (2018), one entry per record
+    std::vector< int > receiverChannels_;
+    std::vector< int > spacecraftIds_;
+    std::vector< int > receiverExciterFlags_;
+    std::vector< double > referenceFrequencies_; // Hz
+    std::vector< double > compressionTimes_; // sec
+    std::vector< double > transmittingStationUplinkDelays_; // sec
+
+    // Ramp data, indexed by transmitting station ID
+    std::map< int, OdfRampColumns > rampData_;
+
+    // Clock offset data, table 3-6 of TRK-2-18 (2018), one entry per clock offset block
+    std::vector< int > clockOffsetPrimaryStationIds_;
+    std::vector< int > clockOffsetSecondaryStationIds_;
+    std::vector< double > clockOffsetStartTimes_; // UTC seconds since the reference time specified in the header
+    std::vector< double > clockOffsetEndTimes_; // UTC seconds since the reference time specified in the header
+    std::vector< double > clockOffsets_; // sec
+
+private:
+
+    /*!
+     * Function to decode an orbit data record, and append its contents to the data columns.
+     *
+     * @param record Pointer to the 36 bytes of the record.
+     */
+    void addOrbitDataRecord( const unsigned char* record );
+
+    /*!
+     * Function to decode a ramp record, and append its contents to the ramp data of the given station.
+     *
+     * @param record Pointer to the 36 bytes of the record.
+     * @param rampStation ID of the station to which the ramp group applies.
+     */
+    void addRampRecord( const unsigned char* record, const int rampStation );
+
+    /*!
+     * Function to decode a clock offset record, and append its contents to the clock offset columns.
+     *
+     * @param record Pointer to the 36 bytes of the record.
+     */
+    void addClockOffsetRecord( const unsigned char* record );
+};
+
+/*!
+ * Function to read a list of ODF files, storing the contents of each file per column. The files are memory-mapped and
+ * decoded independently, distributed over the given number of threads.
+ *
+ * @param fileNames Names of the ODF files that are to be read
+ * @param numberOfThreads Number of threads over which the files are distributed
+ * @return Contents of the ODF files, in the same order as fileNames
+ */
+std::vector< std::shared_ptr< OdfColumnarFileContents > > readOdfFilesColumnar(
+        const std::vector< std::string >& fileNames,
+        const unsigned int numberOfThreads = 1 );
+
 } // namespace input_output
 
 } // namespace tudat
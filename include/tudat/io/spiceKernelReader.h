@@ -0,0 +1,406 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SPICEKERNELREADER_H
+#define TUDAT_SPICEKERNELREADER_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! NAIF integer code of the J2000 (ICRF-aligned) inertial reference frame
+static const int spiceJ2000FrameId = 1;
+
+//! NAIF integer code of the ECLIPJ2000 inertial reference frame
+static const int spiceEclipJ2000FrameId = 17;
+
+//! Function to retrieve the NAIF integer code of an inertial frame supported by the native SPICE kernel reader
+/*!
+ *  Function to retrieve the NAIF integer code of an inertial frame supported by the native SPICE kernel reader
+ *  (J2000 and ECLIPJ2000).
+ *  \param frameName Name of the frame
+ *  \return NAIF integer code of the frame
+ */
+int getSpiceInertialFrameId( const std::string& frameName );
+
+//! Function to retrieve the rotation matrix from the J2000 frame to an inertial frame supported by the native reader
+/*!
+ *  Function to retrieve the rotation matrix from the J2000 frame to an inertial frame supported by the native reader
+ *  (J2000 and ECLIPJ2000). The ECLIPJ2000 frame is obtained from the J2000 frame using the IAU 1976 obliquity of the
+ *  ecliptic at J2000, as is done by SPICE.
+ *  \param frameId NAIF integer code of the frame
+ *  \return Rotation matrix from the J2000 frame to the requested frame
+ */
+Eigen::Matrix3d getRotationFromJ2000ToSpiceInertialFrame( const int frameId );
+
+//! Class for a single segment of an SPK (ephemeris) or binary PCK (orientation) kernel
+/*!
+ *  Class for a single segment of an SPK (ephemeris) or binary PCK (orientation) kernel, providing direct evaluation of
+ *  the data in the segment. Supported are SPK types 1 (modified difference arrays), 2 (Chebyshev position),
+ *  3 (Chebyshev position and velocity), 13 (Hermite interpolation, unequal time steps) and 21 (extended modified
+ *  difference arrays), and binary PCK type 2
+ *  (Chebyshev Euler angles). The segment data is not copied, but is read directly from the (memory-mapped) kernel file
+ *  on each evaluation. Evaluation does not modify the object, so that it may be performed concurrently from multiple
+ *  threads.
+ */
+class SpiceKernelSegment
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, parses the segment meta-data, and checks its consistency with the segment size.
+     *  \param fileData Pointer to start of the contents of the kernel file (which must remain valid for the lifetime of
+     *  this object)
+     *  \param fileName Name of the kernel file, used for error messages
+     *  \param isOrientationSegment Boolean denoting whether the segment is from a binary PCK (true) or SPK (false) file
+     *  \param bodyId NAIF integer code of the target body (SPK), or of the body-fixed frame class (PCK)
+     *  \param centerId NAIF integer code of the center body (SPK); not used for PCK segments
+     *  \param frameId NAIF integer code of the frame in which the state is given (SPK), or of the base frame w.r.t.
+     *  which the orientation is given (PCK)
+     *  \param dataType Type of the segment
+     *  \param startEpoch Start of the segment coverage (TDB seconds since J2000)
+     *  \param endEpoch End of the segment coverage (TDB seconds since J2000)
+     *  \param initialAddress Address (1-based double precision word index) of the first segment data item
+     *  \param finalAddress Address (1-based double precision word index) of the last segment data item
+     */
+    SpiceKernelSegment( const char* fileData,
+                        const std::string& fileName,
+                        const bool isOrientationSegment,
+                        const int bodyId,
+                        const int centerId,
+                        const int frameId,
+                        const int dataType,
+                        const double startEpoch,
+                        const double endEpoch,
+                        const int initialAddress,
+                        const int finalAddress );
+
+    //! Function to evaluate the segment at a given epoch
+    /*!
+     *  Function to evaluate the segment at a given epoch. For SPK segments, the Cartesian state (in km and km/s) of the
+     *  body w.r.t. its center is returned, in the frame of the segment. For PCK segments, the Euler angles (in rad) and
+     *  their time derivatives (in rad/s) are returned.
+     *  \param ephemerisTime Epoch at which the segment is to be evaluated (TDB seconds since J2000)
+     *  \param result Evaluated state or Euler angles and their derivatives (returned by reference)
+     */
+    void evaluate( const double ephemerisTime, double* result ) const;
+
+    //! Function to retrieve whether the segment is from a binary PCK (true) or SPK (false) file
+    bool isOrientationSegment( ) const
+    {
+        return isOrientationSegment_;
+    }
+
+    //! Function to retrieve the NAIF integer code of the target body (SPK), or of the body-fixed frame class (PCK)
+    int getBodyId( ) const
+    {
+        return bodyId_;
+    }
+
+    //! Function to retrieve the NAIF integer code of the center body (SPK)
+    int getCenterId( ) const
+    {
+        return centerId_;
+    }
+
+    //! Function to retrieve the NAIF integer code of the frame (SPK), or of the base frame (PCK)
+    int getFrameId( ) const
+    {
+        return frameId_;
+    }
+
+    //! Function to retrieve the type of the segment
+    int getDataType( ) const
+    {
+        return dataType_;
+    }
+
+    //! Function to retrieve the start of the segment coverage (TDB seconds since J2000)
+    double getStartEpoch( ) const
+    {
+        return startEpoch_;
+    }
+
+    //! Function to retrieve the end of the segment coverage (TDB seconds since J2000)
+    double getEndEpoch( ) const
+    {
+        return endEpoch_;
+    }
+
+private:
+
+    //! Function to evaluate a Chebyshev segment (SPK type 2 or 3, PCK type 2)
+    void evaluateChebyshevSegment( const double ephemerisTime, double* result ) const;
+
+    //! Function to evaluate a Hermite interpolation segment (SPK type 13)
+    void evaluateHermiteSegment( const double ephemerisTime, double* result ) const;
+
+    //! Function to evaluate a (extended) modified difference array segment (SPK type 1 or 21)
+    void evaluateDifferenceLineSegment( const double ephemerisTime, double* result ) const;
+
+    //! Pointer to the first data item of the segment
+    const double* segmentData_;
+
+    //! Boolean denoting whether the segment is from a binary PCK (true) or SPK (false) file
+    bool isOrientationSegment_;
+
+    //! NAIF integer code of the target body (SPK), or of the body-fixed frame class (PCK)
+    int bodyId_;
+
+    //! NAIF integer code of the center body (SPK)
+    int centerId_;
+
+    //! NAIF integer code of the frame (SPK), or of the base frame (PCK)
+    int frameId_;
+
+    //! Type of the segment
+    int dataType_;
+
+    //! Start of the segment coverage (TDB seconds since J2000)
+    double startEpoch_;
+
+    //! End of the segment coverage (TDB seconds since J2000)
+    double endEpoch_;
+
+    //! Number of records (types 1, 2, 3 and 21), or of states (type 13), in the segment
+    int numberOfRecords_;
+
+    //! Initial epoch of the first record (types 2 and 3)
+    double initialRecordEpoch_;
+
+    //! Length of the interval covered by each record (types 2 and 3)
+    double recordIntervalLength_;
+
+    //! Number of data items per record (types 1, 2, 3 and 21)
+    int recordSize_;
+
+    //! Number of Chebyshev coefficients per component (types 2 and 3)
+    int numberOfCoefficients_;
+
+    //! Number of states used for a single interpolation (type 13)
+    int windowSize_;
+
+    //! Maximum dimension of the difference arrays (types 1 and 21)
+    int maximumDifferenceLineDimension_;
+
+    //! Pointer to the epochs of the states (type 13) or the final epochs of the records (types 1 and 21)
+    const double* epochs_;
+};
+
+//! Class for an SPK (ephemeris) or binary PCK (orientation) kernel file
+/*!
+ *  Class for an SPK (ephemeris) or binary PCK (orientation) kernel file, in the NAIF Double precision Array File (DAF)
+ *  format. The file is memory-mapped, and its segment descriptors are parsed on construction. Only files in the native
+ *  binary format of the host (little- or big-endian IEEE) are supported.
+ */
+class SpiceKernelFile
+{
+public:
+
+    //! Constructor, maps the file into memory and parses its segment descriptors
+    /*!
+     *  Constructor, maps the file into memory and parses its segment descriptors
+     *  \param fileName Name of the kernel file
+     */
+    SpiceKernelFile( const std::string& fileName );
+
+    //! Function to retrieve the name of the kernel file
+    std::string getFileName( ) const
+    {
+        return file_->getFileName( );
+    }
+
+    //! Function to retrieve whether the file is a binary PCK (true) or SPK (false) file
+    bool isOrientationKernel( ) const
+    {
+        return isOrientationKernel_;
+    }
+
+    //! Function to retrieve the segments in the file, in the order in which they are stored
+    const std::vector< SpiceKernelSegment >& getSegments( ) const
+    {
+        return segments_;
+    }
+
+private:
+
+    //! Memory-mapped contents of the file
+    std::shared_ptr< MemoryMappedFile > file_;
+
+    //! Boolean denoting whether the file is a binary PCK (true) or SPK (false) file
+    bool isOrientationKernel_;
+
+    //! Segments in the file, in the order in which they are stored
+    std::vector< SpiceKernelSegment > segments_;
+};
+
+//! Class storing which segment is to be used for a single body (or frame) as a function of time
+/*!
+ *  Class storing which segment is to be used for a single body (or frame) as a function of time. The time axis is
+ *  split into intervals at all segment boundaries, and for each interval the segment with the highest priority (as
+ *  defined by SPICE: segments of later-loaded files first, and later segments in a file first) is stored, so that a
+ *  segment is retrieved by a single binary search.
+ */
+class SpiceKernelSegmentCoverage
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param segmentsByPriority Segments for a single body (or frame), in order of decreasing priority
+     */
+    SpiceKernelSegmentCoverage( const std::vector< const SpiceKernelSegment* >& segmentsByPriority );
+
+    //! Function to retrieve the segment to be used at a given epoch
+    /*!
+     *  Function to retrieve the segment to be used at a given epoch
+     *  \param ephemerisTime Epoch at which segment is to be retrieved (TDB seconds since J2000)
+     *  \return Segment to be used at the given epoch (nullptr if the epoch is not covered)
+     */
+    const SpiceKernelSegment* findSegment( const double ephemerisTime ) const;
+
+    //! Function to retrieve the boundaries of the intervals into which the time axis is split
+    const std::vector< double >& getIntervalBoundaries( ) const
+    {
+        return intervalBoundaries_;
+    }
+
+private:
+
+    //! Boundaries of the intervals into which the time axis is split (one more than the number of intervals)
+    std::vector< double > intervalBoundaries_;
+
+    //! Segment with the highest priority in each interval (nullptr for intervals without coverage)
+    std::vector< const SpiceKernelSegment* > intervalSegments_;
+
+    //! Priority (0 being the highest) of the segment in each interval
+    std::vector< int > intervalPriorities_;
+};
+
+//! Class providing ephemerides and orientations from a set of SPK and binary PCK kernels, without use of CSPICE
+/*!
+ *  Class providing ephemerides and orientations from a set of SPK and binary PCK kernels, without use of CSPICE. The
+ *  kernel files are memory-mapped and indexed on construction, after which the object is not modified, so that it may
+ *  be used concurrently from multiple threads (unlike CSPICE itself). The priority of overlapping segments follows that
+ *  of SPICE, with files later in the list taking precedence. States of bodies are computed by summing the states along
+ *  the chains of center bodies of the target and observer, up to their closest common center. Only the geometric
+ *  states (without aberration corrections) in the J2000 and ECLIPJ2000 frames are supported, and the frames of the
+ *  segments themselves must be one of these two.
+ */
+class SpiceKernelCollection
+{
+public:
+
+    //! Constructor, maps the kernel files into memory and indexes their segments
+    /*!
+     *  Constructor, maps the kernel files into memory and indexes their segments
+     *  \param fileNames Names of the SPK and binary PCK kernel files, in order of increasing priority
+     */
+    SpiceKernelCollection( const std::vector< std::string >& fileNames );
+
+    //! Function to compute the Cartesian state of a body w.r.t. another body
+    /*!
+     *  Function to compute the geometric Cartesian state of a body w.r.t. another body.
+     *  \param targetId NAIF integer code of the body of which the state is to be computed
+     *  \param observerId NAIF integer code of the body w.r.t. which the state is to be computed
+     *  \param ephemerisTime Epoch at which the state is to be computed (TDB seconds since J2000)
+     *  \param frameId NAIF integer code of the frame in which the state is to be computed (J2000 or ECLIPJ2000)
+     *  \return Cartesian state of target w.r.t. observer (in km and km/s)
+     */
+    Eigen::Vector6d getCartesianState( const int targetId,
+                                       const int observerId,
+                                       const double ephemerisTime,
+                                       const int frameId = spiceJ2000FrameId ) const;
+
+    //! Function to compute the orientation of a body-fixed frame, and its time derivative
+    /*!
+     *  Function to compute the rotation matrix from an inertial frame to a body-fixed frame defined in a binary PCK
+     *  kernel, and its time derivative.
+     *  \param frameClassId NAIF integer code of the body-fixed frame class (e.g. 3000 for ITRF93)
+     *  \param ephemerisTime Epoch at which the orientation is to be computed (TDB seconds since J2000)
+     *  \param rotationToFrame Rotation matrix from the inertial to the body-fixed frame (returned by reference)
+     *  \param rotationToFrameDerivative Time derivative of rotation matrix from the inertial to the body-fixed frame
+     *  (returned by reference)
+     *  \param frameId NAIF integer code of the inertial frame (J2000 or ECLIPJ2000)
+     */
+    void getRotationToBodyFixedFrame( const int frameClassId,
+                                      const double ephemerisTime,
+                                      Eigen::Matrix3d& rotationToFrame,
+                                      Eigen::Matrix3d& rotationToFrameDerivative,
+                                      const int frameId = spiceJ2000FrameId ) const;
+
+    //! Function to retrieve whether ephemeris data is available for a given body
+    bool hasEphemerisData( const int bodyId ) const
+    {
+        return ( ephemerisCoverage_.count( bodyId ) > 0 );
+    }
+
+    //! Function to retrieve whether orientation data is available for a given body-fixed frame class
+    bool hasOrientationData( const int frameClassId ) const
+    {
+        return ( orientationCoverage_.count( frameClassId ) > 0 );
+    }
+
+    //! Function to retrieve the kernel files in the collection
+    const std::vector< std::shared_ptr< SpiceKernelFile > >& getKernelFiles( ) const
+    {
+        return kernelFiles_;
+    }
+
+private:
+
+    //! Function to find the ephemeris segment to be used for a body at a given epoch, throwing an error if none exists
+    const SpiceKernelSegment* findEphemerisSegment( const int bodyId, const double ephemerisTime ) const;
+
+    //! Function to add the state of a segment (rotated to the J2000 frame if needed) to a state
+    void addSegmentState( const SpiceKernelSegment* segment, const double ephemerisTime, Eigen::Vector6d& state ) const;
+
+    //! Kernel files in the collection, in order of increasing priority
+    std::vector< std::shared_ptr< SpiceKernelFile > > kernelFiles_;
+
+    //! Ephemeris segment coverage per NAIF body code
+    std::map< int, SpiceKernelSegmentCoverage > ephemerisCoverage_;
+
+    //! Orientation segment coverage per NAIF body-fixed frame class code
+    std::map< int, SpiceKernelSegmentCoverage > orientationCoverage_;
+
+    //! Rotation matrix from the ECLIPJ2000 frame to the J2000 frame
+    Eigen::Matrix3d rotationFromEclipticToJ2000_;
+};
+
+//! Function to retrieve a collection of SPICE kernels, reusing an existing collection for the same list of files
+/*!
+ *  Function to retrieve a collection of SPICE kernels. If a collection for the same list of files is still in use,
+ *  it is returned instead of a new one, so that the kernel files are mapped and indexed only once when used for
+ *  multiple bodies. This function may be called concurrently from multiple threads.
+ *  \param fileNames Names of the SPK and binary PCK kernel files, in order of increasing priority
+ *  \return Collection of SPICE kernels for the given list of files
+ */
+std::shared_ptr< SpiceKernelCollection > getSpiceKernelCollection( const std::vector< std::string >& fileNames );
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_SPICEKERNELREADER_H
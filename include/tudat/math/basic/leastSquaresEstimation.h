@@ -16,8 +16,10 @@
 #define TUDAT_LEASTSQUARESESTIMATION_H
 
 #include <map>
+#include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/Cholesky>
 #include <Eigen/SVD>
 
 #include <boost/function.hpp>
@@ -173,6 +175,267 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
         const Eigen::VectorXd& observationResiduals,
         const double limitConditionNumberForWarning = 1.0E8 );
 
+//! Function to add linear constraints to the inverse covariance matrix and right-hand side of the normal equations
+/*!
+ * Function to add linear constraints to the inverse covariance matrix and right-hand side of the normal equations, by
+ * bordering the inverse covariance matrix with the constraint multiplier (Lagrange multiplier formulation). Both the matrix and
+ * vector are modified by this function.
+ * \param inverseOfCovarianceMatrix Inverse covariance matrix (normal matrix) to which constraints are to be added
+ * \param rightHandSide Right-hand side of normal equations to which constraints are to be added
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ */
+void addConstraintsToNormalEquations(
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside );
+
+//! Class to accumulate the normal equations of a least squares problem, one block of observations at a time
+/*!
+ * Class to accumulate the normal equations H^T W H and H^T W y of a weighted least squares problem (with uncorrelated
+ * observation weights), one block of observations at a time. This allows the normal equations to be set up without the
+ * full design matrix H ever being stored, so that the memory use is independent of the number of observations. Only the
+ * lower triangle of the normal matrix is updated when adding observations (as a rank update).
+ */
+class NormalEquationsAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfParameters Number of estimated parameters (columns of the design matrix)
+     */
+    NormalEquationsAccumulator( const int numberOfParameters );
+
+    //! Function to add the contribution of a block of observations to the normal equations
+    /*!
+     * Function to add the contribution of a block of observations to the normal equations
+     * \param designMatrixBlock Partial derivatives of the observations in the block (rows) w.r.t. estimated parameters (columns)
+     * \param observationResidualsBlock Difference between measured and simulated observations in the block
+     * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the observations in the block
+     */
+    void addObservations(
+            const Eigen::MatrixXd& designMatrixBlock,
+            const Eigen::VectorXd& observationResidualsBlock,
+            const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to add the contribution of a block of observations to the normal matrix only (without residuals)
+    /*!
+     * Function to add the contribution of a block of observations to the normal matrix only (without residuals), as used
+     * for covariance analysis
+     * \param designMatrixBlock Partial derivatives of the observations in the block (rows) w.r.t. estimated parameters (columns)
+     * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the observations in the block
+     */
+    void addObservationPartials(
+            const Eigen::MatrixXd& designMatrixBlock,
+            const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to retrieve the (full, symmetric) normal matrix H^T W H accumulated so far
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+    //! Function to retrieve the right-hand side H^T W y of the normal equations accumulated so far
+    Eigen::VectorXd getRightHandSide( ) const
+    {
+        return rightHandSide_;
+    }
+
+    //! Function to retrieve the number of observations added to the normal equations
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+    //! Function to remove all observations from the normal equations
+    void reset( );
+
+private:
+
+    //! Number of estimated parameters
+    int numberOfParameters_;
+
+    //! Normal matrix H^T W H (only lower triangle is updated)
+    Eigen::MatrixXd normalMatrix_;
+
+    //! Right-hand side H^T W y of the normal equations
+    Eigen::VectorXd rightHandSide_;
+
+    //! Number of observations added to the normal equations
+    int numberOfObservations_;
+
+};
+
+//! Function to perform an iteration of least squares estimation from (accumulated) normal equations
+/*!
+ * Function to perform an iteration of least squares estimation from (accumulated) normal equations H^T W H and H^T W y,
+ * as an alternative to performLeastSquaresAdjustmentFromDesignMatrix when the full design matrix is not available. Without
+ * constraints, the system is solved by a Cholesky decomposition (with a robust LDLT decomposition, and finally an SVD
+ * decomposition, as fallback for semi-definite systems). With constraints, the (indefinite) bordered system is solved using
+ * an SVD decomposition.
+ * \param normalMatrix Normal matrix H^T W H (without a priori information)
+ * \param rightHandSide Right-hand side H^T W y of the normal equations
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (none if size 0)
+ * \param limitConditionNumberForWarning Maximum value of the condition number of the covariance matrix that is allowed
+ * (warning printed when exceeded, no check if NaN)
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
+//! Class to accumulate and solve normal equations with a block-arrow (arrow-head) structure
+/*!
+ * Class to accumulate and solve the normal equations H^T W H and H^T W y of a weighted least squares problem in which the
+ * parameters are partitioned into global parameters, and a number of groups of local parameters (e.g. the initial states and
+ * other arc-wise parameters of the arcs of a multi-arc estimation). Each observation may depend on the global parameters, and
+ * on the local parameters of at most a single group, so that the normal matrix has a block-arrow structure: the blocks
+ * coupling local parameters of different groups are zero. Only the non-zero blocks are stored, and the normal equations are
+ * solved by reducing the local parameters of each group (Schur complement), solving the reduced system for the global
+ * parameters, and then back-substituting to obtain the local parameters. The cost of accumulating and solving the normal
+ * equations is then linear in the number of groups, instead of quadratic (accumulation) or cubic (solution) in the total
+ * number of parameters.
+ *
+ * The group to which an observation is assigned is determined from the non-zero partials w.r.t. the local parameters. An
+ * exception is thrown if an observation depends on local parameters of more than a single group.
+ */
+class BlockArrowNormalEquationsAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfParameters Total number of estimated parameters (columns of the design matrix)
+     * \param localParameterIndices List of groups of local parameters, with each entry the indices (in the full parameter
+     * vector) of the parameters in that group. All parameters that are not in any group are global parameters.
+     */
+    BlockArrowNormalEquationsAccumulator(
+            const int numberOfParameters,
+            const std::vector< std::vector< int > >& localParameterIndices );
+
+    //! Function to add the contribution of a block of observations to the normal equations
+    /*!
+     * Function to add the contribution of a block of observations to the normal equations
+     * \param designMatrixBlock Partial derivatives of the observations in the block (rows) w.r.t. estimated parameters (columns)
+     * \param observationResidualsBlock Difference between measured and simulated observations in the block
+     * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the observations in the block
+     */
+    void addObservations(
+            const Eigen::MatrixXd& designMatrixBlock,
+            const Eigen::VectorXd& observationResidualsBlock,
+            const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to add the contribution of a block of observations to the normal matrix only (without residuals)
+    /*!
+     * Function to add the contribution of a block of observations to the normal matrix only (without residuals), as used
+     * for covariance analysis
+     * \param designMatrixBlock Partial derivatives of the observations in the block (rows) w.r.t. estimated parameters (columns)
+     * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the observations in the block
+     */
+    void addObservationPartials(
+            const Eigen::MatrixXd& designMatrixBlock,
+            const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to rescale the parameters of the normal equations
+    /*!
+     * Function to rescale the parameters of the normal equations, such that the normal equations are those for the parameters
+     * p_i / s_i (i.e. the normal matrix is replaced by S N S and the right-hand side by S b, with S = diag( s ) ). This is
+     * used to normalize the normal equations, in the same manner as the design matrix is normalized.
+     * \param scalingFactors Scaling factor s_i for each of the parameters
+     */
+    void scaleParameters( const Eigen::VectorXd& scalingFactors );
+
+    //! Function to solve the normal equations, reducing the local parameters of each group
+    /*!
+     * Function to solve the normal equations (with a priori information), by reducing the local parameters of each group
+     * (Schur complement) and solving the reduced system for the global parameters (by Cholesky decomposition, with LDLT and
+     * SVD decompositions as fallback, as in performLeastSquaresAdjustmentFromNormalEquations). The a priori information may
+     * not couple local parameters of different groups.
+     * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (none if size 0)
+     * \param limitConditionNumberForWarning Maximum value of the condition number of the reduced global system that is
+     * allowed (warning printed when exceeded, no check if NaN)
+     * \return Solution of the normal equations (for all parameters, in the order of the full parameter vector)
+     */
+    Eigen::VectorXd solve( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+                           const double limitConditionNumberForWarning = 1.0E8 ) const;
+
+    //! Function to retrieve the full (dense, symmetric) normal matrix H^T W H accumulated so far
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+    //! Function to retrieve the (full) right-hand side H^T W y of the normal equations accumulated so far
+    Eigen::VectorXd getRightHandSide( ) const;
+
+    //! Function to retrieve the number of observations added to the normal equations
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+    //! Function to retrieve the number of groups of local parameters
+    int getNumberOfLocalParameterGroups( ) const
+    {
+        return localParameterIndices_.size( );
+    }
+
+    //! Function to retrieve the number of global parameters
+    int getNumberOfGlobalParameters( ) const
+    {
+        return globalParameterIndices_.size( );
+    }
+
+    //! Function to remove all observations from the normal equations
+    void reset( );
+
+private:
+
+    //! Function to add the contribution of a block of observations to the normal equations (residuals only used if non-null)
+    void addObservationBlock(
+            const Eigen::MatrixXd& designMatrixBlock,
+            const Eigen::VectorXd* observationResidualsBlock,
+            const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Total number of estimated parameters
+    int numberOfParameters_;
+
+    //! Indices (in full parameter vector) of the local parameters, per group
+    std::vector< std::vector< int > > localParameterIndices_;
+
+    //! Indices (in full parameter vector) of the global parameters
+    std::vector< int > globalParameterIndices_;
+
+    //! Group of each parameter (-1 for global parameters)
+    std::vector< int > parameterGroups_;
+
+    //! Index of each parameter in the list of global parameters, or in the list of local parameters of its group
+    std::vector< int > parameterIndicesInGroup_;
+
+    //! Normal matrix block for global parameters (only lower triangle is updated)
+    Eigen::MatrixXd globalNormalMatrix_;
+
+    //! Normal matrix blocks for local parameters, per group (only lower triangle is updated)
+    std::vector< Eigen::MatrixXd > localNormalMatrices_;
+
+    //! Normal matrix blocks coupling local (rows) and global (columns) parameters, per group
+    std::vector< Eigen::MatrixXd > localGlobalNormalMatrices_;
+
+    //! Right-hand side of normal equations for global parameters
+    Eigen::VectorXd globalRightHandSide_;
+
+    //! Right-hand sides of normal equations for local parameters, per group
+    std::vector< Eigen::VectorXd > localRightHandSides_;
+
+    //! Number of observations added to the normal equations
+    int numberOfObservations_;
+
+};
+
 
 Eigen::VectorXd evaluatePolynomial(
     const Eigen::VectorXd& independentValues,
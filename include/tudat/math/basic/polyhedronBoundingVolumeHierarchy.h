@@ -0,0 +1,195 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *       Real-Time Collision Detection, C. Ericson (2004), Morgan Kaufmann, Sections 5.1.5 and 6.2
+ *       "Signed distance computation using the angle weighted pseudonormal", Baerentzen and Aanaes (2005), IEEE
+ *          Transactions on Visualization and Computer Graphics, 11(3), pp. 243-253
+ */
+
+#ifndef TUDAT_POLYHEDRON_BOUNDING_VOLUME_HIERARCHY_H
+#define TUDAT_POLYHEDRON_BOUNDING_VOLUME_HIERARCHY_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+/*! Computes the point on a triangle closest to a given point.
+ *
+ * Computes the point on a triangle closest to a given point, using the Voronoi regions of the triangle features
+ * (Ericson, 2004, Section 5.1.5).
+ * @param point Point for which the closest point on the triangle is to be computed.
+ * @param vertex0 First vertex of the triangle.
+ * @param vertex1 Second vertex of the triangle.
+ * @param vertex2 Third vertex of the triangle.
+ * @param closestFeature Feature of the triangle on which the closest point lies (output): 0, 1 and 2 denote the
+ * vertices, 3, 4 and 5 the edges from vertex 0 to 1, 1 to 2 and 2 to 0, and 6 the interior of the triangle.
+ * @return Point on the triangle closest to the given point.
+ */
+Eigen::Vector3d computeClosestPointOnTriangle(
+        const Eigen::Vector3d& point,
+        const Eigen::Vector3d& vertex0,
+        const Eigen::Vector3d& vertex1,
+        const Eigen::Vector3d& vertex2,
+        int& closestFeature );
+
+/*! Bounding volume hierarchy of the facets of a polyhedron, for closest-point queries.
+ *
+ * Bounding volume hierarchy (BVH) of the facets of a polyhedron, for closest-point queries. The facets are stored in a
+ * binary tree of axis-aligned bounding boxes, which is built once on construction by recursively splitting the facets
+ * at the median of their centroids along the longest axis of the node (Ericson, 2004, Section 6.2). The distance from a
+ * point to the polyhedron surface (or to its closest vertex) is then found with a depth-first traversal which visits
+ * the closest child first and discards all nodes whose bounding box is further away than the current best distance,
+ * which requires O(log N) operations for typical shape models, instead of O(N) for a brute-force search.
+ *
+ * The closest point is returned together with the angle-weighted pseudonormal of the feature (facet, edge or vertex)
+ * on which it lies (Baerentzen and Aanaes, 2005), which allows determining whether the point is inside or outside a
+ * closed polyhedron without evaluating the solid angle subtended by all facets.
+ */
+class PolyhedronBoundingVolumeHierarchy
+{
+public:
+
+    /*! Constructor.
+     *
+     * Constructor, builds the bounding volume hierarchy.
+     * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+     * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3
+     * columns), provided in counterclockwise order when seen from outside the polyhedron.
+     * @param maximumNumberOfFacetsPerLeaf Maximum number of facets stored in each leaf of the tree.
+     */
+    PolyhedronBoundingVolumeHierarchy( const Eigen::MatrixXd& verticesCoordinates,
+                                       const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                       const unsigned int maximumNumberOfFacetsPerLeaf = 4 );
+
+    /*! Computes the distance to the closest point on the surface of the polyhedron.
+     *
+     * Computes the (unsigned) distance to the closest point on the surface of the polyhedron, i.e. the minimum distance
+     * to any of its facets, edges and vertices.
+     * @param point Point for which the distance is to be computed.
+     * @param closestPoint Closest point on the surface of the polyhedron (output).
+     * @param closestPointPseudoNormal Angle-weighted pseudonormal of the feature on which the closest point lies
+     * (output). For a closed polyhedron, the point is inside if its position relative to the closest point has a
+     * negative component along this direction.
+     * @return Distance to the surface of the polyhedron.
+     */
+    double computeDistanceToSurface( const Eigen::Vector3d& point,
+                                     Eigen::Vector3d& closestPoint,
+                                     Eigen::Vector3d& closestPointPseudoNormal ) const;
+
+    /*! Computes the distance to the closest vertex of the polyhedron.
+     *
+     * Computes the distance to the closest vertex of the polyhedron.
+     * @param point Point for which the distance is to be computed.
+     * @param closestVertex Index of the closest vertex (output).
+     * @return Distance to the closest vertex.
+     */
+    double computeDistanceToClosestVertex( const Eigen::Vector3d& point,
+                                           unsigned int& closestVertex ) const;
+
+    /*! Checks whether a point is inside the polyhedron.
+     *
+     * Checks whether a point is inside the (closed) polyhedron, from the pseudonormal at the closest point on its
+     * surface. Points on the surface are considered to be outside.
+     * @param point Point to be checked.
+     * @return True if the point is inside the polyhedron, false otherwise.
+     */
+    bool isPointInside( const Eigen::Vector3d& point ) const;
+
+    //! Function to return the number of nodes in the tree.
+    unsigned int getNumberOfNodes( ) const
+    {
+        return nodes_.size( );
+    }
+
+    //! Function to return the minimum corner of the bounding box of the full polyhedron.
+    Eigen::Vector3d getMinimumBoundingBoxCorner( ) const
+    {
+        return nodes_.at( 0 ).minimumCorner;
+    }
+
+    //! Function to return the maximum corner of the bounding box of the full polyhedron.
+    Eigen::Vector3d getMaximumBoundingBoxCorner( ) const
+    {
+        return nodes_.at( 0 ).maximumCorner;
+    }
+
+private:
+
+    //! Node of the tree.
+    struct Node
+    {
+        //! Minimum corner of the axis-aligned bounding box of the facets in the node.
+        Eigen::Vector3d minimumCorner;
+
+        //! Maximum corner of the axis-aligned bounding box of the facets in the node.
+        Eigen::Vector3d maximumCorner;
+
+        //! Index of the first facet in facetIndices_ (leaf), or of the first child node (the second child directly
+        //! follows the first one).
+        unsigned int firstIndex;
+
+        //! Number of facets in the leaf (0 for internal nodes).
+        unsigned int numberOfFacets;
+    };
+
+    /*! Recursively builds the subtree for a range of facets.
+     *
+     * Recursively builds the subtree for a range of facets, and stores it in nodes_.
+     * @param nodeIndex Index of the node in nodes_ for which the subtree is to be built.
+     * @param firstFacet Index of the first facet of the range in facetIndices_.
+     * @param endFacet Index one past the last facet of the range in facetIndices_.
+     * @param facetCentroids Centroids of all facets.
+     */
+    void buildSubtree( const unsigned int nodeIndex,
+                       const unsigned int firstFacet,
+                       const unsigned int endFacet,
+                       const Eigen::MatrixXd& facetCentroids );
+
+    //! Computes the squared distance from a point to the bounding box of a node (0 if the point is inside it).
+    double computeSquaredDistanceToNode( const Eigen::Vector3d& point, const Node& node ) const
+    {
+        return ( node.minimumCorner - point ).cwiseMax( point - node.maximumCorner ).cwiseMax( 0.0 ).squaredNorm( );
+    }
+
+    //! Cartesian coordinates of each vertex.
+    Eigen::MatrixXd verticesCoordinates_;
+
+    //! Indices of the 3 vertices describing each facet.
+    Eigen::MatrixXi verticesDefiningEachFacet_;
+
+    //! Maximum number of facets stored in each leaf of the tree.
+    unsigned int maximumNumberOfFacetsPerLeaf_;
+
+    //! Nodes of the tree, with the root node first.
+    std::vector< Node > nodes_;
+
+    //! Indices of the facets, ordered such that the facets of each leaf are contiguous.
+    std::vector< unsigned int > facetIndices_;
+
+    //! Outward unit normal of each facet (one row per facet).
+    Eigen::MatrixXd facetNormals_;
+
+    //! Pseudonormal of each facet edge (one row per facet, with the edges from vertex 0 to 1, 1 to 2 and 2 to 0 in
+    //! columns 0-2, 3-5 and 6-8, respectively).
+    Eigen::MatrixXd edgePseudoNormals_;
+
+    //! Angle-weighted pseudonormal of each vertex (one row per vertex).
+    Eigen::MatrixXd vertexPseudoNormals_;
+};
+
+} // namespace basic_mathematics
+} // namespace tudat
+
+#endif // TUDAT_POLYHEDRON_BOUNDING_VOLUME_HIERARCHY_H
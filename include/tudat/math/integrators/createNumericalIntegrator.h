@@ -337,13 +337,16 @@ public:
                         const bool assessTerminationOnMinorSteps = false ) :
         integratorType_( integratorType ), initialTimeDeprecated_( initialTime ),
         initialTimeStep_( initialTimeStep ), 
-        assessTerminationOnMinorSteps_( assessTerminationOnMinorSteps )
+        assessTerminationOnMinorSteps_( assessTerminationOnMinorSteps ),
+        useDenseOutput_( false )
     { }
 
     virtual std::shared_ptr< IntegratorSettings > clone( ) const
     {
-        return std::make_shared< IntegratorSettings >(
+        std::shared_ptr< IntegratorSettings > clonedSettings = std::make_shared< IntegratorSettings >(
                     integratorType_, initialTimeDeprecated_, initialTimeStep_, assessTerminationOnMinorSteps_ );
+        clonedSettings->useDenseOutput_ = useDenseOutput_;
+        return clonedSettings;
     }
 
     
@@ -381,6 +384,17 @@ public:
      */
     bool assessTerminationOnMinorSteps_;
 
+    // Whether the dense output (continuous extension) of the integrator is to be used.
+    /*
+     * Whether the dense output (continuous extension) of the integrator is to be used. If true, the root finder used to
+     * propagate to an exact dependent variable termination condition evaluates the state inside the last step from the
+     * dense output, instead of re-integrating the step for each iteration. The final state is only taken from the dense
+     * output if its order is equal to that of the integrator; otherwise, it is computed by a final integration step.
+     * Only supported for variable step size Runge-Kutta coefficient sets with a published continuous extension (see
+     * RungeKuttaCoefficients::denseOutputCoefficients). The default value is false.
+     */
+    bool useDenseOutput_;
+
 };
 
 // Class to define settings of fixed step RK numerical integrator.
@@ -475,10 +489,13 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< MultiStageVariableStepSizeSettings< IndependentVariableType> >(
-            this->initialTimeStep_, coefficientSet_,
-            stepSizeControlSettings_, stepSizeAcceptanceSettings_,
-            this->assessTerminationOnMinorSteps_ );
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+            std::make_shared< MultiStageVariableStepSizeSettings< IndependentVariableType> >(
+                this->initialTimeStep_, coefficientSet_,
+                stepSizeControlSettings_, stepSizeAcceptanceSettings_,
+                this->assessTerminationOnMinorSteps_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -551,11 +568,14 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
                     areTolerancesDefinedAsScalar_, this->initialTimeDeprecated_, this->initialTimeStep_, coefficientSet_,
                     minimumStepSize_, maximumStepSize_, this->assessTerminationOnMinorSteps_,
                     safetyFactorForNextStepSize_, maximumFactorIncreaseForNextStepSize_, minimumFactorDecreaseForNextStepSize_,
                     exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Virtual destructor.
@@ -642,12 +662,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     this->assessTerminationOnMinorSteps_,
                     this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
                     this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
     // Constructor.
     /*
@@ -776,12 +799,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     this->assessTerminationOnMinorSteps_,
                     this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
                     this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -1079,9 +1105,10 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > rungeKut
         const IndependentVariableType safetyFactorForNextStepSize = 0.8,
         const IndependentVariableType maximumFactorIncreaseForNextStepSize = 4.0,
         const IndependentVariableType minimumFactorDecreaseForNextStepSize = 0.1,
-        const bool exceptionIfMinimumStepExceeded = true )
+        const bool exceptionIfMinimumStepExceeded = true,
+        const bool useDenseOutput = false )
 {
-    return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances<
+    auto settings = std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances<
             IndependentVariableType > >(
                 TUDAT_NAN, initialTimeStep,
                 coefficientSet, minimumStepSize, maximumStepSize,
@@ -1089,6 +1116,9 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > rungeKut
                  assessTerminationOnMinorSteps, safetyFactorForNextStepSize,
                 maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize,
                 exceptionIfMinimumStepExceeded );
+    settings->useDenseOutput_ = useDenseOutput;
+
+    return settings;
 }
 
 
@@ -1132,7 +1162,8 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > rungeKut
         const IndependentVariableType safetyFactorForNextStepSize = 0.8,
         const IndependentVariableType maximumFactorIncreaseForNextStepSize = 4.0,
         const IndependentVariableType minimumFactorDecreaseForNextStepSize = 0.1,
-        const bool exceptionIfMinimumStepExceeded = true )
+        const bool exceptionIfMinimumStepExceeded = true,
+        const bool useDenseOutput = false )
 {
     auto settings = std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances<
             IndependentVariableType > >(
@@ -1142,6 +1173,7 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > rungeKut
                  assessTerminationOnMinorSteps, safetyFactorForNextStepSize,
                 maximumFactorIncreaseForNextStepSize, minimumFactorDecreaseForNextStepSize,
                 exceptionIfMinimumStepExceeded );
+    settings->useDenseOutput_ = useDenseOutput;
 
     return settings;
 }
@@ -1152,10 +1184,14 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > multiSta
     const numerical_integrators::CoefficientSets coefficientSet,
     const std::shared_ptr< IntegratorStepSizeControlSettings > stepSizeControlSettings,
     const std::shared_ptr< IntegratorStepSizeValidationSettings > stepSizeAcceptanceSettings,
-    const bool assessTerminationOnMinorSteps = false )
+    const bool assessTerminationOnMinorSteps = false,
+    const bool useDenseOutput = false )
 {
-    return std::make_shared< MultiStageVariableStepSizeSettings< IndependentVariableType > >(
+    auto settings = std::make_shared< MultiStageVariableStepSizeSettings< IndependentVariableType > >(
         initialTimeStep, coefficientSet, stepSizeControlSettings, stepSizeAcceptanceSettings, assessTerminationOnMinorSteps );
+    settings->useDenseOutput_ = useDenseOutput;
+
+    return settings;
 }
 
 
@@ -1705,6 +1741,12 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         throw std::runtime_error( "Error while creating integrator. The resulting integrator pointer is null." );
     }
 
+    // Switch on dense output, if requested (throws an error if not supported by integrator)
+    if( integratorSettings->useDenseOutput_ )
+    {
+        integrator->setUseDenseOutput( true );
+    }
+
     // Give back integrator
     return integrator;
 }
@@ -12,8 +12,11 @@
 #ifndef TUDAT_NUMERICAL_INTEGRATOR_H
 #define TUDAT_NUMERICAL_INTEGRATOR_H
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <vector>
 
 #include <functional>
 #include <memory>
@@ -146,6 +149,24 @@ public:
             const TimeStepType initialStepSize,
             const TimeStepType finalTimeTolerance = std::numeric_limits< TimeStepType >::epsilon( ) );
 
+    //! Perform an integration, and return the states at specified output values of the independent variable.
+    /*!
+     * Performs an integration from the current state and independent variable up to the last of the outputEpochs, and
+     * returns the states at all outputEpochs. The steps are taken independently of the outputEpochs (except for the last
+     * step, which is chosen such that it ends at the last of the outputEpochs), and the states at the outputEpochs
+     * inside a step are obtained from the dense output of that step. The dense output must be switched on (see
+     * setUseDenseOutput). The outputEpochs must not be before the current independent variable (w.r.t. the direction of
+     * integration).
+     * \param outputEpochs Values of the independent variable at which the state is to be returned.
+     * \param initialStepSize The initial step size to use (the sign of which sets the direction of integration).
+     * \param finalTimeTolerance Tolerance to within which an output epoch is considered to coincide with a step.
+     * \return Map of states, with the outputEpochs as keys.
+     */
+    std::map< IndependentVariableType, StateType > integrateToOutputEpochs(
+            const std::vector< IndependentVariableType >& outputEpochs,
+            const TimeStepType initialStepSize,
+            const TimeStepType finalTimeTolerance = std::numeric_limits< TimeStepType >::epsilon( ) );
+
     //! Perform a single integration step.
     /*!
      * Performs a single integration step from current independent variable and state as specified
@@ -197,6 +218,57 @@ public:
      */
     virtual void setStepSizeControl( const bool useStepSizeControl ) { }
 
+    //! Function to toggle the use of the dense output (continuous extension) of the integrator.
+    /*!
+     * Function to toggle the use of the dense output (continuous extension) of the integrator, which allows the state
+     * to be evaluated at any point of the last step without repeating the step. To be implemented in derived classes
+     * that provide a dense output; if not implemented, throws an error when switching it on.
+     * \param useDenseOutput Boolean denoting whether the dense output is to be used
+     */
+    virtual void setUseDenseOutput( const bool useDenseOutput )
+    {
+        if( useDenseOutput )
+        {
+            throw std::runtime_error( "Error in numerical integrator. Dense output is not implemented in this integrator." );
+        }
+    }
+
+    //! Function to check whether the dense output can be evaluated over the last step.
+    /*!
+     * Function to check whether the dense output can be evaluated over the last step, i.e. whether it is switched on
+     * and a step has been accepted since the last discrete change of the state.
+     * \return True if getDenseOutputState can be called for the last step.
+     */
+    virtual bool isDenseOutputAvailable( ) const
+    {
+        return false;
+    }
+
+    //! Function to check whether the dense output is of the same order as the integrator.
+    /*!
+     * Function to check whether the dense output is used, and is of the same order as the integrator, so that an
+     * interpolated state is as accurate as a state obtained by taking a step.
+     * \return True if the dense output is used, and is of the same order as the integrator.
+     */
+    virtual bool isDenseOutputOfIntegratorOrder( ) const
+    {
+        return false;
+    }
+
+    //! Function to compute the state at an independent variable value inside the last step from the dense output.
+    /*!
+     * Function to compute the state at an independent variable value inside the last step (between the previous and the
+     * current independent variable) from the dense output, without repeating the step. If not implemented, throws
+     * error.
+     * \param independentVariable Independent variable value at which the state is to be computed.
+     * \return Interpolated state.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        throw std::runtime_error( "Function getDenseOutputState not implemented in this integrator" );
+    }
+
     //! Replace the state with a new value.
     /*!
      * Replace the state with a new value. This allows for discrete jumps in the state, often
@@ -331,6 +403,92 @@ StateType NumericalIntegrator< IndependentVariableType, StateType, StateDerivati
     return getCurrentState( );
 }
 
+//! Perform an integration, and return the states at specified output values of the independent variable.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+std::map< IndependentVariableType, StateType >
+NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::integrateToOutputEpochs(
+        const std::vector< IndependentVariableType >& outputEpochs,
+        const TimeStepType initialStepSize,
+        const TimeStepType finalTimeTolerance )
+{
+    std::map< IndependentVariableType, StateType > outputStates;
+    if( outputEpochs.size( ) == 0 )
+    {
+        return outputStates;
+    }
+
+    // Sort output epochs in direction of integration
+    const double integrationDirection = ( initialStepSize < 0.0 ) ? -1.0 : 1.0;
+    std::vector< IndependentVariableType > sortedOutputEpochs = outputEpochs;
+    std::sort( sortedOutputEpochs.begin( ), sortedOutputEpochs.end( ),
+               [ = ]( const IndependentVariableType& first, const IndependentVariableType& second )
+    {
+        return ( integrationDirection > 0.0 ) ? ( first < second ) : ( second < first );
+    } );
+
+    // Retrieve (signed) distance from current independent variable to an output epoch
+    auto getDistanceToEpoch = [ & ]( const IndependentVariableType& outputEpoch )
+    {
+        return static_cast< TimeStepType >( outputEpoch - getCurrentIndependentVariable( ) ) * integrationDirection;
+    };
+    if( getDistanceToEpoch( sortedOutputEpochs.front( ) ) < -finalTimeTolerance )
+    {
+        throw std::runtime_error( "Error when integrating to output epochs, epochs before the current independent "
+                                  "variable were requested." );
+    }
+
+    // Set output at current independent variable
+    unsigned int nextOutputIndex = 0;
+    while( nextOutputIndex < sortedOutputEpochs.size( ) &&
+           getDistanceToEpoch( sortedOutputEpochs.at( nextOutputIndex ) ) <= finalTimeTolerance )
+    {
+        outputStates[ sortedOutputEpochs.at( nextOutputIndex ) ] = getCurrentState( );
+        nextOutputIndex++;
+    }
+
+    TimeStepType stepSize = initialStepSize;
+    while( nextOutputIndex < sortedOutputEpochs.size( ) )
+    {
+        // Let the last step end at the last output epoch
+        if( std::fabs( static_cast< TimeStepType >( sortedOutputEpochs.back( ) - getCurrentIndependentVariable( ) ) ) <=
+                std::fabs( stepSize ) * ( 1.0 + finalTimeTolerance ) )
+        {
+            stepSize = sortedOutputEpochs.back( ) - getCurrentIndependentVariable( );
+        }
+
+        // Perform the step.
+        performIntegrationStep( stepSize );
+        stepSize = getNextStepSize( );
+        if( !isDenseOutputAvailable( ) )
+        {
+            throw std::runtime_error( "Error when integrating to output epochs, dense output is not available; it must "
+                                      "be switched on." );
+        }
+
+        // Set output inside the step from the dense output, and at the end of the step (to within rounding errors of the
+        // independent variable) from the integrated state
+        const TimeStepType endOfStepTolerance = std::max(
+                    finalTimeTolerance, static_cast< TimeStepType >( 1.0E-12 * std::fabs( static_cast< double >(
+                        getCurrentIndependentVariable( ) - getPreviousIndependentVariable( ) ) ) ) );
+        while( nextOutputIndex < sortedOutputEpochs.size( ) &&
+               getDistanceToEpoch( sortedOutputEpochs.at( nextOutputIndex ) ) <= endOfStepTolerance )
+        {
+            if( std::fabs( getDistanceToEpoch( sortedOutputEpochs.at( nextOutputIndex ) ) ) <= endOfStepTolerance )
+            {
+                outputStates[ sortedOutputEpochs.at( nextOutputIndex ) ] = getCurrentState( );
+            }
+            else
+            {
+                outputStates[ sortedOutputEpochs.at( nextOutputIndex ) ] =
+                        getDenseOutputState( sortedOutputEpochs.at( nextOutputIndex ) );
+            }
+            nextOutputIndex++;
+        }
+    }
+
+    return outputStates;
+}
+
 //! Typedef for shared-pointer to default numerical integrator.
 /*!
  * Typedef for shared-pointer to a default numerical integrator (IndependentVariableType = double,
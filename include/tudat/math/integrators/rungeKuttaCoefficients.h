@@ -9,6 +9,8 @@
  *
  *    References
  *      Burden, R.L., Faires, J.D. Numerical Analysis, 7th Edition, Books/Cole, 2001.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *      Hairer, E., Wanner, G. DOP853 Fortran code, http://www.unige.ch/~hairer/software.html.
  *
  */
 
@@ -51,7 +53,8 @@ enum CoefficientSets
     rungeKuttaVerner89,
     rungeKuttaFeagin108,
     rungeKuttaFeagin1210,
-    rungeKuttaFeagin1412
+    rungeKuttaFeagin1412,
+    rungeKutta85DormandPrince
 };
 
 // Struct that defines the coefficients of a Runge-Kutta integrator
@@ -87,6 +90,30 @@ struct RungeKuttaCoefficients
     // Name of the coefficients.
     std::string name;
 
+    // Coefficients of the continuous extension (dense output) of the integrated estimate.
+    /*
+     * Coefficients of the continuous extension (dense output) of the integrated estimate, with one row per stage (the
+     * stages of the step, followed by the additional dense output stages) and one column per power of the normalized
+     * step fraction theta (starting at theta^1). The weight of stage i at theta is
+     * b_i( theta ) = sum_k denseOutputCoefficients( i, k ) theta^( k + 1 ). Empty if the coefficient set has no
+     * continuous extension.
+     */
+    Eigen::MatrixXd denseOutputCoefficients;
+
+    // a-coefficients of the additional stages that are evaluated for the dense output.
+    /*
+     * a-coefficients of the additional stages that are evaluated (once per step) for the dense output, with one row per
+     * additional stage, and one column for each preceding stage (the stages of the step, followed by the preceding
+     * additional stages).
+     */
+    Eigen::MatrixXd denseOutputACoefficients;
+
+    // c-coefficients of the additional stages that are evaluated for the dense output.
+    Eigen::VectorXd denseOutputCCoefficients;
+
+    // Order of the continuous extension (0 if the coefficient set has no continuous extension).
+    unsigned int denseOutputOrder;
+
     // Default constructor.
     /*
      * Default constructor that initializes coefficients to 0.
@@ -99,7 +126,8 @@ struct RungeKuttaCoefficients
         lowerOrder( 0 ),
         orderEstimateToIntegrate( lower ),
         isFixedStepSize( false ),
-        name( "Undefined" )        
+        name( "Undefined" ),
+        denseOutputOrder( 0 )
     { }
 
     // Constructor.
@@ -130,7 +158,8 @@ struct RungeKuttaCoefficients
         lowerOrder( lowerOrder_ ),
         orderEstimateToIntegrate( order ),
         isFixedStepSize( isFixedStepSize_ ),
-        name( name_ )
+        name( name_ ),
+        denseOutputOrder( 0 )
     { }
 
     // Get coefficients for a specified coefficient set.
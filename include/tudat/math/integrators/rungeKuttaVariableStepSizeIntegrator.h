@@ -135,7 +135,9 @@ public:
         minimumStepSize_( std::fabs( static_cast< double >( minimumStepSize ) ) ),
         maximumStepSize_( std::fabs( static_cast< double >( maximumStepSize ) ) ),
         stepSize_( initialStepSize ),
-        useStepSizeControl_( true )
+        useStepSizeControl_( true ),
+        useDenseOutput_( false ),
+        isDenseOutputAvailable_( false )
     {
         stepSizeController_ = std::make_shared< PerElementIntegratorStepSizeController< TimeStepType, StateType > >(
             relativeErrorTolerance, absoluteErrorTolerance,
@@ -204,7 +206,9 @@ public:
         minimumStepSize_( std::fabs( static_cast< double >( minimumStepSize ) ) ),
         maximumStepSize_( std::fabs( static_cast< double >( maximumStepSize ) ) ),
         stepSize_( initialStepSize ),
-        useStepSizeControl_( true )
+        useStepSizeControl_( true ),
+        useDenseOutput_( false ),
+        isDenseOutputAvailable_( false )
     {
         stepSizeController_ = std::make_shared< PerElementIntegratorStepSizeController< TimeStepType, StateType > >(
             StateType::Constant( initialState.rows( ), initialState.cols( ),
@@ -251,7 +255,9 @@ public:
         stepSize_( initialStepSize ),
         stepSizeController_( stepSizeController ),
         stepSizeValidator_( stepSizeValidator ),
-        useStepSizeControl_( true )
+        useStepSizeControl_( true ),
+        useDenseOutput_( false ),
+        isDenseOutputAvailable_( false )
     {
         stepSizeController_->initialize( initialState );
 
@@ -362,6 +368,7 @@ public:
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
+            isDenseOutputAvailable_ = false;
         }
     }
 
@@ -380,6 +387,7 @@ public:
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
+            isDenseOutputAvailable_ = false;
         }
     }
 
@@ -409,6 +417,70 @@ public:
         return stepSizeValidator_;
     }
 
+    //! Function to toggle the use of the dense output (continuous extension) of the integrator.
+    /*!
+     * Function to toggle the use of the dense output (continuous extension) of the integrator. When switched on, the
+     * stages of each accepted step are retained, so that the state can be evaluated anywhere inside the last step. Only
+     * coefficient sets with a published continuous extension support this (see RungeKuttaCoefficients::
+     * denseOutputCoefficients); an error is thrown when switching it on for any other coefficient set.
+     * \param useDenseOutput Boolean denoting whether the dense output is to be used
+     */
+    void setUseDenseOutput( const bool useDenseOutput )
+    {
+        if( useDenseOutput && coefficients_.denseOutputOrder == 0 )
+        {
+            throw std::runtime_error( "Error in RKF integrator, dense output is not available for the " +
+                                      coefficients_.name + " coefficients." );
+        }
+        useDenseOutput_ = useDenseOutput;
+        isDenseOutputAvailable_ = false;
+    }
+
+    //! Function to check whether the dense output can be evaluated over the last step.
+    /*!
+     * Function to check whether the dense output can be evaluated over the last step, i.e. whether it is switched on
+     * and a step has been accepted since it was switched on or since the last (non-reversible) modification of the state.
+     * The dense output of the last accepted step remains available after a rollback.
+     * \return True if getDenseOutputState can be called for the last step.
+     */
+    bool isDenseOutputAvailable( ) const
+    {
+        return isDenseOutputAvailable_;
+    }
+
+    //! Function to return the order of the dense output.
+    /*!
+     * Function to return the order of the dense output (0 if the dense output is not used).
+     * \return Order of the dense output.
+     */
+    unsigned int getDenseOutputOrder( ) const
+    {
+        return useDenseOutput_ ? coefficients_.denseOutputOrder : 0;
+    }
+
+    //! Function to check whether the dense output is of the same order as the integrated estimate.
+    /*!
+     * Function to check whether the dense output is used, and is of the same order as the integrated estimate.
+     * \return True if the dense output is used, and is of the same order as the integrated estimate.
+     */
+    bool isDenseOutputOfIntegratorOrder( ) const
+    {
+        return useDenseOutput_ && ( coefficients_.denseOutputOrder ==
+                ( ( coefficients_.orderEstimateToIntegrate == RungeKuttaCoefficients::higher ) ?
+                      coefficients_.higherOrder : coefficients_.lowerOrder ) );
+    }
+
+    //! Function to compute the state at an independent variable value inside the last step from the dense output.
+    /*!
+     * Function to compute the state at an independent variable value inside the last accepted step from the dense
+     * output, as y( t0 + theta h ) = y0 + h sum_i b_i( theta ) k_i, with k_i the stages of the step, followed by the
+     * additional dense output stages. The additional stages are evaluated at the first call for a given step. At the end
+     * of the step (theta = 1), the integrated state is recovered (to within rounding errors).
+     * \param independentVariable Independent variable value at which the state is to be computed.
+     * \return Interpolated state.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable );
+
 protected:
 
     //! Computes the next step size and validates the result.
@@ -489,6 +561,25 @@ protected:
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
+    //! Boolean denoting whether the dense output is to be used
+    bool useDenseOutput_;
+
+    //! Boolean denoting whether the dense output of the last accepted step is available
+    bool isDenseOutputAvailable_;
+
+    //! Independent variable at the start of the last accepted step (for dense output).
+    IndependentVariableType denseOutputStartIndependentVariable_;
+
+    //! State at the start of the last accepted step (for dense output).
+    StateType denseOutputStartState_;
+
+    //! Size of the last accepted step (for dense output).
+    TimeStepType denseOutputStepSize_;
+
+    //! State derivatives (values of k_{i}) of the last accepted step, and of the additional dense output stages once
+    //! these have been evaluated (for dense output).
+    std::vector< StateDerivativeType > denseOutputStateDerivatives_;
+
 };
 
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -557,6 +648,16 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         this->lastState_ = this->currentState_;
         this->currentIndependentVariable_ += stepSize;
 
+        // Retain the stages of the accepted step for the dense output.
+        if( useDenseOutput_ )
+        {
+            denseOutputStartIndependentVariable_ = this->lastIndependentVariable_;
+            denseOutputStartState_ = this->lastState_;
+            denseOutputStepSize_ = stepSize;
+            denseOutputStateDerivatives_ = currentStateDerivatives_;
+            isDenseOutputAvailable_ = true;
+        }
+
         switch ( this->coefficients_.orderEstimateToIntegrate )
         {
         case RungeKuttaCoefficients::lower:
@@ -578,6 +679,60 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
     }
 }
 
+//! Compute the state at an independent variable value inside the last step from the dense output.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::getDenseOutputState( const IndependentVariableType independentVariable )
+{
+    if( !isDenseOutputAvailable_ )
+    {
+        throw std::runtime_error( "Error in RKF integrator, dense output is not available; it must be switched on, "
+                                  "and a step must have been taken." );
+    }
+
+    // Compute fraction of the step at which the state is to be computed.
+    const double stepFraction = static_cast< double >( independentVariable - denseOutputStartIndependentVariable_ ) /
+            static_cast< double >( denseOutputStepSize_ );
+    if( stepFraction < -1.0E-12 || stepFraction > 1.0 + 1.0E-12 )
+    {
+        throw std::runtime_error( "Error in RKF integrator, dense output requested outside of last step." );
+    }
+
+    // Evaluate the additional stages of the dense output, if not yet done for this step.
+    const int numberOfStepStages = this->coefficients_.cCoefficients.rows( );
+    if( static_cast< int >( denseOutputStateDerivatives_.size( ) ) == numberOfStepStages )
+    {
+        for( int stage = 0; stage < this->coefficients_.denseOutputCCoefficients.rows( ); stage++ )
+        {
+            StateType intermediateState( denseOutputStartState_ );
+            for ( int column = 0; column < numberOfStepStages + stage; column++ )
+            {
+                intermediateState += denseOutputStepSize_ * this->coefficients_.denseOutputACoefficients( stage, column ) *
+                        denseOutputStateDerivatives_[ column ];
+            }
+            denseOutputStateDerivatives_.push_back(
+                        this->stateDerivativeFunction_(
+                            denseOutputStartIndependentVariable_ +
+                            this->coefficients_.denseOutputCCoefficients( stage ) * denseOutputStepSize_,
+                            intermediateState ) );
+        }
+    }
+
+    StateType interpolatedState( denseOutputStartState_ );
+    for ( int stage = 0; stage < this->coefficients_.denseOutputCoefficients.rows( ); stage++ )
+    {
+        // Evaluate weight polynomial b_i( theta ) = sum_k beta_ik theta^( k + 1 ) using Horner's scheme.
+        double stageWeight = 0.0;
+        for( int power = this->coefficients_.denseOutputCoefficients.cols( ) - 1; power >= 0; power-- )
+        {
+            stageWeight = ( stageWeight + this->coefficients_.denseOutputCoefficients( stage, power ) ) * stepFraction;
+        }
+        interpolatedState += denseOutputStepSize_ * stageWeight * denseOutputStateDerivatives_[ stage ];
+    }
+    return interpolatedState;
+}
+
 //! Compute the next step size and validate the result.
 template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
 bool
@@ -512,6 +512,39 @@ extern template class LagrangeInterpolator< double, Eigen::MatrixXd >;
 //! Typedef for LagrangeInterpolator with double as both its dependent and independent data type.
 typedef LagrangeInterpolator< double, double > LagrangeInterpolatorDouble;
 
+//! Function to create a copy of a Lagrange interpolator that can be used independently of the original
+/*!
+ *  Function to create a copy of a Lagrange interpolator, with identical data and settings, that can be used independently
+ *  of the original. Since an interpolator stores its look-up state and intermediate results, a single interpolator may not
+ *  be used from multiple threads at once; a copy created by this function can be used concurrently with the original.
+ *  \param interpolator Interpolator that is to be copied (must be a LagrangeInterpolator)
+ *  \return Copy of the interpolator (nullptr if input is nullptr)
+ */
+template< typename IndependentVariableType, typename DependentVariableType,
+          typename ScalarType = typename scalar_type< IndependentVariableType >::value_type >
+std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > > createIndependentLagrangeInterpolatorCopy(
+        const std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > > interpolator )
+{
+    if( interpolator == nullptr )
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr< LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType > > lagrangeInterpolator =
+            std::dynamic_pointer_cast< LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType > >(
+                interpolator );
+    if( lagrangeInterpolator == nullptr )
+    {
+        throw std::runtime_error( "Error when copying interpolator, only Lagrange interpolators can be copied." );
+    }
+
+    return std::make_shared< LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType > >(
+                lagrangeInterpolator->getIndependentValues( ), lagrangeInterpolator->getDependentValues( ),
+                lagrangeInterpolator->getNumberOfStages( ), lagrangeInterpolator->getSelectedLookupScheme( ),
+                lagrangeInterpolator->getLagrangeBoundaryHandling( ), lagrangeInterpolator->getBoundaryHandling( ),
+                lagrangeInterpolator->getDefaultExtrapolationValue( ) );
+}
+
 } // namespace interpolators
 
 } // namespace tudat
@@ -45,6 +45,7 @@
 #include "tudat/astro/system_models/vehicleSystems.h"
 #include "tudat/basics/basicTypedefs.h"
 #include "tudat/math/basic/numericalDerivative.h"
+#include "tudat/simulation/environment_setup/ephemerisStateCache.h"
 
 namespace tudat {
 
@@ -651,13 +652,13 @@ public:
                 if (sizeof(StateScalarType) == 8)
                 {
                     currentState_ =
-                            (bodyEphemeris_->getTemplatedStateFromEphemeris<StateScalarType, TimeType>(time) + ephemerisFrameToBaseFrame_->getBaseFrameState<TimeType, StateScalarType>(time)).template cast<double>();
+                            (ephemerisStateCache_.getStateFromEphemeris<StateScalarType, TimeType>(bodyEphemeris_, time) + ephemerisFrameToBaseFrame_->getBaseFrameState<TimeType, StateScalarType>(time)).template cast<double>();
                     currentLongState_ = currentState_.template cast<long double>();
                 }
                 else
                 {
                     currentLongState_ =
-                            (bodyEphemeris_->getTemplatedStateFromEphemeris<StateScalarType, TimeType>(time) + ephemerisFrameToBaseFrame_->getBaseFrameState<TimeType, StateScalarType>(time) ).template cast<long double>();
+                            (ephemerisStateCache_.getStateFromEphemeris<StateScalarType, TimeType>(bodyEphemeris_, time) + ephemerisFrameToBaseFrame_->getBaseFrameState<TimeType, StateScalarType>(time) ).template cast<long double>();
                     currentState_ = currentLongState_.template cast<double>();
                 }
             }
@@ -740,6 +741,43 @@ public:
         }
     }
 
+    //! Templated function to get the state of the body w.r.t. its ephemeris origin from its ephemeris.
+    /*!
+     * Templated function to get the state of the body w.r.t. its ephemeris origin (in the frame of its ephemeris) from
+     * its ephemeris, through the ephemeris state cache of the body. Unlike the getStateInBaseFrameFromEphemeris function,
+     * this function does not modify the current state of the body.
+     * \param time Time at which to evaluate state.
+     * \return State w.r.t. ephemeris origin at requested time
+     */
+    template<typename StateScalarType = double, typename TimeType = double>
+    Eigen::Matrix<StateScalarType, 6, 1> getStateInEphemerisFrameFromEphemeris(const TimeType time)
+    {
+        if( bodyEphemeris_ == nullptr )
+        {
+            throw std::runtime_error( "Error when requesting state from ephemeris of body " + bodyName_ + ", body has no ephemeris" );
+        }
+        return ephemerisStateCache_.getStateFromEphemeris<StateScalarType, TimeType>(bodyEphemeris_, time);
+    }
+
+    //! Function to get the rotation from global to body-fixed frame from the rotational ephemeris.
+    /*!
+     * Function to get the rotation from global to body-fixed frame from the rotational ephemeris, through the ephemeris
+     * state cache of the body. Unlike the setCurrentRotationToLocalFrameFromEphemeris function, this function does not
+     * modify the current rotation of the body.
+     * \param time Time at which to evaluate rotation.
+     * \return Rotation from global to body-fixed frame at requested time
+     */
+    template< typename TimeType = double >
+    Eigen::Quaterniond getRotationToLocalFrameFromEphemeris( const TimeType time )
+    {
+        if( rotationalEphemeris_ == nullptr )
+        {
+            throw std::runtime_error( "Error when requesting rotation from rotational ephemeris of body " + bodyName_ +
+                                      ", body has no rotational ephemeris" );
+        }
+        return ephemerisStateCache_.getRotationToLocalFrameFromEphemeris< TimeType >( rotationalEphemeris_, time );
+    }
+
     //! Get current rotational state.
     /*!
      * Returns the internally stored current rotational state vector.
@@ -859,7 +897,8 @@ public:
     {
         if( rotationalEphemeris_!= nullptr )
         {
-            currentRotationToLocalFrame_ = rotationalEphemeris_->getRotationToTargetFrame( time );
+            currentRotationToLocalFrame_ = ephemerisStateCache_.getRotationToLocalFrameFromEphemeris< double >(
+                        rotationalEphemeris_, time );
         }
 //        else if( dependentOrientationCalculator_ != nullptr )
 //        {
@@ -886,8 +925,8 @@ public:
     {
         if( rotationalEphemeris_ != nullptr )
         {
-            rotationalEphemeris_->getFullRotationalQuantitiesToTargetFrameTemplated< TimeType >(
-                        currentRotationToLocalFrame_, currentRotationToLocalFrameDerivative_,
+            ephemerisStateCache_.getRotationalStateFromEphemeris< TimeType >(
+                        rotationalEphemeris_, currentRotationToLocalFrame_, currentRotationToLocalFrameDerivative_,
                         currentAngularVelocityVectorInGlobalFrame_, time );
             currentAngularVelocityVectorInLocalFrame_ = currentRotationToLocalFrame_ * currentAngularVelocityVectorInGlobalFrame_;
         }
@@ -1127,6 +1166,7 @@ public:
     void setEphemeris( const std::shared_ptr< ephemerides::Ephemeris > bodyEphemeris )
     {
         bodyEphemeris_ = bodyEphemeris;
+        ephemerisStateCache_.resetEphemeris( bodyEphemeris_ );
     }
 
     //! Function to set the gravity field of the body.
@@ -1173,6 +1213,7 @@ public:
 //            std::cerr << "Warning when setting rotational ephemeris, dependentOrientationCalculator_ already found, NOT setting closure" << std::endl;
 //        }
         rotationalEphemeris_ = rotationalEphemeris;
+        ephemerisStateCache_.resetRotationalEphemeris( rotationalEphemeris_ );
     }
 
     //! Function to set the shape model of the body.
@@ -1697,6 +1738,29 @@ public:
         timeOfCurrentState_ = Time(TUDAT_NAN);
     }
 
+    //! Function to set the cache that defines the validity of the ephemeris state cache entries of all bodies
+    /*!
+     * Function to set the cache that defines the validity of the ephemeris state cache entries of all bodies in the
+     * system of bodies of which this body is a member (called when adding the body to a SystemOfBodies).
+     * \param systemCache Cache defining the validity of the ephemeris state cache entries of all bodies
+     */
+    void setEphemerisStateCache( const std::shared_ptr< EphemerisStateCache > systemCache )
+    {
+        ephemerisStateCache_.setSystemCache( systemCache );
+    }
+
+    //! Function to retrieve the statistics of the use of the ephemeris state cache of this body
+    const EphemerisCacheStatistics& getEphemerisCacheStatistics( ) const
+    {
+        return ephemerisStateCache_.getStatistics( );
+    }
+
+    //! Function to reset the statistics of the use of the ephemeris state cache of this body to zero
+    void resetEphemerisCacheStatistics( )
+    {
+        ephemerisStateCache_.resetStatistics( );
+    }
+
     double getDoubleTimeOfCurrentState( )
     {
         return static_cast< double >( timeOfCurrentState_ );
@@ -1808,6 +1872,9 @@ private:
     //! Rotation model of body.
     std::shared_ptr<ephemerides::RotationalEphemeris> rotationalEphemeris_;
 
+    //! Cache of the most recent state and rotation computed from the ephemeris and rotation model of the body
+    BodyEphemerisStateCache ephemerisStateCache_;
+
     std::vector< std::shared_ptr< basic_astrodynamics::BodyDeformationModel > > bodyDeformationModels_;
 
     std::shared_ptr< RigidBodyProperties > massProperties_;
@@ -1964,13 +2031,30 @@ void setGlobalFrameBodyEphemerides( const std::unordered_map< std::string, std::
                     // Set barycentric state function of global frame origin
                     if( globalFrameOrigin == bodyIterator.first )
                     {
-                        std::shared_ptr< ephemerides::ReferenceFrameManager > frameManager =
-                                createFrameManager( bodies );
-                        frameManager->getEphemeris( globalFrameOrigin, "SSB" );
+                        // Sum the states along the chain of ephemeris origins, retrieving each through the
+                        // ephemeris state cache of the associated body
+                        Body* globalFrameOriginBody = bodyIterator.second.get( );
+                        std::vector< Body* > originChainBodies;
+                        for( unsigned int i = 0; i < globalFrameOriginChain.size( ); i++ )
+                        {
+                            if( globalFrameOriginChain.at( i ) != "SSB" )
+                            {
+                                originChainBodies.push_back( bodies.at( globalFrameOriginChain.at( i ) ).get( ) );
+                            }
+                        }
 
                         std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
-                                std::bind( &ephemerides::Ephemeris::getTemplatedStateFromEphemeris< StateScalarType, TimeType >,
-                                           frameManager->getEphemeris( globalFrameOrigin, "SSB" ), std::placeholders::_1 );
+                                [ = ]( const TimeType time )
+                        {
+                            Eigen::Matrix< StateScalarType, 6, 1 > barycentricState =
+                                    globalFrameOriginBody->getStateInEphemerisFrameFromEphemeris< StateScalarType, TimeType >( time );
+                            for( unsigned int i = 0; i < originChainBodies.size( ); i++ )
+                            {
+                                barycentricState += originChainBodies.at( i )->
+                                        getStateInEphemerisFrameFromEphemeris< StateScalarType, TimeType >( time );
+                            }
+                            return barycentricState;
+                        };
 
                         std::shared_ptr< BaseStateInterface > baseStateInterface =
                                 std::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
@@ -2095,7 +2179,14 @@ public:
     SystemOfBodies( const std::string frameOrigin = "SSB", const std::string frameOrientation = "ECLIPJ2000",
                     const std::unordered_map< std::string, std::shared_ptr< Body > >& bodyMap =
             std::unordered_map< std::string, std::shared_ptr< Body > >( ) ):
-        frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation ), bodyMap_( bodyMap ){ }
+        frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation ), bodyMap_( bodyMap ),
+        ephemerisStateCache_( std::make_shared< EphemerisStateCache >( ) )
+    {
+        for( auto bodyIterator : bodyMap_ )
+        {
+            bodyIterator.second->setEphemerisStateCache( ephemerisStateCache_ );
+        }
+    }
 
     std::shared_ptr< Body > at( const std::string& bodyName ) const
     {
@@ -2136,6 +2227,7 @@ public:
     {
         bodyMap_[ bodyName ] = std::make_shared< Body >( );
         bodyMap_[ bodyName ]->setBodyName( bodyName );
+        bodyMap_[ bodyName ]->setEphemerisStateCache( ephemerisStateCache_ );
         if( processBody )
         {
             processBodyFrameDefinitions< StateScalarType, TimeType >( );
@@ -2147,6 +2239,7 @@ public:
     {
         bodyMap_[ bodyName ] = bodyToAdd;
         bodyMap_[ bodyName ]->setBodyName( bodyName );
+        bodyMap_[ bodyName ]->setEphemerisStateCache( ephemerisStateCache_ );
         if( processBody )
         {
             processBodyFrameDefinitions< StateScalarType, TimeType >( );
@@ -2189,6 +2282,64 @@ public:
         bodyMap_.erase( bodyName );
 
     }
+
+    //! Function to invalidate the ephemeris state cache entries of all bodies, and start caching for a new stage
+    //! (called at the start of each evaluation of the state derivative)
+    void startEphemerisStateCacheStage( ) const
+    {
+        ephemerisStateCache_->startStage( );
+    }
+
+    //! Function to invalidate the ephemeris state cache entries of all bodies, and stop caching until the next stage
+    //! is started
+    void invalidateEphemerisStateCache( ) const
+    {
+        ephemerisStateCache_->invalidate( );
+    }
+
+    //! Function to retrieve the cache defining the validity of the ephemeris state cache entries of all bodies
+    std::shared_ptr< EphemerisStateCache > getEphemerisStateCache( ) const
+    {
+        return ephemerisStateCache_;
+    }
+
+    //! Function to set whether the ephemeris states and rotations of the bodies are cached during each stage
+    void setIsEphemerisStateCacheEnabled( const bool isCacheEnabled ) const
+    {
+        ephemerisStateCache_->setIsCacheEnabled( isCacheEnabled );
+    }
+
+    //! Function to retrieve the statistics of the use of the ephemeris state cache of each body
+    std::map< std::string, EphemerisCacheStatistics > getEphemerisCacheStatistics( ) const
+    {
+        std::map< std::string, EphemerisCacheStatistics > cacheStatistics;
+        for( auto bodyIterator : bodyMap_ )
+        {
+            cacheStatistics[ bodyIterator.first ] = bodyIterator.second->getEphemerisCacheStatistics( );
+        }
+        return cacheStatistics;
+    }
+
+    //! Function to retrieve the statistics of the use of the ephemeris state caches of all bodies combined
+    EphemerisCacheStatistics getTotalEphemerisCacheStatistics( ) const
+    {
+        EphemerisCacheStatistics totalStatistics;
+        for( auto bodyIterator : bodyMap_ )
+        {
+            totalStatistics += bodyIterator.second->getEphemerisCacheStatistics( );
+        }
+        return totalStatistics;
+    }
+
+    //! Function to reset the statistics of the use of the ephemeris state caches of all bodies to zero
+    void resetEphemerisCacheStatistics( ) const
+    {
+        for( auto bodyIterator : bodyMap_ )
+        {
+            bodyIterator.second->resetEphemerisCacheStatistics( );
+        }
+    }
+
 private:
 
     std::string frameOrigin_;
@@ -2197,6 +2348,10 @@ private:
 
     std::unordered_map< std::string, std::shared_ptr< Body > > bodyMap_;
 
+    //! Cache defining the validity of the ephemeris state cache entries of all bodies (shared by all copies of this
+    //! object)
+    std::shared_ptr< EphemerisStateCache > ephemerisStateCache_;
+
 };
 
 double getBodyGravitationalParameter( const SystemOfBodies& bodies, const std::string bodyName );
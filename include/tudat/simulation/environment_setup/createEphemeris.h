@@ -27,6 +27,8 @@
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositionsCircularCoplanar.h"
 #include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/nativeSpiceEphemeris.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
 #include "tudat/math/interpolators/createInterpolator.h"
 #include "tudat/interface/spice/spiceInterface.h"
 #include "tudat/interface/spice/spiceEphemeris.h"
@@ -55,7 +57,9 @@ enum EphemerisType
     custom_ephemeris,
     direct_tle_ephemeris,
     interpolated_tle_ephemeris,
-    scaled_ephemeris
+    scaled_ephemeris,
+    native_spice_ephemeris,
+    chebyshev_ephemeris
 };
 
 // Class for providing settings for ephemeris model.
@@ -398,6 +402,53 @@ private:
     std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
 };
 
+// EphemerisSettings derived class for defining settings of an ephemeris read directly from SPK kernels.
+/*
+ *  EphemerisSettings derived class for defining settings of an ephemeris read directly from SPK kernels, without use of
+ *  the CSPICE library (see NativeSpiceEphemeris). The kernel files are memory-mapped and evaluated by a native reader,
+ *  which is thread-safe and avoids the per-call overhead of CSPICE. Only SPK segment types 1, 2, 3, 13 and 21 are
+ *  supported, states are geometric (no aberration corrections), and the frame orientation must be J2000 or ECLIPJ2000.
+ *  Body names are converted to NAIF codes (using Spice) only when the ephemeris is created.
+ */
+//! @get_docstring(NativeSpiceEphemerisSettings.__docstring__)
+class NativeSpiceEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    // Constructor.
+    /*
+     *  Constructor.
+     *  \param kernelFiles Names of the SPK kernel files, in order of increasing priority
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  \param frameOrientation Orientation of the reference frame in which the ephemeris is to be calculated
+     *  \param bodyNameOverride Name (or NAIF code) of the body in the kernels, if different from the body name in the
+     *  environment
+     */
+    NativeSpiceEphemerisSettings( const std::vector< std::string >& kernelFiles,
+                                  const std::string frameOrigin = "SSB",
+                                  const std::string frameOrientation = "ECLIPJ2000",
+                                  const std::string bodyNameOverride = "" ):
+        EphemerisSettings( native_spice_ephemeris, frameOrigin, frameOrientation ),
+        kernelFiles_( kernelFiles ), bodyNameOverride_( bodyNameOverride ){ }
+
+    // Destructor
+    virtual ~NativeSpiceEphemerisSettings( ){ }
+
+    // Function to return the names of the SPK kernel files, in order of increasing priority
+    std::vector< std::string > getKernelFiles( ){ return kernelFiles_; }
+
+    // Function to return the name (or NAIF code) of the body in the kernels, if different from the body name
+    std::string getBodyNameOverride( ){ return bodyNameOverride_; }
+
+protected:
+
+    // Names of the SPK kernel files, in order of increasing priority
+    std::vector< std::string > kernelFiles_;
+
+    // Name (or NAIF code) of the body in the kernels, if different from the body name in the environment
+    std::string bodyNameOverride_;
+};
+
 // EphemerisSettings derived class for defining settings of an approximate ephemeris for major
 // planets.
 /*
@@ -689,6 +740,114 @@ private:
     std::map< double, Eigen::Vector6d > bodyStateHistory_;
 };
 
+// EphemerisSettings derived class for defining settings of an ephemeris represented by Chebyshev polynomial granules.
+/*
+ *  EphemerisSettings derived class for defining settings of an ephemeris represented by Chebyshev polynomial granules
+ *  (see ChebyshevEphemeris). The granules are either fitted (with adaptive length) to a state history, such as the
+ *  results of a numerical propagation, or read from a binary file written by writeChebyshevEphemerisToFile. Compared to
+ *  a tabulated ephemeris, the memory use is typically orders of magnitude smaller, and velocities are the exact
+ *  derivatives of the positions. Once the ephemeris has been fitted, the state history is released from these settings,
+ *  and only the fitted granules are retained (and reused if the settings are used to create another ephemeris).
+ */
+//! @get_docstring(ChebyshevEphemerisSettings.__docstring__)
+class ChebyshevEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    // Constructor, for an ephemeris fitted to a state history.
+    /*
+     *  Constructor, for an ephemeris fitted to a state history.
+     *  \param bodyStateHistory Data map (time as key, Cartesian state as values) to which the ephemeris is to be fitted
+     *  \param positionTolerance Maximum position residual of the fit at the states of the history
+     *  \param velocityTolerance Maximum velocity residual of the fit at the states of the history (not checked if NaN)
+     *  \param polynomialDegree Degree of the Chebyshev polynomials of each granule
+     *  \param maximumGranuleDuration Maximum duration of a single granule (no maximum if NaN)
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  \param frameOrientation Orientation of the reference frame in which the ephemeris is to be calculated
+     */
+    ChebyshevEphemerisSettings(
+            const std::map< double, Eigen::Vector6d >& bodyStateHistory,
+            const double positionTolerance,
+            const double velocityTolerance = TUDAT_NAN,
+            const int polynomialDegree = 13,
+            const double maximumGranuleDuration = TUDAT_NAN,
+            const std::string frameOrigin = "SSB",
+            const std::string frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        bodyStateHistory_( bodyStateHistory ), positionTolerance_( positionTolerance ),
+        velocityTolerance_( velocityTolerance ), polynomialDegree_( polynomialDegree ),
+        maximumGranuleDuration_( maximumGranuleDuration ), fileName_( "" ){ }
+
+    // Constructor, for an ephemeris read from file.
+    /*
+     *  Constructor, for an ephemeris read from file.
+     *  \param fileName Name of the file (written by writeChebyshevEphemerisToFile) from which the ephemeris is read
+     *  \param frameOrigin Name of body relative to which the ephemeris is defined (checked against file contents)
+     *  \param frameOrientation Orientation of the frame in which the ephemeris is defined (checked against file contents)
+     */
+    ChebyshevEphemerisSettings(
+            const std::string& fileName,
+            const std::string frameOrigin = "SSB",
+            const std::string frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        positionTolerance_( TUDAT_NAN ), velocityTolerance_( TUDAT_NAN ), polynomialDegree_( 0 ),
+        maximumGranuleDuration_( TUDAT_NAN ), fileName_( fileName ){ }
+
+    // Destructor
+    virtual ~ChebyshevEphemerisSettings( ){ }
+
+    // Function returning data map to which the ephemeris is to be fitted (empty if read from file, or once fitted)
+    const std::map< double, Eigen::Vector6d >& getBodyStateHistory( ){ return bodyStateHistory_; }
+
+    // Function returning the ephemeris fitted to the state history (nullptr if not yet fitted, or read from file)
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > getFittedEphemeris( ){ return fittedEphemeris_; }
+
+    // Function to set the ephemeris fitted to the state history, releasing the memory of the state history
+    void setFittedEphemeris( const std::shared_ptr< ephemerides::ChebyshevEphemeris > fittedEphemeris )
+    {
+        fittedEphemeris_ = fittedEphemeris;
+        std::map< double, Eigen::Vector6d >( ).swap( bodyStateHistory_ );
+    }
+
+    // Function returning maximum position residual of the fit
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    // Function returning maximum velocity residual of the fit
+    double getVelocityTolerance( ){ return velocityTolerance_; }
+
+    // Function returning degree of the Chebyshev polynomials of each granule
+    int getPolynomialDegree( ){ return polynomialDegree_; }
+
+    // Function returning maximum duration of a single granule
+    double getMaximumGranuleDuration( ){ return maximumGranuleDuration_; }
+
+    // Function returning name of the file from which the ephemeris is read (empty if fitted to a state history)
+    std::string getFileName( ){ return fileName_; }
+
+protected:
+
+    // Data map (time as key, Cartesian state as values) to which the ephemeris is to be fitted
+    std::map< double, Eigen::Vector6d > bodyStateHistory_;
+
+    // Maximum position residual of the fit at the states of the history
+    double positionTolerance_;
+
+    // Maximum velocity residual of the fit at the states of the history (not checked if NaN)
+    double velocityTolerance_;
+
+    // Degree of the Chebyshev polynomials of each granule
+    int polynomialDegree_;
+
+    // Maximum duration of a single granule (no maximum if NaN)
+    double maximumGranuleDuration_;
+
+    // Name of the file from which the ephemeris is read (empty if fitted to a state history)
+    std::string fileName_;
+
+    // Ephemeris fitted to the state history (nullptr if not yet fitted, or read from file)
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > fittedEphemeris_;
+};
+
 class AutoGeneratedTabulatedEphemerisSettings: public EphemerisSettings
 {
 public:
@@ -982,6 +1141,17 @@ inline std::shared_ptr< EphemerisSettings > directSpiceEphemerisSettings(
             frameOrigin, frameOrientation, bodyNameOverride);
 }
 
+//! @get_docstring(nativeSpiceEphemerisSettings)
+inline std::shared_ptr< EphemerisSettings > nativeSpiceEphemerisSettings(
+        const std::vector< std::string >& kernelFiles,
+        const std::string frameOrigin = "SSB",
+        const std::string frameOrientation = "ECLIPJ2000",
+        const std::string bodyNameOverride = "" )
+{
+    return std::make_shared< NativeSpiceEphemerisSettings >(
+            kernelFiles, frameOrigin, frameOrientation, bodyNameOverride );
+}
+
 //! @get_docstring(interpolatedSpiceEphemerisSettings)
 inline std::shared_ptr< EphemerisSettings > interpolatedSpiceEphemerisSettings(
 		double initialTime,
@@ -1020,6 +1190,31 @@ inline std::shared_ptr< EphemerisSettings > tabulatedEphemerisSettings(
             ephemerisSettings, startTime, endTime, timeStep, interpolatorSettings );
 }
 
+//! @get_docstring(chebyshevEphemerisSettings)
+inline std::shared_ptr< EphemerisSettings > chebyshevEphemerisSettings(
+        const std::map< double, Eigen::Vector6d >& bodyStateHistory,
+        const double positionTolerance,
+        const double velocityTolerance = TUDAT_NAN,
+        const int polynomialDegree = 13,
+        const double maximumGranuleDuration = TUDAT_NAN,
+        const std::string frameOrigin = "SSB",
+        const std::string frameOrientation = "ECLIPJ2000" )
+{
+    return std::make_shared< ChebyshevEphemerisSettings >(
+            bodyStateHistory, positionTolerance, velocityTolerance, polynomialDegree, maximumGranuleDuration,
+            frameOrigin, frameOrientation );
+}
+
+//! @get_docstring(chebyshevEphemerisFromFileSettings)
+inline std::shared_ptr< EphemerisSettings > chebyshevEphemerisFromFileSettings(
+        const std::string& fileName,
+        const std::string frameOrigin = "SSB",
+        const std::string frameOrientation = "ECLIPJ2000" )
+{
+    return std::make_shared< ChebyshevEphemerisSettings >(
+            fileName, frameOrigin, frameOrientation );
+}
+
 //! @get_docstring(constantEphemerisSettings)
 inline std::shared_ptr< EphemerisSettings > constantEphemerisSettings(
 		const Eigen::Vector6d& constantState,
@@ -1149,6 +1344,31 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case native_spice_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< NativeSpiceEphemerisSettings > nativeEphemerisSettings =
+                    std::dynamic_pointer_cast< NativeSpiceEphemerisSettings >( ephemerisSettings );
+            if( nativeEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error(
+                            "Error, expected native spice ephemeris settings for body " + bodyName );
+            }
+            else
+            {
+                std::string inputName = ( nativeEphemerisSettings->getBodyNameOverride( ) == "" ) ?
+                            bodyName : nativeEphemerisSettings->getBodyNameOverride( );
+
+                // Create corresponding ephemeris object, with NAIF codes retrieved once, here.
+                ephemeris = std::make_shared< NativeSpiceEphemeris >(
+                            input_output::getSpiceKernelCollection( nativeEphemerisSettings->getKernelFiles( ) ),
+                            spice_interface::getSpkBodyIdFromName( inputName ),
+                            spice_interface::getSpkBodyIdFromName( nativeEphemerisSettings->getFrameOrigin( ) ),
+                            nativeEphemerisSettings->getFrameOrigin( ),
+                            nativeEphemerisSettings->getFrameOrientation( ) );
+            }
+            break;
+        }
         case interpolated_spice:
         {
             // Check consistency of type and class.
@@ -1225,6 +1445,58 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case chebyshev_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings =
+                    std::dynamic_pointer_cast< ChebyshevEphemerisSettings >( ephemerisSettings );
+            if( chebyshevEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error(
+                            "Error, expected Chebyshev ephemeris settings for body " + bodyName );
+            }
+            else if( chebyshevEphemerisSettings->getFileName( ) != "" )
+            {
+                std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris =
+                        readChebyshevEphemerisFromFile( chebyshevEphemerisSettings->getFileName( ) );
+                if( chebyshevEphemeris->getReferenceFrameOrigin( ) != chebyshevEphemerisSettings->getFrameOrigin( ) ||
+                        chebyshevEphemeris->getReferenceFrameOrientation( ) !=
+                        chebyshevEphemerisSettings->getFrameOrientation( ) )
+                {
+                    throw std::runtime_error(
+                                "Error when creating Chebyshev ephemeris for body " + bodyName + ", frame " +
+                                chebyshevEphemeris->getReferenceFrameOrigin( ) + "/" +
+                                chebyshevEphemeris->getReferenceFrameOrientation( ) + " in file " +
+                                chebyshevEphemerisSettings->getFileName( ) + " is inconsistent with settings (" +
+                                chebyshevEphemerisSettings->getFrameOrigin( ) + "/" +
+                                chebyshevEphemerisSettings->getFrameOrientation( ) + ")" );
+                }
+                ephemeris = chebyshevEphemeris;
+            }
+            else if( chebyshevEphemerisSettings->getFittedEphemeris( ) != nullptr )
+            {
+                // Reuse granules fitted when these settings were used before
+                std::shared_ptr< ChebyshevEphemeris > fittedEphemeris = chebyshevEphemerisSettings->getFittedEphemeris( );
+                ephemeris = std::make_shared< ChebyshevEphemeris >(
+                            fittedEphemeris->getGranuleBoundaries( ), fittedEphemeris->getGranuleCoefficients( ),
+                            fittedEphemeris->getPolynomialDegree( ), chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ) );
+            }
+            else
+            {
+                std::shared_ptr< ChebyshevEphemeris > fittedEphemeris = createChebyshevEphemerisFromStateHistory(
+                            chebyshevEphemerisSettings->getBodyStateHistory( ),
+                            chebyshevEphemerisSettings->getPositionTolerance( ),
+                            chebyshevEphemerisSettings->getVelocityTolerance( ),
+                            chebyshevEphemerisSettings->getPolynomialDegree( ),
+                            chebyshevEphemerisSettings->getMaximumGranuleDuration( ),
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ) );
+                chebyshevEphemerisSettings->setFittedEphemeris( fittedEphemeris );
+                ephemeris = fittedEphemeris;
+            }
+            break;
+        }
         case auto_generated_tabulated_ephemeris:
         {
             // Check consistency of type and class.
@@ -24,6 +24,7 @@
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
 #include "tudat/astro/gravitation/gravityFieldVariations.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
 #include "tudat/astro/gravitation/ringGravityField.h"
 
 namespace tudat
@@ -315,7 +316,10 @@ public:
         verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         associatedReferenceFrame_( associatedReferenceFrame ),
-        gravitationalConstant_( gravitationalConstant )
+        gravitationalConstant_( gravitationalConstant ),
+        exteriorSphericalHarmonicsDegree_( -1 ),
+        brillouinSphereMargin_( 0.1 ),
+        switchLayerWidth_( 0.2 )
     {
         volume_ = basic_astrodynamics::computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
         gravitationalParameter_ = gravitationalConstant_ * density_ * volume_;
@@ -341,7 +345,10 @@ public:
         verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         associatedReferenceFrame_( associatedReferenceFrame ),
-        gravitationalConstant_( gravitationalConstant )
+        gravitationalConstant_( gravitationalConstant ),
+        exteriorSphericalHarmonicsDegree_( -1 ),
+        brillouinSphereMargin_( 0.1 ),
+        switchLayerWidth_( 0.2 )
     {
         volume_ = basic_astrodynamics::computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
         density_ = gravitationalParameter_ / ( gravitationalConstant_ * volume_ );
@@ -396,6 +403,35 @@ public:
     void resetVerticesDefiningEachFacet ( const Eigen::MatrixXi& verticesDefiningEachFacet )
     { verticesDefiningEachFacet_ = verticesDefiningEachFacet; }
 
+    /*! Function to set an equivalent exterior spherical harmonic expansion, to be used far from the polyhedron.
+     *
+     * Function to set an equivalent exterior spherical harmonic expansion, to be used far from the polyhedron (see
+     * HybridPolyhedronGravityField). A negative maximum degree disables the exterior expansion.
+     * @param maximumDegree Maximum degree (and order) of the exterior spherical harmonic expansion.
+     * @param brillouinSphereMargin Relative margin w.r.t. the brillouin radius, inside of which only the polyhedron is used.
+     * @param switchLayerWidth Relative width of the layer in which polyhedron and spherical harmonics are combined.
+     */
+    void setExteriorSphericalHarmonicExpansion( const int maximumDegree,
+                                                const double brillouinSphereMargin = 0.1,
+                                                const double switchLayerWidth = 0.2 )
+    {
+        exteriorSphericalHarmonicsDegree_ = maximumDegree;
+        brillouinSphereMargin_ = brillouinSphereMargin;
+        switchLayerWidth_ = switchLayerWidth;
+    }
+
+    //! Function to return the maximum degree of the exterior spherical harmonic expansion (negative if not used).
+    int getExteriorSphericalHarmonicsDegree( )
+    { return exteriorSphericalHarmonicsDegree_; }
+
+    //! Function to return the relative margin w.r.t. the brillouin radius inside of which only the polyhedron is used.
+    double getBrillouinSphereMargin( )
+    { return brillouinSphereMargin_; }
+
+    //! Function to return the relative width of the layer in which polyhedron and spherical harmonics are combined.
+    double getSwitchLayerWidth( )
+    { return switchLayerWidth_; }
+
 protected:
 
     // Gravitational parameter
@@ -417,6 +453,15 @@ protected:
 
     double volume_;
 
+    // Maximum degree of the exterior spherical harmonic expansion (negative if not used).
+    int exteriorSphericalHarmonicsDegree_;
+
+    // Relative margin w.r.t. the brillouin radius inside of which only the polyhedron is used.
+    double brillouinSphereMargin_;
+
+    // Relative width of the layer in which polyhedron and spherical harmonics are combined.
+    double switchLayerWidth_;
+
 };
 
 // Derived class of GravityFieldSettings defining settings of polyhedron gravity
@@ -824,6 +869,25 @@ inline std::shared_ptr< GravityFieldSettings > polyhedronGravitySettingsFromMu(
             gravitationalConstant );
 }
 
+inline std::shared_ptr< GravityFieldSettings > hybridPolyhedronGravitySettings(
+        const double density,
+        const Eigen::MatrixXd verticesCoordinates,
+        const Eigen::MatrixXi verticesDefiningEachFacet,
+        const std::string& associatedReferenceFrame,
+        const int exteriorSphericalHarmonicsDegree,
+        const double brillouinSphereMargin = 0.1,
+        const double switchLayerWidth = 0.2,
+        const double gravitationalConstant = physical_constants::GRAVITATIONAL_CONSTANT )
+{
+    std::shared_ptr< PolyhedronGravityFieldSettings > polyhedronSettings =
+            std::make_shared< PolyhedronGravityFieldSettings >(
+                gravitationalConstant, density, verticesCoordinates,
+                verticesDefiningEachFacet, associatedReferenceFrame );
+    polyhedronSettings->setExteriorSphericalHarmonicExpansion(
+                exteriorSphericalHarmonicsDegree, brillouinSphereMargin, switchLayerWidth );
+    return polyhedronSettings;
+}
+
 inline std::shared_ptr< GravityFieldSettings > ringGravitySettings(
         const double gravitationalParameter,
         const double ringRadius,
@@ -50,7 +50,9 @@ enum RotationModelType
     pitch_trim_rotation_model,
     body_fixed_direction_based_rotation_model,
     orbital_state_based_rotation_model,
-    custom_rotation_model
+    custom_rotation_model,
+    native_spice_rotation_model,
+    precomputed_rotation_model
 };
 
 //Class for providing settings for rotation model.
@@ -161,6 +163,165 @@ private:
 };
 
 
+//RotationModelSettings derived class for defining settings of a rotation model read directly from binary PCK kernels.
+/*
+ *  RotationModelSettings derived class for defining settings of a rotation model read directly from binary PCK kernels,
+ *  without use of the CSPICE library (see NativeSpiceRotationalEphemeris). Only binary PCK segment type 2 is supported,
+ *  and the original frame must be J2000 or ECLIPJ2000.
+ */
+class NativeSpiceRotationModelSettings: public RotationModelSettings
+{
+public:
+
+    //Constructor
+    /*
+     *  Constructor
+     *  \param kernelFiles Names of the binary PCK kernel files, in order of increasing priority
+     *  \param originalFrame Base frame of rotation model (J2000 or ECLIPJ2000)
+     *  \param targetFrame Target frame of rotation model
+     *  \param pckFrameName Name of the PCK frame (e.g. ITRF93), or the NAIF code of its frame class, in the kernels
+     *  (equal to targetFrame if empty)
+     */
+    NativeSpiceRotationModelSettings( const std::vector< std::string >& kernelFiles,
+                                      const std::string& originalFrame,
+                                      const std::string& targetFrame,
+                                      const std::string& pckFrameName = "" ):
+        RotationModelSettings( native_spice_rotation_model, originalFrame, targetFrame ),
+        kernelFiles_( kernelFiles ),
+        pckFrameName_( ( pckFrameName != "" ) ? pckFrameName : targetFrame ){ }
+
+    std::vector< std::string > getKernelFiles( )
+    {
+        return kernelFiles_;
+    }
+
+    std::string getPckFrameName( )
+    {
+        return pckFrameName_;
+    }
+
+private:
+
+    //Names of the binary PCK kernel files, in order of increasing priority
+    std::vector< std::string > kernelFiles_;
+
+    //Name of the PCK frame, or the NAIF code of its frame class, in the kernels
+    std::string pckFrameName_;
+
+};
+
+//RotationModelSettings derived class for defining settings of a rotation model tabulated from another rotation model.
+/*
+ *  RotationModelSettings derived class for defining settings of a rotation model that is precomputed on a regular time
+ *  grid from an (computationally expensive) underlying rotation model, typically the GCRS<->ITRS model, and evaluated
+ *  by Hermite interpolation (see PrecomputedRotationalEphemeris). The underlying model must depend on time only.
+ */
+class PrecomputedRotationModelSettings: public RotationModelSettings
+{
+public:
+
+    //Constructor
+    /*
+     *  Constructor
+     *  \param underlyingRotationModelSettings Settings of the rotation model from which the table is computed
+     *  \param startTime Start time of the table
+     *  \param endTime End time of the table (table may extend up to one time step beyond it)
+     *  \param timeStep Time step of the table
+     *  \param maximumInterpolationError Maximum allowed interpolation error (rad), checked at creation (NaN: no check)
+     *  \param numberOfThreads Number of threads used to compute the table
+     *  \param cacheFile Name of file in which the table is stored, and from which it is loaded when consistent with
+     *  these settings, including all settings and input files of the underlying model (no file used if empty). A cache
+     *  file may only be used for simple, native SPICE and GCRS<->ITRS underlying rotation models.
+     *  \param nominalRotationRate Rate of the rotation about the target frame z-axis that is factored out before
+     *  interpolation (determined from the underlying model if NaN)
+     */
+    PrecomputedRotationModelSettings(
+            const std::shared_ptr< RotationModelSettings > underlyingRotationModelSettings,
+            const double startTime,
+            const double endTime,
+            const double timeStep = 3600.0,
+            const double maximumInterpolationError = 1.0E-10,
+            const unsigned int numberOfThreads = 1,
+            const std::string& cacheFile = "",
+            const double nominalRotationRate = TUDAT_NAN ):
+        RotationModelSettings( precomputed_rotation_model,
+                               underlyingRotationModelSettings->getOriginalFrame( ),
+                               underlyingRotationModelSettings->getTargetFrame( ) ),
+        underlyingRotationModelSettings_( underlyingRotationModelSettings ),
+        startTime_( startTime ), endTime_( endTime ), timeStep_( timeStep ),
+        maximumInterpolationError_( maximumInterpolationError ),
+        numberOfThreads_( numberOfThreads ),
+        cacheFile_( cacheFile ),
+        nominalRotationRate_( nominalRotationRate ){ }
+
+    std::shared_ptr< RotationModelSettings > getUnderlyingRotationModelSettings( )
+    {
+        return underlyingRotationModelSettings_;
+    }
+
+    double getStartTime( )
+    {
+        return startTime_;
+    }
+
+    double getEndTime( )
+    {
+        return endTime_;
+    }
+
+    double getTimeStep( )
+    {
+        return timeStep_;
+    }
+
+    double getMaximumInterpolationError( )
+    {
+        return maximumInterpolationError_;
+    }
+
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    std::string getCacheFile( )
+    {
+        return cacheFile_;
+    }
+
+    double getNominalRotationRate( )
+    {
+        return nominalRotationRate_;
+    }
+
+private:
+
+    //Settings of the rotation model from which the table is computed
+    std::shared_ptr< RotationModelSettings > underlyingRotationModelSettings_;
+
+    //Start time of the table
+    double startTime_;
+
+    //End time of the table
+    double endTime_;
+
+    //Time step of the table
+    double timeStep_;
+
+    //Maximum allowed interpolation error (rad)
+    double maximumInterpolationError_;
+
+    //Number of threads used to compute the table
+    unsigned int numberOfThreads_;
+
+    //Name of file in which the table is cached
+    std::string cacheFile_;
+
+    //Rate of the rotation about the target frame z-axis that is factored out before interpolation
+    double nominalRotationRate_;
+
+};
+
 //RotationModelSettings derived class for defining settings of a simple rotational ephemeris.
 class SimpleRotationModelSettings: public RotationModelSettings
 {
@@ -231,14 +392,25 @@ struct EopCorrectionSettings
      *  \param minimumAmplitude Minimum amplitude that is read from files and considered in calculations.
      *  \param amplitudesFiles List of files with amplitudes for corrections
      *  \param argumentMultipliersFile Fundamental argument multiplier for corrections
+     *  \param useIncrementalEvaluation Boolean denoting whether the corrections are evaluated incrementally for closely
+     *  spaced times (see ShortPeriodEarthOrientationCorrectionCalculator::setIncrementalEvaluation). This makes the
+     *  resulting rotation model stateful, so that it must not be evaluated from multiple threads concurrently.
+     *  \param maximumIncrementalTimeStep Maximum time difference w.r.t. previous call for which incremental evaluation is used
+     *  \param maximumNumberOfIncrementalSteps Maximum number of successive incremental evaluations
      */
     EopCorrectionSettings(
             const double conversionFactor,
             const double minimumAmplitude,
             const std::vector< std::string >& amplitudesFiles,
-            const std::vector< std::string >& argumentMultipliersFile ):
+            const std::vector< std::string >& argumentMultipliersFile,
+            const bool useIncrementalEvaluation = false,
+            const double maximumIncrementalTimeStep = 60.0,
+            const unsigned int maximumNumberOfIncrementalSteps = 100 ):
         conversionFactor_( conversionFactor ), minimumAmplitude_( minimumAmplitude ),
-        amplitudesFiles_( amplitudesFiles ), argumentMultipliersFile_( argumentMultipliersFile ){ }
+        amplitudesFiles_( amplitudesFiles ), argumentMultipliersFile_( argumentMultipliersFile ),
+        useIncrementalEvaluation_( useIncrementalEvaluation ),
+        maximumIncrementalTimeStep_( maximumIncrementalTimeStep ),
+        maximumNumberOfIncrementalSteps_( maximumNumberOfIncrementalSteps ){ }
 
     //Conversion factor to be used for amplitudes to multiply input values
     double conversionFactor_;
@@ -251,6 +423,15 @@ struct EopCorrectionSettings
 
     //Fundamental argument multiplier for corrections
     std::vector< std::string > argumentMultipliersFile_;
+
+    //Boolean denoting whether the corrections are evaluated incrementally for closely spaced times
+    bool useIncrementalEvaluation_;
+
+    //Maximum time difference w.r.t. previous call for which incremental evaluation is used
+    double maximumIncrementalTimeStep_;
+
+    //Maximum number of successive incremental evaluations
+    unsigned int maximumNumberOfIncrementalSteps_;
 };
 
 //Settings for creating a GCRS<->ITRS rotation model
@@ -1076,6 +1257,33 @@ inline std::shared_ptr< RotationModelSettings > spiceRotationModelSettings(
                 originalFrame, targetFrame, spiceFrameName );
 }
 
+//! @get_docstring(nativeSpiceRotationModelSettings)
+inline std::shared_ptr< RotationModelSettings > nativeSpiceRotationModelSettings(
+        const std::vector< std::string >& kernelFiles,
+        const std::string& originalFrame,
+        const std::string& targetFrame,
+        const std::string& pckFrameName = "" )
+{
+    return std::make_shared< NativeSpiceRotationModelSettings >(
+                kernelFiles, originalFrame, targetFrame, pckFrameName );
+}
+
+//! @get_docstring(precomputedRotationModelSettings)
+inline std::shared_ptr< RotationModelSettings > precomputedRotationModelSettings(
+        const std::shared_ptr< RotationModelSettings > underlyingRotationModelSettings,
+        const double startTime,
+        const double endTime,
+        const double timeStep = 3600.0,
+        const double maximumInterpolationError = 1.0E-10,
+        const unsigned int numberOfThreads = 1,
+        const std::string& cacheFile = "",
+        const double nominalRotationRate = TUDAT_NAN )
+{
+    return std::make_shared< PrecomputedRotationModelSettings >(
+                underlyingRotationModelSettings, startTime, endTime, timeStep, maximumInterpolationError,
+                numberOfThreads, cacheFile, nominalRotationRate );
+}
+
 //! @get_docstring(gcrsToItrsRotationModelSettings)
 inline std::shared_ptr< RotationModelSettings > gcrsToItrsRotationModelSettings(
         const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
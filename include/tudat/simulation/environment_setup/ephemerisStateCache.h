@@ -0,0 +1,425 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_EPHEMERISSTATECACHE_H
+#define TUDAT_EPHEMERISSTATECACHE_H
+
+#include <memory>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/astro/ephemerides/rotationalEphemeris.h"
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/timeType.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Statistics of the use of the ephemeris state cache of a body (or set of bodies)
+/*!
+ *  Statistics of the use of the ephemeris state cache of a body (or set of bodies). Each lookup of the ephemeris
+ *  (rotational ephemeris) through the cache is counted as either a hit (value retrieved from cache) or a miss (value
+ *  computed by the ephemeris), regardless of whether caching is enabled.
+ */
+struct EphemerisCacheStatistics
+{
+    EphemerisCacheStatistics( ):
+        stateHits_( 0 ), stateMisses_( 0 ), rotationHits_( 0 ), rotationMisses_( 0 ){ }
+
+    //! Function to compute the fraction of translational state lookups that was retrieved from the cache
+    double getStateHitRate( ) const
+    {
+        return ( stateHits_ + stateMisses_ == 0 ) ? 0.0 :
+                                                   static_cast< double >( stateHits_ ) /
+                                                   static_cast< double >( stateHits_ + stateMisses_ );
+    }
+
+    //! Function to compute the fraction of rotational state lookups that was retrieved from the cache
+    double getRotationHitRate( ) const
+    {
+        return ( rotationHits_ + rotationMisses_ == 0 ) ? 0.0 :
+                                                         static_cast< double >( rotationHits_ ) /
+                                                         static_cast< double >( rotationHits_ + rotationMisses_ );
+    }
+
+    //! Operator to add the statistics of another cache to this object
+    EphemerisCacheStatistics& operator+=( const EphemerisCacheStatistics& statisticsToAdd )
+    {
+        stateHits_ += statisticsToAdd.stateHits_;
+        stateMisses_ += statisticsToAdd.stateMisses_;
+        rotationHits_ += statisticsToAdd.rotationHits_;
+        rotationMisses_ += statisticsToAdd.rotationMisses_;
+        return *this;
+    }
+
+    //! Number of translational state lookups retrieved from the cache
+    unsigned long long stateHits_;
+
+    //! Number of translational state lookups computed by the ephemeris
+    unsigned long long stateMisses_;
+
+    //! Number of rotational state lookups retrieved from the cache
+    unsigned long long rotationHits_;
+
+    //! Number of rotational state lookups computed by the rotational ephemeris
+    unsigned long long rotationMisses_;
+};
+
+//! Class that defines the validity of the ephemeris state caches of all bodies in a SystemOfBodies
+/*!
+ *  Class that defines the validity of the ephemeris state caches of all bodies in a SystemOfBodies. Each cache entry
+ *  of a body stores the 'stage' at which it was computed, and is only used while the stage of this object is
+ *  unchanged, so that invalidating the entries of all bodies is a constant-time operation. Entries are only stored and
+ *  used while a stage is active, which is the case from the start of an evaluation of the state derivative (see
+ *  EnvironmentUpdater::updateEnvironment) until the next call to invalidate(), which is done at the end of a
+ *  propagation and when the ephemerides are reset from propagation results. Outside of a propagation (e.g. when
+ *  simulating observations, during which parameters of the environment may be modified), all lookups are therefore
+ *  passed directly to the ephemerides.
+ */
+class EphemerisStateCache
+{
+public:
+
+    //! Constructor
+    EphemerisStateCache( ):
+        currentStage_( 1 ), isStageActive_( false ), isCacheEnabled_( true ){ }
+
+    //! Function to invalidate the cache entries of all bodies, and start a new stage, during which entries are cached
+    void startStage( )
+    {
+        currentStage_++;
+        isStageActive_ = true;
+    }
+
+    //! Function to invalidate the cache entries of all bodies, and stop caching until the next call to startStage
+    void invalidate( )
+    {
+        currentStage_++;
+        isStageActive_ = false;
+    }
+
+    //! Function to retrieve the current stage, for which cache entries are valid
+    unsigned long long getCurrentStage( ) const
+    {
+        return currentStage_;
+    }
+
+    //! Function to retrieve whether entries are currently stored in/retrieved from the cache
+    bool isCacheActive( ) const
+    {
+        return isCacheEnabled_ && isStageActive_;
+    }
+
+    //! Function to retrieve whether caching is enabled
+    bool getIsCacheEnabled( ) const
+    {
+        return isCacheEnabled_;
+    }
+
+    //! Function to set whether caching is enabled (if not, all lookups are passed directly to the ephemerides)
+    void setIsCacheEnabled( const bool isCacheEnabled )
+    {
+        isCacheEnabled_ = isCacheEnabled;
+        currentStage_++;
+    }
+
+private:
+
+    //! Current stage, for which cache entries are valid
+    unsigned long long currentStage_;
+
+    //! Boolean denoting whether a stage has been started, and not yet invalidated
+    bool isStageActive_;
+
+    //! Boolean denoting whether caching is enabled
+    bool isCacheEnabled_;
+};
+
+//! Function to check whether the state computed by an ephemeris may be cached
+/*!
+ *  Function to check whether the state computed by an ephemeris may be cached, which is the case if it depends only on
+ *  time (and not on the current state of the environment).
+ *  \param ephemeris Ephemeris that is to be checked
+ *  \return True if the state computed by the ephemeris may be cached
+ */
+bool isEphemerisCacheable( const std::shared_ptr< ephemerides::Ephemeris > ephemeris );
+
+//! Function to check whether the rotation computed by a rotational ephemeris may be cached
+/*!
+ *  Function to check whether the rotation computed by a rotational ephemeris may be cached, which is the case if it
+ *  depends only on time (and not on the current state of the environment, as is the case for rotation models based
+ *  on aerodynamic angles, or a body-fixed direction).
+ *  \param rotationalEphemeris Rotational ephemeris that is to be checked
+ *  \return True if the rotation computed by the rotational ephemeris may be cached
+ */
+bool isRotationalEphemerisCacheable( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris );
+
+//! Class to cache the state and rotation computed from the ephemerides of a single body
+/*!
+ *  Class to cache the state and rotation computed from the ephemeris and rotational ephemeris of a single body. The
+ *  most recently computed state (for double and long double state scalar types separately) and rotational state are
+ *  stored, together with the epoch at which they were computed, and reused for lookups at the same epoch while the
+ *  stage of the associated EphemerisStateCache of the system of bodies is unchanged. If no EphemerisStateCache is set
+ *  (i.e. the body is not part of a SystemOfBodies), it is not active, or the ephemeris depends on the state of the
+ *  environment, all lookups are passed directly to the ephemeris.
+ */
+class BodyEphemerisStateCache
+{
+public:
+
+    //! Constructor
+    BodyEphemerisStateCache( ):
+        isEphemerisCacheable_( false ), isRotationalEphemerisCacheable_( false ),
+        doubleStateStage_( 0 ), longDoubleStateStage_( 0 ), rotationStage_( 0 ),
+        isFullRotationalStateCached_( false ){ }
+
+    //! Function to set the cache defining the validity of the entries of all bodies in the system of bodies
+    void setSystemCache( const std::shared_ptr< EphemerisStateCache > systemCache )
+    {
+        systemCache_ = systemCache;
+        invalidate( );
+    }
+
+    //! Function to reset the ephemeris of the body, checking whether it may be cached, and invalidating the cache
+    void resetEphemeris( const std::shared_ptr< ephemerides::Ephemeris > ephemeris )
+    {
+        isEphemerisCacheable_ = isEphemerisCacheable( ephemeris );
+        doubleStateStage_ = 0;
+        longDoubleStateStage_ = 0;
+    }
+
+    //! Function to reset the rotational ephemeris of the body, checking whether it may be cached, and invalidating
+    //! the cache
+    void resetRotationalEphemeris( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris )
+    {
+        isRotationalEphemerisCacheable_ = isRotationalEphemerisCacheable( rotationalEphemeris );
+        rotationStage_ = 0;
+    }
+
+    //! Function to invalidate the entries of this cache
+    void invalidate( )
+    {
+        doubleStateStage_ = 0;
+        longDoubleStateStage_ = 0;
+        rotationStage_ = 0;
+    }
+
+    //! Function to retrieve the state of the body from its ephemeris, through the cache
+    /*!
+     *  Function to retrieve the state of the body from its ephemeris (w.r.t. the ephemeris origin), through the cache.
+     *  \param ephemeris Ephemeris of the body
+     *  \param time Time at which the state is to be retrieved
+     *  \return State of the body w.r.t. its ephemeris origin at the requested time
+     */
+    template< typename StateScalarType, typename TimeType >
+    Eigen::Matrix< StateScalarType, 6, 1 > getStateFromEphemeris(
+            const std::shared_ptr< ephemerides::Ephemeris >& ephemeris, const TimeType& time )
+    {
+        if( !isEphemerisCacheable_ || systemCache_ == nullptr || !systemCache_->isCacheActive( ) )
+        {
+            statistics_.stateMisses_++;
+            return ephemeris->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time );
+        }
+
+        Time cacheTime = static_cast< Time >( time );
+        unsigned long long currentStage = systemCache_->getCurrentStage( );
+        if( sizeof( StateScalarType ) == 8 )
+        {
+            if( !( doubleStateStage_ == currentStage && doubleStateTime_ == cacheTime ) )
+            {
+                statistics_.stateMisses_++;
+                doubleState_ = ephemeris->getTemplatedStateFromEphemeris< StateScalarType, TimeType >(
+                            time ).template cast< double >( );
+                doubleStateTime_ = cacheTime;
+                doubleStateStage_ = currentStage;
+            }
+            else
+            {
+                statistics_.stateHits_++;
+            }
+            return doubleState_.template cast< StateScalarType >( );
+        }
+        else
+        {
+            if( !( longDoubleStateStage_ == currentStage && longDoubleStateTime_ == cacheTime ) )
+            {
+                statistics_.stateMisses_++;
+                longDoubleState_ = ephemeris->getTemplatedStateFromEphemeris< StateScalarType, TimeType >(
+                            time ).template cast< long double >( );
+                longDoubleStateTime_ = cacheTime;
+                longDoubleStateStage_ = currentStage;
+            }
+            else
+            {
+                statistics_.stateHits_++;
+            }
+            return longDoubleState_.template cast< StateScalarType >( );
+        }
+    }
+
+    //! Function to retrieve the full rotational state of the body from its rotational ephemeris, through the cache
+    /*!
+     *  Function to retrieve the full rotational state of the body from its rotational ephemeris, through the cache.
+     *  \param rotationalEphemeris Rotational ephemeris of the body
+     *  \param rotationToLocalFrame Rotation from base to body-fixed frame (returned by reference)
+     *  \param rotationToLocalFrameDerivative Time derivative of rotation matrix from base to body-fixed frame (returned
+     *  by reference)
+     *  \param angularVelocityVectorInGlobalFrame Angular velocity vector of body, expressed in base frame (returned by
+     *  reference)
+     *  \param time Time at which the rotational state is to be retrieved
+     */
+    template< typename TimeType >
+    void getRotationalStateFromEphemeris(
+            const std::shared_ptr< ephemerides::RotationalEphemeris >& rotationalEphemeris,
+            Eigen::Quaterniond& rotationToLocalFrame,
+            Eigen::Matrix3d& rotationToLocalFrameDerivative,
+            Eigen::Vector3d& angularVelocityVectorInGlobalFrame,
+            const TimeType& time )
+    {
+        if( !isRotationalEphemerisCacheable_ || systemCache_ == nullptr || !systemCache_->isCacheActive( ) )
+        {
+            statistics_.rotationMisses_++;
+            rotationalEphemeris->getFullRotationalQuantitiesToTargetFrameTemplated< TimeType >(
+                        rotationToLocalFrame, rotationToLocalFrameDerivative, angularVelocityVectorInGlobalFrame, time );
+            return;
+        }
+
+        Time cacheTime = static_cast< Time >( time );
+        unsigned long long currentStage = systemCache_->getCurrentStage( );
+        if( !( rotationStage_ == currentStage && rotationTime_ == cacheTime && isFullRotationalStateCached_ ) )
+        {
+            statistics_.rotationMisses_++;
+            rotationalEphemeris->getFullRotationalQuantitiesToTargetFrameTemplated< TimeType >(
+                        rotationToLocalFrame_, rotationToLocalFrameDerivative_, angularVelocityVectorInGlobalFrame_,
+                        time );
+            rotationTime_ = cacheTime;
+            rotationStage_ = currentStage;
+            isFullRotationalStateCached_ = true;
+        }
+        else
+        {
+            statistics_.rotationHits_++;
+        }
+
+        rotationToLocalFrame = rotationToLocalFrame_;
+        rotationToLocalFrameDerivative = rotationToLocalFrameDerivative_;
+        angularVelocityVectorInGlobalFrame = angularVelocityVectorInGlobalFrame_;
+    }
+
+    //! Function to retrieve the rotation from base to body-fixed frame from the rotational ephemeris, through the cache
+    /*!
+     *  Function to retrieve the rotation from base to body-fixed frame from the rotational ephemeris, through the
+     *  cache. If the full rotational state at the requested time is cached, its rotation is returned. Otherwise, only
+     *  the rotation is computed (and cached).
+     *  \param rotationalEphemeris Rotational ephemeris of the body
+     *  \param time Time at which the rotation is to be retrieved
+     *  \return Rotation from base to body-fixed frame at the requested time
+     */
+    template< typename TimeType >
+    Eigen::Quaterniond getRotationToLocalFrameFromEphemeris(
+            const std::shared_ptr< ephemerides::RotationalEphemeris >& rotationalEphemeris,
+            const TimeType& time )
+    {
+        if( !isRotationalEphemerisCacheable_ || systemCache_ == nullptr || !systemCache_->isCacheActive( ) )
+        {
+            statistics_.rotationMisses_++;
+            return rotationalEphemeris->getRotationToTargetFrameTemplated< TimeType >( time );
+        }
+
+        Time cacheTime = static_cast< Time >( time );
+        unsigned long long currentStage = systemCache_->getCurrentStage( );
+        if( !( rotationStage_ == currentStage && rotationTime_ == cacheTime ) )
+        {
+            statistics_.rotationMisses_++;
+            rotationToLocalFrame_ = rotationalEphemeris->getRotationToTargetFrameTemplated< TimeType >( time );
+            rotationTime_ = cacheTime;
+            rotationStage_ = currentStage;
+            isFullRotationalStateCached_ = false;
+        }
+        else
+        {
+            statistics_.rotationHits_++;
+        }
+        return rotationToLocalFrame_;
+    }
+
+    //! Function to retrieve the statistics of the use of this cache
+    const EphemerisCacheStatistics& getStatistics( ) const
+    {
+        return statistics_;
+    }
+
+    //! Function to reset the statistics of the use of this cache to zero
+    void resetStatistics( )
+    {
+        statistics_ = EphemerisCacheStatistics( );
+    }
+
+private:
+
+    //! Cache defining the validity of the entries of all bodies in the system of bodies (nullptr if none)
+    std::shared_ptr< EphemerisStateCache > systemCache_;
+
+    //! Boolean denoting whether the state computed by the ephemeris of the body may be cached
+    bool isEphemerisCacheable_;
+
+    //! Boolean denoting whether the rotation computed by the rotational ephemeris of the body may be cached
+    bool isRotationalEphemerisCacheable_;
+
+    //! Stage at which cached double precision state was computed (0 if invalid)
+    unsigned long long doubleStateStage_;
+
+    //! Time at which cached double precision state was computed
+    Time doubleStateTime_;
+
+    //! Cached double precision state
+    Eigen::Vector6d doubleState_;
+
+    //! Stage at which cached long double precision state was computed (0 if invalid)
+    unsigned long long longDoubleStateStage_;
+
+    //! Time at which cached long double precision state was computed
+    Time longDoubleStateTime_;
+
+    //! Cached long double precision state
+    Eigen::Matrix< long double, 6, 1 > longDoubleState_;
+
+    //! Stage at which cached rotational state was computed (0 if invalid)
+    unsigned long long rotationStage_;
+
+    //! Time at which cached rotational state was computed
+    Time rotationTime_;
+
+    //! Boolean denoting whether the cached rotational state includes its time derivative (or only the rotation)
+    bool isFullRotationalStateCached_;
+
+    //! Cached rotation from base to body-fixed frame
+    Eigen::Quaterniond rotationToLocalFrame_;
+
+    //! Cached time derivative of rotation matrix from base to body-fixed frame
+    Eigen::Matrix3d rotationToLocalFrameDerivative_;
+
+    //! Cached angular velocity vector of body, expressed in base frame
+    Eigen::Vector3d angularVelocityVectorInGlobalFrame_;
+
+    //! Statistics of the use of this cache
+    EphemerisCacheStatistics statistics_;
+};
+
+} // namespace simulation_setup
+
+} // namespace tudat
+
+#endif // TUDAT_EPHEMERISSTATECACHE_H
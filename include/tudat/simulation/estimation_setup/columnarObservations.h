@@ -0,0 +1,1016 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COLUMNAROBSERVATIONS_H
+#define TUDAT_COLUMNAROBSERVATIONS_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/timeType.h"
+#include "tudat/io/memoryMappedFile.h"
+#include "tudat/simulation/estimation_setup/observations.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Current version of the binary columnar observation file format
+constexpr uint32_t COLUMNAR_OBSERVATION_FILE_VERSION = 1;
+
+//! Alignment (in bytes) of the data columns in a binary columnar observation file
+constexpr uint64_t COLUMNAR_OBSERVATION_FILE_ALIGNMENT = 64;
+
+//! Entry in the table of observation sets of a ColumnarObservationCollection
+/*!
+ *  Entry in the table of observation sets of a ColumnarObservationCollection, defining the properties of a single
+ *  observation set, and the location of its data in the columns of the collection. Stored directly in binary columnar
+ *  observation files, so that only fixed-size members are used.
+ */
+struct ColumnarObservationSetEntry
+{
+    //! Observable type of set (ObservableType, as integer)
+    int32_t observableType_;
+
+    //! Index of link ends of set in list of link ends of collection
+    int32_t linkEndsId_;
+
+    //! Reference link end of set (LinkEndType, as integer)
+    int32_t referenceLinkEnd_;
+
+    //! Size of single observable of set
+    int32_t observableSize_;
+
+    //! Number of dependent variables per observation of set
+    int32_t dependentVariableSize_;
+
+    //! Index of ancillary settings of set in list of ancillary settings of collection (-1 if none)
+    int32_t ancillarySettingsId_;
+
+    //! Index of first observation of set in time and link end id columns
+    int64_t firstObservation_;
+
+    //! Number of observations in set
+    int64_t numberOfObservations_;
+
+    //! Index of first entry of set in observation value and weight columns
+    int64_t firstValue_;
+
+    //! Index of first entry of set in dependent variable column
+    int64_t firstDependentVariableValue_;
+};
+
+//! Header of binary columnar observation file
+/*!
+ *  Header of binary columnar observation file, which is written at the start of the file. The file consists of this
+ *  header, followed by a metadata section (link ends and ancillary settings), the table of observation sets, and the
+ *  data columns (observation values, times, link end ids, weights and dependent variables). All offsets are in bytes
+ *  from the start of the file, and data columns are aligned to COLUMNAR_OBSERVATION_FILE_ALIGNMENT bytes, so that they
+ *  can be accessed directly after memory-mapping the file. All data is stored in the native binary representation of
+ *  the platform on which the file was written.
+ */
+struct ColumnarObservationFileHeader
+{
+    //! Identifier of file type ("TUDATOBS")
+    char fileIdentifier_[ 8 ];
+
+    //! Version of file format
+    uint32_t formatVersion_;
+
+    //! Size (in bytes) of observation scalar type
+    uint32_t observationScalarSize_;
+
+    //! Identifier of time type (see getColumnarTimeTypeIdentifier)
+    uint32_t timeTypeIdentifier_;
+
+    //! Size (in bytes) of time type
+    uint32_t timeTypeSize_;
+
+    //! Number of observation sets
+    uint64_t numberOfSets_;
+
+    //! Total number of observations
+    uint64_t numberOfObservations_;
+
+    //! Total number of observation values (number of observations, multiplied by observable size)
+    uint64_t numberOfValues_;
+
+    //! Total number of dependent variable values
+    uint64_t numberOfDependentVariableValues_;
+
+    //! Offset and size of metadata section
+    uint64_t metadataOffset_;
+    uint64_t metadataSize_;
+
+    //! Offsets of table of observation sets, and of data columns
+    uint64_t setTableOffset_;
+    uint64_t valuesOffset_;
+    uint64_t timesOffset_;
+    uint64_t linkEndIdsOffset_;
+    uint64_t weightsOffset_;
+    uint64_t dependentVariablesOffset_;
+};
+
+//! Function to retrieve the identifier of a time type, as stored in binary columnar observation files
+template< typename TimeType >
+uint32_t getColumnarTimeTypeIdentifier( );
+
+template< >
+inline uint32_t getColumnarTimeTypeIdentifier< double >( )
+{
+    return 0;
+}
+
+template< >
+inline uint32_t getColumnarTimeTypeIdentifier< long double >( )
+{
+    return 1;
+}
+
+template< >
+inline uint32_t getColumnarTimeTypeIdentifier< Time >( )
+{
+    return 2;
+}
+
+//! Function to serialize the link ends and ancillary settings of a columnar observation collection
+/*!
+ *  Function to serialize the link ends and ancillary settings of a columnar observation collection, for storage in the
+ *  metadata section of a binary columnar observation file
+ *  \param linkEndsList List of link ends, in order of link end id
+ *  \param ancillarySettingsList List of ancillary settings, in order of ancillary settings id
+ *  \return Serialized metadata
+ */
+std::string serializeColumnarObservationMetadata(
+        const std::vector< LinkEnds >& linkEndsList,
+        const std::vector< std::shared_ptr< ObservationAncilliarySimulationSettings > >& ancillarySettingsList );
+
+//! Function to parse the link ends and ancillary settings of a columnar observation collection
+/*!
+ *  Function to parse the link ends and ancillary settings of a columnar observation collection, from the metadata section
+ *  of a binary columnar observation file (inverse of serializeColumnarObservationMetadata)
+ *  \param metadata Pointer to start of metadata
+ *  \param metadataSize Size of metadata (in bytes)
+ *  \param linkEndsList List of link ends, in order of link end id (returned by reference)
+ *  \param ancillarySettingsList List of ancillary settings, in order of ancillary settings id (returned by reference)
+ */
+void parseColumnarObservationMetadata(
+        const char* metadata,
+        const std::size_t metadataSize,
+        std::vector< LinkEnds >& linkEndsList,
+        std::vector< std::shared_ptr< ObservationAncilliarySimulationSettings > >& ancillarySettingsList );
+
+//! Zero-copy view of a contiguous range of observation sets of a ColumnarObservationCollection
+/*!
+ *  Zero-copy view of a contiguous range of observation sets of a ColumnarObservationCollection (e.g. all observations of
+ *  a single observable type, or of a single observable type and link ends). The view refers directly to the columns of
+ *  the collection from which it was created, and is only valid as long as this collection exists.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class ColumnarObservationSlice
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param values Pointer to first observation value of slice
+     *  \param times Pointer to first observation time of slice
+     *  \param linkEndIds Pointer to first link end id of slice
+     *  \param weights Pointer to first weight of slice
+     *  \param numberOfValues Number of observation values in slice
+     *  \param numberOfObservations Number of observations in slice
+     */
+    ColumnarObservationSlice(
+            const ObservationScalarType* values,
+            const TimeType* times,
+            const int32_t* linkEndIds,
+            const double* weights,
+            const int64_t numberOfValues,
+            const int64_t numberOfObservations ):
+        values_( values ), times_( times ), linkEndIds_( linkEndIds ), weights_( weights ),
+        numberOfValues_( numberOfValues ), numberOfObservations_( numberOfObservations ){ }
+
+    //! Function to retrieve (a view of) the observation values in the slice
+    Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationVector( ) const
+    {
+        return Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( values_, numberOfValues_ );
+    }
+
+    //! Function to retrieve (a view of) the weights of the observation values in the slice
+    Eigen::Map< const Eigen::VectorXd > getWeightsVector( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( weights_, numberOfValues_ );
+    }
+
+    //! Function to retrieve (a view of) the link end ids of the observations in the slice
+    Eigen::Map< const Eigen::Matrix< int32_t, Eigen::Dynamic, 1 > > getLinkEndIds( ) const
+    {
+        return Eigen::Map< const Eigen::Matrix< int32_t, Eigen::Dynamic, 1 > >( linkEndIds_, numberOfObservations_ );
+    }
+
+    //! Function to retrieve pointer to the first observation time in the slice
+    const TimeType* getTimesData( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the time of a single observation in the slice
+    const TimeType& getTime( const int64_t index ) const
+    {
+        return times_[ index ];
+    }
+
+    //! Function to retrieve (a copy of) the observation times in the slice
+    std::vector< TimeType > getTimes( ) const
+    {
+        return std::vector< TimeType >( times_, times_ + numberOfObservations_ );
+    }
+
+    //! Function to retrieve the number of observation values in the slice
+    int64_t getNumberOfValues( ) const
+    {
+        return numberOfValues_;
+    }
+
+    //! Function to retrieve the number of observations in the slice
+    int64_t getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+private:
+
+    //! Pointer to first observation value of slice
+    const ObservationScalarType* values_;
+
+    //! Pointer to first observation time of slice
+    const TimeType* times_;
+
+    //! Pointer to first link end id of slice
+    const int32_t* linkEndIds_;
+
+    //! Pointer to first weight of slice
+    const double* weights_;
+
+    //! Number of observation values in slice
+    int64_t numberOfValues_;
+
+    //! Number of observations in slice
+    int64_t numberOfObservations_;
+};
+
+//! Collection of observations, stored in a columnar layout
+/*!
+ *  Collection of observations, stored in a columnar layout: the observation values, times, link end ids, weights and
+ *  dependent variables of all observation sets are each stored in a single contiguous column, with a table of observation
+ *  sets defining the location of each set in the columns. The sets are ordered by observable type and link ends (as in
+ *  ObservationCollection), so that all observations of a given observable type (and link ends) are contiguous, and can
+ *  be retrieved as a zero-copy ColumnarObservationSlice. Times and link end ids are stored per observation; values and
+ *  weights per observation entry (i.e. the observable size times per observation).
+ *
+ *  The collection can be written to a versioned binary file (writeToFile), and loaded from such a file by
+ *  memory-mapping it (loadColumnarObservationCollection), in which case the columns refer directly to the mapped file
+ *  contents: no data is copied, loading is independent of the file size, and the (read-only) data is shared between all
+ *  processes using the same file. Observation dependent variable calculators are not stored, and are not available
+ *  when converting a collection back to an ObservationCollection.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class ColumnarObservationCollection
+{
+public:
+
+    //! Constructor, creates columnar collection from an ObservationCollection
+    /*!
+     *  Constructor, creates columnar collection from an ObservationCollection
+     *  \param observationCollection Collection of observations that is to be stored
+     *  \param weights Weights of the observations, in the same order as the concatenated observation vector of
+     *  observationCollection (default empty, in which case all weights are set to 1)
+     */
+    ColumnarObservationCollection(
+            const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationCollection,
+            const Eigen::VectorXd& weights = Eigen::VectorXd::Zero( 0 ) )
+    {
+        std::map< std::shared_ptr< ObservationAncilliarySimulationSettings >, int > ancillarySettingsIds;
+        std::map< LinkEnds, int > linkEndsIds;
+
+        const typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets& observationSets =
+                observationCollection->getObservationsReference( );
+        int64_t numberOfObservations = 0;
+        int64_t numberOfValues = 0;
+        int64_t numberOfDependentVariableValues = 0;
+        for( auto observableIterator : observationSets )
+        {
+            int observableSize = getObservableSize( observableIterator.first );
+            for( auto linkEndIterator : observableIterator.second )
+            {
+                if( linkEndsIds.count( linkEndIterator.first ) == 0 )
+                {
+                    linkEndsIds[ linkEndIterator.first ] = linkEndsList_.size( );
+                    linkEndsList_.push_back( linkEndIterator.first );
+                }
+
+                for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+                {
+                    std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > currentSet =
+                            linkEndIterator.second.at( i );
+
+                    // Register ancillary settings of set
+                    int ancillarySettingsId = -1;
+                    std::shared_ptr< ObservationAncilliarySimulationSettings > currentAncillarySettings =
+                            currentSet->getAncilliarySettings( );
+                    if( currentAncillarySettings != nullptr )
+                    {
+                        if( ancillarySettingsIds.count( currentAncillarySettings ) == 0 )
+                        {
+                            ancillarySettingsIds[ currentAncillarySettings ] = ancillarySettingsList_.size( );
+                            ancillarySettingsList_.push_back( currentAncillarySettings );
+                        }
+                        ancillarySettingsId = ancillarySettingsIds.at( currentAncillarySettings );
+                    }
+
+                    // Add entry for set
+                    ColumnarObservationSetEntry currentEntry;
+                    currentEntry.observableType_ = static_cast< int32_t >( observableIterator.first );
+                    currentEntry.linkEndsId_ = linkEndsIds.at( linkEndIterator.first );
+                    currentEntry.referenceLinkEnd_ = static_cast< int32_t >( currentSet->getReferenceLinkEnd( ) );
+                    currentEntry.observableSize_ = observableSize;
+                    currentEntry.dependentVariableSize_ =
+                            currentSet->getObservationsDependentVariablesReference( ).size( ) > 0 ?
+                                currentSet->getObservationsDependentVariablesReference( ).at( 0 ).rows( ) : 0;
+                    currentEntry.ancillarySettingsId_ = ancillarySettingsId;
+                    currentEntry.firstObservation_ = numberOfObservations;
+                    currentEntry.numberOfObservations_ = currentSet->getNumberOfObservables( );
+                    currentEntry.firstValue_ = numberOfValues;
+                    currentEntry.firstDependentVariableValue_ = numberOfDependentVariableValues;
+                    setEntriesStorage_.push_back( currentEntry );
+
+                    numberOfObservations += currentEntry.numberOfObservations_;
+                    numberOfValues += currentEntry.numberOfObservations_ * observableSize;
+                    numberOfDependentVariableValues += currentEntry.numberOfObservations_ * currentEntry.dependentVariableSize_;
+                }
+            }
+        }
+
+        // Fill columns
+        valuesStorage_.resize( numberOfValues );
+        timesStorage_.resize( numberOfObservations );
+        linkEndIdsStorage_.resize( numberOfObservations );
+        dependentVariablesStorage_.resize( numberOfDependentVariableValues );
+        unsigned int setCounter = 0;
+        for( auto observableIterator : observationSets )
+        {
+            for( auto linkEndIterator : observableIterator.second )
+            {
+                for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+                {
+                    const ColumnarObservationSetEntry& currentEntry = setEntriesStorage_.at( setCounter );
+                    const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& currentObservations =
+                            linkEndIterator.second.at( i )->getObservationsReference( );
+                    const std::vector< TimeType >& currentTimes =
+                            linkEndIterator.second.at( i )->getObservationTimesReference( );
+                    const std::vector< Eigen::VectorXd >& currentDependentVariables =
+                            linkEndIterator.second.at( i )->getObservationsDependentVariablesReference( );
+
+                    for( int64_t j = 0; j < currentEntry.numberOfObservations_; j++ )
+                    {
+                        Eigen::Map< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >(
+                                    valuesStorage_.data( ) + currentEntry.firstValue_ + j * currentEntry.observableSize_,
+                                    currentEntry.observableSize_ ) = currentObservations.at( j );
+                        timesStorage_[ currentEntry.firstObservation_ + j ] = currentTimes.at( j );
+                        linkEndIdsStorage_[ currentEntry.firstObservation_ + j ] = currentEntry.linkEndsId_;
+                        if( currentEntry.dependentVariableSize_ > 0 )
+                        {
+                            if( currentDependentVariables.at( j ).rows( ) != currentEntry.dependentVariableSize_ )
+                            {
+                                throw std::runtime_error(
+                                            "Error when creating columnar observation collection, dependent variables of "
+                                            "set are not of consistent size." );
+                            }
+                            Eigen::Map< Eigen::VectorXd >(
+                                        dependentVariablesStorage_.data( ) + currentEntry.firstDependentVariableValue_ +
+                                        j * currentEntry.dependentVariableSize_, currentEntry.dependentVariableSize_ ) =
+                                    currentDependentVariables.at( j );
+                        }
+                    }
+                    setCounter++;
+                }
+            }
+        }
+
+        // Set weights
+        if( weights.rows( ) == 0 )
+        {
+            weightsStorage_.assign( numberOfValues, 1.0 );
+        }
+        else if( weights.rows( ) == numberOfValues )
+        {
+            weightsStorage_.assign( weights.data( ), weights.data( ) + numberOfValues );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when creating columnar observation collection, weights vector has size " +
+                                      std::to_string( weights.rows( ) ) + ", expected " + std::to_string( numberOfValues ) );
+        }
+
+        numberOfSets_ = setEntriesStorage_.size( );
+        numberOfObservations_ = numberOfObservations;
+        numberOfValues_ = numberOfValues;
+        numberOfDependentVariableValues_ = numberOfDependentVariableValues;
+        setEntries_ = setEntriesStorage_.data( );
+        values_ = valuesStorage_.data( );
+        times_ = timesStorage_.data( );
+        linkEndIds_ = linkEndIdsStorage_.data( );
+        weights_ = weightsStorage_.data( );
+        dependentVariables_ = dependentVariablesStorage_.data( );
+
+        setObservableRanges( );
+    }
+
+    //! Constructor, creates columnar collection referring to the contents of a memory-mapped binary file
+    /*!
+     *  Constructor, creates columnar collection referring to the contents of a memory-mapped binary columnar observation
+     *  file (written by writeToFile). The columns refer directly to the file contents; no data is copied.
+     *  \param mappedFile Memory-mapped binary columnar observation file
+     */
+    ColumnarObservationCollection( const std::shared_ptr< input_output::MemoryMappedFile > mappedFile ):
+        mappedFile_( mappedFile )
+    {
+        const char* fileData = mappedFile_->getData( );
+        std::size_t fileSize = mappedFile_->getSize( );
+
+        // Read and check header
+        ColumnarObservationFileHeader header;
+        if( fileSize < sizeof( ColumnarObservationFileHeader ) )
+        {
+            throw std::runtime_error( "Error when loading columnar observation file " + mappedFile_->getFileName( ) +
+                                      ", file is too small." );
+        }
+        std::memcpy( &header, fileData, sizeof( ColumnarObservationFileHeader ) );
+        if( std::strncmp( header.fileIdentifier_, "TUDATOBS", 8 ) != 0 )
+        {
+            throw std::runtime_error( "Error when loading columnar observation file " + mappedFile_->getFileName( ) +
+                                      ", file is not a columnar observation file." );
+        }
+        if( header.formatVersion_ != COLUMNAR_OBSERVATION_FILE_VERSION )
+        {
+            throw std::runtime_error( "Error when loading columnar observation file " + mappedFile_->getFileName( ) +
+                                      ", file format version " + std::to_string( header.formatVersion_ ) +
+                                      " is not supported." );
+        }
+        if( header.observationScalarSize_ != sizeof( ObservationScalarType ) ||
+                header.timeTypeIdentifier_ != getColumnarTimeTypeIdentifier< TimeType >( ) ||
+                header.timeTypeSize_ != sizeof( TimeType ) )
+        {
+            throw std::runtime_error( "Error when loading columnar observation file " + mappedFile_->getFileName( ) +
+                                      ", observation scalar type or time type is incompatible." );
+        }
+
+        numberOfSets_ = header.numberOfSets_;
+        numberOfObservations_ = header.numberOfObservations_;
+        numberOfValues_ = header.numberOfValues_;
+        numberOfDependentVariableValues_ = header.numberOfDependentVariableValues_;
+
+        // Check that all sections lie inside the file, and are aligned for the type of their elements
+        checkFileSection< char >( fileData, header.metadataOffset_, header.metadataSize_, fileSize );
+        checkFileSection< ColumnarObservationSetEntry >( fileData, header.setTableOffset_, header.numberOfSets_, fileSize );
+        checkFileSection< ObservationScalarType >( fileData, header.valuesOffset_, header.numberOfValues_, fileSize );
+        checkFileSection< TimeType >( fileData, header.timesOffset_, header.numberOfObservations_, fileSize );
+        checkFileSection< int32_t >( fileData, header.linkEndIdsOffset_, header.numberOfObservations_, fileSize );
+        checkFileSection< double >( fileData, header.weightsOffset_, header.numberOfValues_, fileSize );
+        checkFileSection< double >(
+                    fileData, header.dependentVariablesOffset_, header.numberOfDependentVariableValues_, fileSize );
+
+        parseColumnarObservationMetadata(
+                    fileData + header.metadataOffset_, header.metadataSize_, linkEndsList_, ancillarySettingsList_ );
+
+        setEntries_ = reinterpret_cast< const ColumnarObservationSetEntry* >( fileData + header.setTableOffset_ );
+        values_ = reinterpret_cast< const ObservationScalarType* >( fileData + header.valuesOffset_ );
+        times_ = reinterpret_cast< const TimeType* >( fileData + header.timesOffset_ );
+        linkEndIds_ = reinterpret_cast< const int32_t* >( fileData + header.linkEndIdsOffset_ );
+        weights_ = reinterpret_cast< const double* >( fileData + header.weightsOffset_ );
+        dependentVariables_ = reinterpret_cast< const double* >( fileData + header.dependentVariablesOffset_ );
+
+        checkSetEntries( );
+        setObservableRanges( );
+    }
+
+    ColumnarObservationCollection( const ColumnarObservationCollection& ) = delete;
+
+    ColumnarObservationCollection& operator=( const ColumnarObservationCollection& ) = delete;
+
+    //! Function to retrieve (a view of) the full concatenated observation vector
+    Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationVector( ) const
+    {
+        return Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( values_, numberOfValues_ );
+    }
+
+    //! Function to retrieve (a view of) the full concatenated weights vector
+    Eigen::Map< const Eigen::VectorXd > getWeightsVector( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( weights_, numberOfValues_ );
+    }
+
+    //! Function to retrieve (a view of) the link end ids of all observations
+    Eigen::Map< const Eigen::Matrix< int32_t, Eigen::Dynamic, 1 > > getLinkEndIds( ) const
+    {
+        return Eigen::Map< const Eigen::Matrix< int32_t, Eigen::Dynamic, 1 > >( linkEndIds_, numberOfObservations_ );
+    }
+
+    //! Function to retrieve pointer to the times of all observations
+    const TimeType* getTimesData( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the number of observation sets
+    int64_t getNumberOfSets( ) const
+    {
+        return numberOfSets_;
+    }
+
+    //! Function to retrieve the total number of observations
+    int64_t getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+    //! Function to retrieve the total number of observation values
+    int64_t getNumberOfValues( ) const
+    {
+        return numberOfValues_;
+    }
+
+    //! Function to retrieve the entry of a single observation set
+    const ColumnarObservationSetEntry& getSetEntry( const int64_t setIndex ) const
+    {
+        if( setIndex < 0 || setIndex >= numberOfSets_ )
+        {
+            throw std::runtime_error( "Error when retrieving columnar observation set entry, index is out of bounds." );
+        }
+        return setEntries_[ setIndex ];
+    }
+
+    //! Function to retrieve the list of link ends, in order of link end id
+    const std::vector< LinkEnds >& getLinkEndsList( ) const
+    {
+        return linkEndsList_;
+    }
+
+    //! Function to retrieve the list of ancillary settings, in order of ancillary settings id
+    const std::vector< std::shared_ptr< ObservationAncilliarySimulationSettings > >& getAncillarySettingsList( ) const
+    {
+        return ancillarySettingsList_;
+    }
+
+    //! Function to retrieve whether the columns refer to a memory-mapped file
+    bool isMemoryMapped( ) const
+    {
+        return mappedFile_ != nullptr;
+    }
+
+    //! Function to retrieve (a view of) the dependent variables of a single observation set
+    /*!
+     *  Function to retrieve (a view of) the dependent variables of a single observation set, with one row per observation
+     *  \param setIndex Index of observation set
+     *  \return Dependent variables of observation set
+     */
+    Eigen::Map< const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > > getDependentVariables(
+            const int64_t setIndex ) const
+    {
+        const ColumnarObservationSetEntry& setEntry = getSetEntry( setIndex );
+        return Eigen::Map< const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > >(
+                    dependentVariables_ + setEntry.firstDependentVariableValue_,
+                    setEntry.numberOfObservations_, setEntry.dependentVariableSize_ );
+    }
+
+    //! Function to retrieve a zero-copy slice containing all observations of a single observation set
+    ColumnarObservationSlice< ObservationScalarType, TimeType > getSetSlice( const int64_t setIndex ) const
+    {
+        return createSlice( setIndex, setIndex + 1 );
+    }
+
+    //! Function to retrieve a zero-copy slice containing all observations of a single observable type
+    ColumnarObservationSlice< ObservationScalarType, TimeType > getObservableSlice(
+            const ObservableType observableType ) const
+    {
+        if( observableSetRanges_.count( observableType ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving columnar observation slice, no observations of type " +
+                                      getObservableName( observableType ) + " found." );
+        }
+        return createSlice( observableSetRanges_.at( observableType ).first,
+                            observableSetRanges_.at( observableType ).second );
+    }
+
+    //! Function to retrieve a zero-copy slice containing all observations of a single observable type and link ends
+    ColumnarObservationSlice< ObservationScalarType, TimeType > getObservableSlice(
+            const ObservableType observableType,
+            const LinkEnds& linkEnds ) const
+    {
+        if( observableAndLinkEndsSetRanges_.count( observableType ) == 0 ||
+                observableAndLinkEndsSetRanges_.at( observableType ).count( linkEnds ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving columnar observation slice, no observations of type " +
+                                      getObservableName( observableType ) + " and link ends " +
+                                      getLinkEndsString( linkEnds ) + " found." );
+        }
+        return createSlice( observableAndLinkEndsSetRanges_.at( observableType ).at( linkEnds ).first,
+                            observableAndLinkEndsSetRanges_.at( observableType ).at( linkEnds ).second );
+    }
+
+    //! Function to create an ObservationCollection with the observations stored in this object
+    /*!
+     *  Function to create an ObservationCollection with the observations stored in this object (copying the data into
+     *  the storage of the SingleObservationSet objects). Dependent variable calculators are not restored.
+     *  \return Observation collection
+     */
+    std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > createObservationCollection( ) const
+    {
+        typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets observationSets;
+        for( int64_t i = 0; i < numberOfSets_; i++ )
+        {
+            const ColumnarObservationSetEntry& setEntry = setEntries_[ i ];
+
+            std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
+            std::vector< Eigen::VectorXd > dependentVariables;
+            observations.reserve( setEntry.numberOfObservations_ );
+            for( int64_t j = 0; j < setEntry.numberOfObservations_; j++ )
+            {
+                observations.push_back( Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >(
+                                            values_ + setEntry.firstValue_ + j * setEntry.observableSize_,
+                                            setEntry.observableSize_ ) );
+                if( setEntry.dependentVariableSize_ > 0 )
+                {
+                    dependentVariables.push_back( Eigen::Map< const Eigen::VectorXd >(
+                                                      dependentVariables_ + setEntry.firstDependentVariableValue_ +
+                                                      j * setEntry.dependentVariableSize_,
+                                                      setEntry.dependentVariableSize_ ) );
+                }
+            }
+
+            LinkEnds linkEnds = linkEndsList_.at( setEntry.linkEndsId_ );
+            observationSets[ static_cast< ObservableType >( setEntry.observableType_ ) ][ linkEnds ].push_back(
+                        std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
+                            static_cast< ObservableType >( setEntry.observableType_ ), linkEnds, observations,
+                            std::vector< TimeType >( times_ + setEntry.firstObservation_,
+                                                     times_ + setEntry.firstObservation_ + setEntry.numberOfObservations_ ),
+                            static_cast< LinkEndType >( setEntry.referenceLinkEnd_ ), dependentVariables, nullptr,
+                            setEntry.ancillarySettingsId_ >= 0 ?
+                                ancillarySettingsList_.at( setEntry.ancillarySettingsId_ ) : nullptr ) );
+        }
+        return std::make_shared< ObservationCollection< ObservationScalarType, TimeType > >( observationSets );
+    }
+
+    //! Function to write the collection to a binary columnar observation file
+    /*!
+     *  Function to write the collection to a binary columnar observation file, which can be loaded (memory-mapped) using
+     *  loadColumnarObservationCollection. See ColumnarObservationFileHeader for a description of the file format.
+     *  \param fileName Name of the file that is to be written
+     */
+    void writeToFile( const std::string& fileName ) const
+    {
+        std::string metadata = serializeColumnarObservationMetadata( linkEndsList_, ancillarySettingsList_ );
+
+        // Define layout of file
+        ColumnarObservationFileHeader header;
+        std::memset( &header, 0, sizeof( ColumnarObservationFileHeader ) );
+        std::memcpy( header.fileIdentifier_, "TUDATOBS", 8 );
+        header.formatVersion_ = COLUMNAR_OBSERVATION_FILE_VERSION;
+        header.observationScalarSize_ = sizeof( ObservationScalarType );
+        header.timeTypeIdentifier_ = getColumnarTimeTypeIdentifier< TimeType >( );
+        header.timeTypeSize_ = sizeof( TimeType );
+        header.numberOfSets_ = numberOfSets_;
+        header.numberOfObservations_ = numberOfObservations_;
+        header.numberOfValues_ = numberOfValues_;
+        header.numberOfDependentVariableValues_ = numberOfDependentVariableValues_;
+
+        uint64_t currentOffset = sizeof( ColumnarObservationFileHeader );
+        header.metadataOffset_ = currentOffset;
+        header.metadataSize_ = metadata.size( );
+        currentOffset = getAlignedFileOffset( currentOffset + header.metadataSize_ );
+        header.setTableOffset_ = currentOffset;
+        currentOffset = getAlignedFileOffset( currentOffset + numberOfSets_ * sizeof( ColumnarObservationSetEntry ) );
+        header.valuesOffset_ = currentOffset;
+        currentOffset = getAlignedFileOffset( currentOffset + numberOfValues_ * sizeof( ObservationScalarType ) );
+        header.timesOffset_ = currentOffset;
+        currentOffset = getAlignedFileOffset( currentOffset + numberOfObservations_ * sizeof( TimeType ) );
+        header.linkEndIdsOffset_ = currentOffset;
+        currentOffset = getAlignedFileOffset( currentOffset + numberOfObservations_ * sizeof( int32_t ) );
+        header.weightsOffset_ = currentOffset;
+        currentOffset = getAlignedFileOffset( currentOffset + numberOfValues_ * sizeof( double ) );
+        header.dependentVariablesOffset_ = currentOffset;
+
+        // Write sections
+        std::ofstream fileStream( fileName, std::ios::binary | std::ios::trunc );
+        if( !fileStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing columnar observation file " + fileName +
+                                      ", file could not be opened." );
+        }
+        writeFileSection( fileStream, 0, reinterpret_cast< const char* >( &header ), sizeof( ColumnarObservationFileHeader ) );
+        writeFileSection( fileStream, header.metadataOffset_, metadata.data( ), metadata.size( ) );
+        writeFileSection( fileStream, header.setTableOffset_, reinterpret_cast< const char* >( setEntries_ ),
+                          numberOfSets_ * sizeof( ColumnarObservationSetEntry ) );
+        writeFileSection( fileStream, header.valuesOffset_, reinterpret_cast< const char* >( values_ ),
+                          numberOfValues_ * sizeof( ObservationScalarType ) );
+        writeFileSection( fileStream, header.timesOffset_, reinterpret_cast< const char* >( times_ ),
+                          numberOfObservations_ * sizeof( TimeType ) );
+        writeFileSection( fileStream, header.linkEndIdsOffset_, reinterpret_cast< const char* >( linkEndIds_ ),
+                          numberOfObservations_ * sizeof( int32_t ) );
+        writeFileSection( fileStream, header.weightsOffset_, reinterpret_cast< const char* >( weights_ ),
+                          numberOfValues_ * sizeof( double ) );
+        writeFileSection( fileStream, header.dependentVariablesOffset_, reinterpret_cast< const char* >( dependentVariables_ ),
+                          numberOfDependentVariableValues_ * sizeof( double ) );
+        if( !fileStream.good( ) )
+        {
+            throw std::runtime_error( "Error when writing columnar observation file " + fileName + "." );
+        }
+    }
+
+private:
+
+    //! Function to create a slice of the columns, for a range of observation sets
+    ColumnarObservationSlice< ObservationScalarType, TimeType > createSlice(
+            const int64_t firstSet, const int64_t endSet ) const
+    {
+        const ColumnarObservationSetEntry& firstEntry = getSetEntry( firstSet );
+        const ColumnarObservationSetEntry& lastEntry = getSetEntry( endSet - 1 );
+        int64_t numberOfValues = lastEntry.firstValue_ + lastEntry.numberOfObservations_ * lastEntry.observableSize_ -
+                firstEntry.firstValue_;
+        int64_t numberOfObservations = lastEntry.firstObservation_ + lastEntry.numberOfObservations_ -
+                firstEntry.firstObservation_;
+        return ColumnarObservationSlice< ObservationScalarType, TimeType >(
+                    values_ + firstEntry.firstValue_, times_ + firstEntry.firstObservation_,
+                    linkEndIds_ + firstEntry.firstObservation_, weights_ + firstEntry.firstValue_,
+                    numberOfValues, numberOfObservations );
+    }
+
+    //! Function to check whether the entries of the table of observation sets are consistent with the data columns
+    /*!
+     *  Function to check whether the entries of the table of observation sets are consistent with the data columns, so
+     *  that no data outside the columns can be accessed through the (memory-mapped) table. The observable type, reference
+     *  link end and sizes of each set must be valid, and the sets must be stored contiguously (in the order of the table),
+     *  exactly covering the columns.
+     */
+    void checkSetEntries( ) const
+    {
+        int64_t currentObservation = 0;
+        int64_t currentValue = 0;
+        int64_t currentDependentVariableValue = 0;
+        for( int64_t i = 0; i < numberOfSets_; i++ )
+        {
+            const ColumnarObservationSetEntry& setEntry = setEntries_[ i ];
+            std::string errorPrefix = "Error when loading columnar observation file " + mappedFile_->getFileName( ) +
+                    ", entry " + std::to_string( i ) + " of observation set table ";
+
+            if( setEntry.observableType_ < static_cast< int32_t >( one_way_range ) ||
+                    setEntry.observableType_ > static_cast< int32_t >( dsn_n_way_averaged_doppler ) )
+            {
+                throw std::runtime_error( errorPrefix + "has invalid observable type " +
+                                          std::to_string( setEntry.observableType_ ) + "." );
+            }
+            if( setEntry.observableSize_ != getObservableSize( static_cast< ObservableType >( setEntry.observableType_ ) ) )
+            {
+                throw std::runtime_error( errorPrefix + "has invalid observable size " +
+                                          std::to_string( setEntry.observableSize_ ) + "." );
+            }
+            if( setEntry.referenceLinkEnd_ < static_cast< int32_t >( unidentified_link_end ) ||
+                    setEntry.referenceLinkEnd_ > static_cast< int32_t >( observer ) )
+            {
+                throw std::runtime_error( errorPrefix + "has invalid reference link end." );
+            }
+            if( setEntry.ancillarySettingsId_ < -1 )
+            {
+                throw std::runtime_error( errorPrefix + "has invalid ancillary settings id." );
+            }
+
+            // Check that set directly follows the preceding set in all columns, and lies inside the columns
+            if( setEntry.numberOfObservations_ < 0 || setEntry.dependentVariableSize_ < 0 )
+            {
+                throw std::runtime_error( errorPrefix + "has negative size." );
+            }
+            if( setEntry.firstObservation_ != currentObservation ||
+                    setEntry.firstValue_ != currentValue ||
+                    setEntry.firstDependentVariableValue_ != currentDependentVariableValue )
+            {
+                throw std::runtime_error( errorPrefix + "is not consistent with preceding entries." );
+            }
+            if( setEntry.numberOfObservations_ > numberOfObservations_ - currentObservation ||
+                    setEntry.numberOfObservations_ > ( numberOfValues_ - currentValue ) / setEntry.observableSize_ ||
+                    ( setEntry.dependentVariableSize_ > 0 && setEntry.numberOfObservations_ >
+                      ( numberOfDependentVariableValues_ - currentDependentVariableValue ) / setEntry.dependentVariableSize_ ) )
+            {
+                throw std::runtime_error( errorPrefix + "exceeds size of data columns." );
+            }
+            currentObservation += setEntry.numberOfObservations_;
+            currentValue += setEntry.numberOfObservations_ * setEntry.observableSize_;
+            currentDependentVariableValue += setEntry.numberOfObservations_ * setEntry.dependentVariableSize_;
+        }
+
+        if( currentObservation != numberOfObservations_ || currentValue != numberOfValues_ ||
+                currentDependentVariableValue != numberOfDependentVariableValues_ )
+        {
+            throw std::runtime_error( "Error when loading columnar observation file " + mappedFile_->getFileName( ) +
+                                      ", observation set table does not cover data columns." );
+        }
+    }
+
+    //! Function to determine the ranges of observation sets per observable type, and per observable type and link ends
+    void setObservableRanges( )
+    {
+        for( int64_t i = 0; i < numberOfSets_; i++ )
+        {
+            if( setEntries_[ i ].linkEndsId_ < 0 ||
+                    setEntries_[ i ].linkEndsId_ >= static_cast< int32_t >( linkEndsList_.size( ) ) )
+            {
+                throw std::runtime_error( "Error in columnar observation collection, link end id of set is invalid." );
+            }
+            if( setEntries_[ i ].ancillarySettingsId_ >= static_cast< int32_t >( ancillarySettingsList_.size( ) ) )
+            {
+                throw std::runtime_error( "Error in columnar observation collection, ancillary settings id of set is invalid." );
+            }
+
+            ObservableType currentObservableType = static_cast< ObservableType >( setEntries_[ i ].observableType_ );
+            const LinkEnds& currentLinkEnds = linkEndsList_.at( setEntries_[ i ].linkEndsId_ );
+            if( observableSetRanges_.count( currentObservableType ) == 0 )
+            {
+                observableSetRanges_[ currentObservableType ] = std::make_pair( i, i + 1 );
+            }
+            else if( observableSetRanges_.at( currentObservableType ).second != i )
+            {
+                throw std::runtime_error( "Error in columnar observation collection, sets are not sorted by observable type." );
+            }
+            else
+            {
+                observableSetRanges_[ currentObservableType ].second = i + 1;
+            }
+
+            if( observableAndLinkEndsSetRanges_[ currentObservableType ].count( currentLinkEnds ) == 0 )
+            {
+                observableAndLinkEndsSetRanges_[ currentObservableType ][ currentLinkEnds ] = std::make_pair( i, i + 1 );
+            }
+            else if( observableAndLinkEndsSetRanges_.at( currentObservableType ).at( currentLinkEnds ).second != i )
+            {
+                throw std::runtime_error( "Error in columnar observation collection, sets are not sorted by link ends." );
+            }
+            else
+            {
+                observableAndLinkEndsSetRanges_[ currentObservableType ][ currentLinkEnds ].second = i + 1;
+            }
+        }
+    }
+
+    //! Function to check whether a section of a binary file (with given number of elements of type ElementType) lies inside
+    //! the file, and whether it is aligned such that its contents can be accessed as ElementType
+    template< typename ElementType >
+    void checkFileSection( const char* fileData, const uint64_t offset, const uint64_t numberOfElements,
+                           const uint64_t fileSize ) const
+    {
+        if( offset > fileSize || numberOfElements > ( fileSize - offset ) / sizeof( ElementType ) )
+        {
+            throw std::runtime_error( "Error when reading columnar observation file " + mappedFile_->getFileName( ) +
+                                      ", section at offset " + std::to_string( offset ) + " with " +
+                                      std::to_string( numberOfElements ) + " elements exceeds file size " +
+                                      std::to_string( fileSize ) + "; file is truncated or corrupted." );
+        }
+        if( offset % alignof( ElementType ) != 0 ||
+                reinterpret_cast< std::uintptr_t >( fileData + offset ) % alignof( ElementType ) != 0 )
+        {
+            throw std::runtime_error( "Error when reading columnar observation file " + mappedFile_->getFileName( ) +
+                                      ", section at offset " + std::to_string( offset ) + " is not aligned to " +
+                                      std::to_string( alignof( ElementType ) ) + " bytes; file is corrupted." );
+        }
+    }
+
+    //! Function to round a file offset up to the alignment of the data columns
+    static uint64_t getAlignedFileOffset( const uint64_t offset )
+    {
+        return ( ( offset + COLUMNAR_OBSERVATION_FILE_ALIGNMENT - 1 ) / COLUMNAR_OBSERVATION_FILE_ALIGNMENT ) *
+                COLUMNAR_OBSERVATION_FILE_ALIGNMENT;
+    }
+
+    //! Function to write a section of a binary file, at the given offset (padding the file as needed)
+    static void writeFileSection( std::ofstream& fileStream, const uint64_t offset, const char* data, const uint64_t size )
+    {
+        uint64_t currentPosition = static_cast< uint64_t >( fileStream.tellp( ) );
+        if( currentPosition < offset )
+        {
+            std::vector< char > padding( offset - currentPosition, 0 );
+            fileStream.write( padding.data( ), padding.size( ) );
+        }
+        if( size > 0 )
+        {
+            fileStream.write( data, size );
+        }
+    }
+
+    //! Memory-mapped file to which the columns refer (nullptr if columns are stored in this object)
+    std::shared_ptr< input_output::MemoryMappedFile > mappedFile_;
+
+    //! Storage of columns, if not memory-mapped
+    std::vector< ColumnarObservationSetEntry > setEntriesStorage_;
+    std::vector< ObservationScalarType > valuesStorage_;
+    std::vector< TimeType > timesStorage_;
+    std::vector< int32_t > linkEndIdsStorage_;
+    std::vector< double > weightsStorage_;
+    std::vector< double > dependentVariablesStorage_;
+
+    //! Table of observation sets
+    const ColumnarObservationSetEntry* setEntries_;
+
+    //! Column of observation values
+    const ObservationScalarType* values_;
+
+    //! Column of observation times
+    const TimeType* times_;
+
+    //! Column of observation link end ids
+    const int32_t* linkEndIds_;
+
+    //! Column of observation weights
+    const double* weights_;
+
+    //! Column of observation dependent variables
+    const double* dependentVariables_;
+
+    //! Number of observation sets
+    int64_t numberOfSets_;
+
+    //! Total number of observations
+    int64_t numberOfObservations_;
+
+    //! Total number of observation values
+    int64_t numberOfValues_;
+
+    //! Total number of dependent variable values
+    int64_t numberOfDependentVariableValues_;
+
+    //! List of link ends, in order of link end id
+    std::vector< LinkEnds > linkEndsList_;
+
+    //! List of ancillary settings, in order of ancillary settings id
+    std::vector< std::shared_ptr< ObservationAncilliarySimulationSettings > > ancillarySettingsList_;
+
+    //! Range of observation sets (first and past-the-end index) per observable type
+    std::map< ObservableType, std::pair< int64_t, int64_t > > observableSetRanges_;
+
+    //! Range of observation sets (first and past-the-end index) per observable type and link ends
+    std::map< ObservableType, std::map< LinkEnds, std::pair< int64_t, int64_t > > > observableAndLinkEndsSetRanges_;
+};
+
+//! Function to write an observation collection to a binary columnar observation file
+/*!
+ *  Function to write an observation collection to a binary columnar observation file, which can be loaded (memory-mapped)
+ *  using loadColumnarObservationCollection
+ *  \param observationCollection Collection of observations that is to be written
+ *  \param fileName Name of the file that is to be written
+ *  \param weights Weights of the observations, in the same order as the concatenated observation vector of
+ *  observationCollection (default empty, in which case all weights are set to 1)
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void writeObservationCollectionToFile(
+        const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationCollection,
+        const std::string& fileName,
+        const Eigen::VectorXd& weights = Eigen::VectorXd::Zero( 0 ) )
+{
+    ColumnarObservationCollection< ObservationScalarType, TimeType >( observationCollection, weights ).writeToFile( fileName );
+}
+
+//! Function to load a binary columnar observation file, by memory-mapping it
+/*!
+ *  Function to load a binary columnar observation file, by memory-mapping it. The columns of the returned collection
+ *  refer directly to the file contents (which must not be modified while the collection exists).
+ *  \param fileName Name of the file that is to be loaded
+ *  \return Columnar observation collection
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< ColumnarObservationCollection< ObservationScalarType, TimeType > > loadColumnarObservationCollection(
+        const std::string& fileName )
+{
+    return std::make_shared< ColumnarObservationCollection< ObservationScalarType, TimeType > >(
+                std::make_shared< input_output::MemoryMappedFile >( fileName ) );
+}
+
+} // namespace observation_models
+
+} // namespace tudat
+
+#endif // TUDAT_COLUMNAROBSERVATIONS_H
@@ -11,6 +11,9 @@
 #ifndef TUDAT_CREATEESTIMATABLEPARAMETERS_H
 #define TUDAT_CREATEESTIMATABLEPARAMETERS_H
 
+#include <set>
+#include <tuple>
+
 #include "tudat/astro/basic_astro/accelerationModel.h"
 
 #include "tudat/astro/orbit_determination/estimatable_parameters/estimatableParameter.h"
@@ -2213,6 +2216,128 @@ getAssociatedMultiArcParameter(
     return multiArcParameter;
 }
 
+//! Function to retrieve the start times of the arcs of an arc-wise (non-state) parameter
+/*!
+ *  Function to retrieve the start times of the arcs of an arc-wise (non-state) parameter, for arc-wise empirical
+ *  accelerations, drag and radiation pressure coefficients, and observation (time) biases.
+ *  \param parameter Parameter for which the arc start times are to be retrieved
+ *  \return Start times of the arcs of the parameter (empty if the parameter is not an arc-wise parameter)
+ */
+inline std::vector< double > getArcWiseParameterArcStartTimes(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter )
+{
+    using namespace estimatable_parameters;
+
+    std::vector< double > arcStartTimes;
+    if( std::dynamic_pointer_cast< ArcWiseEmpiricalAccelerationCoefficientsParameter >( parameter ) != nullptr )
+    {
+        arcStartTimes = std::dynamic_pointer_cast< ArcWiseEmpiricalAccelerationCoefficientsParameter >( parameter )->getArcStartTimes( );
+    }
+    else if( std::dynamic_pointer_cast< ArcWiseConstantDragCoefficient >( parameter ) != nullptr )
+    {
+        arcStartTimes = std::dynamic_pointer_cast< ArcWiseConstantDragCoefficient >( parameter )->getArcStartTimes( );
+    }
+    else if( std::dynamic_pointer_cast< ArcWiseRadiationPressureCoefficient >( parameter ) != nullptr )
+    {
+        arcStartTimes = std::dynamic_pointer_cast< ArcWiseRadiationPressureCoefficient >( parameter )->getArcStartTimes( );
+    }
+    else if( std::dynamic_pointer_cast< ArcWiseObservationBiasParameter >( parameter ) != nullptr )
+    {
+        arcStartTimes = std::dynamic_pointer_cast< ArcWiseObservationBiasParameter >( parameter )->getArcStartTimes( );
+    }
+    else if( std::dynamic_pointer_cast< ArcWiseTimeDriftBiasParameter >( parameter ) != nullptr )
+    {
+        arcStartTimes = std::dynamic_pointer_cast< ArcWiseTimeDriftBiasParameter >( parameter )->getArcStartTimes( );
+    }
+    else if( std::dynamic_pointer_cast< ArcWiseTimeBiasParameter >( parameter ) != nullptr )
+    {
+        arcStartTimes = std::dynamic_pointer_cast< ArcWiseTimeBiasParameter >( parameter )->getArcStartTimes( );
+    }
+    return arcStartTimes;
+}
+
+//! Function to retrieve the indices of the local parameters of each arc of a multi-arc estimation
+/*!
+ *  Function to retrieve the indices of the local parameters of each arc of a multi-arc estimation, for use with the
+ *  block-arrow normal equations (see linear_algebra::BlockArrowNormalEquationsAccumulator). The arcs are defined by the
+ *  (combined) start times of all arc-wise initial translational state parameters. The local parameters of an arc are those
+ *  entries of the arc-wise initial state parameters, and of the arc-wise empirical acceleration, drag coefficient, radiation
+ *  pressure coefficient and observation bias parameters, for which the arc coincides with the arc of the estimation (i.e.
+ *  for which both the start time of the arc and the start time of the next arc are identical). All other parameters are
+ *  global parameters, which is always a valid (but less efficient) partitioning.
+ *  \param parametersToEstimate Set of estimated parameters
+ *  \return Indices (in the estimated parameter vector) of the local parameters, per arc
+ */
+template< typename InitialStateParameterType = double >
+std::vector< std::vector< int > > getArcWiseLocalParameterIndices(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > > parametersToEstimate )
+{
+    using namespace estimatable_parameters;
+
+    // Retrieve arc start times, index and single-arc size of arc-wise parameters
+    std::vector< std::tuple< std::vector< double >, int, int > > arcWiseParameters;
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > > > >
+            multiArcStateParameters = parametersToEstimate->getInitialMultiArcStateParameters( );
+    std::set< double > arcStartTimeSet;
+    for( auto parameterIterator: multiArcStateParameters )
+    {
+        std::shared_ptr< ArcWiseInitialTranslationalStateParameter< InitialStateParameterType > > stateParameter =
+                std::dynamic_pointer_cast< ArcWiseInitialTranslationalStateParameter< InitialStateParameterType > >(
+                    parameterIterator.second );
+        if( stateParameter != nullptr )
+        {
+            std::vector< double > currentArcStartTimes = stateParameter->getArcStartTimes( );
+            arcStartTimeSet.insert( currentArcStartTimes.begin( ), currentArcStartTimes.end( ) );
+            arcWiseParameters.push_back( std::make_tuple( currentArcStartTimes, parameterIterator.first, 6 ) );
+        }
+    }
+
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+            parametersToEstimate->getVectorParameters( );
+    for( auto parameterIterator: vectorParameters )
+    {
+        std::vector< double > currentArcStartTimes = getArcWiseParameterArcStartTimes( parameterIterator.second );
+        if( currentArcStartTimes.size( ) > 0 )
+        {
+            arcWiseParameters.push_back(
+                        std::make_tuple( currentArcStartTimes, parameterIterator.first,
+                                         parameterIterator.second->getParameterSize( ) / currentArcStartTimes.size( ) ) );
+        }
+    }
+
+    // Assign arcs of arc-wise parameters to arcs of estimation, if they coincide
+    std::vector< double > arcStartTimes( arcStartTimeSet.begin( ), arcStartTimeSet.end( ) );
+    std::vector< std::vector< int > > localParameterIndices( arcStartTimes.size( ) );
+    for( unsigned int i = 0; i < arcWiseParameters.size( ); i++ )
+    {
+        const std::vector< double >& currentArcStartTimes = std::get< 0 >( arcWiseParameters.at( i ) );
+        int startIndex = std::get< 1 >( arcWiseParameters.at( i ) );
+        int singleArcSize = std::get< 2 >( arcWiseParameters.at( i ) );
+        for( unsigned int j = 0; j < currentArcStartTimes.size( ); j++ )
+        {
+            std::vector< double >::iterator arcIterator = std::find(
+                        arcStartTimes.begin( ), arcStartTimes.end( ), currentArcStartTimes.at( j ) );
+            if( arcIterator == arcStartTimes.end( ) )
+            {
+                continue;
+            }
+
+            int arcIndex = std::distance( arcStartTimes.begin( ), arcIterator );
+            bool isLastParameterArc = ( j + 1 == currentArcStartTimes.size( ) );
+            bool isLastArc = ( arcIndex + 1 == static_cast< int >( arcStartTimes.size( ) ) );
+            if( ( isLastParameterArc && isLastArc ) ||
+                    ( !isLastParameterArc && !isLastArc && currentArcStartTimes.at( j + 1 ) == arcStartTimes.at( arcIndex + 1 ) ) )
+            {
+                for( int k = 0; k < singleArcSize; k++ )
+                {
+                    localParameterIndices.at( arcIndex ).push_back( startIndex + j * singleArcSize + k );
+                }
+            }
+        }
+    }
+
+    return localParameterIndices;
+}
 
 //! Function to get initial state vector of estimated dynamical states.
 /*!
@@ -864,6 +864,13 @@ private:
 
 };
 
+//! Class to define the settings for DSN n-way averaged Doppler observable
+/*!
+ *  Class to define the settings for DSN n-way averaged Doppler observable. If useIntervalChaining is true, the light-time
+ *  solution (and, during estimation, the observation partials) at the end of each count interval is reused at the start
+ *  of the next count interval, if the intervals are exactly back-to-back, see
+ *  DsnNWayAveragedDopplerObservationModel::setIntervalChaining.
+ */
 class DsnNWayAveragedDopplerObservationSettings: public ObservationModelSettings
 {
 public:
@@ -874,8 +881,10 @@ public:
             std::vector< std::shared_ptr< LightTimeCorrectionSettings > >( ),
             const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr,
             const std::shared_ptr< LightTimeConvergenceCriteria > lightTimeConvergenceCriteria
-                = std::make_shared< LightTimeConvergenceCriteria >( ) ):
+                = std::make_shared< LightTimeConvergenceCriteria >( ),
+            const bool useIntervalChaining = false ):
         ObservationModelSettings( dsn_n_way_averaged_doppler, linkEnds, lightTimeCorrectionsList, biasSettings ),
+        useIntervalChaining_( useIntervalChaining ),
         multiLegLightTimeConvergenceCriteria_( lightTimeConvergenceCriteria )
     {
         for( unsigned int i = 0; i < linkEnds.size( ) - 1; i++ )
@@ -891,10 +900,12 @@ public:
             const std::vector< std::shared_ptr< ObservationModelSettings > > oneWayRangeObsevationSettings,
             const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr,
             const std::shared_ptr< LightTimeConvergenceCriteria > lightTimeConvergenceCriteria
-                = std::make_shared< LightTimeConvergenceCriteria >( ) ):
+                = std::make_shared< LightTimeConvergenceCriteria >( ),
+            const bool useIntervalChaining = false ):
         ObservationModelSettings( n_way_differenced_range,
                                   mergeOneWayLinkEnds( getObservationModelListLinkEnds( oneWayRangeObsevationSettings ) ),
                                   std::vector< std::shared_ptr< LightTimeCorrectionSettings > >( ), biasSettings ),
+        useIntervalChaining_( useIntervalChaining ),
         oneWayRangeObsevationSettings_( oneWayRangeObsevationSettings ),
         multiLegLightTimeConvergenceCriteria_( lightTimeConvergenceCriteria ){ }
 
@@ -904,6 +915,9 @@ public:
                 oneWayRangeObsevationSettings_, nullptr, multiLegLightTimeConvergenceCriteria_ );
     }
 
+    //! Boolean denoting whether light-time solutions and partials are shared between adjacent count intervals
+    bool useIntervalChaining_;
+
 private:
     std::vector< std::shared_ptr< ObservationModelSettings > > oneWayRangeObsevationSettings_;
 
@@ -1088,20 +1102,24 @@ inline std::shared_ptr< ObservationModelSettings > dsnNWayAveragedDopplerObserva
                 std::vector< std::shared_ptr< LightTimeCorrectionSettings > >( ),
         const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr,
         const std::shared_ptr< LightTimeConvergenceCriteria > lightTimeConvergenceCriteria =
-                std::make_shared< LightTimeConvergenceCriteria >( ) )
+                std::make_shared< LightTimeConvergenceCriteria >( ),
+        const bool useIntervalChaining = false )
 {
     return std::make_shared< DsnNWayAveragedDopplerObservationSettings >(
-                linkEnds, lightTimeCorrectionsList, biasSettings, lightTimeConvergenceCriteria );
+                linkEnds, lightTimeCorrectionsList, biasSettings, lightTimeConvergenceCriteria,
+                useIntervalChaining );
 }
 
 inline std::shared_ptr< ObservationModelSettings > dsnNWayAveragedDopplerObservationSettings(
         const std::vector< std::shared_ptr< ObservationModelSettings > > oneWayRangeObsevationSettings,
         const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr,
         const std::shared_ptr< LightTimeConvergenceCriteria > lightTimeConvergenceCriteria
-                = std::make_shared< LightTimeConvergenceCriteria >( ) )
+                = std::make_shared< LightTimeConvergenceCriteria >( ),
+        const bool useIntervalChaining = false )
 {
     return std::make_shared< DsnNWayAveragedDopplerObservationSettings >(
-                oneWayRangeObsevationSettings, biasSettings, lightTimeConvergenceCriteria );
+                oneWayRangeObsevationSettings, biasSettings, lightTimeConvergenceCriteria,
+                useIntervalChaining );
 }
 
 
@@ -2016,6 +2034,11 @@ public:
                                 linkEnds.at( observation_models::transmitter ).stationName_ )->getTransmittingFrequencyCalculator( ),
                         turnaroundRatioFunction,
                         observationBias );
+            if( dsnNWayAveragedDopplerObservationSettings->useIntervalChaining_ )
+            {
+                std::dynamic_pointer_cast< DsnNWayAveragedDopplerObservationModel< ObservationScalarType, TimeType > >(
+                            observationModel )->setIntervalChaining( true );
+            }
 
             break;
         }
@@ -330,7 +330,8 @@ public:
             const std::shared_ptr< ObservationPartial< ObservationSize > > firstPartial,
             const std::shared_ptr< ObservationPartial< ObservationSize > > secondPartial,
             const observation_models::LinkEnds& linkEnds,
-            const simulation_setup::SystemOfBodies& bodies );
+            const simulation_setup::SystemOfBodies& bodies,
+            const bool useIntervalChaining = false );
 };
 
 template< >
@@ -342,7 +343,8 @@ public:
             const std::shared_ptr< ObservationPartial< 1 > > firstPartial,
             const std::shared_ptr< ObservationPartial< 1 > > secondPartial,
             const observation_models::LinkEnds& linkEnds,
-            const simulation_setup::SystemOfBodies& bodies )
+            const simulation_setup::SystemOfBodies& bodies,
+            const bool useIntervalChaining = false )
     {
         using namespace observation_models;
 
@@ -420,6 +422,15 @@ public:
                 }
             }
 
+            // If requested, share partial cache between start and end legs: the end leg partial of a count interval is
+            // reused as the start leg partial of the next count interval
+            if( useIntervalChaining && firstPartial != nullptr && secondPartial != nullptr )
+            {
+                std::shared_ptr< NWayRangePartialCache > partialCache = std::make_shared< NWayRangePartialCache >( );
+                std::dynamic_pointer_cast< NWayRangePartial >( firstPartial )->setPartialCache( partialCache, false );
+                std::dynamic_pointer_cast< NWayRangePartial >( secondPartial )->setPartialCache( partialCache, true );
+            }
+
             const std::function< double ( std::vector< FrequencyBands >, double ) > receivedFrequencyFunction =
                     createLinkFrequencyFunction(
                             bodies, linkEnds, observation_models::retransmitter, observation_models::receiver );
@@ -455,7 +466,8 @@ public:
             const std::shared_ptr< ObservationPartial< 2 > > firstPartial,
             const std::shared_ptr< ObservationPartial< 2 > > secondPartial,
             const observation_models::LinkEnds& linkEnds,
-            const simulation_setup::SystemOfBodies& bodies )
+            const simulation_setup::SystemOfBodies& bodies,
+            const bool useIntervalChaining = false )
     {
         using namespace observation_models;
 
@@ -578,6 +590,18 @@ std::shared_ptr< PositionPartialScaling > > createDifferencedObservablePartials(
 
     std::map< std::pair< int, int >, std::shared_ptr< ObservationPartial< ObservationSize > > > differencedObservationPartialList;
 
+    // Check whether partials are to be shared between adjacent count intervals
+    bool useIntervalChaining = false;
+    if( differencedObservableType == dsn_n_way_averaged_doppler )
+    {
+        std::shared_ptr< DsnNWayAveragedDopplerObservationModel< ParameterType, TimeType > > dsnDopplerModel =
+                std::dynamic_pointer_cast< DsnNWayAveragedDopplerObservationModel< ParameterType, TimeType > >( observationModel );
+        if( dsnDopplerModel != nullptr )
+        {
+            useIntervalChaining = dsnDopplerModel->getUseIntervalChaining( );
+        }
+    }
+
     // Iterate over all one-way range partials and create one-way range rate partial from them.
     for( auto it : mergedPartials )
     {
@@ -588,7 +612,8 @@ std::shared_ptr< PositionPartialScaling > > createDifferencedObservablePartials(
                     it.second.first,
                     it.second.second,
                     linkEnds,
-                    bodies );
+                    bodies,
+                    useIntervalChaining );
     }
 
 
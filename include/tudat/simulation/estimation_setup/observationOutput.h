@@ -100,6 +100,11 @@ public:
     {
         return linkEnds_;
     }
+
+    std::vector< std::shared_ptr< ObservationDependentVariableSettings > > getDependentVariableSettingsList( )
+    {
+        return settingsList_;
+    }
 private:
 
     observation_models::ObservableType observableType_;
@@ -209,6 +209,12 @@ public:
         return dependentVariableCalculator_;
     }
 
+    void setDependentVariableCalculator(
+            const std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator )
+    {
+        dependentVariableCalculator_ = dependentVariableCalculator;
+    }
+
 
     std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > getAncilliarySettings( )
     {
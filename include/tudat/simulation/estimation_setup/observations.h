@@ -688,16 +688,16 @@ private:
 
                     std::pair< int, int > startAndSize =
                             observationSetStartAndSize_.at( currentObservableType ).at( currentLinkEnds ).at( i );
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > currentObservables =
-                            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( startAndSize.second );
 
-                    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > currentObservationSet =
-                            linkEndIterator.second.at( i )->getObservations( );
-                    std::vector< TimeType > currentObservationTimes =
-                            linkEndIterator.second.at( i )->getObservationTimes( );
+                    // Copy observations directly from set into concatenated vector
+                    const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& currentObservationSet =
+                            linkEndIterator.second.at( i )->getObservationsReference( );
+                    const std::vector< TimeType >& currentObservationTimes =
+                            linkEndIterator.second.at( i )->getObservationTimesReference( );
                     for( unsigned int j = 0; j < currentObservationSet.size( ); j++ )
                     {
-                        currentObservables.segment( j * observableSize, observableSize ) = currentObservationSet.at( j );
+                        concatenatedObservations_.segment( startAndSize.first + j * observableSize, observableSize ) =
+                                currentObservationSet.at( j );
                         for( int k = 0; k < observableSize; k++ )
                         {
                             concatenatedTimes_[ observationCounter ] = currentObservationTimes.at( j );
@@ -706,7 +706,6 @@ private:
                             observationCounter++;
                         }
                     }
-                    concatenatedObservations_.segment( startAndSize.first, startAndSize.second ) = currentObservables;
                 }
             }
         }
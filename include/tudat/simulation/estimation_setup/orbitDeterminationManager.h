@@ -15,6 +15,7 @@
 
 
 
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/math/basic/leastSquaresEstimation.h"
 #include "tudat/astro/observation_models/observationManager.h"
@@ -226,6 +227,300 @@ void calculateResiduals(
 
 }
 
+//! Function to calculate the observation partials matrix and residuals, distributing the observations over multiple threads
+/*!
+ *  Function to calculate the observation partials matrix and residuals, as calculateDesignMatrixAndResiduals, but with the
+ *  observations distributed over multiple threads. The observation sets are split into chunks of observation epochs (an
+ *  observation set of which the times are not strictly increasing is processed as a single chunk), which are assigned to
+ *  the threads in a fixed order (see executeTasksInParallel). Each thread uses its own observation managers, which must not
+ *  share any (mutable) models with the observation managers of the other threads, and writes its results directly into the
+ *  (disjoint) rows of the design matrix and residual vector. The residual discontinuity check is performed afterwards.
+ *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+ *  \param threadObservationManagers Objects used to compute the observations and partials, per observable type, for each
+ *  thread (with the number of threads equal to the size of this vector)
+ *  \param totalNumberParameters Length of the vector of estimated parameters
+ *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+ *  \param designMatrix Partials of observables w.r.t. parameter vector (returned by reference).
+ *  \param residuals Residuals of computed w.r.t. input observable values (returned by reference).
+ *  \param calculateResiduals Boolean denoting whether the residuals are to be computed
+ *  \param calculatePartials Boolean denoting whether the partials are to be computed
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+    typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
+void calculateDesignMatrixAndResidualsInParallel(
+    const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+    const std::vector< std::map< observation_models::ObservableType,
+        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >& threadObservationManagers,
+    const int totalNumberParameters,
+    const int totalObservationSize,
+    Eigen::MatrixXd& designMatrix,
+    Eigen::VectorXd& residuals,
+    const bool calculateResiduals = true,
+    const bool calculatePartials = true )
+{
+    if( calculatePartials && totalNumberParameters <= 0 )
+    {
+        throw std::runtime_error( "Error when computing observation partials; number of parameters is 0 or smaller: " + std::to_string( totalNumberParameters ) );
+    }
+
+    unsigned int numberOfThreads = threadObservationManagers.size( );
+    if( numberOfThreads == 0 )
+    {
+        throw std::runtime_error( "Error when computing observations and partials in parallel, no observation managers provided" );
+    }
+
+    // Initialize return data (before distributing over threads, so that each thread only writes into its own rows)
+    if( calculatePartials )
+    {
+        designMatrix = Eigen::MatrixXd::Zero( totalObservationSize, totalNumberParameters );
+    }
+
+    if( calculateResiduals )
+    {
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+    }
+
+    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
+        sortedObservations = observationsCollection->getObservations( );
+
+    // Define chunk size, such that the number of chunks is a number of times the number of threads (for load balancing)
+    int totalNumberOfEpochs = 0;
+    for( auto observablesIterator : sortedObservations )
+    {
+        for( auto dataIterator : observablesIterator.second )
+        {
+            for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+            {
+                totalNumberOfEpochs += dataIterator.second.at( i )->getNumberOfObservables( );
+            }
+        }
+    }
+    int maximumChunkSize = std::max( 1, totalNumberOfEpochs / static_cast< int >( 4 * numberOfThreads ) );
+
+    // Create list of chunks: observation set, index of first epoch and number of epochs
+    std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds, unsigned int, int, int > >
+            observationChunks;
+    for( auto observablesIterator : sortedObservations )
+    {
+        for( auto dataIterator : observablesIterator.second )
+        {
+            for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+            {
+                const std::vector< TimeType >& observationTimes = dataIterator.second.at( i )->getObservationTimesReference( );
+                int numberOfEpochs = static_cast< int >( observationTimes.size( ) );
+
+                // Use single chunk if times are not strictly increasing
+                int currentChunkSize = maximumChunkSize;
+                if( std::adjacent_find( observationTimes.begin( ), observationTimes.end( ),
+                                        std::greater_equal< TimeType >( ) ) != observationTimes.end( ) )
+                {
+                    currentChunkSize = numberOfEpochs;
+                }
+
+                for( int chunkStart = 0; chunkStart < numberOfEpochs; chunkStart += currentChunkSize )
+                {
+                    observationChunks.push_back(
+                                std::make_tuple( observablesIterator.first, dataIterator.first, i, chunkStart,
+                                                 std::min( currentChunkSize, numberOfEpochs - chunkStart ) ) );
+                }
+            }
+        }
+    }
+
+    // Compute observations and partials for each chunk, on the thread to which it is assigned
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observedValues =
+            observationsCollection->getObservationVectorReference( );
+    const std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, std::vector< std::pair< int, int > > > >&
+            observationSetStartAndSize = observationsCollection->getObservationSetStartAndSizeReference( );
+    utilities::executeTasksInParallel(
+                observationChunks.size( ), numberOfThreads, [ & ]( const unsigned int chunkIndex, const unsigned int threadIndex )
+    {
+        observation_models::ObservableType currentObservableType = std::get< 0 >( observationChunks.at( chunkIndex ) );
+        const observation_models::LinkEnds& currentLinkEnds = std::get< 1 >( observationChunks.at( chunkIndex ) );
+        unsigned int setIndex = std::get< 2 >( observationChunks.at( chunkIndex ) );
+        int chunkStart = std::get< 3 >( observationChunks.at( chunkIndex ) );
+        int numberOfChunkEpochs = std::get< 4 >( observationChunks.at( chunkIndex ) );
+
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+            sortedObservations.at( currentObservableType ).at( currentLinkEnds ).at( setIndex );
+        std::pair< int, int > observationIndices = observationSetStartAndSize.at(
+            currentObservableType ).at( currentLinkEnds ).at( setIndex );
+        const std::vector< TimeType >& observationTimes = currentObservations->getObservationTimesReference( );
+        int singleObservableSize = observationIndices.second / static_cast< int >( observationTimes.size( ) );
+
+        std::vector< TimeType > chunkTimes(
+            observationTimes.begin( ) + chunkStart, observationTimes.begin( ) + chunkStart + numberOfChunkEpochs );
+
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
+        Eigen::MatrixXd partialsMatrix;
+        threadObservationManagers.at( threadIndex ).at( currentObservableType )->computeObservationsWithPartials(
+            chunkTimes, currentLinkEnds,
+            currentObservations->getReferenceLinkEnd( ),
+            currentObservations->getAncilliarySettings( ),
+            observationsVector,
+            partialsMatrix,
+            calculateResiduals,
+            calculatePartials );
+
+        int chunkStartIndex = observationIndices.first + chunkStart * singleObservableSize;
+        int chunkSize = numberOfChunkEpochs * singleObservableSize;
+        if( calculatePartials )
+        {
+            designMatrix.block( chunkStartIndex, 0, chunkSize, totalNumberParameters ) = partialsMatrix;
+        }
+
+        if( calculateResiduals )
+        {
+            residuals.segment( chunkStartIndex, chunkSize ) =
+                ( observedValues.segment( chunkStartIndex, chunkSize ) - observationsVector ).template cast< double >( );
+        }
+    } );
+
+    if( calculateResiduals )
+    {
+        for( auto observablesIterator : sortedObservations )
+        {
+            std::pair< int, int > observableStartAndSize =
+                    observationsCollection->getObservationTypeStartAndSize( ).at( observablesIterator.first );
+
+            observation_models::checkObservationResidualDiscontinuities(
+                residuals.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 ),
+                observablesIterator.first );
+        }
+    }
+}
+
+//! Function to calculate the observation residuals, and the observation partials per block of observations
+/*!
+ *  Function to calculate the observation residuals, and the observation partials per block of observations. In contrast to
+ *  calculateDesignMatrixAndResiduals, the full matrix of partials is never created. Instead, the partials are computed for
+ *  at most maximumObservationBlockSize observation epochs at a time, and each block is passed to designMatrixBlockFunction,
+ *  which can then (for instance) add it to the normal equations. Observation sets of which the times are not strictly
+ *  increasing are processed as a single block, since the observation manager returns its output ordered by time. The
+ *  residual discontinuity check (see checkObservationResidualDiscontinuities) is performed per block, before the block is
+ *  passed to designMatrixBlockFunction, so that the residuals in the block are final when the function is called.
+ *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+ *  \param observationManagers Objects used to compute the observations and partials, per observable type
+ *  \param totalNumberParameters Length of the vector of estimated parameters
+ *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+ *  \param maximumObservationBlockSize Maximum number of observation epochs for which partials are computed at once
+ *  \param designMatrixBlockFunction Function called for each block of partials, with the index of the first row of
+ *  the block (in the full design matrix) and the partials as input.
+ *  \param residuals Residuals of computed w.r.t. input observable values (returned by reference).
+ *  \param calculateResiduals Boolean denoting whether the residuals are to be computed
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+    typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
+void calculateDesignMatrixBlocksAndResiduals(
+    const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+    const std::map< observation_models::ObservableType,
+        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >& observationManagers,
+    const int totalNumberParameters,
+    const int totalObservationSize,
+    const int maximumObservationBlockSize,
+    const std::function< void( const int, const Eigen::MatrixXd& ) >& designMatrixBlockFunction,
+    Eigen::VectorXd& residuals,
+    const bool calculateResiduals = true )
+{
+    if( totalNumberParameters <= 0 )
+    {
+        throw std::runtime_error( "Error when computing observation partials; number of parameters is 0 or smaller: " + std::to_string( totalNumberParameters ) );
+    }
+
+    if( maximumObservationBlockSize <= 0 )
+    {
+        throw std::runtime_error( "Error when computing observation partials per block; block size is 0 or smaller: " +
+                                  std::to_string( maximumObservationBlockSize ) );
+    }
+
+    if( calculateResiduals )
+    {
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+    }
+
+    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
+        sortedObservations = observationsCollection->getObservations( );
+
+    // Iterate over all observable types in observationsAndTimes
+    for( auto observablesIterator : sortedObservations )
+    {
+        observation_models::ObservableType currentObservableType = observablesIterator.first;
+        int previousBlockEndIndex = -1;
+
+        // Iterate over all link ends for current observable type in observationsAndTimes
+        for( auto dataIterator : observablesIterator.second )
+        {
+            observation_models::LinkEnds currentLinkEnds = dataIterator.first;
+            for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+            {
+                std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                    dataIterator.second.at( i );
+                std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
+                    currentObservableType ).at( currentLinkEnds ).at( i );
+                if( observationIndices.second == 0 )
+                {
+                    continue;
+                }
+
+                const std::vector< TimeType >& observationTimes = currentObservations->getObservationTimesReference( );
+                int numberOfEpochs = static_cast< int >( observationTimes.size( ) );
+                int singleObservableSize = observationIndices.second / numberOfEpochs;
+
+                // Use single block if times are not strictly increasing
+                int currentBlockSize = maximumObservationBlockSize;
+                if( std::adjacent_find( observationTimes.begin( ), observationTimes.end( ),
+                                        std::greater_equal< TimeType >( ) ) != observationTimes.end( ) )
+                {
+                    currentBlockSize = numberOfEpochs;
+                }
+
+                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observedValues;
+                if( calculateResiduals )
+                {
+                    observedValues = currentObservations->getObservationsVector( );
+                }
+
+                // Compute observations and partials per block of epochs
+                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
+                Eigen::MatrixXd partialsMatrix;
+                for( int blockStart = 0; blockStart < numberOfEpochs; blockStart += currentBlockSize )
+                {
+                    int numberOfBlockEpochs = std::min( currentBlockSize, numberOfEpochs - blockStart );
+                    std::vector< TimeType > blockTimes(
+                        observationTimes.begin( ) + blockStart, observationTimes.begin( ) + blockStart + numberOfBlockEpochs );
+
+                    observationManagers.at( currentObservableType )->computeObservationsWithPartials(
+                        blockTimes, currentLinkEnds,
+                        currentObservations->getReferenceLinkEnd( ),
+                        currentObservations->getAncilliarySettings( ),
+                        observationsVector,
+                        partialsMatrix,
+                        calculateResiduals,
+                        true );
+
+                    int blockStartIndex = observationIndices.first + blockStart * singleObservableSize;
+                    int blockSize = partialsMatrix.rows( );
+                    if( calculateResiduals )
+                    {
+                        residuals.segment( blockStartIndex, blockSize ) =
+                            ( observedValues.segment( blockStart * singleObservableSize, blockSize ) -
+                              observationsVector ).template cast< double >( );
+
+                        // Check discontinuities before residuals are used, including last residual of previous block
+                        int checkStartIndex = ( blockStartIndex == previousBlockEndIndex ) ? blockStartIndex - 1 : blockStartIndex;
+                        observation_models::checkObservationResidualDiscontinuities(
+                            residuals.block( checkStartIndex, 0, blockStartIndex + blockSize - checkStartIndex, 1 ),
+                            currentObservableType );
+                    }
+                    previousBlockEndIndex = blockStartIndex + blockSize;
+
+                    designMatrixBlockFunction( blockStartIndex, partialsMatrix );
+                }
+            }
+        }
+    }
+}
+
 //! Top-level class for performing orbit determination.
 /*!
  *  Top-level class for performing orbit determination. All required propagation/estimation settings are provided to
@@ -300,7 +595,8 @@ public:
             const std::vector< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
             const bool propagateOnCreation = true ):
-        parametersToEstimate_( parametersToEstimate )
+        parametersToEstimate_( parametersToEstimate ),
+        bodies_( bodies )
     {
 
         std::vector< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > processedIntegratorSettings =
@@ -487,6 +783,28 @@ public:
         return normalizedCovariance;
     }
 
+    //! Function to compute the contribution of the consider parameters to the covariance, from the normal equations
+    /*!
+     * Function to compute the contribution of the consider parameters to the (normalized) covariance, from the normal
+     * equations, as an alternative to linear_algebra::calculateConsiderParametersCovarianceContribution when the full design
+     * matrix is not available.
+     * \param normalizedCovarianceMatrix Normalized covariance matrix of estimated parameters (upper left block is used if it
+     * includes the constraints)
+     * \param normalizedNormalMatrix Normalized normal matrix for estimated and consider parameters (in that order)
+     * \param normalizedConsiderCovariance Normalized covariance of consider parameters
+     * \return Contribution of consider parameters to normalized covariance
+     */
+    Eigen::MatrixXd calculateConsiderParametersCovarianceContributionFromNormalEquations(
+            const Eigen::MatrixXd& normalizedCovarianceMatrix,
+            const Eigen::MatrixXd& normalizedNormalMatrix,
+            const Eigen::MatrixXd& normalizedConsiderCovariance )
+    {
+        Eigen::MatrixXd covarianceTimesNormalMatrix =
+                normalizedCovarianceMatrix.topLeftCorner( numberEstimatedParameters_, numberEstimatedParameters_ ) *
+                normalizedNormalMatrix.block( 0, numberEstimatedParameters_, numberEstimatedParameters_, numberConsiderParameters_ );
+        return covarianceTimesNormalMatrix * normalizedConsiderCovariance * covarianceTimesNormalMatrix.transpose( );
+    }
+
     //! Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
     /*!
      * Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
@@ -600,33 +918,54 @@ public:
             fullParameterEstimate.segment( numberEstimatedParameters_, numberConsiderParameters_ ) = considerParametersValues_;
         }
 
-        // Compute design matrices (estimated and consider), and residuals (empty for covariance analysis)
+        // Compute design matrices (estimated and consider) and normalization terms, or normal equations if these are accumulated
+        bool accumulateNormalEquations = estimationInput->getAccumulateNormalEquations( );
         bool exceptionDuringPropagation = false;
         std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
-        std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
-                estimationInput, fullParameterEstimate, false, 0, exceptionDuringPropagation, simulationResults );
-        Eigen::MatrixXd designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
-        Eigen::MatrixXd designMatrixConsiderParameters;
-        if ( considerParametersIncluded_ )
+        Eigen::MatrixXd designMatrixEstimatedParameters, designMatrixConsiderParameters, normalizedNormalMatrix;
+        Eigen::VectorXd normalizationTerms, considerNormalizationTerms, normalizedRightHandSide, residuals;
+        if( accumulateNormalEquations )
         {
-            designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+            std::shared_ptr< linear_algebra::BlockArrowNormalEquationsAccumulator > blockArrowNormalEquations;
+            performPreEstimationStepsWithNormalEquations(
+                        estimationInput, fullParameterEstimate, false, 0, exceptionDuringPropagation, simulationResults, residuals,
+                        normalizedNormalMatrix, normalizedRightHandSide, normalizationTerms, considerNormalizationTerms,
+                        designMatrixEstimatedParameters, designMatrixConsiderParameters, blockArrowNormalEquations );
+            if ( !considerParametersIncluded_ )
+            {
+                designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+            }
         }
         else
         {
-            designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+            std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
+                    estimationInput, fullParameterEstimate, false, 0, exceptionDuringPropagation, simulationResults );
+            designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
+            if ( considerParametersIncluded_ )
+            {
+                designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+            }
+            else
+            {
+                designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+            }
+
+            // Normalise partials
+            normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+            if ( considerParametersIncluded_ )
+            {
+                considerNormalizationTerms = normalizeDesignMatrix( designMatrixConsiderParameters );
+            }
         }
 
-        // Normalise partials and inverse a priori covariance
-        Eigen::VectorXd normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+        // Normalise inverse a priori covariance
         Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
                 estimationInput->getInverseOfAprioriCovariance( numberEstimatedParameters_ ), normalizationTerms );
 
-        // Normalise partials w.r.t. consider parameters and consider covariance
-        Eigen::VectorXd considerNormalizationTerms;
+        // Normalise consider covariance
         Eigen::MatrixXd normalizedConsiderCovariance;
         if ( considerParametersIncluded_ )
         {
-            considerNormalizationTerms = normalizeDesignMatrix( designMatrixConsiderParameters );
             normalizedConsiderCovariance = normalizeCovariance( estimationInput->getConsiderCovariance( ), considerNormalizationTerms );
         }
         else
@@ -642,14 +981,34 @@ public:
         parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
 
         // Compute inverse of updated covariance
-        Eigen::MatrixXd inverseNormalizedCovariance = linear_algebra::calculateInverseOfUpdatedCovarianceMatrix(
-                designMatrixEstimatedParameters.block( 0, 0, designMatrixEstimatedParameters.rows( ), numberEstimatedParameters_ ),
-                estimationInput->getWeightsMatrixDiagonals( ),
-                normalizedInverseAprioriCovarianceMatrix, constraintStateMultiplier, constraintRightHandSide, estimationInput->getLimitConditionNumberForWarning( ) );
+        Eigen::MatrixXd inverseNormalizedCovariance;
+        if( accumulateNormalEquations )
+        {
+            inverseNormalizedCovariance = normalizedNormalMatrix.topLeftCorner( numberEstimatedParameters_, numberEstimatedParameters_ ) +
+                    normalizedInverseAprioriCovarianceMatrix;
+            if( constraintStateMultiplier.rows( ) != 0 )
+            {
+                Eigen::VectorXd constrainedRightHandSide = Eigen::VectorXd::Zero( numberEstimatedParameters_ );
+                linear_algebra::addConstraintsToNormalEquations(
+                            inverseNormalizedCovariance, constrainedRightHandSide, constraintStateMultiplier, constraintRightHandSide );
+            }
+        }
+        else
+        {
+            inverseNormalizedCovariance = linear_algebra::calculateInverseOfUpdatedCovarianceMatrix(
+                    designMatrixEstimatedParameters.block( 0, 0, designMatrixEstimatedParameters.rows( ), numberEstimatedParameters_ ),
+                    estimationInput->getWeightsMatrixDiagonals( ),
+                    normalizedInverseAprioriCovarianceMatrix, constraintStateMultiplier, constraintRightHandSide, estimationInput->getLimitConditionNumberForWarning( ) );
+        }
 
         // Compute contribution consider parameters
         Eigen::MatrixXd covarianceContributionConsiderParameters;
-        if ( considerParametersIncluded_ )
+        if ( considerParametersIncluded_ && accumulateNormalEquations )
+        {
+            covarianceContributionConsiderParameters = calculateConsiderParametersCovarianceContributionFromNormalEquations(
+                    inverseNormalizedCovariance.inverse( ), normalizedNormalMatrix, normalizedConsiderCovariance );
+        }
+        else if ( considerParametersIncluded_ )
         {
             covarianceContributionConsiderParameters = linear_algebra::calculateConsiderParametersCovarianceContribution(
                     inverseNormalizedCovariance.inverse( ), designMatrixEstimatedParameters, estimationInput->getWeightsMatrixDiagonals( ),
@@ -694,7 +1053,11 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( numberEstimatedParameters_, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( numberEstimatedParameters_, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestDesignMatrixEstimatedParameters = Eigen::MatrixXd::Constant( totalNumberOfObservations, totalNumberParameters_, TUDAT_NAN );
+
+        // Do not allocate full design matrix if it is not computed
+        bool accumulateNormalEquations = estimationInput->getAccumulateNormalEquations( );
+        int designMatrixRows = ( accumulateNormalEquations && !estimationInput->getSaveDesignMatrix( ) ) ? 0 : totalNumberOfObservations;
+        Eigen::MatrixXd bestDesignMatrixEstimatedParameters = Eigen::MatrixXd::Constant( designMatrixRows, totalNumberParameters_, TUDAT_NAN );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( numberEstimatedParameters_, numberEstimatedParameters_, TUDAT_NAN );
 
@@ -703,7 +1066,7 @@ public:
         if ( considerParametersIncluded_ )
         {
             bestConsiderTransformationData = Eigen::VectorXd::Constant( numberConsiderParameters_, TUDAT_NAN );
-            bestDesignMatrixConsiderParameters = Eigen::MatrixXd::Constant( totalNumberOfObservations, numberConsiderParameters_, TUDAT_NAN );
+            bestDesignMatrixConsiderParameters = Eigen::MatrixXd::Constant( designMatrixRows, numberConsiderParameters_, TUDAT_NAN );
             bestConsiderCovarianceContribution = Eigen::MatrixXd::Constant( numberEstimatedParameters_, numberEstimatedParameters_, TUDAT_NAN );
         }
         else
@@ -729,6 +1092,18 @@ public:
 
         bool exceptionDuringPropagation = false, exceptionDuringInversion = false;
 
+        // Check whether arc-wise parameters can be reduced per arc, if requested
+        if( accumulateNormalEquations && estimationInput->getReduceArcWiseParameters( ) )
+        {
+            Eigen::MatrixXd constraintStateMultiplier;
+            Eigen::VectorXd constraintRightHandSide;
+            parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
+            if( considerParametersIncluded_ || constraintStateMultiplier.rows( ) > 0 )
+            {
+                throw std::runtime_error( "Error when estimating parameters, reduction of arc-wise parameters is not supported with consider parameters or constraints" );
+            }
+        }
+
         // Iterate until convergence (at least once)
         int bestIteration = -1;
         int numberOfIterations = 0;
@@ -741,20 +1116,45 @@ public:
                 newFullParameterEstimate.segment( numberEstimatedParameters_, numberConsiderParameters_ ) = considerParametersValues_;
             }
 
-            // Compute design matrices (for estimated and consider parameters) and residuals.
+            // Compute design matrices (for estimated and consider parameters) and normalization terms, or normal equations if
+            // these are accumulated, and residuals.
             std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
-            std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
-                    estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults );
-            Eigen::VectorXd residuals = designMatricesAndResiduals.second;
-            Eigen::MatrixXd designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
-            Eigen::MatrixXd designMatrixConsiderParameters;
-            if ( considerParametersIncluded_ )
+            Eigen::MatrixXd designMatrixEstimatedParameters, designMatrixConsiderParameters, normalizedNormalMatrix;
+            Eigen::VectorXd residuals, normalizationTerms, normalizationTermsConsider, normalizedRightHandSide;
+            std::shared_ptr< linear_algebra::BlockArrowNormalEquationsAccumulator > blockArrowNormalEquations;
+            if( accumulateNormalEquations )
             {
-                designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+                performPreEstimationStepsWithNormalEquations(
+                            estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation,
+                            simulationResults, residuals, normalizedNormalMatrix, normalizedRightHandSide, normalizationTerms,
+                            normalizationTermsConsider, designMatrixEstimatedParameters, designMatrixConsiderParameters,
+                            blockArrowNormalEquations );
+                if ( !considerParametersIncluded_ )
+                {
+                    designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+                }
             }
             else
             {
-                designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+                std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > designMatricesAndResiduals = performPreEstimationSteps(
+                        estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults );
+                residuals = designMatricesAndResiduals.second;
+                designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
+                if ( considerParametersIncluded_ )
+                {
+                    designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+                }
+                else
+                {
+                    designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+                }
+
+                // Normalise estimated and consider parameters partials
+                normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+                if ( considerParametersIncluded_ )
+                {
+                    normalizationTermsConsider = normalizeDesignMatrix( designMatrixConsiderParameters );
+                }
             }
 
             // Set simulation results
@@ -763,17 +1163,15 @@ public:
                 simulationResultsPerIteration.push_back( simulationResults );
             }
 
-            // Normalise estimated parameters partials and inverse apriori covariance
-            Eigen::VectorXd normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+            // Normalise inverse apriori covariance
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
                     estimationInput->getInverseOfAprioriCovariance( numberEstimatedParameters_ ), normalizationTerms );
 
-            // Normalise partials w.r.t. consider parameters, consider covariance and parameters deviations
-            Eigen::VectorXd normalizationTermsConsider, normalizedConsiderParametersDeviation;
+            // Normalise consider covariance and parameters deviations
+            Eigen::VectorXd normalizedConsiderParametersDeviation;
             Eigen::MatrixXd normalizedConsiderCovariance;
             if ( considerParametersIncluded_ )
             {
-                normalizationTermsConsider = normalizeDesignMatrix( designMatrixConsiderParameters );
                 normalizedConsiderCovariance = normalizeCovariance( estimationInput->getConsiderCovariance( ), normalizationTermsConsider );
                 normalizedConsiderParametersDeviation = estimationInput->considerParametersDeviations_.cwiseProduct( normalizationTermsConsider );
             }
@@ -799,10 +1197,38 @@ public:
                     conditionNumberCheck = TUDAT_NAN;
                 }
                 // Perform LSQ inversion
-                leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
-                        designMatrixEstimatedParameters, residuals, estimationInput->getWeightsMatrixDiagonals( ),
-                        normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
-                        designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                if( blockArrowNormalEquations != nullptr )
+                {
+                    // Reduce arc-wise parameters per arc, and solve for all parameters
+                    leastSquaresOutput.first = blockArrowNormalEquations->solve(
+                                normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck );
+                    leastSquaresOutput.second = normalizedNormalMatrix;
+                    if( normalizedInverseAprioriCovarianceMatrix.size( ) > 0 )
+                    {
+                        leastSquaresOutput.second += normalizedInverseAprioriCovarianceMatrix;
+                    }
+                }
+                else if( accumulateNormalEquations )
+                {
+                    // Add contribution of consider parameters deviations to right-hand side
+                    if ( considerParametersIncluded_ && normalizedConsiderParametersDeviation.size( ) > 0 )
+                    {
+                        normalizedRightHandSide += normalizedNormalMatrix.block(
+                                    0, numberEstimatedParameters_, numberEstimatedParameters_, numberConsiderParameters_ ) *
+                                normalizedConsiderParametersDeviation;
+                    }
+                    leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                            normalizedNormalMatrix.topLeftCorner( numberEstimatedParameters_, numberEstimatedParameters_ ),
+                            normalizedRightHandSide, normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck,
+                            constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else
+                {
+                    leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
+                            designMatrixEstimatedParameters, residuals, estimationInput->getWeightsMatrixDiagonals( ),
+                            normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
+                            designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
@@ -822,7 +1248,12 @@ public:
 
             // Compute contribution consider parameters
             Eigen::MatrixXd covarianceContributionConsiderParameters;
-            if ( considerParametersIncluded_ )
+            if ( considerParametersIncluded_ && accumulateNormalEquations )
+            {
+                covarianceContributionConsiderParameters = calculateConsiderParametersCovarianceContributionFromNormalEquations(
+                        ( leastSquaresOutput.second ).inverse( ), normalizedNormalMatrix, normalizedConsiderCovariance );
+            }
+            else if ( considerParametersIncluded_ )
             {
                 covarianceContributionConsiderParameters = linear_algebra::calculateConsiderParametersCovarianceContribution(
                         ( leastSquaresOutput.second ).inverse( ), designMatrixEstimatedParameters, estimationInput->getWeightsMatrixDiagonals( ),
@@ -1059,6 +1490,71 @@ public:
         return stateTransitionAndSensitivityMatrixInterface_;
     }
 
+    //! Function to set the observations and partials to be computed on multiple threads
+    /*!
+     *  Function to set the observations and partials (when computing the full design matrix) to be computed on multiple
+     *  threads (see calculateDesignMatrixAndResidualsInParallel). Since observation models, observation partials and
+     *  environment models store intermediate results, each additional thread uses its own environment, parameter set and
+     *  observation managers, which are created by this function (the first thread uses those of this object). Before each
+     *  evaluation, the parameter values, the numerically integrated ephemerides, and the state transition/sensitivity matrix
+     *  and dependent variable interpolators of this object are copied to those of the other threads. Any model that is
+     *  shared between the environments (e.g. an ephemeris that calls Spice directly) must be safe to use from multiple
+     *  threads.
+     *  Observations are computed serially when the normal equations are accumulated per block of observations.
+     *  \param numberOfThreads Number of threads over which the observations are distributed (1 for serial computation)
+     *  \param environmentCreationFunction Function creating a new (independent) set of bodies for a single thread, which
+     *  must be identical to the bodies of this object (before propagation)
+     *  \param parameterCreationFunction Function creating the estimated parameters for a single thread, from the bodies
+     *  created for that thread, which must be identical to the full (estimated and consider) parameter set of this object
+     */
+    void setParallelObservationEvaluation(
+            const unsigned int numberOfThreads,
+            const std::function< SystemOfBodies( ) > environmentCreationFunction,
+            const std::function< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >(
+                const SystemOfBodies& ) > parameterCreationFunction )
+    {
+        if( numberOfThreads == 0 )
+        {
+            throw std::runtime_error( "Error when setting parallel observation evaluation, at least one thread is required." );
+        }
+
+        parallelBodies_.clear( );
+        parallelParameters_.clear( );
+        parallelObservationManagers_.clear( );
+        if( numberOfThreads == 1 )
+        {
+            return;
+        }
+
+        // Check whether parameters can be handled by the thread-local observation managers
+        std::map< propagators::IntegratedStateType, std::vector< std::pair< std::string, std::string > > > initialDynamicalStates =
+                estimatable_parameters::getListOfInitialDynamicalStateParametersEstimate< ObservationScalarType >( fullParameters_ );
+        for( auto stateIterator : initialDynamicalStates )
+        {
+            if( stateIterator.first != propagators::translational_state )
+            {
+                throw std::runtime_error( "Error when setting parallel observation evaluation, only translational states can be estimated." );
+            }
+        }
+
+        // Create environment, parameters and observation managers for each additional thread
+        for( unsigned int i = 1; i < numberOfThreads; i++ )
+        {
+            parallelBodies_.push_back( environmentCreationFunction( ) );
+            parallelParameters_.push_back( parameterCreationFunction( parallelBodies_.back( ) ) );
+            if( parallelParameters_.back( )->getParametersDescriptions( ) != fullParameters_->getParametersDescriptions( ) )
+            {
+                throw std::runtime_error( "Error when setting parallel observation evaluation, parameters created for thread " +
+                                          std::to_string( i ) + " are inconsistent with estimated parameters." );
+            }
+
+            parallelObservationManagers_.push_back(
+                        observation_models::createObservationManagersBase< ObservationScalarType, TimeType >(
+                            observationSettingsList_, parallelBodies_.back( ), parallelParameters_.back( ),
+                            stateTransitionAndSensitivityMatrixInterface_, dependentVariablesInterface_ ) );
+        }
+    }
+
 protected:
 
     //! Function called by either constructor to initialize the object.
@@ -1144,7 +1640,11 @@ protected:
         }
 
 
+        // Store bodies of which the ephemerides are reset by the propagation (for parallel observation evaluation)
+        propagatedTranslationalBodies_ = getPropagatedTranslationalBodies( propagatorSettings );
+
         // Iterate over all observables and create observation managers.
+        observationSettingsList_ = observationSettingsList;
         observationManagers_ = createObservationManagersBase(
             observationSettingsList, bodies, fullParameters_,
             stateTransitionAndSensitivityMatrixInterface_, dependentVariablesInterface_ );
@@ -1163,6 +1663,106 @@ protected:
 
     }
 
+    //! Function to retrieve the bodies of which the translational state is propagated for given propagator settings
+    std::vector< std::string > getPropagatedTranslationalBodies(
+            const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings )
+    {
+        std::vector< std::shared_ptr< propagators::SingleArcPropagatorSettings< ObservationScalarType, TimeType > > > singleArcSettingsList;
+        if( std::dynamic_pointer_cast< propagators::SingleArcPropagatorSettings< ObservationScalarType, TimeType > >( propagatorSettings ) != nullptr )
+        {
+            singleArcSettingsList.push_back(
+                        std::dynamic_pointer_cast< propagators::SingleArcPropagatorSettings< ObservationScalarType, TimeType > >( propagatorSettings ) );
+        }
+        else if( std::dynamic_pointer_cast< propagators::MultiArcPropagatorSettings< ObservationScalarType, TimeType > >( propagatorSettings ) != nullptr )
+        {
+            singleArcSettingsList = std::dynamic_pointer_cast< propagators::MultiArcPropagatorSettings< ObservationScalarType, TimeType > >(
+                        propagatorSettings )->getSingleArcSettings( );
+        }
+        else if( std::dynamic_pointer_cast< propagators::HybridArcPropagatorSettings< ObservationScalarType, TimeType > >( propagatorSettings ) != nullptr )
+        {
+            std::shared_ptr< propagators::HybridArcPropagatorSettings< ObservationScalarType, TimeType > > hybridArcSettings =
+                    std::dynamic_pointer_cast< propagators::HybridArcPropagatorSettings< ObservationScalarType, TimeType > >( propagatorSettings );
+            singleArcSettingsList = hybridArcSettings->getMultiArcPropagatorSettings( )->getSingleArcSettings( );
+            singleArcSettingsList.push_back( hybridArcSettings->getSingleArcPropagatorSettings( ) );
+        }
+
+        std::vector< std::string > propagatedBodies;
+        for( unsigned int i = 0; i < singleArcSettingsList.size( ); i++ )
+        {
+            std::map< propagators::IntegratedStateType, std::vector< std::tuple< std::string, std::string, propagators::PropagatorType > > >
+                    integratedStates = propagators::getIntegratedTypeAndBodyList< ObservationScalarType, TimeType >( singleArcSettingsList.at( i ) );
+            if( integratedStates.count( propagators::translational_state ) > 0 )
+            {
+                for( auto bodyIterator : integratedStates.at( propagators::translational_state ) )
+                {
+                    if( std::find( propagatedBodies.begin( ), propagatedBodies.end( ), std::get< 0 >( bodyIterator ) ) ==
+                            propagatedBodies.end( ) )
+                    {
+                        propagatedBodies.push_back( std::get< 0 >( bodyIterator ) );
+                    }
+                }
+            }
+        }
+        return propagatedBodies;
+    }
+
+    //! Function to calculate the design matrix and (optionally) residuals, on multiple threads if requested
+    /*!
+     *  Function to calculate the design matrix and (optionally) residuals, using calculateDesignMatrixAndResiduals, or
+     *  calculateDesignMatrixAndResidualsInParallel if setParallelObservationEvaluation was called with multiple threads. In
+     *  the latter case, the current parameter values, propagated ephemerides and state transition/sensitivity matrices
+     *  are first copied to the objects used by the other threads.
+     *  \param observationCollection Observations for which the design matrix and residuals are to be calculated
+     *  \param designMatrix Partials of observables w.r.t. parameter vector (returned by reference).
+     *  \param residuals Residuals of computed w.r.t. input observable values (returned by reference).
+     *  \param calculateResiduals Boolean denoting whether the residuals are to be computed
+     */
+    void calculateDesignMatrixAndResidualsOfObservations(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationCollection,
+            Eigen::MatrixXd& designMatrix,
+            Eigen::VectorXd& residuals,
+            const bool calculateResiduals )
+    {
+        int totalNumberOfObservations = observationCollection->getTotalObservableSize( );
+        if( parallelObservationManagers_.size( ) == 0 )
+        {
+            calculateDesignMatrixAndResiduals< ObservationScalarType, TimeType >(
+                        observationCollection, observationManagers_, totalNumberParameters_, totalNumberOfObservations,
+                        designMatrix, residuals, calculateResiduals );
+        }
+        else
+        {
+            std::vector< std::map< observation_models::ObservableType,
+                    std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >
+                    threadObservationManagers = { observationManagers_ };
+            ParameterVectorType fullParameterValues = fullParameters_->template getFullParameterValues< ObservationScalarType >( );
+            for( unsigned int i = 0; i < parallelObservationManagers_.size( ); i++ )
+            {
+                parallelParameters_.at( i )->template resetParameterValues< ObservationScalarType >( fullParameterValues );
+                for( unsigned int j = 0; j < propagatedTranslationalBodies_.size( ); j++ )
+                {
+                    propagators::copyIntegratedEphemerisOfBody(
+                                bodies_, parallelBodies_.at( i ), propagatedTranslationalBodies_.at( j ) );
+                }
+
+                std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > threadStateTransitionInterface =
+                        stateTransitionAndSensitivityMatrixInterface_->createIndependentCopy( );
+                std::shared_ptr< propagators::DependentVariablesInterface< TimeType > > threadDependentVariablesInterface =
+                        ( dependentVariablesInterface_ == nullptr ) ? nullptr : dependentVariablesInterface_->createIndependentCopy( );
+                for( auto managerIterator : parallelObservationManagers_.at( i ) )
+                {
+                    managerIterator.second->resetStateTransitionMatrixInterface( threadStateTransitionInterface );
+                    managerIterator.second->resetDependentVariablesInterface( threadDependentVariablesInterface );
+                }
+                threadObservationManagers.push_back( parallelObservationManagers_.at( i ) );
+            }
+
+            calculateDesignMatrixAndResidualsInParallel< ObservationScalarType, TimeType >(
+                        observationCollection, threadObservationManagers, totalNumberParameters_, totalNumberOfObservations,
+                        designMatrix, residuals, calculateResiduals );
+        }
+    }
+
     //! Function to create full parameters set with estimated and consider parameters.
     void setFullParametersSet( )
     {
@@ -1227,17 +1827,14 @@ protected:
     }
 
 
-    std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > performPreEstimationSteps(
+    //! Function to reset the parameter estimate, and reintegrate the equations of motion and variational equations
+    void resetParametersAndPropagate(
             std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
             ParameterVectorType& newParameterEstimate,
-            const bool calculateResiduals,
             const int numberOfIterations,
             bool& exceptionDuringPropagation,
             std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults )
     {
-        // Get number of observations
-        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
-
         // Re-integrate equations of motion and variational equations with new parameter estimate.
         try
         {
@@ -1260,6 +1857,22 @@ protected:
                      error.what( )<<std::endl<<"Terminating estimation"<<std::endl;
             exceptionDuringPropagation = true;
         }
+    }
+
+    std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::VectorXd > performPreEstimationSteps(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const bool calculateResiduals,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults )
+    {
+        // Get number of observations
+        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
+
+        // Re-integrate equations of motion and variational equations with new parameter estimate.
+        resetParametersAndPropagate(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults );
 
         if( estimationInput->getPrintOutput( ) )
         {
@@ -1269,21 +1882,182 @@ protected:
         // Calculate residuals and observation matrix for current parameter estimate.
         Eigen::VectorXd residuals;
         Eigen::MatrixXd designMatrix;
-        if ( calculateResiduals )
+        calculateDesignMatrixAndResidualsOfObservations(
+                    estimationInput->getObservationCollection( ), designMatrix, residuals, calculateResiduals );
+
+        // Divide partials matrix between estimated and consider parameters
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > designMatrices = separateEstimatedAndConsiderDesignMatrices( designMatrix, totalNumberOfObservations );
+
+        return std::make_pair( designMatrices, residuals );
+    }
+
+    //! Function to compute the normalized normal equations and residuals, accumulating the normal equations per block of observations
+    /*!
+     * Function to compute the normalized normal equations and residuals, as an alternative to performPreEstimationSteps, with the
+     * normal equations accumulated per block of observations, so that the full design matrix need not be stored. The normal
+     * equations are set up for the estimated and consider parameters together (in that order), and are normalized in the same
+     * manner as the design matrix is by normalizeDesignMatrix.
+     * \param estimationInput Input to the estimation/covariance analysis
+     * \param newParameterEstimate Full (estimated and consider) parameter vector for the current iteration
+     * \param calculateResiduals Boolean denoting whether the residuals (and right-hand side of the normal equations) are computed
+     * \param numberOfIterations Number of iterations of estimation that have been completed
+     * \param exceptionDuringPropagation Boolean denoting whether an exception was caught during propagation (returned by reference)
+     * \param simulationResults Results of the propagation (returned by reference, if requested by estimationInput)
+     * \param residuals Observation residuals (returned by reference)
+     * \param normalizedNormalMatrix Normalized normal matrix H^T W H for estimated and consider parameters (returned by reference)
+     * \param normalizedRightHandSide Normalized right-hand side H^T W y for estimated parameters (returned by reference)
+     * \param normalizationTerms Normalization terms for estimated parameters (returned by reference)
+     * \param considerNormalizationTerms Normalization terms for consider parameters (returned by reference)
+     * \param designMatrixEstimatedParameters Normalized design matrix for estimated parameters, only computed if it is to be
+     * saved according to estimationInput (returned by reference)
+     * \param designMatrixConsiderParameters Normalized design matrix for consider parameters, only computed if it is to be
+     * saved according to estimationInput (returned by reference)
+     * \param blockArrowNormalEquations Normalized normal equations in block-arrow form, if the arc-wise parameters are to be
+     * reduced per arc according to estimationInput, nullptr otherwise (returned by reference)
+     */
+    void performPreEstimationStepsWithNormalEquations(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const bool calculateResiduals,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults,
+            Eigen::VectorXd& residuals,
+            Eigen::MatrixXd& normalizedNormalMatrix,
+            Eigen::VectorXd& normalizedRightHandSide,
+            Eigen::VectorXd& normalizationTerms,
+            Eigen::VectorXd& considerNormalizationTerms,
+            Eigen::MatrixXd& designMatrixEstimatedParameters,
+            Eigen::MatrixXd& designMatrixConsiderParameters,
+            std::shared_ptr< linear_algebra::BlockArrowNormalEquationsAccumulator >& blockArrowNormalEquations )
+    {
+        // Get number of observations
+        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
+        int numberOfParameters = numberEstimatedParameters_ + numberConsiderParameters_;
+
+        // Re-integrate equations of motion and variational equations with new parameter estimate.
+        resetParametersAndPropagate(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults );
+
+        if( estimationInput->getPrintOutput( ) )
         {
-            calculateDesignMatrixAndResiduals< ObservationScalarType, TimeType >(
-                    estimationInput->getObservationCollection( ), observationManagers_, totalNumberParameters_, totalNumberOfObservations, designMatrix, residuals, true );
+            std::cout << "Calculating residuals and accumulating normal equations " << totalNumberOfObservations << std::endl;
+        }
+
+        // Initialize normal equations, and design matrices (if required)
+        bool saveDesignMatrix = estimationInput->getSaveDesignMatrix( );
+        Eigen::VectorXd weightsMatrixDiagonals = estimationInput->getWeightsMatrixDiagonals( );
+        std::shared_ptr< linear_algebra::NormalEquationsAccumulator > normalEquations;
+        if( estimationInput->getReduceArcWiseParameters( ) )
+        {
+            blockArrowNormalEquations = std::make_shared< linear_algebra::BlockArrowNormalEquationsAccumulator >(
+                        numberOfParameters, simulation_setup::getArcWiseLocalParameterIndices( parametersToEstimate_ ) );
         }
         else
         {
-            calculateDesignMatrix< ObservationScalarType, TimeType >(
-                    estimationInput->getObservationCollection( ), observationManagers_, totalNumberParameters_, totalNumberOfObservations, designMatrix );
+            normalEquations = std::make_shared< linear_algebra::NormalEquationsAccumulator >( numberOfParameters );
+            blockArrowNormalEquations = nullptr;
         }
+        Eigen::VectorXd partialsMinima = Eigen::VectorXd::Constant( numberOfParameters, std::numeric_limits< double >::max( ) );
+        Eigen::VectorXd partialsMaxima = Eigen::VectorXd::Constant( numberOfParameters, std::numeric_limits< double >::lowest( ) );
+        designMatrixEstimatedParameters = Eigen::MatrixXd::Zero( saveDesignMatrix ? totalNumberOfObservations : 0, numberEstimatedParameters_ );
+        designMatrixConsiderParameters = Eigen::MatrixXd::Zero( saveDesignMatrix ? totalNumberOfObservations : 0, numberConsiderParameters_ );
+
+        // Add each block of partials to normal equations
+        Eigen::MatrixXd partialsBlock;
+        std::function< void( const int, const Eigen::MatrixXd& ) > designMatrixBlockFunction =
+                [ & ]( const int startIndex, const Eigen::MatrixXd& fullPartialsBlock )
+        {
+            int blockSize = fullPartialsBlock.rows( );
+            std::pair< Eigen::MatrixXd, Eigen::MatrixXd > designMatrixBlocks =
+                    separateEstimatedAndConsiderDesignMatrices( fullPartialsBlock, blockSize );
+            partialsBlock.resize( blockSize, numberOfParameters );
+            partialsBlock.leftCols( numberEstimatedParameters_ ) = designMatrixBlocks.first;
+            partialsBlock.rightCols( numberConsiderParameters_ ) = designMatrixBlocks.second;
+
+            if( blockSize > 0 )
+            {
+                partialsMinima = partialsMinima.cwiseMin( partialsBlock.colwise( ).minCoeff( ).transpose( ) );
+                partialsMaxima = partialsMaxima.cwiseMax( partialsBlock.colwise( ).maxCoeff( ).transpose( ) );
+            }
 
-        // Divide partials matrix between estimated and consider parameters
-        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > designMatrices = separateEstimatedAndConsiderDesignMatrices( designMatrix, totalNumberOfObservations );
+            if( blockArrowNormalEquations != nullptr && calculateResiduals )
+            {
+                blockArrowNormalEquations->addObservations(
+                            partialsBlock, residuals.segment( startIndex, blockSize ),
+                            weightsMatrixDiagonals.segment( startIndex, blockSize ) );
+            }
+            else if( blockArrowNormalEquations != nullptr )
+            {
+                blockArrowNormalEquations->addObservationPartials(
+                            partialsBlock, weightsMatrixDiagonals.segment( startIndex, blockSize ) );
+            }
+            else if( calculateResiduals )
+            {
+                normalEquations->addObservations(
+                            partialsBlock, residuals.segment( startIndex, blockSize ),
+                            weightsMatrixDiagonals.segment( startIndex, blockSize ) );
+            }
+            else
+            {
+                normalEquations->addObservationPartials( partialsBlock, weightsMatrixDiagonals.segment( startIndex, blockSize ) );
+            }
 
-        return std::make_pair( designMatrices, residuals );
+            if( saveDesignMatrix )
+            {
+                designMatrixEstimatedParameters.middleRows( startIndex, blockSize ) = designMatrixBlocks.first;
+                designMatrixConsiderParameters.middleRows( startIndex, blockSize ) = designMatrixBlocks.second;
+            }
+        };
+        calculateDesignMatrixBlocksAndResiduals< ObservationScalarType, TimeType >(
+                    estimationInput->getObservationCollection( ), observationManagers_, totalNumberParameters_,
+                    totalNumberOfObservations, estimationInput->getMaximumObservationBlockSize( ),
+                    designMatrixBlockFunction, residuals, calculateResiduals );
+
+        // Compute normalization terms, consistent with normalizeDesignMatrix
+        int numberOfAccumulatedObservations = ( blockArrowNormalEquations != nullptr ) ?
+                    blockArrowNormalEquations->getNumberOfObservations( ) : normalEquations->getNumberOfObservations( );
+        Eigen::VectorXd fullNormalizationTerms = Eigen::VectorXd( numberOfParameters );
+        for( int i = 0; i < numberOfParameters; i++ )
+        {
+            if( std::fabs( partialsMinima( i ) ) > partialsMaxima( i ) )
+            {
+                fullNormalizationTerms( i ) = partialsMinima( i );
+            }
+            else
+            {
+                fullNormalizationTerms( i ) = partialsMaxima( i );
+            }
+            if( fullNormalizationTerms( i ) == 0.0 || numberOfAccumulatedObservations == 0 )
+            {
+                fullNormalizationTerms( i ) = 1.0;
+            }
+        }
+        normalizationTerms = fullNormalizationTerms.segment( 0, numberEstimatedParameters_ );
+        considerNormalizationTerms = fullNormalizationTerms.segment( numberEstimatedParameters_, numberConsiderParameters_ );
+
+        // Normalize normal equations and design matrices
+        Eigen::VectorXd inverseNormalizationTerms = fullNormalizationTerms.cwiseInverse( );
+        if( blockArrowNormalEquations != nullptr )
+        {
+            blockArrowNormalEquations->scaleParameters( inverseNormalizationTerms );
+            normalizedNormalMatrix = blockArrowNormalEquations->getNormalMatrix( );
+            normalizedRightHandSide = blockArrowNormalEquations->getRightHandSide( ).segment( 0, numberEstimatedParameters_ );
+        }
+        else
+        {
+            normalizedNormalMatrix = inverseNormalizationTerms.asDiagonal( ) * normalEquations->getNormalMatrix( ) *
+                    inverseNormalizationTerms.asDiagonal( );
+            normalizedRightHandSide = inverseNormalizationTerms.segment( 0, numberEstimatedParameters_ ).cwiseProduct(
+                        normalEquations->getRightHandSide( ).segment( 0, numberEstimatedParameters_ ) );
+        }
+        if( saveDesignMatrix )
+        {
+            designMatrixEstimatedParameters = designMatrixEstimatedParameters *
+                    inverseNormalizationTerms.segment( 0, numberEstimatedParameters_ ).asDiagonal( );
+            designMatrixConsiderParameters = designMatrixConsiderParameters *
+                    inverseNormalizationTerms.segment( numberEstimatedParameters_, numberConsiderParameters_ ).asDiagonal( );
+        }
     }
 
     std::pair< Eigen::MatrixXd, Eigen::MatrixXd > separateEstimatedAndConsiderDesignMatrices(
@@ -1366,6 +2140,22 @@ protected:
     //! Boolean denoting whether consider parameters are included in the orbit determination
     bool considerParametersIncluded_;
 
+    //! Settings for the observation models, used to create the observation managers
+    std::vector< std::shared_ptr< observation_models::ObservationModelSettings > > observationSettingsList_;
+
+    //! Bodies of which the translational state is propagated (and the ephemeris reset after propagation)
+    std::vector< std::string > propagatedTranslationalBodies_;
+
+    //! Environment for each additional thread used in computing observations and partials
+    std::vector< SystemOfBodies > parallelBodies_;
+
+    //! Full (estimated and consider) parameter set for each additional thread used in computing observations and partials
+    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > > parallelParameters_;
+
+    //! Observation managers for each additional thread used in computing observations and partials
+    std::vector< std::map< observation_models::ObservableType,
+    std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > > parallelObservationManagers_;
+
 };
 
 extern template class OrbitDeterminationManager< double, double >;
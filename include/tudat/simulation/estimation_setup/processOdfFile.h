@@ -13,6 +13,8 @@
 #ifndef TUDAT_PROCESSODFFILE_H
 #define TUDAT_PROCESSODFFILE_H
 
+#include <tuple>
+
 #include "tudat/basics/utilities.h"
 #include "tudat/io/readOdfFile.h"
 #include "tudat/astro/observation_models/observableTypes.h"
@@ -193,6 +195,16 @@ public:
 bool compareRawOdfDataByStartDate( std::shared_ptr< input_output::OdfRawFileContents > rawOdfData1,
                                    std::shared_ptr< input_output::OdfRawFileContents > rawOdfData2 );
 
+/*!
+ * Compares two columnar ODF data objects based on their start date. Used to sort ODF files.
+ *
+ * @param columnarOdfData1 Columnar ODF data object.
+ * @param columnarOdfData2 Columnar ODF data object.
+ * @return true if columnarOdfData1 starts before columnarOdfData2, false otherwise
+ */
+bool compareColumnarOdfDataByStartDate( std::shared_ptr< input_output::OdfColumnarFileContents > columnarOdfData1,
+                                        std::shared_ptr< input_output::OdfColumnarFileContents > columnarOdfData2 );
+
 // Class containing processed ODF data.
 class ProcessedOdfFileContents
 {
@@ -263,6 +275,47 @@ public:
         updateProcessedObservationTimes( );
     }
 
+    /*!
+     * Constructor for multiple columnar ODF data objects (see input_output::OdfColumnarFileContents). Processes the
+     * ODF data directly from the data columns, yielding the same processed data as the constructor from the
+     * equivalent raw ODF data objects.
+     *
+     * @param columnarOdfDataVector Vector of multiple columnar ODF data objects
+     * @param spacecraftName Name of the spacecraft.
+     * @param verbose Bool indicating whether to print warning regarding e.g. ignored data.
+     * @param earthFixedGroundStationPositions Map with the position of each ground station in the corresponding planet's
+     *      body-fixed frame. Positions are only used for converting the time between UTC and TDB, therefore approximate
+     *      positions are sufficient.
+     */
+    ProcessedOdfFileContents(
+            std::vector< std::shared_ptr< input_output::OdfColumnarFileContents > > columnarOdfDataVector,
+            const std::string spacecraftName,
+            bool verbose = true,
+            const std::map< std::string, Eigen::Vector3d >& earthFixedGroundStationPositions =
+                    simulation_setup::getApproximateDsnGroundStationPositions( ) ):
+            columnarOdfData_( columnarOdfDataVector ),
+            spacecraftName_( spacecraftName ),
+            approximateEarthFixedGroundStationPositions_ ( earthFixedGroundStationPositions ),
+            verbose_( verbose )
+    {
+        // Sort ODF data files by date and check whether all the provided files apply to the same spacecraft
+        sortAndValidateOdfDataVector( columnarOdfDataVector );
+
+        // Extract and process ODF data
+        std::vector< std::map< int, input_output::OdfRampColumns > > rampDataPerFile;
+        for ( unsigned int i = 0; i < columnarOdfDataVector.size( ); ++i )
+        {
+            rampDataPerFile.push_back( columnarOdfDataVector.at( i )->rampData_ );
+        }
+        extractMultipleOdfRampData( rampDataPerFile );
+        for ( unsigned int i = 0; i < columnarOdfDataVector.size( ); ++i )
+        {
+            extractColumnarOdfOrbitData( columnarOdfDataVector.at( i ) );
+        }
+        // Compute the processed observation times (i.e. TDB time from J2000)
+        updateProcessedObservationTimes( );
+    }
+
     // Get the name of the spacecraft to which the ODF data applies
     std::string getSpacecraftName( )
     {
@@ -303,12 +356,18 @@ public:
         return processedDataBlocks_;
     }
 
-    // Return the raw ODF data
+    // Return the raw ODF data (empty if the object was created from columnar ODF data)
     std::vector< std::shared_ptr< input_output::OdfRawFileContents > > getRawOdfData( )
     {
         return rawOdfData_;
     }
 
+    // Return the columnar ODF data (empty if the object was created from raw ODF data)
+    std::vector< std::shared_ptr< input_output::OdfColumnarFileContents > > getColumnarOdfData( )
+    {
+        return columnarOdfData_;
+    }
+
 private:
 
     /*!
@@ -319,18 +378,29 @@ private:
      */
     void sortAndValidateOdfDataVector( std::vector< std::shared_ptr< input_output::OdfRawFileContents > >& rawOdfDataVector );
 
+    /*!
+     * Checks whether the vector of columnar ODF data is valid (i.e. all objects apply to the same spacecraft), and if so,
+     * sorts the vector by the date of the ODF objets.
+     *
+     * @param columnarOdfDataVector Vector of columnar ODF objects.
+     */
+    void sortAndValidateOdfDataVector(
+            std::vector< std::shared_ptr< input_output::OdfColumnarFileContents > >& columnarOdfDataVector );
+
     /*!
      * Checks whether a given observation is valid. Checks if the observation time is covered by the available ramp tables,
      * for the relevant ground station(s).
      *
-     * @param rawDataBlock Raw ODF data block
+     * @param observableTime Observation time in UTC seconds since EME1950
+     * @param currentObservableId ODF data type of the observation
      * @param linkEnds Link ends to which the ODF block applies
      * @param currentObservableType Observable type
      * @return Bool indicating whether observation is valid or not
      */
-    bool isObservationValid( std::shared_ptr< input_output::OdfDataBlock > rawDataBlock,
-                             observation_models::LinkEnds linkEnds,
-                             observation_models::ObservableType currentObservableType );
+    bool isObservationValid( const double observableTime,
+                             const int currentObservableId,
+                             const observation_models::LinkEnds& linkEnds,
+                             const observation_models::ObservableType currentObservableType );
 
     /*!
      * Extracts data from a raw ODF file, splitting it based on observable type and link ends.
@@ -339,6 +409,13 @@ private:
      */
     void extractRawOdfOrbitData( std::shared_ptr< input_output::OdfRawFileContents > rawOdfData );
 
+    /*!
+     * Extracts data from a columnar ODF file, splitting it based on observable type and link ends.
+     *
+     * @param columnarOdfData Columnar ODF data object.
+     */
+    void extractColumnarOdfOrbitData( std::shared_ptr< input_output::OdfColumnarFileContents > columnarOdfData );
+
     /*!
      * Add an unprocessed ODF data block to the processed data object associated with the relevant observable type and
      * link ends.
@@ -361,6 +438,14 @@ private:
     void extractMultipleRawOdfRampData(
             std::vector< std::shared_ptr< input_output::OdfRawFileContents > > rawOdfDataVector );
 
+    /*!
+     * Merges the ramp data from multiple ODF files, creating one frequency interpolator object per ground station.
+     *
+     * @param rampDataPerFile Ramp data (indexed by station ID) for each ODF file, sorted by the date of the files.
+     */
+    void extractMultipleOdfRampData(
+            const std::vector< std::map< int, input_output::OdfRampColumns > >& rampDataPerFile );
+
     /*!
      * Goes over all the extracted ibservations and converts the observation times to TDB from J2000.
      */
@@ -387,6 +472,9 @@ private:
     // Vector of raw ODF data
     std::vector< std::shared_ptr< input_output::OdfRawFileContents > > rawOdfData_;
 
+    // Vector of columnar ODF data
+    std::vector< std::shared_ptr< input_output::OdfColumnarFileContents > > columnarOdfData_;
+
     // Name of the spacecraft
     const std::string spacecraftName_;
 
@@ -479,6 +567,43 @@ inline std::shared_ptr< ProcessedOdfFileContents > processOdfData(
             odfFiles, spacecraftName, verbose, earthFixedGroundStationPositions );
 }
 
+inline std::shared_ptr< ProcessedOdfFileContents > processOdfData(
+        const std::vector< std::shared_ptr< input_output::OdfColumnarFileContents > >& odfFiles,
+        const std::string& spacecraftName,
+        const bool verbose = true,
+        const std::map< std::string, Eigen::Vector3d >& earthFixedGroundStationPositions =
+                simulation_setup::getApproximateDsnGroundStationPositions( ) )
+{
+    return std::make_shared< ProcessedOdfFileContents >(
+            odfFiles, spacecraftName, verbose, earthFixedGroundStationPositions );
+}
+
+/*!
+ * Reads and processes a list of ODF files. The files are memory-mapped and decoded into columnar ODF data objects (see
+ * input_output::OdfColumnarFileContents), distributed over the given number of threads, and processed directly from the
+ * data columns.
+ *
+ * @param odfFileNames Names of the ODF files
+ * @param spacecraftName Name of the spacecraft.
+ * @param numberOfThreads Number of threads over which the reading of the files is distributed
+ * @param verbose Bool indicating whether to print warning regarding e.g. ignored data.
+ * @param earthFixedGroundStationPositions Map with the (approximate) position of each ground station in the
+ *      corresponding planet's body-fixed frame.
+ * @return Processed ODF data
+ */
+inline std::shared_ptr< ProcessedOdfFileContents > processColumnarOdfData(
+        const std::vector< std::string >& odfFileNames,
+        const std::string& spacecraftName,
+        const unsigned int numberOfThreads = 1,
+        const bool verbose = true,
+        const std::map< std::string, Eigen::Vector3d >& earthFixedGroundStationPositions =
+                simulation_setup::getApproximateDsnGroundStationPositions( ) )
+{
+    return std::make_shared< ProcessedOdfFileContents >(
+            input_output::readOdfFilesColumnar( odfFileNames, numberOfThreads ), spacecraftName, verbose,
+            earthFixedGroundStationPositions );
+}
+
 inline std::shared_ptr< ProcessedOdfFileContents > processOdfData(
         const std::shared_ptr< input_output::OdfRawFileContents > odfFile,
         const std::string& spacecraftName,
@@ -502,6 +627,23 @@ observation_models::LinkEnds getLinkEndsFromOdfBlock (
         const std::shared_ptr< input_output::OdfDataBlock > dataBlock,
         std::string spacecraftName );
 
+/*!
+ * Creates the link ends associated with a given ODF observation, from the identifiers in its common data block.
+ *
+ * @param odfDataType ODF data type of the observation
+ * @param transmittingStationNetworkId Network ID of the transmitting station
+ * @param transmittingStationId ID of the transmitting station
+ * @param receivingStationId ID of the receiving station
+ * @param spacecraftName Spacecraft name
+ * @return Link ends
+ */
+observation_models::LinkEnds getLinkEndsFromOdfIds (
+        const int odfDataType,
+        const int transmittingStationNetworkId,
+        const int transmittingStationId,
+        const int receivingStationId,
+        const std::string& spacecraftName );
+
 /*!
  * Creates the ancillary settings for the observations indexed by dataIndex in the provided processed ODF data.
  *
@@ -592,23 +734,51 @@ void separateSingleLinkOdfData(
     observables.clear( );
     ancillarySettings.clear( );
 
+    std::shared_ptr< ProcessedOdfFileDopplerData > dopplerDataBlock =
+            std::dynamic_pointer_cast< ProcessedOdfFileDopplerData >( odfSingleLinkData );
+    if ( dopplerDataBlock == nullptr && odfSingleLinkData->unprocessedObservationTimes_.size( ) > 0 )
+    {
+        throw std::runtime_error("Error when casting ODF processed data: data type not identified.");
+    }
+
     // Get time and observables vectors
-    std::vector< double > observationTimesTdb = odfSingleLinkData->getObservationTimesVector( );
-    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > > observablesVector =
-            odfSingleLinkData->getObservablesVector( );
+    const std::vector< double >& observationTimesTdb = odfSingleLinkData->processedObservationTimes_;
+    const std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > >& observablesVector =
+            odfSingleLinkData->observableValues_;
+
+    // Observations are grouped by the ODF data from which their ancillary settings are created, so that the ancillary
+    // settings are only created (and compared) once per group, rather than once per observation
+    typedef std::tuple< int, int, int, double, double, double, double > OdfAncillaryDataKey;
+    std::map< OdfAncillaryDataKey, unsigned int > ancillarySettingsIndices;
 
     for ( unsigned int i = 0; i < odfSingleLinkData->unprocessedObservationTimes_.size( ); ++i )
     {
+        OdfAncillaryDataKey currentKey = std::make_tuple(
+                odfSingleLinkData->uplinkBandIds_.at( i ), odfSingleLinkData->downlinkBandIds_.at( i ),
+                odfSingleLinkData->referenceBandIds_.at( i ), dopplerDataBlock->countInterval_.at( i ),
+                dopplerDataBlock->referenceFrequencies_.at( i ), dopplerDataBlock->transmitterUplinkDelays_.at( i ),
+                odfSingleLinkData->receiverDownlinkDelays_.at( i ) );
+
+        auto settingsIterator = ancillarySettingsIndices.find( currentKey );
+        if ( settingsIterator != ancillarySettingsIndices.end( ) )
+        {
+            observationTimes.at( settingsIterator->second ).push_back( static_cast< TimeType >( observationTimesTdb.at( i ) ) );
+            observables.at( settingsIterator->second ).push_back(
+                    observablesVector.at( i ).template cast< ObservationScalarType >( ) );
+            continue;
+        }
+
         observation_models::ObservationAncilliarySimulationSettings currentAncillarySettings =
                 createOdfAncillarySettings< TimeType >( odfSingleLinkData, i );
 
+        // Merge with existing group if ancillary settings are identical (e.g. if bands map to the same settings)
         bool newAncillarySettings = true;
-
         for ( unsigned int j = 0; j < ancillarySettings.size( ); ++j )
         {
             if ( ancillarySettings.at( j ) == currentAncillarySettings )
             {
                 newAncillarySettings = false;
+                ancillarySettingsIndices[ currentKey ] = j;
                 observationTimes.at( j ).push_back( static_cast< TimeType >( observationTimesTdb.at( i ) ) );
                 observables.at( j ).push_back( observablesVector.at( i ).template cast< ObservationScalarType >( ) );
                 break;
@@ -617,6 +787,7 @@ void separateSingleLinkOdfData(
 
         if ( newAncillarySettings )
         {
+            ancillarySettingsIndices[ currentKey ] = ancillarySettings.size( );
             observationTimes.push_back ( std::vector< TimeType >{ static_cast< TimeType >( observationTimesTdb.at( i ) ) } );
             observables.push_back( std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >{
                 observablesVector.at( i ).template cast< ObservationScalarType >( ) } );
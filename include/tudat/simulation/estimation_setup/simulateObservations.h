@@ -16,6 +16,7 @@
 #include <functional>
 
 #include "tudat/astro/observation_models/observationSimulator.h"
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/simulation/estimation_setup/observations.h"
 #include "tudat/basics/utilities.h"
 #include "tudat/math/basic/leastSquaresEstimation.h"
@@ -141,21 +142,31 @@ simulateObservationsWithCheck(
         const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings = nullptr )
 {
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
-    std::tuple< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool, Eigen::VectorXd > simulatedObservation;
     std::vector< Eigen::VectorXd > dependentVariables;
 
+    // Simulate observables, and retrieve link end times and states
+    std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > calculatedObservations;
+    std::vector< std::vector< Eigen::Vector6d > > vectorsOfStates;
+    std::vector< std::vector< double > > vectorsOfTimes;
+    observationModel->resetObservationCache( );
+    observationModel->computeObservationSetWithLinkEndData(
+                observationTimes, referenceLinkEnd, calculatedObservations, vectorsOfTimes, vectorsOfStates,
+                ancilliarySettings );
+
     for( unsigned int i = 0; i < observationTimes.size( ); i++ )
     {
-        simulatedObservation = simulateObservationWithCheck< ObservationSize, ObservationScalarType, TimeType >(
-                    observationTimes.at( i ), observationModel, referenceLinkEnd, linkViabilityCalculators, noiseFunction,
-                    dependentVariableCalculator, ancilliarySettings );
-
         // Check if receiving station can view transmitting station.
-        if( std::get< 1 >( simulatedObservation ) )
+        if( isObservationViable( vectorsOfStates.at( i ), vectorsOfTimes.at( i ), linkViabilityCalculators ) )
         {
-            // If viable, add observable and time to vector of simulated data.
-            observations[ observationTimes[ i ] ] = std::get< 0 >( simulatedObservation );
-            dependentVariables.push_back( std::get< 2 >( simulatedObservation ) );
+            // If viable, add noise and dependent variables, and add observable and time to vector of simulated data.
+            Eigen::VectorXd currentDependentVariables = Eigen::VectorXd::Zero( 0 );
+            addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
+                        calculatedObservations.at( i ), observationTimes.at( i ), currentDependentVariables,
+                        vectorsOfStates.at( i ), vectorsOfTimes.at( i ), ancilliarySettings,
+                        observationModel->getObservableType( ), noiseFunction, dependentVariableCalculator );
+
+            observations[ observationTimes[ i ] ] = calculatedObservations.at( i );
+            dependentVariables.push_back( currentDependentVariables );
         }
     }
 
@@ -237,7 +248,7 @@ simulatePerArcSingleObservationSet(
     std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings =
             observationsToSimulate->getAncilliarySettings( );
 
-
+    observationModel->resetObservationCache( );
     while( currentObservationTime < observationsToSimulate->endTime_ )
     {
         bool addTimeInterval = true;
@@ -422,6 +433,80 @@ simulateSingleObservationSet(
                 bodies );
 }
 
+//! Function to simulate observations for single observable and single set of link ends, from list of observation simulators
+/*!
+ *  Function to simulate observations for single observable and single set of link ends, retrieving the observation simulator
+ *  of the required type from a list of observation simulators.
+ *  \param observationsToSimulate Object that computes/defines settings for observation times/reference link end
+ *  \param observationSimulators List of Observation simulators per observable type.
+ *  \param bodies Environment in which observations are simulated (used to create viability calculators)
+ *  \return Simulated observations for the requested observable type and link ends.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > simulateSingleObservationSet(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const SystemOfBodies& bodies )
+{
+    observation_models::ObservableType observableType = observationsToSimulate->getObservableType( );
+    int observationSize = observation_models::getObservableSize( observableType );
+
+    std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > simulatedObservations;
+    switch( observationSize )
+    {
+    case 1:
+    {
+        std::shared_ptr< observation_models::ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                observation_models::getObservationSimulatorOfType< 1 >( observationSimulators, observableType );
+
+        if( derivedObservationSimulator == nullptr )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic cast to size 1 is nullptr" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
+                    observationsToSimulate, derivedObservationSimulator, bodies );
+        break;
+    }
+    case 2:
+    {
+        std::shared_ptr< observation_models::ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                observation_models::getObservationSimulatorOfType< 2 >( observationSimulators, observableType );
+
+        if( derivedObservationSimulator == nullptr )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic cast to size 2 is nullptr" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
+                    observationsToSimulate, derivedObservationSimulator, bodies );
+        break;
+    }
+    case 3:
+    {
+        std::shared_ptr< observation_models::ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                observation_models::getObservationSimulatorOfType< 3 >( observationSimulators, observableType );
+
+        if( derivedObservationSimulator == nullptr )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic cast to size 3 is nullptr" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
+                    observationsToSimulate, derivedObservationSimulator, bodies );
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                  std::to_string( observationSize ) );
+
+    }
+    return simulatedObservations;
+}
+
 //! Function to simulate observations from set of observables and link and sets
 /*!
  *  Function to simulate observations from set of observables, link ends and observation time settings
@@ -448,69 +533,180 @@ std::shared_ptr< observation_models::ObservationCollection< ObservationScalarTyp
         observation_models::ObservableType observableType = observationsToSimulate.at( i )->getObservableType( );
         observation_models::LinkEnds linkEnds = observationsToSimulate.at( i )->getLinkEnds( ).linkEnds_;
 
-        int observationSize = observation_models::getObservableSize( observableType );
+        // Simulate observations for current observable and link ends set.
+        sortedObservations[ observableType ][ linkEnds ].push_back(
+                    simulateSingleObservationSet< ObservationScalarType, TimeType >(
+                        observationsToSimulate.at( i ), observationSimulators, bodies ) );
+    }
+    std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationCollection =
+            std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >( sortedObservations );
 
-        switch( observationSize )
-        {
-        case 1:
-        {
-            std::shared_ptr< observation_models::ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                    observation_models::getObservationSimulatorOfType< 1 >( observationSimulators, observableType );
+    return observationCollection;
+}
 
-            if( derivedObservationSimulator == nullptr )
-            {
-                throw std::runtime_error( "Error when simulating observation: dynamic cast to size 1 is nullptr" );
-            }
+//! Function to create a copy of observation simulation settings, with dependent variables computed from a different environment
+/*!
+ *  Function to create a (shallow) copy of observation simulation settings, in which the dependent variable calculator is
+ *  recreated, using the same dependent variable settings, from the environment provided as input. This is used to simulate
+ *  observations in an independent copy of the environment (e.g. on a separate thread). All other settings, including the
+ *  noise function, are shared with the original settings.
+ *  \param originalSettings Settings that are to be copied
+ *  \param bodies Environment from which the dependent variables are to be computed
+ *  \return Copy of observation simulation settings
+ */
+template< typename TimeType = double >
+std::shared_ptr< ObservationSimulationSettings< TimeType > > copyObservationSimulationSettingsForEnvironment(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > > originalSettings,
+        const SystemOfBodies& bodies )
+{
+    std::shared_ptr< ObservationSimulationSettings< TimeType > > copiedSettings;
+    if( std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( originalSettings ) != nullptr )
+    {
+        copiedSettings = std::make_shared< TabulatedObservationSimulationSettings< TimeType > >(
+                    *std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( originalSettings ) );
+    }
+    else if( std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( originalSettings ) != nullptr )
+    {
+        copiedSettings = std::make_shared< PerArcObservationSimulationSettings< TimeType > >(
+                    *std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( originalSettings ) );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when copying observation simulation settings, settings type not recognized" );
+    }
 
-            // Simulate observations for current observable and link ends set.
-            sortedObservations[ observableType ][ linkEnds ].push_back(
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
-                            observationsToSimulate.at( i ), derivedObservationSimulator, bodies ) );
-            break;
-        }
-        case 2:
-        {
-            std::shared_ptr< observation_models::ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                    observation_models::getObservationSimulatorOfType< 2 >( observationSimulators, observableType );
+    std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator =
+            std::make_shared< ObservationDependentVariableCalculator >(
+                originalSettings->getObservableType( ), originalSettings->getLinkEnds( ) );
+    if( originalSettings->getDependentVariableCalculator( ) != nullptr )
+    {
+        dependentVariableCalculator->addDependentVariables(
+                    originalSettings->getDependentVariableCalculator( )->getDependentVariableSettingsList( ), bodies );
+    }
+    copiedSettings->setDependentVariableCalculator( dependentVariableCalculator );
+    return copiedSettings;
+}
 
-            if( derivedObservationSimulator == nullptr )
-            {
-                throw std::runtime_error( "Error when simulating observation: dynamic cast to size 2 is nullptr" );
-            }
+//! Function to simulate observations from set of observables and link and sets, distributed over multiple threads
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, distributing the
+ *  entries of observationsToSimulate over multiple threads. Each thread uses its own environment and observation simulators
+ *  (which are not thread-safe), created from identical settings. The first entries of threadObservationSimulators and
+ *  threadBodies are used by the calling thread. Each entry of observationsToSimulate is simulated completely by a single
+ *  thread, so that its noise function is evaluated in the same order as for the serial simulateObservations function.
+ *  Provided that the noise function of each entry is independent (as is the case when using e.g.
+ *  addGaussianNoiseFunctionToObservationSimulationSettings), the output is identical to that of simulateObservations,
+ *  regardless of the number of threads. Noise functions shared between multiple entries must not be used with this function.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param threadObservationSimulators List of observation simulators, per thread
+ *  \param threadBodies Environment in which observations are simulated, per thread
+ *  \return Simulated observation values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > simulateObservationsInParallel(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const std::vector< std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > > >&
+        threadObservationSimulators,
+        const std::vector< SystemOfBodies >& threadBodies )
+{
+    unsigned int numberOfThreads = threadObservationSimulators.size( );
+    if( numberOfThreads == 0 )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, no observation simulators provided" );
+    }
+    else if( threadBodies.size( ) != numberOfThreads )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, number of environments (" +
+                                  std::to_string( threadBodies.size( ) ) + ") and observation simulator lists (" +
+                                  std::to_string( numberOfThreads ) + ") is not equal" );
+    }
 
-            // Simulate observations for current observable and link ends set.
-            sortedObservations[ observableType ][ linkEnds ].push_back(
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
-                            observationsToSimulate.at( i ), derivedObservationSimulator, bodies ) );
-            break;
+    // Simulate each set of observations on a single thread
+    std::vector< std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > > simulatedObservationSets(
+                observationsToSimulate.size( ) );
+    utilities::executeTasksInParallel(
+                observationsToSimulate.size( ), numberOfThreads,
+                [ & ]( const unsigned int setIndex, const unsigned int threadIndex )
+    {
+        if( threadIndex == 0 )
+        {
+            simulatedObservationSets.at( setIndex ) = simulateSingleObservationSet< ObservationScalarType, TimeType >(
+                        observationsToSimulate.at( setIndex ), threadObservationSimulators.at( 0 ), threadBodies.at( 0 ) );
         }
-        case 3:
+        else
         {
-            std::shared_ptr< observation_models::ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                    observation_models::getObservationSimulatorOfType< 3 >( observationSimulators, observableType );
+            // Compute dependent variables from thread environment, but store original calculator in output
+            std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > threadObservationSet =
+                    simulateSingleObservationSet< ObservationScalarType, TimeType >(
+                        copyObservationSimulationSettingsForEnvironment(
+                            observationsToSimulate.at( setIndex ), threadBodies.at( threadIndex ) ),
+                        threadObservationSimulators.at( threadIndex ), threadBodies.at( threadIndex ) );
+            simulatedObservationSets.at( setIndex ) =
+                    std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
+                        threadObservationSet->getObservableType( ), threadObservationSet->getLinkEnds( ),
+                        threadObservationSet->getObservationsReference( ), threadObservationSet->getObservationTimesReference( ),
+                        threadObservationSet->getReferenceLinkEnd( ),
+                        threadObservationSet->getObservationsDependentVariablesReference( ),
+                        observationsToSimulate.at( setIndex )->getDependentVariableCalculator( ),
+                        threadObservationSet->getAncilliarySettings( ) );
+        }
+    } );
 
-            if( derivedObservationSimulator == nullptr )
-            {
-                throw std::runtime_error( "Error when simulating observation: dynamic cast to size 3 is nullptr" );
-            }
+    // Sort observations in same order as serial simulation
+    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets sortedObservations;
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        sortedObservations[ observationsToSimulate.at( i )->getObservableType( ) ]
+                [ observationsToSimulate.at( i )->getLinkEnds( ).linkEnds_ ].push_back( simulatedObservationSets.at( i ) );
+    }
 
-            // Simulate observations for current observable and link ends set.
-            sortedObservations[ observableType ][ linkEnds ].push_back(
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
-                            observationsToSimulate.at( i ), derivedObservationSimulator, bodies ) );
+    return std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >( sortedObservations );
+}
 
-            break;
-        }
-        default:
-            throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
-                                      std::to_string( observationSize ) );
+//! Function to simulate observations from set of observables and link and sets, distributed over multiple threads
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, distributing the
+ *  entries of observationsToSimulate over multiple threads (see other overload of this function for details). The calling
+ *  thread uses the environment and observation simulators provided as input. For each additional thread, an independent
+ *  environment is created using the environmentCreationFunction (which must reproduce the properties of the bodies input,
+ *  including e.g. ground stations and numerically propagated ephemerides), and observation simulators are created from
+ *  the observationModelSettings (which must be the settings from which the observationSimulators were created).
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulators List of Observation simulators per link end set per observable type.
+ *  \param bodies Environment in which observations are simulated.
+ *  \param observationModelSettings Settings from which the observation simulators are created
+ *  \param environmentCreationFunction Function creating an independent copy of the environment
+ *  \param numberOfThreads Number of threads over which the simulation is distributed
+ *  \return Simulated observation values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > simulateObservationsInParallel(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const SystemOfBodies& bodies,
+        const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationModelSettings,
+        const std::function< SystemOfBodies( ) > environmentCreationFunction,
+        const unsigned int numberOfThreads )
+{
+    if( numberOfThreads == 0 )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, at least one thread is required." );
+    }
 
-        }
+    // Create environment and observation simulators for each additional thread
+    std::vector< SystemOfBodies > threadBodies = { bodies };
+    std::vector< std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > > >
+            threadObservationSimulators = { observationSimulators };
+    for( unsigned int i = 1; i < numberOfThreads; i++ )
+    {
+        threadBodies.push_back( environmentCreationFunction( ) );
+        threadObservationSimulators.push_back(
+                    observation_models::createObservationSimulators< ObservationScalarType, TimeType >(
+                        observationModelSettings, threadBodies.back( ) ) );
     }
-    std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationCollection =
-            std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >( sortedObservations );
 
-    return observationCollection;
+    return simulateObservationsInParallel< ObservationScalarType, TimeType >(
+                observationsToSimulate, threadObservationSimulators, threadBodies );
 }
 
 template< typename ObservationScalarType = double, typename TimeType = double >
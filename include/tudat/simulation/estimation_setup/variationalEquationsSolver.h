@@ -757,7 +757,8 @@ public:
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodies, parametersToEstimate, propagatorSettings != nullptr ?
                 propagatorSettings->getOutputSettingsWithCheck( )->getClearNumericalSolutions( ) : false ),
-        propagatorSettings_( std::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) )
+        propagatorSettings_( std::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) ),
+        useCompactMatrixHistory_( false ), useSinglePrecisionSensitivity_( false )
     {
         // Check input consistency
         if( std::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType, TimeType >  >( propagatorSettings ) == nullptr )
@@ -967,6 +968,36 @@ public:
         return variationalPropagationResults_;
     }
 
+    //! Function to set whether the state transition and sensitivity matrices are stored in a compact matrix history
+    /*!
+     *  Function to set whether the state transition and sensitivity matrices are stored in a compact matrix history
+     *  (see CompactStateTransitionMatrixHistory), instead of in Lagrange interpolators, after the next integration of the
+     *  variational equations. If results of the variational equations are available (and not cleared), the state
+     *  transition matrix interface is reset immediately. When the compact matrix history is used, the numerical solution
+     *  of the variational equations in the propagation results is always cleared after the compact history is created
+     *  (regardless of the clearNumericalSolution setting), so that the matrix history is only stored once; the matrices
+     *  remain accessible through the state transition matrix interface (see
+     *  SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCompactMatrixHistory). As a result, switching
+     *  back to interpolators only takes effect after the next integration of the variational equations.
+     *  This option is only available for single-arc variational equations; multi-arc and hybrid-arc solvers always use
+     *  Lagrange interpolators.
+     *  \param useCompactMatrixHistory Boolean denoting whether to use a compact matrix history
+     *  \param useSinglePrecisionSensitivity Boolean denoting whether to store the sensitivity matrices in single
+     *  precision in the compact matrix history
+     */
+    void setCompactMatrixHistorySettings( const bool useCompactMatrixHistory,
+                                          const bool useSinglePrecisionSensitivity = false )
+    {
+        useCompactMatrixHistory_ = useCompactMatrixHistory;
+        useSinglePrecisionSensitivity_ = useSinglePrecisionSensitivity;
+
+        if( variationalPropagationResults_ != nullptr &&
+                variationalPropagationResults_->getStateTransitionSolution( ).size( ) > 0 )
+        {
+            resetVariationalEquationsInterpolators( );
+        }
+    }
+
     std::shared_ptr< SimulationResults< StateScalarType, TimeType > > getVariationalPropagationResults( )
     {
         return getSingleArcVariationalPropagationResults( );
@@ -990,6 +1021,34 @@ private:
         using namespace interpolators;
         using namespace utilities;
 
+        // Create compact matrix history, if requested
+        if( useCompactMatrixHistory_ )
+        {
+            std::shared_ptr< CompactStateTransitionMatrixHistory > compactMatrixHistory =
+                    std::make_shared< CompactStateTransitionMatrixHistory >(
+                        variationalPropagationResults_->getStateTransitionSolution( ),
+                        variationalPropagationResults_->getSensitivitySolution( ),
+                        4, useSinglePrecisionSensitivity_ );
+
+            // Matrix history is retained in compact history only
+            variationalPropagationResults_->getStateTransitionSolution( ).clear( );
+            variationalPropagationResults_->getSensitivitySolution( ).clear( );
+
+            if( stateTransitionInterface_ == nullptr )
+            {
+                stateTransitionInterface_ = std::make_shared< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                            compactMatrixHistory, propagatorSettings_->getConventionalStateSize( ), parameterVectorSize_,
+                            variationalEquationsObject_->getStatePartialAdditionIndices( ) );
+            }
+            else
+            {
+                std::dynamic_pointer_cast< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                            stateTransitionInterface_ )->updateCompactMatrixHistory(
+                            compactMatrixHistory, variationalEquationsObject_->getStatePartialAdditionIndices( ) );
+            }
+            return;
+        }
+
         // Create interpolators.
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
                 stateTransitionMatrixInterpolator;
@@ -1042,6 +1101,12 @@ private:
 
     std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > variationalPropagationResults_;
 
+    //! Boolean denoting whether the state transition and sensitivity matrices are stored in a compact matrix history
+    bool useCompactMatrixHistory_;
+
+    //! Boolean denoting whether the sensitivity matrices are stored in single precision in the compact matrix history
+    bool useSinglePrecisionSensitivity_;
+
 };
 
 
@@ -1286,6 +1351,7 @@ public:
     void integrateDynamicalEquationsOfMotionOnly(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& initialStateEstimate )
     {
+        synchronizeParallelParameterValues( );
         dynamicsSimulator_->integrateEquationsOfMotion( initialStateEstimate );
     }
 
@@ -1299,6 +1365,7 @@ public:
     void integrateDynamicalEquationsOfMotionOnly(
             const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStateEstimate )
     {
+        synchronizeParallelParameterValues( );
         dynamicsSimulator_->integrateEquationsOfMotion( initialStateEstimate );
     }
 
@@ -1360,6 +1427,8 @@ public:
         // Propagate variational equations and equations of motion concurrently
         if( integrateEquationsConcurrently )
         {
+            synchronizeParallelParameterValues( );
+
             // Propagate dynamics and variational equations and store results in variationalPropagationResults_ object
             dynamicsSimulator_->template integrateEquationsOfMotion<MultiArcVariationalResults>(
                     variationalPropagationResults_, getInitialStateProvider( initialStateEstimate ));
@@ -1394,6 +1463,63 @@ public:
         return getDynamicsSimulator( );
     }
 
+    //! Function to set the arcs to be propagated concurrently
+    /*!
+     *  Function to set the arcs (dynamics and variational equations) to be propagated concurrently, distributed over a
+     *  fixed number of threads, each of which uses its own copy of the environment and propagator settings (see
+     *  MultiArcDynamicsSimulator::setParallelPropagationSettings). For each thread, the parameters to estimate are
+     *  created from the function provided here, for the copy of the environment of that thread. Before each propagation,
+     *  the values of these parameters are set to the values of the parametersToEstimate_ of this object.
+     *  \param parallelPropagationSettings Settings for concurrent propagation of the arcs (nullptr to propagate the
+     *  arcs sequentially)
+     *  \param parameterCreationFunction Function creating the parameters to estimate (identical to parametersToEstimate_)
+     *  from the bodies and propagator settings of a single thread.
+     */
+    void setParallelPropagationSettings(
+            const std::shared_ptr< MultiArcParallelPropagationSettings< StateScalarType, TimeType > > parallelPropagationSettings,
+            const std::function< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > >(
+                const simulation_setup::SystemOfBodies&,
+                const std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > ) > parameterCreationFunction )
+    {
+        dynamicsSimulator_->setParallelPropagationSettings( parallelPropagationSettings );
+        parallelParametersToEstimate_.clear( );
+        parallelArcWiseParametersToEstimate_.clear( );
+
+        if( parallelPropagationSettings != nullptr )
+        {
+            for( unsigned int i = 0; i < parallelPropagationSettings->getNumberOfThreads( ); i++ )
+            {
+                parallelParametersToEstimate_.push_back(
+                            parameterCreationFunction( dynamicsSimulator_->getParallelEnvironment( i ),
+                                                       dynamicsSimulator_->getParallelPropagatorSettings( i ) ) );
+                if( parallelParametersToEstimate_.at( i )->getParameterSetSize( ) != parametersToEstimate_->getParameterSetSize( ) )
+                {
+                    throw std::runtime_error(
+                                "Error when setting parallel multi-arc variational equations propagation, size of parameter set "
+                                "created for thread " + std::to_string( i ) + " is inconsistent with parameters to estimate" );
+                }
+
+                std::map< int, std::vector< std::string > > estimatedBodiesPerArc;
+                std::map< int, std::map< std::string, int > > arcIndicesPerBody;
+                bool areEstimatedBodiesDifferentPerArc;
+                checkMultiArcPropagatorSettingsAndParameterEstimationConsistency(
+                            dynamicsSimulator_->getParallelPropagatorSettings( i ), parallelParametersToEstimate_.at( i ),
+                            propagatorSettings_->getArcStartTimes( ), estimatedBodiesPerArc, arcIndicesPerBody,
+                            areEstimatedBodiesDifferentPerArc );
+
+                parallelArcWiseParametersToEstimate_.push_back(
+                            std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >( ) );
+                estimatable_parameters::getParametersToEstimatePerArcTest(
+                            parallelParametersToEstimate_.at( i ), parallelArcWiseParametersToEstimate_.at( i ),
+                            propagatorSettings_->getArcStartTimes( ), estimatedBodiesPerArc, arcIndicesPerBody );
+            }
+
+            dynamicsSimulator_->setParallelArcDynamicsSimulatorCreationFunction(
+                        std::bind( &MultiArcVariationalEquationsSolver< StateScalarType, TimeType >::addParallelArcVariationalEquations,
+                                   this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3 ) );
+        }
+    }
+
 
 
     //! Function to reset parameter estimate and re-integrate equations of motion and, if desired, variational equations.
@@ -1569,9 +1695,59 @@ private:
         return partialIndices;
     }
 
+    //! Function to add the variational equations to the dynamics simulator of an arc that is propagated concurrently
+    /*!
+     *  Function to add the variational equations to the dynamics simulator of an arc that is propagated concurrently (with
+     *  its own copy of the environment), called by the dynamicsSimulator_ when creating this simulator.
+     *  \param arcIndex Index of the arc
+     *  \param threadIndex Index of the thread by which the arc is propagated
+     *  \param arcDynamicsSimulator Dynamics simulator of the arc
+     */
+    void addParallelArcVariationalEquations(
+            const unsigned int arcIndex, const unsigned int threadIndex,
+            const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > arcDynamicsSimulator )
+    {
+        std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > arcStateDerivative =
+                arcDynamicsSimulator->getDynamicsStateDerivative( );
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > arcParametersToEstimate =
+                parallelArcWiseParametersToEstimate_.at( threadIndex ).at( arcIndex );
+
+        std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
+                simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
+                    arcStateDerivative->getStateDerivativeModels( ),
+                    dynamicsSimulator_->getParallelEnvironment( threadIndex ), arcParametersToEstimate );
+
+        arcStateDerivative->addVariationalEquations(
+                    std::make_shared< VariationalEquations >(
+                        stateDerivativePartials, arcParametersToEstimate, arcStateDerivative->getStateTypeStartIndices( ),
+                        arcIndex, arcIndicesPerBody_.at( arcIndex ) ) );
+    }
+
+    //! Function to set the values of the parameters of each thread (for concurrent propagation) to those of parametersToEstimate_
+    void synchronizeParallelParameterValues( )
+    {
+        for( unsigned int i = 0; i < parallelParametersToEstimate_.size( ); i++ )
+        {
+            parallelParametersToEstimate_.at( i )->template resetParameterValues< StateScalarType >(
+                        parametersToEstimate_->template getFullParameterValues< StateScalarType >( ) );
+            for( int j = 0; j < numberOfArcs_; j++ )
+            {
+                parallelArcWiseParametersToEstimate_.at( i ).at( j )->template resetParameterValues< StateScalarType >(
+                            arcWiseParametersToEstimate_.at( j )->template getFullParameterValues< StateScalarType >( ) );
+            }
+        }
+    }
+
     //! Object to propagate the dynamics for all arcs.
     std::shared_ptr< MultiArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator_;
 
+    //! Parameters to estimate for each thread (for concurrent propagation), using the associated copy of the environment.
+    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > > parallelParametersToEstimate_;
+
+    //! Arc-wise parameters to estimate for each thread (for concurrent propagation).
+    std::vector< std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > > >
+    parallelArcWiseParametersToEstimate_;
+
 //    //! Numerical solution history of integrated variational equations, per arc.
 //    /*!
 //     *  Numerical solution history of integrated variational equations, per arc.
@@ -104,11 +104,19 @@ public:
      *  Constructor to set maximum degree and order that is to be taken into account.
      *  \param maximumDegree Maximum degree
      *  \param maximumOrder Maximum order
+     *  \param evaluationAlgorithm Algorithm with which the spherical harmonic expansion is evaluated
+     *  \param degreeTruncationTolerance Tolerance (relative to point-mass acceleration) for altitude-adaptive truncation
+     *  of the expansion; no truncation is performed if not positive.
      */
     SphericalHarmonicAccelerationSettings( const int maximumDegree,
-                                           const int maximumOrder ):
+                                           const int maximumOrder,
+                                           const gravitation::SphericalHarmonicsEvaluationAlgorithm evaluationAlgorithm =
+            gravitation::term_wise_spherical_harmonics_evaluation,
+                                           const double degreeTruncationTolerance = 0.0 ):
         AccelerationSettings( basic_astrodynamics::spherical_harmonic_gravity ),
-        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ){ }
+        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ),
+        evaluationAlgorithm_( evaluationAlgorithm ),
+        degreeTruncationTolerance_( degreeTruncationTolerance ){ }
 
 
     // Maximum degree that is to be used for spherical harmonic acceleration
@@ -116,13 +124,23 @@ public:
 
     // Maximum order that is to be used for spherical harmonic acceleration
     int maximumOrder_;
+
+    // Algorithm with which the spherical harmonic expansion is evaluated
+    gravitation::SphericalHarmonicsEvaluationAlgorithm evaluationAlgorithm_;
+
+    // Tolerance for altitude-adaptive truncation of the expansion (no truncation if not positive)
+    double degreeTruncationTolerance_;
 };
 
 //! @get_docstring(sphericalHarmonicAcceleration)
 inline std::shared_ptr< AccelerationSettings > sphericalHarmonicAcceleration(
-        const int maximumDegree, const int maximumOrder )
+        const int maximumDegree, const int maximumOrder,
+        const gravitation::SphericalHarmonicsEvaluationAlgorithm evaluationAlgorithm =
+        gravitation::term_wise_spherical_harmonics_evaluation,
+        const double degreeTruncationTolerance = 0.0 )
 {
-    return std::make_shared< SphericalHarmonicAccelerationSettings >( maximumDegree, maximumOrder );
+    return std::make_shared< SphericalHarmonicAccelerationSettings >(
+                maximumDegree, maximumOrder, evaluationAlgorithm, degreeTruncationTolerance );
 }
 
 // Class for providing acceleration settings for mutual spherical harmonics acceleration model.
@@ -199,9 +217,32 @@ inline std::shared_ptr< AccelerationSettings > mutualSphericalHarmonicAccelerati
 			);
 }
 
-inline std::shared_ptr< AccelerationSettings > polyhedronAcceleration( )
+// Class for providing settings for polyhedron gravitational acceleration.
+/*
+ *  Class for providing settings for polyhedron gravitational acceleration, allowing the evaluation of the sums over
+ *  the polyhedron facets and edges to be distributed over multiple threads (which is beneficial for shape models with
+ *  a large number of facets).
+ */
+class PolyhedronAccelerationSettings: public AccelerationSettings
+{
+public:
+
+    // Constructor
+    /*
+     * Constructor
+     * \param numberOfThreads Number of threads over which the facets and edges are distributed.
+     */
+    PolyhedronAccelerationSettings( const unsigned int numberOfThreads = 1 ):
+        AccelerationSettings( basic_astrodynamics::polyhedron_gravity ),
+        numberOfThreads_( numberOfThreads ){ }
+
+    // Number of threads over which the facets and edges are distributed.
+    unsigned int numberOfThreads_;
+};
+
+inline std::shared_ptr< AccelerationSettings > polyhedronAcceleration( const unsigned int numberOfThreads = 1 )
 {
-    return std::make_shared< AccelerationSettings >( basic_astrodynamics::polyhedron_gravity );
+    return std::make_shared< PolyhedronAccelerationSettings >( numberOfThreads );
 }
 
 inline std::shared_ptr< AccelerationSettings > ringAcceleration( )
@@ -209,6 +250,70 @@ inline std::shared_ptr< AccelerationSettings > ringAcceleration( )
     return std::make_shared< AccelerationSettings >( basic_astrodynamics::ring_gravity );
 }
 
+// Class for providing settings for gravitational acceleration from a precomputed gravity field grid.
+/*
+ *  Class for providing settings for gravitational acceleration from a precomputed gravity field grid. The grid is
+ *  generated (when creating the acceleration model) from the gravity field model of the body exerting the acceleration,
+ *  as defined by its gravity field settings, in the given radial range, and the acceleration is subsequently retrieved
+ *  by interpolation (see GravityFieldGrid).
+ */
+class GriddedGravityAccelerationSettings: public AccelerationSettings
+{
+public:
+
+    // Constructor
+    /*
+     * Constructor
+     * \param minimumRadius Inner radius of the grid.
+     * \param maximumRadius Outer radius of the grid.
+     * \param relativeTolerance Tolerance on interpolation error, relative to the point-mass acceleration.
+     * \param numberOfInterpolationPoints Number of nodes per dimension used in interpolation.
+     * \param layerRadiusRatio Ratio of outer and inner radius of each of the radial layers of the grid.
+     * \param maximumNumberOfNodesPerLayer Maximum number of nodes per radial layer of the grid.
+     */
+    GriddedGravityAccelerationSettings( const double minimumRadius,
+                                        const double maximumRadius,
+                                        const double relativeTolerance = 1.0E-9,
+                                        const int numberOfInterpolationPoints = 6,
+                                        const double layerRadiusRatio = 1.2,
+                                        const int maximumNumberOfNodesPerLayer = 4000000 ):
+        AccelerationSettings( basic_astrodynamics::gridded_gravity ),
+        minimumRadius_( minimumRadius ), maximumRadius_( maximumRadius ),
+        relativeTolerance_( relativeTolerance ), numberOfInterpolationPoints_( numberOfInterpolationPoints ),
+        layerRadiusRatio_( layerRadiusRatio ), maximumNumberOfNodesPerLayer_( maximumNumberOfNodesPerLayer ){ }
+
+    // Inner radius of the grid.
+    double minimumRadius_;
+
+    // Outer radius of the grid.
+    double maximumRadius_;
+
+    // Tolerance on interpolation error, relative to the point-mass acceleration.
+    double relativeTolerance_;
+
+    // Number of nodes per dimension used in interpolation.
+    int numberOfInterpolationPoints_;
+
+    // Ratio of outer and inner radius of each of the radial layers of the grid.
+    double layerRadiusRatio_;
+
+    // Maximum number of nodes per radial layer of the grid.
+    int maximumNumberOfNodesPerLayer_;
+};
+
+inline std::shared_ptr< AccelerationSettings > griddedGravityAcceleration(
+        const double minimumRadius,
+        const double maximumRadius,
+        const double relativeTolerance = 1.0E-9,
+        const int numberOfInterpolationPoints = 6,
+        const double layerRadiusRatio = 1.2,
+        const int maximumNumberOfNodesPerLayer = 4000000 )
+{
+    return std::make_shared< GriddedGravityAccelerationSettings >(
+                minimumRadius, maximumRadius, relativeTolerance, numberOfInterpolationPoints,
+                layerRadiusRatio, maximumNumberOfNodesPerLayer );
+}
+
 // Class to provide settings for typical relativistic corrections to the dynamics of an orbiter.
 /*
  *  Class to provide settings for typical relativistic corrections to the dynamics of an orbiter: the
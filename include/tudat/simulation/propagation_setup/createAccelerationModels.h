@@ -204,6 +204,8 @@ createMutualSphericalHarmonicsGravityAcceleration(
  *  \param nameOfBodyUndergoingAcceleration Name of body that is being accelerated.
  *  \param nameOfBodyExertingAcceleration Name of body that is exerting the spherical harmonic
  *  gravity acceleration.
+ *  \param useCentralBodyFixedFrame Boolean setting whether the central body-fixed frame is used for the propagation.
+ *  \param numberOfThreads Number of threads over which the polyhedron facets and edges are distributed.
  *  \return Polyhedron gravity acceleration model pointer.
  */
 std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel >
@@ -212,7 +214,8 @@ createPolyhedronGravityAcceleration(
         const std::shared_ptr< Body > bodyExertingAcceleration,
         const std::string& nameOfBodyUndergoingAcceleration,
         const std::string& nameOfBodyExertingAcceleration,
-        const bool useCentralBodyFixedFrame);
+        const bool useCentralBodyFixedFrame,
+        const unsigned int numberOfThreads = 1 );
 
 //! Function to create ring gravity acceleration model.
 /*!
@@ -434,6 +437,26 @@ std::shared_ptr< gravitation::DirectTidalDissipationAcceleration > createDirectT
         const std::string& nameOfBodyExertingAcceleration,
         const  std::shared_ptr< AccelerationSettings > accelerationSettings );
 
+//! Function to create gravitational acceleration model from a precomputed gravity field grid.
+/*!
+ *  Function to create gravitational acceleration model from a precomputed gravity field grid. The grid is generated
+ *  from the gravity field model of the body exerting the acceleration, in the body-fixed frame of that body.
+ *  \param bodyUndergoingAcceleration Pointer to object of body that is being accelerated.
+ *  \param bodyExertingAcceleration Pointer to object of body that is exerting the acceleration.
+ *  \param nameOfBodyUndergoingAcceleration Name of object of body that is being accelerated.
+ *  \param nameOfBodyExertingAcceleration Name of object of body that is exerting the acceleration.
+ *  \param accelerationSettings Settings for the acceleration model (of type GriddedGravityAccelerationSettings).
+ *  \param useCentralBodyFixedFrame Boolean setting whether the gravitational parameters of the two bodies are summed.
+ *  \return Pointer to object for calculating acceleration.
+ */
+std::shared_ptr< gravitation::GriddedGravitationalAccelerationModel > createGriddedGravityAcceleration(
+        const std::shared_ptr< Body > bodyUndergoingAcceleration,
+        const std::shared_ptr< Body > bodyExertingAcceleration,
+        const std::string& nameOfBodyUndergoingAcceleration,
+        const std::string& nameOfBodyExertingAcceleration,
+        const std::shared_ptr< AccelerationSettings > accelerationSettings,
+        const bool useCentralBodyFixedFrame );
+
 //! Function to create a momentum wheel desaturation acceleration model.
 /*!
  *  Function to create a momentum wheel desaturation acceleration model.
@@ -18,6 +18,7 @@
 #include <Eigen/Core>
 
 #include "tudat/math/interpolators/oneDimensionalInterpolator.h"
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
 #include "tudat/simulation/propagation_setup/propagationOutputSettings.h"
 #include "tudat/simulation/propagation_setup/propagationOutput.h"
 
@@ -61,6 +62,15 @@ public:
     virtual Eigen::VectorXd getSingleDependentVariable(
         const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
         const TimeType evaluationTime ) = 0;
+
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with copies of the dependent variable interpolators and look-up schemes, so
+     * that it can be used concurrently with the original (e.g. for computing observation partials on multiple threads). The
+     * copy is not updated when the interpolators of the original are reset.
+     * \return Copy of this object that can be used independently of the original
+     */
+    virtual std::shared_ptr< DependentVariablesInterface< TimeType > > createIndependentCopy( ) = 0;
 //
 //    //! Function to get the value of a single dependent variable at a given time, from the dependent variable ID.
 //    virtual Eigen::VectorXd getSingleDependentVariable(
@@ -238,6 +248,21 @@ public:
         return dependentVariablesIdsAndIndices_;
     }
 
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with a copy of the dependent variable interpolator, so that it can be used
+     * concurrently with the original.
+     * \return Copy of this object that can be used independently of the original
+     */
+    std::shared_ptr< DependentVariablesInterface< TimeType > > createIndependentCopy( )
+    {
+        std::shared_ptr< SingleArcDependentVariablesInterface< TimeType > > interfaceCopy =
+                std::make_shared< SingleArcDependentVariablesInterface< TimeType > >( *this );
+        interfaceCopy->dependentVariablesInterpolator_ =
+                interpolators::createIndependentLagrangeInterpolatorCopy( dependentVariablesInterpolator_ );
+        return interfaceCopy;
+    }
+
 private:
 
 
@@ -418,6 +443,32 @@ public:
         return numberArcs_;
     }
 
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with independent copies of the single-arc interfaces and of the arc look-up
+     * scheme, so that it can be used concurrently with the original.
+     * \return Copy of this object that can be used independently of the original
+     */
+    std::shared_ptr< DependentVariablesInterface< TimeType > > createIndependentCopy( )
+    {
+        std::shared_ptr< MultiArcDependentVariablesInterface< TimeType > > interfaceCopy =
+                std::make_shared< MultiArcDependentVariablesInterface< TimeType > >( *this );
+        for( unsigned int i = 0; i < singleArcInterfaces_.size( ); i++ )
+        {
+            interfaceCopy->singleArcInterfaces_.at( i ) =
+                    std::dynamic_pointer_cast< SingleArcDependentVariablesInterface< TimeType > >(
+                        singleArcInterfaces_.at( i )->createIndependentCopy( ) );
+        }
+
+        if( lookUpscheme_ != nullptr )
+        {
+            std::vector< double > arcSplitTimes = arcStartTimes_;
+            arcSplitTimes.push_back( std::numeric_limits< double >::max( ) );
+            interfaceCopy->lookUpscheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >( arcSplitTimes );
+        }
+        return interfaceCopy;
+    }
+
 
 private:
 
@@ -502,6 +553,26 @@ public:
 
         return dependentVariables;
     }
+
+    //! Function to create a copy of this object that can be used independently of the original
+    /*!
+     * Function to create a copy of this object, with independent copies of the single- and multi-arc interfaces, so that it
+     * can be used concurrently with the original.
+     * \return Copy of this object that can be used independently of the original
+     */
+    std::shared_ptr< DependentVariablesInterface< TimeType > > createIndependentCopy( )
+    {
+        std::shared_ptr< HybridArcDependentVariablesInterface< TimeType > > interfaceCopy =
+                std::make_shared< HybridArcDependentVariablesInterface< TimeType > >( *this );
+        interfaceCopy->singleArcInterface_ =
+                std::dynamic_pointer_cast< SingleArcDependentVariablesInterface< TimeType > >(
+                    singleArcInterface_->createIndependentCopy( ) );
+        interfaceCopy->multiArcInterface_ =
+                std::dynamic_pointer_cast< MultiArcDependentVariablesInterface< TimeType > >(
+                    multiArcInterface_->createIndependentCopy( ) );
+        return interfaceCopy;
+    }
+
 private:
 
     //! Object to retrieve dependent variable for single arc component
@@ -19,6 +19,7 @@
 
 #include "tudat/basics/tudatTypeTraits.h"
 #include "tudat/basics/utilities.h"
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/ephemerides/frameManager.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
@@ -1139,6 +1140,7 @@ public:
      */
     const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolutionRaw( )
     {
+        propagationResults_->updateHistoryMaps( );
         return propagationResults_->equationsOfMotionNumericalSolutionRaw_;
     }
 
@@ -1149,6 +1151,7 @@ public:
      */
     const std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
     {
+        propagationResults_->updateHistoryMaps( );
         return propagationResults_->dependentVariableHistory_;
     }
 
@@ -1159,9 +1162,36 @@ public:
      */
     std::map< TimeType, double > getCumulativeComputationTimeHistory( )
     {
+        propagationResults_->updateHistoryMaps( );
         return propagationResults_->cumulativeComputationTimeHistory_;
     }
 
+    //! Function to return the state history of numerically integrated bodies, in propagation coordinates, as contiguous
+    //! history (in order of propagation).
+    /*!
+     * Function to return the state history of numerically integrated bodies, in propagation coordinates, as contiguous
+     * history (in order of propagation). Unlike getEquationsOfMotionNumericalSolutionRaw, this does not require a map
+     * to be created from the propagation results.
+     * \return State history of numerically integrated bodies, in propagation coordinates.
+     */
+    const PropagationHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionRawHistory( )
+    {
+        return propagationResults_->getEquationsOfMotionNumericalSolutionRawHistory( );
+    }
+
+    //! Function to return the dependent variable history that was saved during numerical propagation, as contiguous
+    //! history (in order of propagation).
+    /*!
+     * Function to return the dependent variable history that was saved during numerical propagation, as contiguous
+     * history (in order of propagation). Unlike getDependentVariableHistory, this does not require a map to be created
+     * from the propagation results.
+     * \return Dependent variable history that was saved during numerical propagation.
+     */
+    const PropagationHistory< TimeType, double >& getDependentVariableFlatHistory( )
+    {
+        return propagationResults_->getDependentVariableFlatHistory( );
+    }
+
     //! Function to return the map of number of cumulative function evaluations that was saved during numerical propagation.
     /*!
      * Function to return the map of cumulative number of function evaluations that was saved during numerical propagation.
@@ -1375,6 +1405,7 @@ private:
      *  Function to perform steps necessary to finalize the propagation
      *  - Store number of function evaluations in the results object
      *  - Print messages to terminal, as requested by user settings
+     *  - Stop caching ephemeris states and rotations in the environment (see SystemOfBodies::startEphemerisStateCacheStage)
      *  - Update the environment (e.g. use numerical results to create tabulated ephemerides and similar for other dynamics)
      *    if requested by user
      */
@@ -1388,6 +1419,9 @@ private:
                 outputSettings_->getPrintSettings( ),
                                                outputSettings_->getPropagationEndHeader( ),
                                                propagationResults );
+
+        // Stop caching ephemeris states/rotations, as the environment may be modified after the propagation
+        this->bodies_.invalidateEphemerisStateCache( );
         processNumericalEquationsOfMotionSolution( );
     }
 };
@@ -1681,6 +1715,42 @@ void checkPropagationResultsObjectConsistency(
     }
 }
 
+//! Function to create the results object for a single arc that is propagated concurrently with other arcs (dynamics only)
+/*!
+ *  Function to create the results object for a single arc that is propagated concurrently with other arcs, for a
+ *  propagation of the dynamics only.
+ *  \param arcDynamicsSimulator Dynamics simulator with which the arc is propagated (using its own copy of the environment)
+ *  \param arcPropagationResults Results object of the arc in the main multi-arc results
+ *  \return Results object in which the propagation by arcDynamicsSimulator is to be stored
+ */
+template< typename StateScalarType, typename TimeType >
+std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > createParallelArcPropagationResults(
+        const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > arcDynamicsSimulator,
+        const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > arcPropagationResults )
+{
+    return arcDynamicsSimulator->getSingleArcPropagationResults( );
+}
+
+//! Function to create the results object for a single arc that is propagated concurrently with other arcs (dynamics and
+//! variational equations)
+/*!
+ *  Function to create the results object for a single arc that is propagated concurrently with other arcs, for a
+ *  propagation of the dynamics and variational equations.
+ *  \param arcDynamicsSimulator Dynamics simulator with which the arc is propagated (using its own copy of the environment)
+ *  \param arcPropagationResults Results object of the arc in the main multi-arc results
+ *  \return Results object in which the propagation by arcDynamicsSimulator is to be stored
+ */
+template< typename StateScalarType, typename TimeType >
+std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > createParallelArcPropagationResults(
+        const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > arcDynamicsSimulator,
+        const std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > arcPropagationResults )
+{
+    return std::make_shared< SingleArcVariationalSimulationResults< StateScalarType, TimeType > >(
+                arcDynamicsSimulator->getSingleArcPropagationResults( ),
+                arcPropagationResults->getStateTransitionMatrixSize( ),
+                arcPropagationResults->getSensitivityMatrixSize( ) );
+}
+
 //! Class for performing full numerical integration of a dynamical system over multiple arcs.
 /*!
  *  Class for performing full numerical integration of a dynamical system over multiple arcs, equations of motion are set up
@@ -1882,14 +1952,25 @@ public:
         printPrePropagationMessages( );
 
 
-        // Propagate dynamics for each arc
-        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        // Propagate dynamics for each arc, concurrently if possible
+        if( parallelPropagationSettings_ != nullptr && !areArcInitialStatesLinked( initialStateProvider ) )
         {
-            currentArcInitialState = getArcInitialState( i, initialStateProvider );
-            arcInitialStateList.push_back( currentArcInitialState );
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+            {
+                arcInitialStateList.push_back( getArcInitialState( i, initialStateProvider ) );
+            }
+            propagateArcsInParallel< MultiArcSimulationResults >( propagationResults, arcInitialStateList );
+        }
+        else
+        {
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+            {
+                currentArcInitialState = getArcInitialState( i, initialStateProvider );
+                arcInitialStateList.push_back( currentArcInitialState );
 
-            singleArcDynamicsSimulators_.at( i )->template integrateEquationsOfMotion<
-                    typename MultiArcSimulationResults::single_arc_type >( currentArcInitialState, propagationResults->getSingleArcResults( ).at( i ) );
+                singleArcDynamicsSimulators_.at( i )->template integrateEquationsOfMotion<
+                        typename MultiArcSimulationResults::single_arc_type >( currentArcInitialState, propagationResults->getSingleArcResults( ).at( i ) );
+            }
         }
 
         printPostPropagationMessages( );
@@ -2028,6 +2109,88 @@ public:
         return propagationResults_;
     }
 
+    //! Function to set the arcs to be propagated concurrently
+    /*!
+     *  Function to set the arcs to be propagated concurrently, distributed over a fixed number of threads (arc i is
+     *  propagated by thread i modulo the number of threads). For each thread, a copy of the environment and of the
+     *  propagator settings is created (serially) from the functions in the parallelPropagationSettings. The arcs are only
+     *  propagated concurrently if their initial states are not taken from the propagation of the preceding arc. After
+     *  propagating all arcs, the results are stored in (and post-processed by) this object, which uses the original
+     *  environment. Note that the copies of the environment are not updated by the results of a propagation (e.g. the
+     *  ephemerides of propagated bodies are only reset in the original environment).
+     *  \param parallelPropagationSettings Settings for concurrent propagation of the arcs (nullptr to propagate the
+     *  arcs sequentially)
+     */
+    void setParallelPropagationSettings(
+            const std::shared_ptr< MultiArcParallelPropagationSettings< StateScalarType, TimeType > > parallelPropagationSettings )
+    {
+        parallelPropagationSettings_ = parallelPropagationSettings;
+        parallelEnvironments_.clear( );
+        parallelPropagatorSettings_.clear( );
+        parallelArcDynamicsSimulators_.clear( );
+
+        if( parallelPropagationSettings_ != nullptr )
+        {
+            for( unsigned int i = 0; i < parallelPropagationSettings_->getNumberOfThreads( ); i++ )
+            {
+                parallelEnvironments_.push_back( parallelPropagationSettings_->getEnvironmentCreationFunction( )( ) );
+                parallelPropagatorSettings_.push_back(
+                            parallelPropagationSettings_->getPropagatorSettingsCreationFunction( )( parallelEnvironments_.at( i ) ) );
+                if( parallelPropagatorSettings_.at( i )->getSingleArcSettings( ).size( ) != singleArcDynamicsSimulators_.size( ) )
+                {
+                    throw std::runtime_error(
+                                "Error when setting parallel multi-arc propagation, number of arcs created for thread " +
+                                std::to_string( i ) + " (" +
+                                std::to_string( parallelPropagatorSettings_.at( i )->getSingleArcSettings( ).size( ) ) +
+                                ") is inconsistent with number of propagated arcs (" +
+                                std::to_string( singleArcDynamicsSimulators_.size( ) ) + ")" );
+                }
+
+                // Printing of the arcs is done from the main thread only
+                for( auto arcSettings: parallelPropagatorSettings_.at( i )->getSingleArcSettings( ) )
+                {
+                    arcSettings->getOutputSettings( )->getPrintSettings( )->disableAllPrinting( );
+                }
+            }
+            parallelArcDynamicsSimulators_.resize( singleArcDynamicsSimulators_.size( ) );
+        }
+    }
+
+    //! Function to set a function that is called when creating the dynamics simulator of an arc for concurrent propagation
+    /*!
+     *  Function to set a function that is called when creating the dynamics simulator of an arc for concurrent propagation,
+     *  for instance to add the variational equations to it (called from the thread propagating the arc).
+     *  \param parallelArcDynamicsSimulatorCreationFunction Function called with the index of the arc, the index of the
+     *  thread, and the newly created dynamics simulator for the arc.
+     */
+    void setParallelArcDynamicsSimulatorCreationFunction(
+            const std::function< void( const unsigned int, const unsigned int,
+                                       const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > ) >
+            parallelArcDynamicsSimulatorCreationFunction )
+    {
+        parallelArcDynamicsSimulatorCreationFunction_ = parallelArcDynamicsSimulatorCreationFunction;
+        parallelArcDynamicsSimulators_.assign( parallelArcDynamicsSimulators_.size( ), nullptr );
+    }
+
+    //! Function to retrieve the settings for concurrent propagation of the arcs (nullptr if arcs are propagated sequentially)
+    std::shared_ptr< MultiArcParallelPropagationSettings< StateScalarType, TimeType > > getParallelPropagationSettings( )
+    {
+        return parallelPropagationSettings_;
+    }
+
+    //! Function to retrieve the copy of the environment used by a given thread for concurrent propagation of the arcs
+    const simulation_setup::SystemOfBodies& getParallelEnvironment( const unsigned int threadIndex )
+    {
+        return parallelEnvironments_.at( threadIndex );
+    }
+
+    //! Function to retrieve the propagator settings used by a given thread for concurrent propagation of the arcs
+    std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > getParallelPropagatorSettings(
+            const unsigned int threadIndex )
+    {
+        return parallelPropagatorSettings_.at( threadIndex );
+    }
+
 
 
 
@@ -2131,6 +2294,82 @@ public:
 
 protected:
 
+    //! Function to check whether the initial state of any arc is to be taken from the propagation of the preceding arc
+    bool areArcInitialStatesLinked( const std::shared_ptr< MultiArcInitialStateProvider< StateScalarType > > initialStateProvider )
+    {
+        bool initialStatesAreLinked = false;
+        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        {
+            bool initialStateFromPreviousArc = false;
+            initialStateProvider->getArcInitialState( i, initialStateFromPreviousArc );
+            if( initialStateFromPreviousArc )
+            {
+                initialStatesAreLinked = true;
+            }
+        }
+        initialStateProvider->restartPropagation( );
+        return initialStatesAreLinked;
+    }
+
+    //! Function to retrieve the dynamics simulator of an arc for concurrent propagation (created on first use)
+    std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > getParallelArcDynamicsSimulator(
+            const unsigned int arcIndex, const unsigned int threadIndex )
+    {
+        if( parallelArcDynamicsSimulators_.at( arcIndex ) == nullptr )
+        {
+            parallelArcDynamicsSimulators_.at( arcIndex ) =
+                    std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                        parallelEnvironments_.at( threadIndex ),
+                        parallelPropagatorSettings_.at( threadIndex )->getSingleArcSettings( ).at( arcIndex ), false );
+            if( parallelArcDynamicsSimulatorCreationFunction_ != nullptr )
+            {
+                parallelArcDynamicsSimulatorCreationFunction_(
+                            arcIndex, threadIndex, parallelArcDynamicsSimulators_.at( arcIndex ) );
+            }
+        }
+        return parallelArcDynamicsSimulators_.at( arcIndex );
+    }
+
+    //! Function to propagate all arcs concurrently
+    /*!
+     *  Function to propagate all arcs concurrently, using the copies of the environment created for each thread, and to
+     *  subsequently store the results in the propagationResults (from the calling thread).
+     *  \param propagationResults Object in which the results of the propagation are to be stored
+     *  \param arcInitialStates Initial state of each arc
+     */
+    template< typename MultiArcSimulationResults >
+    void propagateArcsInParallel(
+            const std::shared_ptr< MultiArcSimulationResults > propagationResults,
+            const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, MultiArcSimulationResults::single_arc_type::number_of_columns > >&
+            arcInitialStates )
+    {
+        typedef typename MultiArcSimulationResults::single_arc_type SingleArcResults;
+
+        std::vector< std::shared_ptr< SingleArcResults > > parallelArcResults( singleArcDynamicsSimulators_.size( ) );
+        utilities::executeTasksInParallel(
+                    singleArcDynamicsSimulators_.size( ), parallelPropagationSettings_->getNumberOfThreads( ),
+                    [ & ]( const unsigned int arcIndex, const unsigned int threadIndex )
+        {
+            std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > arcDynamicsSimulator =
+                    getParallelArcDynamicsSimulator( arcIndex, threadIndex );
+            arcDynamicsSimulator->resetInitialPropagationTime(
+                        singleArcDynamicsSimulators_.at( arcIndex )->getInitialPropagationTime( ) );
+
+            parallelArcResults.at( arcIndex ) = createParallelArcPropagationResults(
+                        arcDynamicsSimulator, propagationResults->getSingleArcResults( ).at( arcIndex ) );
+            arcDynamicsSimulator->template integrateEquationsOfMotion< SingleArcResults >(
+                        arcInitialStates.at( arcIndex ), parallelArcResults.at( arcIndex ) );
+        } );
+
+        // Store and post-process results using the original environment
+        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        {
+            propagationResults->getSingleArcResults( ).at( i )->copyPropagationResults( parallelArcResults.at( i ) );
+            parallelArcResults.at( i )->clearSolutionMaps( );
+            singleArcDynamicsSimulators_.at( i )->processNumericalEquationsOfMotionSolution( );
+        }
+    }
+
     //! Objects used to compute the dynamics of the sepatrate arcs
     std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators_;
 
@@ -2139,6 +2378,24 @@ protected:
 
     std::shared_ptr< MultiArcResults > propagationResults_;
 
+    //! Settings for concurrent propagation of the arcs (nullptr if arcs are propagated sequentially)
+    std::shared_ptr< MultiArcParallelPropagationSettings< StateScalarType, TimeType > > parallelPropagationSettings_;
+
+    //! Copy of the environment for each thread, used for concurrent propagation of the arcs
+    std::vector< simulation_setup::SystemOfBodies > parallelEnvironments_;
+
+    //! Propagator settings for each thread (using the associated copy of the environment)
+    std::vector< std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > > parallelPropagatorSettings_;
+
+    //! Dynamics simulator for each arc, used for concurrent propagation of the arcs (using the environment of the thread
+    //! by which the arc is propagated)
+    std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > parallelArcDynamicsSimulators_;
+
+    //! Function called when creating the dynamics simulator of an arc for concurrent propagation
+    std::function< void( const unsigned int, const unsigned int,
+                         const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > ) >
+    parallelArcDynamicsSimulatorCreationFunction_;
+
 };
 
 
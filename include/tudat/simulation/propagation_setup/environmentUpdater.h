@@ -105,6 +105,9 @@ public:
                                       std::to_string( integratedStates_.size( ) ) );
         }
 
+        // Invalidate cached ephemeris states/rotations of previous stage, and cache those computed during this stage
+        bodyList_.startEphemerisStateCacheStage( );
+
         for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
         {
             resetFunctionVector_.at( i ).template get< 2 >( )( );
@@ -8,6 +8,7 @@
 #include <map>
 #include <string>
 
+#include "tudat/astro/propagators/propagationHistory.h"
 #include "tudat/simulation/propagation_setup/propagationProcessingSettings.h"
 #include "tudat/simulation/propagation_setup/propagationTermination.h"
 #include "tudat/simulation/propagation_setup/dependentVariablesInterface.h"
@@ -105,13 +106,37 @@ namespace tudat
             
             void manuallySetSecondaryData( const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > resultsToCopy )
             {
+                updateHistoryMaps( );
                 dependentVariableHistory_ = resultsToCopy->getDependentVariableHistory( );
                 cumulativeComputationTimeHistory_ =  resultsToCopy->getCumulativeComputationTimeHistory( );
+                dependentVariableFlatHistory_.clear( );
+                cumulativeComputationTimeFlatHistory_.clear( );
                 cumulativeNumberOfFunctionEvaluations_ =  resultsToCopy->getCumulativeNumberOfFunctionEvaluations( );
                 propagationTerminationReason_ = resultsToCopy->getPropagationTerminationReason( );
                 propagationIsPerformed_ = true;
             }
 
+            //! Function to set the numerical results of a propagation from a results object of the same dynamics
+            /*
+             *  Function to set the numerical results of a propagation from a results object of the same dynamics, but
+             *  propagated using a different copy of the environment (e.g. for concurrent propagation of multiple arcs).
+             *  The processed solution is recomputed by this object, so that it uses its own environment.
+             */
+            void copyPropagationResults( const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > resultsToCopy )
+            {
+                reset( );
+                equationsOfMotionNumericalSolutionRawHistory_ = resultsToCopy->getEquationsOfMotionNumericalSolutionRawHistory( );
+                dependentVariableFlatHistory_ = resultsToCopy->getDependentVariableFlatHistory( );
+                cumulativeComputationTimeFlatHistory_ = resultsToCopy->getCumulativeComputationTimeFlatHistory( );
+                cumulativeNumberOfFunctionEvaluations_ = resultsToCopy->getCumulativeNumberOfFunctionEvaluations( );
+                historyMapsAreOutdated_ = true;
+
+                rawSolutionConversionFunction_( equationsOfMotionNumericalSolution_,
+                                                equationsOfMotionNumericalSolutionRawHistory_.createMap( ) );
+                propagationTerminationReason_ = resultsToCopy->getPropagationTerminationReason( );
+                propagationIsPerformed_ = true;
+            }
+
             //! Function that sets new numerical results of a propagation, after the propagation of the dynamics
             void reset(
                     const std::map <TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >>& equationsOfMotionNumericalSolutionRaw,
@@ -146,6 +171,44 @@ namespace tudat
 
             }
 
+            //! Function that sets new numerical results of a propagation, after the propagation of the dynamics, from
+            //! contiguous histories
+            /*
+             *  Function that sets new numerical results of a propagation, after the propagation of the dynamics, from
+             *  contiguous histories (as produced by the propagation). The histories are stored as they are, and the
+             *  maps of the unprocessed solution, dependent variables and computation time are only created when they are
+             *  first requested (by the respective get functions). For non-sequential propagations, the two propagation
+             *  legs are merged in the maps, so these are created directly.
+             */
+            void reset(
+                    PropagationHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw,
+                    PropagationHistory< TimeType, double > dependentVariableHistory,
+                    PropagationHistory< TimeType, double > cumulativeComputationTimeHistory,
+                    const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
+                    std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
+            {
+                if( !sequentialPropagation_ )
+                {
+                    reset( equationsOfMotionNumericalSolutionRaw.createMap( ),
+                           dependentVariableHistory.template createMap< Eigen::VectorXd >( ),
+                           cumulativeComputationTimeHistory.createScalarMap( ),
+                           cumulativeNumberOfFunctionEvaluations, propagationTerminationReason );
+                    return;
+                }
+
+                reset( );
+                equationsOfMotionNumericalSolutionRawHistory_ = std::move( equationsOfMotionNumericalSolutionRaw );
+                dependentVariableFlatHistory_ = std::move( dependentVariableHistory );
+                cumulativeComputationTimeFlatHistory_ = std::move( cumulativeComputationTimeHistory );
+                cumulativeNumberOfFunctionEvaluations_ = cumulativeNumberOfFunctionEvaluations;
+                historyMapsAreOutdated_ = true;
+
+                // Create processed solution from a temporary map of the unprocessed solution
+                rawSolutionConversionFunction_( equationsOfMotionNumericalSolution_,
+                                                equationsOfMotionNumericalSolutionRawHistory_.createMap( ) );
+                propagationTerminationReason_ = propagationTerminationReason;
+            }
+
             //! Function to clear all maps with numerical results, but *not* signal that a new propagation will start,
             //! this is typically done to save memory usage (and is called using the clearNumericalSolution setting
             //! of the PropagatorProcessingSettings
@@ -156,13 +219,23 @@ namespace tudat
                 dependentVariableHistory_.clear();
                 cumulativeComputationTimeHistory_.clear();
                 cumulativeNumberOfFunctionEvaluations_.clear();
+                equationsOfMotionNumericalSolutionRawHistory_.clear( );
+                dependentVariableFlatHistory_.clear( );
+                cumulativeComputationTimeFlatHistory_.clear( );
+                historyMapsAreOutdated_ = false;
                 solutionIsCleared_ = true;
             }
 
             //! Get initial and final propagation time from raw results
             std::pair< TimeType, TimeType > getArcInitialAndFinalTime( )
             {
-                if( equationsOfMotionNumericalSolutionRaw_.size( ) == 0 )
+                if( historyMapsAreOutdated_ && !equationsOfMotionNumericalSolutionRawHistory_.empty( ) )
+                {
+                    auto timeBounds = std::minmax_element( equationsOfMotionNumericalSolutionRawHistory_.getTimes( ).begin( ),
+                                                           equationsOfMotionNumericalSolutionRawHistory_.getTimes( ).end( ) );
+                    return std::make_pair( *timeBounds.first, *timeBounds.second );
+                }
+                else if( equationsOfMotionNumericalSolutionRaw_.size( ) == 0 )
                 {
                     throw std::runtime_error( "Error when getting single-arc dynamics initial and final times; no results set" );
                 }
@@ -216,24 +289,67 @@ namespace tudat
             getEquationsOfMotionNumericalSolutionRaw( )
             {
                 checkAvailabilityOfSolution( "equations of motion unprocessed numerical solution" );
+                updateHistoryMaps( );
                 return equationsOfMotionNumericalSolutionRaw_;
             }
 
             std::map <TimeType, Eigen::VectorXd> &getDependentVariableHistory( )
             {
                 checkAvailabilityOfSolution( "dependent variable history", false );
+                updateHistoryMaps( );
                 return dependentVariableHistory_;
             }
 
             std::map<TimeType, double> &getCumulativeComputationTimeHistory( )
             {
                 checkAvailabilityOfSolution( "cumulative computation time history", false );
+                updateHistoryMaps( );
                 return cumulativeComputationTimeHistory_;
             }
 
+            //! Function to retrieve the unprocessed numerical solution as contiguous history (in order of propagation),
+            //! which allows access to the full solution without copying
+            const PropagationHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionRawHistory( )
+            {
+                checkAvailabilityOfSolution( "equations of motion unprocessed numerical solution" );
+                if( equationsOfMotionNumericalSolutionRawHistory_.empty( ) )
+                {
+                    equationsOfMotionNumericalSolutionRawHistory_.appendMap( equationsOfMotionNumericalSolutionRaw_ );
+                }
+                return equationsOfMotionNumericalSolutionRawHistory_;
+            }
+
+            //! Function to retrieve the dependent variables as contiguous history (in order of propagation),
+            //! which allows access to the full history without copying
+            const PropagationHistory< TimeType, double >& getDependentVariableFlatHistory( )
+            {
+                checkAvailabilityOfSolution( "dependent variable history", false );
+                if( dependentVariableFlatHistory_.empty( ) )
+                {
+                    dependentVariableFlatHistory_.appendMap( dependentVariableHistory_ );
+                }
+                return dependentVariableFlatHistory_;
+            }
+
+            //! Function to retrieve the cumulative computation time as contiguous history (in order of propagation)
+            const PropagationHistory< TimeType, double >& getCumulativeComputationTimeFlatHistory( )
+            {
+                checkAvailabilityOfSolution( "cumulative computation time history", false );
+                if( cumulativeComputationTimeFlatHistory_.empty( ) )
+                {
+                    cumulativeComputationTimeFlatHistory_.appendMap( cumulativeComputationTimeHistory_ );
+                }
+                return cumulativeComputationTimeFlatHistory_;
+            }
+
             double getTotalComputationRuntime( )
             {
                 checkAvailabilityOfSolution( "cumulative computation time history", false );
+                if( historyMapsAreOutdated_ )
+                {
+                    return std::max( cumulativeComputationTimeFlatHistory_.getValues( )( 0, 0 ),
+                                     cumulativeComputationTimeFlatHistory_.getLastValue( )( 0, 0 ) );
+                }
                 return std::max( cumulativeComputationTimeHistory_.begin( )->second,
                                  cumulativeComputationTimeHistory_.rbegin( )->second );
             }
@@ -351,6 +467,7 @@ namespace tudat
 
             void updateDependentVariableInterface( )
             {
+                updateHistoryMaps( );
                 if( dependentVariableHistory_.size( ) > 0 && dependentVariableInterface_ != nullptr )
                 {
                     std::shared_ptr< interpolators::LagrangeInterpolator< TimeType, Eigen::VectorXd > > dependentVariablesInterpolator =
@@ -374,6 +491,19 @@ namespace tudat
 
         private:
 
+            //! Function to create the maps of the unprocessed solution, dependent variables and computation time from the
+            //! contiguous histories, if these have not yet been created since the last propagation
+            void updateHistoryMaps( )
+            {
+                if( historyMapsAreOutdated_ )
+                {
+                    equationsOfMotionNumericalSolutionRaw_ = equationsOfMotionNumericalSolutionRawHistory_.createMap( );
+                    dependentVariableHistory_ = dependentVariableFlatHistory_.template createMap< Eigen::VectorXd >( );
+                    cumulativeComputationTimeHistory_ = cumulativeComputationTimeFlatHistory_.createScalarMap( );
+                    historyMapsAreOutdated_ = false;
+                }
+            }
+
             //! Map of state history of numerically integrated bodies.
             /*!
              *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
@@ -401,6 +531,19 @@ namespace tudat
             //! Map of cumulative number of function evaluations that was saved during numerical propagation.
             std::map<TimeType, unsigned int> cumulativeNumberOfFunctionEvaluations_;
 
+            //! Contiguous history of the unprocessed numerical solution, in order of propagation (primary storage of the
+            //! unprocessed solution after a propagation; equationsOfMotionNumericalSolutionRaw_ is created on request).
+            PropagationHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRawHistory_;
+
+            //! Contiguous history of the dependent variables, in order of propagation.
+            PropagationHistory< TimeType, double > dependentVariableFlatHistory_;
+
+            //! Contiguous history of the cumulative computation time, in order of propagation.
+            PropagationHistory< TimeType, double > cumulativeComputationTimeFlatHistory_;
+
+            //! Boolean denoting whether the contiguous histories hold results for which the maps have not yet been created
+            bool historyMapsAreOutdated_ = false;
+
             std::map <std::pair<int, int>, std::string> processedStateIds_;
 
             std::map <std::pair<int, int>, std::string> propagatedStateIds_;
@@ -480,6 +623,48 @@ namespace tudat
                         propagationTerminationReason );
             }
 
+            void reset(
+                    PropagationHistory< TimeType, StateScalarType > fullSolution,
+                    PropagationHistory< TimeType, double > dependentVariableHistory,
+                    PropagationHistory< TimeType, double > cumulativeComputationTimeHistory,
+                    const std::map<TimeType, unsigned int>& cumulativeNumberOfFunctionEvaluations,
+                    std::shared_ptr <PropagationTerminationDetails> propagationTerminationReason )
+            {
+                PropagationHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw(
+                            stateTransitionMatrixSize_, 1 );
+                equationsOfMotionNumericalSolutionRaw.reserve( fullSolution.size( ) );
+                for( unsigned int i = 0; i < fullSolution.size( ); i++ )
+                {
+                    const double currentTime = static_cast< double >( fullSolution.getTime( i ) );
+                    auto currentSolution = fullSolution.getValue( i );
+                    stateTransitionSolution_[ currentTime ] = currentSolution.block(
+                                0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).template cast< double >( );
+                    sensitivitySolution_[ currentTime ] = currentSolution.block(
+                                0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ).template cast< double >( );
+                    equationsOfMotionNumericalSolutionRaw.append(
+                                fullSolution.getTime( i ), currentSolution.block(
+                                    0, stateTransitionMatrixSize_ + sensitivityMatrixSize_, stateTransitionMatrixSize_, 1 ) );
+                }
+                fullSolution.clear( );
+                fullSolution.shrinkToFit( );
+
+                singleArcDynamicsResults_->reset(
+                        std::move( equationsOfMotionNumericalSolutionRaw ),
+                        std::move( dependentVariableHistory ),
+                        std::move( cumulativeComputationTimeHistory ),
+                        cumulativeNumberOfFunctionEvaluations,
+                        propagationTerminationReason );
+            }
+
+            //! Function to set the numerical results of a propagation from a results object of the same dynamics
+            //! (see SingleArcSimulationResults::copyPropagationResults)
+            void copyPropagationResults( const std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > resultsToCopy )
+            {
+                stateTransitionSolution_ = resultsToCopy->getStateTransitionSolution( );
+                sensitivitySolution_ = resultsToCopy->getSensitivitySolution( );
+                singleArcDynamicsResults_->copyPropagationResults( resultsToCopy->getDynamicsResults( ) );
+            }
+
             void manuallySetSecondaryData( const std::shared_ptr< SingleArcVariationalSimulationResults< StateScalarType, TimeType > > resultsToCopy )
             {
                 singleArcDynamicsResults_->manuallySetSecondaryData( resultsToCopy->getDynamicsResults( ) );
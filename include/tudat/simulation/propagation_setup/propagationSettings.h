@@ -634,6 +634,87 @@ std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > multi
                 singleArcSettings, transferInitialStateInformationPerArc, outputSettings );
 }
 
+//! Class for defining settings for the concurrent propagation of the arcs of a multi-arc propagation
+/*!
+ *  Class for defining settings for the concurrent propagation of the arcs of a multi-arc propagation, using a fixed
+ *  number of threads. Since the environment models (and the Body objects they are stored in) are updated during the
+ *  propagation, each thread requires its own copy of the environment and of the models (accelerations, torques, etc.)
+ *  that use it. These are created once (for each thread) from the functions provided here, which must create a new
+ *  set of bodies, and multi-arc propagator settings identical to those of the main propagation (but using the new
+ *  bodies). Note that any models that are shared between these copies (e.g. ephemerides retrieved directly from Spice,
+ *  or models created once and inserted into multiple sets of bodies) must be thread safe.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class MultiArcParallelPropagationSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfThreads Number of threads over which the arcs are distributed
+     * \param environmentCreationFunction Function creating a new (independent) set of bodies for a single thread
+     * \param propagatorSettingsCreationFunction Function creating the multi-arc propagator settings for a single thread,
+     * from the bodies created for that thread
+     */
+    MultiArcParallelPropagationSettings(
+            const unsigned int numberOfThreads,
+            const std::function< simulation_setup::SystemOfBodies( ) > environmentCreationFunction,
+            const std::function< std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > >(
+                const simulation_setup::SystemOfBodies& ) > propagatorSettingsCreationFunction ):
+        numberOfThreads_( numberOfThreads ),
+        environmentCreationFunction_( environmentCreationFunction ),
+        propagatorSettingsCreationFunction_( propagatorSettingsCreationFunction )
+    {
+        if( numberOfThreads_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating multi-arc parallel propagation settings, at least one thread is required." );
+        }
+    }
+
+    //! Function to retrieve the number of threads over which the arcs are distributed
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to retrieve the function creating a new (independent) set of bodies for a single thread
+    std::function< simulation_setup::SystemOfBodies( ) > getEnvironmentCreationFunction( )
+    {
+        return environmentCreationFunction_;
+    }
+
+    //! Function to retrieve the function creating the multi-arc propagator settings for a single thread
+    std::function< std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > >(
+            const simulation_setup::SystemOfBodies& ) > getPropagatorSettingsCreationFunction( )
+    {
+        return propagatorSettingsCreationFunction_;
+    }
+
+protected:
+
+    //! Number of threads over which the arcs are distributed
+    unsigned int numberOfThreads_;
+
+    //! Function creating a new (independent) set of bodies for a single thread
+    std::function< simulation_setup::SystemOfBodies( ) > environmentCreationFunction_;
+
+    //! Function creating the multi-arc propagator settings for a single thread, from the bodies created for that thread
+    std::function< std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > >(
+            const simulation_setup::SystemOfBodies& ) > propagatorSettingsCreationFunction_;
+};
+
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< MultiArcParallelPropagationSettings< StateScalarType, TimeType > > multiArcParallelPropagationSettings(
+        const unsigned int numberOfThreads,
+        const std::function< simulation_setup::SystemOfBodies( ) > environmentCreationFunction,
+        const std::function< std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > >(
+            const simulation_setup::SystemOfBodies& ) > propagatorSettingsCreationFunction )
+{
+    return std::make_shared< MultiArcParallelPropagationSettings< StateScalarType, TimeType > >(
+                numberOfThreads, environmentCreationFunction, propagatorSettingsCreationFunction );
+}
+
 //! Class for defining setting of a propagator for a combination of single- and multi-arc dynamics
 template< typename StateScalarType = double, typename TimeType = double >
 class HybridArcPropagatorSettings: public PropagatorSettings< StateScalarType >
@@ -177,6 +177,113 @@ void resetIntegratedEphemerisOfBody(
     }
 }
 
+//! Function to copy a tabulated ephemeris with given state scalar and time types, with an independent copy of its interpolator
+/*!
+ * Function to copy a tabulated ephemeris with given state scalar and time types, such that the target ephemeris returns the
+ * same states as the original, but can be used concurrently with it (see createIndependentLagrangeInterpolatorCopy).
+ * \param originalEphemeris Ephemeris that is to be copied
+ * \param targetEphemeris Ephemeris in which the interpolator of the original is to be set. If nullptr, a new tabulated
+ * ephemeris is created (returned by reference).
+ * \return True if the original ephemeris is a tabulated ephemeris of the given type (false otherwise, in which case no
+ * copy is made).
+ */
+template< typename StateScalarType, typename TimeType >
+bool copyTabulatedEphemeris(
+        const std::shared_ptr< ephemerides::Ephemeris > originalEphemeris,
+        std::shared_ptr< ephemerides::Ephemeris >& targetEphemeris )
+{
+    std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > > originalTabulatedEphemeris =
+            std::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >( originalEphemeris );
+    if( originalTabulatedEphemeris == nullptr )
+    {
+        return false;
+    }
+
+    if( targetEphemeris == nullptr )
+    {
+        targetEphemeris = std::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                    std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >( ),
+                    originalEphemeris->getReferenceFrameOrigin( ), originalEphemeris->getReferenceFrameOrientation( ) );
+    }
+
+    std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > > targetTabulatedEphemeris =
+            std::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >( targetEphemeris );
+    if( targetTabulatedEphemeris == nullptr )
+    {
+        throw std::runtime_error( "Error when copying tabulated ephemeris, target ephemeris is not of the same type as the original" );
+    }
+    targetTabulatedEphemeris->resetInterpolator(
+                interpolators::createIndependentLagrangeInterpolatorCopy( originalTabulatedEphemeris->getInterpolator( ) ) );
+    return true;
+}
+
+//! Function to copy the numerically integrated ephemeris of a body from one environment to another.
+/*!
+ * Function to copy the numerically integrated ephemeris of a body from one environment to another, for instance to update
+ * an independent copy of the environment (used on a different thread) after a propagation. The ephemeris of the body must be
+ * a tabulated ephemeris, or a multi-arc ephemeris composed of tabulated ephemerides, in both environments. The interpolators
+ * are copied, so that the two environments can be used concurrently.
+ * \param originalBodies Environment from which the ephemeris is to be copied
+ * \param targetBodies Environment in which the ephemeris is to be set
+ * \param bodyName Name of body for which the ephemeris is to be copied
+ */
+inline void copyIntegratedEphemerisOfBody(
+        const simulation_setup::SystemOfBodies& originalBodies,
+        const simulation_setup::SystemOfBodies& targetBodies,
+        const std::string& bodyName )
+{
+    std::shared_ptr< ephemerides::Ephemeris > originalEphemeris = originalBodies.at( bodyName )->getEphemeris( );
+    std::shared_ptr< ephemerides::Ephemeris > targetEphemeris = targetBodies.at( bodyName )->getEphemeris( );
+    if( originalEphemeris == nullptr || targetEphemeris == nullptr )
+    {
+        throw std::runtime_error( "Error when copying integrated ephemeris of body " + bodyName + ", no ephemeris found" );
+    }
+
+    auto copySingleEphemeris = [ ]( const std::shared_ptr< ephemerides::Ephemeris > original,
+                                    std::shared_ptr< ephemerides::Ephemeris >& target )
+    {
+        return copyTabulatedEphemeris< double, double >( original, target ) ||
+                copyTabulatedEphemeris< long double, double >( original, target ) ||
+                copyTabulatedEphemeris< double, Time >( original, target ) ||
+                copyTabulatedEphemeris< long double, Time >( original, target );
+    };
+
+    std::shared_ptr< ephemerides::MultiArcEphemeris > originalMultiArcEphemeris =
+            std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( originalEphemeris );
+    if( originalMultiArcEphemeris != nullptr )
+    {
+        std::shared_ptr< ephemerides::MultiArcEphemeris > targetMultiArcEphemeris =
+                std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( targetEphemeris );
+        if( targetMultiArcEphemeris == nullptr )
+        {
+            throw std::runtime_error( "Error when copying integrated ephemeris of body " + bodyName +
+                                      ", target ephemeris is not a multi-arc ephemeris" );
+        }
+
+        // Create new arc ephemerides in target, since number of arcs may differ
+        std::vector< std::shared_ptr< ephemerides::Ephemeris > > originalArcEphemerides =
+                originalMultiArcEphemeris->getSingleArcEphemerides( );
+        std::vector< std::shared_ptr< ephemerides::Ephemeris > > targetArcEphemerides( originalArcEphemerides.size( ) );
+        for( unsigned int i = 0; i < originalArcEphemerides.size( ); i++ )
+        {
+            if( !copySingleEphemeris( originalArcEphemerides.at( i ), targetArcEphemerides.at( i ) ) )
+            {
+                throw std::runtime_error( "Error when copying integrated ephemeris of body " + bodyName +
+                                          ", arc " + std::to_string( i ) + " is not a tabulated ephemeris" );
+            }
+        }
+
+        std::vector< double > arcStartTimes = originalMultiArcEphemeris->getArcSplitTimes( );
+        arcStartTimes.pop_back( );
+        targetMultiArcEphemeris->resetSingleArcEphemerides( targetArcEphemerides, arcStartTimes );
+    }
+    else if( !copySingleEphemeris( originalEphemeris, targetEphemeris ) )
+    {
+        throw std::runtime_error( "Error when copying integrated ephemeris of body " + bodyName +
+                                  ", no tabulated ephemeris found" );
+    }
+}
+
 //! Function to convert output of translational motion to input for the ephemeris.
 /*!
  * Function to convert output of translational motion from the numerical integrator to the required
@@ -368,6 +475,9 @@ void resetIntegratedEphemerides(
         
     }
     
+    // Stop caching ephemeris states, which are modified below
+    bodies.invalidateEphemerisStateCache( );
+
     // Create interpolators from numerical integration results (states) at discrete times.
     createAndSetInterpolatorsForEphemerides(
                 bodies, bodiesToIntegrate, startIndexAndSize.first, ephemerisUpdateOrder,
@@ -412,6 +522,9 @@ void resetMultiArcIntegratedEphemerides(
         ephemerisUpdateOrder = bodiesToIntegrate;
     }
 
+    // Stop caching ephemeris states, which are modified below
+    bodies.invalidateEphemerisStateCache( );
+
 
     //    // Check that, for each arc, the bodies to integrate and ephemeris update order are identical (for now).
     //    for ( unsigned int i = 1 ; i < bodiesToIntegrate.size( ) ; i++ )
@@ -654,6 +767,9 @@ void resetIntegratedRotationalEphemerides(
         const std::vector< std::string >& bodiesToIntegrate,
         const std::pair< unsigned int, unsigned int > startIndexAndSize )
 {
+    // Stop caching ephemeris rotations, which are modified below
+    bodies.invalidateEphemerisStateCache( );
+
     // Create interpolators from numerical integration results (states) at discrete times.
     createAndSetInterpolatorsForRotationalEphemerides(
                 bodies, bodiesToIntegrate, startIndexAndSize.first, equationsOfMotionNumericalSolution );
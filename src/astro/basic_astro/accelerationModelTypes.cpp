@@ -86,6 +86,9 @@ std::string getAccelerationModelName( const AvailableAcceleration accelerationTy
     case custom_acceleration:
         accelerationName = "custom acceleration";
         break;
+    case gridded_gravity:
+        accelerationName = "gridded gravity ";
+        break;
     default:
         std::string errorMessage = "Error, acceleration type " +
                 std::to_string( accelerationType ) +
@@ -153,6 +156,10 @@ AvailableAcceleration getAccelerationModelType(
     {
         accelerationType = ring_gravity;
     }
+    else if( std::dynamic_pointer_cast< GriddedGravitationalAccelerationModel >( accelerationModel ) != nullptr  )
+    {
+        accelerationType = gridded_gravity;
+    }
     else if( std::dynamic_pointer_cast< AerodynamicAcceleration >(
                  accelerationModel ) != nullptr )
     {
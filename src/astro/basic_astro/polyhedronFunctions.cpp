@@ -12,6 +12,7 @@
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
 #include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/legendrePolynomials.h"
 
 namespace tudat
 {
@@ -191,5 +192,138 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
     return computePolyhedronInertiaTensor( verticesCoordinates, verticesDefiningEachFacet, density );
 }
 
+double computePolyhedronBrillouinRadius( const Eigen::MatrixXd& verticesCoordinates )
+{
+    return verticesCoordinates.rowwise( ).norm( ).maxCoeff( );
+}
+
+//! Function to compute the nodes and weights of the Gauss-Legendre quadrature rule on the interval [0,1].
+void computeUnitIntervalGaussLegendreNodesAndWeights( const int numberOfNodes,
+                                                      Eigen::VectorXd& nodes,
+                                                      Eigen::VectorXd& weights )
+{
+    nodes.resize( numberOfNodes );
+    weights.resize( numberOfNodes );
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        // Find root of Legendre polynomial with Newton iteration, starting from asymptotic approximation
+        double root = std::cos( mathematical_constants::PI * ( i + 0.75 ) / ( numberOfNodes + 0.5 ) );
+        double derivative = 1.0;
+        for( int iteration = 0; iteration < 100; iteration++ )
+        {
+            double currentPolynomial = 1.0, previousPolynomial = 0.0;
+            for( int degree = 1; degree <= numberOfNodes; degree++ )
+            {
+                const double olderPolynomial = previousPolynomial;
+                previousPolynomial = currentPolynomial;
+                currentPolynomial = ( ( 2.0 * degree - 1.0 ) * root * previousPolynomial -
+                                      ( degree - 1.0 ) * olderPolynomial ) / degree;
+            }
+            derivative = numberOfNodes * ( root * currentPolynomial - previousPolynomial ) / ( root * root - 1.0 );
+            const double correction = currentPolynomial / derivative;
+            root -= correction;
+            if( std::fabs( correction ) < 1.0E-15 )
+            {
+                break;
+            }
+        }
+
+        // Map node and weight from [-1,1] to [0,1]
+        nodes( i ) = 0.5 * ( 1.0 - root );
+        weights( i ) = 1.0 / ( ( 1.0 - root * root ) * derivative * derivative );
+    }
+}
+
+void computePolyhedronSphericalHarmonicCoefficients( const Eigen::MatrixXd& verticesCoordinates,
+                                                     const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                     const int maximumDegree,
+                                                     const double referenceRadius,
+                                                     Eigen::MatrixXd& cosineCoefficients,
+                                                     Eigen::MatrixXd& sineCoefficients )
+{
+    // Check if inputs are valid
+    basic_mathematics::checkValidityOfPolyhedronSettings ( verticesCoordinates, verticesDefiningEachFacet );
+    if( maximumDegree < 0 )
+    {
+        throw std::runtime_error( "Error when computing polyhedron spherical harmonic coefficients, maximum degree (" +
+                                  std::to_string( maximumDegree ) + ") must be non-negative." );
+    }
+
+    const unsigned int numberOfFacets = verticesDefiningEachFacet.rows( );
+
+    // Define quadrature rule, exact for polynomial of degree maximumDegree + 1 in each of the collapsed coordinates
+    Eigen::VectorXd quadratureNodes, quadratureWeights;
+    computeUnitIntervalGaussLegendreNodesAndWeights( ( maximumDegree + 3 ) / 2, quadratureNodes, quadratureWeights );
+    const int numberOfNodes = quadratureNodes.rows( );
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+    Eigen::VectorXd cosineOfMultipleLongitude( maximumDegree + 1 ), sineOfMultipleLongitude( maximumDegree + 1 );
+
+    // Integrals of solid spherical harmonics over the (unscaled) cones formed by the origin and each facet
+    cosineCoefficients.setZero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients.setZero( maximumDegree + 1, maximumDegree + 1 );
+
+    for( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        const Eigen::Vector3d vertex0 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 0 ), 0 );
+        const Eigen::Vector3d vertex1 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 1 ), 0 );
+        const Eigen::Vector3d vertex2 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 2 ), 0 );
+
+        // Twice the facet area times the signed distance of the facet plane from the origin
+        const Eigen::Vector3d facetNormal = ( vertex1 - vertex0 ).cross( vertex2 - vertex1 );
+        const double facetFactor = facetNormal.dot( vertex0 );
+        if( facetFactor == 0.0 )
+        {
+            continue;
+        }
+
+        // Integrate over facet, using collapsed coordinates x = v0 + s ( v1 - v0 ) + s t ( v2 - v1 ), with dA = 2 A s ds dt
+        for( int i = 0; i < numberOfNodes; i++ )
+        {
+            for( int j = 0; j < numberOfNodes; j++ )
+            {
+                const Eigen::Vector3d point = vertex0 + quadratureNodes( i ) * ( vertex1 - vertex0 ) +
+                        quadratureNodes( i ) * quadratureNodes( j ) * ( vertex2 - vertex1 );
+                const double radius = point.norm( );
+                if( radius == 0.0 )
+                {
+                    continue;
+                }
+                const double weight = facetFactor * quadratureWeights( i ) * quadratureWeights( j ) * quadratureNodes( i );
+
+                // Compute terms of solid spherical harmonics
+                legendreCache.update( point.z( ) / radius );
+                const double longitude = std::atan2( point.y( ), point.x( ) );
+                for( int order = 0; order <= maximumDegree; order++ )
+                {
+                    cosineOfMultipleLongitude( order ) = std::cos( order * longitude );
+                    sineOfMultipleLongitude( order ) = std::sin( order * longitude );
+                }
+
+                double radiusRatioPower = weight;
+                for( int degree = 0; degree <= maximumDegree; degree++ )
+                {
+                    for( int order = 0; order <= degree; order++ )
+                    {
+                        const double legendreTerm = radiusRatioPower * legendreCache.getLegendrePolynomial( degree, order );
+                        cosineCoefficients( degree, order ) += legendreTerm * cosineOfMultipleLongitude( order );
+                        sineCoefficients( degree, order ) += legendreTerm * sineOfMultipleLongitude( order );
+                    }
+                    radiusRatioPower *= radius / referenceRadius;
+                }
+            }
+        }
+    }
+
+    // Scale with volume of polyhedron, and per-degree factors
+    const double volume = computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        const double scalingFactor = 1.0 / ( ( degree + 3.0 ) * ( 2.0 * degree + 1.0 ) * volume );
+        cosineCoefficients.row( degree ) *= scalingFactor;
+        sineCoefficients.row( degree ) *= scalingFactor;
+    }
+}
+
 } // namespace basic_astrodynamics
-} // namespace tudat
\ No newline at end of file
+} // namespace tudat
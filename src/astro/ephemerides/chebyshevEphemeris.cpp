@@ -0,0 +1,596 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include <Eigen/QR>
+
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Identifier at the start of each Chebyshev ephemeris file
+static const char chebyshevEphemerisFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'H', 'B' };
+
+//! Version of the Chebyshev ephemeris file format
+static const std::int32_t chebyshevEphemerisFileVersion = 1;
+
+//! Maximum number of buckets in the granule lookup table, per granule
+static const int maximumBucketsPerGranule = 16;
+
+//! Constructor, from granule data
+ChebyshevEphemeris::ChebyshevEphemeris(
+        const std::vector< double >& granuleBoundaries,
+        const std::vector< double >& granuleCoefficients,
+        const int polynomialDegree,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    granuleBoundaries_( granuleBoundaries ),
+    granuleCoefficients_( granuleCoefficients ),
+    polynomialDegree_( polynomialDegree ),
+    coefficientsPerGranule_( 3 * ( polynomialDegree + 1 ) )
+{
+    // Check input consistency
+    if( polynomialDegree_ < 0 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be non-negative." );
+    }
+
+    if( granuleBoundaries_.size( ) < 2 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, at least one granule is required." );
+    }
+
+    int numberOfGranules = getNumberOfGranules( );
+    if( granuleCoefficients_.size( ) != static_cast< unsigned int >( numberOfGranules * coefficientsPerGranule_ ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, " +
+                                  std::to_string( granuleCoefficients_.size( ) ) + " coefficients provided for " +
+                                  std::to_string( numberOfGranules ) + " granules of degree " +
+                                  std::to_string( polynomialDegree_ ) + "." );
+    }
+
+    double minimumGranuleDuration = granuleBoundaries_.back( ) - granuleBoundaries_.front( );
+    for( int i = 0; i < numberOfGranules; i++ )
+    {
+        if( !( granuleBoundaries_.at( i + 1 ) > granuleBoundaries_.at( i ) ) )
+        {
+            throw std::runtime_error( "Error when creating Chebyshev ephemeris, granule boundaries must be strictly "
+                                      "increasing." );
+        }
+        minimumGranuleDuration = std::min( minimumGranuleDuration,
+                                           granuleBoundaries_.at( i + 1 ) - granuleBoundaries_.at( i ) );
+    }
+
+    // Create bucket table, with buckets no wider than the shortest granule (or as close as the limit on the table size
+    // allows), so that at most a few granule boundaries have to be passed when looking up a time.
+    double totalDuration = granuleBoundaries_.back( ) - granuleBoundaries_.front( );
+    int numberOfBuckets = static_cast< int >( std::min(
+                std::ceil( totalDuration / minimumGranuleDuration ),
+                static_cast< double >( maximumBucketsPerGranule ) * static_cast< double >( numberOfGranules ) ) );
+    numberOfBuckets = std::max( numberOfBuckets, 1 );
+    bucketWidth_ = totalDuration / static_cast< double >( numberOfBuckets );
+
+    bucketGranuleIndices_.resize( numberOfBuckets );
+    for( int i = 0; i < numberOfBuckets; i++ )
+    {
+        double bucketStartTime = granuleBoundaries_.front( ) + static_cast< double >( i ) * bucketWidth_;
+        int granuleIndex = static_cast< int >(
+                    std::upper_bound( granuleBoundaries_.begin( ), granuleBoundaries_.end( ), bucketStartTime ) -
+                    granuleBoundaries_.begin( ) ) - 1;
+        bucketGranuleIndices_[ i ] = std::max( 0, std::min( granuleIndex, numberOfGranules - 1 ) );
+    }
+}
+
+//! Function to retrieve the index of the granule containing a given time
+int ChebyshevEphemeris::getGranuleIndex( const double secondsSinceEpoch ) const
+{
+    if( !( secondsSinceEpoch >= granuleBoundaries_.front( ) && secondsSinceEpoch <= granuleBoundaries_.back( ) ) )
+    {
+        throw std::runtime_error( "Error in Chebyshev ephemeris, requested time " + std::to_string( secondsSinceEpoch ) +
+                                  " is outside of interval [" + std::to_string( granuleBoundaries_.front( ) ) + ", " +
+                                  std::to_string( granuleBoundaries_.back( ) ) + "]." );
+    }
+
+    int bucketIndex = std::min( static_cast< int >( ( secondsSinceEpoch - granuleBoundaries_.front( ) ) / bucketWidth_ ),
+                                static_cast< int >( bucketGranuleIndices_.size( ) ) - 1 );
+    int granuleIndex = bucketGranuleIndices_[ bucketIndex ];
+
+    // Correct for granule boundaries inside the bucket (and rounding of the bucket index)
+    int lastGranuleIndex = getNumberOfGranules( ) - 1;
+    while( granuleIndex < lastGranuleIndex && secondsSinceEpoch >= granuleBoundaries_[ granuleIndex + 1 ] )
+    {
+        granuleIndex++;
+    }
+    while( granuleIndex > 0 && secondsSinceEpoch < granuleBoundaries_[ granuleIndex ] )
+    {
+        granuleIndex--;
+    }
+    return granuleIndex;
+}
+
+//! Get cartesian state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    int granuleIndex = getGranuleIndex( secondsSinceEpoch );
+
+    // Compute normalized time in granule
+    double granuleMidpoint = 0.5 * ( granuleBoundaries_[ granuleIndex ] + granuleBoundaries_[ granuleIndex + 1 ] );
+    double granuleHalfLength = 0.5 * ( granuleBoundaries_[ granuleIndex + 1 ] - granuleBoundaries_[ granuleIndex ] );
+    double normalizedTime = ( secondsSinceEpoch - granuleMidpoint ) / granuleHalfLength;
+
+    const double* xCoefficients = granuleCoefficients_.data( ) + granuleIndex * coefficientsPerGranule_;
+    const double* yCoefficients = xCoefficients + ( polynomialDegree_ + 1 );
+    const double* zCoefficients = yCoefficients + ( polynomialDegree_ + 1 );
+
+    // Sum polynomials and their derivatives, using recurrence relations T_{k+1} = 2 x T_k - T_{k-1} and
+    // T'_{k+1} = 2 T_k + 2 x T'_k - T'_{k-1}
+    Eigen::Vector6d cartesianState;
+    cartesianState << xCoefficients[ 0 ], yCoefficients[ 0 ], zCoefficients[ 0 ], 0.0, 0.0, 0.0;
+
+    double previousPolynomial = 1.0, currentPolynomial = normalizedTime;
+    double previousDerivative = 0.0, currentDerivative = 1.0;
+    for( int k = 1; k <= polynomialDegree_; k++ )
+    {
+        cartesianState( 0 ) += xCoefficients[ k ] * currentPolynomial;
+        cartesianState( 1 ) += yCoefficients[ k ] * currentPolynomial;
+        cartesianState( 2 ) += zCoefficients[ k ] * currentPolynomial;
+        cartesianState( 3 ) += xCoefficients[ k ] * currentDerivative;
+        cartesianState( 4 ) += yCoefficients[ k ] * currentDerivative;
+        cartesianState( 5 ) += zCoefficients[ k ] * currentDerivative;
+
+        double nextPolynomial = 2.0 * normalizedTime * currentPolynomial - previousPolynomial;
+        double nextDerivative = 2.0 * currentPolynomial + 2.0 * normalizedTime * currentDerivative - previousDerivative;
+        previousPolynomial = currentPolynomial;
+        currentPolynomial = nextPolynomial;
+        previousDerivative = currentDerivative;
+        currentDerivative = nextDerivative;
+    }
+
+    // Convert derivative w.r.t. normalized time to time derivative
+    cartesianState.segment( 3, 3 ) /= granuleHalfLength;
+
+    return cartesianState;
+}
+
+namespace
+{
+
+//! Function to fill the rows of a least-squares design matrix for Chebyshev polynomials and their derivatives
+/*!
+ *  Function to fill the rows of a least-squares design matrix for the position (value of the Chebyshev polynomials)
+ *  and velocity (derivative of the Chebyshev polynomials, w.r.t. normalized time) at a single normalized time.
+ *  \param normalizedTime Normalized time in [-1, 1] at which the polynomials are to be evaluated
+ *  \param polynomialDegree Degree of the Chebyshev polynomials
+ *  \param positionRow Row of the design matrix for the position (returned by reference)
+ *  \param velocityRow Row of the design matrix for the velocity (returned by reference)
+ */
+template< typename RowType >
+void setChebyshevDesignMatrixRows( const double normalizedTime,
+                                   const int polynomialDegree,
+                                   RowType positionRow,
+                                   RowType velocityRow )
+{
+    positionRow( 0 ) = 1.0;
+    velocityRow( 0 ) = 0.0;
+    if( polynomialDegree > 0 )
+    {
+        positionRow( 1 ) = normalizedTime;
+        velocityRow( 1 ) = 1.0;
+    }
+    for( int k = 2; k <= polynomialDegree; k++ )
+    {
+        positionRow( k ) = 2.0 * normalizedTime * positionRow( k - 1 ) - positionRow( k - 2 );
+        velocityRow( k ) = 2.0 * positionRow( k - 1 ) + 2.0 * normalizedTime * velocityRow( k - 1 ) -
+                velocityRow( k - 2 );
+    }
+}
+
+//! Class to perform the adaptive fit of Chebyshev granules to a state history
+class ChebyshevGranuleFitter
+{
+public:
+
+    //! Constructor, the state history is referenced (not copied), and must remain valid for the lifetime of the object
+    ChebyshevGranuleFitter( const std::map< double, Eigen::Vector6d >& stateHistory,
+                            const double positionTolerance,
+                            const double velocityTolerance,
+                            const int polynomialDegree ):
+        numberOfGranulesOutsideTolerance_( 0 ),
+        maximumPositionResidualOutsideTolerance_( 0.0 ),
+        maximumVelocityResidualOutsideTolerance_( 0.0 ),
+        positionTolerance_( positionTolerance ),
+        velocityTolerance_( velocityTolerance ),
+        polynomialDegree_( polynomialDegree ),
+        // Require the positions alone to determine the polynomials, so that the velocities provide redundancy and the
+        // residuals are a meaningful measure of the quality of the fit in between the states.
+        minimumNumberOfStatesPerGranule_( polynomialDegree + 1 )
+    {
+        times_.reserve( stateHistory.size( ) );
+        states_.reserve( stateHistory.size( ) );
+        for( auto stateIterator = stateHistory.begin( ); stateIterator != stateHistory.end( ); stateIterator++ )
+        {
+            times_.push_back( stateIterator->first );
+            states_.push_back( &stateIterator->second );
+        }
+    }
+
+    //! Function to fit granules on a given interval, bisecting the interval where the tolerance is not met
+    void fitInterval( const double startTime, const double endTime )
+    {
+        int firstIndex, numberOfStates;
+        getStateIndices( startTime, endTime, firstIndex, numberOfStates );
+
+        Eigen::MatrixXd coefficients;
+        double maximumPositionResidual, maximumVelocityResidual;
+        fitGranule( startTime, endTime, firstIndex, numberOfStates,
+                    coefficients, maximumPositionResidual, maximumVelocityResidual );
+
+        bool isToleranceMet = ( maximumPositionResidual <= positionTolerance_ ) &&
+                ( velocityTolerance_ != velocityTolerance_ || maximumVelocityResidual <= velocityTolerance_ );
+        if( !isToleranceMet )
+        {
+            // Bisect interval, if both halves contain sufficient states
+            double midTime = 0.5 * ( startTime + endTime );
+            int firstIndexFirstHalf, numberOfStatesFirstHalf, firstIndexSecondHalf, numberOfStatesSecondHalf;
+            getStateIndices( startTime, midTime, firstIndexFirstHalf, numberOfStatesFirstHalf );
+            getStateIndices( midTime, endTime, firstIndexSecondHalf, numberOfStatesSecondHalf );
+
+            if( numberOfStatesFirstHalf >= minimumNumberOfStatesPerGranule_ &&
+                    numberOfStatesSecondHalf >= minimumNumberOfStatesPerGranule_ &&
+                    midTime > startTime && midTime < endTime )
+            {
+                fitInterval( startTime, midTime );
+                fitInterval( midTime, endTime );
+                return;
+            }
+
+            numberOfGranulesOutsideTolerance_++;
+            maximumPositionResidualOutsideTolerance_ =
+                    std::max( maximumPositionResidualOutsideTolerance_, maximumPositionResidual );
+            maximumVelocityResidualOutsideTolerance_ =
+                    std::max( maximumVelocityResidualOutsideTolerance_, maximumVelocityResidual );
+        }
+
+        // Store granule
+        if( granuleBoundaries_.size( ) == 0 )
+        {
+            granuleBoundaries_.push_back( startTime );
+        }
+        granuleBoundaries_.push_back( endTime );
+        for( int j = 0; j < 3; j++ )
+        {
+            for( int k = 0; k <= polynomialDegree_; k++ )
+            {
+                granuleCoefficients_.push_back( coefficients( k, j ) );
+            }
+        }
+    }
+
+    //! Function to retrieve the number of states that is required in a single granule
+    int getMinimumNumberOfStatesPerGranule( ) const
+    {
+        return minimumNumberOfStatesPerGranule_;
+    }
+
+    //! Function to retrieve the boundaries of the time intervals of the granules fitted so far
+    const std::vector< double >& getGranuleBoundaries( ) const
+    {
+        return granuleBoundaries_;
+    }
+
+    //! Function to retrieve the Chebyshev coefficients of the granules fitted so far
+    const std::vector< double >& getGranuleCoefficients( ) const
+    {
+        return granuleCoefficients_;
+    }
+
+    //! Function to retrieve the number of granules for which the tolerance could not be met
+    int getNumberOfGranulesOutsideTolerance( ) const
+    {
+        return numberOfGranulesOutsideTolerance_;
+    }
+
+    //! Function to retrieve the maximum position residual of the granules for which the tolerance could not be met
+    double getMaximumPositionResidualOutsideTolerance( ) const
+    {
+        return maximumPositionResidualOutsideTolerance_;
+    }
+
+    //! Function to retrieve the maximum velocity residual of the granules for which the tolerance could not be met
+    double getMaximumVelocityResidualOutsideTolerance( ) const
+    {
+        return maximumVelocityResidualOutsideTolerance_;
+    }
+
+private:
+
+    //! Function to retrieve the range of indices of the states in a given (closed) interval
+    void getStateIndices( const double startTime, const double endTime, int& firstIndex, int& numberOfStates )
+    {
+        firstIndex = static_cast< int >(
+                    std::lower_bound( times_.begin( ), times_.end( ), startTime ) - times_.begin( ) );
+        int endIndex = static_cast< int >(
+                    std::upper_bound( times_.begin( ), times_.end( ), endTime ) - times_.begin( ) );
+        numberOfStates = endIndex - firstIndex;
+    }
+
+    //! Function to perform the least-squares fit of a single granule, and compute its residuals
+    void fitGranule( const double startTime, const double endTime, const int firstIndex, const int numberOfStates,
+                     Eigen::MatrixXd& coefficients, double& maximumPositionResidual, double& maximumVelocityResidual )
+    {
+        double granuleMidpoint = 0.5 * ( startTime + endTime );
+        double granuleHalfLength = 0.5 * ( endTime - startTime );
+
+        // Set up design matrix and observations, with the velocity scaled to the derivative w.r.t. normalized time
+        Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Zero( 2 * numberOfStates, polynomialDegree_ + 1 );
+        Eigen::MatrixXd observations = Eigen::MatrixXd::Zero( 2 * numberOfStates, 3 );
+        for( int i = 0; i < numberOfStates; i++ )
+        {
+            const Eigen::Vector6d& currentState = *states_.at( firstIndex + i );
+            setChebyshevDesignMatrixRows(
+                        ( times_.at( firstIndex + i ) - granuleMidpoint ) / granuleHalfLength, polynomialDegree_,
+                        designMatrix.row( 2 * i ), designMatrix.row( 2 * i + 1 ) );
+            observations.row( 2 * i ) = currentState.segment( 0, 3 ).transpose( );
+            observations.row( 2 * i + 1 ) = granuleHalfLength * currentState.segment( 3, 3 ).transpose( );
+        }
+
+        coefficients = designMatrix.colPivHouseholderQr( ).solve( observations );
+
+        // Compute residuals of fit
+        Eigen::MatrixXd residuals = designMatrix * coefficients - observations;
+        maximumPositionResidual = 0.0;
+        maximumVelocityResidual = 0.0;
+        for( int i = 0; i < numberOfStates; i++ )
+        {
+            maximumPositionResidual = std::max( maximumPositionResidual, residuals.row( 2 * i ).norm( ) );
+            maximumVelocityResidual = std::max( maximumVelocityResidual,
+                                                residuals.row( 2 * i + 1 ).norm( ) / granuleHalfLength );
+        }
+    }
+
+    //! Boundaries of the time intervals of the granules fitted so far
+    std::vector< double > granuleBoundaries_;
+
+    //! Chebyshev coefficients of the granules fitted so far
+    std::vector< double > granuleCoefficients_;
+
+    //! Number of granules for which the tolerance could not be met
+    int numberOfGranulesOutsideTolerance_;
+
+    //! Maximum position residual of the granules for which the tolerance could not be met
+    double maximumPositionResidualOutsideTolerance_;
+
+    //! Maximum velocity residual of the granules for which the tolerance could not be met
+    double maximumVelocityResidualOutsideTolerance_;
+
+    //! Times of the state history
+    std::vector< double > times_;
+
+    //! Pointers to the states of the state history (in the same order as times_)
+    std::vector< const Eigen::Vector6d* > states_;
+
+    //! Maximum position residual of the fit at the states of the history
+    double positionTolerance_;
+
+    //! Maximum velocity residual of the fit at the states of the history (not checked if NaN)
+    double velocityTolerance_;
+
+    //! Degree of the Chebyshev polynomials of each granule
+    int polynomialDegree_;
+
+    //! Minimum number of states in a single granule
+    int minimumNumberOfStatesPerGranule_;
+};
+
+} // namespace
+
+//! Function to fit a Chebyshev ephemeris to a state history, with adaptive granule length
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemerisFromStateHistory(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree,
+        const double maximumGranuleDuration,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation )
+{
+    if( polynomialDegree < 1 )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, polynomial degree must be at least 1." );
+    }
+
+    if( !( positionTolerance > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, position tolerance must be positive." );
+    }
+
+    ChebyshevGranuleFitter granuleFitter( stateHistory, positionTolerance, velocityTolerance, polynomialDegree );
+    if( static_cast< int >( stateHistory.size( ) ) < granuleFitter.getMinimumNumberOfStatesPerGranule( ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris of degree " +
+                                  std::to_string( polynomialDegree ) + ", at least " +
+                                  std::to_string( granuleFitter.getMinimumNumberOfStatesPerGranule( ) ) +
+                                  " states are required, " + std::to_string( stateHistory.size( ) ) + " provided." );
+    }
+
+    // Divide full interval in initial granules of at most the maximum duration, and fit each of them
+    double startTime = stateHistory.begin( )->first;
+    double endTime = stateHistory.rbegin( )->first;
+    int numberOfInitialGranules = 1;
+    if( maximumGranuleDuration == maximumGranuleDuration )
+    {
+        if( !( maximumGranuleDuration > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when fitting Chebyshev ephemeris, maximum granule duration must be "
+                                      "positive." );
+        }
+        numberOfInitialGranules = std::max(
+                    1, static_cast< int >( std::ceil( ( endTime - startTime ) / maximumGranuleDuration ) ) );
+    }
+
+    for( int i = 0; i < numberOfInitialGranules; i++ )
+    {
+        granuleFitter.fitInterval(
+                    ( i == 0 ) ? startTime : startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                                 static_cast< double >( numberOfInitialGranules ),
+                    ( i == numberOfInitialGranules - 1 ) ? endTime :
+                                                           startTime + ( endTime - startTime ) *
+                                                           static_cast< double >( i + 1 ) /
+                                                           static_cast< double >( numberOfInitialGranules ) );
+    }
+
+    if( granuleFitter.getNumberOfGranulesOutsideTolerance( ) > 0 )
+    {
+        std::cerr << "Warning when fitting Chebyshev ephemeris, tolerance not met for " <<
+                     granuleFitter.getNumberOfGranulesOutsideTolerance( ) << " granule(s) with too few states to be "
+                     "subdivided; maximum position and velocity residuals are " <<
+                     granuleFitter.getMaximumPositionResidualOutsideTolerance( ) << " and " <<
+                     granuleFitter.getMaximumVelocityResidualOutsideTolerance( ) << std::endl;
+    }
+
+    return std::make_shared< ChebyshevEphemeris >(
+                granuleFitter.getGranuleBoundaries( ), granuleFitter.getGranuleCoefficients( ), polynomialDegree,
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
+//! Function to write a string, preceded by its length, to a binary file
+static void writeStringToBinaryFile( std::ofstream& file, const std::string& stringToWrite )
+{
+    std::int32_t stringLength = static_cast< std::int32_t >( stringToWrite.size( ) );
+    file.write( reinterpret_cast< const char* >( &stringLength ), sizeof( stringLength ) );
+    file.write( stringToWrite.data( ), stringLength );
+}
+
+//! Function to read a string, preceded by its length, from a binary file
+static std::string readStringFromBinaryFile( std::ifstream& file, const std::string& fileName )
+{
+    std::int32_t stringLength = 0;
+    file.read( reinterpret_cast< char* >( &stringLength ), sizeof( stringLength ) );
+    if( !file || stringLength < 0 || stringLength > 1024 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", invalid header." );
+    }
+    std::string readString( stringLength, ' ' );
+    file.read( &readString[ 0 ], stringLength );
+    return readString;
+}
+
+//! Function to write a Chebyshev ephemeris to a binary file
+void writeChebyshevEphemerisToFile( const std::shared_ptr< ChebyshevEphemeris > ephemeris,
+                                    const std::string& fileName )
+{
+    std::ofstream file( fileName, std::ios::binary | std::ios::trunc );
+    if( !file.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris, could not open file " + fileName + "." );
+    }
+
+    std::int32_t polynomialDegree = ephemeris->getPolynomialDegree( );
+    std::int64_t numberOfGranules = ephemeris->getNumberOfGranules( );
+
+    file.write( chebyshevEphemerisFileIdentifier, sizeof( chebyshevEphemerisFileIdentifier ) );
+    file.write( reinterpret_cast< const char* >( &chebyshevEphemerisFileVersion ),
+                sizeof( chebyshevEphemerisFileVersion ) );
+    file.write( reinterpret_cast< const char* >( &polynomialDegree ), sizeof( polynomialDegree ) );
+    file.write( reinterpret_cast< const char* >( &numberOfGranules ), sizeof( numberOfGranules ) );
+    writeStringToBinaryFile( file, ephemeris->getReferenceFrameOrigin( ) );
+    writeStringToBinaryFile( file, ephemeris->getReferenceFrameOrientation( ) );
+
+    file.write( reinterpret_cast< const char* >( ephemeris->getGranuleBoundaries( ).data( ) ),
+                ephemeris->getGranuleBoundaries( ).size( ) * sizeof( double ) );
+    file.write( reinterpret_cast< const char* >( ephemeris->getGranuleCoefficients( ).data( ) ),
+                ephemeris->getGranuleCoefficients( ).size( ) * sizeof( double ) );
+
+    if( !file )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris to file " + fileName + "." );
+    }
+}
+
+//! Function to read a Chebyshev ephemeris from a binary file
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFromFile( const std::string& fileName )
+{
+    std::ifstream file( fileName, std::ios::binary );
+    if( !file.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, could not open file " + fileName + "." );
+    }
+
+    // Read and check header
+    char fileIdentifier[ sizeof( chebyshevEphemerisFileIdentifier ) ];
+    std::int32_t fileVersion = 0, polynomialDegree = 0;
+    std::int64_t numberOfGranules = 0;
+
+    file.read( fileIdentifier, sizeof( fileIdentifier ) );
+    if( !file || std::memcmp( fileIdentifier, chebyshevEphemerisFileIdentifier, sizeof( fileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, file " + fileName +
+                                  " is not a Chebyshev ephemeris file." );
+    }
+
+    file.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    if( !file || fileVersion != chebyshevEphemerisFileVersion )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", unsupported version " +
+                                  std::to_string( fileVersion ) + " (or file written with different byte order)." );
+    }
+
+    file.read( reinterpret_cast< char* >( &polynomialDegree ), sizeof( polynomialDegree ) );
+    file.read( reinterpret_cast< char* >( &numberOfGranules ), sizeof( numberOfGranules ) );
+    if( !file || polynomialDegree < 0 || numberOfGranules < 1 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", invalid header." );
+    }
+    std::string referenceFrameOrigin = readStringFromBinaryFile( file, fileName );
+    std::string referenceFrameOrientation = readStringFromBinaryFile( file, fileName );
+
+    // Check size of remaining data, before allocating memory for it
+    std::streampos dataStart = file.tellg( );
+    file.seekg( 0, std::ios::end );
+    std::streamoff dataSize = file.tellg( ) - dataStart;
+    file.seekg( dataStart );
+
+    std::int64_t numberOfBoundaries = numberOfGranules + 1;
+    std::int64_t numberOfCoefficients = numberOfGranules * 3 * ( static_cast< std::int64_t >( polynomialDegree ) + 1 );
+    if( dataSize != static_cast< std::streamoff >( ( numberOfBoundaries + numberOfCoefficients ) * sizeof( double ) ) )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName +
+                                  ", file size is inconsistent with header." );
+    }
+
+    std::vector< double > granuleBoundaries( numberOfBoundaries );
+    std::vector< double > granuleCoefficients( numberOfCoefficients );
+    file.read( reinterpret_cast< char* >( granuleBoundaries.data( ) ), numberOfBoundaries * sizeof( double ) );
+    file.read( reinterpret_cast< char* >( granuleCoefficients.data( ) ), numberOfCoefficients * sizeof( double ) );
+    if( !file )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + "." );
+    }
+
+    return std::make_shared< ChebyshevEphemeris >(
+                granuleBoundaries, granuleCoefficients, polynomialDegree,
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
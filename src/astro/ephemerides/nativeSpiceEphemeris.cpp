@@ -0,0 +1,103 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include "tudat/astro/ephemerides/nativeSpiceEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor
+NativeSpiceEphemeris::NativeSpiceEphemeris(
+        const std::shared_ptr< input_output::SpiceKernelCollection > kernelCollection,
+        const int targetBodyId,
+        const int observerBodyId,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    kernelCollection_( kernelCollection ),
+    targetBodyId_( targetBodyId ),
+    observerBodyId_( observerBodyId ),
+    frameId_( input_output::getSpiceInertialFrameId( referenceFrameOrientation ) )
+{
+    if( !kernelCollection_->hasEphemerisData( targetBodyId_ ) && targetBodyId_ != 0 )
+    {
+        throw std::runtime_error( "Error when creating native SPICE ephemeris, no data found for body with NAIF code " +
+                                  std::to_string( targetBodyId_ ) + "." );
+    }
+}
+
+//! Function to calculate the Cartesian state of the body
+Eigen::Vector6d NativeSpiceEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    // Retrieve state from kernels, and convert from km to m
+    return 1000.0 * kernelCollection_->getCartesianState(
+                targetBodyId_, observerBodyId_, secondsSinceEpoch, frameId_ );
+}
+
+//! Constructor
+NativeSpiceRotationalEphemeris::NativeSpiceRotationalEphemeris(
+        const std::shared_ptr< input_output::SpiceKernelCollection > kernelCollection,
+        const int frameClassId,
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation ):
+    RotationalEphemeris( baseFrameOrientation, targetFrameOrientation ),
+    kernelCollection_( kernelCollection ),
+    frameClassId_( frameClassId ),
+    baseFrameId_( input_output::getSpiceInertialFrameId( baseFrameOrientation ) )
+{
+    if( !kernelCollection_->hasOrientationData( frameClassId_ ) )
+    {
+        throw std::runtime_error( "Error when creating native SPICE rotational ephemeris, no data found for frame "
+                                  "class " + std::to_string( frameClassId_ ) + "." );
+    }
+}
+
+//! Function to calculate the rotation quaternion from base frame to target frame.
+Eigen::Quaterniond NativeSpiceRotationalEphemeris::getRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    Eigen::Matrix3d rotationToFrame, rotationToFrameDerivative;
+    kernelCollection_->getRotationToBodyFixedFrame(
+                frameClassId_, secondsSinceEpoch, rotationToFrame, rotationToFrameDerivative, baseFrameId_ );
+    return Eigen::Quaterniond( rotationToFrame );
+}
+
+//! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+Eigen::Matrix3d NativeSpiceRotationalEphemeris::getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    Eigen::Matrix3d rotationToFrame, rotationToFrameDerivative;
+    kernelCollection_->getRotationToBodyFixedFrame(
+                frameClassId_, secondsSinceEpoch, rotationToFrame, rotationToFrameDerivative, baseFrameId_ );
+    return rotationToFrameDerivative;
+}
+
+//! Function to calculate the full rotational state at given time
+void NativeSpiceRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch )
+{
+    Eigen::Matrix3d rotationToFrame;
+    kernelCollection_->getRotationToBodyFixedFrame(
+                frameClassId_, secondsSinceEpoch, rotationToFrame, currentRotationToLocalFrameDerivative, baseFrameId_ );
+    currentRotationToLocalFrame = Eigen::Quaterniond( rotationToFrame );
+
+    currentAngularVelocityVectorInGlobalFrame = getRotationalVelocityVectorInBaseFrameFromMatrices(
+                rotationToFrame, currentRotationToLocalFrameDerivative.transpose( ) );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,441 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "tudat/astro/ephemerides/precomputedRotationalEphemeris.h"
+#include "tudat/basics/parallelExecution.h"
+#include "tudat/math/basic/linearAlgebra.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Identifier at the start of each precomputed rotational ephemeris file
+static const char precomputedRotationFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'R', 'O', 'T' };
+
+//! Version of the precomputed rotational ephemeris file format
+static const std::int32_t precomputedRotationFileVersion = 1;
+
+//! Constructor, from table data
+PrecomputedRotationalEphemeris::PrecomputedRotationalEphemeris(
+        const double tableStartTime,
+        const double tableTimeStep,
+        const std::vector< double >& nodeData,
+        const double nominalRotationRate,
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation,
+        const double maximumInterpolationError ):
+    RotationalEphemeris( baseFrameOrientation, targetFrameOrientation ),
+    tableStartTime_( tableStartTime ),
+    tableTimeStep_( tableTimeStep ),
+    nodeData_( nodeData ),
+    nominalRotationRate_( nominalRotationRate ),
+    maximumInterpolationError_( maximumInterpolationError )
+{
+    if( !( tableTimeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating precomputed rotational ephemeris, time step must be positive." );
+    }
+
+    if( nodeData_.size( ) % 8 != 0 || nodeData_.size( ) < 16 )
+    {
+        throw std::runtime_error( "Error when creating precomputed rotational ephemeris, " +
+                                  std::to_string( nodeData_.size( ) ) + " node data values provided, expected a "
+                                  "multiple of 8, for at least 2 nodes." );
+    }
+}
+
+//! Function to calculate the rotation quaternion from base frame to target frame.
+Eigen::Quaterniond PrecomputedRotationalEphemeris::getRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    Eigen::Quaterniond rotationToTargetFrame;
+    computeRotationToTargetFrame( secondsSinceEpoch, rotationToTargetFrame, nullptr );
+    return rotationToTargetFrame;
+}
+
+//! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+Eigen::Matrix3d PrecomputedRotationalEphemeris::getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    Eigen::Quaterniond rotationToTargetFrame;
+    Eigen::Matrix3d rotationToTargetFrameDerivative;
+    computeRotationToTargetFrame( secondsSinceEpoch, rotationToTargetFrame, &rotationToTargetFrameDerivative );
+    return rotationToTargetFrameDerivative;
+}
+
+//! Function to calculate the full rotational state at given time
+void PrecomputedRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch )
+{
+    computeRotationToTargetFrame( secondsSinceEpoch, currentRotationToLocalFrame,
+                                  &currentRotationToLocalFrameDerivative );
+    currentAngularVelocityVectorInGlobalFrame = getRotationalVelocityVectorInBaseFrameFromMatrices(
+                Eigen::Matrix3d( currentRotationToLocalFrame ), currentRotationToLocalFrameDerivative.transpose( ) );
+}
+
+//! Function to compute the interpolated rotation, and (optionally) its derivative, from base to target frame
+void PrecomputedRotationalEphemeris::computeRotationToTargetFrame(
+        const double secondsSinceEpoch,
+        Eigen::Quaterniond& rotationToTargetFrame,
+        Eigen::Matrix3d* rotationToTargetFrameDerivative )
+{
+    // Find interval of table containing requested time
+    int numberOfNodes = getNumberOfNodes( );
+    double timeSinceTableStart = secondsSinceEpoch - tableStartTime_;
+    if( !( timeSinceTableStart >= 0.0 &&
+           timeSinceTableStart <= static_cast< double >( numberOfNodes - 1 ) * tableTimeStep_ ) )
+    {
+        throw std::runtime_error( "Error when interpolating precomputed rotational ephemeris, time " +
+                                  std::to_string( secondsSinceEpoch ) + " is outside of table interval [" +
+                                  std::to_string( getTableStartTime( ) ) + ", " +
+                                  std::to_string( getTableEndTime( ) ) + "]." );
+    }
+    int intervalIndex = std::min( static_cast< int >( timeSinceTableStart / tableTimeStep_ ), numberOfNodes - 2 );
+    double s = timeSinceTableStart / tableTimeStep_ - static_cast< double >( intervalIndex );
+
+    Eigen::Map< const Eigen::Vector4d > startQuaternion( &nodeData_[ 8 * intervalIndex ] );
+    Eigen::Map< const Eigen::Vector4d > startQuaternionDerivative( &nodeData_[ 8 * intervalIndex + 4 ] );
+    Eigen::Map< const Eigen::Vector4d > endQuaternion( &nodeData_[ 8 * intervalIndex + 8 ] );
+    Eigen::Map< const Eigen::Vector4d > endQuaternionDerivative( &nodeData_[ 8 * intervalIndex + 12 ] );
+
+    // Compute cubic Hermite interpolant of residual rotation quaternion, and normalize
+    double s2 = s * s;
+    double s3 = s2 * s;
+    Eigen::Vector4d interpolatedQuaternion =
+            ( 2.0 * s3 - 3.0 * s2 + 1.0 ) * startQuaternion +
+            ( s3 - 2.0 * s2 + s ) * tableTimeStep_ * startQuaternionDerivative +
+            ( -2.0 * s3 + 3.0 * s2 ) * endQuaternion +
+            ( s3 - s2 ) * tableTimeStep_ * endQuaternionDerivative;
+    double interpolatedQuaternionNorm = interpolatedQuaternion.norm( );
+    Eigen::Vector4d normalizedQuaternion = interpolatedQuaternion / interpolatedQuaternionNorm;
+    Eigen::Quaterniond residualRotation(
+                normalizedQuaternion( 0 ), normalizedQuaternion( 1 ),
+                normalizedQuaternion( 2 ), normalizedQuaternion( 3 ) );
+
+    // Add nominal rotation about z-axis of target frame
+    Eigen::Quaterniond nominalRotation(
+                Eigen::AngleAxisd( -nominalRotationRate_ * timeSinceTableStart, Eigen::Vector3d::UnitZ( ) ) );
+    rotationToTargetFrame = nominalRotation * residualRotation;
+
+    if( rotationToTargetFrameDerivative != nullptr )
+    {
+        // Compute derivative of normalized interpolant
+        Eigen::Vector4d interpolatedQuaternionDerivative =
+                ( ( 6.0 * s2 - 6.0 * s ) * startQuaternion +
+                  ( 3.0 * s2 - 4.0 * s + 1.0 ) * tableTimeStep_ * startQuaternionDerivative +
+                  ( -6.0 * s2 + 6.0 * s ) * endQuaternion +
+                  ( 3.0 * s2 - 2.0 * s ) * tableTimeStep_ * endQuaternionDerivative ) / tableTimeStep_;
+        Eigen::Vector4d normalizedQuaternionDerivative =
+                ( interpolatedQuaternionDerivative -
+                  normalizedQuaternion * normalizedQuaternion.dot( interpolatedQuaternionDerivative ) ) /
+                interpolatedQuaternionNorm;
+
+        // Compute angular velocity of residual rotation, in its target frame: dM/dt = M [w]x
+        Eigen::Quaterniond residualRotationDerivative(
+                    normalizedQuaternionDerivative( 0 ), normalizedQuaternionDerivative( 1 ),
+                    normalizedQuaternionDerivative( 2 ), normalizedQuaternionDerivative( 3 ) );
+        Eigen::Vector3d residualAngularVelocity = 2.0 * ( residualRotation.conjugate( ) * residualRotationDerivative ).vec( );
+
+        Eigen::Matrix3d residualRotationMatrix = residualRotation.toRotationMatrix( );
+        *rotationToTargetFrameDerivative = nominalRotation.toRotationMatrix( ) * (
+                    -nominalRotationRate_ * linear_algebra::getCrossProductMatrix( Eigen::Vector3d::UnitZ( ) ) *
+                    residualRotationMatrix +
+                    residualRotationMatrix * linear_algebra::getCrossProductMatrix( residualAngularVelocity ) );
+    }
+}
+
+//! Function to compute the quaternion (w, x, y, z) of the residual rotation, w.r.t. a nominal rotation about the z-axis
+static Eigen::Vector4d computeResidualRotationQuaternion(
+        const std::shared_ptr< RotationalEphemeris > sourceRotationModel,
+        const double time,
+        const double tableStartTime,
+        const double nominalRotationRate )
+{
+    Eigen::Quaterniond residualRotation =
+            Eigen::Quaterniond( Eigen::AngleAxisd( nominalRotationRate * ( time - tableStartTime ),
+                                                   Eigen::Vector3d::UnitZ( ) ) ) *
+            sourceRotationModel->getRotationToTargetFrame( time );
+    return Eigen::Vector4d( residualRotation.w( ), residualRotation.x( ), residualRotation.y( ), residualRotation.z( ) );
+}
+
+//! Function to create a precomputed rotational ephemeris from a (computationally expensive) rotation model
+std::shared_ptr< PrecomputedRotationalEphemeris > createPrecomputedRotationalEphemeris(
+        const std::function< std::shared_ptr< RotationalEphemeris >( ) > sourceRotationModelCreationFunction,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const double maximumInterpolationError,
+        const unsigned int numberOfThreads,
+        const double nominalRotationRate )
+{
+    if( !( timeStep > 0.0 ) || !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when creating precomputed rotational ephemeris, time step must be positive, "
+                                  "and end time must be larger than start time." );
+    }
+
+    if( numberOfThreads == 0 )
+    {
+        throw std::runtime_error( "Error when creating precomputed rotational ephemeris, at least one thread is "
+                                  "required." );
+    }
+
+    // Create source rotation model for each thread
+    std::vector< std::shared_ptr< RotationalEphemeris > > sourceRotationModels( numberOfThreads );
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        sourceRotationModels.at( i ) = sourceRotationModelCreationFunction( );
+        if( sourceRotationModels.at( i ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating precomputed rotational ephemeris, no source rotation model "
+                                      "created." );
+        }
+    }
+
+    // Determine nominal rotation rate from source model, if required
+    double usedNominalRotationRate = nominalRotationRate;
+    if( std::isnan( usedNominalRotationRate ) )
+    {
+        Eigen::Quaterniond rotationToTargetFrame;
+        Eigen::Matrix3d rotationToTargetFrameDerivative;
+        Eigen::Vector3d angularVelocityInBaseFrame;
+        sourceRotationModels.at( 0 )->getFullRotationalQuantitiesToTargetFrame(
+                    rotationToTargetFrame, rotationToTargetFrameDerivative, angularVelocityInBaseFrame, startTime );
+        usedNominalRotationRate = ( rotationToTargetFrame * angularVelocityInBaseFrame ).z( );
+    }
+
+    // Compute residual rotation, and its derivative (from fourth-order central difference), at each node
+    int numberOfNodes = static_cast< int >( std::ceil( ( endTime - startTime ) / timeStep ) ) + 1;
+    double differenceStep = std::min( 60.0, timeStep / 4.0 );
+    std::vector< double > nodeData( 8 * numberOfNodes );
+    utilities::executeTasksInParallel(
+                numberOfNodes, numberOfThreads,
+                [ & ]( const unsigned int nodeIndex, const unsigned int threadIndex )
+    {
+        std::shared_ptr< RotationalEphemeris > sourceRotationModel = sourceRotationModels.at( threadIndex );
+        double nodeTime = startTime + static_cast< double >( nodeIndex ) * timeStep;
+
+        Eigen::Vector4d nodeQuaternion = computeResidualRotationQuaternion(
+                    sourceRotationModel, nodeTime, startTime, usedNominalRotationRate );
+        Eigen::Vector4d differenceQuaternions[ 4 ];
+        const double differenceOffsets[ 4 ] = { -2.0, -1.0, 1.0, 2.0 };
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            differenceQuaternions[ i ] = computeResidualRotationQuaternion(
+                        sourceRotationModel, nodeTime + differenceOffsets[ i ] * differenceStep,
+                        startTime, usedNominalRotationRate );
+            if( differenceQuaternions[ i ].dot( nodeQuaternion ) < 0.0 )
+            {
+                differenceQuaternions[ i ] *= -1.0;
+            }
+        }
+        Eigen::Vector4d nodeQuaternionDerivative =
+                ( differenceQuaternions[ 0 ] - 8.0 * differenceQuaternions[ 1 ] +
+                  8.0 * differenceQuaternions[ 2 ] - differenceQuaternions[ 3 ] ) / ( 12.0 * differenceStep );
+
+        Eigen::Map< Eigen::Vector4d > nodeQuaternionEntries( &nodeData[ 8 * nodeIndex ] );
+        Eigen::Map< Eigen::Vector4d > nodeQuaternionDerivativeEntries( &nodeData[ 8 * nodeIndex + 4 ] );
+        nodeQuaternionEntries = nodeQuaternion;
+        nodeQuaternionDerivativeEntries = nodeQuaternionDerivative;
+    } );
+
+    // Ensure continuity of quaternion sign between nodes
+    for( int i = 1; i < numberOfNodes; i++ )
+    {
+        Eigen::Map< Eigen::Vector4d > previousQuaternion( &nodeData[ 8 * ( i - 1 ) ] );
+        Eigen::Map< Eigen::Matrix< double, 8, 1 > > currentNode( &nodeData[ 8 * i ] );
+        if( currentNode.segment( 0, 4 ).dot( previousQuaternion ) < 0.0 )
+        {
+            currentNode *= -1.0;
+        }
+    }
+
+    std::string baseFrame = sourceRotationModels.at( 0 )->getBaseFrameOrientation( );
+    std::string targetFrame = sourceRotationModels.at( 0 )->getTargetFrameOrientation( );
+    std::shared_ptr< PrecomputedRotationalEphemeris > precomputedRotationModel =
+            std::make_shared< PrecomputedRotationalEphemeris >(
+                startTime, timeStep, nodeData, usedNominalRotationRate, baseFrame, targetFrame );
+
+    // Check interpolation error at midpoints of table intervals
+    if( !std::isnan( maximumInterpolationError ) )
+    {
+        std::vector< double > intervalErrors( numberOfNodes - 1 );
+        utilities::executeTasksInParallel(
+                    numberOfNodes - 1, numberOfThreads,
+                    [ & ]( const unsigned int intervalIndex, const unsigned int threadIndex )
+        {
+            double midpointTime = startTime + ( static_cast< double >( intervalIndex ) + 0.5 ) * timeStep;
+            intervalErrors.at( intervalIndex ) =
+                    precomputedRotationModel->getRotationToTargetFrame( midpointTime ).angularDistance(
+                        sourceRotationModels.at( threadIndex )->getRotationToTargetFrame( midpointTime ) );
+        } );
+
+        double maximumError = *std::max_element( intervalErrors.begin( ), intervalErrors.end( ) );
+        if( !( maximumError <= maximumInterpolationError ) )
+        {
+            throw std::runtime_error( "Error when creating precomputed rotational ephemeris, maximum interpolation "
+                                      "error " + std::to_string( maximumError ) + " rad exceeds tolerance " +
+                                      std::to_string( maximumInterpolationError ) + " rad; reduce the time step." );
+        }
+
+        precomputedRotationModel = std::make_shared< PrecomputedRotationalEphemeris >(
+                    startTime, timeStep, nodeData, usedNominalRotationRate, baseFrame, targetFrame, maximumError );
+    }
+
+    return precomputedRotationModel;
+}
+
+//! Function to write a string, preceded by its length, to a binary file
+static void writeStringToBinaryFile( std::ofstream& file, const std::string& stringToWrite )
+{
+    std::int32_t stringLength = static_cast< std::int32_t >( stringToWrite.size( ) );
+    file.write( reinterpret_cast< const char* >( &stringLength ), sizeof( stringLength ) );
+    file.write( stringToWrite.data( ), stringLength );
+}
+
+//! Function to read a string, preceded by its length, from a binary file
+static std::string readStringFromBinaryFile( std::ifstream& file, const std::string& fileName )
+{
+    std::int32_t stringLength = 0;
+    file.read( reinterpret_cast< char* >( &stringLength ), sizeof( stringLength ) );
+    if( !file || stringLength < 0 || stringLength > 65536 )
+    {
+        throw std::runtime_error( "Error when reading precomputed rotational ephemeris file " + fileName +
+                                  ", invalid header." );
+    }
+    std::string readString( stringLength, ' ' );
+    file.read( &readString[ 0 ], stringLength );
+    return readString;
+}
+
+//! Function to write a precomputed rotational ephemeris to a binary file
+void writePrecomputedRotationalEphemerisToFile(
+        const std::shared_ptr< PrecomputedRotationalEphemeris > rotationalEphemeris,
+        const std::string& fileName,
+        const std::string& sourceIdentifier )
+{
+    std::ofstream file( fileName, std::ios::binary | std::ios::trunc );
+    if( !file.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing precomputed rotational ephemeris, could not open file " +
+                                  fileName + "." );
+    }
+
+    std::int64_t numberOfNodes = rotationalEphemeris->getNumberOfNodes( );
+    double headerValues[ 4 ] = { rotationalEphemeris->getTableStartTime( ), rotationalEphemeris->getTableTimeStep( ),
+                                 rotationalEphemeris->getNominalRotationRate( ),
+                                 rotationalEphemeris->getMaximumInterpolationError( ) };
+
+    file.write( precomputedRotationFileIdentifier, sizeof( precomputedRotationFileIdentifier ) );
+    file.write( reinterpret_cast< const char* >( &precomputedRotationFileVersion ),
+                sizeof( precomputedRotationFileVersion ) );
+    file.write( reinterpret_cast< const char* >( &numberOfNodes ), sizeof( numberOfNodes ) );
+    file.write( reinterpret_cast< const char* >( headerValues ), sizeof( headerValues ) );
+    writeStringToBinaryFile( file, rotationalEphemeris->getBaseFrameOrientation( ) );
+    writeStringToBinaryFile( file, rotationalEphemeris->getTargetFrameOrientation( ) );
+    writeStringToBinaryFile( file, sourceIdentifier );
+
+    file.write( reinterpret_cast< const char* >( rotationalEphemeris->getNodeData( ).data( ) ),
+                rotationalEphemeris->getNodeData( ).size( ) * sizeof( double ) );
+
+    if( !file )
+    {
+        throw std::runtime_error( "Error when writing precomputed rotational ephemeris to file " + fileName + "." );
+    }
+}
+
+//! Function to read a precomputed rotational ephemeris from a binary file
+std::shared_ptr< PrecomputedRotationalEphemeris > readPrecomputedRotationalEphemerisFromFile(
+        const std::string& fileName,
+        std::string& sourceIdentifier )
+{
+    std::ifstream file( fileName, std::ios::binary );
+    if( !file.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading precomputed rotational ephemeris, could not open file " +
+                                  fileName + "." );
+    }
+
+    // Read and check header
+    char fileIdentifier[ sizeof( precomputedRotationFileIdentifier ) ];
+    std::int32_t fileVersion = 0;
+    std::int64_t numberOfNodes = 0;
+    double headerValues[ 4 ];
+
+    file.read( fileIdentifier, sizeof( fileIdentifier ) );
+    if( !file || std::memcmp( fileIdentifier, precomputedRotationFileIdentifier, sizeof( fileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading precomputed rotational ephemeris, file " + fileName +
+                                  " is not a precomputed rotational ephemeris file." );
+    }
+
+    file.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    if( !file || fileVersion != precomputedRotationFileVersion )
+    {
+        throw std::runtime_error( "Error when reading precomputed rotational ephemeris file " + fileName +
+                                  ", unsupported version " + std::to_string( fileVersion ) +
+                                  " (or file written with different byte order)." );
+    }
+
+    file.read( reinterpret_cast< char* >( &numberOfNodes ), sizeof( numberOfNodes ) );
+    file.read( reinterpret_cast< char* >( headerValues ), sizeof( headerValues ) );
+    if( !file || numberOfNodes < 2 )
+    {
+        throw std::runtime_error( "Error when reading precomputed rotational ephemeris file " + fileName +
+                                  ", invalid header." );
+    }
+    std::string baseFrame = readStringFromBinaryFile( file, fileName );
+    std::string targetFrame = readStringFromBinaryFile( file, fileName );
+    sourceIdentifier = readStringFromBinaryFile( file, fileName );
+
+    // Check size of remaining data, before allocating memory for it
+    std::streampos dataStart = file.tellg( );
+    file.seekg( 0, std::ios::end );
+    std::streamoff dataSize = file.tellg( ) - dataStart;
+    file.seekg( dataStart );
+    if( dataSize != static_cast< std::streamoff >( 8 * numberOfNodes * sizeof( double ) ) )
+    {
+        throw std::runtime_error( "Error when reading precomputed rotational ephemeris file " + fileName +
+                                  ", file size is inconsistent with header." );
+    }
+
+    std::vector< double > nodeData( 8 * numberOfNodes );
+    file.read( reinterpret_cast< char* >( nodeData.data( ) ), nodeData.size( ) * sizeof( double ) );
+    if( !file )
+    {
+        throw std::runtime_error( "Error when reading precomputed rotational ephemeris file " + fileName + "." );
+    }
+
+    return std::make_shared< PrecomputedRotationalEphemeris >(
+                headerValues[ 0 ], headerValues[ 1 ], nodeData, headerValues[ 2 ], baseFrame, targetFrame,
+            headerValues[ 3 ] );
+}
+
+//! Function to read a precomputed rotational ephemeris from a binary file
+std::shared_ptr< PrecomputedRotationalEphemeris > readPrecomputedRotationalEphemerisFromFile(
+        const std::string& fileName )
+{
+    std::string sourceIdentifier;
+    return readPrecomputedRotationalEphemerisFromFile( fileName, sourceIdentifier );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
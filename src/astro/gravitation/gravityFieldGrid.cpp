@@ -0,0 +1,462 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <iostream>
+
+#include "tudat/astro/gravitation/centralGravityModel.h"
+#include "tudat/astro/gravitation/gravityFieldGrid.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Maximum number of nodes per dimension used in interpolation.
+static const int MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS = 8;
+
+//! Constructor, sets grid dimensions and allocates memory for the node values.
+GravityFieldGridLayer::GravityFieldGridLayer( const double minimumRadius,
+                                              const double maximumRadius,
+                                              const int numberOfRadialNodes,
+                                              const int numberOfLatitudeNodes,
+                                              const int numberOfLongitudeNodes ):
+    minimumRadius_( minimumRadius ), maximumRadius_( maximumRadius ),
+    numberOfRadialNodes_( numberOfRadialNodes ), numberOfLatitudeNodes_( numberOfLatitudeNodes ),
+    numberOfLongitudeNodes_( numberOfLongitudeNodes ),
+    maximumAbsoluteError_( TUDAT_NAN ), maximumRelativeError_( TUDAT_NAN )
+{
+    logarithmicRadiusStep_ = std::log( maximumRadius_ / minimumRadius_ ) / static_cast< double >( numberOfRadialNodes_ - 1 );
+    latitudeStep_ = mathematical_constants::PI / static_cast< double >( numberOfLatitudeNodes_ - 1 );
+    longitudeStep_ = 2.0 * mathematical_constants::PI / static_cast< double >( numberOfLongitudeNodes_ );
+    residualAccelerations_.resize( 3 * getNumberOfNodes( ) );
+}
+
+//! Function to retrieve the body-fixed position of a grid node.
+Eigen::Vector3d GravityFieldGridLayer::getNodePosition( const double radialIndex,
+                                                        const double latitudeIndex,
+                                                        const double longitudeIndex ) const
+{
+    double radius = minimumRadius_ * std::exp( radialIndex * logarithmicRadiusStep_ );
+    double latitude = -mathematical_constants::PI / 2.0 + latitudeIndex * latitudeStep_;
+    double longitude = -mathematical_constants::PI + longitudeIndex * longitudeStep_;
+    return radius * ( Eigen::Vector3d( ) << std::cos( latitude ) * std::cos( longitude ),
+                      std::cos( latitude ) * std::sin( longitude ),
+                      std::sin( latitude ) ).finished( );
+}
+
+//! Constructor, generates the grid from the source gravity field.
+GravityFieldGrid::GravityFieldGrid(
+        const std::function< Eigen::Vector3d( const Eigen::Vector3d& ) > sourceAccelerationFunction,
+        const double gravitationalParameter,
+        const double minimumRadius,
+        const double maximumRadius,
+        const double relativeTolerance,
+        const int numberOfInterpolationPoints,
+        const double layerRadiusRatio,
+        const int maximumNumberOfNodesPerLayer,
+        const int numberOfErrorCheckPoints ):
+    sourceAccelerationFunction_( sourceAccelerationFunction ),
+    gravitationalParameter_( gravitationalParameter ),
+    minimumRadius_( minimumRadius ),
+    maximumRadius_( maximumRadius ),
+    relativeTolerance_( relativeTolerance ),
+    numberOfInterpolationPoints_( numberOfInterpolationPoints ),
+    maximumNumberOfNodesPerLayer_( maximumNumberOfNodesPerLayer ),
+    numberOfErrorCheckPoints_( numberOfErrorCheckPoints ),
+    numberOfEvaluationsOutsideGrid_( 0 )
+{
+    if( !( minimumRadius_ > 0.0 ) || !( maximumRadius_ > minimumRadius_ ) )
+    {
+        throw std::runtime_error( "Error when creating gravity field grid, radial range (" +
+                                  std::to_string( minimumRadius_ ) + ", " + std::to_string( maximumRadius_ ) +
+                                  ") is invalid" );
+    }
+
+    if( !( relativeTolerance_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating gravity field grid, tolerance must be positive" );
+    }
+
+    if( numberOfInterpolationPoints_ < 2 || numberOfInterpolationPoints_ > MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS )
+    {
+        throw std::runtime_error( "Error when creating gravity field grid, number of interpolation points " +
+                                  std::to_string( numberOfInterpolationPoints_ ) + " is not supported" );
+    }
+
+    if( !( layerRadiusRatio > 1.0 ) )
+    {
+        throw std::runtime_error( "Error when creating gravity field grid, layer radius ratio must be larger than 1" );
+    }
+
+    // Precompute denominators of Lagrange basis polynomials for nodes 0, 1, ..., N-1
+    lagrangeDenominators_.resize( numberOfInterpolationPoints_ );
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        lagrangeDenominators_[ i ] = 1.0;
+        for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+        {
+            if( i != j )
+            {
+                lagrangeDenominators_[ i ] *= static_cast< double >( i - j );
+            }
+        }
+    }
+
+    // Split radial range into layers with equal radius ratio
+    int numberOfLayers = static_cast< int >(
+                std::ceil( std::log( maximumRadius_ / minimumRadius_ ) / std::log( layerRadiusRatio ) - 1.0E-12 ) );
+    double actualLayerRadiusRatio = std::pow( maximumRadius_ / minimumRadius_, 1.0 / static_cast< double >( numberOfLayers ) );
+    for( int i = 0; i < numberOfLayers; i++ )
+    {
+        layerBoundaries_.push_back( minimumRadius_ * std::pow( actualLayerRadiusRatio, static_cast< double >( i ) ) );
+    }
+    layerBoundaries_.push_back( maximumRadius_ );
+
+    // Generate layers
+    for( int i = 0; i < numberOfLayers; i++ )
+    {
+        layers_.push_back( createLayer( layerBoundaries_.at( i ), layerBoundaries_.at( i + 1 ) ) );
+    }
+
+    layerLookUpScheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+                layerBoundaries_ );
+}
+
+//! Function to compute the acceleration at a given body-fixed position.
+Eigen::Vector3d GravityFieldGrid::getAcceleration( const Eigen::Vector3d& bodyFixedPosition )
+{
+    if( !isPositionInsideGrid( bodyFixedPosition ) )
+    {
+        numberOfEvaluationsOutsideGrid_++;
+        return sourceAccelerationFunction_( bodyFixedPosition );
+    }
+
+    Eigen::Vector3d residualAcceleration;
+    interpolateResidualAcceleration( layers_.at( findLayerIndex( bodyFixedPosition.norm( ) ) ),
+                                     bodyFixedPosition, residualAcceleration );
+    return residualAcceleration + computeGravitationalAcceleration( bodyFixedPosition, gravitationalParameter_ );
+}
+
+//! Function to compute the acceleration, and its gradient w.r.t. the position, at a given body-fixed position.
+void GravityFieldGrid::getAccelerationAndGradient( const Eigen::Vector3d& bodyFixedPosition,
+                                                   Eigen::Vector3d& acceleration,
+                                                   Eigen::Matrix3d& accelerationGradient )
+{
+    if( !isPositionInsideGrid( bodyFixedPosition ) )
+    {
+        throw std::runtime_error( "Error when computing acceleration gradient from gravity field grid, position with radius " +
+                                  std::to_string( bodyFixedPosition.norm( ) ) + " is outside of grid" );
+    }
+
+    Eigen::Vector3d residualAcceleration;
+    interpolateResidualAcceleration( layers_.at( findLayerIndex( bodyFixedPosition.norm( ) ) ),
+                                     bodyFixedPosition, residualAcceleration, &accelerationGradient );
+
+    // Add point-mass contribution
+    double radius = bodyFixedPosition.norm( );
+    double inverseCubedRadius = 1.0 / ( radius * radius * radius );
+    acceleration = residualAcceleration - gravitationalParameter_ * inverseCubedRadius * bodyFixedPosition;
+    accelerationGradient += gravitationalParameter_ * inverseCubedRadius * (
+                3.0 / ( radius * radius ) * bodyFixedPosition * bodyFixedPosition.transpose( ) -
+                Eigen::Matrix3d::Identity( ) );
+}
+
+//! Function to compute the difference between the interpolated and source acceleration at a given position.
+double GravityFieldGrid::computeRelativeInterpolationError( const Eigen::Vector3d& bodyFixedPosition )
+{
+    return ( getAcceleration( bodyFixedPosition ) - sourceAccelerationFunction_( bodyFixedPosition ) ).norm( ) *
+            bodyFixedPosition.squaredNorm( ) / gravitationalParameter_;
+}
+
+//! Function to retrieve the total number of nodes in the grid.
+int GravityFieldGrid::getNumberOfNodes( ) const
+{
+    int numberOfNodes = 0;
+    for( unsigned int i = 0; i < layers_.size( ); i++ )
+    {
+        numberOfNodes += layers_.at( i ).getNumberOfNodes( );
+    }
+    return numberOfNodes;
+}
+
+//! Function to retrieve the maximum relative error at the check points, over all layers.
+double GravityFieldGrid::getMaximumRelativeError( ) const
+{
+    double maximumError = 0.0;
+    for( unsigned int i = 0; i < layers_.size( ); i++ )
+    {
+        maximumError = std::max( maximumError, layers_.at( i ).maximumRelativeError_ );
+    }
+    return maximumError;
+}
+
+//! Function to retrieve the maximum absolute error (in m/s^2) at the check points, over all layers.
+double GravityFieldGrid::getMaximumAbsoluteError( ) const
+{
+    double maximumError = 0.0;
+    for( unsigned int i = 0; i < layers_.size( ); i++ )
+    {
+        maximumError = std::max( maximumError, layers_.at( i ).maximumAbsoluteError_ );
+    }
+    return maximumError;
+}
+
+//! Function to generate a single layer, refining it until the tolerance is met.
+GravityFieldGridLayer GravityFieldGrid::createLayer( const double minimumRadius, const double maximumRadius )
+{
+    // Set initial (coarse) resolution
+    int numberOfRadialNodes = numberOfInterpolationPoints_;
+    int numberOfLatitudeNodes = std::max( 9, numberOfInterpolationPoints_ );
+    int numberOfLongitudeNodes = 2 * ( numberOfLatitudeNodes - 1 );
+
+    double radialError = TUDAT_NAN, angularError = TUDAT_NAN;
+    double radialAbsoluteError = TUDAT_NAN, angularAbsoluteError = TUDAT_NAN;
+    while( true )
+    {
+        GravityFieldGridLayer layer( minimumRadius, maximumRadius, numberOfRadialNodes,
+                                     numberOfLatitudeNodes, numberOfLongitudeNodes );
+        computeLayerNodeValues( layer );
+
+        // Compute errors from radial and angular interpolation separately
+        radialError = computeLayerInterpolationError(
+                    layer, Eigen::Vector3d( 0.5, 0.0, 0.0 ), radialAbsoluteError );
+        angularError = computeLayerInterpolationError(
+                    layer, Eigen::Vector3d( 0.0, 0.5, 0.5 ), angularAbsoluteError );
+
+        bool refineRadially = ( radialError > 0.5 * relativeTolerance_ );
+        bool refineAngularly = ( angularError > 0.5 * relativeTolerance_ );
+
+        if( refineRadially || refineAngularly )
+        {
+            // Halve node spacing in directions where the tolerance is not met
+            int newNumberOfRadialNodes = refineRadially ? 2 * numberOfRadialNodes - 1 : numberOfRadialNodes;
+            int newNumberOfLatitudeNodes = refineAngularly ? 2 * numberOfLatitudeNodes - 1 : numberOfLatitudeNodes;
+            int newNumberOfLongitudeNodes = refineAngularly ? 2 * numberOfLongitudeNodes : numberOfLongitudeNodes;
+
+            if( static_cast< double >( newNumberOfRadialNodes ) * static_cast< double >( newNumberOfLatitudeNodes ) *
+                    static_cast< double >( newNumberOfLongitudeNodes ) <= maximumNumberOfNodesPerLayer_ )
+            {
+                numberOfRadialNodes = newNumberOfRadialNodes;
+                numberOfLatitudeNodes = newNumberOfLatitudeNodes;
+                numberOfLongitudeNodes = newNumberOfLongitudeNodes;
+                continue;
+            }
+
+            std::cerr << "Warning when creating gravity field grid, maximum number of nodes reached for layer between radii "
+                      << minimumRadius << " and " << maximumRadius << "; relative interpolation error is estimated at "
+                      << std::max( radialError, angularError ) << ", tolerance is " << relativeTolerance_ << std::endl;
+        }
+
+        // Compute error estimate of final layer at cell centres, which combines all directions
+        double cellCentreAbsoluteError;
+        double cellCentreError = computeLayerInterpolationError(
+                    layer, Eigen::Vector3d( 0.5, 0.5, 0.5 ), cellCentreAbsoluteError );
+        layer.maximumRelativeError_ = std::max( cellCentreError, std::max( radialError, angularError ) );
+        layer.maximumAbsoluteError_ = std::max( cellCentreAbsoluteError,
+                                                std::max( radialAbsoluteError, angularAbsoluteError ) );
+        return layer;
+    }
+}
+
+//! Function to fill the node values of a layer from the source field.
+void GravityFieldGrid::computeLayerNodeValues( GravityFieldGridLayer& layer )
+{
+    Eigen::Vector3d nodePosition;
+    for( int i = 0; i < layer.numberOfRadialNodes_; i++ )
+    {
+        for( int j = 0; j < layer.numberOfLatitudeNodes_; j++ )
+        {
+            for( int k = 0; k < layer.numberOfLongitudeNodes_; k++ )
+            {
+                nodePosition = layer.getNodePosition( i, j, k );
+                Eigen::Map< Eigen::Vector3d >( &layer.residualAccelerations_[ layer.getNodeValueIndex( i, j, k ) ] ) =
+                        sourceAccelerationFunction_( nodePosition ) -
+                        computeGravitationalAcceleration( nodePosition, gravitationalParameter_ );
+            }
+        }
+    }
+}
+
+//! Function to compute the maximum interpolation error at a set of check points in a layer.
+double GravityFieldGrid::computeLayerInterpolationError( const GravityFieldGridLayer& layer,
+                                                         const Eigen::Vector3d& nodeOffsets,
+                                                         double& maximumAbsoluteError )
+{
+    // Irrational multipliers of additive recurrence (R3 sequence), used to distribute check points over cells
+    static const double sequenceMultipliers[ 3 ] = { 0.8191725133961645, 0.6710436067037893, 0.5497004779019703 };
+    const int numberOfCells[ 3 ] = { layer.numberOfRadialNodes_ - 1, layer.numberOfLatitudeNodes_ - 1,
+                                     layer.numberOfLongitudeNodes_ };
+
+    double maximumRelativeError = 0.0;
+    maximumAbsoluteError = 0.0;
+
+    Eigen::Vector3d checkPosition, residualAcceleration;
+    double cellIndices[ 3 ];
+    for( int i = 0; i < numberOfErrorCheckPoints_; i++ )
+    {
+        for( int j = 0; j < 3; j++ )
+        {
+            double sequenceValue = 0.5 + sequenceMultipliers[ j ] * static_cast< double >( i );
+            cellIndices[ j ] = std::min( std::floor( ( sequenceValue - std::floor( sequenceValue ) ) * numberOfCells[ j ] ),
+                                         static_cast< double >( numberOfCells[ j ] - 1 ) ) + nodeOffsets( j );
+        }
+        checkPosition = layer.getNodePosition( cellIndices[ 0 ], cellIndices[ 1 ], cellIndices[ 2 ] );
+
+        interpolateResidualAcceleration( layer, checkPosition, residualAcceleration );
+        double absoluteError = ( residualAcceleration +
+                                 computeGravitationalAcceleration( checkPosition, gravitationalParameter_ ) -
+                                 sourceAccelerationFunction_( checkPosition ) ).norm( );
+        maximumAbsoluteError = std::max( maximumAbsoluteError, absoluteError );
+        maximumRelativeError = std::max(
+                    maximumRelativeError, absoluteError * checkPosition.squaredNorm( ) / gravitationalParameter_ );
+    }
+    return maximumRelativeError;
+}
+
+//! Function to interpolate the residual acceleration (and optionally its gradient) in a layer.
+void GravityFieldGrid::interpolateResidualAcceleration( const GravityFieldGridLayer& layer,
+                                                        const Eigen::Vector3d& bodyFixedPosition,
+                                                        Eigen::Vector3d& residualAcceleration,
+                                                        Eigen::Matrix3d* residualGradient ) const
+{
+    // Compute spherical coordinates, in units of node spacing
+    double radius = bodyFixedPosition.norm( );
+    double horizontalDistance = bodyFixedPosition.segment( 0, 2 ).norm( );
+    double radialCoordinate = std::log( radius / layer.minimumRadius_ ) / layer.logarithmicRadiusStep_;
+    double latitudeCoordinate = ( std::atan2( bodyFixedPosition.z( ), horizontalDistance ) +
+                                  mathematical_constants::PI / 2.0 ) / layer.latitudeStep_;
+    double longitudeCoordinate = ( std::atan2( bodyFixedPosition.y( ), bodyFixedPosition.x( ) ) +
+                                   mathematical_constants::PI ) / layer.longitudeStep_;
+
+    // Compute interpolation weights per dimension
+    int firstRadialIndex, firstLatitudeIndex, firstLongitudeIndex;
+    double radialWeights[ MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS ];
+    double latitudeWeights[ MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS ];
+    double longitudeWeights[ MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS ];
+    double radialWeightDerivatives[ MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS ];
+    double latitudeWeightDerivatives[ MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS ];
+    double longitudeWeightDerivatives[ MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS ];
+    computeInterpolationWeights( radialCoordinate, layer.numberOfRadialNodes_, false,
+                                 firstRadialIndex, radialWeights, radialWeightDerivatives );
+    computeInterpolationWeights( latitudeCoordinate, layer.numberOfLatitudeNodes_, false,
+                                 firstLatitudeIndex, latitudeWeights, latitudeWeightDerivatives );
+    computeInterpolationWeights( longitudeCoordinate, layer.numberOfLongitudeNodes_, true,
+                                 firstLongitudeIndex, longitudeWeights, longitudeWeightDerivatives );
+
+    int longitudeIndices[ MAXIMUM_NUMBER_OF_INTERPOLATION_POINTS ];
+    for( int k = 0; k < numberOfInterpolationPoints_; k++ )
+    {
+        longitudeIndices[ k ] = ( ( firstLongitudeIndex + k ) % layer.numberOfLongitudeNodes_ +
+                                  layer.numberOfLongitudeNodes_ ) % layer.numberOfLongitudeNodes_;
+    }
+
+    // Perform tensor-product interpolation; columns of derivative matrix are w.r.t. radial/latitude/longitude coordinates
+    residualAcceleration.setZero( );
+    Eigen::Matrix3d coordinateDerivatives = Eigen::Matrix3d::Zero( );
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+        {
+            Eigen::Vector3d longitudeSum = Eigen::Vector3d::Zero( );
+            Eigen::Vector3d longitudeDerivativeSum = Eigen::Vector3d::Zero( );
+            for( int k = 0; k < numberOfInterpolationPoints_; k++ )
+            {
+                Eigen::Map< const Eigen::Vector3d > nodeValue(
+                            &layer.residualAccelerations_[ layer.getNodeValueIndex(
+                                firstRadialIndex + i, firstLatitudeIndex + j, longitudeIndices[ k ] ) ] );
+                longitudeSum += longitudeWeights[ k ] * nodeValue;
+                if( residualGradient != nullptr )
+                {
+                    longitudeDerivativeSum += longitudeWeightDerivatives[ k ] * nodeValue;
+                }
+            }
+
+            residualAcceleration += radialWeights[ i ] * latitudeWeights[ j ] * longitudeSum;
+            if( residualGradient != nullptr )
+            {
+                coordinateDerivatives.col( 0 ) += radialWeightDerivatives[ i ] * latitudeWeights[ j ] * longitudeSum;
+                coordinateDerivatives.col( 1 ) += radialWeights[ i ] * latitudeWeightDerivatives[ j ] * longitudeSum;
+                coordinateDerivatives.col( 2 ) += radialWeights[ i ] * latitudeWeights[ j ] * longitudeDerivativeSum;
+            }
+        }
+    }
+
+    if( residualGradient != nullptr )
+    {
+        // Compute partials of grid coordinates w.r.t. Cartesian position
+        Eigen::Matrix3d coordinatePartials = Eigen::Matrix3d::Zero( );
+        double squaredRadius = radius * radius;
+        coordinatePartials.row( 0 ) = bodyFixedPosition.transpose( ) / ( squaredRadius * layer.logarithmicRadiusStep_ );
+        if( horizontalDistance > 1.0E-12 * radius )
+        {
+            coordinatePartials.row( 1 ) <<
+                -bodyFixedPosition.x( ) * bodyFixedPosition.z( ) / ( squaredRadius * horizontalDistance ),
+                -bodyFixedPosition.y( ) * bodyFixedPosition.z( ) / ( squaredRadius * horizontalDistance ),
+                horizontalDistance / squaredRadius;
+            coordinatePartials.row( 1 ) /= layer.latitudeStep_;
+
+            double squaredHorizontalDistance = horizontalDistance * horizontalDistance;
+            coordinatePartials.row( 2 ) <<
+                -bodyFixedPosition.y( ) / squaredHorizontalDistance,
+                bodyFixedPosition.x( ) / squaredHorizontalDistance,
+                0.0;
+            coordinatePartials.row( 2 ) /= layer.longitudeStep_;
+        }
+        *residualGradient = coordinateDerivatives * coordinatePartials;
+    }
+}
+
+//! Function to compute the Lagrange interpolation weights (and their derivatives) of a single dimension.
+void GravityFieldGrid::computeInterpolationWeights( const double nodeCoordinate,
+                                                    const int numberOfNodes,
+                                                    const bool isPeriodic,
+                                                    int& firstNodeIndex,
+                                                    double* weights,
+                                                    double* weightDerivatives ) const
+{
+    // Center stencil around interpolation point, and shift it inside the grid for non-periodic dimensions
+    firstNodeIndex = static_cast< int >( std::floor( nodeCoordinate ) ) - ( numberOfInterpolationPoints_ - 1 ) / 2;
+    if( !isPeriodic )
+    {
+        firstNodeIndex = std::max( 0, std::min( firstNodeIndex, numberOfNodes - numberOfInterpolationPoints_ ) );
+    }
+
+    double stencilCoordinate = nodeCoordinate - static_cast< double >( firstNodeIndex );
+    for( int i = 0; i < numberOfInterpolationPoints_; i++ )
+    {
+        double numerator = 1.0;
+        double numeratorDerivative = 0.0;
+        for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+        {
+            if( i != j )
+            {
+                numeratorDerivative = numeratorDerivative * ( stencilCoordinate - j ) + numerator;
+                numerator *= ( stencilCoordinate - j );
+            }
+        }
+        weights[ i ] = numerator / lagrangeDenominators_[ i ];
+        weightDerivatives[ i ] = numeratorDerivative / lagrangeDenominators_[ i ];
+    }
+}
+
+//! Function to find the layer in which a given radius is located.
+int GravityFieldGrid::findLayerIndex( const double radius )
+{
+    int layerIndex = layerLookUpScheme_->findNearestLowerNeighbour( radius );
+    return std::max( 0, std::min( layerIndex, static_cast< int >( layers_.size( ) ) - 1 ) );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
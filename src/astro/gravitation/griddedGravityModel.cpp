@@ -0,0 +1,42 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "tudat/astro/gravitation/griddedGravityModel.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Update class members.
+void GriddedGravitationalAccelerationModel::updateMembers( const double currentTime )
+{
+    if( !( this->currentTime_ == currentTime ) )
+    {
+        rotationToIntegrationFrame_ = rotationFromBodyFixedToIntegrationFrameFunction_( );
+
+        subjectPositionFunction_( positionOfBodySubjectToAcceleration_ );
+        sourcePositionFunction_( positionOfBodyExertingAcceleration_ );
+        currentInertialRelativePosition_ = positionOfBodySubjectToAcceleration_ - positionOfBodyExertingAcceleration_;
+
+        currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * currentInertialRelativePosition_;
+
+        // Retrieve acceleration from grid, and scale to current gravitational parameter
+        currentAcceleration_ = rotationToIntegrationFrame_ * (
+                    gravityFieldGrid_->getAcceleration( currentRelativePosition_ ) *
+                    ( gravitationalParameterFunction_( ) / gravityFieldGrid_->getGravitationalParameter( ) ) );
+    }
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -0,0 +1,145 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "tudat/astro/basic_astro/polyhedronFuntions.h"
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to compute the weight of the polyhedron in a hybrid polyhedron/spherical harmonic gravity field.
+double computeHybridGravityFieldPolyhedronWeight(
+        const double radius, const double innerSwitchRadius, const double outerSwitchRadius )
+{
+    if( radius <= innerSwitchRadius )
+    {
+        return 1.0;
+    }
+    else if( radius >= outerSwitchRadius )
+    {
+        return 0.0;
+    }
+    else
+    {
+        const double layerFraction = ( radius - innerSwitchRadius ) / ( outerSwitchRadius - innerSwitchRadius );
+        return 1.0 - layerFraction * layerFraction * ( 3.0 - 2.0 * layerFraction );
+    }
+}
+
+//! Function to compute the derivative of the weight of the polyhedron in a hybrid gravity field w.r.t. the radius.
+double computeHybridGravityFieldPolyhedronWeightDerivative(
+        const double radius, const double innerSwitchRadius, const double outerSwitchRadius )
+{
+    if( radius <= innerSwitchRadius || radius >= outerSwitchRadius )
+    {
+        return 0.0;
+    }
+    else
+    {
+        const double layerFraction = ( radius - innerSwitchRadius ) / ( outerSwitchRadius - innerSwitchRadius );
+        return -6.0 * layerFraction * ( 1.0 - layerFraction ) / ( outerSwitchRadius - innerSwitchRadius );
+    }
+}
+
+//! Constructor.
+HybridPolyhedronGravityField::HybridPolyhedronGravityField(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int maximumDegree,
+        const double brillouinSphereMargin,
+        const double switchLayerWidth,
+        const std::string& fixedReferenceFrame,
+        const std::function< void( ) > updateInertiaTensor ):
+    PolyhedronGravityField( gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet,
+                            fixedReferenceFrame, updateInertiaTensor )
+{
+    if( brillouinSphereMargin < 0.0 || switchLayerWidth <= 0.0 )
+    {
+        throw std::runtime_error( "Error when creating hybrid polyhedron gravity field, brillouin sphere margin (" +
+                                  std::to_string( brillouinSphereMargin ) + ") must be non-negative, and switch "
+                                  "layer width (" + std::to_string( switchLayerWidth ) + ") must be positive." );
+    }
+
+    brillouinRadius_ = basic_astrodynamics::computePolyhedronBrillouinRadius( verticesCoordinates );
+    innerSwitchRadius_ = brillouinRadius_ * ( 1.0 + brillouinSphereMargin );
+    outerSwitchRadius_ = innerSwitchRadius_ * ( 1.0 + switchLayerWidth );
+
+    // Compute exterior spherical harmonic expansion of polyhedron
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                verticesCoordinates, verticesDefiningEachFacet, maximumDegree, brillouinRadius_,
+                cosineCoefficients, sineCoefficients );
+    exteriorGravityField_ = std::make_shared< SphericalHarmonicsGravityField >(
+                gravitationalParameter, brillouinRadius_, cosineCoefficients, sineCoefficients, fixedReferenceFrame );
+}
+
+//! Function to calculate the gravitational potential.
+double HybridPolyhedronGravityField::getGravitationalPotential( const Eigen::Vector3d& bodyFixedPosition )
+{
+    const double polyhedronWeight = computeHybridGravityFieldPolyhedronWeight(
+                bodyFixedPosition.norm( ), innerSwitchRadius_, outerSwitchRadius_ );
+
+    double potential = 0.0;
+    if( polyhedronWeight > 0.0 )
+    {
+        potential += polyhedronWeight * PolyhedronGravityField::getGravitationalPotential( bodyFixedPosition );
+    }
+    if( polyhedronWeight < 1.0 )
+    {
+        potential += ( 1.0 - polyhedronWeight ) * getExteriorGravityFieldScaling( ) *
+                exteriorGravityField_->getGravitationalPotential( bodyFixedPosition );
+    }
+    return potential;
+}
+
+//! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
+Eigen::Vector3d HybridPolyhedronGravityField::getGradientOfPotential( const Eigen::Vector3d& bodyFixedPosition )
+{
+    const double polyhedronWeight = computeHybridGravityFieldPolyhedronWeight(
+                bodyFixedPosition.norm( ), innerSwitchRadius_, outerSwitchRadius_ );
+
+    Eigen::Vector3d gradient = Eigen::Vector3d::Zero( );
+    if( polyhedronWeight > 0.0 )
+    {
+        gradient += polyhedronWeight * PolyhedronGravityField::getGradientOfPotential( bodyFixedPosition );
+    }
+    if( polyhedronWeight < 1.0 )
+    {
+        gradient += ( 1.0 - polyhedronWeight ) * getExteriorGravityFieldScaling( ) *
+                exteriorGravityField_->getGradientOfPotential( bodyFixedPosition );
+    }
+    return gradient;
+}
+
+//! Function to calculate the laplacian of the gravitational potential.
+double HybridPolyhedronGravityField::getLaplacianOfPotential( const Eigen::Vector3d& bodyFixedPosition )
+{
+    const double polyhedronWeight = computeHybridGravityFieldPolyhedronWeight(
+                bodyFixedPosition.norm( ), innerSwitchRadius_, outerSwitchRadius_ );
+
+    // Laplacian of exterior field is zero
+    if( polyhedronWeight > 0.0 )
+    {
+        return polyhedronWeight * PolyhedronGravityField::getLaplacianOfPotential( bodyFixedPosition );
+    }
+    else
+    {
+        return 0.0;
+    }
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -0,0 +1,484 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Pines, S. Uniform representation of the gravitational potential and its derivatives.
+ *        AIAA Journal, 11(11):1508-1511, 1973.
+ *      Lundberg, J.B., Schutz, B.E. Recursion formulas of Legendre functions for use with
+ *        nonsingular geopotential models. Journal of Guidance, Control, and Dynamics, 11(1):31-38, 1988.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/gravitation/pinesSphericalHarmonicsGravity.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Update maximum degree and order of cache, and recompute all recursion multipliers.
+void PinesSphericalHarmonicsCache::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    maximumDegree_ = maximumDegree;
+    maximumOrder_ = std::min( maximumOrder, maximumDegree );
+
+    // The gravity gradient requires derived Legendre functions up to one degree and two orders above the coefficients
+    const int numberOfDegreeRows = maximumDegree_ + 2;
+    const int numberOfOrderColumns = maximumOrder_ + 3;
+
+    computeGeodesyNormalizedColumnRecursionMultipliers(
+                numberOfDegreeRows - 1, numberOfOrderColumns, firstColumnMultipliers_, secondColumnMultipliers_,
+                derivativeMultipliers_, sectoralMultipliers_ );
+
+    radialMultipliers_.setZero( numberOfDegreeRows, numberOfOrderColumns );
+    for( int order = 0; order < numberOfOrderColumns; order++ )
+    {
+        const double doubleOrder = static_cast< double >( order );
+        const double normalizationFactor = ( order == 0 ) ? 0.5 : 1.0;
+        for( int degree = order; degree < numberOfDegreeRows; degree++ )
+        {
+            const double doubleDegree = static_cast< double >( degree );
+            radialMultipliers_( degree, order ) = std::sqrt(
+                        normalizationFactor * ( 2.0 * doubleDegree + 1.0 ) / ( 2.0 * doubleDegree + 3.0 ) *
+                        ( doubleDegree + doubleOrder + 1.0 ) * ( doubleDegree + doubleOrder + 2.0 ) );
+        }
+    }
+
+    degreePlusTwo_ = Eigen::VectorXd::LinSpaced(
+                numberOfDegreeRows, 2.0, static_cast< double >( numberOfDegreeRows + 1 ) );
+    radiusRatioPowers_.setZero( numberOfDegreeRows );
+    realTerms_.setZero( numberOfOrderColumns );
+    imaginaryTerms_.setZero( numberOfOrderColumns );
+    derivedLegendreFunctions_.setZero( numberOfDegreeRows, numberOfOrderColumns );
+
+    workBuffers_.resize( 5 );
+    for( unsigned int i = 0; i < workBuffers_.size( ); i++ )
+    {
+        workBuffers_.at( i ).setZero( numberOfDegreeRows );
+    }
+
+    currentPosition_.setConstant( TUDAT_NAN );
+    currentReferenceRadius_ = TUDAT_NAN;
+    currentRadius_ = TUDAT_NAN;
+    currentUnitPosition_.setConstant( TUDAT_NAN );
+}
+
+//! Update cache to the current body-fixed position.
+void PinesSphericalHarmonicsCache::update( const Eigen::Vector3d& bodyFixedPosition, const double referenceRadius )
+{
+    if( bodyFixedPosition == currentPosition_ && referenceRadius == currentReferenceRadius_ )
+    {
+        return;
+    }
+
+    currentPosition_ = bodyFixedPosition;
+    currentReferenceRadius_ = referenceRadius;
+    currentRadius_ = bodyFixedPosition.norm( );
+
+    if( !( currentRadius_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when updating Pines spherical harmonic cache, position is at origin" );
+    }
+    currentUnitPosition_ = bodyFixedPosition / currentRadius_;
+
+    const double s = currentUnitPosition_.x( );
+    const double t = currentUnitPosition_.y( );
+    const double u = currentUnitPosition_.z( );
+
+    // Compute powers of radius ratio
+    const double radiusRatio = referenceRadius / currentRadius_;
+    double currentRatioPower = radiusRatio;
+    for( int i = 0; i < radiusRatioPowers_.rows( ); i++ )
+    {
+        radiusRatioPowers_( i ) = currentRatioPower;
+        currentRatioPower *= radiusRatio;
+    }
+
+    // Compute real and imaginary parts of (s + i t)^m
+    realTerms_( 0 ) = 1.0;
+    imaginaryTerms_( 0 ) = 0.0;
+    for( int i = 1; i < realTerms_.rows( ); i++ )
+    {
+        realTerms_( i ) = realTerms_( i - 1 ) * s - imaginaryTerms_( i - 1 ) * t;
+        imaginaryTerms_( i ) = imaginaryTerms_( i - 1 ) * s + realTerms_( i - 1 ) * t;
+    }
+
+    // Compute geodesy-normalized derived Legendre functions, order by order
+    const int numberOfDegrees = static_cast< int >( derivedLegendreFunctions_.rows( ) );
+    const int numberOfOrders = std::min(
+                static_cast< int >( derivedLegendreFunctions_.cols( ) ), numberOfDegrees );
+    double sectoralFunction = 1.0;
+    for( int order = 0; order < numberOfOrders; order++ )
+    {
+        if( order > 0 )
+        {
+            sectoralFunction *= sectoralMultipliers_( order );
+        }
+
+        const double* firstMultipliers = firstColumnMultipliers_.col( order ).data( );
+        const double* secondMultipliers = secondColumnMultipliers_.col( order ).data( );
+        double* legendreFunctionData = derivedLegendreFunctions_.col( order ).data( );
+
+        legendreFunctionData[ order ] = sectoralFunction;
+        if( order + 1 < numberOfDegrees )
+        {
+            legendreFunctionData[ order + 1 ] = firstMultipliers[ order + 1 ] * u * sectoralFunction;
+        }
+        for( int degree = order + 2; degree < numberOfDegrees; degree++ )
+        {
+            legendreFunctionData[ degree ] =
+                    firstMultipliers[ degree ] * u * legendreFunctionData[ degree - 1 ] -
+                    secondMultipliers[ degree ] * legendreFunctionData[ degree - 2 ];
+        }
+    }
+}
+
+//! Function to check whether Pines cache is sufficiently large for a given set of coefficients
+void checkPinesCacheSize( const int numberOfDegrees,
+                          const int numberOfOrders,
+                          PinesSphericalHarmonicsCache& pinesCache )
+{
+    if( numberOfDegrees - 1 > pinesCache.getMaximumDegree( ) ||
+            numberOfOrders - 1 > pinesCache.getMaximumOrder( ) )
+    {
+        throw std::runtime_error( "Error when computing Pines spherical harmonic acceleration, cache size (" +
+                                  std::to_string( pinesCache.getMaximumDegree( ) ) + ", " +
+                                  std::to_string( pinesCache.getMaximumOrder( ) ) +
+                                  ") is insufficient for coefficients up to (" +
+                                  std::to_string( numberOfDegrees - 1 ) + ", " +
+                                  std::to_string( numberOfOrders - 1 ) + ")" );
+    }
+}
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, using the Pines formulation.
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumPines(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::Ref< const Eigen::MatrixXd >& cosineHarmonicCoefficients,
+        const Eigen::Ref< const Eigen::MatrixXd >& sineHarmonicCoefficients,
+        PinesSphericalHarmonicsCache& pinesCache,
+        const Eigen::Matrix3d& accelerationRotation )
+{
+    // Set number of degrees and orders that are to be evaluated.
+    const int numberOfDegrees = static_cast< int >( cosineHarmonicCoefficients.rows( ) );
+    const int numberOfOrders = std::min(
+                static_cast< int >( cosineHarmonicCoefficients.cols( ) ), numberOfDegrees );
+    checkPinesCacheSize( numberOfDegrees, numberOfOrders, pinesCache );
+
+    pinesCache.update( positionOfBodySubjectToAcceleration, equatorialRadius );
+
+    const Eigen::MatrixXd& legendreFunctions = pinesCache.derivedLegendreFunctions_;
+    const Eigen::VectorXd& realTerms = pinesCache.realTerms_;
+    const Eigen::VectorXd& imaginaryTerms = pinesCache.imaginaryTerms_;
+    Eigen::VectorXd& scaledLegendreFunctions = pinesCache.workBuffers_[ 0 ];
+    Eigen::VectorXd& scaledLegendreDerivatives = pinesCache.workBuffers_[ 1 ];
+    Eigen::VectorXd& scaledRadialLegendreFunctions = pinesCache.workBuffers_[ 2 ];
+
+    // Compute acceleration components a1, a2, a3 (along x, y and z) and a4 (along unit position vector)
+    double firstComponent = 0.0;
+    double secondComponent = 0.0;
+    double thirdComponent = 0.0;
+    double fourthComponent = 0.0;
+    for( int order = 0; order < numberOfOrders; order++ )
+    {
+        const int numberOfTerms = numberOfDegrees - order;
+        const auto radiusRatioBlock = pinesCache.radiusRatioPowers_.segment( order, numberOfTerms );
+
+        // Compute A_nm, D_nm A_{n,m+1} and G_nm A_{n+1,m+1}, multiplied by radius ratio powers.
+        scaledLegendreFunctions.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    legendreFunctions.col( order ).segment( order, numberOfTerms ) );
+        scaledLegendreDerivatives.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    pinesCache.derivativeMultipliers_.col( order ).segment( order, numberOfTerms ).cwiseProduct(
+                        legendreFunctions.col( order + 1 ).segment( order, numberOfTerms ) ) );
+        scaledRadialLegendreFunctions.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    pinesCache.radialMultipliers_.col( order ).segment( order, numberOfTerms ).cwiseProduct(
+                        legendreFunctions.col( order + 1 ).segment( order + 1, numberOfTerms ) ) );
+
+        // Sum contributions of all degrees at current order (contiguous column of coefficient matrices)
+        const auto cosineCoefficientBlock = cosineHarmonicCoefficients.col( order ).segment( order, numberOfTerms );
+        const auto sineCoefficientBlock = sineHarmonicCoefficients.col( order ).segment( order, numberOfTerms );
+
+        const double derivativeCosineSum =
+                scaledLegendreDerivatives.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+        const double derivativeSineSum =
+                scaledLegendreDerivatives.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+        const double radialCosineSum =
+                scaledRadialLegendreFunctions.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+        const double radialSineSum =
+                scaledRadialLegendreFunctions.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+
+        thirdComponent += realTerms( order ) * derivativeCosineSum + imaginaryTerms( order ) * derivativeSineSum;
+        fourthComponent -= realTerms( order ) * radialCosineSum + imaginaryTerms( order ) * radialSineSum;
+
+        if( order > 0 )
+        {
+            const double legendreCosineSum =
+                    scaledLegendreFunctions.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+            const double legendreSineSum =
+                    scaledLegendreFunctions.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+            const double doubleOrder = static_cast< double >( order );
+
+            firstComponent += doubleOrder * (
+                        realTerms( order - 1 ) * legendreCosineSum + imaginaryTerms( order - 1 ) * legendreSineSum );
+            secondComponent += doubleOrder * (
+                        realTerms( order - 1 ) * legendreSineSum - imaginaryTerms( order - 1 ) * legendreCosineSum );
+        }
+    }
+
+    const double preMultiplier = gravitationalParameter / ( equatorialRadius * pinesCache.getCurrentRadius( ) );
+    const Eigen::Vector3d bodyFixedAcceleration = preMultiplier * (
+                Eigen::Vector3d( firstComponent, secondComponent, thirdComponent ) +
+                fourthComponent * pinesCache.getCurrentUnitPosition( ) );
+
+    return accelerationRotation * bodyFixedAcceleration;
+}
+
+//! Compute the partial derivative of a spherical harmonic acceleration w.r.t. position, using the Pines formulation.
+Eigen::Matrix3d computePartialDerivativeOfBodyFixedSphericalHarmonicAccelerationPines(
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        PinesSphericalHarmonicsCache& pinesCache )
+{
+    const int numberOfDegrees = static_cast< int >( cosineHarmonicCoefficients.rows( ) );
+    const int numberOfOrders = std::min(
+                static_cast< int >( cosineHarmonicCoefficients.cols( ) ), numberOfDegrees );
+    checkPinesCacheSize( numberOfDegrees, numberOfOrders, pinesCache );
+
+    const Eigen::MatrixXd& legendreFunctions = pinesCache.derivedLegendreFunctions_;
+    const Eigen::MatrixXd& derivativeMultipliers = pinesCache.derivativeMultipliers_;
+    const Eigen::MatrixXd& radialMultipliers = pinesCache.radialMultipliers_;
+    const Eigen::VectorXd& realTerms = pinesCache.realTerms_;
+    const Eigen::VectorXd& imaginaryTerms = pinesCache.imaginaryTerms_;
+
+    // Entry (k, 0..2) contains the derivative of acceleration component a_k w.r.t. s, t and u, and entry (k, 3) the
+    // derivative w.r.t. radius, multiplied by -r. Vector accelerationComponents contains a_k.
+    Eigen::Matrix< double, 4, 4 > componentDerivatives = Eigen::Matrix< double, 4, 4 >::Zero( );
+    Eigen::Vector4d accelerationComponents = Eigen::Vector4d::Zero( );
+
+    for( int order = 0; order < numberOfOrders; order++ )
+    {
+        const int numberOfTerms = numberOfDegrees - order;
+        const auto radiusRatioBlock = pinesCache.radiusRatioPowers_.segment( order, numberOfTerms );
+        const auto degreeBlock = pinesCache.degreePlusTwo_.segment( order, numberOfTerms );
+        const auto cosineCoefficientBlock = cosineHarmonicCoefficients.col( order ).segment( order, numberOfTerms );
+        const auto sineCoefficientBlock = sineHarmonicCoefficients.col( order ).segment( order, numberOfTerms );
+
+        // Compute (products of multipliers and) derived Legendre functions, multiplied by radius ratio powers:
+        // A_nm, D_nm A_{n,m+1}, D_nm D_{n,m+1} A_{n,m+2}, G_nm A_{n+1,m+1}, G_nm D_{n+1,m+1} A_{n+1,m+2}
+        Eigen::VectorXd& zerothDerivativeTerms = pinesCache.workBuffers_[ 0 ];
+        Eigen::VectorXd& firstDerivativeTerms = pinesCache.workBuffers_[ 1 ];
+        Eigen::VectorXd& secondDerivativeTerms = pinesCache.workBuffers_[ 2 ];
+        Eigen::VectorXd& radialTerms = pinesCache.workBuffers_[ 3 ];
+        Eigen::VectorXd& radialDerivativeTerms = pinesCache.workBuffers_[ 4 ];
+
+        zerothDerivativeTerms.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    legendreFunctions.col( order ).segment( order, numberOfTerms ) );
+        firstDerivativeTerms.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    derivativeMultipliers.col( order ).segment( order, numberOfTerms ).cwiseProduct(
+                        legendreFunctions.col( order + 1 ).segment( order, numberOfTerms ) ) );
+        secondDerivativeTerms.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    derivativeMultipliers.col( order ).segment( order, numberOfTerms ).cwiseProduct(
+                        derivativeMultipliers.col( order + 1 ).segment( order, numberOfTerms ) ).cwiseProduct(
+                        legendreFunctions.col( order + 2 ).segment( order, numberOfTerms ) ) );
+        radialTerms.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    radialMultipliers.col( order ).segment( order, numberOfTerms ).cwiseProduct(
+                        legendreFunctions.col( order + 1 ).segment( order + 1, numberOfTerms ) ) );
+        radialDerivativeTerms.segment( order, numberOfTerms ) = radiusRatioBlock.cwiseProduct(
+                    radialMultipliers.col( order ).segment( order, numberOfTerms ).cwiseProduct(
+                        derivativeMultipliers.col( order + 1 ).segment( order + 1, numberOfTerms ) ).cwiseProduct(
+                        legendreFunctions.col( order + 2 ).segment( order + 1, numberOfTerms ) ) );
+
+        // Sum contributions of all degrees at current order, with cosine and sine coefficients.
+        const double zerothCosineSum = zerothDerivativeTerms.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+        const double zerothSineSum = zerothDerivativeTerms.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+        const double firstCosineSum = firstDerivativeTerms.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+        const double firstSineSum = firstDerivativeTerms.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+        const double secondCosineSum = secondDerivativeTerms.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+        const double secondSineSum = secondDerivativeTerms.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+        const double radialCosineSum = radialTerms.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+        const double radialSineSum = radialTerms.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+        const double radialDerivativeCosineSum =
+                radialDerivativeTerms.segment( order, numberOfTerms ).dot( cosineCoefficientBlock );
+        const double radialDerivativeSineSum =
+                radialDerivativeTerms.segment( order, numberOfTerms ).dot( sineCoefficientBlock );
+
+        // Sum contributions of all degrees at current order, weighted by (n+2) for the radial derivatives.
+        const double zerothDegreeCosineSum = degreeBlock.cwiseProduct(
+                    zerothDerivativeTerms.segment( order, numberOfTerms ) ).dot( cosineCoefficientBlock );
+        const double zerothDegreeSineSum = degreeBlock.cwiseProduct(
+                    zerothDerivativeTerms.segment( order, numberOfTerms ) ).dot( sineCoefficientBlock );
+        const double firstDegreeCosineSum = degreeBlock.cwiseProduct(
+                    firstDerivativeTerms.segment( order, numberOfTerms ) ).dot( cosineCoefficientBlock );
+        const double firstDegreeSineSum = degreeBlock.cwiseProduct(
+                    firstDerivativeTerms.segment( order, numberOfTerms ) ).dot( sineCoefficientBlock );
+        const double radialDegreeCosineSum = degreeBlock.cwiseProduct(
+                    radialTerms.segment( order, numberOfTerms ) ).dot( cosineCoefficientBlock );
+        const double radialDegreeSineSum = degreeBlock.cwiseProduct(
+                    radialTerms.segment( order, numberOfTerms ) ).dot( sineCoefficientBlock );
+
+        const double doubleOrder = static_cast< double >( order );
+        const double realTerm = realTerms( order );
+        const double imaginaryTerm = imaginaryTerms( order );
+        const double previousRealTerm = ( order > 0 ) ? realTerms( order - 1 ) : 0.0;
+        const double previousImaginaryTerm = ( order > 0 ) ? imaginaryTerms( order - 1 ) : 0.0;
+        const double secondPreviousRealTerm = ( order > 1 ) ? realTerms( order - 2 ) : 0.0;
+        const double secondPreviousImaginaryTerm = ( order > 1 ) ? imaginaryTerms( order - 2 ) : 0.0;
+
+        // Add contributions to a3 and a4, and their derivatives
+        accelerationComponents( 2 ) += realTerm * firstCosineSum + imaginaryTerm * firstSineSum;
+        accelerationComponents( 3 ) -= realTerm * radialCosineSum + imaginaryTerm * radialSineSum;
+
+        componentDerivatives( 2, 2 ) += realTerm * secondCosineSum + imaginaryTerm * secondSineSum;
+        componentDerivatives( 2, 3 ) += realTerm * firstDegreeCosineSum + imaginaryTerm * firstDegreeSineSum;
+        componentDerivatives( 3, 2 ) -= realTerm * radialDerivativeCosineSum + imaginaryTerm * radialDerivativeSineSum;
+        componentDerivatives( 3, 3 ) -= realTerm * radialDegreeCosineSum + imaginaryTerm * radialDegreeSineSum;
+
+        if( order > 0 )
+        {
+            componentDerivatives( 2, 0 ) += doubleOrder * (
+                        previousRealTerm * firstCosineSum + previousImaginaryTerm * firstSineSum );
+            componentDerivatives( 2, 1 ) += doubleOrder * (
+                        previousRealTerm * firstSineSum - previousImaginaryTerm * firstCosineSum );
+            componentDerivatives( 3, 0 ) -= doubleOrder * (
+                        previousRealTerm * radialCosineSum + previousImaginaryTerm * radialSineSum );
+            componentDerivatives( 3, 1 ) -= doubleOrder * (
+                        previousRealTerm * radialSineSum - previousImaginaryTerm * radialCosineSum );
+
+            // Add contributions to a1 and a2, and their derivatives
+            accelerationComponents( 0 ) += doubleOrder * (
+                        previousRealTerm * zerothCosineSum + previousImaginaryTerm * zerothSineSum );
+            accelerationComponents( 1 ) += doubleOrder * (
+                        previousRealTerm * zerothSineSum - previousImaginaryTerm * zerothCosineSum );
+
+            componentDerivatives( 0, 2 ) += doubleOrder * (
+                        previousRealTerm * firstCosineSum + previousImaginaryTerm * firstSineSum );
+            componentDerivatives( 1, 2 ) += doubleOrder * (
+                        previousRealTerm * firstSineSum - previousImaginaryTerm * firstCosineSum );
+            componentDerivatives( 0, 3 ) += doubleOrder * (
+                        previousRealTerm * zerothDegreeCosineSum + previousImaginaryTerm * zerothDegreeSineSum );
+            componentDerivatives( 1, 3 ) += doubleOrder * (
+                        previousRealTerm * zerothDegreeSineSum - previousImaginaryTerm * zerothDegreeCosineSum );
+
+            if( order > 1 )
+            {
+                const double orderProduct = doubleOrder * ( doubleOrder - 1.0 );
+                const double firstSecondDerivative = orderProduct * (
+                            secondPreviousRealTerm * zerothCosineSum + secondPreviousImaginaryTerm * zerothSineSum );
+                const double mixedSecondDerivative = orderProduct * (
+                            secondPreviousRealTerm * zerothSineSum - secondPreviousImaginaryTerm * zerothCosineSum );
+                componentDerivatives( 0, 0 ) += firstSecondDerivative;
+                componentDerivatives( 0, 1 ) += mixedSecondDerivative;
+                componentDerivatives( 1, 0 ) += mixedSecondDerivative;
+                componentDerivatives( 1, 1 ) -= firstSecondDerivative;
+            }
+        }
+    }
+
+    // Scale components, and convert derivatives w.r.t. (r,s,t,u) to derivatives w.r.t. Cartesian position.
+    const double radius = pinesCache.getCurrentRadius( );
+    const Eigen::Vector3d unitPosition = pinesCache.getCurrentUnitPosition( );
+    const double preMultiplier = gravitationalParameter / ( equatorialRadius * radius );
+    accelerationComponents *= preMultiplier;
+    componentDerivatives *= preMultiplier;
+
+    Eigen::Matrix< double, 4, 3 > componentGradients;
+    for( int i = 0; i < 4; i++ )
+    {
+        const Eigen::Vector3d directionCosineDerivatives = componentDerivatives.block( i, 0, 1, 3 ).transpose( );
+        componentGradients.block( i, 0, 1, 3 ) = (
+                    ( directionCosineDerivatives - unitPosition * ( unitPosition.dot( directionCosineDerivatives ) +
+                                                                    componentDerivatives( i, 3 ) ) ) / radius ).transpose( );
+    }
+
+    return componentGradients.block( 0, 0, 3, 3 ) +
+            unitPosition * componentGradients.block( 3, 0, 1, 3 ) +
+            accelerationComponents( 3 ) / radius * (
+                Eigen::Matrix3d::Identity( ) - unitPosition * unitPosition.transpose( ) );
+}
+
+//! Compute the partials of a spherical harmonic acceleration w.r.t. a set of coefficients, using the Pines formulation.
+void computeSphericalHarmonicGravityWrtCoefficientsPines(
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        PinesSphericalHarmonicsCache& pinesCache,
+        const std::vector< std::pair< int, int > >& blockIndices,
+        const bool computeSinePartials,
+        const Eigen::Matrix3d& accelerationRotation,
+        Eigen::MatrixXd& partialsMatrix,
+        const int maximumAccelerationDegree,
+        const int maximumAccelerationOrder )
+{
+    partialsMatrix.setZero( 3, blockIndices.size( ) );
+
+    const double preMultiplier = gravitationalParameter / ( equatorialRadius * pinesCache.getCurrentRadius( ) );
+    const Eigen::Vector3d unitPosition = pinesCache.getCurrentUnitPosition( );
+    const Eigen::MatrixXd& legendreFunctions = pinesCache.derivedLegendreFunctions_;
+
+    for( unsigned int i = 0; i < blockIndices.size( ); i++ )
+    {
+        const int degree = blockIndices.at( i ).first;
+        const int order = blockIndices.at( i ).second;
+        if( degree > maximumAccelerationDegree || order > maximumAccelerationOrder )
+        {
+            continue;
+        }
+        else if( degree > pinesCache.getMaximumDegree( ) || order > pinesCache.getMaximumOrder( ) )
+        {
+            throw std::runtime_error( "Error when computing Pines spherical harmonic coefficient partials, cache size (" +
+                                      std::to_string( pinesCache.getMaximumDegree( ) ) + ", " +
+                                      std::to_string( pinesCache.getMaximumOrder( ) ) +
+                                      ") is insufficient for coefficient (" +
+                                      std::to_string( degree ) + ", " + std::to_string( order ) + ")" );
+        }
+
+        const double doubleOrder = static_cast< double >( order );
+        const double termMultiplier = preMultiplier * pinesCache.radiusRatioPowers_( degree );
+        const double legendreTerm = termMultiplier * legendreFunctions( degree, order );
+        const double derivativeTerm = termMultiplier * pinesCache.derivativeMultipliers_( degree, order ) *
+                legendreFunctions( degree, order + 1 );
+        const double radialTerm = -termMultiplier * pinesCache.radialMultipliers_( degree, order ) *
+                legendreFunctions( degree + 1, order + 1 );
+
+        const double realTerm = pinesCache.realTerms_( order );
+        const double imaginaryTerm = pinesCache.imaginaryTerms_( order );
+        const double previousRealTerm = ( order > 0 ) ? pinesCache.realTerms_( order - 1 ) : 0.0;
+        const double previousImaginaryTerm = ( order > 0 ) ? pinesCache.imaginaryTerms_( order - 1 ) : 0.0;
+
+        Eigen::Vector3d bodyFixedPartial;
+        if( !computeSinePartials )
+        {
+            bodyFixedPartial << doubleOrder * legendreTerm * previousRealTerm,
+                    -doubleOrder * legendreTerm * previousImaginaryTerm,
+                    derivativeTerm * realTerm;
+            bodyFixedPartial += radialTerm * realTerm * unitPosition;
+        }
+        else
+        {
+            bodyFixedPartial << doubleOrder * legendreTerm * previousImaginaryTerm,
+                    doubleOrder * legendreTerm * previousRealTerm,
+                    derivativeTerm * imaginaryTerm;
+            bodyFixedPartial += radialTerm * imaginaryTerm * unitPosition;
+        }
+        partialsMatrix.block( 0, i, 3, 1 ) = accelerationRotation * bodyFixedPartial;
+    }
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -9,7 +9,12 @@
  *
  */
 
+#include <algorithm>
+#include <functional>
+#include <map>
+
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/basics/parallelExecution.h"
 
 namespace tudat
 {
@@ -17,24 +22,252 @@ namespace tudat
 namespace gravitation
 {
 
+PolyhedronGravityCache::PolyhedronGravityCache(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const std::vector< Eigen::MatrixXd >& edgeDyads,
+        const unsigned int numberOfThreads ):
+    verticesCoordinates_( verticesCoordinates ),
+    verticesDefiningEachFacet_( verticesDefiningEachFacet ),
+    verticesDefiningEachEdge_( verticesDefiningEachEdge ),
+    numberOfThreads_( 1 ),
+    numberOfActiveThreads_( 1 ),
+    currentPotentialSum_( TUDAT_NAN ),
+    currentGradientSum_( Eigen::Vector3d::Constant( TUDAT_NAN ) ),
+    currentPerFacetFactorSum_( TUDAT_NAN )
+{
+    currentBodyFixedPosition_ = (Eigen::Vector3d() << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN).finished();
+
+    const unsigned int numberOfVertices = verticesCoordinates_.rows( );
+    const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows( );
+    const unsigned int numberOfEdges = verticesDefiningEachEdge_.rows( );
+
+    if( edgeDyads.size( ) != numberOfEdges )
+    {
+        throw std::runtime_error( "Error when creating polyhedron gravity cache: number of edge dyads (" +
+                                  std::to_string( edgeDyads.size( ) ) + ") is not consistent with number of edges (" +
+                                  std::to_string( numberOfEdges ) + ")." );
+    }
+
+    // Compute outward-pointing facet normals
+    facetNormals_.resize( numberOfFacets, 3 );
+    for( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        const Eigen::Vector3d vertex0 = verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 0 ), 0 );
+        const Eigen::Vector3d vertex1 = verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 1 ), 0 );
+        const Eigen::Vector3d vertex2 = verticesCoordinates_.block< 1, 3 >( verticesDefiningEachFacet_( facet, 2 ), 0 );
+
+        facetNormals_.row( facet ) = ( vertex1 - vertex0 ).cross( vertex2 - vertex1 ).normalized( ).transpose( );
+    }
+
+    // Store independent components of the (symmetric) edge dyads, and the edge lengths
+    edgeDyadComponents_.resize( numberOfEdges, 6 );
+    edgeLengths_.resize( numberOfEdges );
+    for( unsigned int edge = 0; edge < numberOfEdges; ++edge )
+    {
+        const Eigen::MatrixXd& edgeDyad = edgeDyads.at( edge );
+        edgeDyadComponents_( edge, 0 ) = edgeDyad( 0, 0 );
+        edgeDyadComponents_( edge, 1 ) = edgeDyad( 1, 1 );
+        edgeDyadComponents_( edge, 2 ) = edgeDyad( 2, 2 );
+        edgeDyadComponents_( edge, 3 ) = 0.5 * ( edgeDyad( 0, 1 ) + edgeDyad( 1, 0 ) );
+        edgeDyadComponents_( edge, 4 ) = 0.5 * ( edgeDyad( 0, 2 ) + edgeDyad( 2, 0 ) );
+        edgeDyadComponents_( edge, 5 ) = 0.5 * ( edgeDyad( 1, 2 ) + edgeDyad( 2, 1 ) );
+
+        edgeLengths_( edge ) = ( verticesCoordinates_.block< 1, 3 >( verticesDefiningEachEdge_( edge, 0 ), 0 ) -
+                                 verticesCoordinates_.block< 1, 3 >( verticesDefiningEachEdge_( edge, 1 ), 0 ) ).norm( );
+    }
+
+    // Allocate variables that are recomputed on each update
+    currentVerticesCoordinatesRelativeToFieldPoint_.resize( numberOfVertices, 3 );
+    currentVerticesDistanceToFieldPoint_.resize( numberOfVertices );
+    currentPerFacetFactor_.resize( numberOfFacets );
+    currentPerEdgeFactor_.resize( numberOfEdges );
+
+    setNumberOfThreads( numberOfThreads );
+}
+
 void PolyhedronGravityCache::update (const Eigen::Vector3d& currentBodyFixedPosition)
 {
     if ( currentBodyFixedPosition != currentBodyFixedPosition_ )
     {
         currentBodyFixedPosition_ = currentBodyFixedPosition;
 
-        // Compute coordinates of vertices with respect to field point
-        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
-                currentVerticesCoordinatesRelativeToFieldPoint_, currentBodyFixedPosition_, verticesCoordinates_);
+        // Compute coordinates of vertices with respect to field point, and their distance to the field point
+        for( int coordinate = 0; coordinate < 3; ++coordinate )
+        {
+            currentVerticesCoordinatesRelativeToFieldPoint_.col( coordinate ).array( ) =
+                    verticesCoordinates_.col( coordinate ).array( ) - currentBodyFixedPosition_( coordinate );
+        }
+        currentVerticesDistanceToFieldPoint_.array( ) = (
+                    currentVerticesCoordinatesRelativeToFieldPoint_.col( 0 ).array( ).square( ) +
+                    currentVerticesCoordinatesRelativeToFieldPoint_.col( 1 ).array( ).square( ) +
+                    currentVerticesCoordinatesRelativeToFieldPoint_.col( 2 ).array( ).square( ) ).sqrt( );
+
+        // Compute per-facet and per-edge factors, and associated sums, distributing facets and edges over threads
+        const long numberOfFacets = verticesDefiningEachFacet_.rows( );
+        const long numberOfEdges = verticesDefiningEachEdge_.rows( );
+        if( numberOfActiveThreads_ == 1 )
+        {
+            computeFactorsAndSums( 0, numberOfFacets, 0, numberOfEdges, threadPartialSums_.at( 0 ) );
+        }
+        else
+        {
+            // Evaluate one range of facets and edges per thread, each with its own partial sums
+            utilities::executeTasksInParallel(
+                        numberOfActiveThreads_, numberOfActiveThreads_,
+                        [ & ]( const unsigned int range, const unsigned int )
+            {
+                computeFactorsAndSums( numberOfFacets * range / numberOfActiveThreads_,
+                                       numberOfFacets * ( range + 1 ) / numberOfActiveThreads_,
+                                       numberOfEdges * range / numberOfActiveThreads_,
+                                       numberOfEdges * ( range + 1 ) / numberOfActiveThreads_,
+                                       threadPartialSums_.at( range ) );
+            } );
+        }
+
+        // Combine partial sums in fixed order
+        currentPotentialSum_ = 0.0;
+        currentGradientSum_.setZero( );
+        currentPerFacetFactorSum_ = 0.0;
+        for( unsigned int thread = 0; thread < numberOfActiveThreads_; ++thread )
+        {
+            currentPotentialSum_ += threadPartialSums_.at( thread ).potentialSum;
+            currentGradientSum_ += threadPartialSums_.at( thread ).gradientSum;
+            currentPerFacetFactorSum_ += threadPartialSums_.at( thread ).perFacetFactorSum;
+        }
+    }
+}
+
+void PolyhedronGravityCache::computeFactorsAndSums(
+        const int firstFacet, const int endFacet, const int firstEdge, const int endEdge,
+        PartialSums& partialSums )
+{
+    // Retrieve contiguous arrays with vertex, facet and edge properties
+    const double* relativeX = currentVerticesCoordinatesRelativeToFieldPoint_.col( 0 ).data( );
+    const double* relativeY = currentVerticesCoordinatesRelativeToFieldPoint_.col( 1 ).data( );
+    const double* relativeZ = currentVerticesCoordinatesRelativeToFieldPoint_.col( 2 ).data( );
+    const double* distance = currentVerticesDistanceToFieldPoint_.data( );
+
+    const int* facetVertexI = verticesDefiningEachFacet_.col( 0 ).data( );
+    const int* facetVertexJ = verticesDefiningEachFacet_.col( 1 ).data( );
+    const int* facetVertexK = verticesDefiningEachFacet_.col( 2 ).data( );
+    const double* normalX = facetNormals_.col( 0 ).data( );
+    const double* normalY = facetNormals_.col( 1 ).data( );
+    const double* normalZ = facetNormals_.col( 2 ).data( );
+    double* perFacetFactor = currentPerFacetFactor_.data( );
+
+    const int* edgeVertexI = verticesDefiningEachEdge_.col( 0 ).data( );
+    const int* edgeVertexJ = verticesDefiningEachEdge_.col( 1 ).data( );
+    const double* dyadXX = edgeDyadComponents_.col( 0 ).data( );
+    const double* dyadYY = edgeDyadComponents_.col( 1 ).data( );
+    const double* dyadZZ = edgeDyadComponents_.col( 2 ).data( );
+    const double* dyadXY = edgeDyadComponents_.col( 3 ).data( );
+    const double* dyadXZ = edgeDyadComponents_.col( 4 ).data( );
+    const double* dyadYZ = edgeDyadComponents_.col( 5 ).data( );
+    const double* edgeLength = edgeLengths_.data( );
+    double* perEdgeFactor = currentPerEdgeFactor_.data( );
+
+    // Loop over facets
+    double facetPotentialSum = 0.0, facetGradientX = 0.0, facetGradientY = 0.0, facetGradientZ = 0.0;
+    double perFacetFactorSum = 0.0;
+    for( int facet = firstFacet; facet < endFacet; ++facet )
+    {
+        const int i = facetVertexI[ facet ], j = facetVertexJ[ facet ], k = facetVertexK[ facet ];
+        const double xi = relativeX[ i ], yi = relativeY[ i ], zi = relativeZ[ i ];
+        const double xj = relativeX[ j ], yj = relativeY[ j ], zj = relativeZ[ j ];
+        const double xk = relativeX[ k ], yk = relativeY[ k ], zk = relativeZ[ k ];
+
+        // Compute per-facet factor (Eq. 27 of Werner and Scheeres, 1997)
+        const double numerator = xi * ( yj * zk - zj * yk ) + yi * ( zj * xk - xj * zk ) + zi * ( xj * yk - yj * xk );
+        const double denominator = distance[ i ] * distance[ j ] * distance[ k ] +
+                distance[ i ] * ( xj * xk + yj * yk + zj * zk ) +
+                distance[ j ] * ( xk * xi + yk * yi + zk * zi ) +
+                distance[ k ] * ( xi * xj + yi * yj + zi * zj );
+        const double factor = ( numerator == 0.0 ) ? 0.0 : 2.0 * std::atan2( numerator, denominator );
+        perFacetFactor[ facet ] = factor;
+
+        // Facet dyad times vector to facet plane, computed as n_f ( n_f . r_f )
+        const double normalDistance = normalX[ facet ] * xi + normalY[ facet ] * yi + normalZ[ facet ] * zi;
+        facetGradientX += normalX[ facet ] * normalDistance * factor;
+        facetGradientY += normalY[ facet ] * normalDistance * factor;
+        facetGradientZ += normalZ[ facet ] * normalDistance * factor;
+        facetPotentialSum += normalDistance * normalDistance * factor;
+        perFacetFactorSum += factor;
+    }
+
+    // Loop over edges
+    double edgePotentialSum = 0.0, edgeGradientX = 0.0, edgeGradientY = 0.0, edgeGradientZ = 0.0;
+    for( int edge = firstEdge; edge < endEdge; ++edge )
+    {
+        const int i = edgeVertexI[ edge ], j = edgeVertexJ[ edge ];
+
+        // Compute per-edge factor (Eq. 7 of Werner and Scheeres, 1997). Selection of the edge factor to be 0 at the
+        // edge singularity is only valid for the potential and its gradient (see calculatePolyhedronPerEdgeFactor)
+        const double distanceSum = distance[ i ] + distance[ j ];
+        const double denominator = distanceSum - edgeLength[ edge ];
+        const double factor = ( std::abs( denominator ) < 1.0E-18 ) ?
+                    0.0 : std::log( ( distanceSum + edgeLength[ edge ] ) / denominator );
+        perEdgeFactor[ edge ] = factor;
+
+        // Edge dyad times vector to edge
+        const double xi = relativeX[ i ], yi = relativeY[ i ], zi = relativeZ[ i ];
+        const double dyadTimesX = dyadXX[ edge ] * xi + dyadXY[ edge ] * yi + dyadXZ[ edge ] * zi;
+        const double dyadTimesY = dyadXY[ edge ] * xi + dyadYY[ edge ] * yi + dyadYZ[ edge ] * zi;
+        const double dyadTimesZ = dyadXZ[ edge ] * xi + dyadYZ[ edge ] * yi + dyadZZ[ edge ] * zi;
+        edgeGradientX += dyadTimesX * factor;
+        edgeGradientY += dyadTimesY * factor;
+        edgeGradientZ += dyadTimesZ * factor;
+        edgePotentialSum += ( xi * dyadTimesX + yi * dyadTimesY + zi * dyadTimesZ ) * factor;
+    }
+
+    partialSums.potentialSum = edgePotentialSum - facetPotentialSum;
+    partialSums.gradientSum << edgeGradientX - facetGradientX, edgeGradientY - facetGradientY,
+            edgeGradientZ - facetGradientZ;
+    partialSums.perFacetFactorSum = perFacetFactorSum;
+}
+
+Eigen::Matrix3d PolyhedronGravityCache::getHessianOfPotential( const double gravitationalConstantTimesDensity )
+{
+    // When computing the per edge factor, it is taken to be 0 at edges singularities (see function
+    // calculatePolyhedronPerEdgeFactor, and reference within). This is not valid when computing the hessian matrix!
+    if( ( currentPerEdgeFactor_.array( ) == 0.0 ).any( ) )
+    {
+        throw std::runtime_error( "Computation of hessian matrix has a singularity for points at edges." );
+    }
+
+    // Sum independent components of edge and facet terms
+    Eigen::Matrix< double, 1, 6 > hessianComponents =
+            currentPerEdgeFactor_.transpose( ) * edgeDyadComponents_;
+    const Eigen::Map< const Eigen::ArrayXd > perFacetFactor( currentPerFacetFactor_.data( ), currentPerFacetFactor_.size( ) );
+    hessianComponents( 0 ) -= ( facetNormals_.col( 0 ).array( ).square( ) * perFacetFactor ).sum( );
+    hessianComponents( 1 ) -= ( facetNormals_.col( 1 ).array( ).square( ) * perFacetFactor ).sum( );
+    hessianComponents( 2 ) -= ( facetNormals_.col( 2 ).array( ).square( ) * perFacetFactor ).sum( );
+    hessianComponents( 3 ) -= ( facetNormals_.col( 0 ).array( ) * facetNormals_.col( 1 ).array( ) * perFacetFactor ).sum( );
+    hessianComponents( 4 ) -= ( facetNormals_.col( 0 ).array( ) * facetNormals_.col( 2 ).array( ) * perFacetFactor ).sum( );
+    hessianComponents( 5 ) -= ( facetNormals_.col( 1 ).array( ) * facetNormals_.col( 2 ).array( ) * perFacetFactor ).sum( );
 
-        // Compute per-facet factor
-        basic_mathematics::calculatePolyhedronPerFacetFactor(
-                currentPerFacetFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachFacet_);
+    Eigen::Matrix3d hessian;
+    hessian << hessianComponents( 0 ), hessianComponents( 3 ), hessianComponents( 4 ),
+            hessianComponents( 3 ), hessianComponents( 1 ), hessianComponents( 5 ),
+            hessianComponents( 4 ), hessianComponents( 5 ), hessianComponents( 2 );
+    return gravitationalConstantTimesDensity * hessian;
+}
 
-        // Compute per-edge factor
-        basic_mathematics::calculatePolyhedronPerEdgeFactor(
-                currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachEdge_);
+void PolyhedronGravityCache::setNumberOfThreads( const unsigned int numberOfThreads )
+{
+    if( numberOfThreads == 0 )
+    {
+        throw std::runtime_error( "Error when setting number of threads for polyhedron gravity cache, at least one "
+                                  "thread is required." );
     }
+    numberOfThreads_ = numberOfThreads;
+
+    // Only use as many threads as can each be given a sufficiently large number of facets
+    numberOfActiveThreads_ = std::max( 1u, std::min(
+            numberOfThreads_, static_cast< unsigned int >(
+                verticesDefiningEachFacet_.rows( ) / MINIMUM_NUMBER_OF_FACETS_PER_THREAD ) ) );
+    threadPartialSums_.resize( numberOfActiveThreads_ );
 }
 
 void PolyhedronGravityField::computeVerticesAndFacetsDefiningEachEdge ( )
@@ -46,42 +279,37 @@ void PolyhedronGravityField::computeVerticesAndFacetsDefiningEachEdge ( )
     verticesDefiningEachEdge_ = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
     facetsDefiningEachEdge_ = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
 
+    // Map from (sorted) pair of vertices to index of edge, to identify edges that have already been inserted
+    std::map< std::pair< int, int >, unsigned int > edgeIndices;
+
     unsigned int numberOfInsertedEdges = 0;
     for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
     {
-        // Extract edges from face
-        std::vector< std::vector< int > > edgesToInsert;
-        const int vertex0 = verticesDefiningEachFacet_(facet,0);
-        const int vertex1 = verticesDefiningEachFacet_(facet,1);
-        const int vertex2 = verticesDefiningEachFacet_(facet,2);
-        edgesToInsert.push_back( { vertex0, vertex1 } );
-        edgesToInsert.push_back( { vertex1, vertex2 } );
-        edgesToInsert.push_back( { vertex2, vertex0 } );
-
-        // Check if all edges of the facet have been included in verticesDefiningEachEdge. If so, remove the edge from
-        // the edgesToInsert vector and add the facet to facetsDefiningEachEdge
-        for ( unsigned int edge = 0; edge < numberOfInsertedEdges && !edgesToInsert.empty(); ++edge )
+        for ( unsigned int facetEdge = 0; facetEdge < 3; ++facetEdge )
         {
-            // Loop over edges of current facet still to be inserted
-            for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
+            const int vertex0 = verticesDefiningEachFacet_( facet, facetEdge );
+            const int vertex1 = verticesDefiningEachFacet_( facet, ( facetEdge + 1 ) % 3 );
+            const std::pair< int, int > edgeKey = std::make_pair( std::min( vertex0, vertex1 ), std::max( vertex0, vertex1 ) );
+
+            // If edge has already been inserted, add the facet as second facet defining the edge. Otherwise, insert it.
+            std::map< std::pair< int, int >, unsigned int >::const_iterator edgeIterator = edgeIndices.find( edgeKey );
+            if ( edgeIterator != edgeIndices.end( ) )
+            {
+                facetsDefiningEachEdge_( edgeIterator->second, 1 ) = facet;
+            }
+            else
             {
-                if ( ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 0) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 1) ) ||
-                        ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 1) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 0) ) )
+                if ( numberOfInsertedEdges >= numberOfEdges )
                 {
-                    edgesToInsert.erase(edgesToInsert.begin() + i);
-                    facetsDefiningEachEdge_(edge, 1) = facet;
+                    throw std::runtime_error( "Extracted number of polyhedron edges not correct." );
                 }
+                verticesDefiningEachEdge_( numberOfInsertedEdges, 0 ) = vertex0;
+                verticesDefiningEachEdge_( numberOfInsertedEdges, 1 ) = vertex1;
+                facetsDefiningEachEdge_( numberOfInsertedEdges, 0 ) = facet;
+                edgeIndices[ edgeKey ] = numberOfInsertedEdges;
+                ++numberOfInsertedEdges;
             }
         }
-
-        // Check if any of the facet's edges still needs to be added to verticesDefiningEachEdge, and add it/them if so
-        for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
-        {
-            verticesDefiningEachEdge_(numberOfInsertedEdges,0) = edgesToInsert.at(i).at(0);
-            verticesDefiningEachEdge_(numberOfInsertedEdges,1) = edgesToInsert.at(i).at(1);
-            facetsDefiningEachEdge_(numberOfInsertedEdges, 0) = facet;
-            ++numberOfInsertedEdges;
-        }
     }
 
     // Sanity checks
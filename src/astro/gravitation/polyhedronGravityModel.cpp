@@ -31,41 +31,63 @@ void PolyhedronGravitationalAccelerationModel::updateMembers( const double curre
 
         currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * currentInertialRelativePosition_;
 
-        polyhedronCache_->update( currentRelativePosition_ );
+        const double gravitationalConstantTimesDensity = gravitationalParameterFunction_( ) / volumeFunction_( );
+        double exteriorGravityFieldScaling = TUDAT_NAN;
+
+        // Determine whether to use polyhedron and/or exterior spherical harmonic gravity field
+        currentPolyhedronWeight_ = 1.0;
+        if( exteriorGravityField_ != nullptr )
+        {
+            currentPolyhedronWeight_ = computeHybridGravityFieldPolyhedronWeight(
+                        currentRelativePosition_.norm( ), innerSwitchRadius_, outerSwitchRadius_ );
+            exteriorGravityFieldScaling = gravitationalParameterFunction_( ) /
+                    exteriorGravityField_->getGravitationalParameter( );
+        }
 
         // Compute the current acceleration
-        currentAccelerationInBodyFixedFrame_ = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
-                gravitationalParameterFunction_() / volumeFunction_(),
-                polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                getVerticesDefiningEachFacet_(),
-                getVerticesDefiningEachEdge_(),
-                getFacetDyads_(),
-                getEdgeDyads_(),
-                polyhedronCache_->getPerFacetFactor(),
-                polyhedronCache_->getPerEdgeFactor() );
+        currentAccelerationInBodyFixedFrame_.setZero( );
+        if( currentPolyhedronWeight_ > 0.0 )
+        {
+            polyhedronCache_->update( currentRelativePosition_ );
+            currentPolyhedronAccelerationInBodyFixedFrame_ = polyhedronCache_->getGradientOfPotential(
+                        gravitationalConstantTimesDensity );
+            currentAccelerationInBodyFixedFrame_ += currentPolyhedronWeight_ * currentPolyhedronAccelerationInBodyFixedFrame_;
+        }
+        if( currentPolyhedronWeight_ < 1.0 )
+        {
+            currentExteriorAccelerationInBodyFixedFrame_ = exteriorGravityFieldScaling *
+                    exteriorGravityField_->getGradientOfPotential( currentRelativePosition_ );
+            currentAccelerationInBodyFixedFrame_ +=
+                    ( 1.0 - currentPolyhedronWeight_ ) * currentExteriorAccelerationInBodyFixedFrame_;
+        }
 
         currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
 
         // Compute the current gravitational potential
         if ( updatePotential_ )
         {
-            currentPotential_ = basic_mathematics::calculatePolyhedronGravitationalPotential(
-                    gravitationalParameterFunction_( ) / volumeFunction_( ),
-                    polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                    getVerticesDefiningEachFacet_( ),
-                    getVerticesDefiningEachEdge_( ),
-                    getFacetDyads_( ),
-                    getEdgeDyads_( ),
-                    polyhedronCache_->getPerFacetFactor( ),
-                    polyhedronCache_->getPerEdgeFactor( ) );
+            currentPotential_ = 0.0;
+            if( currentPolyhedronWeight_ > 0.0 )
+            {
+                currentPotential_ += currentPolyhedronWeight_ *
+                        polyhedronCache_->getGravitationalPotential( gravitationalConstantTimesDensity );
+            }
+            if( currentPolyhedronWeight_ < 1.0 )
+            {
+                currentPotential_ += ( 1.0 - currentPolyhedronWeight_ ) * exteriorGravityFieldScaling *
+                        exteriorGravityField_->getGravitationalPotential( currentRelativePosition_ );
+            }
         }
 
-        // Compute the current laplacian
+        // Compute the current laplacian (which is zero for the exterior spherical harmonic gravity field)
         if ( updateLaplacianOfPotential_ )
         {
-            currentLaplacianOfPotential_ = basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
-                    gravitationalParameterFunction_( ) / volumeFunction_( ),
-                    polyhedronCache_->getPerFacetFactor( ) );
+            currentLaplacianOfPotential_ = 0.0;
+            if( currentPolyhedronWeight_ > 0.0 )
+            {
+                currentLaplacianOfPotential_ = currentPolyhedronWeight_ *
+                        polyhedronCache_->getLaplacianOfPotential( gravitationalConstantTimesDensity );
+            }
         }
     }
 }
@@ -34,6 +34,49 @@ namespace tudat
 namespace gravitation
 {
 
+//! Function to compute the degree amplitude spectrum of a spherical harmonic gravity field.
+Eigen::VectorXd computeDegreeAmplitudeSpectrum(
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients )
+{
+    return ( cosineHarmonicCoefficients.rowwise( ).squaredNorm( ) +
+             sineHarmonicCoefficients.rowwise( ).squaredNorm( ) ).cwiseSqrt( );
+}
+
+//! Function to compute the degree to which a spherical harmonic expansion can be truncated at a given distance.
+int computeAdaptiveTruncationDegree(
+        const Eigen::VectorXd& degreeAmplitudes,
+        const double radiusRatio,
+        const double tolerance,
+        Eigen::VectorXd& degreeContributions )
+{
+    const int numberOfDegrees = static_cast< int >( degreeAmplitudes.rows( ) );
+    if( degreeContributions.rows( ) != numberOfDegrees )
+    {
+        degreeContributions.resize( numberOfDegrees );
+    }
+
+    // Compute estimated relative acceleration per degree (powers computed in ascending order to prevent underflow)
+    double currentRatioPower = 1.0;
+    for( int degree = 0; degree < numberOfDegrees; degree++ )
+    {
+        degreeContributions( degree ) = static_cast< double >( degree + 1 ) * currentRatioPower * degreeAmplitudes( degree );
+        currentRatioPower *= radiusRatio;
+    }
+
+    // Find lowest degree for which sum of truncated contributions is below tolerance
+    double truncatedContribution = 0.0;
+    for( int degree = numberOfDegrees - 1; degree > 0; degree-- )
+    {
+        truncatedContribution += degreeContributions( degree );
+        if( truncatedContribution > tolerance )
+        {
+            return degree;
+        }
+    }
+    return 0;
+}
+
 } // namespace gravitation
 
 } // namespace tudat
@@ -0,0 +1,294 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Holmes, S.A., Featherstone, W.E. A unified approach to the Clenshaw summation and the
+ *        recursive computation of very high degree and order normalised associated Legendre
+ *        functions. Journal of Geodesy, 76(5):279-299, 2002.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/gravitation/vectorizedSphericalHarmonicsGravity.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to compute the multipliers of the geodesy-normalized fixed-order Legendre recursions.
+void computeGeodesyNormalizedColumnRecursionMultipliers(
+        const int maximumDegree,
+        const int numberOfOrderColumns,
+        Eigen::MatrixXd& firstColumnMultipliers,
+        Eigen::MatrixXd& secondColumnMultipliers,
+        Eigen::MatrixXd& derivativeMultipliers,
+        Eigen::VectorXd& sectoralMultipliers )
+{
+    firstColumnMultipliers.setZero( maximumDegree + 1, numberOfOrderColumns );
+    secondColumnMultipliers.setZero( maximumDegree + 1, numberOfOrderColumns );
+    derivativeMultipliers.setZero( maximumDegree + 1, numberOfOrderColumns );
+    sectoralMultipliers.setZero( numberOfOrderColumns );
+
+    for( int order = 0; order < numberOfOrderColumns; order++ )
+    {
+        const double doubleOrder = static_cast< double >( order );
+        for( int degree = order; degree <= maximumDegree; degree++ )
+        {
+            const double doubleDegree = static_cast< double >( degree );
+
+            // Compute multipliers of geodesy-normalized fixed-order recursion
+            if( degree > order )
+            {
+                firstColumnMultipliers( degree, order ) = std::sqrt(
+                            ( 2.0 * doubleDegree + 1.0 ) * ( 2.0 * doubleDegree - 1.0 ) /
+                            ( ( doubleDegree + doubleOrder ) * ( doubleDegree - doubleOrder ) ) );
+            }
+            if( degree > order + 1 )
+            {
+                secondColumnMultipliers( degree, order ) = std::sqrt(
+                            ( 2.0 * doubleDegree + 1.0 ) * ( doubleDegree + doubleOrder - 1.0 ) *
+                            ( doubleDegree - doubleOrder - 1.0 ) /
+                            ( ( doubleDegree + doubleOrder ) * ( doubleDegree - doubleOrder ) *
+                              ( 2.0 * doubleDegree - 3.0 ) ) );
+            }
+
+            // Compute multipliers for latitude derivative
+            derivativeMultipliers( degree, order ) = std::sqrt(
+                        ( doubleDegree + doubleOrder + 1.0 ) * ( doubleDegree - doubleOrder ) );
+            if( order == 0 )
+            {
+                derivativeMultipliers( degree, order ) *= std::sqrt( 0.5 );
+            }
+        }
+
+        // Compute multipliers of geodesy-normalized sectoral recursion
+        if( order == 1 )
+        {
+            sectoralMultipliers( order ) = std::sqrt( 3.0 );
+        }
+        else if( order > 1 )
+        {
+            sectoralMultipliers( order ) = std::sqrt( ( 2.0 * doubleOrder + 1.0 ) / ( 2.0 * doubleOrder ) );
+        }
+    }
+}
+
+//! Update maximum degree and order of cache, and recompute all recursion multipliers.
+void ColumnWiseSphericalHarmonicsCache::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    maximumDegree_ = maximumDegree;
+    maximumOrder_ = std::min( maximumOrder, maximumDegree );
+
+    // One additional order is needed, since the derivative of P_{n,m} requires P_{n,m+1}
+    const int numberOfOrderColumns = maximumOrder_ + 2;
+
+    computeGeodesyNormalizedColumnRecursionMultipliers(
+                maximumDegree_, numberOfOrderColumns, firstColumnMultipliers_, secondColumnMultipliers_,
+                derivativeMultipliers_, sectoralMultipliers_ );
+
+    degreePlusOne_ = Eigen::VectorXd::LinSpaced( maximumDegree_ + 1, 1.0, static_cast< double >( maximumDegree_ + 1 ) );
+    radiusRatioPowers_.setZero( maximumDegree_ + 1 );
+    cosinesOfLongitude_.setZero( numberOfOrderColumns );
+    sinesOfLongitude_.setZero( numberOfOrderColumns );
+
+    currentOrderLegendreFunctions_.setZero( maximumDegree_ + 1 );
+    nextOrderLegendreFunctions_.setZero( maximumDegree_ + 1 );
+    scaledLegendreFunctions_.setZero( maximumDegree_ + 1 );
+    scaledLegendreDerivatives_.setZero( maximumDegree_ + 1 );
+}
+
+//! Update the trigonometric functions of multiples of the longitude and the powers of the radius ratio.
+void ColumnWiseSphericalHarmonicsCache::update( const double radiusRatio,
+                                                const double cosineOfLongitude,
+                                                const double sineOfLongitude )
+{
+    double currentRatioPower = radiusRatio;
+    for( int i = 0; i <= maximumDegree_; i++ )
+    {
+        radiusRatioPowers_( i ) = currentRatioPower;
+        currentRatioPower *= radiusRatio;
+    }
+
+    cosinesOfLongitude_( 0 ) = 1.0;
+    sinesOfLongitude_( 0 ) = 0.0;
+    for( int i = 1; i < cosinesOfLongitude_.rows( ); i++ )
+    {
+        cosinesOfLongitude_( i ) = cosinesOfLongitude_( i - 1 ) * cosineOfLongitude -
+                sinesOfLongitude_( i - 1 ) * sineOfLongitude;
+        sinesOfLongitude_( i ) = sinesOfLongitude_( i - 1 ) * cosineOfLongitude +
+                cosinesOfLongitude_( i - 1 ) * sineOfLongitude;
+    }
+}
+
+//! Function to compute the geodesy-normalized Legendre functions of all degrees at a single order
+void computeSingleOrderLegendreFunctions(
+        const int order,
+        const int numberOfDegrees,
+        const double sectoralLegendreFunction,
+        const double sineOfLatitude,
+        const ColumnWiseSphericalHarmonicsCache& columnWiseCache,
+        Eigen::VectorXd& legendreFunctions )
+{
+    const double* firstMultipliers = columnWiseCache.firstColumnMultipliers_.col( order ).data( );
+    const double* secondMultipliers = columnWiseCache.secondColumnMultipliers_.col( order ).data( );
+    double* legendreFunctionData = legendreFunctions.data( );
+
+    legendreFunctionData[ order ] = sectoralLegendreFunction;
+    if( order + 1 < numberOfDegrees )
+    {
+        legendreFunctionData[ order + 1 ] = firstMultipliers[ order + 1 ] * sineOfLatitude * sectoralLegendreFunction;
+    }
+    for( int degree = order + 2; degree < numberOfDegrees; degree++ )
+    {
+        legendreFunctionData[ degree ] =
+                firstMultipliers[ degree ] * sineOfLatitude * legendreFunctionData[ degree - 1 ] -
+                secondMultipliers[ degree ] * legendreFunctionData[ degree - 2 ];
+    }
+}
+
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, using a column-wise evaluation.
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSumColumnWise(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::Ref< const Eigen::MatrixXd >& cosineHarmonicCoefficients,
+        const Eigen::Ref< const Eigen::MatrixXd >& sineHarmonicCoefficients,
+        ColumnWiseSphericalHarmonicsCache& columnWiseCache,
+        const Eigen::Matrix3d& accelerationRotation )
+{
+    // Set number of degrees and orders that are to be evaluated.
+    const int numberOfDegrees = static_cast< int >( cosineHarmonicCoefficients.rows( ) );
+    const int numberOfOrders = std::min(
+                static_cast< int >( cosineHarmonicCoefficients.cols( ) ), numberOfDegrees );
+
+    if( numberOfDegrees - 1 > columnWiseCache.getMaximumDegree( ) ||
+            numberOfOrders - 1 > columnWiseCache.getMaximumOrder( ) )
+    {
+        throw std::runtime_error( "Error when computing column-wise spherical harmonic acceleration, cache size (" +
+                                  std::to_string( columnWiseCache.getMaximumDegree( ) ) + ", " +
+                                  std::to_string( columnWiseCache.getMaximumOrder( ) ) +
+                                  ") is insufficient for coefficients up to (" +
+                                  std::to_string( numberOfDegrees - 1 ) + ", " +
+                                  std::to_string( numberOfOrders - 1 ) + ")" );
+    }
+
+    // Compute trigonometric functions of latitude and longitude directly from Cartesian position
+    const double xyDistanceSquared =
+            positionOfBodySubjectToAcceleration.x( ) * positionOfBodySubjectToAcceleration.x( ) +
+            positionOfBodySubjectToAcceleration.y( ) * positionOfBodySubjectToAcceleration.y( );
+    const double xyDistance = std::sqrt( xyDistanceSquared );
+    const double radius = std::sqrt(
+                xyDistanceSquared + positionOfBodySubjectToAcceleration.z( ) * positionOfBodySubjectToAcceleration.z( ) );
+
+    if( !( xyDistance > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when computing column-wise spherical harmonic acceleration, position is on the polar axis, where a singularity occurs" );
+    }
+
+    const double sineOfLatitude = positionOfBodySubjectToAcceleration.z( ) / radius;
+    const double cosineOfLatitude = xyDistance / radius;
+    const double tangentOfLatitude = sineOfLatitude / cosineOfLatitude;
+    const double cosineOfLongitude = positionOfBodySubjectToAcceleration.x( ) / xyDistance;
+    const double sineOfLongitude = positionOfBodySubjectToAcceleration.y( ) / xyDistance;
+
+    columnWiseCache.update( equatorialRadius / radius, cosineOfLongitude, sineOfLongitude );
+
+    Eigen::VectorXd& currentOrderLegendreFunctions = columnWiseCache.currentOrderLegendreFunctions_;
+    Eigen::VectorXd& nextOrderLegendreFunctions = columnWiseCache.nextOrderLegendreFunctions_;
+    Eigen::VectorXd& scaledLegendreFunctions = columnWiseCache.scaledLegendreFunctions_;
+    Eigen::VectorXd& scaledLegendreDerivatives = columnWiseCache.scaledLegendreDerivatives_;
+
+    // Compute zonal Legendre functions
+    double currentSectoralFunction = 1.0;
+    double nextSectoralFunction = 0.0;
+    computeSingleOrderLegendreFunctions(
+                0, numberOfDegrees, currentSectoralFunction, sineOfLatitude, columnWiseCache,
+                currentOrderLegendreFunctions );
+
+    double radialGradient = 0.0;
+    double latitudeGradient = 0.0;
+    double longitudeGradient = 0.0;
+    for( int order = 0; order < numberOfOrders; order++ )
+    {
+        const int numberOfTerms = numberOfDegrees - order;
+
+        // Compute Legendre functions at next order (required for derivative at current order)
+        if( order + 1 < numberOfDegrees )
+        {
+            nextSectoralFunction = columnWiseCache.sectoralMultipliers_( order + 1 ) *
+                    cosineOfLatitude * currentSectoralFunction;
+            computeSingleOrderLegendreFunctions(
+                        order + 1, numberOfDegrees, nextSectoralFunction, sineOfLatitude, columnWiseCache,
+                        nextOrderLegendreFunctions );
+        }
+        nextOrderLegendreFunctions( order ) = 0.0;
+
+        // Compute Legendre functions and latitude derivatives, multiplied by radius ratio powers.
+        scaledLegendreFunctions.segment( order, numberOfTerms ) =
+                columnWiseCache.radiusRatioPowers_.segment( order, numberOfTerms ).cwiseProduct(
+                    currentOrderLegendreFunctions.segment( order, numberOfTerms ) );
+        scaledLegendreDerivatives.segment( order, numberOfTerms ) =
+                columnWiseCache.radiusRatioPowers_.segment( order, numberOfTerms ).cwiseProduct(
+                    columnWiseCache.derivativeMultipliers_.col( order ).segment( order, numberOfTerms ).cwiseProduct(
+                        nextOrderLegendreFunctions.segment( order, numberOfTerms ) ) -
+                    ( static_cast< double >( order ) * tangentOfLatitude ) *
+                    currentOrderLegendreFunctions.segment( order, numberOfTerms ) );
+
+        // Sum contributions of all degrees at current order (contiguous column of coefficient matrices)
+        const auto cosineCoefficientBlock = cosineHarmonicCoefficients.col( order ).segment( order, numberOfTerms );
+        const auto sineCoefficientBlock = sineHarmonicCoefficients.col( order ).segment( order, numberOfTerms );
+        const auto legendreBlock = scaledLegendreFunctions.segment( order, numberOfTerms );
+        const auto legendreDerivativeBlock = scaledLegendreDerivatives.segment( order, numberOfTerms );
+        const auto degreeBlock = columnWiseCache.degreePlusOne_.segment( order, numberOfTerms );
+
+        const double legendreCosineSum = legendreBlock.dot( cosineCoefficientBlock );
+        const double legendreSineSum = legendreBlock.dot( sineCoefficientBlock );
+        const double radialCosineSum = degreeBlock.cwiseProduct( legendreBlock ).dot( cosineCoefficientBlock );
+        const double radialSineSum = degreeBlock.cwiseProduct( legendreBlock ).dot( sineCoefficientBlock );
+        const double derivativeCosineSum = legendreDerivativeBlock.dot( cosineCoefficientBlock );
+        const double derivativeSineSum = legendreDerivativeBlock.dot( sineCoefficientBlock );
+
+        const double cosineOfOrderLongitude = columnWiseCache.cosinesOfLongitude_( order );
+        const double sineOfOrderLongitude = columnWiseCache.sinesOfLongitude_( order );
+
+        radialGradient -= cosineOfOrderLongitude * radialCosineSum + sineOfOrderLongitude * radialSineSum;
+        latitudeGradient += cosineOfOrderLongitude * derivativeCosineSum + sineOfOrderLongitude * derivativeSineSum;
+        longitudeGradient += static_cast< double >( order ) * (
+                    cosineOfOrderLongitude * legendreSineSum - sineOfOrderLongitude * legendreCosineSum );
+
+        currentOrderLegendreFunctions.swap( nextOrderLegendreFunctions );
+        currentSectoralFunction = nextSectoralFunction;
+    }
+
+    // Scale gradient, and convert from spherical gradient to Cartesian gradient.
+    const double preMultiplier = gravitationalParameter / equatorialRadius;
+    radialGradient *= preMultiplier / radius;
+    latitudeGradient *= preMultiplier / radius;
+    longitudeGradient *= preMultiplier / xyDistance;
+
+    const Eigen::Vector3d bodyFixedAcceleration =
+            ( Eigen::Vector3d( ) <<
+              ( radialGradient * cosineOfLatitude - latitudeGradient * sineOfLatitude ) * cosineOfLongitude -
+              longitudeGradient * sineOfLongitude,
+              ( radialGradient * cosineOfLatitude - latitudeGradient * sineOfLatitude ) * sineOfLongitude +
+              longitudeGradient * cosineOfLongitude,
+              radialGradient * sineOfLatitude + latitudeGradient * cosineOfLatitude ).finished( );
+
+    return accelerationRotation * bodyFixedAcceleration;
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -9,7 +9,6 @@
  */
 
 #include "tudat/astro/orbit_determination/acceleration_partials/polyhedronAccelerationPartial.h"
-#include "tudat/math/basic/polyhedron.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/centralGravityAccelerationPartial.h"
 
 namespace tudat
@@ -27,8 +26,7 @@ PolyhedronGravityPartial::PolyhedronGravityPartial (
     gravitationalParameterFunction_( accelerationModel->getGravitationalParameterFunction( ) ),
     volumeFunction_( accelerationModel->getVolumeFunction( ) ),
     polyhedronCache_( accelerationModel->getPolyhedronCache() ),
-    facetDyads_( accelerationModel->getFacetDyadsFunction( )( ) ),
-    edgeDyads_( accelerationModel->getEdgeDyadsFunction( )( ) ),
+    accelerationModel_( accelerationModel ),
     positionFunctionOfAcceleratedBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
                                                    getCurrentPositionOfBodySubjectToAcceleration, accelerationModel ) ),
     positionFunctionOfAcceleratingBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
@@ -41,7 +39,17 @@ PolyhedronGravityPartial::PolyhedronGravityPartial (
                                 accelerationModel, std::placeholders::_1 ) ),
     rotationMatrixPartials_( rotationMatrixPartials )
 {
-
+    // Create cache for partials of exterior spherical harmonic gravity field
+    if( accelerationModel->getExteriorGravityField( ) != nullptr )
+    {
+        std::shared_ptr< gravitation::SphericalHarmonicsGravityField > exteriorGravityField =
+                accelerationModel->getExteriorGravityField( );
+        const int maximumDegree = static_cast< int >( exteriorGravityField->getDegreeOfExpansion( ) );
+        const int maximumOrder = static_cast< int >( exteriorGravityField->getOrderOfExpansion( ) );
+        exteriorSphericalHarmonicsCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+        exteriorSphericalHarmonicsCache_->getLegendreCache( )->setComputeSecondDerivatives( 1 );
+        exteriorSphericalHarmonicsCache_->resetMaximumDegreeAndOrder( maximumDegree, maximumOrder + 2 );
+    }
 }
 
 void PolyhedronGravityPartial::update( const double currentTime )
@@ -57,11 +65,37 @@ void PolyhedronGravityPartial::update( const double currentTime )
         Eigen::Matrix3d currentRotationToBodyFixedFrame_ = fromBodyFixedToIntegrationFrameRotation_( ).inverse( );
 
         // Calculate partial of acceleration wrt position of body undergoing acceleration.
-        currentBodyFixedPartialWrtPosition_ = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
-                gravitationalParameterFunction_() / volumeFunction_(),
-                facetDyads_, edgeDyads_,
-                polyhedronCache_->getPerFacetFactor(),
-                polyhedronCache_->getPerEdgeFactor() );
+        const double polyhedronWeight = accelerationModel_->getCurrentPolyhedronWeight( );
+        if( polyhedronWeight == 1.0 )
+        {
+            currentBodyFixedPartialWrtPosition_ = polyhedronCache_->getHessianOfPotential(
+                    gravitationalParameterFunction_() / volumeFunction_() );
+        }
+        else
+        {
+            // Combine partials of polyhedron and exterior spherical harmonic gravity field, including the partial of
+            // the polyhedron weight
+            std::shared_ptr< gravitation::SphericalHarmonicsGravityField > exteriorGravityField =
+                    accelerationModel_->getExteriorGravityField( );
+            const Eigen::Vector3d bodyFixedPosition = accelerationModel_->getCurrentRelativePosition( );
+            const double radius = bodyFixedPosition.norm( );
+
+            currentBodyFixedPartialWrtPosition_ = ( 1.0 - polyhedronWeight ) * computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                        bodyFixedPosition, exteriorGravityField->getReferenceRadius( ), gravitationalParameterFunction_( ),
+                        exteriorGravityField->getCosineCoefficients( ), exteriorGravityField->getSineCoefficients( ),
+                        exteriorSphericalHarmonicsCache_ );
+            if( polyhedronWeight > 0.0 )
+            {
+                currentBodyFixedPartialWrtPosition_ += polyhedronWeight * polyhedronCache_->getHessianOfPotential(
+                            gravitationalParameterFunction_() / volumeFunction_() );
+                currentBodyFixedPartialWrtPosition_ +=
+                        ( accelerationModel_->getCurrentPolyhedronAccelerationInBodyFixedFrame( ) -
+                          accelerationModel_->getCurrentExteriorAccelerationInBodyFixedFrame( ) ) *
+                        gravitation::computeHybridGravityFieldPolyhedronWeightDerivative(
+                            radius, accelerationModel_->getInnerSwitchRadius( ),
+                            accelerationModel_->getOuterSwitchRadius( ) ) * bodyFixedPosition.transpose( ) / radius;
+            }
+        }
 
         currentPartialWrtVelocity_.setZero( );
         currentPartialWrtPosition_.setZero( );
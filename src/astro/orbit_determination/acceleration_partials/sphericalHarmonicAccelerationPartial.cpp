@@ -36,6 +36,8 @@ SphericalHarmonicsGravityPartial::SphericalHarmonicsGravityPartial(
     cosineCoefficients_( accelerationModel->getCosineHarmonicCoefficientsFunction( ) ),
     sineCoefficients_( accelerationModel->getSineHarmonicCoefficientsFunction( ) ),
     sphericalHarmonicCache_( accelerationModel->getSphericalHarmonicsCache( ) ),
+    pinesCacheFunction_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::getPinesCache,
+                                    accelerationModel ) ),
     positionFunctionOfAcceleratedBody_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::
                                                    getCurrentPositionOfBodySubjectToAcceleration, accelerationModel ) ),
     positionFunctionOfAcceleratingBody_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::
@@ -46,6 +48,10 @@ SphericalHarmonicsGravityPartial::SphericalHarmonicsGravityPartial(
                                       accelerationModel ) ),
     updateFunction_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::updateMembers,
                                 accelerationModel, std::placeholders::_1 ) ),
+    currentTruncationDegreeFunction_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::
+                                                 getCurrentTruncationDegree, accelerationModel ) ),
+    currentTruncationOrderFunction_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::
+                                                getCurrentTruncationOrder, accelerationModel ) ),
     rotationMatrixPartials_( rotationMatrixPartials ),
     tidalLoveNumberPartialInterfaces_( tidalLoveNumberPartialInterfaces ),
     accelerationUsesMutualAttraction_( accelerationModel->getIsMutualAttractionUsed( ) )
@@ -56,6 +62,8 @@ SphericalHarmonicsGravityPartial::SphericalHarmonicsGravityPartial(
 
     maximumDegree_ = cosineCoefficients_( ).rows( ) - 1;
     maximumOrder_ = sineCoefficients_( ).cols( ) - 1;
+    currentMaximumDegree_ = maximumDegree_;
+    currentMaximumOrder_ = maximumOrder_;
 
     if( sphericalHarmonicCache_->getMaximumDegree( ) < maximumDegree_ ||
             sphericalHarmonicCache_->getMaximumOrder( ) < maximumOrder_ + 2 )
@@ -333,15 +341,49 @@ void SphericalHarmonicsGravityPartial::update( const double currentTime )
         currentCosineCoefficients_ = cosineCoefficients_( );
         currentSineCoefficients_ = sineCoefficients_( );
 
-        // Update trogonometric functions of multiples of longitude.
-        sphericalHarmonicCache_->update(
-                    bodyFixedSphericalPosition_( 0 ), std::sin( bodyFixedSphericalPosition_( 1 ) ),
-                    bodyFixedSphericalPosition_( 2 ), bodyReferenceRadius_( ) );
+        // Use same (altitude-adaptive) truncation of the expansion as the acceleration model
+        currentMaximumDegree_ = maximumDegree_;
+        currentMaximumOrder_ = maximumOrder_;
+        const int truncationDegree = currentTruncationDegreeFunction_( );
+        if( truncationDegree >= 0 && truncationDegree < maximumDegree_ )
+        {
+            currentMaximumDegree_ = truncationDegree;
+            currentMaximumOrder_ = std::min( maximumOrder_, currentTruncationOrderFunction_( ) );
+            currentCosineCoefficients_ = currentCosineCoefficients_.topLeftCorner(
+                        currentMaximumDegree_ + 1, currentMaximumOrder_ + 1 ).eval( );
+            currentSineCoefficients_ = currentSineCoefficients_.topLeftCorner(
+                        currentMaximumDegree_ + 1, currentMaximumOrder_ + 1 ).eval( );
+        }
 
-        // Calculate partial of acceleration wrt position of body undergoing acceleration.
-        currentBodyFixedPartialWrtPosition_ = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
-                    bodyFixedPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                    currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_ );
+        // Retrieve Pines cache from acceleration model, as evaluation algorithm (and cache) may have been changed
+        pinesCache_ = pinesCacheFunction_( );
+        if( pinesCache_ != nullptr )
+        {
+            if( pinesCache_->getMaximumDegree( ) < maximumDegree_ || pinesCache_->getMaximumOrder( ) < maximumOrder_ )
+            {
+                pinesCache_->resetMaximumDegreeAndOrder( maximumDegree_, maximumOrder_ );
+            }
+
+            // Update Pines cache (no-op if already updated by acceleration model), and calculate partial of acceleration
+            // wrt position of body undergoing acceleration.
+            pinesCache_->update( bodyFixedPosition_, bodyReferenceRadius_( ) );
+            currentBodyFixedPartialWrtPosition_ =
+                    gravitation::computePartialDerivativeOfBodyFixedSphericalHarmonicAccelerationPines(
+                        gravitationalParameterFunction_( ), bodyReferenceRadius_( ),
+                        currentCosineCoefficients_, currentSineCoefficients_, *pinesCache_ );
+        }
+        else
+        {
+            // Update trogonometric functions of multiples of longitude.
+            sphericalHarmonicCache_->update(
+                        bodyFixedSphericalPosition_( 0 ), std::sin( bodyFixedSphericalPosition_( 1 ) ),
+                        bodyFixedSphericalPosition_( 2 ), bodyReferenceRadius_( ) );
+
+            // Calculate partial of acceleration wrt position of body undergoing acceleration.
+            currentBodyFixedPartialWrtPosition_ = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                        bodyFixedPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
+                        currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_ );
+        }
 
         currentPartialWrtVelocity_.setZero( );
         currentPartialWrtPosition_.setZero( );
@@ -407,12 +449,22 @@ void SphericalHarmonicsGravityPartial::wrtCosineCoefficientBlock(
         const std::vector< std::pair< int, int > >& blockIndices,
         Eigen::MatrixXd& partialDerivatives )
 {
-    calculateSphericalHarmonicGravityWrtCCoefficients(
-                bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                sphericalHarmonicCache_,
-                blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                    bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
-                maximumDegree_, maximumOrder_ );
+    if( pinesCache_ != nullptr )
+    {
+        gravitation::computeSphericalHarmonicGravityWrtCoefficientsPines(
+                    gravitationalParameterFunction_( ), bodyReferenceRadius_( ), *pinesCache_,
+                    blockIndices, false, fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
+                    currentMaximumDegree_, currentMaximumOrder_ );
+    }
+    else
+    {
+        calculateSphericalHarmonicGravityWrtCCoefficients(
+                    bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
+                    sphericalHarmonicCache_,
+                    blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
+                        bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
+                    currentMaximumDegree_, currentMaximumOrder_ );
+    }
 }
 
 //! Function to calculate the partial of the acceleration wrt a set of sine coefficients.
@@ -420,12 +472,22 @@ void SphericalHarmonicsGravityPartial::wrtSineCoefficientBlock(
         const std::vector< std::pair< int, int > >& blockIndices,
         Eigen::MatrixXd& partialDerivatives )
 {
-    calculateSphericalHarmonicGravityWrtSCoefficients(
-                bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                sphericalHarmonicCache_,
-                blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                    bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
-                maximumDegree_, maximumOrder_ );
+    if( pinesCache_ != nullptr )
+    {
+        gravitation::computeSphericalHarmonicGravityWrtCoefficientsPines(
+                    gravitationalParameterFunction_( ), bodyReferenceRadius_( ), *pinesCache_,
+                    blockIndices, true, fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
+                    currentMaximumDegree_, currentMaximumOrder_ );
+    }
+    else
+    {
+        calculateSphericalHarmonicGravityWrtSCoefficients(
+                    bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
+                    sphericalHarmonicCache_,
+                    blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
+                        bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), partialDerivatives,
+                    currentMaximumDegree_, currentMaximumOrder_ );
+    }
 }
 
 //! Function to calculate an acceleration partial wrt a rotational parameter.
@@ -482,46 +544,26 @@ void SphericalHarmonicsGravityPartial::wrtTidalModelParameter(
         // Compute acceleration w.r.t. C and S coefficients, and multiply with partials of C,S coefficients w.r.t. parameter
         if( sumOrders )
         {
-            calculateSphericalHarmonicGravityWrtCCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtCosineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, 0, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 0, 0, 1, singleOrderPartialSize );
 
 
             blockIndices[ 0 ] = std::make_pair( degree, orders.at( i ) );
-            calculateSphericalHarmonicGravityWrtSCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtSineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, 0, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 1, 0, 1, singleOrderPartialSize );
         }
         else
         {
-            calculateSphericalHarmonicGravityWrtCCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtCosineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, i * singleOrderPartialSize, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 0, 0, 1, singleOrderPartialSize );
 
-            calculateSphericalHarmonicGravityWrtSCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtSineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, i * singleOrderPartialSize, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 1, 0, 1, singleOrderPartialSize );
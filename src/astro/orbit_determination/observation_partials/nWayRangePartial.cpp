@@ -83,6 +83,17 @@ NWayRangePartial::NWayRangePartialReturnType NWayRangePartial::calculatePartial(
         const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings,
         const Eigen::Vector1d& currentObservation )
 {
+    // Reuse (and remove) stored partial if computed from identical input
+    if( partialCache_ != nullptr && !storePartialsInCache_ )
+    {
+        if( partialCache_->isCachedInput( states, times, linkEndOfFixedTime, ancillarySettings ) )
+        {
+            partialCache_->numberOfReusedPartials_++;
+            partialCache_->isSet_ = false;
+            return std::move( partialCache_->partials_ );
+        }
+    }
+
     NWayRangePartialReturnType completePartialSet;
     int referenceStartLinkEndIndex = getNWayLinkIndexFromLinkEndType( linkEndOfFixedTime, numberOfLinkEnds_ );
 
@@ -137,6 +148,16 @@ NWayRangePartial::NWayRangePartialReturnType NWayRangePartial::calculatePartial(
         completePartialSet.insert( completePartialSet.end( ), currentPartialSet.begin( ), currentPartialSet.end( ) );
     }
 
+    if( partialCache_ != nullptr && storePartialsInCache_ )
+    {
+        partialCache_->isSet_ = true;
+        partialCache_->states_ = states;
+        partialCache_->times_ = times;
+        partialCache_->linkEndOfFixedTime_ = linkEndOfFixedTime;
+        partialCache_->ancillarySettings_ = ancillarySettings;
+        partialCache_->partials_ = completePartialSet;
+    }
+
     return completePartialSet;
 }
 
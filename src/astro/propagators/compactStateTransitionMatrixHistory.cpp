@@ -0,0 +1,261 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/propagators/compactStateTransitionMatrixHistory.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Constructor
+CompactStateTransitionMatrixHistory::CompactStateTransitionMatrixHistory(
+        const std::map< double, Eigen::MatrixXd >& stateTransitionSolution,
+        const std::map< double, Eigen::MatrixXd >& sensitivitySolution,
+        const int numberOfStages,
+        const bool useSinglePrecisionSensitivity ):
+    stateTransitionMatrixSize_( 0 ), sensitivityMatrixSize_( 0 ), numberOfStages_( numberOfStages ),
+    useSinglePrecisionSensitivity_( useSinglePrecisionSensitivity )
+{
+    if( numberOfStages_ < 2 || numberOfStages_ > maximumNumberOfStages || numberOfStages_ % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when creating compact state transition matrix history, number of stages " +
+                                  std::to_string( numberOfStages_ ) + " is not supported." );
+    }
+
+    if( stateTransitionSolution.size( ) != sensitivitySolution.size( ) )
+    {
+        throw std::runtime_error( "Error when creating compact state transition matrix history, state transition and "
+                                  "sensitivity matrix histories have different sizes." );
+    }
+
+    if( static_cast< int >( stateTransitionSolution.size( ) ) < numberOfStages_ )
+    {
+        throw std::runtime_error( "Error when creating compact state transition matrix history, " +
+                                  std::to_string( stateTransitionSolution.size( ) ) +
+                                  " epochs are insufficient for interpolation with " +
+                                  std::to_string( numberOfStages_ ) + " stages." );
+    }
+
+    stateTransitionMatrixSize_ = stateTransitionSolution.begin( )->second.rows( );
+    sensitivityMatrixSize_ = sensitivitySolution.begin( )->second.cols( );
+    const std::size_t stateTransitionEntries = stateTransitionMatrixSize_ * stateTransitionMatrixSize_;
+    const std::size_t sensitivityEntries = stateTransitionMatrixSize_ * sensitivityMatrixSize_;
+
+    // Copy matrices into contiguous buffers
+    times_.reserve( stateTransitionSolution.size( ) );
+    stateTransitionData_.resize( stateTransitionEntries * stateTransitionSolution.size( ) );
+    if( useSinglePrecisionSensitivity_ )
+    {
+        singlePrecisionSensitivityData_.resize( sensitivityEntries * sensitivitySolution.size( ) );
+    }
+    else
+    {
+        sensitivityData_.resize( sensitivityEntries * sensitivitySolution.size( ) );
+    }
+
+    auto sensitivityIterator = sensitivitySolution.begin( );
+    for( auto stateTransitionIterator = stateTransitionSolution.begin( );
+         stateTransitionIterator != stateTransitionSolution.end( ); stateTransitionIterator++, sensitivityIterator++ )
+    {
+        if( stateTransitionIterator->first != sensitivityIterator->first )
+        {
+            throw std::runtime_error( "Error when creating compact state transition matrix history, state transition and "
+                                      "sensitivity matrix histories are given at different epochs." );
+        }
+
+        if( stateTransitionIterator->second.rows( ) != stateTransitionMatrixSize_ ||
+                stateTransitionIterator->second.cols( ) != stateTransitionMatrixSize_ ||
+                sensitivityIterator->second.rows( ) != stateTransitionMatrixSize_ ||
+                sensitivityIterator->second.cols( ) != sensitivityMatrixSize_ )
+        {
+            throw std::runtime_error( "Error when creating compact state transition matrix history, inconsistent matrix "
+                                      "sizes found at epoch " + std::to_string( stateTransitionIterator->first ) );
+        }
+
+        const std::size_t currentIndex = times_.size( );
+        Eigen::Map< Eigen::MatrixXd >(
+                    stateTransitionData_.data( ) + currentIndex * stateTransitionEntries,
+                    stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) = stateTransitionIterator->second;
+        if( useSinglePrecisionSensitivity_ )
+        {
+            Eigen::Map< Eigen::MatrixXf >(
+                        singlePrecisionSensitivityData_.data( ) + currentIndex * sensitivityEntries,
+                        stateTransitionMatrixSize_, sensitivityMatrixSize_ ) = sensitivityIterator->second.cast< float >( );
+        }
+        else
+        {
+            Eigen::Map< Eigen::MatrixXd >(
+                        sensitivityData_.data( ) + currentIndex * sensitivityEntries,
+                        stateTransitionMatrixSize_, sensitivityMatrixSize_ ) = sensitivityIterator->second;
+        }
+        times_.push_back( stateTransitionIterator->first );
+    }
+
+    // Precompute inverse denominators of Lagrange polynomials for each stencil
+    const int numberOfStencils = static_cast< int >( times_.size( ) ) - numberOfStages_ + 1;
+    inverseLagrangeDenominators_.resize( numberOfStencils * numberOfStages_ );
+    for( int i = 0; i < numberOfStencils; i++ )
+    {
+        for( int j = 0; j < numberOfStages_; j++ )
+        {
+            double currentDenominator = 1.0;
+            for( int k = 0; k < numberOfStages_; k++ )
+            {
+                if( k != j )
+                {
+                    currentDenominator *= ( times_[ i + j ] - times_[ i + k ] );
+                }
+            }
+            inverseLagrangeDenominators_[ i * numberOfStages_ + j ] = 1.0 / currentDenominator;
+        }
+    }
+}
+
+//! Function to interpolate the concatenated state transition and sensitivity matrix at a list of times
+void CompactStateTransitionMatrixHistory::interpolateCombinedMatrices(
+        const std::vector< double >& evaluationTimes,
+        std::vector< Eigen::MatrixXd >& combinedMatrices ) const
+{
+    combinedMatrices.resize( evaluationTimes.size( ) );
+
+    int nearestLowerIndex = -1;
+    int firstStencilIndex;
+    double lagrangeWeights[ maximumNumberOfStages ];
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        combinedMatrices[ i ].resize( stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+
+        nearestLowerIndex = findNearestLowerIndex( evaluationTimes[ i ], nearestLowerIndex );
+        computeLagrangeWeights( evaluationTimes[ i ], nearestLowerIndex, firstStencilIndex, lagrangeWeights );
+        interpolateWithWeights(
+                    firstStencilIndex, lagrangeWeights,
+                    combinedMatrices[ i ].block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ),
+                    combinedMatrices[ i ].block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) );
+    }
+}
+
+//! Function to find the index of the last epoch before (or at) the given time, clipped to the data intervals
+int CompactStateTransitionMatrixHistory::findNearestLowerIndex( const double evaluationTime, const int initialGuess ) const
+{
+    const int lastIntervalIndex = static_cast< int >( times_.size( ) ) - 2;
+
+    // Move forward from initial guess, for (nearly) sorted evaluation times
+    if( initialGuess >= 0 && initialGuess <= lastIntervalIndex && times_[ initialGuess ] <= evaluationTime )
+    {
+        int currentIndex = initialGuess;
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            if( currentIndex == lastIntervalIndex || times_[ currentIndex + 1 ] > evaluationTime )
+            {
+                return currentIndex;
+            }
+            currentIndex++;
+        }
+    }
+
+    // Use bisection for all other cases
+    int nearestLowerIndex = static_cast< int >(
+                std::upper_bound( times_.begin( ), times_.end( ), evaluationTime ) - times_.begin( ) ) - 1;
+    return std::min( std::max( nearestLowerIndex, 0 ), lastIntervalIndex );
+}
+
+//! Function to compute the Lagrange polynomial weights for the data points in the interpolation stencil
+void CompactStateTransitionMatrixHistory::computeLagrangeWeights(
+        const double evaluationTime,
+        const int nearestLowerIndex,
+        int& firstStencilIndex,
+        double* lagrangeWeights ) const
+{
+    // Center stencil on current interval, shifting it inwards near the boundaries
+    firstStencilIndex = nearestLowerIndex - ( numberOfStages_ / 2 - 1 );
+    firstStencilIndex = std::min( std::max( firstStencilIndex, 0 ),
+                                  static_cast< int >( times_.size( ) ) - numberOfStages_ );
+
+    // Compute products of differences w.r.t. stencil times preceding and following each data point
+    const double* stencilTimes = times_.data( ) + firstStencilIndex;
+    const double* inverseDenominators = inverseLagrangeDenominators_.data( ) + firstStencilIndex * numberOfStages_;
+    double precedingDifferenceProduct = 1.0;
+    for( int i = 0; i < numberOfStages_; i++ )
+    {
+        lagrangeWeights[ i ] = precedingDifferenceProduct * inverseDenominators[ i ];
+        precedingDifferenceProduct *= ( evaluationTime - stencilTimes[ i ] );
+    }
+
+    double followingDifferenceProduct = 1.0;
+    for( int i = numberOfStages_ - 1; i >= 0; i-- )
+    {
+        lagrangeWeights[ i ] *= followingDifferenceProduct;
+        followingDifferenceProduct *= ( evaluationTime - stencilTimes[ i ] );
+    }
+}
+
+//! Function to compute the weighted sum of the matrices in the interpolation stencil
+template< typename DataScalarType >
+void computeWeightedMatrixSum( const DataScalarType* matrixData,
+                               const std::size_t matrixEntries,
+                               const int numberOfStages,
+                               const double* lagrangeWeights,
+                               Eigen::Ref< Eigen::MatrixXd > interpolatedMatrix )
+{
+    typedef Eigen::Map< const Eigen::Matrix< DataScalarType, Eigen::Dynamic, Eigen::Dynamic > > MatrixDataMap;
+    const int numberOfRows = interpolatedMatrix.rows( );
+    const int numberOfColumns = interpolatedMatrix.cols( );
+
+    // Add matrices two at a time (number of stages is even), to limit the number of passes over the output
+    interpolatedMatrix.noalias( ) =
+            lagrangeWeights[ 0 ] * MatrixDataMap( matrixData, numberOfRows, numberOfColumns ).template cast< double >( ) +
+            lagrangeWeights[ 1 ] * MatrixDataMap( matrixData + matrixEntries, numberOfRows, numberOfColumns ).template cast< double >( );
+    for( int i = 2; i < numberOfStages; i += 2 )
+    {
+        interpolatedMatrix.noalias( ) +=
+                lagrangeWeights[ i ] * MatrixDataMap(
+                    matrixData + i * matrixEntries, numberOfRows, numberOfColumns ).template cast< double >( ) +
+                lagrangeWeights[ i + 1 ] * MatrixDataMap(
+                    matrixData + ( i + 1 ) * matrixEntries, numberOfRows, numberOfColumns ).template cast< double >( );
+    }
+}
+
+//! Function to compute the weighted sum of the matrices in the interpolation stencil
+void CompactStateTransitionMatrixHistory::interpolateWithWeights(
+        const int firstStencilIndex,
+        const double* lagrangeWeights,
+        Eigen::Ref< Eigen::MatrixXd > stateTransitionMatrix,
+        Eigen::Ref< Eigen::MatrixXd > sensitivityMatrix ) const
+{
+    const std::size_t stateTransitionEntries = stateTransitionMatrixSize_ * stateTransitionMatrixSize_;
+    const std::size_t sensitivityEntries = stateTransitionMatrixSize_ * sensitivityMatrixSize_;
+
+    computeWeightedMatrixSum( stateTransitionData_.data( ) + firstStencilIndex * stateTransitionEntries,
+                              stateTransitionEntries, numberOfStages_, lagrangeWeights, stateTransitionMatrix );
+
+    if( sensitivityMatrixSize_ > 0 )
+    {
+        if( useSinglePrecisionSensitivity_ )
+        {
+            computeWeightedMatrixSum( singlePrecisionSensitivityData_.data( ) + firstStencilIndex * sensitivityEntries,
+                                      sensitivityEntries, numberOfStages_, lagrangeWeights, sensitivityMatrix );
+        }
+        else
+        {
+            computeWeightedMatrixSum( sensitivityData_.data( ) + firstStencilIndex * sensitivityEntries,
+                                      sensitivityEntries, numberOfStages_, lagrangeWeights, sensitivityMatrix );
+        }
+    }
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -13,10 +13,12 @@ void getFullVariationalEquationsSolutionHistory(
         const std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
         const std::vector< double > evaluationTimes )
 {
+    std::vector< Eigen::MatrixXd > fullVariationalEquationsSolutions;
+    stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrices(
+                evaluationTimes, fullVariationalEquationsSolutions, false );
     for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
     {
-        fullVariationalEquationsSolutionHistory[ evaluationTimes.at( i ) ] =
-                stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ), false  );
+        fullVariationalEquationsSolutionHistory[ evaluationTimes.at( i ) ] = std::move( fullVariationalEquationsSolutions.at( i ) );
     }
 }
 
@@ -28,6 +28,7 @@ void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrix
 {
     stateTransitionMatrixInterpolator_ = stateTransitionMatrixInterpolator;
     sensitivityMatrixInterpolator_ = sensitivityMatrixInterpolator;
+    compactMatrixHistory_ = nullptr;
 
     // Re-order state partial addition indices to match ephemeris update order (inverted in variational equations object)
     statePartialAdditionIndices_.clear( );
@@ -43,31 +44,81 @@ Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::g
         const bool addCentralBodyDependency,
         const std::vector< std::string >& arcDefiningBodies )
 {
-    combinedStateTransitionMatrix_.setZero( );
+    getCombinedStateTransitionAndSensitivityMatrix(
+                evaluationTime, combinedStateTransitionMatrix_, addCentralBodyDependency, arcDefiningBodies );
+    return combinedStateTransitionMatrix_;
+}
 
+//! Function to get the concatenated state transition and sensitivity matrix at a given time, returned by reference.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix(
+        const double evaluationTime,
+        Eigen::MatrixXd& combinedMatrix,
+        const bool addCentralBodyDependency,
+        const std::vector< std::string >& arcDefiningBodies )
+{
+    combinedMatrix.resize( stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+    if( compactMatrixHistory_ != nullptr )
+    {
+        compactMatrixHistory_->interpolateCombinedMatrix( evaluationTime, combinedMatrix );
+    }
+    else
+    {
+        // Set Phi and S matrices.
+        combinedMatrix.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+                stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
 
-    // Set Phi and S matrices.
-    combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
-            stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
+        if( sensitivityMatrixSize_ > 0 )
+        {
+            combinedMatrix.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
+                    sensitivityMatrixInterpolator_->interpolate( evaluationTime );
+        }
+    }
 
-    if( sensitivityMatrixSize_ > 0 )
+    if ( addCentralBodyDependency )
     {
-        combinedStateTransitionMatrix_.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
-                sensitivityMatrixInterpolator_->interpolate( evaluationTime );
+        addCentralBodyDependencyToCombinedMatrix( combinedMatrix );
     }
+}
 
-    if ( addCentralBodyDependency )
+//! Function to get the concatenated state transition and sensitivity matrices at a list of times.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrices(
+        const std::vector< double >& evaluationTimes,
+        std::vector< Eigen::MatrixXd >& combinedMatrices,
+        const bool addCentralBodyDependency )
+{
+    if( compactMatrixHistory_ != nullptr )
+    {
+        compactMatrixHistory_->interpolateCombinedMatrices( evaluationTimes, combinedMatrices );
+        if ( addCentralBodyDependency )
+        {
+            for( unsigned int i = 0; i < combinedMatrices.size( ); i++ )
+            {
+                addCentralBodyDependencyToCombinedMatrix( combinedMatrices[ i ] );
+            }
+        }
+    }
+    else
     {
-        for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+        combinedMatrices.resize( evaluationTimes.size( ) );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
         {
-            combinedStateTransitionMatrix_.block(
-                    statePartialAdditionIndices_.at( i ).first, 0, 6, stateTransitionMatrixSize_ + sensitivityMatrixSize_ ) +=
-                    combinedStateTransitionMatrix_.block(
-                            statePartialAdditionIndices_.at( i ).second, 0, 6, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+            getCombinedStateTransitionAndSensitivityMatrix(
+                        evaluationTimes[ i ], combinedMatrices[ i ], addCentralBodyDependency );
         }
     }
+}
 
-    return combinedStateTransitionMatrix_;
+//! Function to add the dependency on the central body states to a concatenated state transition and sensitivity matrix.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::addCentralBodyDependencyToCombinedMatrix(
+        Eigen::MatrixXd& combinedMatrix )
+{
+    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+    {
+        combinedMatrix.block(
+                statePartialAdditionIndices_.at( i ).first, 0, 6, stateTransitionMatrixSize_ + sensitivityMatrixSize_ ) +=
+                combinedMatrix.block(
+                        statePartialAdditionIndices_.at( i ).second, 0, 6, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+    }
 }
 
 }
@@ -44,7 +44,7 @@ void VariationalEquations::setBodyStatePartialMatrix( )
 
     if( dynamicalStatesToEstimate_.count( propagators::rotational_state ) > 0 )
     {
-        Eigen::VectorXd rotationalStates = currentStatesPerTypeInConventionalRepresentation_.at(
+        const Eigen::VectorXd& rotationalStates = currentStatesPerTypeInConventionalRepresentation_.at(
                     propagators::rotational_state );
 
         int startIndex = stateTypeStartIndices_.at( propagators::rotational_state );
@@ -57,29 +57,13 @@ void VariationalEquations::setBodyStatePartialMatrix( )
         }
     }
 
-    // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
-    for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
-         std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator
-         typeIterator = statePartialList_.begin( ); typeIterator != statePartialList_.end( ); typeIterator++ )
+    // Evaluate all state partial functions determined by setStatePartialFunctionList( )
+    for( unsigned int i = 0; i < statePartialBlocks_.size( ); i++ )
     {
-        int startIndex = stateTypeStartIndices_.at( typeIterator->first );
-        int currentStateSize = getSingleIntegrationSize( typeIterator->first );
-        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
-
-        for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
-        {
-            // Iterate over all bodies exerting an acceleration on this body.
-            for( statePartialIterator_ = typeIterator->second.at( i ).begin( );
-                 statePartialIterator_ != typeIterator->second.at( i ).end( );
-                 statePartialIterator_++ )
-            {
-                statePartialIterator_->second(
-                            variationalMatrix_.block(
-                                startIndex + entriesToSkipPerEntry + i* currentStateSize, statePartialIterator_->first.first,
-                                currentStateSize - entriesToSkipPerEntry, statePartialIterator_->first.second ) );
-
-            }
-        }
+        statePartialBlocks_[ i ].partialFunction_(
+                    variationalMatrix_.block(
+                        statePartialBlocks_[ i ].startRow_, statePartialBlocks_[ i ].startColumn_,
+                        statePartialBlocks_[ i ].numberOfRows_, statePartialBlocks_[ i ].numberOfColumns_ ) );
     }
 
     for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
@@ -168,6 +152,211 @@ void VariationalEquations::setStatePartialFunctionList( )
     }
 }
 
+//! Function (called by constructor) to set up the flat lists of partial functions and the product blocks
+void VariationalEquations::createEvaluationPlan( )
+{
+    statePartialBlocks_.clear( );
+    parameterPartialBlocks_.clear( );
+    productBlocks_.clear( );
+
+    // Matrix denoting which entries of variationalMatrix_ may be non-zero
+    Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic > nonZeroEntries =
+            Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic >::Constant(
+                totalDynamicalStateSize_, totalDynamicalStateSize_, false );
+
+    if( dynamicalStatesToEstimate_.count( propagators::translational_state ) > 0 )
+    {
+        int startIndex = stateTypeStartIndices_.at( propagators::translational_state );
+        for( unsigned int i = 0; i < dynamicalStatesToEstimate_.at( propagators::translational_state ).size( ); i++ )
+        {
+            for( int j = 0; j < 3; j++ )
+            {
+                nonZeroEntries( startIndex + i * 6 + j, startIndex + i * 6 + 3 + j ) = true;
+            }
+        }
+    }
+
+    if( dynamicalStatesToEstimate_.count( propagators::rotational_state ) > 0 )
+    {
+        int startIndex = stateTypeStartIndices_.at( propagators::rotational_state );
+        for( unsigned int i = 0; i < dynamicalStatesToEstimate_.at( propagators::rotational_state ).size( ); i++ )
+        {
+            nonZeroEntries.block( startIndex + i * 7, startIndex + i * 7, 4, 7 ).setConstant( true );
+        }
+    }
+
+    // Create flat lists of state and parameter partial functions
+    for( const auto& typeIterator : statePartialList_ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator.first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator.first );
+        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator.first );
+
+        for( unsigned int i = 0; i < typeIterator.second.size( ); i++ )
+        {
+            for( const auto& functionIterator : typeIterator.second.at( i ) )
+            {
+                statePartialBlocks_.push_back(
+                            VariationalEquationsPartialBlock(
+                                startIndex + entriesToSkipPerEntry + i * currentStateSize, functionIterator.first.first,
+                                currentStateSize - entriesToSkipPerEntry, functionIterator.first.second,
+                                functionIterator.second ) );
+                nonZeroEntries.block(
+                            statePartialBlocks_.back( ).startRow_, statePartialBlocks_.back( ).startColumn_,
+                            statePartialBlocks_.back( ).numberOfRows_, statePartialBlocks_.back( ).numberOfColumns_ ).setConstant( true );
+            }
+        }
+    }
+
+    for( const auto& typeIterator : parameterPartialList_ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator.first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator.first );
+        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator.first );
+
+        for( unsigned int i = 0; i < typeIterator.second.size( ); i++ )
+        {
+            for( const auto& functionIterator : typeIterator.second.at( i ) )
+            {
+                parameterPartialBlocks_.push_back(
+                            VariationalEquationsPartialBlock(
+                                startIndex + entriesToSkipPerEntry + currentStateSize * i,
+                                functionIterator.first.first - totalDynamicalStateSize_,
+                                currentStateSize - entriesToSkipPerEntry, functionIterator.first.second,
+                                functionIterator.second ) );
+            }
+        }
+    }
+
+    // Apply column additions and row scalings of setBodyStatePartialMatrix to non-zero entries
+    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+    {
+        for( int j = 0; j < 3; j++ )
+        {
+            for( int k = 0; k < totalDynamicalStateSize_; k++ )
+            {
+                nonZeroEntries( k, statePartialAdditionIndices_.at( i ).second + j ) =
+                        nonZeroEntries( k, statePartialAdditionIndices_.at( i ).second + j ) ||
+                        nonZeroEntries( k, statePartialAdditionIndices_.at( i ).first + j );
+            }
+        }
+    }
+
+    for( unsigned int i = 0; i < inertiaTensorsForMultiplication_.size( ); i++ )
+    {
+        int startRow = inertiaTensorsForMultiplication_.at( i ).first;
+        for( int k = 0; k < totalDynamicalStateSize_; k++ )
+        {
+            bool isColumnNonZero = nonZeroEntries( startRow, k ) || nonZeroEntries( startRow + 1, k ) ||
+                    nonZeroEntries( startRow + 2, k );
+            nonZeroEntries.block( startRow, k, 3, 1 ).setConstant( isColumnNonZero );
+        }
+    }
+
+    // Set blocks of rows: kinematic and dynamic part of each propagated body
+    std::vector< VariationalMatrixProductBlock > rowBlocks;
+    for( const auto& typeIterator : stateDerivativePartialList_ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator.first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator.first );
+        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator.first );
+
+        for( unsigned int i = 0; i < typeIterator.second.size( ); i++ )
+        {
+            if( entriesToSkipPerEntry > 0 )
+            {
+                rowBlocks.push_back( VariationalMatrixProductBlock(
+                                         startIndex + i * currentStateSize, entriesToSkipPerEntry ) );
+
+                // Kinematic part of translational state is identity block, if no other partials are added to it
+                if( typeIterator.first == propagators::translational_state )
+                {
+                    rowBlocks.back( ).identityStartColumn_ = startIndex + i * currentStateSize + 3;
+                }
+            }
+            rowBlocks.push_back( VariationalMatrixProductBlock(
+                                     startIndex + i * currentStateSize + entriesToSkipPerEntry,
+                                     currentStateSize - entriesToSkipPerEntry ) );
+        }
+    }
+
+    productBlocks_ = createVariationalMatrixProductBlocks( rowBlocks, nonZeroEntries );
+}
+
+//! Function to determine the blocks in which the product of the state partial matrix and another matrix is evaluated
+std::vector< VariationalMatrixProductBlock > createVariationalMatrixProductBlocks(
+        const std::vector< VariationalMatrixProductBlock >& rowBlocks,
+        const Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic >& nonZeroEntries )
+{
+    int matrixSize = nonZeroEntries.rows( );
+
+    // Check that each row is in exactly one block; use a single dense block otherwise
+    std::vector< int > numberOfBlocksPerRow( matrixSize, 0 );
+    bool areBlocksConsistent = true;
+    for( unsigned int i = 0; i < rowBlocks.size( ); i++ )
+    {
+        for( int j = rowBlocks.at( i ).startRow_; j < rowBlocks.at( i ).startRow_ + rowBlocks.at( i ).numberOfRows_; j++ )
+        {
+            if( j < 0 || j >= matrixSize )
+            {
+                areBlocksConsistent = false;
+            }
+            else
+            {
+                numberOfBlocksPerRow.at( j )++;
+            }
+        }
+    }
+    for( int j = 0; j < matrixSize; j++ )
+    {
+        if( numberOfBlocksPerRow.at( j ) != 1 )
+        {
+            areBlocksConsistent = false;
+        }
+    }
+
+    std::vector< VariationalMatrixProductBlock > productBlocks;
+    if( !areBlocksConsistent )
+    {
+        productBlocks.push_back( VariationalMatrixProductBlock( 0, matrixSize ) );
+        productBlocks.back( ).nonZeroColumnRanges_.push_back( std::make_pair( 0, matrixSize ) );
+        return productBlocks;
+    }
+
+    for( unsigned int i = 0; i < rowBlocks.size( ); i++ )
+    {
+        int startRow = rowBlocks.at( i ).startRow_;
+        int numberOfRows = rowBlocks.at( i ).numberOfRows_;
+        productBlocks.push_back( VariationalMatrixProductBlock( startRow, numberOfRows ) );
+
+        // Retain identity block only if the non-zero entries of the rows are exactly those of the identity matrix
+        int identityStartColumn = rowBlocks.at( i ).identityStartColumn_;
+        if( identityStartColumn >= 0 && identityStartColumn + numberOfRows <= matrixSize &&
+                nonZeroEntries.block( startRow, 0, numberOfRows, matrixSize ).count( ) == numberOfRows &&
+                nonZeroEntries.block( startRow, identityStartColumn, numberOfRows, numberOfRows ).diagonal( ).all( ) )
+        {
+            productBlocks.back( ).identityStartColumn_ = identityStartColumn;
+            continue;
+        }
+
+        // Determine contiguous ranges of non-zero columns
+        int rangeStartColumn = -1;
+        for( int k = 0; k <= matrixSize; k++ )
+        {
+            bool isColumnNonZero = ( k < matrixSize ) && nonZeroEntries.block( startRow, k, numberOfRows, 1 ).any( );
+            if( isColumnNonZero && rangeStartColumn < 0 )
+            {
+                rangeStartColumn = k;
+            }
+            else if( !isColumnNonZero && rangeStartColumn >= 0 )
+            {
+                productBlocks.back( ).nonZeroColumnRanges_.push_back( std::make_pair( rangeStartColumn, k - rangeStartColumn ) );
+                rangeStartColumn = -1;
+            }
+        }
+    }
+    return productBlocks;
+}
 
 } // namespace propagators
 
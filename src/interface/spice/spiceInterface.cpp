@@ -399,6 +399,66 @@ std::string convertNaifIdToBodyName( int bodyNaifId )
     return static_cast< std::string >( bodyName );
 }
 
+//! Function to check if a string consists of an integer, and convert it if so
+static bool convertIntegerString( const std::string& inputString, int& integerValue )
+{
+    std::size_t numberOfParsedCharacters = 0;
+    try
+    {
+        integerValue = std::stoi( inputString, &numberOfParsedCharacters );
+    }
+    catch( std::exception& )
+    {
+        return false;
+    }
+    return ( numberOfParsedCharacters == inputString.size( ) );
+}
+
+//! Retrieve the NAIF identification number of a body, as used in SPK kernels.
+int getSpkBodyIdFromName( const std::string& bodyName )
+{
+    int bodyNaifId;
+    if( !convertIntegerString( bodyName, bodyNaifId ) )
+    {
+        SpiceInt spiceBodyNaifId = 0;
+        SpiceBoolean isIdFound = SPICEFALSE;
+        bods2c_c( bodyName.c_str( ), &spiceBodyNaifId, &isIdFound );
+        if( !isIdFound )
+        {
+            throw std::runtime_error( "Error, body name " + bodyName + " not recognized by Spice." );
+        }
+        bodyNaifId = static_cast< int >( spiceBodyNaifId );
+    }
+    return bodyNaifId;
+}
+
+//! Retrieve the NAIF identification number of a body-fixed frame class, as used in binary PCK kernels.
+int getPckFrameClassIdFromName( const std::string& frameName )
+{
+    int frameClassId;
+    if( !convertIntegerString( frameName, frameClassId ) )
+    {
+        SpiceInt frameCode = 0;
+        namfrm_c( frameName.c_str( ), &frameCode );
+        if( frameCode == 0 )
+        {
+            throw std::runtime_error( "Error, frame name " + frameName + " not recognized by Spice." );
+        }
+
+        SpiceInt frameCenter, frameClass, spiceFrameClassId;
+        SpiceBoolean isFrameFound = SPICEFALSE;
+        frinfo_c( frameCode, &frameCenter, &frameClass, &spiceFrameClassId, &isFrameFound );
+
+        // Frame class 2 denotes a frame defined by a binary PCK kernel
+        if( !isFrameFound || frameClass != 2 )
+        {
+            throw std::runtime_error( "Error, frame " + frameName + " is not defined by a binary PCK kernel." );
+        }
+        frameClassId = static_cast< int >( spiceFrameClassId );
+    }
+    return frameClassId;
+}
+
 //! Check if a certain property of a body is in the kernel pool.
 bool checkBodyPropertyInKernelPool(const std::string &bodyName, const std::string &bodyProperty) {
     // Convert body name to NAIF ID.
@@ -0,0 +1,90 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <fstream>
+#include <stdexcept>
+
+#if !defined( _WIN32 )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "tudat/io/memoryMappedFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Constructor, maps the file into memory
+MemoryMappedFile::MemoryMappedFile( const std::string& fileName ):
+    fileName_( fileName ), data_( nullptr ), size_( 0 ), isMapped_( false )
+{
+#if !defined( _WIN32 )
+    int fileDescriptor = open( fileName.c_str( ), O_RDONLY );
+    if( fileDescriptor < 0 )
+    {
+        throw std::runtime_error( "Error when memory-mapping file " + fileName + ", file could not be opened." );
+    }
+
+    struct stat fileStatus;
+    if( fstat( fileDescriptor, &fileStatus ) != 0 )
+    {
+        close( fileDescriptor );
+        throw std::runtime_error( "Error when memory-mapping file " + fileName + ", file size could not be determined." );
+    }
+    size_ = static_cast< std::size_t >( fileStatus.st_size );
+
+    // Empty files cannot be mapped, and have no contents to access
+    if( size_ > 0 )
+    {
+        void* mappedData = mmap( nullptr, size_, PROT_READ, MAP_SHARED, fileDescriptor, 0 );
+        if( mappedData == MAP_FAILED )
+        {
+            close( fileDescriptor );
+            throw std::runtime_error( "Error when memory-mapping file " + fileName + ", mapping failed." );
+        }
+        data_ = static_cast< const char* >( mappedData );
+        isMapped_ = true;
+    }
+
+    // Mapping remains valid after closing file
+    close( fileDescriptor );
+#else
+    std::ifstream fileStream( fileName, std::ios::binary | std::ios::ate );
+    if( !fileStream.good( ) )
+    {
+        throw std::runtime_error( "Error when memory-mapping file " + fileName + ", file could not be opened." );
+    }
+    size_ = static_cast< std::size_t >( fileStream.tellg( ) );
+    buffer_.resize( size_ );
+    fileStream.seekg( 0 );
+    fileStream.read( buffer_.data( ), size_ );
+    data_ = buffer_.data( );
+#endif
+}
+
+//! Destructor, unmaps the file
+MemoryMappedFile::~MemoryMappedFile( )
+{
+#if !defined( _WIN32 )
+    if( isMapped_ )
+    {
+        munmap( const_cast< char* >( data_ ), size_ );
+    }
+#endif
+}
+
+} // namespace input_output
+
+} // namespace tudat
@@ -8,6 +8,10 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+
+#include "tudat/basics/parallelExecution.h"
+#include "tudat/io/memoryMappedFile.h"
 #include "tudat/io/readOdfFile.h"
 
 namespace tudat
@@ -728,6 +732,301 @@ OdfRawFileContents::OdfRawFileContents( const std::string& odfFile ):
     }
 }
 
+//! Size (in bytes) of a single ODF record
+static const unsigned int ODF_RECORD_SIZE = 36;
+
+//! Function to check whether an ODF record is a header, i.e. whether its filler items (bytes 16-35) are zero.
+static bool isOdfHeaderRecord( const unsigned char* record )
+{
+    for( unsigned int i = 16; i < ODF_RECORD_SIZE; i++ )
+    {
+        if( record[ i ] != 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Function to parse the items of an ODF header record, according to table 3.1 of TRK-2-18 (2018).
+static void parseOdfHeaderRecord( const unsigned char* record, int& primaryKey, unsigned int& secondaryKey,
+                                  unsigned int& logicalRecordLength, unsigned int& groupStartPacketNumber )
+{
+    primaryKey = getSignedIntegerFromBytes( record, 0, 32 );
+    secondaryKey = getUnsignedIntegerFromBytes( record, 32, 32 );
+    logicalRecordLength = getUnsignedIntegerFromBytes( record, 64, 32 );
+    groupStartPacketNumber = getUnsignedIntegerFromBytes( record, 96, 32 );
+}
+
+void OdfColumnarFileContents::addOrbitDataRecord( const unsigned char* record )
+{
+    // Common data, table 3-4a of TRK-2-18 (2018)
+    int formatId = getUnsignedIntegerFromBytes( record, 128, 3 );
+    if ( formatId != 2 )
+    {
+        throw std::runtime_error( "Error when reading ODF file: reading of ODF files with format ID " + std::to_string( formatId ) +
+            " not implemented." );
+    }
+
+    int dataType = getUnsignedIntegerFromBytes( record, 147, 6 );
+    if( !( ( dataType >= 1 && dataType <= 6 ) || ( dataType >= 11 && dataType <= 13 ) || dataType == 37 || dataType == 41 ||
+           ( dataType >= 51 && dataType <= 58 ) ) )
+    {
+        throw std::runtime_error( "Error, ODF data type " + std::to_string( dataType ) + " not recognized." );
+    }
+
+    observableTimes_.push_back(
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 0, 32 ) ) +
+                static_cast< double >( static_cast< int >( getUnsignedIntegerFromBytes( record, 32, 10 ) ) ) / 1000.0 );
+    receivingStationDownlinkDelays_.push_back(
+                static_cast< int >( getUnsignedIntegerFromBytes( record, 42, 22 ) ) * 1.0e-9 );
+    observableValues_.push_back(
+                static_cast< double >( getSignedIntegerFromBytes( record, 64, 32 ) ) +
+                static_cast< double >( getSignedIntegerFromBytes( record, 96, 32 ) ) / 1.0E9 );
+    receivingStationIds_.push_back( getUnsignedIntegerFromBytes( record, 131, 7 ) );
+    transmittingStationIds_.push_back( getUnsignedIntegerFromBytes( record, 138, 7 ) );
+    transmittingStationNetworkIds_.push_back( getUnsignedIntegerFromBytes( record, 145, 2 ) );
+    dataTypes_.push_back( dataType );
+    downlinkBandIds_.push_back( getUnsignedIntegerFromBytes( record, 153, 2 ) );
+    uplinkBandIds_.push_back( getUnsignedIntegerFromBytes( record, 155, 2 ) );
+    referenceBandIds_.push_back( getUnsignedIntegerFromBytes( record, 157, 2 ) );
+    validities_.push_back( getUnsignedIntegerFromBytes( record, 159, 1 ) );
+
+    // Observable-specific data, table 3-4d of TRK-2-18 (2018)
+    receiverChannels_.push_back( getUnsignedIntegerFromBytes( record, 160, 7 ) );
+    spacecraftIds_.push_back( getUnsignedIntegerFromBytes( record, 167, 10 ) );
+    receiverExciterFlags_.push_back( getUnsignedIntegerFromBytes( record, 177, 1 ) );
+    int referenceFrequencyHighPart = getUnsignedIntegerFromBytes( record, 178, 22 );
+    int referenceFrequencyLowPart = getUnsignedIntegerFromBytes( record, 200, 24 );
+    referenceFrequencies_.push_back(
+                std::pow( 2.0, 24 ) / 1.0E3 * referenceFrequencyHighPart + referenceFrequencyLowPart / 1.0E3 );
+    compressionTimes_.push_back( static_cast< int >( getUnsignedIntegerFromBytes( record, 244, 22 ) ) * 1.0e-2 );
+    transmittingStationUplinkDelays_.push_back( static_cast< int >( getUnsignedIntegerFromBytes( record, 266, 22 ) ) * 1.0e-9 );
+}
+
+void OdfColumnarFileContents::addRampRecord( const unsigned char* record, const int rampStation )
+{
+    // Ramp data, table 3-5 of TRK-2-18 (2018)
+    OdfRampColumns& currentRampData = rampData_[ rampStation ];
+    currentRampData.rampStartTimes_.push_back(
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 0, 32 ) ) +
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 32, 32 ) ) * 1.0E-9 );
+    currentRampData.rampRates_.push_back(
+                static_cast< double >( getSignedIntegerFromBytes( record, 64, 32 ) ) +
+                static_cast< double >( getSignedIntegerFromBytes( record, 96, 32 ) ) * 1.0E-9 );
+    currentRampData.rampStartFrequencies_.push_back(
+                static_cast< double >( static_cast< int >( getUnsignedIntegerFromBytes( record, 128, 22 ) ) ) * 1.0E9 +
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 160, 32 ) ) +
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 192, 32 ) ) * 1.0E-9 );
+    currentRampData.rampEndTimes_.push_back(
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 224, 32 ) ) +
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 256, 32 ) ) * 1.0E-9 );
+}
+
+void OdfColumnarFileContents::addClockOffsetRecord( const unsigned char* record )
+{
+    // Clock offset data, table 3-6 of TRK-2-18 (2018)
+    clockOffsetStartTimes_.push_back(
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 0, 32 ) ) +
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 32, 32 ) ) * 1.0E-9 );
+    clockOffsets_.push_back(
+                static_cast< double >( getSignedIntegerFromBytes( record, 64, 32 ) ) +
+                static_cast< double >( getSignedIntegerFromBytes( record, 96, 32 ) ) * 1.0E-9 );
+    clockOffsetPrimaryStationIds_.push_back( getUnsignedIntegerFromBytes( record, 128, 32 ) );
+    clockOffsetSecondaryStationIds_.push_back( getUnsignedIntegerFromBytes( record, 160, 32 ) );
+    clockOffsetEndTimes_.push_back(
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 224, 32 ) ) +
+                static_cast< double >( getUnsignedIntegerFromBytes( record, 256, 32 ) ) * 1.0E-9 );
+}
+
+OdfColumnarFileContents::OdfColumnarFileContents( const std::string& odfFile ):
+    fileName_( odfFile )
+{
+    // Map file into memory
+    std::shared_ptr< MemoryMappedFile > mappedFile;
+    try
+    {
+        mappedFile = std::make_shared< MemoryMappedFile >( odfFile );
+    }
+    catch( const std::runtime_error& )
+    {
+        throw std::runtime_error( "Error when opening ODF file, file " + odfFile +  " could not be opened." );
+    }
+    const unsigned char* fileData = reinterpret_cast< const unsigned char* >( mappedFile->getData( ) );
+    const std::size_t numberOfRecords = mappedFile->getSize( ) / ODF_RECORD_SIZE;
+
+    auto getRecord = [ & ]( const std::size_t recordIndex )
+    {
+        if( recordIndex >= numberOfRecords )
+        {
+            throw std::runtime_error( "Error when reading ODF file " + odfFile + ": end of file was found before EOF group." );
+        }
+        return fileData + recordIndex * ODF_RECORD_SIZE;
+    };
+
+    // Variables to parse headers
+    int primaryKey;
+    unsigned int secondaryKey, logicalRecordLength, groupStartPacketNumber;
+
+    // Parse file label header and data
+    parseOdfHeaderRecord( getRecord( 0 ), primaryKey, secondaryKey, logicalRecordLength, groupStartPacketNumber );
+    if( !isOdfHeaderRecord( getRecord( 0 ) ) || primaryKey != 101 || secondaryKey != 0 || logicalRecordLength != 1 ||
+        groupStartPacketNumber != 0 )
+    {
+        throw std::runtime_error( "Error when reading ODF file, file label header invalid: primary key " +
+        std::to_string( primaryKey ) + ", secondary key " + std::to_string( secondaryKey ) + ", logical record length" +
+        std::to_string( logicalRecordLength ) + ", packet number " + std::to_string( groupStartPacketNumber ) + "." );
+    }
+
+    const char* fileLabelRecord = reinterpret_cast< const char* >( getRecord( 1 ) );
+    systemId_ = std::string( fileLabelRecord, 8 );
+    programId_ = std::string( fileLabelRecord + 8, 8 );
+    spacecraftId_ = getUnsignedIntegerFromBytes( getRecord( 1 ), 128, 32 );
+    fileCreationDate_ = getUnsignedIntegerFromBytes( getRecord( 1 ), 160, 32 );
+    fileCreationTime_ = getUnsignedIntegerFromBytes( getRecord( 1 ), 192, 32 );
+    fileReferenceDate_ = getUnsignedIntegerFromBytes( getRecord( 1 ), 224, 32 );
+    fileReferenceTime_ = getUnsignedIntegerFromBytes( getRecord( 1 ), 256, 32 );
+
+    // Parse identifier header and data
+    parseOdfHeaderRecord( getRecord( 2 ), primaryKey, secondaryKey, logicalRecordLength, groupStartPacketNumber );
+    if( !isOdfHeaderRecord( getRecord( 2 ) ) || primaryKey != 107 || secondaryKey != 0 || logicalRecordLength != 1 ||
+        groupStartPacketNumber != 2 )
+    {
+        throw std::runtime_error( "Error when reading ODF file, identifier header invalid: primary key " +
+        std::to_string( primaryKey ) + ", secondary key " + std::to_string( secondaryKey ) + ", logical record length " +
+        std::to_string( logicalRecordLength ) + ", packet number " + std::to_string( groupStartPacketNumber ) + "." );
+    }
+
+    const char* identifierRecord = reinterpret_cast< const char* >( getRecord( 3 ) );
+    identifierGroupStringA_ = std::string( identifierRecord, 8 );
+    identifierGroupStringB_ = std::string( identifierRecord + 8, 8 );
+    identifierGroupStringC_ = std::string( identifierRecord + 16, 20 );
+
+    // Parse orbit data header
+    parseOdfHeaderRecord( getRecord( 4 ), primaryKey, secondaryKey, logicalRecordLength, groupStartPacketNumber );
+    if( !isOdfHeaderRecord( getRecord( 4 ) ) || primaryKey != 109 || secondaryKey != 0 || logicalRecordLength != 1 ||
+        groupStartPacketNumber != 4 )
+    {
+        throw std::runtime_error( "Error when reading ODF file, orbit header invalid: primary key " +
+        std::to_string( primaryKey ) + ", secondary key " + std::to_string( secondaryKey ) + ", logical record length " +
+        std::to_string( logicalRecordLength ) + ", packet number " + std::to_string( groupStartPacketNumber ) + "." );
+    }
+
+    // Reserve memory for (upper bound of) number of orbit data records
+    observableTimes_.reserve( numberOfRecords );
+    observableValues_.reserve( numberOfRecords );
+    receivingStationDownlinkDelays_.reserve( numberOfRecords );
+    receivingStationIds_.reserve( numberOfRecords );
+    transmittingStationIds_.reserve( numberOfRecords );
+    transmittingStationNetworkIds_.reserve( numberOfRecords );
+    dataTypes_.reserve( numberOfRecords );
+    downlinkBandIds_.reserve( numberOfRecords );
+    uplinkBandIds_.reserve( numberOfRecords );
+    referenceBandIds_.reserve( numberOfRecords );
+    validities_.reserve( numberOfRecords );
+    receiverChannels_.reserve( numberOfRecords );
+    spacecraftIds_.reserve( numberOfRecords );
+    receiverExciterFlags_.reserve( numberOfRecords );
+    referenceFrequencies_.reserve( numberOfRecords );
+    compressionTimes_.reserve( numberOfRecords );
+    transmittingStationUplinkDelays_.reserve( numberOfRecords );
+
+    // Read file until summary or EOF header is found
+    std::size_t currentRecordIndex = 5;
+    for ( int currentRampStation = -1, currentBlockType = 109; ; )
+    {
+        const unsigned char* currentRecord = getRecord( currentRecordIndex++ );
+
+        // If block is header
+        if ( isOdfHeaderRecord( currentRecord ) )
+        {
+            parseOdfHeaderRecord( currentRecord, primaryKey, secondaryKey, logicalRecordLength, groupStartPacketNumber );
+            currentBlockType = primaryKey;
+
+            // Ramp group header
+            if ( primaryKey == 2030 )
+            {
+                if( secondaryKey > 99 || logicalRecordLength != 1 )
+                {
+                    throw std::runtime_error( "Error when reading ODF file, ramp header invalid: primary key " +
+                    std::to_string( primaryKey ) + ", secondary key " + std::to_string( secondaryKey ) +
+                    ", logical record length " + std::to_string( logicalRecordLength ) + "." );
+                }
+                currentRampStation = secondaryKey;
+            }
+            // Clock offset header
+            else if ( primaryKey == 2040 )
+            {
+                if( secondaryKey != 0 || logicalRecordLength != 1 )
+                {
+                    throw std::runtime_error( "Error when reading ODF file, clock offset header invalid: primary key " +
+                    std::to_string( primaryKey ) + ", secondary key " + std::to_string( secondaryKey ) +
+                    ", logical record length " + std::to_string( logicalRecordLength ) + "." );
+                }
+            }
+            // Summary or EOF file header: exit loop
+            else
+            {
+                break;
+            }
+        }
+        // If not a header, decode associated record
+        else if ( currentBlockType == 109 )
+        {
+            addOrbitDataRecord( currentRecord );
+        }
+        else if ( currentBlockType == 2030 )
+        {
+            addRampRecord( currentRecord, currentRampStation );
+        }
+        else if ( currentBlockType == 2040 )
+        {
+            addClockOffsetRecord( currentRecord );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when reading ODF group, invalid block type." );
+        }
+    }
+
+    // Ignore summary data, consistent with OdfRawFileContents
+    if ( primaryKey == 105 )
+    {
+        getRecord( currentRecordIndex + 1 );
+    }
+
+    // EOF group
+    if ( primaryKey == -1 )
+    {
+        if( secondaryKey != 0 || logicalRecordLength != 0 )
+        {
+            throw std::runtime_error( "Error when reading ODF file, EOF header invalid: primary key " +
+            std::to_string( primaryKey ) + ", secondary key " + std::to_string( secondaryKey ) + ", logical record length " +
+            std::to_string( logicalRecordLength ) + "." );
+        }
+        eofHeaderFound_ = true;
+    }
+    else
+    {
+        eofHeaderFound_ = false;
+    }
+}
+
+std::vector< std::shared_ptr< OdfColumnarFileContents > > readOdfFilesColumnar(
+        const std::vector< std::string >& fileNames,
+        const unsigned int numberOfThreads )
+{
+    std::vector< std::shared_ptr< OdfColumnarFileContents > > odfFileContents( fileNames.size( ) );
+    utilities::executeTasksInParallel(
+                fileNames.size( ),
+                std::max( 1u, std::min( numberOfThreads, static_cast< unsigned int >( fileNames.size( ) ) ) ),
+                [ & ]( const unsigned int fileIndex, const unsigned int )
+    {
+        odfFileContents.at( fileIndex ) = std::make_shared< OdfColumnarFileContents >( fileNames.at( fileIndex ) );
+    } );
+    return odfFileContents;
+}
+
 } // namespace input_output
 
 } // namespace tudat
@@ -0,0 +1,934 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+#include "tudat/io/spiceKernelReader.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Size (in bytes) of a single record of a DAF file
+static const std::size_t dafRecordSize = 1024;
+
+//! Maximum number of states used for a single Hermite interpolation (SPK type 13)
+static const int maximumHermiteWindowSize = 32;
+
+//! Maximum dimension of the difference arrays (SPK type 21; fixed to 15 for SPK type 1)
+static const int maximumDifferenceLineDimension = 64;
+
+//! Function to retrieve the NAIF integer code of an inertial frame supported by the native SPICE kernel reader
+int getSpiceInertialFrameId( const std::string& frameName )
+{
+    if( frameName == "J2000" )
+    {
+        return spiceJ2000FrameId;
+    }
+    else if( frameName == "ECLIPJ2000" )
+    {
+        return spiceEclipJ2000FrameId;
+    }
+    else
+    {
+        throw std::runtime_error( "Error, frame " + frameName + " not supported by native SPICE kernel reader, "
+                                  "only J2000 and ECLIPJ2000 are supported." );
+    }
+}
+
+//! Function to retrieve the rotation matrix from the J2000 frame to an inertial frame supported by the native reader
+Eigen::Matrix3d getRotationFromJ2000ToSpiceInertialFrame( const int frameId )
+{
+    if( frameId == spiceJ2000FrameId )
+    {
+        return Eigen::Matrix3d::Identity( );
+    }
+    else if( frameId == spiceEclipJ2000FrameId )
+    {
+        // IAU 1976 obliquity of the ecliptic at J2000 (84381.448 arcseconds)
+        static const double obliquity = 84381.448 / 3600.0 * mathematical_constants::PI / 180.0;
+        static const Eigen::Matrix3d rotationMatrix = ( Eigen::Matrix3d( ) <<
+                1.0, 0.0, 0.0,
+                0.0, std::cos( obliquity ), std::sin( obliquity ),
+                0.0, -std::sin( obliquity ), std::cos( obliquity ) ).finished( );
+        return rotationMatrix;
+    }
+    else
+    {
+        throw std::runtime_error( "Error, frame with NAIF code " + std::to_string( frameId ) +
+                                  " not supported by native SPICE kernel reader, only J2000 and ECLIPJ2000 are "
+                                  "supported." );
+    }
+}
+
+//! Function to compute the rotation matrix about a single axis, and its derivative w.r.t. the angle
+/*!
+ *  Function to compute the rotation matrix about a single axis (1 or 3), as a frame rotation (SPICE convention), and
+ *  its derivative w.r.t. the angle
+ */
+void computeFrameRotationMatrix( const double angle, const int axis,
+                                 Eigen::Matrix3d& rotationMatrix, Eigen::Matrix3d& rotationMatrixPartial )
+{
+    double cosine = std::cos( angle );
+    double sine = std::sin( angle );
+    if( axis == 1 )
+    {
+        rotationMatrix << 1.0, 0.0, 0.0,
+                0.0, cosine, sine,
+                0.0, -sine, cosine;
+        rotationMatrixPartial << 0.0, 0.0, 0.0,
+                0.0, -sine, cosine,
+                0.0, -cosine, -sine;
+    }
+    else
+    {
+        rotationMatrix << cosine, sine, 0.0,
+                -sine, cosine, 0.0,
+                0.0, 0.0, 1.0;
+        rotationMatrixPartial << -sine, cosine, 0.0,
+                -cosine, -sine, 0.0,
+                0.0, 0.0, 0.0;
+    }
+}
+
+//! Function to evaluate a Chebyshev series and its derivative, using the recurrence of the SPICE CHBINT routine
+inline void evaluateChebyshevSeries( const double* coefficients, const int numberOfCoefficients,
+                                     const double normalizedTime, double& value, double& derivative )
+{
+    double w0 = 0.0, w1 = 0.0, w2 = 0.0;
+    double dw0 = 0.0, dw1 = 0.0, dw2 = 0.0;
+    double twiceNormalizedTime = 2.0 * normalizedTime;
+    for( int j = numberOfCoefficients - 1; j > 0; j-- )
+    {
+        w2 = w1;
+        w1 = w0;
+        w0 = coefficients[ j ] + ( twiceNormalizedTime * w1 - w2 );
+
+        dw2 = dw1;
+        dw1 = dw0;
+        dw0 = w1 * 2.0 + twiceNormalizedTime * dw1 - dw2;
+    }
+    value = coefficients[ 0 ] + ( normalizedTime * w0 - w1 );
+    derivative = w0 + normalizedTime * dw0 - dw1;
+}
+
+//! Function to evaluate a Chebyshev series, using the recurrence of the SPICE CHBVAL routine
+inline double evaluateChebyshevSeries( const double* coefficients, const int numberOfCoefficients,
+                                       const double normalizedTime )
+{
+    double w0 = 0.0, w1 = 0.0, w2 = 0.0;
+    double twiceNormalizedTime = 2.0 * normalizedTime;
+    for( int j = numberOfCoefficients - 1; j > 0; j-- )
+    {
+        w2 = w1;
+        w1 = w0;
+        w0 = coefficients[ j ] + ( twiceNormalizedTime * w1 - w2 );
+    }
+    return coefficients[ 0 ] + ( normalizedTime * w0 - w1 );
+}
+
+//! Function to evaluate a Hermite interpolating polynomial and its derivative, using the scheme of the SPICE HRMINT routine
+/*!
+ *  Function to evaluate a Hermite interpolating polynomial and its derivative, using the scheme of the SPICE HRMINT
+ *  routine
+ *  \param numberOfPoints Number of data points
+ *  \param abscissae Independent variable values at the data points
+ *  \param valuesAndDerivatives Function values and derivatives, interleaved, at the data points (modified on output)
+ *  \param derivativeWork Work array of the same size as valuesAndDerivatives
+ *  \param evaluationPoint Value of the independent variable at which the polynomial is to be evaluated
+ *  \param value Interpolated function value (returned by reference)
+ *  \param derivative Interpolated function derivative (returned by reference)
+ */
+void evaluateHermitePolynomial( const int numberOfPoints, const double* abscissae, double* valuesAndDerivatives,
+                                double* derivativeWork, const double evaluationPoint,
+                                double& value, double& derivative )
+{
+    double* work1 = valuesAndDerivatives;
+    double* work2 = derivativeWork;
+
+    // Compute the first-degree interpolants, and their derivatives
+    for( int i = 0; i < numberOfPoints - 1; i++ )
+    {
+        double c1 = abscissae[ i + 1 ] - evaluationPoint;
+        double c2 = evaluationPoint - abscissae[ i ];
+        double denominator = abscissae[ i + 1 ] - abscissae[ i ];
+
+        int previous = 2 * i;
+        int current = previous + 1;
+        int next = current + 1;
+
+        work2[ previous ] = work1[ current ];
+        work2[ current ] = ( work1[ next ] - work1[ previous ] ) / denominator;
+
+        double temporary = work1[ current ] * ( evaluationPoint - abscissae[ i ] ) + work1[ previous ];
+        work1[ current ] = ( c1 * work1[ previous ] + c2 * work1[ next ] ) / denominator;
+        work1[ previous ] = temporary;
+    }
+    work2[ 2 * numberOfPoints - 2 ] = work1[ 2 * numberOfPoints - 1 ];
+    work1[ 2 * numberOfPoints - 2 ] = work1[ 2 * numberOfPoints - 1 ] *
+            ( evaluationPoint - abscissae[ numberOfPoints - 1 ] ) + work1[ 2 * numberOfPoints - 2 ];
+
+    // Compute the higher-degree interpolants, where each abscissa has multiplicity two
+    for( int j = 2; j <= 2 * numberOfPoints - 1; j++ )
+    {
+        for( int i = 1; i <= 2 * numberOfPoints - j; i++ )
+        {
+            int lowerIndex = ( i + 1 ) / 2 - 1;
+            int upperIndex = ( i + j + 1 ) / 2 - 1;
+
+            double c1 = abscissae[ upperIndex ] - evaluationPoint;
+            double c2 = evaluationPoint - abscissae[ lowerIndex ];
+            double denominator = abscissae[ upperIndex ] - abscissae[ lowerIndex ];
+
+            work2[ i - 1 ] = ( c1 * work2[ i - 1 ] + c2 * work2[ i ] + ( work1[ i ] - work1[ i - 1 ] ) ) / denominator;
+            work1[ i - 1 ] = ( c1 * work1[ i - 1 ] + c2 * work1[ i ] ) / denominator;
+        }
+    }
+
+    value = work1[ 0 ];
+    derivative = work2[ 0 ];
+}
+
+//! Function to check whether the number of data items in a segment is consistent with its meta-data
+void checkSegmentSize( const int segmentSize, const int sizeWithoutDirectory, const int numberOfEpochs,
+                       const std::string& fileName, const int bodyId, const int dataType )
+{
+    if( segmentSize != sizeWithoutDirectory + numberOfEpochs / 100 &&
+            segmentSize != sizeWithoutDirectory + ( numberOfEpochs - 1 ) / 100 )
+    {
+        throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", size of type " +
+                                  std::to_string( dataType ) + " segment for body " + std::to_string( bodyId ) +
+                                  " is inconsistent with its meta-data." );
+    }
+}
+
+//! Constructor
+SpiceKernelSegment::SpiceKernelSegment( const char* fileData,
+                                        const std::string& fileName,
+                                        const bool isOrientationSegment,
+                                        const int bodyId,
+                                        const int centerId,
+                                        const int frameId,
+                                        const int dataType,
+                                        const double startEpoch,
+                                        const double endEpoch,
+                                        const int initialAddress,
+                                        const int finalAddress ):
+    segmentData_( reinterpret_cast< const double* >( fileData ) + ( initialAddress - 1 ) ),
+    isOrientationSegment_( isOrientationSegment ), bodyId_( bodyId ), centerId_( centerId ), frameId_( frameId ),
+    dataType_( dataType ), startEpoch_( startEpoch ), endEpoch_( endEpoch ),
+    numberOfRecords_( 0 ), initialRecordEpoch_( 0.0 ), recordIntervalLength_( 0.0 ), recordSize_( 0 ),
+    numberOfCoefficients_( 0 ), windowSize_( 0 ), maximumDifferenceLineDimension_( 0 ), epochs_( nullptr )
+{
+    const int segmentSize = finalAddress - initialAddress + 1;
+    const double* segmentEnd = segmentData_ + segmentSize;
+
+    if( isOrientationSegment && dataType != 2 )
+    {
+        throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", binary PCK segment type " +
+                                  std::to_string( dataType ) + " not supported by native reader." );
+    }
+
+    switch( dataType )
+    {
+    case 2:
+    case 3:
+    {
+        if( segmentSize < 4 )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", segment is truncated." );
+        }
+        initialRecordEpoch_ = segmentEnd[ -4 ];
+        recordIntervalLength_ = segmentEnd[ -3 ];
+        recordSize_ = static_cast< int >( segmentEnd[ -2 ] );
+        numberOfRecords_ = static_cast< int >( segmentEnd[ -1 ] );
+
+        int numberOfComponents = ( dataType == 2 ) ? 3 : 6;
+        numberOfCoefficients_ = ( recordSize_ - 2 ) / numberOfComponents;
+        if( numberOfRecords_ < 1 || recordIntervalLength_ <= 0.0 ||
+                recordSize_ != numberOfComponents * numberOfCoefficients_ + 2 || numberOfCoefficients_ < 1 ||
+                segmentSize != numberOfRecords_ * recordSize_ + 4 )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", size of type " +
+                                      std::to_string( dataType ) + " segment for body " + std::to_string( bodyId ) +
+                                      " is inconsistent with its meta-data." );
+        }
+        break;
+    }
+    case 13:
+    {
+        if( segmentSize < 2 )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", segment is truncated." );
+        }
+        windowSize_ = static_cast< int >( segmentEnd[ -2 ] ) + 1;
+        numberOfRecords_ = static_cast< int >( segmentEnd[ -1 ] );
+        if( numberOfRecords_ < 1 || windowSize_ < 1 )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", invalid type 13 segment for "
+                                      "body " + std::to_string( bodyId ) + "." );
+        }
+        checkSegmentSize( segmentSize, 7 * numberOfRecords_ + 2, numberOfRecords_, fileName, bodyId, dataType );
+
+        windowSize_ = std::min( windowSize_, numberOfRecords_ );
+        if( windowSize_ > maximumHermiteWindowSize )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", window size of type 13 "
+                                      "segment for body " + std::to_string( bodyId ) + " is not supported." );
+        }
+        epochs_ = segmentData_ + 6 * numberOfRecords_;
+        break;
+    }
+    case 1:
+    {
+        if( segmentSize < 1 )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", segment is truncated." );
+        }
+        maximumDifferenceLineDimension_ = 15;
+        numberOfRecords_ = static_cast< int >( segmentEnd[ -1 ] );
+        recordSize_ = 4 * maximumDifferenceLineDimension_ + 11;
+        if( numberOfRecords_ < 1 )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", invalid type 1 segment for "
+                                      "body " + std::to_string( bodyId ) + "." );
+        }
+        checkSegmentSize( segmentSize, ( recordSize_ + 1 ) * numberOfRecords_ + 1, numberOfRecords_,
+                          fileName, bodyId, dataType );
+        epochs_ = segmentData_ + recordSize_ * numberOfRecords_;
+        break;
+    }
+    case 21:
+    {
+        if( segmentSize < 2 )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", segment is truncated." );
+        }
+        maximumDifferenceLineDimension_ = static_cast< int >( segmentEnd[ -2 ] );
+        numberOfRecords_ = static_cast< int >( segmentEnd[ -1 ] );
+        recordSize_ = 4 * maximumDifferenceLineDimension_ + 11;
+        if( numberOfRecords_ < 1 || maximumDifferenceLineDimension_ < 1 ||
+                maximumDifferenceLineDimension_ > maximumDifferenceLineDimension )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", invalid type 21 segment for "
+                                      "body " + std::to_string( bodyId ) + "." );
+        }
+        checkSegmentSize( segmentSize, ( recordSize_ + 1 ) * numberOfRecords_ + 2, numberOfRecords_,
+                          fileName, bodyId, dataType );
+        epochs_ = segmentData_ + recordSize_ * numberOfRecords_;
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", SPK segment type " +
+                                  std::to_string( dataType ) + " not supported by native reader." );
+    }
+}
+
+//! Function to evaluate the segment at a given epoch
+void SpiceKernelSegment::evaluate( const double ephemerisTime, double* result ) const
+{
+    switch( dataType_ )
+    {
+    case 2:
+    case 3:
+        evaluateChebyshevSegment( ephemerisTime, result );
+        break;
+    case 13:
+        evaluateHermiteSegment( ephemerisTime, result );
+        break;
+    case 1:
+    case 21:
+        evaluateDifferenceLineSegment( ephemerisTime, result );
+        break;
+    default:
+        throw std::runtime_error( "Error, SPICE kernel segment type " + std::to_string( dataType_ ) + " not supported." );
+    }
+}
+
+//! Function to evaluate a Chebyshev segment (SPK type 2 or 3, PCK type 2)
+void SpiceKernelSegment::evaluateChebyshevSegment( const double ephemerisTime, double* result ) const
+{
+    // Find record covering the requested epoch
+    int recordIndex = static_cast< int >( std::floor( ( ephemerisTime - initialRecordEpoch_ ) / recordIntervalLength_ ) );
+    recordIndex = std::max( 0, std::min( recordIndex, numberOfRecords_ - 1 ) );
+    const double* record = segmentData_ + recordIndex * recordSize_;
+
+    const double radius = record[ 1 ];
+    const double normalizedTime = ( ephemerisTime - record[ 0 ] ) / radius;
+    const double* coefficients = record + 2;
+
+    if( dataType_ == 2 )
+    {
+        for( int i = 0; i < 3; i++ )
+        {
+            double derivative;
+            evaluateChebyshevSeries(
+                        coefficients + i * numberOfCoefficients_, numberOfCoefficients_, normalizedTime,
+                        result[ i ], derivative );
+            result[ i + 3 ] = derivative / radius;
+        }
+    }
+    else
+    {
+        for( int i = 0; i < 6; i++ )
+        {
+            result[ i ] = evaluateChebyshevSeries(
+                        coefficients + i * numberOfCoefficients_, numberOfCoefficients_, normalizedTime );
+        }
+    }
+
+    // Reduce rotation angle, as is done by SPICE
+    if( isOrientationSegment_ )
+    {
+        result[ 2 ] = std::fmod( result[ 2 ], 2.0 * mathematical_constants::PI );
+    }
+}
+
+//! Function to evaluate a Hermite interpolation segment (SPK type 13)
+void SpiceKernelSegment::evaluateHermiteSegment( const double ephemerisTime, double* result ) const
+{
+    // Select the states used for interpolation, centered on the requested epoch
+    int firstIndex;
+    int lowerIndex = static_cast< int >(
+                std::upper_bound( epochs_, epochs_ + numberOfRecords_, ephemerisTime ) - epochs_ ) - 1;
+    if( windowSize_ % 2 == 0 )
+    {
+        firstIndex = lowerIndex - windowSize_ / 2 + 1;
+    }
+    else
+    {
+        int nearestIndex = lowerIndex;
+        if( lowerIndex < 0 || ( lowerIndex < numberOfRecords_ - 1 &&
+                                epochs_[ lowerIndex + 1 ] - ephemerisTime < ephemerisTime - epochs_[ lowerIndex ] ) )
+        {
+            nearestIndex++;
+        }
+        firstIndex = nearestIndex - ( windowSize_ - 1 ) / 2;
+    }
+    firstIndex = std::max( 0, std::min( firstIndex, numberOfRecords_ - windowSize_ ) );
+
+    // Interpolate each position component, using the velocity component as derivative
+    double valuesAndDerivatives[ 2 * maximumHermiteWindowSize ];
+    double derivativeWork[ 2 * maximumHermiteWindowSize ];
+    for( int i = 0; i < 3; i++ )
+    {
+        for( int j = 0; j < windowSize_; j++ )
+        {
+            const double* currentState = segmentData_ + 6 * ( firstIndex + j );
+            valuesAndDerivatives[ 2 * j ] = currentState[ i ];
+            valuesAndDerivatives[ 2 * j + 1 ] = currentState[ i + 3 ];
+        }
+        evaluateHermitePolynomial( windowSize_, epochs_ + firstIndex, valuesAndDerivatives, derivativeWork,
+                                   ephemerisTime, result[ i ], result[ i + 3 ] );
+    }
+}
+
+//! Function to evaluate a (extended) modified difference array segment (SPK type 1 or 21)
+void SpiceKernelSegment::evaluateDifferenceLineSegment( const double ephemerisTime, double* result ) const
+{
+    // Find first record with final epoch at or after the requested epoch
+    int recordIndex = static_cast< int >(
+                std::lower_bound( epochs_, epochs_ + numberOfRecords_, ephemerisTime ) - epochs_ );
+    recordIndex = std::min( recordIndex, numberOfRecords_ - 1 );
+    const double* record = segmentData_ + recordIndex * recordSize_;
+
+    // Unpack the difference line: reference epoch, step size function vector, reference position and velocity
+    // (interleaved), modified divided difference arrays, maximum integration order plus one, and integration orders
+    const int maximumDimension = maximumDifferenceLineDimension_;
+    const double referenceEpoch = record[ 0 ];
+    const double* stepSizes = record + 1;
+    const double* referenceStates = record + maximumDimension + 1;
+    const double* differences = record + maximumDimension + 7;
+    const int maximumOrderPlusOne = static_cast< int >( record[ 4 * maximumDimension + 7 ] );
+    int integrationOrders[ 3 ];
+    for( int i = 0; i < 3; i++ )
+    {
+        integrationOrders[ i ] = static_cast< int >( record[ 4 * maximumDimension + 8 + i ] );
+    }
+
+    if( maximumOrderPlusOne > maximumDimension + 1 || maximumOrderPlusOne < 2 )
+    {
+        throw std::runtime_error( "Error when evaluating type " + std::to_string( dataType_ ) + " SPICE kernel segment "
+                                  "for body " + std::to_string( bodyId_ ) + ", invalid integration order." );
+    }
+
+    // Compute coefficients of the difference arrays, following the SPICE SPKE21 routine (with one-based indices)
+    double fc[ maximumDifferenceLineDimension + 2 ];
+    double wc[ maximumDifferenceLineDimension + 2 ];
+    double w[ maximumDifferenceLineDimension + 4 ];
+
+    const double delta = ephemerisTime - referenceEpoch;
+    double tp = delta;
+    const int mq2 = maximumOrderPlusOne - 2;
+    int ks = maximumOrderPlusOne - 1;
+
+    fc[ 1 ] = 1.0;
+    for( int j = 1; j <= mq2; j++ )
+    {
+        if( stepSizes[ j - 1 ] == 0.0 )
+        {
+            throw std::runtime_error( "Error when evaluating type " + std::to_string( dataType_ ) + " SPICE kernel "
+                                      "segment for body " + std::to_string( bodyId_ ) + ", step size is zero." );
+        }
+        fc[ j + 1 ] = tp / stepSizes[ j - 1 ];
+        wc[ j ] = delta / stepSizes[ j - 1 ];
+        tp = delta + stepSizes[ j - 1 ];
+    }
+
+    for( int j = 1; j <= maximumOrderPlusOne; j++ )
+    {
+        w[ j ] = 1.0 / static_cast< double >( j );
+    }
+
+    int jx = 0;
+    int ks1 = ks - 1;
+    while( ks >= 2 )
+    {
+        jx++;
+        for( int j = 1; j <= jx; j++ )
+        {
+            w[ j + ks ] = fc[ j + 1 ] * w[ j + ks1 ] - wc[ j ] * w[ j + ks ];
+        }
+        ks = ks1;
+        ks1--;
+    }
+
+    // Compute position
+    for( int i = 0; i < 3; i++ )
+    {
+        double sum = 0.0;
+        for( int j = integrationOrders[ i ]; j >= 1; j-- )
+        {
+            sum += differences[ i * maximumDimension + j - 1 ] * w[ j + ks ];
+        }
+        result[ i ] = referenceStates[ 2 * i ] + delta * ( referenceStates[ 2 * i + 1 ] + delta * sum );
+    }
+
+    // Compute velocity
+    for( int j = 1; j <= jx; j++ )
+    {
+        w[ j + ks ] = fc[ j + 1 ] * w[ j + ks1 ] - wc[ j ] * w[ j + ks ];
+    }
+    ks--;
+
+    for( int i = 0; i < 3; i++ )
+    {
+        double sum = 0.0;
+        for( int j = integrationOrders[ i ]; j >= 1; j-- )
+        {
+            sum += differences[ i * maximumDimension + j - 1 ] * w[ j + ks ];
+        }
+        result[ i + 3 ] = referenceStates[ 2 * i + 1 ] + delta * sum;
+    }
+}
+
+//! Constructor, maps the file into memory and parses its segment descriptors
+SpiceKernelFile::SpiceKernelFile( const std::string& fileName ):
+    file_( std::make_shared< MemoryMappedFile >( fileName ) )
+{
+    const char* fileData = file_->getData( );
+    const std::size_t fileSize = file_->getSize( );
+
+    if( fileSize < dafRecordSize )
+    {
+        throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", file is too small." );
+    }
+
+    std::string fileIdentifier( fileData, 8 );
+    if( fileIdentifier.substr( 0, 4 ) != "DAF/" && fileIdentifier != "NAIF/DAF" )
+    {
+        throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", file is not a binary DAF (SPK or "
+                                  "binary PCK) file." );
+    }
+
+    // Check if file is stored in the binary format of this machine
+    const uint16_t endiannessTest = 1;
+    const bool isLittleEndianMachine = ( *reinterpret_cast< const unsigned char* >( &endiannessTest ) == 1 );
+    std::string binaryFormat( fileData + 88, 8 );
+    if( ( binaryFormat == "LTL-IEEE" && !isLittleEndianMachine ) ||
+            ( binaryFormat == "BIG-IEEE" && isLittleEndianMachine ) )
+    {
+        throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", file binary format " + binaryFormat +
+                                  " is not native to this machine; convert the file before use." );
+    }
+
+    int32_t numberOfDoubleComponents, numberOfIntegerComponents, firstSummaryRecord;
+    std::memcpy( &numberOfDoubleComponents, fileData + 8, 4 );
+    std::memcpy( &numberOfIntegerComponents, fileData + 12, 4 );
+    std::memcpy( &firstSummaryRecord, fileData + 76, 4 );
+
+    if( numberOfDoubleComponents != 2 || ( numberOfIntegerComponents != 5 && numberOfIntegerComponents != 6 ) )
+    {
+        throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", file is not an SPK or binary PCK "
+                                  "file." );
+    }
+    isOrientationKernel_ = ( numberOfIntegerComponents == 5 );
+
+    const int summarySize = numberOfDoubleComponents + ( numberOfIntegerComponents + 1 ) / 2;
+    const std::size_t numberOfAddresses = fileSize / sizeof( double );
+
+    // Parse linked list of summary records
+    int currentRecord = firstSummaryRecord;
+    int numberOfParsedRecords = 0;
+    while( currentRecord > 0 )
+    {
+        if( static_cast< std::size_t >( currentRecord ) * dafRecordSize > fileSize ||
+                numberOfParsedRecords > static_cast< int >( fileSize / dafRecordSize ) )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", summary record is corrupt." );
+        }
+
+        const char* summaryRecord = fileData + ( currentRecord - 1 ) * dafRecordSize;
+        double recordControl[ 3 ];
+        std::memcpy( recordControl, summaryRecord, 3 * sizeof( double ) );
+        int numberOfSummaries = static_cast< int >( recordControl[ 2 ] );
+        if( numberOfSummaries < 0 || ( 3 + numberOfSummaries * summarySize ) * sizeof( double ) > dafRecordSize )
+        {
+            throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", summary record is corrupt." );
+        }
+
+        for( int i = 0; i < numberOfSummaries; i++ )
+        {
+            const char* summary = summaryRecord + ( 3 + i * summarySize ) * sizeof( double );
+            double epochs[ 2 ];
+            int32_t integers[ 6 ];
+            std::memcpy( epochs, summary, 2 * sizeof( double ) );
+            std::memcpy( integers, summary + 2 * sizeof( double ), numberOfIntegerComponents * sizeof( int32_t ) );
+
+            int initialAddress = integers[ numberOfIntegerComponents - 2 ];
+            int finalAddress = integers[ numberOfIntegerComponents - 1 ];
+            if( initialAddress < 1 || finalAddress < initialAddress ||
+                    static_cast< std::size_t >( finalAddress ) > numberOfAddresses )
+            {
+                throw std::runtime_error( "Error when reading SPICE kernel " + fileName + ", segment addresses are "
+                                          "outside of file." );
+            }
+
+            if( isOrientationKernel_ )
+            {
+                segments_.push_back( SpiceKernelSegment(
+                                         fileData, fileName, true, integers[ 0 ], 0, integers[ 1 ], integers[ 2 ],
+                                     epochs[ 0 ], epochs[ 1 ], initialAddress, finalAddress ) );
+            }
+            else
+            {
+                segments_.push_back( SpiceKernelSegment(
+                                         fileData, fileName, false, integers[ 0 ], integers[ 1 ], integers[ 2 ],
+                                     integers[ 3 ], epochs[ 0 ], epochs[ 1 ], initialAddress, finalAddress ) );
+            }
+        }
+
+        currentRecord = static_cast< int >( recordControl[ 0 ] );
+        numberOfParsedRecords++;
+    }
+}
+
+//! Constructor
+SpiceKernelSegmentCoverage::SpiceKernelSegmentCoverage( const std::vector< const SpiceKernelSegment* >& segmentsByPriority )
+{
+    // Create list of segment start and end events, sorted by epoch
+    std::vector< std::pair< double, int > > startEvents, endEvents;
+    std::vector< double > boundaries;
+    for( unsigned int i = 0; i < segmentsByPriority.size( ); i++ )
+    {
+        if( segmentsByPriority.at( i )->getEndEpoch( ) > segmentsByPriority.at( i )->getStartEpoch( ) )
+        {
+            startEvents.push_back( std::make_pair( segmentsByPriority.at( i )->getStartEpoch( ), i ) );
+            endEvents.push_back( std::make_pair( segmentsByPriority.at( i )->getEndEpoch( ), i ) );
+            boundaries.push_back( segmentsByPriority.at( i )->getStartEpoch( ) );
+            boundaries.push_back( segmentsByPriority.at( i )->getEndEpoch( ) );
+        }
+    }
+    std::sort( startEvents.begin( ), startEvents.end( ) );
+    std::sort( endEvents.begin( ), endEvents.end( ) );
+    std::sort( boundaries.begin( ), boundaries.end( ) );
+    boundaries.erase( std::unique( boundaries.begin( ), boundaries.end( ) ), boundaries.end( ) );
+
+    // Sweep over all boundaries, keeping track of segments that cover the current interval, and store the one with
+    // the highest priority (merging adjacent intervals with identical segments)
+    std::set< int > activeSegments;
+    unsigned int startIndex = 0, endIndex = 0;
+    for( unsigned int i = 0; i + 1 < boundaries.size( ); i++ )
+    {
+        while( startIndex < startEvents.size( ) && startEvents.at( startIndex ).first <= boundaries.at( i ) )
+        {
+            activeSegments.insert( startEvents.at( startIndex ).second );
+            startIndex++;
+        }
+        while( endIndex < endEvents.size( ) && endEvents.at( endIndex ).first <= boundaries.at( i ) )
+        {
+            activeSegments.erase( endEvents.at( endIndex ).second );
+            endIndex++;
+        }
+
+        int currentPriority = activeSegments.empty( ) ? -1 : *activeSegments.begin( );
+        if( intervalPriorities_.empty( ) || intervalPriorities_.back( ) != currentPriority )
+        {
+            intervalBoundaries_.push_back( boundaries.at( i ) );
+            intervalPriorities_.push_back( currentPriority );
+            intervalSegments_.push_back( currentPriority < 0 ? nullptr : segmentsByPriority.at( currentPriority ) );
+        }
+    }
+    if( boundaries.size( ) > 0 )
+    {
+        intervalBoundaries_.push_back( boundaries.back( ) );
+    }
+}
+
+//! Function to retrieve the segment to be used at a given epoch
+const SpiceKernelSegment* SpiceKernelSegmentCoverage::findSegment( const double ephemerisTime ) const
+{
+    if( intervalSegments_.empty( ) || !( ephemerisTime >= intervalBoundaries_.front( ) ) ||
+            ephemerisTime > intervalBoundaries_.back( ) )
+    {
+        return nullptr;
+    }
+
+    int intervalIndex = static_cast< int >(
+                std::upper_bound( intervalBoundaries_.begin( ), intervalBoundaries_.end( ), ephemerisTime ) -
+                intervalBoundaries_.begin( ) ) - 1;
+    intervalIndex = std::min( intervalIndex, static_cast< int >( intervalSegments_.size( ) ) - 1 );
+
+    // At a boundary between intervals, the segment of the preceding interval also covers the epoch
+    if( intervalIndex > 0 && ephemerisTime == intervalBoundaries_.at( intervalIndex ) &&
+            intervalPriorities_.at( intervalIndex - 1 ) >= 0 &&
+            ( intervalPriorities_.at( intervalIndex ) < 0 ||
+              intervalPriorities_.at( intervalIndex - 1 ) < intervalPriorities_.at( intervalIndex ) ) )
+    {
+        intervalIndex--;
+    }
+    return intervalSegments_.at( intervalIndex );
+}
+
+//! Constructor, maps the kernel files into memory and indexes their segments
+SpiceKernelCollection::SpiceKernelCollection( const std::vector< std::string >& fileNames ):
+    rotationFromEclipticToJ2000_( getRotationFromJ2000ToSpiceInertialFrame( spiceEclipJ2000FrameId ).transpose( ) )
+{
+    // Collect segments per body, in order of decreasing priority
+    std::map< int, std::vector< const SpiceKernelSegment* > > ephemerisSegments, orientationSegments;
+    for( unsigned int i = 0; i < fileNames.size( ); i++ )
+    {
+        kernelFiles_.push_back( std::make_shared< SpiceKernelFile >( fileNames.at( i ) ) );
+    }
+    for( int i = static_cast< int >( kernelFiles_.size( ) ) - 1; i >= 0; i-- )
+    {
+        const std::vector< SpiceKernelSegment >& segments = kernelFiles_.at( i )->getSegments( );
+        for( int j = static_cast< int >( segments.size( ) ) - 1; j >= 0; j-- )
+        {
+            if( segments.at( j ).isOrientationSegment( ) )
+            {
+                orientationSegments[ segments.at( j ).getBodyId( ) ].push_back( &segments.at( j ) );
+            }
+            else
+            {
+                ephemerisSegments[ segments.at( j ).getBodyId( ) ].push_back( &segments.at( j ) );
+            }
+        }
+    }
+
+    for( auto segmentIterator : ephemerisSegments )
+    {
+        ephemerisCoverage_.emplace( segmentIterator.first, SpiceKernelSegmentCoverage( segmentIterator.second ) );
+    }
+    for( auto segmentIterator : orientationSegments )
+    {
+        orientationCoverage_.emplace( segmentIterator.first, SpiceKernelSegmentCoverage( segmentIterator.second ) );
+    }
+}
+
+//! Function to find the ephemeris segment to be used for a body at a given epoch, throwing an error if none exists
+const SpiceKernelSegment* SpiceKernelCollection::findEphemerisSegment(
+        const int bodyId, const double ephemerisTime ) const
+{
+    auto coverageIterator = ephemerisCoverage_.find( bodyId );
+    const SpiceKernelSegment* segment =
+            ( coverageIterator == ephemerisCoverage_.end( ) ) ? nullptr :
+                                                               coverageIterator->second.findSegment( ephemerisTime );
+    return segment;
+}
+
+//! Function to add the state of a segment (rotated to the J2000 frame if needed) to a state
+void SpiceKernelCollection::addSegmentState(
+        const SpiceKernelSegment* segment, const double ephemerisTime, Eigen::Vector6d& state ) const
+{
+    Eigen::Vector6d segmentState;
+    segment->evaluate( ephemerisTime, segmentState.data( ) );
+    if( segment->getFrameId( ) == spiceJ2000FrameId )
+    {
+        state += segmentState;
+    }
+    else if( segment->getFrameId( ) == spiceEclipJ2000FrameId )
+    {
+        state.segment( 0, 3 ) += rotationFromEclipticToJ2000_ * segmentState.segment( 0, 3 );
+        state.segment( 3, 3 ) += rotationFromEclipticToJ2000_ * segmentState.segment( 3, 3 );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when evaluating SPICE kernel segment for body " +
+                                  std::to_string( segment->getBodyId( ) ) + ", segment frame " +
+                                  std::to_string( segment->getFrameId( ) ) + " not supported by native reader." );
+    }
+}
+
+//! Function to compute the Cartesian state of a body w.r.t. another body
+Eigen::Vector6d SpiceKernelCollection::getCartesianState(
+        const int targetId, const int observerId, const double ephemerisTime, const int frameId ) const
+{
+    static const int maximumChainLength = 100;
+
+    Eigen::Vector6d state = Eigen::Vector6d::Zero( );
+    if( targetId == observerId )
+    {
+        return state;
+    }
+
+    // Determine chains of center bodies for target and observer, up to the solar system barycenter or the last body
+    // for which data is available
+    const SpiceKernelSegment* targetSegments[ maximumChainLength ];
+    int targetChain[ maximumChainLength + 1 ];
+    int targetChainLength = 0;
+    targetChain[ 0 ] = targetId;
+    while( targetChainLength < maximumChainLength &&
+           ( targetSegments[ targetChainLength ] = findEphemerisSegment(
+                 targetChain[ targetChainLength ], ephemerisTime ) ) != nullptr )
+    {
+        targetChain[ targetChainLength + 1 ] = targetSegments[ targetChainLength ]->getCenterId( );
+        targetChainLength++;
+    }
+
+    const SpiceKernelSegment* observerSegments[ maximumChainLength ];
+    int observerChain[ maximumChainLength + 1 ];
+    int observerChainLength = 0;
+    observerChain[ 0 ] = observerId;
+    while( observerChainLength < maximumChainLength &&
+           ( observerSegments[ observerChainLength ] = findEphemerisSegment(
+                 observerChain[ observerChainLength ], ephemerisTime ) ) != nullptr )
+    {
+        observerChain[ observerChainLength + 1 ] = observerSegments[ observerChainLength ]->getCenterId( );
+        observerChainLength++;
+    }
+
+    // Find closest common center of target and observer
+    int targetCommonIndex = -1, observerCommonIndex = -1;
+    for( int i = 0; i <= targetChainLength && targetCommonIndex < 0; i++ )
+    {
+        for( int j = 0; j <= observerChainLength; j++ )
+        {
+            if( targetChain[ i ] == observerChain[ j ] )
+            {
+                targetCommonIndex = i;
+                observerCommonIndex = j;
+                break;
+            }
+        }
+    }
+
+    if( targetCommonIndex < 0 )
+    {
+        throw std::runtime_error( "Error when retrieving state of body " + std::to_string( targetId ) + " w.r.t. body " +
+                                  std::to_string( observerId ) + " from native SPICE kernels at t = " +
+                                  std::to_string( ephemerisTime ) + ", insufficient ephemeris data available." );
+    }
+
+    // Sum states along both chains, up to common center
+    for( int i = 0; i < targetCommonIndex; i++ )
+    {
+        addSegmentState( targetSegments[ i ], ephemerisTime, state );
+    }
+    Eigen::Vector6d observerState = Eigen::Vector6d::Zero( );
+    for( int i = 0; i < observerCommonIndex; i++ )
+    {
+        addSegmentState( observerSegments[ i ], ephemerisTime, observerState );
+    }
+    state -= observerState;
+
+    if( frameId != spiceJ2000FrameId )
+    {
+        Eigen::Matrix3d rotationToFrame = getRotationFromJ2000ToSpiceInertialFrame( frameId );
+        state.segment( 0, 3 ) = ( rotationToFrame * state.segment( 0, 3 ) ).eval( );
+        state.segment( 3, 3 ) = ( rotationToFrame * state.segment( 3, 3 ) ).eval( );
+    }
+    return state;
+}
+
+//! Function to compute the orientation of a body-fixed frame, and its time derivative
+void SpiceKernelCollection::getRotationToBodyFixedFrame(
+        const int frameClassId,
+        const double ephemerisTime,
+        Eigen::Matrix3d& rotationToFrame,
+        Eigen::Matrix3d& rotationToFrameDerivative,
+        const int frameId ) const
+{
+    auto coverageIterator = orientationCoverage_.find( frameClassId );
+    const SpiceKernelSegment* segment =
+            ( coverageIterator == orientationCoverage_.end( ) ) ? nullptr :
+                                                                 coverageIterator->second.findSegment( ephemerisTime );
+    if( segment == nullptr )
+    {
+        throw std::runtime_error( "Error when retrieving orientation of frame class " + std::to_string( frameClassId ) +
+                                  " from native SPICE kernels at t = " + std::to_string( ephemerisTime ) +
+                                  ", insufficient orientation data available." );
+    }
+
+    // Evaluate Euler angles (phi, delta, w) and their rates, and compute rotation [w]_3 [delta]_1 [phi]_3
+    double eulerAngles[ 6 ];
+    segment->evaluate( ephemerisTime, eulerAngles );
+
+    Eigen::Matrix3d firstRotation, secondRotation, thirdRotation;
+    Eigen::Matrix3d firstRotationPartial, secondRotationPartial, thirdRotationPartial;
+    computeFrameRotationMatrix( eulerAngles[ 0 ], 3, firstRotation, firstRotationPartial );
+    computeFrameRotationMatrix( eulerAngles[ 1 ], 1, secondRotation, secondRotationPartial );
+    computeFrameRotationMatrix( eulerAngles[ 2 ], 3, thirdRotation, thirdRotationPartial );
+
+    rotationToFrame = thirdRotation * secondRotation * firstRotation;
+    rotationToFrameDerivative =
+            eulerAngles[ 5 ] * thirdRotationPartial * secondRotation * firstRotation +
+            eulerAngles[ 4 ] * thirdRotation * secondRotationPartial * firstRotation +
+            eulerAngles[ 3 ] * thirdRotation * secondRotation * firstRotationPartial;
+
+    // Convert from base frame of segment to requested frame
+    if( segment->getFrameId( ) != frameId )
+    {
+        Eigen::Matrix3d rotationFromFrameToBaseFrame =
+                getRotationFromJ2000ToSpiceInertialFrame( segment->getFrameId( ) ) *
+                getRotationFromJ2000ToSpiceInertialFrame( frameId ).transpose( );
+        rotationToFrame = ( rotationToFrame * rotationFromFrameToBaseFrame ).eval( );
+        rotationToFrameDerivative = ( rotationToFrameDerivative * rotationFromFrameToBaseFrame ).eval( );
+    }
+}
+
+//! Function to retrieve a collection of SPICE kernels, reusing an existing collection for the same list of files
+std::shared_ptr< SpiceKernelCollection > getSpiceKernelCollection( const std::vector< std::string >& fileNames )
+{
+    static std::mutex collectionMutex;
+    static std::map< std::vector< std::string >, std::weak_ptr< SpiceKernelCollection > > existingCollections;
+
+    std::lock_guard< std::mutex > lock( collectionMutex );
+    std::shared_ptr< SpiceKernelCollection > collection = existingCollections[ fileNames ].lock( );
+    if( collection == nullptr )
+    {
+        collection = std::make_shared< SpiceKernelCollection >( fileNames );
+        existingCollections[ fileNames ] = collection;
+    }
+    return collection;
+}
+
+} // namespace input_output
+
+} // namespace tudat
@@ -72,6 +72,24 @@ Eigen::MatrixXd multiplyDesignMatrixByDiagonalWeightMatrix(
     return weightedDesignMatrix;
 }
 
+//! Function to border the inverse covariance matrix with the multiplier of linear constraints
+void addConstraintsToInverseCovarianceMatrix(
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::MatrixXd& constraintMultiplier )
+{
+    int numberOfConstraints = constraintMultiplier.rows( );
+    int numberOfParameters = constraintMultiplier.cols( );
+
+    inverseOfCovarianceMatrix.conservativeResize(
+                numberOfParameters + numberOfConstraints, numberOfParameters + numberOfConstraints );
+    inverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
+           constraintMultiplier;
+    inverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
+           constraintMultiplier.transpose( );
+    inverseOfCovarianceMatrix.block(
+                numberOfParameters, numberOfParameters, numberOfConstraints, numberOfConstraints ).setZero( );
+}
+
 Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         const Eigen::MatrixXd& designMatrix,
         const Eigen::VectorXd& diagonalOfWeightMatrix,
@@ -96,17 +114,7 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
         }
 
-        int numberOfConstraints = constraintMultiplier.rows( );
-        int numberOfParameters = constraintMultiplier.cols( );
-
-        inverseOfCovarianceMatrix.conservativeResize(
-                    numberOfParameters + numberOfConstraints, numberOfParameters + numberOfConstraints );
-        inverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
-               constraintMultiplier;
-        inverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
-               constraintMultiplier.transpose( );
-        inverseOfCovarianceMatrix.block(
-                    numberOfParameters, numberOfParameters, numberOfConstraints, numberOfConstraints ).setZero( );
+        addConstraintsToInverseCovarianceMatrix( inverseOfCovarianceMatrix, constraintMultiplier );
     }
 
     return inverseOfCovarianceMatrix;
@@ -205,6 +213,611 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
                 limitConditionNumberForWarning );
 }
 
+//! Function to add linear constraints to the inverse covariance matrix and right-hand side of the normal equations
+void addConstraintsToNormalEquations(
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    if( constraintMultiplier.rows( ) != constraintRightHandside.rows( ) )
+    {
+        throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
+    }
+
+    if( constraintMultiplier.cols( ) != inverseOfCovarianceMatrix.cols( ) )
+    {
+        throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with normal equations" );
+    }
+
+    int numberOfConstraints = constraintMultiplier.rows( );
+    int numberOfParameters = constraintMultiplier.cols( );
+
+    addConstraintsToInverseCovarianceMatrix( inverseOfCovarianceMatrix, constraintMultiplier );
+    rightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
+    rightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+}
+
+//! Constructor
+NormalEquationsAccumulator::NormalEquationsAccumulator( const int numberOfParameters ):
+    numberOfParameters_( numberOfParameters )
+{
+    if( numberOfParameters_ <= 0 )
+    {
+        throw std::runtime_error( "Error when creating normal equations, number of parameters is 0 or smaller: " +
+                                  std::to_string( numberOfParameters_ ) );
+    }
+    reset( );
+}
+
+//! Function to add the contribution of a block of observations to the normal equations
+void NormalEquationsAccumulator::addObservations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( observationResidualsBlock.rows( ) != designMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of residuals (" +
+                                  std::to_string( observationResidualsBlock.rows( ) ) +
+                                  ") is incompatible with number of partials (" +
+                                  std::to_string( designMatrixBlock.rows( ) ) + ")" );
+    }
+    addObservationPartials( designMatrixBlock, diagonalOfWeightMatrixBlock );
+    rightHandSide_.noalias( ) += designMatrixBlock.transpose( ) *
+            diagonalOfWeightMatrixBlock.cwiseProduct( observationResidualsBlock );
+}
+
+//! Function to add the contribution of a block of observations to the normal matrix only (without residuals)
+void NormalEquationsAccumulator::addObservationPartials(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( designMatrixBlock.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of partials per observation (" +
+                                  std::to_string( designMatrixBlock.cols( ) ) + ") is incompatible with number of parameters (" +
+                                  std::to_string( numberOfParameters_ ) + ")" );
+    }
+
+    if( diagonalOfWeightMatrixBlock.rows( ) != designMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of weights (" +
+                                  std::to_string( diagonalOfWeightMatrixBlock.rows( ) ) +
+                                  ") is incompatible with number of partials (" +
+                                  std::to_string( designMatrixBlock.rows( ) ) + ")" );
+    }
+
+    if( diagonalOfWeightMatrixBlock.size( ) > 0 && diagonalOfWeightMatrixBlock.minCoeff( ) < 0.0 )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, negative observation weights found" );
+    }
+
+    // Add H^T W H = ( W^(1/2) H )^T ( W^(1/2) H ) as a rank update of the lower triangle
+    normalMatrix_.selfadjointView< Eigen::Lower >( ).rankUpdate(
+                ( diagonalOfWeightMatrixBlock.cwiseSqrt( ).asDiagonal( ) * designMatrixBlock ).transpose( ) );
+    numberOfObservations_ += designMatrixBlock.rows( );
+}
+
+//! Function to retrieve the (full, symmetric) normal matrix H^T W H accumulated so far
+Eigen::MatrixXd NormalEquationsAccumulator::getNormalMatrix( ) const
+{
+    return normalMatrix_.selfadjointView< Eigen::Lower >( );
+}
+
+//! Function to remove all observations from the normal equations
+void NormalEquationsAccumulator::reset( )
+{
+    normalMatrix_ = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+    rightHandSide_ = Eigen::VectorXd::Zero( numberOfParameters_ );
+    numberOfObservations_ = 0;
+}
+
+//! Function to solve a symmetric positive (semi-)definite system of equations, using a Cholesky decomposition (or SVD if this fails)
+Eigen::VectorXd solveSymmetricSystemOfEquations(
+        const Eigen::MatrixXd& matrixToInvert,
+        const Eigen::VectorXd& rightHandSideVector,
+        const double limitConditionNumberForWarning )
+{
+    // Solve system using Cholesky decomposition, or SVD if both decompositions fail
+    Eigen::VectorXd solution;
+    double reciprocalConditionNumber;
+    Eigen::LLT< Eigen::MatrixXd > choleskyDecomposition( matrixToInvert );
+    if( choleskyDecomposition.info( ) == Eigen::Success )
+    {
+        solution = choleskyDecomposition.solve( rightHandSideVector );
+        reciprocalConditionNumber = choleskyDecomposition.rcond( );
+    }
+    else
+    {
+        Eigen::LDLT< Eigen::MatrixXd > robustCholeskyDecomposition( matrixToInvert );
+        if( robustCholeskyDecomposition.info( ) != Eigen::Success )
+        {
+            return solveSystemOfEquationsWithSvd( matrixToInvert, rightHandSideVector, limitConditionNumberForWarning );
+        }
+        solution = robustCholeskyDecomposition.solve( rightHandSideVector );
+        reciprocalConditionNumber = robustCholeskyDecomposition.rcond( );
+    }
+
+    // Check condition number (estimated from decomposition, in 1-norm)
+    if( limitConditionNumberForWarning == limitConditionNumberForWarning )
+    {
+        double conditionNumber = 1.0 / reciprocalConditionNumber;
+        if( conditionNumber > limitConditionNumberForWarning )
+        {
+            std::cerr << "Warning when performing least squares, condition number is " << conditionNumber << std::endl;
+        }
+    }
+
+    return solution;
+}
+
+//! Function to perform an iteration of least squares estimation from (accumulated) normal equations
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    if( normalMatrix.rows( ) != normalMatrix.cols( ) || normalMatrix.rows( ) != rightHandSide.rows( ) )
+    {
+        throw std::runtime_error( "Error when performing least squares from normal equations, sizes are incompatible" );
+    }
+
+    // Add a priori information
+    Eigen::MatrixXd inverseOfCovarianceMatrix = normalMatrix;
+    if( inverseOfAPrioriCovarianceMatrix.size( ) > 0 )
+    {
+        if( inverseOfAPrioriCovarianceMatrix.rows( ) != normalMatrix.rows( ) ||
+                inverseOfAPrioriCovarianceMatrix.cols( ) != normalMatrix.cols( ) )
+        {
+            throw std::runtime_error( "Error when performing least squares from normal equations, a priori covariance is incompatible" );
+        }
+        inverseOfCovarianceMatrix += inverseOfAPrioriCovarianceMatrix;
+    }
+
+    // Solve bordered (indefinite) system if constraints are included
+    if( constraintMultiplier.rows( ) != 0 )
+    {
+        Eigen::VectorXd constrainedRightHandSide = rightHandSide;
+        addConstraintsToNormalEquations(
+                    inverseOfCovarianceMatrix, constrainedRightHandSide, constraintMultiplier, constraintRightHandside );
+        return std::make_pair( solveSystemOfEquationsWithSvd(
+                                   inverseOfCovarianceMatrix, constrainedRightHandSide, limitConditionNumberForWarning ),
+                               inverseOfCovarianceMatrix );
+    }
+
+    // Solve (symmetric positive (semi-)definite) system
+    return std::make_pair( solveSymmetricSystemOfEquations(
+                               inverseOfCovarianceMatrix, rightHandSide, limitConditionNumberForWarning ),
+                           inverseOfCovarianceMatrix );
+}
+
+//! Constructor
+BlockArrowNormalEquationsAccumulator::BlockArrowNormalEquationsAccumulator(
+        const int numberOfParameters,
+        const std::vector< std::vector< int > >& localParameterIndices ):
+    numberOfParameters_( numberOfParameters ), localParameterIndices_( localParameterIndices )
+{
+    if( numberOfParameters_ <= 0 )
+    {
+        throw std::runtime_error( "Error when creating block-arrow normal equations, number of parameters is 0 or smaller: " +
+                                  std::to_string( numberOfParameters_ ) );
+    }
+
+    // Set group of each local parameter, and index in that group
+    parameterGroups_.resize( numberOfParameters_, -1 );
+    parameterIndicesInGroup_.resize( numberOfParameters_, -1 );
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            int currentIndex = localParameterIndices_.at( i ).at( j );
+            if( currentIndex < 0 || currentIndex >= numberOfParameters_ )
+            {
+                throw std::runtime_error( "Error when creating block-arrow normal equations, local parameter index " +
+                                          std::to_string( currentIndex ) + " is out of range" );
+            }
+            if( parameterGroups_.at( currentIndex ) != -1 )
+            {
+                throw std::runtime_error( "Error when creating block-arrow normal equations, parameter " +
+                                          std::to_string( currentIndex ) + " is in more than one group" );
+            }
+            parameterGroups_[ currentIndex ] = i;
+            parameterIndicesInGroup_[ currentIndex ] = j;
+        }
+    }
+
+    // Set all other parameters as global parameters
+    for( int i = 0; i < numberOfParameters_; i++ )
+    {
+        if( parameterGroups_.at( i ) == -1 )
+        {
+            parameterIndicesInGroup_[ i ] = globalParameterIndices_.size( );
+            globalParameterIndices_.push_back( i );
+        }
+    }
+
+    reset( );
+}
+
+//! Function to add the contribution of a block of observations to the normal equations
+void BlockArrowNormalEquationsAccumulator::addObservations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( observationResidualsBlock.rows( ) != designMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to block-arrow normal equations, number of residuals (" +
+                                  std::to_string( observationResidualsBlock.rows( ) ) +
+                                  ") is incompatible with number of partials (" +
+                                  std::to_string( designMatrixBlock.rows( ) ) + ")" );
+    }
+    addObservationBlock( designMatrixBlock, &observationResidualsBlock, diagonalOfWeightMatrixBlock );
+}
+
+//! Function to add the contribution of a block of observations to the normal matrix only (without residuals)
+void BlockArrowNormalEquationsAccumulator::addObservationPartials(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    addObservationBlock( designMatrixBlock, nullptr, diagonalOfWeightMatrixBlock );
+}
+
+//! Function to add the contribution of a block of observations to the normal equations (residuals only used if non-null)
+void BlockArrowNormalEquationsAccumulator::addObservationBlock(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd* observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( designMatrixBlock.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding observations to block-arrow normal equations, number of partials per observation (" +
+                                  std::to_string( designMatrixBlock.cols( ) ) + ") is incompatible with number of parameters (" +
+                                  std::to_string( numberOfParameters_ ) + ")" );
+    }
+
+    if( diagonalOfWeightMatrixBlock.rows( ) != designMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to block-arrow normal equations, number of weights (" +
+                                  std::to_string( diagonalOfWeightMatrixBlock.rows( ) ) +
+                                  ") is incompatible with number of partials (" +
+                                  std::to_string( designMatrixBlock.rows( ) ) + ")" );
+    }
+
+    if( diagonalOfWeightMatrixBlock.size( ) > 0 && diagonalOfWeightMatrixBlock.minCoeff( ) < 0.0 )
+    {
+        throw std::runtime_error( "Error when adding observations to block-arrow normal equations, negative observation weights found" );
+    }
+
+    // Assign each observation to the group of local parameters on which it depends (last entry: no local parameters)
+    int numberOfGroups = localParameterIndices_.size( );
+    std::vector< std::vector< int > > observationIndicesPerGroup( numberOfGroups + 1 );
+    for( int i = 0; i < designMatrixBlock.rows( ); i++ )
+    {
+        int currentGroup = -1;
+        for( int j = 0; j < numberOfGroups; j++ )
+        {
+            for( unsigned int k = 0; k < localParameterIndices_.at( j ).size( ); k++ )
+            {
+                if( designMatrixBlock( i, localParameterIndices_.at( j ).at( k ) ) != 0.0 )
+                {
+                    if( currentGroup != -1 )
+                    {
+                        throw std::runtime_error(
+                                    "Error when adding observations to block-arrow normal equations, observation depends on local parameters of groups " +
+                                    std::to_string( currentGroup ) + " and " + std::to_string( j ) );
+                    }
+                    currentGroup = j;
+                    break;
+                }
+            }
+        }
+        observationIndicesPerGroup.at( currentGroup == -1 ? numberOfGroups : currentGroup ).push_back( i );
+    }
+
+    // Add contribution of the observations of each group, as rank updates of the (lower triangles of the) diagonal blocks
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+    Eigen::MatrixXd weightedGlobalPartials, weightedLocalPartials;
+    Eigen::VectorXd weightedResiduals;
+    for( int i = 0; i <= numberOfGroups; i++ )
+    {
+        const std::vector< int >& currentObservationIndices = observationIndicesPerGroup.at( i );
+        int numberOfObservations = currentObservationIndices.size( );
+        if( numberOfObservations == 0 )
+        {
+            continue;
+        }
+        int numberOfLocalParameters = ( i < numberOfGroups ) ? localParameterIndices_.at( i ).size( ) : 0;
+
+        // Retrieve partials and residuals, premultiplied by the square root of the weights
+        weightedGlobalPartials.resize( numberOfObservations, numberOfGlobalParameters );
+        weightedLocalPartials.resize( numberOfObservations, numberOfLocalParameters );
+        weightedResiduals.resize( numberOfObservations );
+        for( int j = 0; j < numberOfObservations; j++ )
+        {
+            int currentRow = currentObservationIndices.at( j );
+            double weightSquareRoot = std::sqrt( diagonalOfWeightMatrixBlock( currentRow ) );
+            for( int k = 0; k < numberOfGlobalParameters; k++ )
+            {
+                weightedGlobalPartials( j, k ) = weightSquareRoot * designMatrixBlock( currentRow, globalParameterIndices_[ k ] );
+            }
+            for( int k = 0; k < numberOfLocalParameters; k++ )
+            {
+                weightedLocalPartials( j, k ) = weightSquareRoot * designMatrixBlock( currentRow, localParameterIndices_[ i ][ k ] );
+            }
+            if( observationResidualsBlock != nullptr )
+            {
+                weightedResiduals( j ) = weightSquareRoot * ( *observationResidualsBlock )( currentRow );
+            }
+        }
+
+        if( numberOfGlobalParameters > 0 )
+        {
+            globalNormalMatrix_.selfadjointView< Eigen::Lower >( ).rankUpdate( weightedGlobalPartials.transpose( ) );
+            if( observationResidualsBlock != nullptr )
+            {
+                globalRightHandSide_.noalias( ) += weightedGlobalPartials.transpose( ) * weightedResiduals;
+            }
+        }
+
+        if( numberOfLocalParameters > 0 )
+        {
+            localNormalMatrices_[ i ].selfadjointView< Eigen::Lower >( ).rankUpdate( weightedLocalPartials.transpose( ) );
+            localGlobalNormalMatrices_[ i ].noalias( ) += weightedLocalPartials.transpose( ) * weightedGlobalPartials;
+            if( observationResidualsBlock != nullptr )
+            {
+                localRightHandSides_[ i ].noalias( ) += weightedLocalPartials.transpose( ) * weightedResiduals;
+            }
+        }
+    }
+    numberOfObservations_ += designMatrixBlock.rows( );
+}
+
+//! Function to rescale the parameters of the normal equations
+void BlockArrowNormalEquationsAccumulator::scaleParameters( const Eigen::VectorXd& scalingFactors )
+{
+    if( scalingFactors.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when scaling block-arrow normal equations, number of scaling factors (" +
+                                  std::to_string( scalingFactors.rows( ) ) + ") is incompatible with number of parameters (" +
+                                  std::to_string( numberOfParameters_ ) + ")" );
+    }
+
+    Eigen::VectorXd globalScalingFactors = Eigen::VectorXd( globalParameterIndices_.size( ) );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        globalScalingFactors( i ) = scalingFactors( globalParameterIndices_[ i ] );
+    }
+    globalNormalMatrix_ = globalScalingFactors.asDiagonal( ) * globalNormalMatrix_ * globalScalingFactors.asDiagonal( );
+    globalRightHandSide_ = globalRightHandSide_.cwiseProduct( globalScalingFactors );
+
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        Eigen::VectorXd localScalingFactors = Eigen::VectorXd( localParameterIndices_[ i ].size( ) );
+        for( unsigned int j = 0; j < localParameterIndices_[ i ].size( ); j++ )
+        {
+            localScalingFactors( j ) = scalingFactors( localParameterIndices_[ i ][ j ] );
+        }
+        localNormalMatrices_[ i ] = localScalingFactors.asDiagonal( ) * localNormalMatrices_[ i ] *
+                localScalingFactors.asDiagonal( );
+        localGlobalNormalMatrices_[ i ] = localScalingFactors.asDiagonal( ) * localGlobalNormalMatrices_[ i ] *
+                globalScalingFactors.asDiagonal( );
+        localRightHandSides_[ i ] = localRightHandSides_[ i ].cwiseProduct( localScalingFactors );
+    }
+}
+
+//! Function to solve the normal equations, reducing the local parameters of each group
+Eigen::VectorXd BlockArrowNormalEquationsAccumulator::solve(
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning ) const
+{
+    int numberOfGroups = localParameterIndices_.size( );
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+
+    // Retrieve (full) blocks of normal matrix
+    Eigen::MatrixXd globalMatrix = globalNormalMatrix_.selfadjointView< Eigen::Lower >( );
+    std::vector< Eigen::MatrixXd > localMatrices( numberOfGroups );
+    std::vector< Eigen::MatrixXd > localGlobalMatrices = localGlobalNormalMatrices_;
+    for( int i = 0; i < numberOfGroups; i++ )
+    {
+        localMatrices[ i ] = localNormalMatrices_[ i ].selfadjointView< Eigen::Lower >( );
+    }
+
+    // Add a priori information (assumed symmetric) to blocks of normal matrix
+    if( inverseOfAPrioriCovarianceMatrix.size( ) > 0 )
+    {
+        if( inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters_ ||
+                inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters_ )
+        {
+            throw std::runtime_error( "Error when solving block-arrow normal equations, a priori covariance is incompatible" );
+        }
+
+        for( int i = 0; i < numberOfParameters_; i++ )
+        {
+            for( int j = 0; j < numberOfParameters_; j++ )
+            {
+                double currentValue = inverseOfAPrioriCovarianceMatrix( i, j );
+                if( currentValue == 0.0 )
+                {
+                    continue;
+                }
+
+                int rowGroup = parameterGroups_[ i ];
+                int columnGroup = parameterGroups_[ j ];
+                int rowIndex = parameterIndicesInGroup_[ i ];
+                int columnIndex = parameterIndicesInGroup_[ j ];
+                if( rowGroup == -1 && columnGroup == -1 )
+                {
+                    globalMatrix( rowIndex, columnIndex ) += currentValue;
+                }
+                else if( rowGroup == columnGroup )
+                {
+                    localMatrices[ rowGroup ]( rowIndex, columnIndex ) += currentValue;
+                }
+                else if( columnGroup == -1 )
+                {
+                    localGlobalMatrices[ rowGroup ]( rowIndex, columnIndex ) += currentValue;
+                }
+                else if( rowGroup != -1 )
+                {
+                    throw std::runtime_error( "Error when solving block-arrow normal equations, a priori covariance couples local parameters of groups " +
+                                              std::to_string( rowGroup ) + " and " + std::to_string( columnGroup ) );
+                }
+            }
+        }
+    }
+
+    // Reduce local parameters of each group: N_gg - N_lg^T N_ll^-1 N_lg and b_g - N_lg^T N_ll^-1 b_l
+    Eigen::VectorXd reducedRightHandSide = globalRightHandSide_;
+    std::vector< Eigen::MatrixXd > reducedLocalSolutions( numberOfGroups );
+    Eigen::MatrixXd currentRightHandSides;
+    for( int i = 0; i < numberOfGroups; i++ )
+    {
+        int numberOfLocalParameters = localParameterIndices_[ i ].size( );
+        if( numberOfLocalParameters == 0 )
+        {
+            continue;
+        }
+
+        currentRightHandSides.resize( numberOfLocalParameters, numberOfGlobalParameters + 1 );
+        currentRightHandSides.leftCols( numberOfGlobalParameters ) = localGlobalMatrices[ i ];
+        currentRightHandSides.rightCols( 1 ) = localRightHandSides_[ i ];
+
+        Eigen::LLT< Eigen::MatrixXd > choleskyDecomposition( localMatrices[ i ] );
+        if( choleskyDecomposition.info( ) == Eigen::Success )
+        {
+            reducedLocalSolutions[ i ] = choleskyDecomposition.solve( currentRightHandSides );
+        }
+        else
+        {
+            Eigen::LDLT< Eigen::MatrixXd > robustCholeskyDecomposition( localMatrices[ i ] );
+            if( robustCholeskyDecomposition.info( ) != Eigen::Success || !( robustCholeskyDecomposition.rcond( ) > 0.0 ) )
+            {
+                throw std::runtime_error( "Error when solving block-arrow normal equations, normal matrix of local parameters of group " +
+                                          std::to_string( i ) + " is singular" );
+            }
+            reducedLocalSolutions[ i ] = robustCholeskyDecomposition.solve( currentRightHandSides );
+        }
+
+        if( numberOfGlobalParameters > 0 )
+        {
+            globalMatrix.noalias( ) -= localGlobalMatrices[ i ].transpose( ) *
+                    reducedLocalSolutions[ i ].leftCols( numberOfGlobalParameters );
+            reducedRightHandSide.noalias( ) -= localGlobalMatrices[ i ].transpose( ) *
+                    reducedLocalSolutions[ i ].rightCols( 1 );
+        }
+    }
+
+    // Solve reduced system for global parameters, and back-substitute for local parameters
+    Eigen::VectorXd solution = Eigen::VectorXd::Zero( numberOfParameters_ );
+    Eigen::VectorXd globalSolution = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    if( numberOfGlobalParameters > 0 )
+    {
+        globalSolution = solveSymmetricSystemOfEquations( globalMatrix, reducedRightHandSide, limitConditionNumberForWarning );
+    }
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        solution( globalParameterIndices_[ i ] ) = globalSolution( i );
+    }
+
+    for( int i = 0; i < numberOfGroups; i++ )
+    {
+        if( localParameterIndices_[ i ].size( ) == 0 )
+        {
+            continue;
+        }
+
+        Eigen::VectorXd localSolution = reducedLocalSolutions[ i ].rightCols( 1 );
+        if( numberOfGlobalParameters > 0 )
+        {
+            localSolution.noalias( ) -= reducedLocalSolutions[ i ].leftCols( numberOfGlobalParameters ) * globalSolution;
+        }
+        for( unsigned int j = 0; j < localParameterIndices_[ i ].size( ); j++ )
+        {
+            solution( localParameterIndices_[ i ][ j ] ) = localSolution( j );
+        }
+    }
+
+    return solution;
+}
+
+//! Function to retrieve the full (dense, symmetric) normal matrix H^T W H accumulated so far
+Eigen::MatrixXd BlockArrowNormalEquationsAccumulator::getNormalMatrix( ) const
+{
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+
+    Eigen::MatrixXd globalMatrix = globalNormalMatrix_.selfadjointView< Eigen::Lower >( );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < globalParameterIndices_.size( ); j++ )
+        {
+            normalMatrix( globalParameterIndices_[ i ], globalParameterIndices_[ j ] ) = globalMatrix( i, j );
+        }
+    }
+
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        Eigen::MatrixXd localMatrix = localNormalMatrices_[ i ].selfadjointView< Eigen::Lower >( );
+        const std::vector< int >& currentIndices = localParameterIndices_[ i ];
+        for( unsigned int j = 0; j < currentIndices.size( ); j++ )
+        {
+            for( unsigned int k = 0; k < currentIndices.size( ); k++ )
+            {
+                normalMatrix( currentIndices[ j ], currentIndices[ k ] ) = localMatrix( j, k );
+            }
+            for( unsigned int k = 0; k < globalParameterIndices_.size( ); k++ )
+            {
+                normalMatrix( currentIndices[ j ], globalParameterIndices_[ k ] ) = localGlobalNormalMatrices_[ i ]( j, k );
+                normalMatrix( globalParameterIndices_[ k ], currentIndices[ j ] ) = localGlobalNormalMatrices_[ i ]( j, k );
+            }
+        }
+    }
+
+    return normalMatrix;
+}
+
+//! Function to retrieve the (full) right-hand side H^T W y of the normal equations accumulated so far
+Eigen::VectorXd BlockArrowNormalEquationsAccumulator::getRightHandSide( ) const
+{
+    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        rightHandSide( globalParameterIndices_[ i ] ) = globalRightHandSide_( i );
+    }
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < localParameterIndices_[ i ].size( ); j++ )
+        {
+            rightHandSide( localParameterIndices_[ i ][ j ] ) = localRightHandSides_[ i ]( j );
+        }
+    }
+    return rightHandSide;
+}
+
+//! Function to remove all observations from the normal equations
+void BlockArrowNormalEquationsAccumulator::reset( )
+{
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+    globalNormalMatrix_ = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+    globalRightHandSide_ = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+
+    localNormalMatrices_.resize( localParameterIndices_.size( ) );
+    localGlobalNormalMatrices_.resize( localParameterIndices_.size( ) );
+    localRightHandSides_.resize( localParameterIndices_.size( ) );
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        int numberOfLocalParameters = localParameterIndices_[ i ].size( );
+        localNormalMatrices_[ i ] = Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfLocalParameters );
+        localGlobalNormalMatrices_[ i ] = Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfGlobalParameters );
+        localRightHandSides_[ i ] = Eigen::VectorXd::Zero( numberOfLocalParameters );
+    }
+    numberOfObservations_ = 0;
+}
+
 Eigen::VectorXd evaluatePolynomial(
     const Eigen::VectorXd& independentValues,
     const Eigen::VectorXd& polynomialCoefficients,
@@ -0,0 +1,388 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+#include <Eigen/Geometry>
+
+#include "tudat/math/basic/polyhedronBoundingVolumeHierarchy.h"
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+//! Computes the point on a triangle closest to a given point.
+Eigen::Vector3d computeClosestPointOnTriangle(
+        const Eigen::Vector3d& point,
+        const Eigen::Vector3d& vertex0,
+        const Eigen::Vector3d& vertex1,
+        const Eigen::Vector3d& vertex2,
+        int& closestFeature )
+{
+    const Eigen::Vector3d edge01 = vertex1 - vertex0;
+    const Eigen::Vector3d edge02 = vertex2 - vertex0;
+
+    // Check if point is in vertex region outside vertex 0
+    const Eigen::Vector3d vertex0ToPoint = point - vertex0;
+    const double d1 = edge01.dot( vertex0ToPoint );
+    const double d2 = edge02.dot( vertex0ToPoint );
+    if( d1 <= 0.0 && d2 <= 0.0 )
+    {
+        closestFeature = 0;
+        return vertex0;
+    }
+
+    // Check if point is in vertex region outside vertex 1
+    const Eigen::Vector3d vertex1ToPoint = point - vertex1;
+    const double d3 = edge01.dot( vertex1ToPoint );
+    const double d4 = edge02.dot( vertex1ToPoint );
+    if( d3 >= 0.0 && d4 <= d3 )
+    {
+        closestFeature = 1;
+        return vertex1;
+    }
+
+    // Check if point is in edge region of edge 0-1
+    const double vc = d1 * d4 - d3 * d2;
+    if( vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0 )
+    {
+        closestFeature = 3;
+        return vertex0 + d1 / ( d1 - d3 ) * edge01;
+    }
+
+    // Check if point is in vertex region outside vertex 2
+    const Eigen::Vector3d vertex2ToPoint = point - vertex2;
+    const double d5 = edge01.dot( vertex2ToPoint );
+    const double d6 = edge02.dot( vertex2ToPoint );
+    if( d6 >= 0.0 && d5 <= d6 )
+    {
+        closestFeature = 2;
+        return vertex2;
+    }
+
+    // Check if point is in edge region of edge 2-0
+    const double vb = d5 * d2 - d1 * d6;
+    if( vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0 )
+    {
+        closestFeature = 5;
+        return vertex0 + d2 / ( d2 - d6 ) * edge02;
+    }
+
+    // Check if point is in edge region of edge 1-2
+    const double va = d3 * d6 - d5 * d4;
+    if( va <= 0.0 && ( d4 - d3 ) >= 0.0 && ( d5 - d6 ) >= 0.0 )
+    {
+        closestFeature = 4;
+        return vertex1 + ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) ) * ( vertex2 - vertex1 );
+    }
+
+    // Point is inside face region
+    closestFeature = 6;
+    const double denominator = 1.0 / ( va + vb + vc );
+    return vertex0 + edge01 * ( vb * denominator ) + edge02 * ( vc * denominator );
+}
+
+//! Constructor.
+PolyhedronBoundingVolumeHierarchy::PolyhedronBoundingVolumeHierarchy(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const unsigned int maximumNumberOfFacetsPerLeaf ):
+    verticesCoordinates_( verticesCoordinates ),
+    verticesDefiningEachFacet_( verticesDefiningEachFacet ),
+    maximumNumberOfFacetsPerLeaf_( maximumNumberOfFacetsPerLeaf )
+{
+    const unsigned int numberOfVertices = verticesCoordinates_.rows( );
+    const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows( );
+
+    if( numberOfFacets == 0 )
+    {
+        throw std::runtime_error( "Error when creating polyhedron bounding volume hierarchy, no facets provided." );
+    }
+    if( maximumNumberOfFacetsPerLeaf_ == 0 )
+    {
+        throw std::runtime_error( "Error when creating polyhedron bounding volume hierarchy, maximum number of facets "
+                                  "per leaf must be positive." );
+    }
+
+    // Compute facet normals and centroids, and angle-weighted vertex pseudonormals
+    facetNormals_.resize( numberOfFacets, 3 );
+    vertexPseudoNormals_ = Eigen::MatrixXd::Zero( numberOfVertices, 3 );
+    Eigen::MatrixXd facetCentroids( numberOfFacets, 3 );
+    std::map< std::pair< int, int >, Eigen::Vector3d > edgeNormalSums;
+    for( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        Eigen::Vector3d vertices[ 3 ];
+        for( unsigned int i = 0; i < 3; ++i )
+        {
+            vertices[ i ] = verticesCoordinates_.row( verticesDefiningEachFacet_( facet, i ) ).transpose( );
+        }
+
+        const Eigen::Vector3d facetNormal = ( vertices[ 1 ] - vertices[ 0 ] ).cross(
+                    vertices[ 2 ] - vertices[ 1 ] ).normalized( );
+        facetNormals_.row( facet ) = facetNormal.transpose( );
+        facetCentroids.row( facet ) = ( vertices[ 0 ] + vertices[ 1 ] + vertices[ 2 ] ).transpose( ) / 3.0;
+
+        for( unsigned int i = 0; i < 3; ++i )
+        {
+            // Add normal weighted with the facet angle at the vertex
+            const Eigen::Vector3d toNextVertex = ( vertices[ ( i + 1 ) % 3 ] - vertices[ i ] ).normalized( );
+            const Eigen::Vector3d toPreviousVertex = ( vertices[ ( i + 2 ) % 3 ] - vertices[ i ] ).normalized( );
+            const double vertexAngle = std::acos( std::max( -1.0, std::min( 1.0, toNextVertex.dot( toPreviousVertex ) ) ) );
+            vertexPseudoNormals_.row( verticesDefiningEachFacet_( facet, i ) ) += vertexAngle * facetNormal.transpose( );
+
+            // Add normal to the sum for the edge, which is shared by two facets
+            const int edgeVertex0 = verticesDefiningEachFacet_( facet, i );
+            const int edgeVertex1 = verticesDefiningEachFacet_( facet, ( i + 1 ) % 3 );
+            const std::pair< int, int > edgeKey = std::make_pair(
+                        std::min( edgeVertex0, edgeVertex1 ), std::max( edgeVertex0, edgeVertex1 ) );
+            if( edgeNormalSums.count( edgeKey ) == 0 )
+            {
+                edgeNormalSums[ edgeKey ] = facetNormal;
+            }
+            else
+            {
+                edgeNormalSums[ edgeKey ] += facetNormal;
+            }
+        }
+    }
+
+    // Retrieve edge pseudonormals for each facet
+    edgePseudoNormals_.resize( numberOfFacets, 9 );
+    for( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        for( unsigned int i = 0; i < 3; ++i )
+        {
+            const int edgeVertex0 = verticesDefiningEachFacet_( facet, i );
+            const int edgeVertex1 = verticesDefiningEachFacet_( facet, ( i + 1 ) % 3 );
+            edgePseudoNormals_.block< 1, 3 >( facet, 3 * i ) = edgeNormalSums.at(
+                        std::make_pair( std::min( edgeVertex0, edgeVertex1 ),
+                                        std::max( edgeVertex0, edgeVertex1 ) ) ).transpose( );
+        }
+    }
+
+    // Build tree
+    facetIndices_.resize( numberOfFacets );
+    for( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        facetIndices_.at( facet ) = facet;
+    }
+    nodes_.reserve( 2 * ( numberOfFacets / maximumNumberOfFacetsPerLeaf_ + 1 ) );
+    nodes_.push_back( Node( ) );
+    buildSubtree( 0, 0, numberOfFacets, facetCentroids );
+}
+
+//! Recursively builds the subtree for a range of facets.
+void PolyhedronBoundingVolumeHierarchy::buildSubtree(
+        const unsigned int nodeIndex,
+        const unsigned int firstFacet,
+        const unsigned int endFacet,
+        const Eigen::MatrixXd& facetCentroids )
+{
+    // Compute bounding box of facets, and of their centroids
+    Eigen::Vector3d minimumCorner = Eigen::Vector3d::Constant( std::numeric_limits< double >::infinity( ) );
+    Eigen::Vector3d maximumCorner = -minimumCorner;
+    Eigen::Vector3d minimumCentroid = minimumCorner;
+    Eigen::Vector3d maximumCentroid = maximumCorner;
+    for( unsigned int i = firstFacet; i < endFacet; ++i )
+    {
+        const unsigned int facet = facetIndices_.at( i );
+        for( unsigned int j = 0; j < 3; ++j )
+        {
+            const Eigen::Vector3d vertex = verticesCoordinates_.row( verticesDefiningEachFacet_( facet, j ) ).transpose( );
+            minimumCorner = minimumCorner.cwiseMin( vertex );
+            maximumCorner = maximumCorner.cwiseMax( vertex );
+        }
+        minimumCentroid = minimumCentroid.cwiseMin( facetCentroids.row( facet ).transpose( ) );
+        maximumCentroid = maximumCentroid.cwiseMax( facetCentroids.row( facet ).transpose( ) );
+    }
+    nodes_.at( nodeIndex ).minimumCorner = minimumCorner;
+    nodes_.at( nodeIndex ).maximumCorner = maximumCorner;
+
+    // Create leaf if sufficiently few facets remain, or if the facets cannot be separated
+    unsigned int splitAxis;
+    const double centroidExtent = ( maximumCentroid - minimumCentroid ).maxCoeff( &splitAxis );
+    if( endFacet - firstFacet <= maximumNumberOfFacetsPerLeaf_ || !( centroidExtent > 0.0 ) )
+    {
+        nodes_.at( nodeIndex ).firstIndex = firstFacet;
+        nodes_.at( nodeIndex ).numberOfFacets = endFacet - firstFacet;
+        return;
+    }
+
+    // Split facets at median centroid along longest axis
+    const unsigned int middleFacet = firstFacet + ( endFacet - firstFacet ) / 2;
+    std::nth_element( facetIndices_.begin( ) + firstFacet, facetIndices_.begin( ) + middleFacet,
+                      facetIndices_.begin( ) + endFacet,
+                      [ & ]( const unsigned int facet1, const unsigned int facet2 )
+    {
+        return facetCentroids( facet1, splitAxis ) < facetCentroids( facet2, splitAxis );
+    } );
+
+    // Create child nodes (stored contiguously), and build their subtrees
+    const unsigned int firstChild = nodes_.size( );
+    nodes_.at( nodeIndex ).firstIndex = firstChild;
+    nodes_.at( nodeIndex ).numberOfFacets = 0;
+    nodes_.push_back( Node( ) );
+    nodes_.push_back( Node( ) );
+    buildSubtree( firstChild, firstFacet, middleFacet, facetCentroids );
+    buildSubtree( firstChild + 1, middleFacet, endFacet, facetCentroids );
+}
+
+//! Computes the distance to the closest point on the surface of the polyhedron.
+double PolyhedronBoundingVolumeHierarchy::computeDistanceToSurface(
+        const Eigen::Vector3d& point,
+        Eigen::Vector3d& closestPoint,
+        Eigen::Vector3d& closestPointPseudoNormal ) const
+{
+    double minimumSquaredDistance = std::numeric_limits< double >::infinity( );
+    unsigned int closestFacet = 0;
+    int closestFeature = 6;
+
+    // Depth-first traversal of tree, using fixed-size stack (depth of tree is logarithmic in number of facets)
+    unsigned int nodeStack[ 128 ];
+    unsigned int stackSize = 0;
+    nodeStack[ stackSize++ ] = 0;
+    while( stackSize > 0 )
+    {
+        const Node& node = nodes_[ nodeStack[ --stackSize ] ];
+        if( !( computeSquaredDistanceToNode( point, node ) < minimumSquaredDistance ) )
+        {
+            continue;
+        }
+
+        if( node.numberOfFacets > 0 )
+        {
+            // Compute distance to each facet of leaf
+            for( unsigned int i = node.firstIndex; i < node.firstIndex + node.numberOfFacets; ++i )
+            {
+                const unsigned int facet = facetIndices_[ i ];
+                int feature;
+                const Eigen::Vector3d pointOnFacet = computeClosestPointOnTriangle(
+                            point,
+                            verticesCoordinates_.row( verticesDefiningEachFacet_( facet, 0 ) ).transpose( ),
+                            verticesCoordinates_.row( verticesDefiningEachFacet_( facet, 1 ) ).transpose( ),
+                            verticesCoordinates_.row( verticesDefiningEachFacet_( facet, 2 ) ).transpose( ),
+                            feature );
+                const double squaredDistance = ( point - pointOnFacet ).squaredNorm( );
+                if( squaredDistance < minimumSquaredDistance )
+                {
+                    minimumSquaredDistance = squaredDistance;
+                    closestPoint = pointOnFacet;
+                    closestFacet = facet;
+                    closestFeature = feature;
+                }
+            }
+        }
+        else
+        {
+            // Push furthest child first, so that closest child is visited first
+            const unsigned int firstChild = node.firstIndex;
+            if( computeSquaredDistanceToNode( point, nodes_[ firstChild ] ) <
+                    computeSquaredDistanceToNode( point, nodes_[ firstChild + 1 ] ) )
+            {
+                nodeStack[ stackSize++ ] = firstChild + 1;
+                nodeStack[ stackSize++ ] = firstChild;
+            }
+            else
+            {
+                nodeStack[ stackSize++ ] = firstChild;
+                nodeStack[ stackSize++ ] = firstChild + 1;
+            }
+        }
+    }
+
+    // Retrieve pseudonormal of feature on which closest point lies
+    if( closestFeature < 3 )
+    {
+        closestPointPseudoNormal = vertexPseudoNormals_.row(
+                    verticesDefiningEachFacet_( closestFacet, closestFeature ) ).transpose( );
+    }
+    else if( closestFeature < 6 )
+    {
+        closestPointPseudoNormal = edgePseudoNormals_.block< 1, 3 >( closestFacet, 3 * ( closestFeature - 3 ) ).transpose( );
+    }
+    else
+    {
+        closestPointPseudoNormal = facetNormals_.row( closestFacet ).transpose( );
+    }
+
+    return std::sqrt( minimumSquaredDistance );
+}
+
+//! Computes the distance to the closest vertex of the polyhedron.
+double PolyhedronBoundingVolumeHierarchy::computeDistanceToClosestVertex(
+        const Eigen::Vector3d& point,
+        unsigned int& closestVertex ) const
+{
+    double minimumSquaredDistance = std::numeric_limits< double >::infinity( );
+
+    // Depth-first traversal of tree (vertices of each facet are contained in its bounding box)
+    unsigned int nodeStack[ 128 ];
+    unsigned int stackSize = 0;
+    nodeStack[ stackSize++ ] = 0;
+    while( stackSize > 0 )
+    {
+        const Node& node = nodes_[ nodeStack[ --stackSize ] ];
+        if( !( computeSquaredDistanceToNode( point, node ) < minimumSquaredDistance ) )
+        {
+            continue;
+        }
+
+        if( node.numberOfFacets > 0 )
+        {
+            for( unsigned int i = node.firstIndex; i < node.firstIndex + node.numberOfFacets; ++i )
+            {
+                for( unsigned int j = 0; j < 3; ++j )
+                {
+                    const unsigned int vertex = verticesDefiningEachFacet_( facetIndices_[ i ], j );
+                    const double squaredDistance = ( verticesCoordinates_.row( vertex ).transpose( ) - point ).squaredNorm( );
+                    if( squaredDistance < minimumSquaredDistance )
+                    {
+                        minimumSquaredDistance = squaredDistance;
+                        closestVertex = vertex;
+                    }
+                }
+            }
+        }
+        else
+        {
+            const unsigned int firstChild = node.firstIndex;
+            if( computeSquaredDistanceToNode( point, nodes_[ firstChild ] ) <
+                    computeSquaredDistanceToNode( point, nodes_[ firstChild + 1 ] ) )
+            {
+                nodeStack[ stackSize++ ] = firstChild + 1;
+                nodeStack[ stackSize++ ] = firstChild;
+            }
+            else
+            {
+                nodeStack[ stackSize++ ] = firstChild;
+                nodeStack[ stackSize++ ] = firstChild + 1;
+            }
+        }
+    }
+
+    return std::sqrt( minimumSquaredDistance );
+}
+
+//! Checks whether a point is inside the polyhedron.
+bool PolyhedronBoundingVolumeHierarchy::isPointInside( const Eigen::Vector3d& point ) const
+{
+    Eigen::Vector3d closestPoint, closestPointPseudoNormal;
+    computeDistanceToSurface( point, closestPoint, closestPointPseudoNormal );
+    return ( point - closestPoint ).dot( closestPointPseudoNormal ) < 0.0;
+}
+
+} // namespace basic_mathematics
+} // namespace tudat
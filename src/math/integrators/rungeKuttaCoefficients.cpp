@@ -12,6 +12,8 @@
  *      Fehlberg, E. Classical Fifth-, Sixth-, Seventh-, and Eighth-Order Runge-Kutta Formulas With
  *          Stepsize Control, Marshall Spaceflight Center, NASA TR R-278, 1968.
  *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *      Hairer, E., Wanner, G. DOP853 Fortran code, http://www.unige.ch/~hairer/software.html.
  *
  *    Notes
  *      The naming of the coefficient sets follows (Montenbruck and Gill, 2005).
@@ -816,6 +818,255 @@ void initializeRungeKutta87DormandPrinceCoefficients(
     rungeKutta87DormandPrinceCoefficients.name = "Runge-Kutta 8/7 Dormand-Prince";
 }
 
+//! Initialize RK85 (Dormand and Prince, DOP853) coefficients.
+void initializeRungeKutta85DormandPrinceCoefficients(
+        RungeKuttaCoefficients& rungeKutta85DormandPrinceCoefficients )
+{
+    // Define characteristics of coefficient set.
+    rungeKutta85DormandPrinceCoefficients.lowerOrder = 5;
+    rungeKutta85DormandPrinceCoefficients.higherOrder = 8;
+    rungeKutta85DormandPrinceCoefficients.orderEstimateToIntegrate
+            = RungeKuttaCoefficients::higher;
+
+    // This coefficient set is taken from the DOP853 code of (Hairer and Wanner), see also (Hairer et al., 1993,
+    // Sections II.5 and II.6). The step size control uses the embedded 5th-order estimate only (the original code
+    // combines it with an additional 3rd-order estimate).
+
+    // a-coefficients for the Runge-Kutta method of order 8
+    // with an embedded 5th-order method for stepsize control and a total of 12 stages.
+    rungeKutta85DormandPrinceCoefficients.aCoefficients = Eigen::MatrixXd::Zero( 12, 11 );
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 1, 0 ) = 0.05260015195876773;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 2, 0 ) = 0.0197250569845379;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 2, 1 ) = 0.0591751709536137;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 3, 0 ) = 0.02958758547680685;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 3, 2 ) = 0.08876275643042054;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 4, 0 ) = 0.2413651341592667;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 4, 2 ) = -0.8845494793282861;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 4, 3 ) = 0.924834003261792;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 5, 0 ) = 0.037037037037037035;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 5, 3 ) = 0.17082860872947386;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 5, 4 ) = 0.12546768756682242;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 6, 0 ) = 0.037109375;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 6, 3 ) = 0.17025221101954405;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 6, 4 ) = 0.06021653898045596;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 6, 5 ) = -0.017578125;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 7, 0 ) = 0.03709200011850479;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 7, 3 ) = 0.17038392571223998;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 7, 4 ) = 0.10726203044637328;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 7, 5 ) = -0.015319437748624402;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 7, 6 ) = 0.008273789163814023;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 8, 0 ) = 0.6241109587160757;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 8, 3 ) = -3.3608926294469414;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 8, 4 ) = -0.868219346841726;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 8, 5 ) = 27.59209969944671;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 8, 6 ) = 20.154067550477894;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 8, 7 ) = -43.48988418106996;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 9, 0 ) = 0.47766253643826434;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 9, 3 ) = -2.4881146199716677;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 9, 4 ) = -0.590290826836843;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 9, 5 ) = 21.230051448181193;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 9, 6 ) = 15.279233632882423;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 9, 7 ) = -33.28821096898486;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 9, 8 ) = -0.020331201708508627;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 0 ) = -0.9371424300859873;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 3 ) = 5.186372428844064;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 4 ) = 1.0914373489967295;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 5 ) = -8.149787010746927;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 6 ) = -18.52006565999696;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 7 ) = 22.739487099350505;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 8 ) = 2.4936055526796523;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 10, 9 ) = -3.0467644718982196;
+
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 0 ) = 2.273310147516538;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 3 ) = -10.53449546673725;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 4 ) = -2.0008720582248625;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 5 ) = -17.9589318631188;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 6 ) = 27.94888452941996;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 7 ) = -2.8589982771350235;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 8 ) = -8.87285693353063;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 9 ) = 12.360567175794303;
+    rungeKutta85DormandPrinceCoefficients.aCoefficients( 11, 10 ) = 0.6433927460157636;
+
+    // c-coefficients for the Runge-Kutta method of order 8
+    // with an embedded 5th-order method for stepsize control and a total of 12 stages.
+    rungeKutta85DormandPrinceCoefficients.cCoefficients = Eigen::VectorXd::Zero( 12 );
+
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 1 ) = 0.05260015195876773;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 2 ) = 0.0789002279381516;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 3 ) = 0.1183503419072274;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 4 ) = 0.2816496580927726;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 5 ) = 0.3333333333333333;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 6 ) = 0.25;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 7 ) = 0.3076923076923077;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 8 ) = 0.6512820512820513;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 9 ) = 0.6;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 10 ) = 0.8571428571428571;
+    rungeKutta85DormandPrinceCoefficients.cCoefficients( 11 ) = 1.0;
+
+    // b-coefficients for the Runge-Kutta method of order 8
+    // with an embedded 5th-order method for stepsize control and a total of 12 stages.
+    rungeKutta85DormandPrinceCoefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, 12 );
+
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 0 ) = 0.054293734116568765;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 5 ) = 4.450312892752409;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 6 ) = 1.8915178993145003;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 7 ) = -5.801203960010585;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 8 ) = 0.3111643669578199;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 9 ) = -0.1521609496625161;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 10 ) = 0.20136540080403034;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 11 ) = 0.04471061572777259;
+
+    // Lower order coefficients are obtained from the higher order coefficients and the error coefficients.
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 0 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 0 ) - 0.01312004499419488;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 5 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 5 ) + 1.2251564463762044;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 6 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 6 ) + 0.4957589496572502;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 7 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 7 ) - 1.6643771824549864;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 8 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 8 ) + 0.35032884874997366;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 9 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 9 ) - 0.3341791187130175;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 10 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 10 ) - 0.08192320648511571;
+    rungeKutta85DormandPrinceCoefficients.bCoefficients( 0, 11 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients( 1, 11 ) + 0.022355307863886294;
+
+    // a- and c-coefficients of the additional stages for the dense output of order 7. The first additional stage is
+    // the state derivative at the end of the step.
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients = Eigen::MatrixXd::Zero( 4, 15 );
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients.block( 0, 0, 1, 12 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients.block( 1, 0, 1, 12 );
+
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 0 ) = 0.056167502283047954;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 6 ) = 0.25350021021662483;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 7 ) = -0.2462390374708025;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 8 ) = -0.12419142326381637;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 9 ) = 0.15329179827876568;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 10 ) = 0.00820105229563469;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 11 ) = 0.007567897660545699;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 1, 12 ) = -0.008298;
+
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 0 ) = 0.03183464816350214;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 5 ) = 0.028300909672366776;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 6 ) = 0.053541988307438566;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 7 ) = -0.05492374857139099;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 10 ) = -0.00010834732869724932;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 11 ) = 0.0003825710908356584;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 12 ) = -0.00034046500868740456;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 2, 13 ) = 0.1413124436746325;
+
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 0 ) = -0.42889630158379194;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 5 ) = -4.697621415361164;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 6 ) = 7.683421196062599;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 7 ) = 4.06898981839711;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 8 ) = 0.3567271874552811;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 12 ) = -0.0013990241651590145;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 13 ) = 2.9475147891527724;
+    rungeKutta85DormandPrinceCoefficients.denseOutputACoefficients( 3, 14 ) = -9.15095847217987;
+
+    rungeKutta85DormandPrinceCoefficients.denseOutputCCoefficients = Eigen::VectorXd::Zero( 4 );
+    rungeKutta85DormandPrinceCoefficients.denseOutputCCoefficients( 0 ) = 1.0;
+    rungeKutta85DormandPrinceCoefficients.denseOutputCCoefficients( 1 ) = 0.1;
+    rungeKutta85DormandPrinceCoefficients.denseOutputCCoefficients( 2 ) = 0.2;
+    rungeKutta85DormandPrinceCoefficients.denseOutputCCoefficients( 3 ) = 0.7777777777777778;
+
+    // The dense output is given in (Hairer and Wanner) in the nested form
+    // y( theta ) = y0 + theta r1 + theta ( 1 - theta ) r2 + theta^2 ( 1 - theta ) r3 +
+    //     theta^2 ( 1 - theta )^2 ( r4 + theta r5 + theta ( 1 - theta ) r6 + theta^2 ( 1 - theta ) r7 ),
+    // with r1 = h sum_i b_i k_i, r2 = h k_1 - r1, r3 = 2 r1 - h k_1 - h k_13 and r_m = h sum_i d_mi k_i for m = 4..7.
+    // The coefficients of r1..r7 (columns) for each stage (rows) are set here, and converted to the polynomial
+    // coefficients of the stage weights below.
+    Eigen::MatrixXd nestedFormCoefficients = Eigen::MatrixXd::Zero( 16, 7 );
+    nestedFormCoefficients.block( 0, 0, 12, 1 ) =
+            rungeKutta85DormandPrinceCoefficients.bCoefficients.block( 1, 0, 1, 12 ).transpose( );
+    nestedFormCoefficients.block( 0, 1, 12, 1 ) = -nestedFormCoefficients.block( 0, 0, 12, 1 );
+    nestedFormCoefficients.block( 0, 2, 12, 1 ) = 2.0 * nestedFormCoefficients.block( 0, 0, 12, 1 );
+    nestedFormCoefficients( 0, 1 ) += 1.0;
+    nestedFormCoefficients( 0, 2 ) -= 1.0;
+    nestedFormCoefficients( 12, 2 ) -= 1.0;
+
+    nestedFormCoefficients( 0, 3 ) = -8.428938276109013;
+    nestedFormCoefficients( 5, 3 ) = 0.5667149535193777;
+    nestedFormCoefficients( 6, 3 ) = -3.0689499459498917;
+    nestedFormCoefficients( 7, 3 ) = 2.38466765651207;
+    nestedFormCoefficients( 8, 3 ) = 2.117034582445028;
+    nestedFormCoefficients( 9, 3 ) = -0.871391583777973;
+    nestedFormCoefficients( 10, 3 ) = 2.2404374302607883;
+    nestedFormCoefficients( 11, 3 ) = 0.6315787787694688;
+    nestedFormCoefficients( 12, 3 ) = -0.08899033645133331;
+    nestedFormCoefficients( 13, 3 ) = 18.148505520854727;
+    nestedFormCoefficients( 14, 3 ) = -9.194632392478356;
+    nestedFormCoefficients( 15, 3 ) = -4.436036387594894;
+
+    nestedFormCoefficients( 0, 4 ) = 10.427508642579134;
+    nestedFormCoefficients( 5, 4 ) = 242.28349177525817;
+    nestedFormCoefficients( 6, 4 ) = 165.20045171727028;
+    nestedFormCoefficients( 7, 4 ) = -374.5467547226902;
+    nestedFormCoefficients( 8, 4 ) = -22.113666853125306;
+    nestedFormCoefficients( 9, 4 ) = 7.733432668472264;
+    nestedFormCoefficients( 10, 4 ) = -30.674084731089398;
+    nestedFormCoefficients( 11, 4 ) = -9.332130526430229;
+    nestedFormCoefficients( 12, 4 ) = 15.697238121770845;
+    nestedFormCoefficients( 13, 4 ) = -31.139403219565178;
+    nestedFormCoefficients( 14, 4 ) = -9.35292435884448;
+    nestedFormCoefficients( 15, 4 ) = 35.81684148639408;
+
+    nestedFormCoefficients( 0, 5 ) = 19.985053242002433;
+    nestedFormCoefficients( 5, 5 ) = -387.0373087493518;
+    nestedFormCoefficients( 6, 5 ) = -189.17813819516758;
+    nestedFormCoefficients( 7, 5 ) = 527.8081592054236;
+    nestedFormCoefficients( 8, 5 ) = -11.57390253995963;
+    nestedFormCoefficients( 9, 5 ) = 6.8812326946963;
+    nestedFormCoefficients( 10, 5 ) = -1.0006050966910838;
+    nestedFormCoefficients( 11, 5 ) = 0.7777137798053443;
+    nestedFormCoefficients( 12, 5 ) = -2.778205752353508;
+    nestedFormCoefficients( 13, 5 ) = -60.19669523126412;
+    nestedFormCoefficients( 14, 5 ) = 84.32040550667716;
+    nestedFormCoefficients( 15, 5 ) = 11.99229113618279;
+
+    nestedFormCoefficients( 0, 6 ) = -25.69393346270375;
+    nestedFormCoefficients( 5, 6 ) = -154.18974869023643;
+    nestedFormCoefficients( 6, 6 ) = -231.5293791760455;
+    nestedFormCoefficients( 7, 6 ) = 357.6391179106141;
+    nestedFormCoefficients( 8, 6 ) = 93.40532418362432;
+    nestedFormCoefficients( 9, 6 ) = -37.45832313645163;
+    nestedFormCoefficients( 10, 6 ) = 104.0996495089623;
+    nestedFormCoefficients( 11, 6 ) = 29.8402934266605;
+    nestedFormCoefficients( 12, 6 ) = -43.53345659001114;
+    nestedFormCoefficients( 13, 6 ) = 96.32455395918828;
+    nestedFormCoefficients( 14, 6 ) = -39.17726167561544;
+    nestedFormCoefficients( 15, 6 ) = -149.72683625798564;
+
+    // Coefficients of theta^1..theta^7 (columns) of the terms of the nested form (rows).
+    Eigen::MatrixXd nestedFormPolynomials = Eigen::MatrixXd::Zero( 7, 7 );
+    nestedFormPolynomials <<
+             1.0,  0.0,  0.0,  0.0,  0.0,  0.0,  0.0,
+             1.0, -1.0,  0.0,  0.0,  0.0,  0.0,  0.0,
+             0.0,  1.0, -1.0,  0.0,  0.0,  0.0,  0.0,
+             0.0,  1.0, -2.0,  1.0,  0.0,  0.0,  0.0,
+             0.0,  0.0,  1.0, -2.0,  1.0,  0.0,  0.0,
+             0.0,  0.0,  1.0, -3.0,  3.0, -1.0,  0.0,
+             0.0,  0.0,  0.0,  1.0, -3.0,  3.0, -1.0;
+    rungeKutta85DormandPrinceCoefficients.denseOutputCoefficients = nestedFormCoefficients * nestedFormPolynomials;
+    rungeKutta85DormandPrinceCoefficients.denseOutputOrder = 7;
+
+    // Set the name of these coefficients.
+    rungeKutta85DormandPrinceCoefficients.name = "Runge-Kutta 8/5 Dormand-Prince (DOP853)";
+}
+
 //! Initialize RKF89 coefficients.
 void initializeRungeKuttaFehlberg89Coefficients( RungeKuttaCoefficients&
                                                  rungeKuttaFehlberg89Coefficients )
@@ -2132,182 +2383,154 @@ void initializeRungeKuttaFeagin1412Coefficients(
     rungeKutta1412Coefficients.name = "Runge-Kutta-Feagin 14/12";
 }
 
+//! Function to create a coefficient set using one of the initialization functions above.
+RungeKuttaCoefficients createRungeKuttaCoefficients(
+        void( *initializationFunction )( RungeKuttaCoefficients& ) )
+{
+    RungeKuttaCoefficients coefficients;
+    initializationFunction( coefficients );
+    return coefficients;
+}
+
 const RungeKuttaCoefficients& RungeKuttaCoefficients::get(
         CoefficientSets coefficientSet )
 {
-    static RungeKuttaCoefficients forwardEulerCoefficients,
-                                  rungeKutta4Coefficients,
-                                  explicitMidPointCoefficients,
-                                  explicitTrapezoidRuleCoefficients,
-                                  ralstonCoefficients,
-                                  rungeKutta3Coefficients,
-                                  ralston3Coefficients,
-                                  SSPRK3Coefficients,
-                                  ralston4Coefficients,
-                                  threeEighthRuleRK4Coefficients,
-                                  heunEulerCoefficients,
-                                  rungeKuttaFehlberg12Coefficients,
-                                  rungeKuttaFehlberg45Coefficients,
-                                  rungeKuttaFehlberg56Coefficients,
-                                  rungeKuttaFehlberg78Coefficients,
-                                  rungeKutta87DormandPrinceCoefficients,
-                                  rungeKuttaFehlberg89Coefficients,
-                                  rungeKuttaVerner89Coefficients,
-                                  rungeKuttaFeagin108Coefficients,
-                                  rungeKuttaFeagin1210Coefficients,
-                                  rungeKuttaFeagin1412Coefficients;
-
+    // Each coefficient set is a function-local static, so that its initialization is done only once, and is
+    // thread-safe when get is called concurrently (e.g. by integrators of arcs propagated in parallel).
     switch ( coefficientSet )
     {
-        
     case forwardEuler:
-        if ( !(forwardEulerCoefficients.isFixedStepSize) )
-        {
-            initializeForwardEulerCoefficients( forwardEulerCoefficients );
-        }
-        return forwardEulerCoefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeForwardEulerCoefficients );
+        return coefficients;
+    }
     case rungeKutta4Classic:
-        if ( !(rungeKutta4Coefficients.isFixedStepSize) )
-        {
-            initializeRungeKutta4Coefficients( rungeKutta4Coefficients );
-        }
-        return rungeKutta4Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKutta4Coefficients );
+        return coefficients;
+    }
     case explicitMidPoint:
-        if ( !(explicitMidPointCoefficients.isFixedStepSize) )
-        {
-            initializeExplicitMidpointCoefficients( explicitMidPointCoefficients );
-        }
-        return explicitMidPointCoefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeExplicitMidpointCoefficients );
+        return coefficients;
+    }
     case explicitTrapezoidRule:
-        if ( !(explicitTrapezoidRuleCoefficients.isFixedStepSize) )
-        {
-            initializeExplicitTrapezoidRuleCoefficients( explicitTrapezoidRuleCoefficients );
-        }
-        return explicitTrapezoidRuleCoefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeExplicitTrapezoidRuleCoefficients );
+        return coefficients;
+    }
     case ralston:
-        if ( !(ralstonCoefficients.isFixedStepSize) )
-        {
-            initializeRalstonCoefficients( ralstonCoefficients );
-        }
-        return ralstonCoefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRalstonCoefficients );
+        return coefficients;
+    }
     case rungeKutta3:
-        if ( !(rungeKutta3Coefficients.isFixedStepSize) )
-        {
-            initializeRungeKutta3Coefficients( rungeKutta3Coefficients );
-        }
-        return rungeKutta3Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKutta3Coefficients );
+        return coefficients;
+    }
     case ralston3:
-        if ( !(ralston3Coefficients.isFixedStepSize) )
-        {
-            initializeRalston3Coefficients( ralston3Coefficients );
-        }
-        return ralston3Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRalston3Coefficients );
+        return coefficients;
+    }
     case SSPRK3:
-        if ( !(SSPRK3Coefficients.isFixedStepSize) )
-        {
-            initializeSSPRK3Coefficients( SSPRK3Coefficients );
-        }
-        return SSPRK3Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeSSPRK3Coefficients );
+        return coefficients;
+    }
     case ralston4:
-        if ( !(ralston4Coefficients.isFixedStepSize) )
-        {
-            initializeRalston4Coefficients( ralston4Coefficients );
-        }
-        return ralston4Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRalston4Coefficients );
+        return coefficients;
+    }
     case threeEighthRuleRK4:
-        if ( !(threeEighthRuleRK4Coefficients.isFixedStepSize) )
-        {
-            initializeThreeEighthRuleRK4Coefficients( threeEighthRuleRK4Coefficients );
-        }
-        return threeEighthRuleRK4Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeThreeEighthRuleRK4Coefficients );
+        return coefficients;
+    }
     case heunEuler:
-        if ( heunEulerCoefficients.higherOrder != 2 )
-        {
-            initializeHeunEulerCoefficients( heunEulerCoefficients );
-        }
-        return heunEulerCoefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeHeunEulerCoefficients );
+        return coefficients;
+    }
     case rungeKuttaFehlberg12:
-        if ( rungeKuttaFehlberg12Coefficients.higherOrder != 2 )
-        {
-            initializeRungeKuttaFehlberg12Coefficients( rungeKuttaFehlberg12Coefficients );
-        }
-        return rungeKuttaFehlberg12Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg12Coefficients );
+        return coefficients;
+    }
     case rungeKuttaFehlberg45:
-        if ( rungeKuttaFehlberg45Coefficients.higherOrder != 5 )
-        {
-            initializeRungeKuttaFehlberg45Coefficients( rungeKuttaFehlberg45Coefficients );
-        }
-        return rungeKuttaFehlberg45Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg45Coefficients );
+        return coefficients;
+    }
     case rungeKuttaFehlberg56:
-        if ( rungeKuttaFehlberg56Coefficients.higherOrder != 6 )
-        {
-            initializeRungeKuttaFehlberg56Coefficients( rungeKuttaFehlberg56Coefficients );
-        }
-        return rungeKuttaFehlberg56Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg56Coefficients );
+        return coefficients;
+    }
     case rungeKuttaFehlberg78:
-        if ( rungeKuttaFehlberg78Coefficients.higherOrder != 8 )
-        {
-            initializeRungeKuttaFehlberg78Coefficients( rungeKuttaFehlberg78Coefficients );
-        }
-        return rungeKuttaFehlberg78Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg78Coefficients );
+        return coefficients;
+    }
     case rungeKutta87DormandPrince:
-        if ( rungeKutta87DormandPrinceCoefficients.higherOrder != 7 )
-        {
-            initializeRungeKutta87DormandPrinceCoefficients(
-                        rungeKutta87DormandPrinceCoefficients );
-        }
-        return rungeKutta87DormandPrinceCoefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKutta87DormandPrinceCoefficients );
+        return coefficients;
+    }
     case rungeKuttaFehlberg89:
-        if ( rungeKuttaFehlberg89Coefficients.higherOrder != 9 )
-        {
-            initializeRungeKuttaFehlberg89Coefficients( rungeKuttaFehlberg89Coefficients );
-        }
-        return rungeKuttaFehlberg89Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg89Coefficients );
+        return coefficients;
+    }
     case rungeKuttaVerner89:
-        if ( rungeKuttaVerner89Coefficients.higherOrder != 9 )
-        {
-            initializeRungeKuttaVerner89Coefficients( rungeKuttaVerner89Coefficients );
-        }
-        return rungeKuttaVerner89Coefficients;
-    
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaVerner89Coefficients );
+        return coefficients;
+    }
     case rungeKuttaFeagin108:
-        if ( rungeKuttaFeagin108Coefficients.higherOrder != 10 )
-        {
-            initializeRungeKuttaFeagin108Coefficients( rungeKuttaFeagin108Coefficients );
-        }
-        return rungeKuttaFeagin108Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFeagin108Coefficients );
+        return coefficients;
+    }
     case rungeKuttaFeagin1210:
-        if ( rungeKuttaFeagin1210Coefficients.higherOrder != 12 )
-        {
-            initializeRungeKuttaFeagin1210Coefficients( rungeKuttaFeagin1210Coefficients );
-        }
-        return rungeKuttaFeagin1210Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFeagin1210Coefficients );
+        return coefficients;
+    }
     case rungeKuttaFeagin1412:
-        if ( rungeKuttaFeagin1412Coefficients.higherOrder != 14 )
-        {
-            initializeRungeKuttaFeagin1412Coefficients( rungeKuttaFeagin1412Coefficients );
-        }
-        return rungeKuttaFeagin1412Coefficients;
-
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFeagin1412Coefficients );
+        return coefficients;
+    }
+    case rungeKutta85DormandPrince:
+    {
+        static const RungeKuttaCoefficients coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKutta85DormandPrinceCoefficients );
+        return coefficients;
+    }
     default: // The default case will never occur because CoefficientsSet is an enum.
         throw RungeKuttaCoefficients( );
     }
@@ -154,11 +154,12 @@ std::shared_ptr< basic_astrodynamics::BodyDeformationModel > createBodyDeformati
                 }
             }
 
+            // Bind raw pointer to body, since the deformation model is owned by the body (shared pointer would create a cycle)
             bodyDeformationModel = std::make_shared< basic_astrodynamics::BasicTidalBodyDeformation >(
-                        std::bind( &Body::getStateInBaseFrameFromEphemeris< double, double >, bodyMap.at( body ),
+                        std::bind( &Body::getStateInBaseFrameFromEphemeris< double, double >, bodyMap.at( body ).get( ),
                                    std::placeholders::_1 ),
                         deformingBodyEphemerides,
-                        std::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrame, bodyMap.at( body )->getRotationalEphemeris( ),
+                        std::bind( &Body::getRotationToLocalFrameFromEphemeris< double >, bodyMap.at( body ).get( ),
                                    std::placeholders::_1 ),
                         gravitionalParameterOfDeformedBody,
                         gravitionalParametersOfDeformingBodies,
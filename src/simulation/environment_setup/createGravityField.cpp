@@ -440,12 +440,27 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
             }
 
             // Create and initialize polyhedron gravity field model.
-            gravityFieldModel = std::make_shared< PolyhedronGravityField >(
-                    polyhedronFieldSettings->getGravitationalParameter(),
-                    polyhedronFieldSettings->getVerticesCoordinates(),
-                    polyhedronFieldSettings->getVerticesDefiningEachFacet(),
-                    associatedReferenceFrame,
-                    inertiaTensorUpdateFunction );
+            if( polyhedronFieldSettings->getExteriorSphericalHarmonicsDegree( ) < 0 )
+            {
+                gravityFieldModel = std::make_shared< PolyhedronGravityField >(
+                        polyhedronFieldSettings->getGravitationalParameter(),
+                        polyhedronFieldSettings->getVerticesCoordinates(),
+                        polyhedronFieldSettings->getVerticesDefiningEachFacet(),
+                        associatedReferenceFrame,
+                        inertiaTensorUpdateFunction );
+            }
+            else
+            {
+                gravityFieldModel = std::make_shared< HybridPolyhedronGravityField >(
+                        polyhedronFieldSettings->getGravitationalParameter(),
+                        polyhedronFieldSettings->getVerticesCoordinates(),
+                        polyhedronFieldSettings->getVerticesDefiningEachFacet(),
+                        polyhedronFieldSettings->getExteriorSphericalHarmonicsDegree( ),
+                        polyhedronFieldSettings->getBrillouinSphereMargin( ),
+                        polyhedronFieldSettings->getSwitchLayerWidth( ),
+                        associatedReferenceFrame,
+                        inertiaTensorUpdateFunction );
+            }
         }
         break;
     }
@@ -197,20 +197,21 @@ std::shared_ptr< gravitation::GravityFieldVariations > createGravityFieldVariati
                 }
             }
 
-            // Set state and orientation functions of perturbed body.
+            // Set state and orientation functions of perturbed body (bound to raw pointer, since the variations are owned
+            // by the body, and a shared pointer would create a cycle).
             if( gravityFieldVariationSettings->getInterpolatorSettings( ) != nullptr )
             {
                 deformedBodyStateFunction = std::bind( &Body::getStateInBaseFrameFromEphemeris< double, double >,
-                                                         bodies.at( body ), std::placeholders::_1 );
+                                                         bodies.at( body ).get( ), std::placeholders::_1 );
                 deformedBodyOrientationFunction = std::bind(
-                            &ephemerides::RotationalEphemeris::getRotationToTargetFrame,
-                            bodies.at( body )->getRotationalEphemeris( ), std::placeholders::_1 );
+                            &Body::getRotationToLocalFrameFromEphemeris< double >,
+                            bodies.at( body ).get( ), std::placeholders::_1 );
             }
             else
             {
-                deformedBodyStateFunction = std::bind( &Body::getState, bodies.at( body ) );
+                deformedBodyStateFunction = std::bind( &Body::getState, bodies.at( body ).get( ) );
                 deformedBodyOrientationFunction = std::bind( &Body::getCurrentRotationToLocalFrame,
-                                                               bodies.at( body ) );
+                                                               bodies.at( body ).get( ) );
 
                 
             }
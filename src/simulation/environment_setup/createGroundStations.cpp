@@ -23,9 +23,10 @@ void createGroundStation(
         const std::string groundStationName,
         const std::shared_ptr< ground_stations::GroundStationState > groundStationState )
 {
+    // Bind raw pointer to body, since the ground station is owned by the body (shared pointer would create a cycle)
     std::shared_ptr< ground_stations::PointingAnglesCalculator > pointingAnglesCalculator =
             std::make_shared< ground_stations::PointingAnglesCalculator >(
-                std::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrame, body->getRotationalEphemeris( ), std::placeholders::_1 ),
+                std::bind( &Body::getRotationToLocalFrameFromEphemeris< double >, body.get( ), std::placeholders::_1 ),
                 std::bind( &ground_stations::GroundStationState::getRotationFromBodyFixedToTopocentricFrame, groundStationState, std::placeholders::_1 ) );
     body->addGroundStation( groundStationName, std::make_shared< ground_stations::GroundStation >(
                                 groundStationState, pointingAnglesCalculator, groundStationName ) );
@@ -36,9 +37,10 @@ std::shared_ptr< ground_stations::StationMotionModel > createGroundStationMotion
         const std::vector< std::shared_ptr< GroundStationMotionSettings > > stationMotionSettings =
         std::vector< std::shared_ptr< GroundStationMotionSettings > >( ) )
 {
+    // Bind raw pointer to body, since the station motion model is owned by the body (via the ground station)
     std::shared_ptr< ground_stations::StationMotionModel > bodyDeformationMotionModel =
             std::make_shared< ground_stations::BodyDeformationStationMotionModel >(
-                std::bind( &Body::getBodyDeformationModelsReference, body ) );
+                std::bind( &Body::getBodyDeformationModelsReference, body.get( ) ) );
 
     if( stationMotionSettings.size( ) == 0 )
     {
@@ -9,10 +9,19 @@
  */
 
 
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
 #include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/fullPlanetaryRotationModel.h"
 #include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
 #include "tudat/interface/spice/spiceRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/nativeSpiceEphemeris.h"
 #include "tudat/simulation/environment_setup/createFlightConditions.h"
 #include "tudat/simulation/environment_setup/createRotationModel.h"
 #include "tudat/astro/ephemerides/directionBasedRotationalEphemeris.h"
@@ -25,6 +34,8 @@
 
 #include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/customRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/precomputedRotationalEphemeris.h"
+#include "tudat/simulation/environment_setup/ephemerisStateCache.h"
 
 namespace tudat
 {
@@ -402,6 +413,182 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createTrimmedAerodynamicAngl
     return rotationModel;
 }
 
+//! Function to append a value, printed without loss of precision, to an identifier string
+template< typename ValueType >
+static void appendToIdentifier( std::ostringstream& identifier, const ValueType& value )
+{
+    identifier << ";" << std::setprecision( std::numeric_limits< double >::max_digits10 ) << value;
+}
+
+//! Function to append a file name, with the size and a hash of the file contents, to an identifier string
+static void appendFileToIdentifier( std::ostringstream& identifier, const std::string& fileName )
+{
+    identifier << ";" << fileName;
+    std::ifstream fileStream( fileName, std::ios::binary );
+    if( !fileStream.good( ) )
+    {
+        identifier << ":missing";
+        return;
+    }
+
+    // Compute 64-bit FNV-1a hash of file contents
+    std::uint64_t fileHash = 14695981039346656037ULL;
+    std::uint64_t fileSize = 0;
+    std::vector< char > buffer( 1 << 16 );
+    while( fileStream.read( buffer.data( ), buffer.size( ) ) || fileStream.gcount( ) > 0 )
+    {
+        for( std::streamsize i = 0; i < fileStream.gcount( ); i++ )
+        {
+            fileHash ^= static_cast< unsigned char >( buffer[ i ] );
+            fileHash *= 1099511628211ULL;
+        }
+        fileSize += fileStream.gcount( );
+    }
+    identifier << ":" << fileSize << ":" << std::hex << fileHash << std::dec;
+}
+
+//! Function to append interpolator generation settings to an identifier string
+static void appendInterpolatorSettingsToIdentifier(
+        std::ostringstream& identifier,
+        const std::shared_ptr< interpolators::InterpolatorGenerationSettings< double > > interpolatorSettings )
+{
+    if( interpolatorSettings == nullptr )
+    {
+        identifier << ";none";
+        return;
+    }
+
+    appendToIdentifier( identifier, interpolatorSettings->initialTime_ );
+    appendToIdentifier( identifier, interpolatorSettings->finalTime_ );
+    appendToIdentifier( identifier, interpolatorSettings->timeStep_ );
+    std::shared_ptr< interpolators::InterpolatorSettings > settings = interpolatorSettings->interpolatorSettings_;
+    appendToIdentifier( identifier, settings->getInterpolatorType( ) );
+    appendToIdentifier( identifier, settings->getSelectedLookupScheme( ) );
+    for( auto boundaryHandling : settings->getBoundaryHandling( ) )
+    {
+        appendToIdentifier( identifier, boundaryHandling );
+    }
+
+    std::shared_ptr< interpolators::LagrangeInterpolatorSettings > lagrangeSettings =
+            std::dynamic_pointer_cast< interpolators::LagrangeInterpolatorSettings >( settings );
+    if( lagrangeSettings != nullptr )
+    {
+        appendToIdentifier( identifier, lagrangeSettings->getInterpolatorOrder( ) );
+        appendToIdentifier( identifier, lagrangeSettings->getLagrangeBoundaryHandling( ) );
+    }
+}
+
+//! Function to append short-period EOP correction settings to an identifier string
+static void appendEopCorrectionSettingsToIdentifier(
+        std::ostringstream& identifier,
+        const std::shared_ptr< EopCorrectionSettings > correctionSettings )
+{
+    appendToIdentifier( identifier, correctionSettings->conversionFactor_ );
+    appendToIdentifier( identifier, correctionSettings->minimumAmplitude_ );
+    appendToIdentifier( identifier, correctionSettings->useIncrementalEvaluation_ );
+    appendToIdentifier( identifier, correctionSettings->maximumIncrementalTimeStep_ );
+    appendToIdentifier( identifier, correctionSettings->maximumNumberOfIncrementalSteps_ );
+    for( unsigned int i = 0; i < correctionSettings->amplitudesFiles_.size( ); i++ )
+    {
+        appendFileToIdentifier( identifier, correctionSettings->amplitudesFiles_.at( i ) );
+    }
+    for( unsigned int i = 0; i < correctionSettings->argumentMultipliersFile_.size( ); i++ )
+    {
+        appendFileToIdentifier( identifier, correctionSettings->argumentMultipliersFile_.at( i ) );
+    }
+}
+
+//! Function to create a string identifying the rotation model from which a precomputed rotation model is computed
+/*!
+ *  Function to create a string identifying the rotation model from which a precomputed rotation model is computed,
+ *  which is stored with a cached table, and compared to that of the current settings when loading the table. The
+ *  identifier contains all settings of the underlying model, as well as the size and a hash of the contents of all
+ *  files from which it is created. As this is only possible for rotation models that are fully defined by their
+ *  settings and input files, an error is thrown for any other type of underlying model (e.g. SPICE rotation models,
+ *  which depend on the kernels loaded in the SPICE pool, or custom rotation models).
+ *  \param underlyingRotationModelSettings Settings of the rotation model from which the table is computed
+ *  \param nominalRotationRate Rate of the rotation about the target frame z-axis that is factored out before
+ *  interpolation (NaN if determined from the underlying model)
+ *  \return String identifying the underlying rotation model
+ */
+std::string getPrecomputedRotationSourceIdentifier(
+        const std::shared_ptr< RotationModelSettings > underlyingRotationModelSettings,
+        const double nominalRotationRate )
+{
+    std::ostringstream sourceIdentifier;
+    sourceIdentifier << underlyingRotationModelSettings->getRotationType( ) << ";" <<
+                        underlyingRotationModelSettings->getOriginalFrame( ) << ";" <<
+                        underlyingRotationModelSettings->getTargetFrame( );
+    appendToIdentifier( sourceIdentifier, nominalRotationRate );
+
+    switch( underlyingRotationModelSettings->getRotationType( ) )
+    {
+    case simple_rotation_model:
+    {
+        std::shared_ptr< SimpleRotationModelSettings > simpleRotationSettings =
+                std::dynamic_pointer_cast< SimpleRotationModelSettings >( underlyingRotationModelSettings );
+        if( simpleRotationSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected simple rotation model settings for precomputed rotation model" );
+        }
+        Eigen::Quaterniond initialOrientation = simpleRotationSettings->getInitialOrientation( );
+        appendToIdentifier( sourceIdentifier, initialOrientation.w( ) );
+        appendToIdentifier( sourceIdentifier, initialOrientation.x( ) );
+        appendToIdentifier( sourceIdentifier, initialOrientation.y( ) );
+        appendToIdentifier( sourceIdentifier, initialOrientation.z( ) );
+        appendToIdentifier( sourceIdentifier, simpleRotationSettings->getInitialTime( ) );
+        appendToIdentifier( sourceIdentifier, simpleRotationSettings->getRotationRate( ) );
+        break;
+    }
+    case native_spice_rotation_model:
+    {
+        std::shared_ptr< NativeSpiceRotationModelSettings > nativeSpiceRotationSettings =
+                std::dynamic_pointer_cast< NativeSpiceRotationModelSettings >( underlyingRotationModelSettings );
+        if( nativeSpiceRotationSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected native SPICE rotation model settings for precomputed rotation model" );
+        }
+        sourceIdentifier << ";" << nativeSpiceRotationSettings->getPckFrameName( );
+        std::vector< std::string > kernelFiles = nativeSpiceRotationSettings->getKernelFiles( );
+        for( unsigned int i = 0; i < kernelFiles.size( ); i++ )
+        {
+            appendFileToIdentifier( sourceIdentifier, kernelFiles.at( i ) );
+        }
+        break;
+    }
+    case gcrs_to_itrs_rotation_model:
+    {
+        std::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationSettings =
+                std::dynamic_pointer_cast< GcrsToItrsRotationModelSettings >( underlyingRotationModelSettings );
+        if( gcrsToItrsRotationSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected GCRS to ITRS rotation model settings for precomputed rotation model" );
+        }
+        appendToIdentifier( sourceIdentifier, gcrsToItrsRotationSettings->getNutationTheory( ) );
+        appendToIdentifier( sourceIdentifier, gcrsToItrsRotationSettings->getInputTimeScale( ) );
+        sourceIdentifier << ";" << gcrsToItrsRotationSettings->getEopFileFormat( );
+        appendFileToIdentifier( sourceIdentifier, gcrsToItrsRotationSettings->getEopFile( ) );
+        appendEopCorrectionSettingsToIdentifier(
+                    sourceIdentifier, gcrsToItrsRotationSettings->getUt1CorrectionSettings( ) );
+        appendEopCorrectionSettingsToIdentifier(
+                    sourceIdentifier, gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( ) );
+        appendInterpolatorSettingsToIdentifier(
+                    sourceIdentifier, gcrsToItrsRotationSettings->getCioInterpolatorSettings( ) );
+        appendInterpolatorSettingsToIdentifier(
+                    sourceIdentifier, gcrsToItrsRotationSettings->getTdbToTtInterpolatorSettings( ) );
+        appendInterpolatorSettingsToIdentifier(
+                    sourceIdentifier, gcrsToItrsRotationSettings->getShortTermInterpolatorSettings( ) );
+        break;
+    }
+    default:
+        throw std::runtime_error(
+                    "Error, precomputed rotation model can only be cached to file for simple, native SPICE and "
+                    "GCRS to ITRS underlying rotation models, found type " +
+                    std::to_string( underlyingRotationModelSettings->getRotationType( ) ) );
+    }
+    return sourceIdentifier.str( );
+}
+
 //! Function to create a rotation model.
 std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         const std::shared_ptr< RotationModelSettings > rotationModelSettings,
@@ -482,6 +669,10 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
                         gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->argumentMultipliersFile_,
                         std::bind( &sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ),
                         gcrsToItrsRotationSettings->getShortTermInterpolatorSettings( ) );
+            shortPeriodPolarMotionCalculator->setIncrementalEvaluation(
+                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->useIncrementalEvaluation_,
+                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->maximumIncrementalTimeStep_,
+                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->maximumNumberOfIncrementalSteps_ );
 
             // Create full polar motion calculator
             std::shared_ptr< earth_orientation::PolarMotionCalculator > polarMotionCalculator =
@@ -504,6 +695,10 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
                         gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->argumentMultipliersFile_,
                         std::bind( &sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst, std::placeholders::_1 ),
                         gcrsToItrsRotationSettings->getShortTermInterpolatorSettings( ) );
+            ut1CorrectionSettings->setIncrementalEvaluation(
+                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->useIncrementalEvaluation_,
+                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->maximumIncrementalTimeStep_,
+                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->maximumNumberOfIncrementalSteps_ );
 
             std::shared_ptr< interpolators::OneDimensionalInterpolator < double, double > > dailyUtcUt1CorrectionInterpolator =
                     std::make_shared< interpolators::JumpDataLinearInterpolator< double, double > >(
@@ -544,6 +739,23 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
                     spiceFrameName );
         break;
     }
+    case native_spice_rotation_model:
+    {
+        std::shared_ptr< NativeSpiceRotationModelSettings > nativeRotationModelSettings =
+            std::dynamic_pointer_cast< NativeSpiceRotationModelSettings >( rotationModelSettings );
+        if( nativeRotationModelSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected native spice rotation model settings for " + body );
+        }
+
+        // Create rotational ephemeris from kernels, with frame class code retrieved once, here.
+        rotationalEphemeris = std::make_shared< NativeSpiceRotationalEphemeris >(
+                    input_output::getSpiceKernelCollection( nativeRotationModelSettings->getKernelFiles( ) ),
+                    spice_interface::getPckFrameClassIdFromName( nativeRotationModelSettings->getPckFrameName( ) ),
+                    rotationModelSettings->getOriginalFrame( ),
+                    rotationModelSettings->getTargetFrame( ) );
+        break;
+    }
     case planetary_rotation_model:
     {
         std::shared_ptr< PlanetaryRotationModelSettings > planetaryRotationModelSettings =
@@ -793,6 +1005,87 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         break;
     }
 
+    case precomputed_rotation_model:
+    {
+        std::shared_ptr< PrecomputedRotationModelSettings > precomputedRotationSettings =
+                std::dynamic_pointer_cast< PrecomputedRotationModelSettings >( rotationModelSettings );
+        if( precomputedRotationSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected precomputed rotation model settings for " + body );
+        }
+
+        std::shared_ptr< RotationModelSettings > underlyingRotationModelSettings =
+                precomputedRotationSettings->getUnderlyingRotationModelSettings( );
+        std::string cacheFile = precomputedRotationSettings->getCacheFile( );
+        std::string sourceIdentifier;
+        if( cacheFile != "" )
+        {
+            sourceIdentifier = getPrecomputedRotationSourceIdentifier(
+                        underlyingRotationModelSettings, precomputedRotationSettings->getNominalRotationRate( ) );
+        }
+
+        // Load table from file, if it is consistent with current settings
+        std::shared_ptr< PrecomputedRotationalEphemeris > precomputedRotationModel;
+        if( cacheFile != "" && boost::filesystem::exists( cacheFile ) )
+        {
+            std::string fileSourceIdentifier;
+            std::shared_ptr< PrecomputedRotationalEphemeris > fileRotationModel =
+                    readPrecomputedRotationalEphemerisFromFile( cacheFile, fileSourceIdentifier );
+            double maximumInterpolationError = precomputedRotationSettings->getMaximumInterpolationError( );
+            if( fileSourceIdentifier == sourceIdentifier &&
+                    fileRotationModel->getBaseFrameOrientation( ) == rotationModelSettings->getOriginalFrame( ) &&
+                    fileRotationModel->getTargetFrameOrientation( ) == rotationModelSettings->getTargetFrame( ) &&
+                    fileRotationModel->getTableStartTime( ) == precomputedRotationSettings->getStartTime( ) &&
+                    fileRotationModel->getTableTimeStep( ) == precomputedRotationSettings->getTimeStep( ) &&
+                    fileRotationModel->getTableEndTime( ) >= precomputedRotationSettings->getEndTime( ) &&
+                    ( std::isnan( maximumInterpolationError ) ||
+                      fileRotationModel->getMaximumInterpolationError( ) <= maximumInterpolationError ) )
+            {
+                precomputedRotationModel = fileRotationModel;
+            }
+        }
+
+        // Compute table from underlying model, which must depend on time only
+        if( precomputedRotationModel == nullptr )
+        {
+            std::function< std::shared_ptr< RotationalEphemeris >( ) > sourceRotationModelCreationFunction =
+                    [ & ]( )
+            {
+                std::shared_ptr< RotationalEphemeris > sourceRotationModel =
+                        createRotationModel( underlyingRotationModelSettings, body, bodies );
+                if( !isRotationalEphemerisCacheable( sourceRotationModel ) )
+                {
+                    throw std::runtime_error( "Error when creating precomputed rotation model for " + body +
+                                              ", underlying rotation model does not depend on time only." );
+                }
+                return sourceRotationModel;
+            };
+
+            double nominalRotationRate = precomputedRotationSettings->getNominalRotationRate( );
+            if( std::isnan( nominalRotationRate ) &&
+                    underlyingRotationModelSettings->getRotationType( ) == gcrs_to_itrs_rotation_model )
+            {
+                nominalRotationRate = EARTH_ROTATION_ANGLE_RATE;
+            }
+
+            precomputedRotationModel = createPrecomputedRotationalEphemeris(
+                        sourceRotationModelCreationFunction,
+                        precomputedRotationSettings->getStartTime( ),
+                        precomputedRotationSettings->getEndTime( ),
+                        precomputedRotationSettings->getTimeStep( ),
+                        precomputedRotationSettings->getMaximumInterpolationError( ),
+                        precomputedRotationSettings->getNumberOfThreads( ),
+                        nominalRotationRate );
+
+            if( cacheFile != "" )
+            {
+                writePrecomputedRotationalEphemerisToFile( precomputedRotationModel, cacheFile, sourceIdentifier );
+            }
+        }
+        rotationalEphemeris = precomputedRotationModel;
+        break;
+    }
+
     default:
         throw std::runtime_error(
                     "Error, did not recognize rotation model settings type " +
@@ -0,0 +1,66 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/ephemerides/aeordynamicAngleRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/compositeEphemeris.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/customEphemeris.h"
+#include "tudat/astro/ephemerides/customRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/directionBasedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
+#include "tudat/simulation/environment_setup/ephemerisStateCache.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Function to check whether the state computed by an ephemeris may be cached
+bool isEphemerisCacheable( const std::shared_ptr< ephemerides::Ephemeris > ephemeris )
+{
+    bool isCacheable = true;
+    if( ephemeris == nullptr )
+    {
+        isCacheable = false;
+    }
+    // Ephemerides defined by (user-defined or environment-dependent) functions are not cached
+    else if( std::dynamic_pointer_cast< ephemerides::CustomEphemeris >( ephemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::ConstantEphemeris >( ephemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::CompositeEphemeris< double, double > >( ephemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::CompositeEphemeris< Time, long double > >( ephemeris ) != nullptr )
+    {
+        isCacheable = false;
+    }
+    return isCacheable;
+}
+
+//! Function to check whether the rotation computed by a rotational ephemeris may be cached
+bool isRotationalEphemerisCacheable( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris )
+{
+    bool isCacheable = true;
+    if( rotationalEphemeris == nullptr )
+    {
+        isCacheable = false;
+    }
+    // Rotation models that depend on the current state of the environment are not cached
+    else if( std::dynamic_pointer_cast< ephemerides::AerodynamicAngleRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::DirectionBasedRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::SynchronousRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::CustomRotationalEphemeris >( rotationalEphemeris ) != nullptr )
+    {
+        isCacheable = false;
+    }
+    return isCacheable;
+}
+
+} // namespace simulation_setup
+
+} // namespace tudat
@@ -0,0 +1,190 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/simulation/estimation_setup/columnarObservations.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Function to append a fixed-size value to serialized metadata
+template< typename ValueType >
+void appendMetadataValue( std::string& metadata, const ValueType value )
+{
+    metadata.append( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+}
+
+//! Function to append a string (preceded by its length) to serialized metadata
+void appendMetadataString( std::string& metadata, const std::string& value )
+{
+    appendMetadataValue< uint32_t >( metadata, value.size( ) );
+    metadata.append( value );
+}
+
+//! Function to read a fixed-size value from serialized metadata, and advance the current position
+template< typename ValueType >
+ValueType readMetadataValue( const char* metadata, const std::size_t metadataSize, std::size_t& currentPosition )
+{
+    if( sizeof( ValueType ) > metadataSize - currentPosition )
+    {
+        throw std::runtime_error( "Error when parsing columnar observation metadata, metadata is truncated." );
+    }
+    ValueType value;
+    std::memcpy( &value, metadata + currentPosition, sizeof( ValueType ) );
+    currentPosition += sizeof( ValueType );
+    return value;
+}
+
+//! Function to read a string (preceded by its length) from serialized metadata, and advance the current position
+std::string readMetadataString( const char* metadata, const std::size_t metadataSize, std::size_t& currentPosition )
+{
+    uint32_t stringSize = readMetadataValue< uint32_t >( metadata, metadataSize, currentPosition );
+    if( stringSize > metadataSize - currentPosition )
+    {
+        throw std::runtime_error( "Error when parsing columnar observation metadata, metadata is truncated." );
+    }
+    std::string value( metadata + currentPosition, stringSize );
+    currentPosition += stringSize;
+    return value;
+}
+
+//! Function to serialize the link ends and ancillary settings of a columnar observation collection
+std::string serializeColumnarObservationMetadata(
+        const std::vector< LinkEnds >& linkEndsList,
+        const std::vector< std::shared_ptr< ObservationAncilliarySimulationSettings > >& ancillarySettingsList )
+{
+    std::string metadata;
+
+    // Serialize link ends, as (link end type, body name, station name) per link end
+    appendMetadataValue< uint32_t >( metadata, linkEndsList.size( ) );
+    for( unsigned int i = 0; i < linkEndsList.size( ); i++ )
+    {
+        appendMetadataValue< uint32_t >( metadata, linkEndsList.at( i ).size( ) );
+        for( auto linkEndIterator : linkEndsList.at( i ) )
+        {
+            std::pair< std::string, std::string > linkEndNames = linkEndIterator.second.getDualStringLinkEnd( );
+            appendMetadataValue< int32_t >( metadata, static_cast< int32_t >( linkEndIterator.first ) );
+            appendMetadataString( metadata, linkEndNames.first );
+            appendMetadataString( metadata, linkEndNames.second );
+        }
+    }
+
+    // Serialize ancillary settings, as lists of (variable type, value) for double and double vector data
+    const std::vector< ObservationAncilliarySimulationVariable > doubleVariables =
+            { doppler_integration_time, doppler_reference_frequency, reception_reference_frequency_band };
+    const std::vector< ObservationAncilliarySimulationVariable > doubleVectorVariables =
+            { link_ends_delays, frequency_bands };
+    appendMetadataValue< uint32_t >( metadata, ancillarySettingsList.size( ) );
+    for( unsigned int i = 0; i < ancillarySettingsList.size( ); i++ )
+    {
+        std::vector< std::pair< int32_t, double > > doubleData;
+        for( unsigned int j = 0; j < doubleVariables.size( ); j++ )
+        {
+            double currentValue = ancillarySettingsList.at( i )->getAncilliaryDoubleData( doubleVariables.at( j ), false );
+            if( currentValue == currentValue )
+            {
+                doubleData.push_back( std::make_pair( static_cast< int32_t >( doubleVariables.at( j ) ), currentValue ) );
+            }
+        }
+        appendMetadataValue< uint32_t >( metadata, doubleData.size( ) );
+        for( unsigned int j = 0; j < doubleData.size( ); j++ )
+        {
+            appendMetadataValue< int32_t >( metadata, doubleData.at( j ).first );
+            appendMetadataValue< double >( metadata, doubleData.at( j ).second );
+        }
+
+        std::vector< std::pair< int32_t, std::vector< double > > > doubleVectorData;
+        for( unsigned int j = 0; j < doubleVectorVariables.size( ); j++ )
+        {
+            std::vector< double > currentValue = ancillarySettingsList.at( i )->getAncilliaryDoubleVectorData(
+                        doubleVectorVariables.at( j ), false );
+            if( currentValue.size( ) > 0 )
+            {
+                doubleVectorData.push_back( std::make_pair( static_cast< int32_t >( doubleVectorVariables.at( j ) ), currentValue ) );
+            }
+        }
+        appendMetadataValue< uint32_t >( metadata, doubleVectorData.size( ) );
+        for( unsigned int j = 0; j < doubleVectorData.size( ); j++ )
+        {
+            appendMetadataValue< int32_t >( metadata, doubleVectorData.at( j ).first );
+            appendMetadataValue< uint32_t >( metadata, doubleVectorData.at( j ).second.size( ) );
+            for( unsigned int k = 0; k < doubleVectorData.at( j ).second.size( ); k++ )
+            {
+                appendMetadataValue< double >( metadata, doubleVectorData.at( j ).second.at( k ) );
+            }
+        }
+    }
+    return metadata;
+}
+
+//! Function to parse the link ends and ancillary settings of a columnar observation collection
+void parseColumnarObservationMetadata(
+        const char* metadata,
+        const std::size_t metadataSize,
+        std::vector< LinkEnds >& linkEndsList,
+        std::vector< std::shared_ptr< ObservationAncilliarySimulationSettings > >& ancillarySettingsList )
+{
+    std::size_t currentPosition = 0;
+
+    linkEndsList.clear( );
+    uint32_t numberOfLinkEnds = readMetadataValue< uint32_t >( metadata, metadataSize, currentPosition );
+    for( unsigned int i = 0; i < numberOfLinkEnds; i++ )
+    {
+        LinkEnds currentLinkEnds;
+        uint32_t numberOfLinkEndEntries = readMetadataValue< uint32_t >( metadata, metadataSize, currentPosition );
+        for( unsigned int j = 0; j < numberOfLinkEndEntries; j++ )
+        {
+            LinkEndType linkEndType = static_cast< LinkEndType >(
+                        readMetadataValue< int32_t >( metadata, metadataSize, currentPosition ) );
+            std::string bodyName = readMetadataString( metadata, metadataSize, currentPosition );
+            std::string stationName = readMetadataString( metadata, metadataSize, currentPosition );
+            currentLinkEnds[ linkEndType ] = LinkEndId( bodyName, stationName );
+        }
+        linkEndsList.push_back( currentLinkEnds );
+    }
+
+    ancillarySettingsList.clear( );
+    uint32_t numberOfAncillarySettings = readMetadataValue< uint32_t >( metadata, metadataSize, currentPosition );
+    for( unsigned int i = 0; i < numberOfAncillarySettings; i++ )
+    {
+        std::shared_ptr< ObservationAncilliarySimulationSettings > currentAncillarySettings =
+                std::make_shared< ObservationAncilliarySimulationSettings >( );
+
+        uint32_t numberOfDoubleData = readMetadataValue< uint32_t >( metadata, metadataSize, currentPosition );
+        for( unsigned int j = 0; j < numberOfDoubleData; j++ )
+        {
+            ObservationAncilliarySimulationVariable variableType = static_cast< ObservationAncilliarySimulationVariable >(
+                        readMetadataValue< int32_t >( metadata, metadataSize, currentPosition ) );
+            currentAncillarySettings->setAncilliaryDoubleData(
+                        variableType, readMetadataValue< double >( metadata, metadataSize, currentPosition ) );
+        }
+
+        uint32_t numberOfDoubleVectorData = readMetadataValue< uint32_t >( metadata, metadataSize, currentPosition );
+        for( unsigned int j = 0; j < numberOfDoubleVectorData; j++ )
+        {
+            ObservationAncilliarySimulationVariable variableType = static_cast< ObservationAncilliarySimulationVariable >(
+                        readMetadataValue< int32_t >( metadata, metadataSize, currentPosition ) );
+            uint32_t vectorSize = readMetadataValue< uint32_t >( metadata, metadataSize, currentPosition );
+            std::vector< double > currentVector;
+            for( unsigned int k = 0; k < vectorSize; k++ )
+            {
+                currentVector.push_back( readMetadataValue< double >( metadata, metadataSize, currentPosition ) );
+            }
+            currentAncillarySettings->setAncilliaryDoubleVectorData( variableType, currentVector );
+        }
+        ancillarySettingsList.push_back( currentAncillarySettings );
+    }
+}
+
+} // namespace observation_models
+
+} // namespace tudat
@@ -168,39 +168,50 @@ observation_models::LinkEnds getLinkEndsFromOdfBlock (
         const std::shared_ptr< input_output::OdfDataBlock > dataBlock,
         std::string spacecraftName )
 {
-    int currentObservableId = dataBlock->getObservableSpecificDataBlock( )->dataType_;
+    return getLinkEndsFromOdfIds(
+            dataBlock->getObservableSpecificDataBlock( )->dataType_,
+            dataBlock->getCommonDataBlock( )->transmittingStationNetworkId_,
+            dataBlock->getCommonDataBlock( )->transmittingStationId_,
+            dataBlock->getCommonDataBlock( )->receivingStationId_,
+            spacecraftName );
+}
 
+observation_models::LinkEnds getLinkEndsFromOdfIds (
+        const int odfDataType,
+        const int transmittingStationNetworkId,
+        const int transmittingStationId,
+        const int receivingStationId,
+        const std::string& spacecraftName )
+{
     observation_models::LinkEnds linkEnds;
 
-    if ( currentObservableId == 11 )
+    if ( odfDataType == 11 )
     {
         linkEnds[ observation_models::transmitter ] = observation_models::LinkEndId ( spacecraftName, "Antenna" );
         linkEnds[ observation_models::receiver ] = observation_models::LinkEndId ( "Earth", getStationNameFromStationId(
-                0, dataBlock->getCommonDataBlock( )->receivingStationId_ ) );
+                0, receivingStationId ) );
     }
-    else if ( currentObservableId == 12 )
+    else if ( odfDataType == 12 )
     {
         linkEnds[ observation_models::transmitter ] = observation_models::LinkEndId (
-                "Earth", getStationNameFromStationId( dataBlock->getCommonDataBlock( )->transmittingStationNetworkId_,
-                                                      dataBlock->getCommonDataBlock( )->transmittingStationId_ ) );
+                "Earth", getStationNameFromStationId( transmittingStationNetworkId, transmittingStationId ) );
         linkEnds[ observation_models::reflector1 ] = observation_models::LinkEndId ( spacecraftName, "Antenna" );
         linkEnds[ observation_models::receiver ] = observation_models::LinkEndId (
-                "Earth", getStationNameFromStationId( 0, dataBlock->getCommonDataBlock( )->receivingStationId_ ) );
+                "Earth", getStationNameFromStationId( 0, receivingStationId ) );
     }
-    else if ( currentObservableId == 13 )
+    else if ( odfDataType == 13 )
     {
         linkEnds[ observation_models::transmitter ] = observation_models::LinkEndId (
-                "Earth", getStationNameFromStationId( dataBlock->getCommonDataBlock( )->transmittingStationNetworkId_,
-                                                      dataBlock->getCommonDataBlock( )->transmittingStationId_ ) );
+                "Earth", getStationNameFromStationId( transmittingStationNetworkId, transmittingStationId ) );
         linkEnds[ observation_models::reflector1 ] = observation_models::LinkEndId ( spacecraftName, "Antenna" );
         linkEnds[ observation_models::receiver ] = observation_models::LinkEndId (
-                "Earth", getStationNameFromStationId( 0, dataBlock->getCommonDataBlock( )->receivingStationId_ ) );
+                "Earth", getStationNameFromStationId( 0, receivingStationId ) );
     }
     else
     {
         throw std::runtime_error(
                 "Error when getting link ends from ODF data blocks, data type " +
-                std::to_string( currentObservableId ) + " not recognized." );
+                std::to_string( odfDataType ) + " not recognized." );
     }
 
     return linkEnds;
@@ -322,6 +333,12 @@ bool compareRawOdfDataByStartDate( std::shared_ptr< input_output::OdfRawFileCont
     }
 }
 
+bool compareColumnarOdfDataByStartDate( std::shared_ptr< input_output::OdfColumnarFileContents > columnarOdfData1,
+                                        std::shared_ptr< input_output::OdfColumnarFileContents > columnarOdfData2 )
+{
+    return columnarOdfData1->observableTimes_.at( 0 ) < columnarOdfData2->observableTimes_.at( 0 );
+}
+
 void ProcessedOdfFileContents::sortAndValidateOdfDataVector(
         std::vector< std::shared_ptr< input_output::OdfRawFileContents > >& rawOdfDataVector )
 {
@@ -341,13 +358,31 @@ void ProcessedOdfFileContents::sortAndValidateOdfDataVector(
     std::stable_sort( rawOdfDataVector.begin( ), rawOdfDataVector.end( ), &compareRawOdfDataByStartDate );
 }
 
-bool ProcessedOdfFileContents::isObservationValid(
-        std::shared_ptr< input_output::OdfDataBlock > rawDataBlock,
-        observation_models::LinkEnds linkEnds,
-        observation_models::ObservableType currentObservableType )
+void ProcessedOdfFileContents::sortAndValidateOdfDataVector(
+        std::vector< std::shared_ptr< input_output::OdfColumnarFileContents > >& columnarOdfDataVector )
 {
-    int currentObservableId = rawDataBlock->getObservableSpecificDataBlock( )->dataType_;
+    unsigned int spacecraftId = columnarOdfDataVector.front( )->spacecraftId_;
 
+    for ( unsigned int i = 0; i < columnarOdfDataVector.size( ); ++i )
+    {
+        // Check if spacecraft ID is valid
+        if ( columnarOdfDataVector.at( i )->spacecraftId_ != spacecraftId )
+        {
+            throw std::runtime_error( "Error when creating processed ODF object from columnar data: multiple spacecraft IDs"
+                                      "found (" + std::to_string( spacecraftId ) + " and " +
+                                      std::to_string( columnarOdfDataVector.at( i )->spacecraftId_ ) + ")." );
+        }
+    }
+
+    std::stable_sort( columnarOdfDataVector.begin( ), columnarOdfDataVector.end( ), &compareColumnarOdfDataByStartDate );
+}
+
+bool ProcessedOdfFileContents::isObservationValid(
+        const double observableTime,
+        const int currentObservableId,
+        const observation_models::LinkEnds& linkEnds,
+        const observation_models::ObservableType currentObservableType )
+{
     std::string transmittingStation, receivingStation;
 
     if ( requiresTransmittingStation( currentObservableType ) )
@@ -366,12 +401,11 @@ bool ProcessedOdfFileContents::isObservationValid(
                         " ignoring corresponding data." << std::endl;
                 }
             }
-            ignoredOdfRawDataBlocks_.push_back( rawDataBlock );
             return false;
         }
 
         // Check if observation time is covered by ramp tables
-        if ( rawDataBlock->getCommonDataBlock( )->getObservableTime( ) <
+        if ( observableTime <
             unprocessedRampStartTimesPerStation_[ transmittingStation ].front( ) )
         {
             if ( verbose_ )
@@ -379,7 +413,6 @@ bool ProcessedOdfFileContents::isObservationValid(
                 std::cerr << "Warning: observation of ODF type " << currentObservableId << " not covered by ramp table of station " <<
                     transmittingStation << ", ignoring it." << std::endl;
             }
-            ignoredOdfRawDataBlocks_.push_back( rawDataBlock );
             return false;
         }
     }
@@ -399,20 +432,18 @@ bool ProcessedOdfFileContents::isObservationValid(
                         receivingStation << ", ignoring it." << std::endl;
                 }
             }
-            ignoredOdfRawDataBlocks_.push_back( rawDataBlock );
             return false;
         }
 
         // Check if observation time is covered by ramp tables
-        if ( rawDataBlock->getCommonDataBlock( )->getObservableTime( ) < unprocessedRampStartTimesPerStation_[ receivingStation ].front( ) ||
-            rawDataBlock->getCommonDataBlock( )->getObservableTime( ) > unprocessedRampStartTimesPerStation_[ receivingStation ].back( ) )
+        if ( observableTime < unprocessedRampStartTimesPerStation_[ receivingStation ].front( ) ||
+            observableTime > unprocessedRampStartTimesPerStation_[ receivingStation ].back( ) )
         {
             if ( verbose_ )
             {
                 std::cerr << "Warning: observation of ODF type " << currentObservableId << " not covered by ramp tables," <<
                     " ignoring it." << std::endl;
             }
-            ignoredOdfRawDataBlocks_.push_back( rawDataBlock );
             return false;
         }
     }
@@ -458,7 +489,8 @@ void ProcessedOdfFileContents::extractRawOdfOrbitData(
                 rawDataBlocks.at( i ), spacecraftName_ );
 
         // Check if observation is valid and should be processed
-        if ( isObservationValid( rawDataBlocks.at( i ), linkEnds, currentObservableType ) )
+        if ( isObservationValid( rawDataBlocks.at( i )->getCommonDataBlock( )->getObservableTime( ), currentObservableId,
+                                 linkEnds, currentObservableType ) )
         {
             // Check if data object already exists for current observable/link ends
             bool createNewObject = false;
@@ -482,30 +514,157 @@ void ProcessedOdfFileContents::extractRawOdfOrbitData(
                     rawDataBlocks.at( i ), processedDataBlocks_[ currentObservableType ][ linkEnds ],
                     rawOdfData->fileName_ );
         }
+        else
+        {
+            ignoredOdfRawDataBlocks_.push_back( rawDataBlocks.at( i ) );
+        }
     }
 
 }
 
-void ProcessedOdfFileContents::extractMultipleRawOdfRampData(
-        std::vector< std::shared_ptr< input_output::OdfRawFileContents > > rawOdfDataVector )
+void ProcessedOdfFileContents::extractColumnarOdfOrbitData(
+        std::shared_ptr< input_output::OdfColumnarFileContents > columnarOdfData )
 {
+    // Observable type (or ignored status) per ODF data type, and processed data object per (data type, transmitting
+    // network, transmitting station, receiving station), determined once instead of per observation
+    std::map< int, std::pair< bool, observation_models::ObservableType > > observableTypePerOdfId;
+    std::map< std::tuple< int, int, int, int >, std::pair< observation_models::LinkEnds,
+        std::shared_ptr< ProcessedOdfFileDopplerData > > > processedDataPerOdfLink;
 
-    std::map< std::string, std::vector< double > > rampRatesPerStation, startFrequenciesPerStation;
+    for( unsigned int i = 0; i < columnarOdfData->getNumberOfDataRecords( ); i++ )
+    {
+        int currentObservableId = columnarOdfData->dataTypes_.at( i );
 
+        // Get current observable type and throw warning if not implemented
+        if ( observableTypePerOdfId.count( currentObservableId ) == 0 )
+        {
+            try
+            {
+                observableTypePerOdfId[ currentObservableId ] =
+                        std::make_pair( true, getObservableTypeForOdfId( currentObservableId ) );
+            }
+            catch( const std::runtime_error& )
+            {
+                observableTypePerOdfId[ currentObservableId ] = std::make_pair( false, observation_models::undefined_observation_model );
+                if ( std::find( ignoredRawOdfObservableTypes_.begin( ), ignoredRawOdfObservableTypes_.end( ),
+                                currentObservableId ) == ignoredRawOdfObservableTypes_.end( ) )
+                {
+                    ignoredRawOdfObservableTypes_.push_back( currentObservableId );
+                    if ( verbose_ )
+                    {
+                        std::cerr << "Warning: processing of ODF data type " << currentObservableId <<
+                            " is not implemented, ignoring the corresponding data." << std::endl;
+                    }
+                }
+            }
+        }
+        if ( !observableTypePerOdfId.at( currentObservableId ).first )
+        {
+            continue;
+        }
+        observation_models::ObservableType currentObservableType = observableTypePerOdfId.at( currentObservableId ).second;
+
+        // Retrieve link ends
+        std::tuple< int, int, int, int > currentOdfLink = std::make_tuple(
+                currentObservableId, columnarOdfData->transmittingStationNetworkIds_.at( i ),
+                columnarOdfData->transmittingStationIds_.at( i ), columnarOdfData->receivingStationIds_.at( i ) );
+        auto linkIterator = processedDataPerOdfLink.find( currentOdfLink );
+        if ( linkIterator == processedDataPerOdfLink.end( ) )
+        {
+            linkIterator = processedDataPerOdfLink.insert(
+                    std::make_pair( currentOdfLink, std::make_pair( getLinkEndsFromOdfIds(
+                            currentObservableId, std::get< 1 >( currentOdfLink ), std::get< 2 >( currentOdfLink ),
+                            std::get< 3 >( currentOdfLink ), spacecraftName_ ), nullptr ) ) ).first;
+        }
+        const observation_models::LinkEnds& linkEnds = linkIterator->second.first;
+
+        // Check if observation is valid and should be processed
+        if ( isObservationValid( columnarOdfData->observableTimes_.at( i ), currentObservableId, linkEnds, currentObservableType ) )
+        {
+            // Retrieve (or create) data object for current observable/link ends
+            if ( linkIterator->second.second == nullptr )
+            {
+                if ( processedDataBlocks_[ currentObservableType ].count( linkEnds ) == 0 )
+                {
+                    processedDataBlocks_[ currentObservableType ][ linkEnds ] = std::make_shared< ProcessedOdfFileDopplerData >(
+                            currentObservableType, linkEnds.at( receiver ).stationName_, linkEnds.at( transmitter ).stationName_ );
+                }
+                linkIterator->second.second = std::dynamic_pointer_cast< ProcessedOdfFileDopplerData >(
+                        processedDataBlocks_.at( currentObservableType ).at( linkEnds ) );
+            }
+            std::shared_ptr< ProcessedOdfFileDopplerData > processedData = linkIterator->second.second;
+
+            // Add properties to data block if data is valid
+            if ( columnarOdfData->validities_.at( i ) == 0 )
+            {
+                processedData->downlinkBandIds_.push_back( columnarOdfData->downlinkBandIds_.at( i ) );
+                processedData->uplinkBandIds_.push_back( columnarOdfData->uplinkBandIds_.at( i ) );
+                processedData->referenceBandIds_.push_back( columnarOdfData->referenceBandIds_.at( i ) );
+                processedData->unprocessedObservationTimes_.push_back( columnarOdfData->observableTimes_.at( i ) );
+                processedData->receiverDownlinkDelays_.push_back( columnarOdfData->receivingStationDownlinkDelays_.at( i ) );
+                processedData->originFiles_.push_back( columnarOdfData->fileName_ );
+
+                if ( currentObservableType == observation_models::dsn_n_way_averaged_doppler )
+                {
+                    processedData->observableValues_.push_back(
+                            ( Eigen::Matrix< double, 1, 1 >( ) << columnarOdfData->observableValues_.at( i ) ).finished( ) );
+                    processedData->countInterval_.push_back( columnarOdfData->compressionTimes_.at( i ) );
+                    processedData->receiverChannels_.push_back( columnarOdfData->receiverChannels_.at( i ) );
+                    processedData->receiverRampingFlags_.push_back( columnarOdfData->receiverExciterFlags_.at( i ) );
+                    processedData->referenceFrequencies_.push_back( columnarOdfData->referenceFrequencies_.at( i ) );
+                    processedData->transmitterUplinkDelays_.push_back(
+                            columnarOdfData->transmittingStationUplinkDelays_.at( i ) );
+                }
+            }
+        }
+    }
+}
+
+void ProcessedOdfFileContents::extractMultipleRawOdfRampData(
+        std::vector< std::shared_ptr< input_output::OdfRawFileContents > > rawOdfDataVector )
+{
+    // Convert ramp blocks to ramp data columns
+    std::vector< std::map< int, input_output::OdfRampColumns > > rampDataPerFile;
     for( unsigned int i = 0; i < rawOdfDataVector.size( ); ++i )
     {
+        std::map< int, input_output::OdfRampColumns > currentRampData;
         std::map< int, std::vector< std::shared_ptr< input_output::OdfRampBlock > > >
                 rampBlocksPerStation = rawOdfDataVector.at( i )->getRampBlocks( );
         for( auto it = rampBlocksPerStation.begin( ); it != rampBlocksPerStation.end( ); it++ )
+        {
+            input_output::OdfRampColumns& currentStationRampData = currentRampData[ it->first ];
+            for( unsigned int j = 0; j < it->second.size( ); j++ )
+            {
+                currentStationRampData.rampStartTimes_.push_back( it->second.at( j )->getRampStartTime( ) );
+                currentStationRampData.rampEndTimes_.push_back( it->second.at( j )->getRampEndTime( ) );
+                currentStationRampData.rampRates_.push_back( it->second.at( j )->getRampRate( ) );
+                currentStationRampData.rampStartFrequencies_.push_back( it->second.at( j )->getRampStartFrequency( ) );
+            }
+        }
+        rampDataPerFile.push_back( currentRampData );
+    }
+
+    extractMultipleOdfRampData( rampDataPerFile );
+}
+
+void ProcessedOdfFileContents::extractMultipleOdfRampData(
+        const std::vector< std::map< int, input_output::OdfRampColumns > >& rampDataPerFile )
+{
+
+    std::map< std::string, std::vector< double > > rampRatesPerStation, startFrequenciesPerStation;
+
+    for( unsigned int i = 0; i < rampDataPerFile.size( ); ++i )
+    {
+        for( auto it = rampDataPerFile.at( i ).begin( ); it != rampDataPerFile.at( i ).end( ); it++ )
         {
             std::string stationName = getStationNameFromStationId( 0, it->first );
 
-            std::vector< std::shared_ptr< input_output::OdfRampBlock > > rampBlocks = it->second;
+            const input_output::OdfRampColumns& rampData = it->second;
 
-            for( unsigned int j = 0; j < it->second.size( ); j++ )
+            for( unsigned int j = 0; j < rampData.rampStartTimes_.size( ); j++ )
             {
                 // Check if zero time ramp
-                if ( rampBlocks.at( j )->getRampStartTime( ) == rampBlocks.at( j )->getRampEndTime( ) )
+                if ( rampData.rampStartTimes_.at( j ) == rampData.rampEndTimes_.at( j ) )
                 {
                     continue;
                 }
@@ -514,15 +673,15 @@ void ProcessedOdfFileContents::extractMultipleRawOdfRampData(
                 if ( j == 0 && !unprocessedRampStartTimesPerStation_[ stationName ].empty( ) )
                 {
                     unprocessedRampStartTimesPerStation_[ stationName ].push_back( unprocessedRampEndTimesPerStation_[ stationName ].back( ) );
-                    unprocessedRampEndTimesPerStation_[ stationName ].push_back( rampBlocks.at( j )->getRampStartTime( ) );
+                    unprocessedRampEndTimesPerStation_[ stationName ].push_back( rampData.rampStartTimes_.at( j ) );
                     rampRatesPerStation[ stationName ].push_back( TUDAT_NAN );
                     startFrequenciesPerStation[ stationName ].push_back( TUDAT_NAN );
                 }
 
-                unprocessedRampStartTimesPerStation_[ stationName ].push_back( rampBlocks.at( j )->getRampStartTime( ) );
-                unprocessedRampEndTimesPerStation_[ stationName ].push_back( rampBlocks.at( j )->getRampEndTime( ) );
-                rampRatesPerStation[ stationName ].push_back( rampBlocks.at( j )->getRampRate( ) );
-                startFrequenciesPerStation[ stationName ].push_back( rampBlocks.at( j )->getRampStartFrequency( ) );
+                unprocessedRampStartTimesPerStation_[ stationName ].push_back( rampData.rampStartTimes_.at( j ) );
+                unprocessedRampEndTimesPerStation_[ stationName ].push_back( rampData.rampEndTimes_.at( j ) );
+                rampRatesPerStation[ stationName ].push_back( rampData.rampRates_.at( j ) );
+                startFrequenciesPerStation[ stationName ].push_back( rampData.rampStartFrequencies_.at( j ) );
             }
         }
     }
@@ -95,13 +95,18 @@ std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > cre
                     isCentralBody );
         break;
     case polyhedron_gravity:
+    {
+        std::shared_ptr< PolyhedronAccelerationSettings > polyhedronSettings =
+                std::dynamic_pointer_cast< PolyhedronAccelerationSettings >( accelerationSettings );
         accelerationModel = createPolyhedronGravityAcceleration(
                 bodyUndergoingAcceleration,
                 bodyExertingAcceleration,
                 nameOfBodyUndergoingAcceleration,
                 nameOfBodyExertingAcceleration,
-                sumGravitationalParameters);
+                sumGravitationalParameters,
+                ( polyhedronSettings == nullptr ) ? 1 : polyhedronSettings->numberOfThreads_ );
         break;
+    }
     case ring_gravity:
         accelerationModel = createRingGravityAcceleration(
                 bodyUndergoingAcceleration,
@@ -440,6 +445,8 @@ createSphericalHarmonicsGravityAcceleration(
                     std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
                       std::bind( &Body::getCurrentRotationToGlobalFrame,
                                  bodyExertingAcceleration ), useMutualAttraction );
+            accelerationModel->setEvaluationAlgorithm( sphericalHarmonicsSettings->evaluationAlgorithm_ );
+            accelerationModel->setDegreeTruncationTolerance( sphericalHarmonicsSettings->degreeTruncationTolerance_ );
         }
     }
     return accelerationModel;
@@ -576,7 +583,8 @@ createPolyhedronGravityAcceleration(
         const std::shared_ptr< Body > bodyExertingAcceleration,
         const std::string& nameOfBodyUndergoingAcceleration,
         const std::string& nameOfBodyExertingAcceleration,
-        const bool useCentralBodyFixedFrame)
+        const bool useCentralBodyFixedFrame,
+        const unsigned int numberOfThreads )
 {
 
     // Declare pointer to return object
@@ -665,7 +673,18 @@ createPolyhedronGravityAcceleration(
                         edgeDyadsFunction,
                         std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
                         std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
-                        useCentralBodyFixedFrame );
+                        useCentralBodyFixedFrame, false, false, numberOfThreads );
+
+        // Use exterior spherical harmonic expansion far from the polyhedron, if available
+        std::shared_ptr< HybridPolyhedronGravityField > hybridGravityField =
+                std::dynamic_pointer_cast< HybridPolyhedronGravityField >( polyhedronGravityField );
+        if( hybridGravityField != nullptr )
+        {
+            accelerationModel->setExteriorGravityField(
+                        hybridGravityField->getExteriorGravityField( ),
+                        hybridGravityField->getInnerSwitchRadius( ),
+                        hybridGravityField->getOuterSwitchRadius( ) );
+        }
 
     }
     return accelerationModel;
@@ -1706,6 +1725,85 @@ std::shared_ptr< gravitation::DirectTidalDissipationAcceleration > createDirectT
     }
 }
 
+//! Function to create gravitational acceleration model from a precomputed gravity field grid.
+std::shared_ptr< gravitation::GriddedGravitationalAccelerationModel > createGriddedGravityAcceleration(
+        const std::shared_ptr< Body > bodyUndergoingAcceleration,
+        const std::shared_ptr< Body > bodyExertingAcceleration,
+        const std::string& nameOfBodyUndergoingAcceleration,
+        const std::string& nameOfBodyExertingAcceleration,
+        const std::shared_ptr< AccelerationSettings > accelerationSettings,
+        const bool useCentralBodyFixedFrame )
+{
+    // Check input consistency
+    std::shared_ptr< GriddedGravityAccelerationSettings > griddedGravitySettings =
+            std::dynamic_pointer_cast< GriddedGravityAccelerationSettings >( accelerationSettings );
+    if( griddedGravitySettings == nullptr )
+    {
+        throw std::runtime_error( "Error when creating gridded gravity acceleration, input is inconsistent" );
+    }
+
+    std::shared_ptr< GravityFieldModel > gravityField = bodyExertingAcceleration->getGravityFieldModel( );
+    if( gravityField == nullptr )
+    {
+        throw std::runtime_error(
+                    std::string( "Error, gravity field model not set when ")
+                    + " making gridded gravitational acceleration of " +
+                    nameOfBodyExertingAcceleration +
+                    " on " + nameOfBodyUndergoingAcceleration );
+    }
+
+    if( bodyExertingAcceleration->getRotationalEphemeris( ) == nullptr )
+    {
+        throw std::runtime_error( "Error when making gridded gravity acceleration on body " +
+                                  nameOfBodyUndergoingAcceleration + ", no rotation model found for " +
+                                  nameOfBodyExertingAcceleration );
+    }
+
+    // Generate grid from gravity field model of body exerting acceleration
+    std::shared_ptr< GravityFieldGrid > gravityFieldGrid = std::make_shared< GravityFieldGrid >(
+                [ = ]( const Eigen::Vector3d& bodyFixedPosition )
+    {
+        return gravityField->getGradientOfPotential( bodyFixedPosition );
+    }, gravityField->getGravitationalParameter( ),
+                griddedGravitySettings->minimumRadius_,
+                griddedGravitySettings->maximumRadius_,
+                griddedGravitySettings->relativeTolerance_,
+                griddedGravitySettings->numberOfInterpolationPoints_,
+                griddedGravitySettings->layerRadiusRatio_,
+                griddedGravitySettings->maximumNumberOfNodesPerLayer_ );
+
+    std::function< double( ) > gravitationalParameterFunction;
+
+    // Check if mutual acceleration is to be used.
+    if( useCentralBodyFixedFrame == false ||
+            bodyUndergoingAcceleration->getGravityFieldModel( ) == nullptr )
+    {
+        gravitationalParameterFunction =
+                std::bind( &gravitation::GravityFieldModel::getGravitationalParameter, gravityField );
+    }
+    else
+    {
+        // Create function returning summed gravitational parameter of the two bodies.
+        std::function< double( ) > gravitationalParameterOfBodyExertingAcceleration =
+                std::bind( &gravitation::GravityFieldModel::getGravitationalParameter, gravityField );
+        std::function< double( ) > gravitationalParameterOfBodyUndergoingAcceleration =
+                std::bind( &gravitation::GravityFieldModel::getGravitationalParameter,
+                           bodyUndergoingAcceleration->getGravityFieldModel( ) );
+        gravitationalParameterFunction =
+                std::bind( &utilities::sumFunctionReturn< double >,
+                           gravitationalParameterOfBodyExertingAcceleration,
+                           gravitationalParameterOfBodyUndergoingAcceleration );
+    }
+
+    return std::make_shared< GriddedGravitationalAccelerationModel >(
+                std::bind( &Body::getPositionByReference, bodyUndergoingAcceleration, std::placeholders::_1 ),
+                gravitationalParameterFunction,
+                gravityFieldGrid,
+                std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
+                std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
+                useCentralBodyFixedFrame );
+}
+
 //! Function to create a momentum wheel desaturation acceleration model.
 std::shared_ptr< propulsion::MomentumWheelDesaturationThrustAcceleration > createMomentumWheelDesaturationAcceleration(
         const std::shared_ptr< Body > bodyUndergoingAcceleration,
@@ -1843,6 +1941,21 @@ std::shared_ptr< AccelerationModel< Eigen::Vector3d > > createAccelerationModel(
                     accelerationSettings,
                     nameOfBodyUndergoingAcceleration );
         break;
+    case gridded_gravity:
+        if( nameOfCentralBody != nameOfBodyExertingAcceleration && !ephemerides::isFrameInertial( nameOfCentralBody ) )
+        {
+            throw std::runtime_error( "Error when making gridded gravity acceleration of " + nameOfBodyExertingAcceleration +
+                                      " on " + nameOfBodyUndergoingAcceleration + ", third-body acceleration (central body " +
+                                      nameOfCentralBody + ") is not supported" );
+        }
+        accelerationModelPointer = createGriddedGravityAcceleration(
+                    bodyUndergoingAcceleration,
+                    bodyExertingAcceleration,
+                    nameOfBodyUndergoingAcceleration,
+                    nameOfBodyExertingAcceleration,
+                    accelerationSettings,
+                    nameOfCentralBody == nameOfBodyExertingAcceleration );
+        break;
     default:
         throw std::runtime_error(
                     std::string( "Error, acceleration model ") +
@@ -0,0 +1,147 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark of the evaluation of the gradient of the polyhedron gravity potential for a shape model with 100000
+ *      facets, using the per-term functions of basic_mathematics, and the structure-of-arrays evaluation of
+ *      PolyhedronGravityField on one and on all available threads. Only built when TUDAT_BUILD_BENCHMARKS is enabled,
+ *      and not run as part of the test suite.
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/gravitation/polyhedronGravityField.h"
+
+using namespace tudat;
+
+//! Function to create a triaxial ellipsoid shape model, with vertices on a latitude-longitude grid.
+void createEllipsoidShapeModel(
+        const double semiAxisX, const double semiAxisY, const double semiAxisZ,
+        const int numberOfLatitudeRings, const int numberOfLongitudes,
+        Eigen::MatrixXd& verticesCoordinates, Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    const int numberOfVertices = 2 + numberOfLatitudeRings * numberOfLongitudes;
+    const int southPole = numberOfVertices - 1;
+
+    verticesCoordinates.resize( numberOfVertices, 3 );
+    verticesCoordinates.row( 0 ) << 0.0, 0.0, semiAxisZ;
+    verticesCoordinates.row( southPole ) << 0.0, 0.0, -semiAxisZ;
+    for( int ring = 0; ring < numberOfLatitudeRings; ring++ )
+    {
+        const double colatitude = mathematical_constants::PI * ( ring + 1 ) / ( numberOfLatitudeRings + 1 );
+        for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+        {
+            const double longitude = 2.0 * mathematical_constants::PI * ( longitudeIndex + 0.25 * ( ring % 2 ) ) /
+                    numberOfLongitudes;
+            verticesCoordinates.row( 1 + ring * numberOfLongitudes + longitudeIndex ) <<
+                semiAxisX * std::sin( colatitude ) * std::cos( longitude ),
+                semiAxisY * std::sin( colatitude ) * std::sin( longitude ),
+                semiAxisZ * std::cos( colatitude );
+        }
+    }
+
+    // Define facets, with vertices in counterclockwise order when seen from outside
+    verticesDefiningEachFacet.resize( 2 * ( numberOfVertices - 2 ), 3 );
+    int facet = 0;
+    for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+    {
+        const int nextLongitudeIndex = ( longitudeIndex + 1 ) % numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) << 0, 1 + longitudeIndex, 1 + nextLongitudeIndex;
+        for( int ring = 0; ring < numberOfLatitudeRings - 1; ring++ )
+        {
+            const int upperVertex = 1 + ring * numberOfLongitudes + longitudeIndex;
+            const int upperNextVertex = 1 + ring * numberOfLongitudes + nextLongitudeIndex;
+            const int lowerVertex = upperVertex + numberOfLongitudes;
+            const int lowerNextVertex = upperNextVertex + numberOfLongitudes;
+            verticesDefiningEachFacet.row( facet++ ) << upperVertex, lowerVertex, lowerNextVertex;
+            verticesDefiningEachFacet.row( facet++ ) << upperVertex, lowerNextVertex, upperNextVertex;
+        }
+        const int lastRingOffset = 1 + ( numberOfLatitudeRings - 1 ) * numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) <<
+            lastRingOffset + longitudeIndex, southPole, lastRingOffset + nextLongitudeIndex;
+    }
+}
+
+int main( )
+{
+    // Create shape model with 100000 facets
+    Eigen::MatrixXd verticesCoordinates;
+    Eigen::MatrixXi verticesDefiningEachFacet;
+    createEllipsoidShapeModel( 16.0E3, 10.0E3, 8.0E3, 200, 250, verticesCoordinates, verticesDefiningEachFacet );
+
+    const double gravitationalParameter = 4.46E5;
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+            gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    const double gravitationalConstantTimesDensity = gravitationalParameter / gravityField.getVolume( );
+
+    const Eigen::MatrixXi verticesDefiningEachEdge = gravityField.getVerticesDefiningEachEdge( );
+    const std::vector< Eigen::MatrixXd > facetDyads = gravityField.getFacetDyads( );
+    const std::vector< Eigen::MatrixXd > edgeDyads = gravityField.getEdgeDyads( );
+
+    const unsigned int numberOfEvaluations = 20;
+    std::cout << "Polyhedron gradient evaluation with " << verticesDefiningEachFacet.rows( ) << " facets and "
+              << verticesDefiningEachEdge.rows( ) << " edges (" << numberOfEvaluations << " evaluations)" << std::endl;
+
+    // Evaluate gradient at different positions (so that no cached values are used), using per-term functions
+    Eigen::Vector3d perTermGradientSum = Eigen::Vector3d::Zero( );
+    auto startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+    {
+        Eigen::MatrixXd relativeVerticesCoordinates;
+        Eigen::VectorXd perFacetFactor, perEdgeFactor;
+        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                    relativeVerticesCoordinates, ( Eigen::Vector3d( ) << 20.0E3 + 100.0 * i, 5.0E3, -3.0E3 ).finished( ),
+                    verticesCoordinates );
+        basic_mathematics::calculatePolyhedronPerFacetFactor(
+                    perFacetFactor, relativeVerticesCoordinates, verticesDefiningEachFacet );
+        basic_mathematics::calculatePolyhedronPerEdgeFactor(
+                    perEdgeFactor, relativeVerticesCoordinates, verticesDefiningEachEdge );
+        perTermGradientSum += basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                    gravitationalConstantTimesDensity, relativeVerticesCoordinates, verticesDefiningEachFacet,
+                    verticesDefiningEachEdge, facetDyads, edgeDyads, perFacetFactor, perEdgeFactor );
+    }
+    const double perTermTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( ) /
+            numberOfEvaluations;
+    std::cout << "    per-term functions:         " << perTermTime * 1.0E3 << " ms" << std::endl;
+
+    // Evaluate gradient using structure-of-arrays evaluation, on one and on all available threads
+    std::vector< unsigned int > numbersOfThreads = { 1 };
+    if( std::thread::hardware_concurrency( ) > 1 )
+    {
+        numbersOfThreads.push_back( std::thread::hardware_concurrency( ) );
+    }
+    for( unsigned int numberOfThreads: numbersOfThreads )
+    {
+        gravityField.setNumberOfThreads( numberOfThreads );
+
+        Eigen::Vector3d gradientSum = Eigen::Vector3d::Zero( );
+        startTime = std::chrono::steady_clock::now( );
+        for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+        {
+            gradientSum += gravityField.getGradientOfPotential(
+                        ( Eigen::Vector3d( ) << 20.0E3 + 100.0 * i, 5.0E3, -3.0E3 ).finished( ) );
+        }
+        const double evaluationTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( ) /
+                numberOfEvaluations;
+
+        std::cout << "    structure-of-arrays, " << gravityField.getNumberOfActiveThreads( ) << " thread(s): "
+                  << evaluationTime * 1.0E3 << " ms, speed-up " << perTermTime / evaluationTime
+                  << ", relative difference " << ( gradientSum - perTermGradientSum ).norm( ) / perTermGradientSum.norm( )
+                  << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Micro-benchmark of the term-wise, column-wise and Pines evaluation of the spherical harmonic acceleration at
+ *      degree 20, 100 and 360. Only built when TUDAT_BUILD_BENCHMARKS is enabled, and not run as part of the test suite.
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+#include "tudat/astro/gravitation/vectorizedSphericalHarmonicsGravity.h"
+#include "tudat/astro/gravitation/pinesSphericalHarmonicsGravity.h"
+
+using namespace tudat;
+using namespace tudat::gravitation;
+
+//! Function to generate a random, geodesy-normalized, spherical harmonic gravity field with a Kaula-type power spectrum
+void getRandomSphericalHarmonicCoefficients(
+        const int maximumDegree, Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
+{
+    std::srand( 42 );
+    cosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        double degreeScaling = 1.0E-5 / std::max( 1.0, static_cast< double >( degree * degree ) );
+        for( int order = 0; order <= maximumDegree; order++ )
+        {
+            if( order > degree )
+            {
+                cosineCoefficients( degree, order ) = 0.0;
+                sineCoefficients( degree, order ) = 0.0;
+            }
+            else
+            {
+                cosineCoefficients( degree, order ) *= degreeScaling;
+                sineCoefficients( degree, order ) *= degreeScaling;
+            }
+        }
+        sineCoefficients( degree, 0 ) = 0.0;
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 1, 0 ) = 0.0;
+    cosineCoefficients( 1, 1 ) = 0.0;
+    sineCoefficients( 1, 1 ) = 0.0;
+}
+
+//! Function to compute the mean wall-clock time [s] of a number of evaluations of a given acceleration function
+template< typename AccelerationFunction >
+double getMeanEvaluationTime( AccelerationFunction accelerationFunction, const int numberOfEvaluations,
+                              Eigen::Vector3d& accelerationSum )
+{
+    Eigen::Vector3d position = ( Eigen::Vector3d( ) << 1.9E6, -0.7E6, 1.1E6 ).finished( );
+    accelerationSum.setZero( );
+
+    auto startTime = std::chrono::steady_clock::now( );
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        position( 0 ) += 1.0;
+        accelerationSum += accelerationFunction( position );
+    }
+    auto endTime = std::chrono::steady_clock::now( );
+
+    return std::chrono::duration< double >( endTime - startTime ).count( ) / static_cast< double >( numberOfEvaluations );
+}
+
+int main( )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+
+    for( int maximumDegree : { 20, 100, 360 } )
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+        ColumnWiseSphericalHarmonicsCache columnWiseCache( maximumDegree, maximumDegree );
+        PinesSphericalHarmonicsCache pinesCache( maximumDegree, maximumDegree );
+        std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+
+        const int numberOfEvaluations = 20000000 / ( maximumDegree * maximumDegree );
+
+        Eigen::Vector3d termWiseAcceleration, columnWiseAcceleration, pinesAcceleration;
+        double termWiseTime = getMeanEvaluationTime(
+                    [ & ]( const Eigen::Vector3d& position )
+        {
+            return computeGeodesyNormalizedGravitationalAccelerationSum(
+                        position, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, sphericalHarmonicsCache, dummyMap, false );
+        }, numberOfEvaluations, termWiseAcceleration );
+        double columnWiseTime = getMeanEvaluationTime(
+                    [ & ]( const Eigen::Vector3d& position )
+        {
+            return computeGeodesyNormalizedGravitationalAccelerationSumColumnWise(
+                        position, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, columnWiseCache );
+        }, numberOfEvaluations, columnWiseAcceleration );
+        double pinesTime = getMeanEvaluationTime(
+                    [ & ]( const Eigen::Vector3d& position )
+        {
+            return computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                        position, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, pinesCache );
+        }, numberOfEvaluations, pinesAcceleration );
+
+        std::cout << "Spherical harmonic acceleration, degree " << maximumDegree << " (" << numberOfEvaluations
+                  << " evaluations)" << std::endl
+                  << "    term-wise:   " << termWiseTime * 1.0E6 << " us" << std::endl
+                  << "    column-wise: " << columnWiseTime * 1.0E6 << " us, speed-up "
+                  << termWiseTime / columnWiseTime << ", relative difference "
+                  << ( columnWiseAcceleration - termWiseAcceleration ).norm( ) / termWiseAcceleration.norm( ) << std::endl
+                  << "    Pines:       " << pinesTime * 1.0E6 << " us, speed-up "
+                  << termWiseTime / pinesTime << ", relative difference "
+                  << ( pinesAcceleration - termWiseAcceleration ).norm( ) / termWiseAcceleration.norm( ) << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
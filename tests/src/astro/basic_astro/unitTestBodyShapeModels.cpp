@@ -16,6 +16,8 @@
 #define BOOST_TEST_MAIN
 
 
+#include <limits>
+
 #include <boost/lambda/lambda.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -366,6 +368,97 @@ BOOST_AUTO_TEST_CASE( testHybridShapeModel )
 
 }
 
+//! Test the altitude above a large, non-convex polyhedron against a brute-force evaluation.
+BOOST_AUTO_TEST_CASE( testPolyhedronShapeModelBoundingVolumeHierarchy )
+{
+    using namespace tudat::basic_astrodynamics;
+
+    // Create non-convex shape model, with radius varying with latitude and longitude
+    const int numberOfLatitudeRings = 40;
+    const int numberOfLongitudes = 80;
+    const int numberOfVertices = 2 + numberOfLatitudeRings * numberOfLongitudes;
+    const int southPole = numberOfVertices - 1;
+    Eigen::MatrixXd verticesCoordinates( numberOfVertices, 3 );
+    verticesCoordinates.row( 0 ) << 0.0, 0.0, 800.0;
+    verticesCoordinates.row( southPole ) << 0.0, 0.0, -800.0;
+    for( int ring = 0; ring < numberOfLatitudeRings; ring++ )
+    {
+        const double colatitude = mathematical_constants::PI * ( ring + 1 ) / ( numberOfLatitudeRings + 1 );
+        for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+        {
+            const double longitude = 2.0 * mathematical_constants::PI * longitudeIndex / numberOfLongitudes;
+            const double radius = 1000.0 * ( 1.0 + 0.3 * std::sin( 3.0 * longitude ) * std::sin( colatitude ) );
+            verticesCoordinates.row( 1 + ring * numberOfLongitudes + longitudeIndex ) <<
+                radius * std::sin( colatitude ) * std::cos( longitude ),
+                0.8 * radius * std::sin( colatitude ) * std::sin( longitude ),
+                800.0 * std::cos( colatitude );
+        }
+    }
+
+    Eigen::MatrixXi verticesDefiningEachFacet( 2 * ( numberOfVertices - 2 ), 3 );
+    int facet = 0;
+    for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+    {
+        const int nextLongitudeIndex = ( longitudeIndex + 1 ) % numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) << 0, 1 + longitudeIndex, 1 + nextLongitudeIndex;
+        for( int ring = 0; ring < numberOfLatitudeRings - 1; ring++ )
+        {
+            const int upperVertex = 1 + ring * numberOfLongitudes + longitudeIndex;
+            const int upperNextVertex = 1 + ring * numberOfLongitudes + nextLongitudeIndex;
+            verticesDefiningEachFacet.row( facet++ ) <<
+                upperVertex, upperVertex + numberOfLongitudes, upperNextVertex + numberOfLongitudes;
+            verticesDefiningEachFacet.row( facet++ ) <<
+                upperVertex, upperNextVertex + numberOfLongitudes, upperNextVertex;
+        }
+        const int lastRingOffset = 1 + ( numberOfLatitudeRings - 1 ) * numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) <<
+            lastRingOffset + longitudeIndex, southPole, lastRingOffset + nextLongitudeIndex;
+    }
+
+    PolyhedronBodyShapeModel shapeModel( verticesCoordinates, verticesDefiningEachFacet, true, false );
+    PolyhedronBodyShapeModel vertexShapeModel( verticesCoordinates, verticesDefiningEachFacet, false, true );
+
+    // Compare with brute-force evaluation, for points inside, close to, and far from the polyhedron
+    Eigen::Vector3d testCartesianPosition;
+    for( int i = 0; i < 500; i++ )
+    {
+        const double scaling = 0.2 + 1.6 * ( i % 50 ) / 49.0;
+        testCartesianPosition << scaling * 1100.0 * std::cos( 0.37 * i ) * std::cos( 0.11 * i ),
+                scaling * 900.0 * std::sin( 0.37 * i ) * std::cos( 0.11 * i ),
+                scaling * 750.0 * std::sin( 0.11 * i );
+
+        double bruteForceDistance = std::numeric_limits< double >::infinity( );
+        for( int j = 0; j < verticesDefiningEachFacet.rows( ); j++ )
+        {
+            int closestFeature;
+            bruteForceDistance = std::min(
+                        bruteForceDistance, ( testCartesianPosition - basic_mathematics::computeClosestPointOnTriangle(
+                            testCartesianPosition,
+                            verticesCoordinates.row( verticesDefiningEachFacet( j, 0 ) ).transpose( ),
+                            verticesCoordinates.row( verticesDefiningEachFacet( j, 1 ) ).transpose( ),
+                            verticesCoordinates.row( verticesDefiningEachFacet( j, 2 ) ).transpose( ),
+                            closestFeature ) ).norm( ) );
+        }
+        const double bruteForceVertexDistance =
+                ( verticesCoordinates.rowwise( ) - testCartesianPosition.transpose( ) ).rowwise( ).norm( ).minCoeff( );
+
+        // Determine whether point is inside from the solid angle subtended by the polyhedron
+        Eigen::MatrixXd verticesCoordinatesRelativeToFieldPoint;
+        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                verticesCoordinatesRelativeToFieldPoint, testCartesianPosition, verticesCoordinates );
+        Eigen::VectorXd perFacetFactor;
+        basic_mathematics::calculatePolyhedronPerFacetFactor(
+                perFacetFactor, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet );
+        const bool isInside = - basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
+                    1.0, perFacetFactor ) > 2.0 * mathematical_constants::PI;
+
+        BOOST_CHECK_CLOSE_FRACTION( shapeModel.getAltitude( testCartesianPosition ),
+                                    ( isInside ? -1.0 : 1.0 ) * bruteForceDistance, 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( vertexShapeModel.getAltitude( testCartesianPosition ),
+                                    bruteForceVertexDistance, 1.0E-12 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
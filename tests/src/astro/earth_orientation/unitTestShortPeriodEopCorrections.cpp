@@ -235,6 +235,77 @@ BOOST_AUTO_TEST_CASE( testShortPeriodUt1CombinedCorrections )
     BOOST_CHECK_SMALL( std::fabs( ut1CorrectionTotal - ( ut1CorrectionLibration + ut1CorrectionOceanTides ) ), 1.0E-20 );
 }
 
+//! Test incremental evaluation of short-periodic polar motion and ut1-utc variations, by comparing to direct evaluation
+BOOST_AUTO_TEST_CASE( testShortPeriodIncrementalCorrections )
+{
+    // Create UT1 and polar motion correction calculators with direct and incremental evaluation
+    std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > directUt1Calculator =
+            getDefaultUT1CorrectionCalculator( );
+    std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > incrementalUt1Calculator =
+            getDefaultUT1CorrectionCalculator( );
+    incrementalUt1Calculator->setIncrementalEvaluation( true, 60.0, 100 );
+
+    std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > > directPolarMotionCalculator =
+            getDefaultPolarMotionCorrectionCalculator( );
+    std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > > incrementalPolarMotionCalculator =
+            getDefaultPolarMotionCorrectionCalculator( );
+    incrementalPolarMotionCalculator->setIncrementalEvaluation( true, 60.0, 100 );
+    BOOST_CHECK( incrementalPolarMotionCalculator->getUseIncrementalEvaluation( ) );
+
+    // Evaluate corrections at closely spaced times (with occasional larger steps, and steps back in time)
+    double microAsToRadians = mathematical_constants::PI / ( 180.0 * 1.0E6 * 3600.0 );
+    double currentTime = 1.0E8;
+    for( int i = 0; i < 2000; i++ )
+    {
+        if( i % 500 == 499 )
+        {
+            currentTime += 3600.0;
+        }
+        else
+        {
+            currentTime += ( i % 7 == 0 ) ? -5.0 : 10.0 + 0.1 * static_cast< double >( i % 3 );
+        }
+
+        // Difference w.r.t. direct evaluation (< 1.0E-6 microarcseconds and < 1.0E-10 microseconds) is fully negligible
+        BOOST_CHECK_SMALL( incrementalUt1Calculator->getCorrections( currentTime ) -
+                           directUt1Calculator->getCorrections( currentTime ), 1.0E-16 );
+        Eigen::Vector2d polarMotionDifference =
+                incrementalPolarMotionCalculator->getCorrections( currentTime ) -
+                directPolarMotionCalculator->getCorrections( currentTime );
+        BOOST_CHECK_SMALL( polarMotionDifference( 0 ), 1.0E-6 * microAsToRadians );
+        BOOST_CHECK_SMALL( polarMotionDifference( 1 ), 1.0E-6 * microAsToRadians );
+    }
+
+    // Check that most evaluations were incremental (with periodic direct evaluations), and none for direct calculators
+    BOOST_CHECK( incrementalUt1Calculator->getNumberOfIncrementalEvaluations( ) > 1000 );
+    BOOST_CHECK( incrementalUt1Calculator->getNumberOfIncrementalEvaluations( ) < 2000 );
+    BOOST_CHECK( incrementalPolarMotionCalculator->getNumberOfIncrementalEvaluations( ) > 1000 );
+    BOOST_CHECK( incrementalPolarMotionCalculator->getNumberOfIncrementalEvaluations( ) < 2000 );
+    BOOST_CHECK_EQUAL( directUt1Calculator->getNumberOfIncrementalEvaluations( ), 0 );
+    BOOST_CHECK_EQUAL( directPolarMotionCalculator->getNumberOfIncrementalEvaluations( ), 0 );
+}
+
+//! Test that short-period correction calculators without any terms return zero corrections
+BOOST_AUTO_TEST_CASE( testShortPeriodEmptyCorrections )
+{
+    ShortPeriodEarthOrientationCorrectionCalculator< double > ut1Calculator(
+                1.0E-6, 0.0, std::vector< std::string >( ), std::vector< std::string >( ) );
+    ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > polarMotionCalculator(
+                1.0E-6, 0.0, std::vector< std::string >( ), std::vector< std::string >( ) );
+
+    for( int i = 0; i < 3; i++ )
+    {
+        double currentTime = 1.0E8 + 10.0 * static_cast< double >( i );
+        BOOST_CHECK_EQUAL( ut1Calculator.getCorrections( currentTime ), 0.0 );
+        BOOST_CHECK_EQUAL( polarMotionCalculator.getCorrections( currentTime )( 0 ), 0.0 );
+        BOOST_CHECK_EQUAL( polarMotionCalculator.getCorrections( currentTime )( 1 ), 0.0 );
+
+        // Check incremental evaluation for second and third time
+        ut1Calculator.setIncrementalEvaluation( i > 0 );
+        polarMotionCalculator.setIncrementalEvaluation( i > 0 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
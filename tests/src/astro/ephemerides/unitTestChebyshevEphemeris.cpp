@@ -0,0 +1,246 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/simulation/environment_setup/createEphemeris.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_chebyshev_ephemeris )
+
+//! Function to create an ephemeris of an eccentric Earth orbit, used as reference for the Chebyshev ephemeris
+std::shared_ptr< ephemerides::KeplerEphemeris > getReferenceEphemeris( )
+{
+    Eigen::Vector6d keplerElements;
+    keplerElements << 2.0E7, 0.6, 0.5, 1.0, 2.0, 0.0;
+    return std::make_shared< ephemerides::KeplerEphemeris >(
+                keplerElements, 0.0, 3.986004418E14, "Earth", "J2000" );
+}
+
+//! Function to create a state history from the reference ephemeris, sampled with a fixed step
+std::map< double, Eigen::Vector6d > getReferenceStateHistory( const double timeStep = 20.0 )
+{
+    std::shared_ptr< ephemerides::KeplerEphemeris > referenceEphemeris = getReferenceEphemeris( );
+    std::map< double, Eigen::Vector6d > stateHistory;
+    for( int i = 0; i <= static_cast< int >( 3.0 * 86400.0 / timeStep ); i++ )
+    {
+        double currentTime = static_cast< double >( i ) * timeStep;
+        stateHistory[ currentTime ] = referenceEphemeris->getCartesianState( currentTime );
+    }
+    return stateHistory;
+}
+
+//! Test fit of Chebyshev ephemeris to state history
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFit )
+{
+    using namespace ephemerides;
+
+    std::shared_ptr< KeplerEphemeris > referenceEphemeris = getReferenceEphemeris( );
+    std::map< double, Eigen::Vector6d > stateHistory = getReferenceStateHistory( );
+
+    double positionTolerance = 1.0E-3;
+    double velocityTolerance = 1.0E-6;
+    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = createChebyshevEphemerisFromStateHistory(
+                stateHistory, positionTolerance, velocityTolerance, 13, TUDAT_NAN, "Earth", "J2000" );
+
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getValidityInterval( ).first, stateHistory.begin( )->first );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getValidityInterval( ).second, stateHistory.rbegin( )->first );
+
+    // Check that tolerance is met at the states of the history
+    for( auto stateIterator : stateHistory )
+    {
+        Eigen::Vector6d stateDifference =
+                chebyshevEphemeris->getCartesianState( stateIterator.first ) - stateIterator.second;
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), positionTolerance );
+        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), velocityTolerance );
+    }
+
+    // Check that accuracy is maintained in between the states of the history (where the tolerance is not enforced)
+    for( auto stateIterator : stateHistory )
+    {
+        double currentTime = stateIterator.first + 30.0;
+        if( currentTime < stateHistory.rbegin( )->first )
+        {
+            Eigen::Vector6d stateDifference = chebyshevEphemeris->getCartesianState( currentTime ) -
+                    referenceEphemeris->getCartesianState( currentTime );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 5.0 * velocityTolerance );
+        }
+    }
+
+    // Check that granule length is adapted to the dynamics (shorter granules near pericenter), and that the
+    // representation is much more compact than the state history
+    int numberOfGranules = chebyshevEphemeris->getNumberOfGranules( );
+    std::vector< double > granuleBoundaries = chebyshevEphemeris->getGranuleBoundaries( );
+    double minimumGranuleDuration = TUDAT_NAN, maximumGranuleDuration = TUDAT_NAN;
+    for( int i = 0; i < numberOfGranules; i++ )
+    {
+        double currentDuration = granuleBoundaries.at( i + 1 ) - granuleBoundaries.at( i );
+        minimumGranuleDuration = ( i == 0 ) ? currentDuration : std::min( minimumGranuleDuration, currentDuration );
+        maximumGranuleDuration = ( i == 0 ) ? currentDuration : std::max( maximumGranuleDuration, currentDuration );
+    }
+    BOOST_CHECK( numberOfGranules > 1 );
+    BOOST_CHECK( maximumGranuleDuration >= 4.0 * minimumGranuleDuration );
+    BOOST_CHECK( chebyshevEphemeris->getGranuleCoefficients( ).size( ) + granuleBoundaries.size( ) <
+                 6 * stateHistory.size( ) / 5 );
+
+    // Check that velocity is the derivative of the position, and that the granule lookup is correct
+    for( int i = 0; i < numberOfGranules; i++ )
+    {
+        double granuleStart = granuleBoundaries.at( i );
+        double granuleEnd = granuleBoundaries.at( i + 1 );
+        double midTime = 0.5 * ( granuleStart + granuleEnd );
+        double timeStep = 1.0;
+
+        Eigen::Vector3d numericalVelocity =
+                ( -chebyshevEphemeris->getCartesianState( midTime + 2.0 * timeStep ).segment( 0, 3 ) +
+                  8.0 * chebyshevEphemeris->getCartesianState( midTime + timeStep ).segment( 0, 3 ) -
+                  8.0 * chebyshevEphemeris->getCartesianState( midTime - timeStep ).segment( 0, 3 ) +
+                  chebyshevEphemeris->getCartesianState( midTime - 2.0 * timeStep ).segment( 0, 3 ) ) /
+                ( 12.0 * timeStep );
+        BOOST_CHECK_SMALL( ( numericalVelocity - chebyshevEphemeris->getCartesianState( midTime ).segment( 3, 3 ) ).norm( ),
+                           1.0E-6 );
+
+        BOOST_CHECK_EQUAL( chebyshevEphemeris->getGranuleIndex( granuleStart ), i );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris->getGranuleIndex( midTime ), i );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris->getGranuleIndex( std::nextafter( granuleEnd, granuleStart ) ), i );
+    }
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getGranuleIndex( granuleBoundaries.back( ) ), numberOfGranules - 1 );
+
+    // Check that times outside of the fitted interval are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        chebyshevEphemeris->getCartesianState( granuleBoundaries.back( ) + 1.0 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    // Check that maximum granule duration is respected
+    std::shared_ptr< ChebyshevEphemeris > shortGranuleEphemeris = createChebyshevEphemerisFromStateHistory(
+                stateHistory, positionTolerance, TUDAT_NAN, 13, 3600.0 );
+    std::vector< double > shortGranuleBoundaries = shortGranuleEphemeris->getGranuleBoundaries( );
+    for( unsigned int i = 0; i < shortGranuleBoundaries.size( ) - 1; i++ )
+    {
+        BOOST_CHECK( shortGranuleBoundaries.at( i + 1 ) - shortGranuleBoundaries.at( i ) <= 3600.0 );
+    }
+}
+
+//! Test writing/reading Chebyshev ephemeris to/from file, and creation from settings
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFileAndSettings )
+{
+    using namespace ephemerides;
+    using namespace simulation_setup;
+
+    std::map< double, Eigen::Vector6d > stateHistory = getReferenceStateHistory( );
+    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = createChebyshevEphemerisFromStateHistory(
+                stateHistory, 1.0E-3, TUDAT_NAN, 11, TUDAT_NAN, "Earth", "J2000" );
+
+    // Write ephemeris to file, and check that ephemeris read from file is identical
+    std::string fileName = "chebyshevEphemerisUnitTest.bin";
+    writeChebyshevEphemerisToFile( chebyshevEphemeris, fileName );
+    std::shared_ptr< ChebyshevEphemeris > readEphemeris = readChebyshevEphemerisFromFile( fileName );
+
+    BOOST_CHECK_EQUAL( readEphemeris->getPolynomialDegree( ), 11 );
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK( readEphemeris->getGranuleBoundaries( ) == chebyshevEphemeris->getGranuleBoundaries( ) );
+    BOOST_CHECK( readEphemeris->getGranuleCoefficients( ) == chebyshevEphemeris->getGranuleCoefficients( ) );
+
+    // Create ephemeris from settings, both from state history and from file
+    std::shared_ptr< ChebyshevEphemerisSettings > settingsFromHistory =
+            std::dynamic_pointer_cast< ChebyshevEphemerisSettings >(
+                chebyshevEphemerisSettings( stateHistory, 1.0E-3, TUDAT_NAN, 11, TUDAT_NAN, "Earth", "J2000" ) );
+    std::shared_ptr< Ephemeris > ephemerisFromHistory = createBodyEphemeris( settingsFromHistory, "Satellite" );
+
+    // Check that state history is released from settings after fit, and that the fit is reused for a second ephemeris
+    BOOST_CHECK_EQUAL( settingsFromHistory->getBodyStateHistory( ).size( ), 0 );
+    BOOST_CHECK( settingsFromHistory->getFittedEphemeris( ) != nullptr );
+    std::shared_ptr< Ephemeris > secondEphemerisFromHistory = createBodyEphemeris( settingsFromHistory, "Satellite" );
+    BOOST_CHECK( secondEphemerisFromHistory != ephemerisFromHistory );
+    BOOST_CHECK( std::dynamic_pointer_cast< ChebyshevEphemeris >( secondEphemerisFromHistory )->getGranuleCoefficients( ) ==
+                 chebyshevEphemeris->getGranuleCoefficients( ) );
+    std::shared_ptr< Ephemeris > ephemerisFromFile = createBodyEphemeris(
+                chebyshevEphemerisFromFileSettings( fileName, "Earth", "J2000" ), "Satellite" );
+    BOOST_CHECK( std::dynamic_pointer_cast< ChebyshevEphemeris >( ephemerisFromHistory ) != nullptr );
+    BOOST_CHECK( std::dynamic_pointer_cast< ChebyshevEphemeris >( ephemerisFromFile ) != nullptr );
+
+    for( auto stateIterator : stateHistory )
+    {
+        Eigen::Vector6d originalState = chebyshevEphemeris->getCartesianState( stateIterator.first );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( readEphemeris->getCartesianState( stateIterator.first )( j ), originalState( j ) );
+            BOOST_CHECK_EQUAL( ephemerisFromFile->getCartesianState( stateIterator.first )( j ), originalState( j ) );
+            BOOST_CHECK_EQUAL( ephemerisFromHistory->getCartesianState( stateIterator.first )( j ), originalState( j ) );
+        }
+    }
+
+    // Check that inconsistent frame in settings is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        createBodyEphemeris( chebyshevEphemerisFromFileSettings( fileName, "SSB", "J2000" ), "Satellite" );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    // Check that truncated file is rejected
+    {
+        std::ifstream inputFile( fileName, std::ios::binary );
+        std::vector< char > fileContents( ( std::istreambuf_iterator< char >( inputFile ) ),
+                                          std::istreambuf_iterator< char >( ) );
+        inputFile.close( );
+        std::ofstream outputFile( fileName, std::ios::binary | std::ios::trunc );
+        outputFile.write( fileContents.data( ), fileContents.size( ) - 8 );
+    }
+    isExceptionCaught = false;
+    try
+    {
+        readChebyshevEphemerisFromFile( fileName );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    std::remove( fileName.c_str( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
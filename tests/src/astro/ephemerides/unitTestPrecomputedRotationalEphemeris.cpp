@@ -0,0 +1,228 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/astro/ephemerides/customRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/precomputedRotationalEphemeris.h"
+#include "tudat/simulation/environment_setup/createRotationModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_precomputed_rotational_ephemeris )
+
+//! Function to create an Earth-like rotation model: fast spin, with slow precession and small (quasi-)diurnal wobble
+std::shared_ptr< ephemerides::RotationalEphemeris > getReferenceRotationModel( )
+{
+    return std::make_shared< ephemerides::CustomRotationalEphemeris >(
+                [ ]( const double time )
+    {
+        double rotationAngleRate = ephemerides::EARTH_ROTATION_ANGLE_RATE;
+        return Eigen::Quaterniond(
+                    Eigen::AngleAxisd( 1.0E-9 * time, Eigen::Vector3d( 0.1, 0.2, 1.0 ).normalized( ) ) *
+                    Eigen::AngleAxisd( 0.4 + 1.0E-6 * std::sin( 1.003 * rotationAngleRate * time ),
+                                       Eigen::Vector3d::UnitX( ) ) *
+                    Eigen::AngleAxisd( 1.0 + rotationAngleRate * time +
+                                       2.0E-6 * std::sin( 2.0 * mathematical_constants::PI * time / ( 13.66 * 86400.0 ) ),
+                                       Eigen::Vector3d::UnitZ( ) ) );
+    }, "GCRS", "ITRS" );
+}
+
+//! Test accuracy and derivatives of precomputed rotation model
+BOOST_AUTO_TEST_CASE( testPrecomputedRotationalEphemerisAccuracy )
+{
+    using namespace ephemerides;
+
+    double startTime = 1.0E8;
+    double endTime = startTime + 5.0 * 86400.0;
+    std::shared_ptr< RotationalEphemeris > referenceRotationModel = getReferenceRotationModel( );
+    std::shared_ptr< PrecomputedRotationalEphemeris > precomputedRotationModel = createPrecomputedRotationalEphemeris(
+                &getReferenceRotationModel, startTime, endTime, 3600.0, 1.0E-10 );
+
+    BOOST_CHECK_EQUAL( precomputedRotationModel->getBaseFrameOrientation( ), "GCRS" );
+    BOOST_CHECK_EQUAL( precomputedRotationModel->getTargetFrameOrientation( ), "ITRS" );
+    BOOST_CHECK_EQUAL( precomputedRotationModel->getNumberOfNodes( ), 121 );
+    BOOST_CHECK( precomputedRotationModel->getTableEndTime( ) >= endTime );
+    BOOST_CHECK( precomputedRotationModel->getMaximumInterpolationError( ) <= 1.0E-10 );
+    BOOST_CHECK_CLOSE_FRACTION( precomputedRotationModel->getNominalRotationRate( ), EARTH_ROTATION_ANGLE_RATE, 1.0E-4 );
+
+    for( int i = 0; i <= 1000; i++ )
+    {
+        double currentTime = startTime + ( endTime - startTime ) * static_cast< double >( i ) / 1000.0;
+
+        // Check rotation against reference model
+        Eigen::Quaterniond rotationToTargetFrame = precomputedRotationModel->getRotationToTargetFrame( currentTime );
+        BOOST_CHECK_SMALL( rotationToTargetFrame.angularDistance(
+                               referenceRotationModel->getRotationToTargetFrame( currentTime ) ), 1.0E-10 );
+        BOOST_CHECK_SMALL( precomputedRotationModel->getRotationToBaseFrame( currentTime ).angularDistance(
+                               referenceRotationModel->getRotationToBaseFrame( currentTime ) ), 1.0E-10 );
+
+        // Check rotation matrix derivative against numerical derivative of interpolated rotation
+        double timeStep = 1.0;
+        double derivativeTime = std::min( std::max( currentTime, startTime + timeStep ), endTime - timeStep );
+        Eigen::Matrix3d numericalDerivative =
+                ( Eigen::Matrix3d( precomputedRotationModel->getRotationToTargetFrame( derivativeTime + timeStep ) ) -
+                  Eigen::Matrix3d( precomputedRotationModel->getRotationToTargetFrame( derivativeTime - timeStep ) ) ) /
+                ( 2.0 * timeStep );
+        Eigen::Matrix3d rotationDerivative = precomputedRotationModel->getDerivativeOfRotationToTargetFrame(
+                    derivativeTime );
+        BOOST_CHECK_SMALL( ( rotationDerivative - numericalDerivative ).norm( ), 1.0E-12 );
+        BOOST_CHECK( ( rotationDerivative.transpose( ) -
+                       precomputedRotationModel->getDerivativeOfRotationToBaseFrame( derivativeTime ) ).norm( ) == 0.0 );
+
+        // Check consistency of full rotational quantities
+        Eigen::Quaterniond fullRotationToTargetFrame;
+        Eigen::Matrix3d fullRotationDerivative;
+        Eigen::Vector3d angularVelocity;
+        precomputedRotationModel->getFullRotationalQuantitiesToTargetFrame(
+                    fullRotationToTargetFrame, fullRotationDerivative, angularVelocity, currentTime );
+        BOOST_CHECK_SMALL( fullRotationToTargetFrame.angularDistance( rotationToTargetFrame ), 1.0E-15 );
+        BOOST_CHECK_CLOSE_FRACTION( ( rotationToTargetFrame * angularVelocity ).z( ),
+                                    EARTH_ROTATION_ANGLE_RATE, 1.0E-4 );
+        BOOST_CHECK_SMALL( ( rotationToTargetFrame * angularVelocity ).segment( 0, 2 ).norm( ),
+                           1.0E-5 * EARTH_ROTATION_ANGLE_RATE );
+    }
+
+    // Check that times outside table are rejected
+    BOOST_CHECK_THROW( precomputedRotationModel->getRotationToTargetFrame( startTime - 1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( precomputedRotationModel->getRotationToTargetFrame(
+                           precomputedRotationModel->getTableEndTime( ) + 1.0 ), std::runtime_error );
+
+    // Check that tolerance violation is detected
+    BOOST_CHECK_THROW( createPrecomputedRotationalEphemeris(
+                           &getReferenceRotationModel, startTime, endTime, 6.0 * 3600.0, 1.0E-10 ),
+                       std::runtime_error );
+}
+
+//! Test that parallel table computation is identical to serial computation
+BOOST_AUTO_TEST_CASE( testPrecomputedRotationalEphemerisParallel )
+{
+    using namespace ephemerides;
+
+    double startTime = 0.0;
+    double endTime = 2.0 * 86400.0;
+    std::shared_ptr< PrecomputedRotationalEphemeris > serialRotationModel = createPrecomputedRotationalEphemeris(
+                &getReferenceRotationModel, startTime, endTime, 1800.0, 1.0E-10, 1 );
+    std::shared_ptr< PrecomputedRotationalEphemeris > parallelRotationModel = createPrecomputedRotationalEphemeris(
+                &getReferenceRotationModel, startTime, endTime, 1800.0, 1.0E-10, 4 );
+
+    BOOST_CHECK( serialRotationModel->getNodeData( ) == parallelRotationModel->getNodeData( ) );
+    BOOST_CHECK_EQUAL( serialRotationModel->getMaximumInterpolationError( ),
+                       parallelRotationModel->getMaximumInterpolationError( ) );
+}
+
+//! Test writing/reading precomputed rotation model to/from file, and creation from settings with a cache file
+BOOST_AUTO_TEST_CASE( testPrecomputedRotationalEphemerisFileAndSettings )
+{
+    using namespace ephemerides;
+    using namespace simulation_setup;
+
+    double startTime = 0.0;
+    double endTime = 86400.0;
+    std::shared_ptr< PrecomputedRotationalEphemeris > precomputedRotationModel = createPrecomputedRotationalEphemeris(
+                &getReferenceRotationModel, startTime, endTime, 3600.0, 1.0E-10 );
+
+    // Write table to file, and check that table read from file is identical
+    std::string fileName = "precomputedRotationUnitTest.bin";
+    writePrecomputedRotationalEphemerisToFile( precomputedRotationModel, fileName, "reference" );
+    std::string sourceIdentifier;
+    std::shared_ptr< PrecomputedRotationalEphemeris > readRotationModel =
+            readPrecomputedRotationalEphemerisFromFile( fileName, sourceIdentifier );
+
+    BOOST_CHECK_EQUAL( sourceIdentifier, "reference" );
+    BOOST_CHECK_EQUAL( readRotationModel->getBaseFrameOrientation( ), "GCRS" );
+    BOOST_CHECK_EQUAL( readRotationModel->getTargetFrameOrientation( ), "ITRS" );
+    BOOST_CHECK_EQUAL( readRotationModel->getTableStartTime( ), precomputedRotationModel->getTableStartTime( ) );
+    BOOST_CHECK_EQUAL( readRotationModel->getTableTimeStep( ), precomputedRotationModel->getTableTimeStep( ) );
+    BOOST_CHECK_EQUAL( readRotationModel->getNominalRotationRate( ), precomputedRotationModel->getNominalRotationRate( ) );
+    BOOST_CHECK_EQUAL( readRotationModel->getMaximumInterpolationError( ),
+                       precomputedRotationModel->getMaximumInterpolationError( ) );
+    BOOST_CHECK( readRotationModel->getNodeData( ) == precomputedRotationModel->getNodeData( ) );
+    std::remove( fileName.c_str( ) );
+
+    // Create precomputed rotation model from settings, computing table and writing it to cache file
+    Eigen::Quaterniond initialOrientation( Eigen::AngleAxisd( 0.3, Eigen::Vector3d( 1.0, 2.0, 3.0 ).normalized( ) ) );
+    std::shared_ptr< RotationModelSettings > underlyingSettings = simpleRotationModelSettings(
+                "ECLIPJ2000", "IAU_Earth", initialOrientation, 0.0, EARTH_ROTATION_ANGLE_RATE );
+    std::shared_ptr< RotationalEphemeris > computedRotationModel = createRotationModel(
+                precomputedRotationModelSettings( underlyingSettings, startTime, endTime, 3600.0, 1.0E-12, 2, fileName ),
+                "Earth" );
+    BOOST_CHECK( std::dynamic_pointer_cast< PrecomputedRotationalEphemeris >( computedRotationModel ) != nullptr );
+    BOOST_CHECK( std::ifstream( fileName ).good( ) );
+
+    // Create precomputed rotation model from settings, loading table from cache file
+    std::shared_ptr< RotationalEphemeris > loadedRotationModel = createRotationModel(
+                precomputedRotationModelSettings( underlyingSettings, startTime, endTime, 3600.0, 1.0E-12, 2, fileName ),
+                "Earth" );
+    BOOST_CHECK( std::dynamic_pointer_cast< PrecomputedRotationalEphemeris >( loadedRotationModel )->getNodeData( ) ==
+                 std::dynamic_pointer_cast< PrecomputedRotationalEphemeris >( computedRotationModel )->getNodeData( ) );
+
+    std::shared_ptr< RotationalEphemeris > underlyingRotationModel = createRotationModel( underlyingSettings, "Earth" );
+    for( int i = 0; i <= 100; i++ )
+    {
+        double currentTime = endTime * static_cast< double >( i ) / 100.0;
+        BOOST_CHECK_SMALL( loadedRotationModel->getRotationToTargetFrame( currentTime ).angularDistance(
+                               underlyingRotationModel->getRotationToTargetFrame( currentTime ) ), 1.0E-12 );
+    }
+
+    // Check that table is not loaded from cache file when it does not cover the requested interval
+    std::shared_ptr< RotationalEphemeris > extendedRotationModel = createRotationModel(
+                precomputedRotationModelSettings( underlyingSettings, startTime, 2.0 * endTime, 3600.0, 1.0E-12, 2,
+                                                  fileName ), "Earth" );
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< PrecomputedRotationalEphemeris >(
+                           extendedRotationModel )->getNumberOfNodes( ), 49 );
+    BOOST_CHECK_EQUAL( readPrecomputedRotationalEphemerisFromFile( fileName )->getNumberOfNodes( ), 49 );
+
+    // Check that table is not loaded from cache file when a setting of the underlying model is (slightly) changed
+    std::shared_ptr< RotationModelSettings > modifiedUnderlyingSettings = simpleRotationModelSettings(
+                "ECLIPJ2000", "IAU_Earth", initialOrientation, 0.0, EARTH_ROTATION_ANGLE_RATE * ( 1.0 + 1.0E-14 ) );
+    std::string originalSourceIdentifier, modifiedSourceIdentifier;
+    createRotationModel( precomputedRotationModelSettings( modifiedUnderlyingSettings, startTime, 2.0 * endTime, 3600.0,
+                                                           1.0E-12, 2, fileName ), "Earth" );
+    readPrecomputedRotationalEphemerisFromFile( fileName, modifiedSourceIdentifier );
+    createRotationModel( precomputedRotationModelSettings( underlyingSettings, startTime, 2.0 * endTime, 3600.0,
+                                                           1.0E-12, 2, fileName ), "Earth" );
+    readPrecomputedRotationalEphemerisFromFile( fileName, originalSourceIdentifier );
+    BOOST_CHECK( modifiedSourceIdentifier != originalSourceIdentifier );
+
+    // Check that underlying rotation model that cannot be fully identified by its settings is not cached
+    BOOST_CHECK_THROW( createRotationModel(
+                           precomputedRotationModelSettings(
+                               spiceRotationModelSettings( "ECLIPJ2000", "IAU_Earth", "IAU_Earth" ),
+                               startTime, endTime, 3600.0, 1.0E-12, 2, fileName ), "Earth" ), std::runtime_error );
+
+    // Check that environment-dependent underlying rotation model is rejected
+    BOOST_CHECK_THROW( createRotationModel(
+                           precomputedRotationModelSettings(
+                               std::make_shared< CustomRotationModelSettings >(
+                                   "ECLIPJ2000", "IAU_Earth",
+                                   [ ]( const double ){ return Eigen::Matrix3d::Identity( ).eval( ); }, 60.0 ),
+                               startTime, endTime ), "Earth" ), std::runtime_error );
+
+    std::remove( fileName.c_str( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,256 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/gravitation/gravityFieldGrid.h"
+#include "tudat/astro/gravitation/griddedGravityModel.h"
+#include "tudat/astro/gravitation/pinesSphericalHarmonicsGravity.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::gravitation;
+
+BOOST_AUTO_TEST_SUITE( test_gravity_field_grid )
+
+//! Function to generate random geodesy-normalized coefficients, with Kaula-type power spectrum
+void getRandomGravityFieldCoefficients( const int maximumDegree,
+                                        Eigen::MatrixXd& cosineCoefficients,
+                                        Eigen::MatrixXd& sineCoefficients )
+{
+    std::srand( 4 );
+    const Eigen::MatrixXd randomCosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    const Eigen::MatrixXd randomSineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        const double kaulaScaling = 1.0E-4 / static_cast< double >( degree * degree );
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = kaulaScaling * randomCosineCoefficients( degree, order );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = kaulaScaling * randomSineCoefficients( degree, order );
+            }
+        }
+    }
+}
+
+//! Test accuracy of grid w.r.t. source field, and consistency of reported error bounds
+BOOST_AUTO_TEST_CASE( testGravityFieldGridAccuracy )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomGravityFieldCoefficients( 20, cosineCoefficients, sineCoefficients );
+
+    PinesSphericalHarmonicsCache pinesCache( 20, 20 );
+
+    int numberOfSourceEvaluations = 0;
+    std::function< Eigen::Vector3d( const Eigen::Vector3d& ) > sourceAccelerationFunction =
+            [ & ]( const Eigen::Vector3d& position )
+    {
+        numberOfSourceEvaluations++;
+        return computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                    position, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    pinesCache );
+    };
+
+    const double relativeTolerance = 1.0E-8;
+    const double minimumRadius = 1.05 * referenceRadius;
+    const double maximumRadius = 2.0 * referenceRadius;
+    GravityFieldGrid gravityFieldGrid(
+                sourceAccelerationFunction, gravitationalParameter, minimumRadius, maximumRadius, relativeTolerance );
+
+    // Check grid properties
+    BOOST_CHECK_EQUAL( gravityFieldGrid.getLayers( ).size( ), 4 );
+    BOOST_CHECK_CLOSE_FRACTION( gravityFieldGrid.getLayers( ).front( ).minimumRadius_, minimumRadius, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( gravityFieldGrid.getLayers( ).back( ).maximumRadius_, maximumRadius, 1.0E-15 );
+    BOOST_CHECK( gravityFieldGrid.getMaximumRelativeError( ) < relativeTolerance );
+    for( unsigned int i = 0; i < gravityFieldGrid.getLayers( ).size( ); i++ )
+    {
+        BOOST_CHECK( gravityFieldGrid.getLayers( ).at( i ).maximumRelativeError_ < relativeTolerance );
+
+        // Check that angular resolution decreases with altitude
+        if( i > 0 )
+        {
+            BOOST_CHECK( gravityFieldGrid.getLayers( ).at( i ).numberOfLatitudeNodes_ <=
+                         gravityFieldGrid.getLayers( ).at( i - 1 ).numberOfLatitudeNodes_ );
+        }
+    }
+
+    // Check interpolation error at random points (including near the poles) w.r.t. reported error bound
+    std::srand( 8 );
+    double maximumRelativeError = 0.0;
+    for( int i = 0; i < 2000; i++ )
+    {
+        Eigen::Vector3d randomVector = Eigen::Vector3d::Random( );
+        if( i % 10 == 0 )
+        {
+            randomVector.segment( 0, 2 ) *= 1.0E-3;
+        }
+        double radius = minimumRadius + ( maximumRadius - minimumRadius ) * 0.5 * ( 1.0 + randomVector( 0 ) );
+        Eigen::Vector3d position = radius * randomVector.normalized( );
+
+        maximumRelativeError = std::max( maximumRelativeError,
+                                         gravityFieldGrid.computeRelativeInterpolationError( position ) );
+    }
+    BOOST_CHECK( maximumRelativeError < 5.0 * gravityFieldGrid.getMaximumRelativeError( ) );
+    BOOST_CHECK( maximumRelativeError < 5.0 * relativeTolerance );
+
+    // Check that positions outside of grid are computed from source field
+    numberOfSourceEvaluations = 0;
+    Eigen::Vector3d outsidePosition = 3.0 * referenceRadius * Eigen::Vector3d( 0.6, 0.0, 0.8 );
+    BOOST_CHECK( !gravityFieldGrid.isPositionInsideGrid( outsidePosition ) );
+    Eigen::Vector3d outsideAcceleration = gravityFieldGrid.getAcceleration( outsidePosition );
+    BOOST_CHECK_EQUAL( numberOfSourceEvaluations, 1 );
+    BOOST_CHECK_EQUAL( gravityFieldGrid.getNumberOfEvaluationsOutsideGrid( ), 1 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                outsideAcceleration, sourceAccelerationFunction( outsidePosition ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    // Check that positions inside grid do not evaluate source field
+    numberOfSourceEvaluations = 0;
+    gravityFieldGrid.getAcceleration( 1.5 * referenceRadius * Eigen::Vector3d( 0.6, 0.0, 0.8 ) );
+    BOOST_CHECK_EQUAL( numberOfSourceEvaluations, 0 );
+
+    // Check input errors
+    BOOST_CHECK_THROW( GravityFieldGrid( sourceAccelerationFunction, gravitationalParameter,
+                                         maximumRadius, minimumRadius, relativeTolerance ), std::runtime_error );
+    BOOST_CHECK_THROW( GravityFieldGrid( sourceAccelerationFunction, gravitationalParameter,
+                                         minimumRadius, maximumRadius, relativeTolerance, 1 ), std::runtime_error );
+}
+
+//! Test gradient of interpolated acceleration against numerical derivative and source field
+BOOST_AUTO_TEST_CASE( testGravityFieldGridGradient )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomGravityFieldCoefficients( 8, cosineCoefficients, sineCoefficients );
+    PinesSphericalHarmonicsCache pinesCache( 8, 8 );
+
+    std::function< Eigen::Vector3d( const Eigen::Vector3d& ) > sourceAccelerationFunction =
+            [ & ]( const Eigen::Vector3d& position )
+    {
+        return computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                    position, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    pinesCache );
+    };
+
+    GravityFieldGrid gravityFieldGrid( sourceAccelerationFunction, gravitationalParameter,
+                                       1.1 * referenceRadius, 1.5 * referenceRadius, 1.0E-9 );
+
+    std::vector< Eigen::Vector3d > testPositions;
+    testPositions.push_back( 1.2 * referenceRadius * Eigen::Vector3d( 0.48, -0.6, 0.64 ) );
+    testPositions.push_back( 1.4 * referenceRadius * Eigen::Vector3d( -0.8, 0.0, -0.6 ) );
+    testPositions.push_back( 1.3 * referenceRadius * Eigen::Vector3d( 0.01, 0.02, 1.0 ).normalized( ) );
+
+    for( unsigned int i = 0; i < testPositions.size( ); i++ )
+    {
+        Eigen::Vector3d acceleration;
+        Eigen::Matrix3d accelerationGradient;
+        gravityFieldGrid.getAccelerationAndGradient( testPositions.at( i ), acceleration, accelerationGradient );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    acceleration, gravityFieldGrid.getAcceleration( testPositions.at( i ) ), 1.0E-15 );
+
+        // Compute gradient by central differences of the grid acceleration
+        Eigen::Matrix3d numericalGradient;
+        double positionPerturbation = 10.0;
+        for( int j = 0; j < 3; j++ )
+        {
+            Eigen::Vector3d perturbation = Eigen::Vector3d::Zero( );
+            perturbation( j ) = positionPerturbation;
+            numericalGradient.col( j ) =
+                    ( gravityFieldGrid.getAcceleration( testPositions.at( i ) + perturbation ) -
+                      gravityFieldGrid.getAcceleration( testPositions.at( i ) - perturbation ) ) /
+                    ( 2.0 * positionPerturbation );
+        }
+
+        // Compute gradient from source field
+        sourceAccelerationFunction( testPositions.at( i ) );
+        Eigen::Matrix3d sourceGradient = computePartialDerivativeOfBodyFixedSphericalHarmonicAccelerationPines(
+                    gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients, pinesCache );
+
+        BOOST_CHECK_SMALL( ( accelerationGradient - numericalGradient ).norm( ) / accelerationGradient.norm( ), 1.0E-6 );
+        BOOST_CHECK_SMALL( ( accelerationGradient - sourceGradient ).norm( ) / sourceGradient.norm( ), 1.0E-6 );
+    }
+
+    Eigen::Vector3d outsideAcceleration;
+    Eigen::Matrix3d outsideAccelerationGradient;
+    BOOST_CHECK_THROW( gravityFieldGrid.getAccelerationAndGradient(
+                           2.0 * referenceRadius * Eigen::Vector3d::UnitX( ),
+                           outsideAcceleration, outsideAccelerationGradient ), std::runtime_error );
+}
+
+//! Test acceleration model using precomputed gravity field grid
+BOOST_AUTO_TEST_CASE( testGriddedGravitationalAccelerationModel )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomGravityFieldCoefficients( 10, cosineCoefficients, sineCoefficients );
+    PinesSphericalHarmonicsCache pinesCache( 10, 10 );
+    std::shared_ptr< GravityFieldGrid > gravityFieldGrid = std::make_shared< GravityFieldGrid >(
+                [ & ]( const Eigen::Vector3d& position )
+    {
+        return computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                    position, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    pinesCache );
+    }, gravitationalParameter, 1.1 * referenceRadius, 1.5 * referenceRadius, 1.0E-9 );
+
+    const Eigen::Vector3d bodyPosition( 1.0E8, -2.0E7, 3.0E6 );
+    const Eigen::Vector3d relativePosition = 1.3 * referenceRadius * Eigen::Vector3d( 0.36, 0.48, 0.8 );
+    const Eigen::Quaterniond rotationToInertialFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( 0.4, Eigen::Vector3d( 1.0, 2.0, -0.5 ).normalized( ) ) );
+    const double scaledGravitationalParameter = 1.01 * gravitationalParameter;
+
+    GriddedGravitationalAccelerationModel accelerationModel(
+                [ & ]( Eigen::Vector3d& input ){ input = bodyPosition + relativePosition; },
+                [ & ]( ){ return scaledGravitationalParameter; },
+                gravityFieldGrid,
+                [ & ]( Eigen::Vector3d& input ){ input = bodyPosition; },
+                [ & ]( ){ return rotationToInertialFrame; }, true );
+    accelerationModel.updateMembers( 0.0 );
+
+    // Compare to source field, evaluated in body-fixed frame
+    Eigen::Vector3d expectedAcceleration = rotationToInertialFrame * computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                rotationToInertialFrame.inverse( ) * relativePosition, scaledGravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients, pinesCache );
+    BOOST_CHECK_SMALL( ( accelerationModel.getAcceleration( ) - expectedAcceleration ).norm( ) /
+                       expectedAcceleration.norm( ), 5.0E-9 );
+    Eigen::Vector3d expectedBodyFixedPosition = rotationToInertialFrame.inverse( ) * relativePosition;
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                accelerationModel.getCurrentRelativePosition( ), expectedBodyFixedPosition, 1.0E-15 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
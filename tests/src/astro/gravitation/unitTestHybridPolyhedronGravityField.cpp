@@ -0,0 +1,303 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Spherical harmonic expansion of the gravitational potential of a polyhedron, R.A. Werner (1997), Computers &
+ *          Geosciences, 23(10), pp. 1071-1077
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/basic_astro/polyhedronFuntions.h"
+#include "tudat/astro/gravitation/hybridPolyhedronGravityField.h"
+#include "tudat/astro/gravitation/polyhedronGravityModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to create a triaxial ellipsoid shape model, with vertices on a latitude-longitude grid, and with its
+//! center shifted w.r.t. the origin.
+void createShiftedEllipsoidShapeModel(
+        const Eigen::Vector3d& semiAxes, const Eigen::Vector3d& centerOffset,
+        const int numberOfLatitudeRings, const int numberOfLongitudes,
+        Eigen::MatrixXd& verticesCoordinates, Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    const int numberOfVertices = 2 + numberOfLatitudeRings * numberOfLongitudes;
+    const int southPole = numberOfVertices - 1;
+
+    verticesCoordinates.resize( numberOfVertices, 3 );
+    verticesCoordinates.row( 0 ) << 0.0, 0.0, semiAxes( 2 );
+    verticesCoordinates.row( southPole ) << 0.0, 0.0, -semiAxes( 2 );
+    for( int ring = 0; ring < numberOfLatitudeRings; ring++ )
+    {
+        const double colatitude = mathematical_constants::PI * ( ring + 1 ) / ( numberOfLatitudeRings + 1 );
+        for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+        {
+            const double longitude = 2.0 * mathematical_constants::PI * ( longitudeIndex + 0.25 * ( ring % 2 ) ) /
+                    numberOfLongitudes;
+            verticesCoordinates.row( 1 + ring * numberOfLongitudes + longitudeIndex ) <<
+                semiAxes( 0 ) * std::sin( colatitude ) * std::cos( longitude ),
+                semiAxes( 1 ) * std::sin( colatitude ) * std::sin( longitude ),
+                semiAxes( 2 ) * std::cos( colatitude );
+        }
+    }
+    verticesCoordinates.rowwise( ) += centerOffset.transpose( );
+
+    // Define facets, with vertices in counterclockwise order when seen from outside
+    verticesDefiningEachFacet.resize( 2 * ( numberOfVertices - 2 ), 3 );
+    int facet = 0;
+    for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+    {
+        const int nextLongitudeIndex = ( longitudeIndex + 1 ) % numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) << 0, 1 + longitudeIndex, 1 + nextLongitudeIndex;
+        for( int ring = 0; ring < numberOfLatitudeRings - 1; ring++ )
+        {
+            const int upperVertex = 1 + ring * numberOfLongitudes + longitudeIndex;
+            const int upperNextVertex = 1 + ring * numberOfLongitudes + nextLongitudeIndex;
+            const int lowerVertex = upperVertex + numberOfLongitudes;
+            const int lowerNextVertex = upperNextVertex + numberOfLongitudes;
+            verticesDefiningEachFacet.row( facet++ ) << upperVertex, lowerVertex, lowerNextVertex;
+            verticesDefiningEachFacet.row( facet++ ) << upperVertex, lowerNextVertex, upperNextVertex;
+        }
+        const int lastRingOffset = 1 + ( numberOfLatitudeRings - 1 ) * numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) <<
+            lastRingOffset + longitudeIndex, southPole, lastRingOffset + nextLongitudeIndex;
+    }
+}
+
+//! Function to compute the centroid of a polyhedron (assuming constant density).
+Eigen::Vector3d computePolyhedronCentroid(
+        const Eigen::MatrixXd& verticesCoordinates, const Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    Eigen::Vector3d firstMoment = Eigen::Vector3d::Zero( );
+    double volume = 0.0;
+    for( int facet = 0; facet < verticesDefiningEachFacet.rows( ); facet++ )
+    {
+        const Eigen::Vector3d vertex0 = verticesCoordinates.row( verticesDefiningEachFacet( facet, 0 ) ).transpose( );
+        const Eigen::Vector3d vertex1 = verticesCoordinates.row( verticesDefiningEachFacet( facet, 1 ) ).transpose( );
+        const Eigen::Vector3d vertex2 = verticesCoordinates.row( verticesDefiningEachFacet( facet, 2 ) ).transpose( );
+        const double tetrahedronVolume = vertex0.dot( vertex1.cross( vertex2 ) ) / 6.0;
+        volume += tetrahedronVolume;
+        firstMoment += tetrahedronVolume * ( vertex0 + vertex1 + vertex2 ) / 4.0;
+    }
+    return firstMoment / volume;
+}
+
+BOOST_AUTO_TEST_SUITE( test_hybrid_polyhedron_gravity_field )
+
+//! Test the weight used to switch between polyhedron and spherical harmonics
+BOOST_AUTO_TEST_CASE( testSwitchWeight )
+{
+    const double innerRadius = 1000.0;
+    const double outerRadius = 1500.0;
+
+    BOOST_CHECK_EQUAL( gravitation::computeHybridGravityFieldPolyhedronWeight( 500.0, innerRadius, outerRadius ), 1.0 );
+    BOOST_CHECK_EQUAL( gravitation::computeHybridGravityFieldPolyhedronWeight( innerRadius, innerRadius, outerRadius ), 1.0 );
+    BOOST_CHECK_EQUAL( gravitation::computeHybridGravityFieldPolyhedronWeight( outerRadius, innerRadius, outerRadius ), 0.0 );
+    BOOST_CHECK_EQUAL( gravitation::computeHybridGravityFieldPolyhedronWeight( 2000.0, innerRadius, outerRadius ), 0.0 );
+    BOOST_CHECK_CLOSE_FRACTION(
+                gravitation::computeHybridGravityFieldPolyhedronWeight( 1250.0, innerRadius, outerRadius ), 0.5, 1.0E-15 );
+
+    // Derivative is zero at, and outside, the edges of the switching layer
+    BOOST_CHECK_EQUAL( gravitation::computeHybridGravityFieldPolyhedronWeightDerivative(
+                           innerRadius, innerRadius, outerRadius ), 0.0 );
+    BOOST_CHECK_EQUAL( gravitation::computeHybridGravityFieldPolyhedronWeightDerivative(
+                           outerRadius, innerRadius, outerRadius ), 0.0 );
+    BOOST_CHECK_EQUAL( gravitation::computeHybridGravityFieldPolyhedronWeightDerivative(
+                           2000.0, innerRadius, outerRadius ), 0.0 );
+
+    // Compare derivative with central difference
+    const double radiusPerturbation = 1.0E-3;
+    for( double radius = 1010.0; radius < outerRadius; radius += 97.0 )
+    {
+        const double numericalDerivative =
+                ( gravitation::computeHybridGravityFieldPolyhedronWeight(
+                      radius + radiusPerturbation, innerRadius, outerRadius ) -
+                  gravitation::computeHybridGravityFieldPolyhedronWeight(
+                      radius - radiusPerturbation, innerRadius, outerRadius ) ) / ( 2.0 * radiusPerturbation );
+        BOOST_CHECK_CLOSE_FRACTION( gravitation::computeHybridGravityFieldPolyhedronWeightDerivative(
+                                        radius, innerRadius, outerRadius ), numericalDerivative, 1.0E-8 );
+    }
+}
+
+//! Test the spherical harmonic coefficients of the polyhedron
+BOOST_AUTO_TEST_CASE( testPolyhedronSphericalHarmonicCoefficients )
+{
+    Eigen::MatrixXd verticesCoordinates;
+    Eigen::MatrixXi verticesDefiningEachFacet;
+    createShiftedEllipsoidShapeModel( ( Eigen::Vector3d( ) << 1200.0, 800.0, 600.0 ).finished( ),
+                                      ( Eigen::Vector3d( ) << 60.0, -40.0, 25.0 ).finished( ),
+                                      12, 24, verticesCoordinates, verticesDefiningEachFacet );
+
+    const double referenceRadius = basic_astrodynamics::computePolyhedronBrillouinRadius( verticesCoordinates );
+    BOOST_CHECK_CLOSE_FRACTION( referenceRadius, verticesCoordinates.rowwise( ).norm( ).maxCoeff( ),
+                                std::numeric_limits< double >::epsilon( ) );
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                verticesCoordinates, verticesDefiningEachFacet, 4, referenceRadius,
+                cosineCoefficients, sineCoefficients );
+
+    BOOST_CHECK_EQUAL( cosineCoefficients.rows( ), 5 );
+    BOOST_CHECK_EQUAL( cosineCoefficients.cols( ), 5 );
+    BOOST_CHECK_EQUAL( sineCoefficients.rows( ), 5 );
+    BOOST_CHECK_EQUAL( sineCoefficients.cols( ), 5 );
+
+    // Degree 0 coefficient is 1, degree 1 coefficients are given by the centroid of the polyhedron
+    const Eigen::Vector3d centroid = computePolyhedronCentroid( verticesCoordinates, verticesDefiningEachFacet );
+    const double degreeOneNormalization = referenceRadius * std::sqrt( 3.0 );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 0, 0 ), 1.0, 1.0E-14 );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 1, 0 ), centroid( 2 ) / degreeOneNormalization, 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 1, 1 ), centroid( 0 ) / degreeOneNormalization, 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( sineCoefficients( 1, 1 ), centroid( 1 ) / degreeOneNormalization, 1.0E-12 );
+
+    // Order-zero sine coefficients vanish, and coefficients with order larger than degree are zero
+    for( int degree = 0; degree <= 4; degree++ )
+    {
+        BOOST_CHECK_EQUAL( sineCoefficients( degree, 0 ), 0.0 );
+        for( int order = degree + 1; order <= 4; order++ )
+        {
+            BOOST_CHECK_EQUAL( cosineCoefficients( degree, order ), 0.0 );
+            BOOST_CHECK_EQUAL( sineCoefficients( degree, order ), 0.0 );
+        }
+    }
+}
+
+//! Test the hybrid gravity field against the polyhedron gravity field
+BOOST_AUTO_TEST_CASE( testHybridGravityField )
+{
+    Eigen::MatrixXd verticesCoordinates;
+    Eigen::MatrixXi verticesDefiningEachFacet;
+    createShiftedEllipsoidShapeModel( ( Eigen::Vector3d( ) << 1200.0, 800.0, 600.0 ).finished( ),
+                                      ( Eigen::Vector3d( ) << 60.0, -40.0, 25.0 ).finished( ),
+                                      18, 36, verticesCoordinates, verticesDefiningEachFacet );
+
+    const double gravitationalParameter = 5.0;
+    gravitation::PolyhedronGravityField polyhedronGravityField(
+                gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    gravitation::HybridPolyhedronGravityField hybridGravityField(
+                gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, 16, 0.1, 0.2 );
+
+    const double brillouinRadius = hybridGravityField.getBrillouinRadius( );
+    BOOST_CHECK_CLOSE_FRACTION( hybridGravityField.getInnerSwitchRadius( ), 1.1 * brillouinRadius, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( hybridGravityField.getOuterSwitchRadius( ), 1.1 * 1.2 * brillouinRadius, 1.0E-15 );
+    BOOST_CHECK_EQUAL( hybridGravityField.getExteriorGravityField( )->getDegreeOfExpansion( ), 16 );
+
+    const Eigen::Vector3d direction = ( Eigen::Vector3d( ) << 0.6, -0.3, 0.5 ).finished( ).normalized( );
+
+    // Inside the inner switch radius, the polyhedron is used
+    for( double relativeRadius: { 0.5, 1.0, 1.05 } )
+    {
+        const Eigen::Vector3d position = relativeRadius * brillouinRadius * direction;
+        BOOST_CHECK_EQUAL( hybridGravityField.getGravitationalPotential( position ),
+                           polyhedronGravityField.getGravitationalPotential( position ) );
+        BOOST_CHECK_EQUAL( hybridGravityField.getLaplacianOfPotential( position ),
+                           polyhedronGravityField.getLaplacianOfPotential( position ) );
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_EQUAL( hybridGravityField.getGradientOfPotential( position )( i ),
+                               polyhedronGravityField.getGradientOfPotential( position )( i ) );
+        }
+    }
+
+    // In the switching layer and outside of it, the hybrid field reproduces the polyhedron, up to the truncation error
+    // of the spherical harmonic expansion
+    for( double relativeRadius: { 1.15, 1.25, 1.5, 3.0 } )
+    {
+        const Eigen::Vector3d position = relativeRadius * brillouinRadius * direction;
+        const Eigen::Vector3d polyhedronGradient = polyhedronGravityField.getGradientOfPotential( position );
+        const Eigen::Vector3d hybridGradient = hybridGravityField.getGradientOfPotential( position );
+
+        BOOST_CHECK_CLOSE_FRACTION( hybridGravityField.getGravitationalPotential( position ),
+                                    polyhedronGravityField.getGravitationalPotential( position ), 1.0E-5 );
+        BOOST_CHECK_SMALL( ( hybridGradient - polyhedronGradient ).norm( ) / polyhedronGradient.norm( ), 1.0E-4 );
+    }
+
+    // Outside the outer switch radius, the spherical harmonics are used
+    const Eigen::Vector3d farPosition = 2.0 * brillouinRadius * direction;
+    BOOST_CHECK_EQUAL( hybridGravityField.getGravitationalPotential( farPosition ),
+                       hybridGravityField.getExteriorGravityField( )->getGravitationalPotential( farPosition ) );
+    BOOST_CHECK_EQUAL( hybridGravityField.getLaplacianOfPotential( farPosition ), 0.0 );
+
+    // Check that an invalid switching layer is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        gravitation::HybridPolyhedronGravityField invalidGravityField(
+                    gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, 4, 0.1, 0.0 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test the polyhedron acceleration model with exterior spherical harmonic gravity field
+BOOST_AUTO_TEST_CASE( testHybridGravityAccelerationModel )
+{
+    Eigen::MatrixXd verticesCoordinates;
+    Eigen::MatrixXi verticesDefiningEachFacet;
+    createShiftedEllipsoidShapeModel( ( Eigen::Vector3d( ) << 1200.0, 800.0, 600.0 ).finished( ),
+                                      ( Eigen::Vector3d( ) << 60.0, -40.0, 25.0 ).finished( ),
+                                      12, 24, verticesCoordinates, verticesDefiningEachFacet );
+
+    const double gravitationalParameter = 5.0;
+    std::shared_ptr< gravitation::HybridPolyhedronGravityField > hybridGravityField =
+            std::make_shared< gravitation::HybridPolyhedronGravityField >(
+                gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet, 12 );
+
+    Eigen::Vector3d bodyFixedPosition;
+    std::function< void( Eigen::Vector3d& ) > bodyFixedPositionFunction =
+            [ & ]( Eigen::Vector3d& positionToSet ){ positionToSet = bodyFixedPosition; };
+
+    gravitation::PolyhedronGravitationalAccelerationModel gravityModel(
+                bodyFixedPositionFunction, gravitationalParameter, hybridGravityField->getVolume( ),
+                verticesCoordinates, verticesDefiningEachFacet, hybridGravityField->getVerticesDefiningEachEdge( ),
+                hybridGravityField->getFacetDyads( ), hybridGravityField->getEdgeDyads( ) );
+    gravityModel.setExteriorGravityField( hybridGravityField->getExteriorGravityField( ),
+                                          hybridGravityField->getInnerSwitchRadius( ),
+                                          hybridGravityField->getOuterSwitchRadius( ) );
+    gravityModel.resetUpdatePotential( true );
+
+    const Eigen::Vector3d direction = ( Eigen::Vector3d( ) << -0.2, 0.7, 0.4 ).finished( ).normalized( );
+    for( double relativeRadius: { 0.9, 1.15, 1.25, 2.0 } )
+    {
+        bodyFixedPosition = relativeRadius * hybridGravityField->getBrillouinRadius( ) * direction;
+        gravityModel.updateMembers( relativeRadius );
+
+        BOOST_CHECK_EQUAL( gravityModel.getCurrentPolyhedronWeight( ),
+                           gravitation::computeHybridGravityFieldPolyhedronWeight(
+                               bodyFixedPosition.norm( ), hybridGravityField->getInnerSwitchRadius( ),
+                               hybridGravityField->getOuterSwitchRadius( ) ) );
+        BOOST_CHECK_CLOSE_FRACTION( gravityModel.getCurrentPotential( ),
+                                    hybridGravityField->getGravitationalPotential( bodyFixedPosition ), 1.0E-14 );
+
+        const Eigen::Vector3d expectedAcceleration = hybridGravityField->getGradientOfPotential( bodyFixedPosition );
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( gravityModel.getAcceleration( )( i ), expectedAcceleration( i ), 1.0E-14 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,330 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/astro/gravitation/pinesSphericalHarmonicsGravity.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::gravitation;
+
+//! Function to generate a random, geodesy-normalized, spherical harmonic gravity field with a Kaula-type power spectrum
+void getRandomSphericalHarmonicCoefficients(
+        const int maximumDegree, Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
+{
+    std::srand( 42 );
+    cosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        double degreeScaling = 1.0E-5 / std::max( 1.0, static_cast< double >( degree * degree ) );
+        for( int order = 0; order <= maximumDegree; order++ )
+        {
+            if( order > degree )
+            {
+                cosineCoefficients( degree, order ) = 0.0;
+                sineCoefficients( degree, order ) = 0.0;
+            }
+            else
+            {
+                cosineCoefficients( degree, order ) *= degreeScaling;
+                sineCoefficients( degree, order ) *= degreeScaling;
+            }
+        }
+        sineCoefficients( degree, 0 ) = 0.0;
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 1, 0 ) = 0.0;
+    cosineCoefficients( 1, 1 ) = 0.0;
+    sineCoefficients( 1, 1 ) = 0.0;
+}
+
+BOOST_AUTO_TEST_SUITE( test_pines_spherical_harmonics_gravity )
+
+//! Compare Pines evaluation to term-wise evaluation of spherical harmonic acceleration
+BOOST_AUTO_TEST_CASE( testPinesSphericalHarmonicAcceleration )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+
+    const Eigen::Matrix3d rotation = Eigen::Matrix3d(
+                Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) *
+                Eigen::AngleAxisd( -0.1, Eigen::Vector3d::UnitX( ) ) );
+
+    std::vector< Eigen::Vector3d > testPositions;
+    testPositions.push_back( ( Eigen::Vector3d( ) << 1.9E6, -0.7E6, 1.1E6 ).finished( ) );
+    testPositions.push_back( ( Eigen::Vector3d( ) << -1.2E6, -1.3E6, -0.4E6 ).finished( ) );
+    testPositions.push_back( ( Eigen::Vector3d( ) << 0.3E6, 0.1E6, 2.1E6 ).finished( ) );
+    testPositions.push_back( ( Eigen::Vector3d( ) << 8.0E6, 2.0E6, -3.0E6 ).finished( ) );
+
+    for( int maximumDegree : { 2, 20, 100, 360 } )
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+        PinesSphericalHarmonicsCache pinesCache( maximumDegree, maximumDegree );
+        std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+
+        for( unsigned int i = 0; i < testPositions.size( ); i++ )
+        {
+            // Test full field, and truncated field with order lower than degree
+            for( int test = 0; test < 2; test++ )
+            {
+                int numberOfOrders = ( test == 0 ) ? maximumDegree + 1 : ( maximumDegree / 2 + 1 );
+                Eigen::MatrixXd currentCosineCoefficients = cosineCoefficients.block(
+                            0, 0, maximumDegree + 1, numberOfOrders );
+                Eigen::MatrixXd currentSineCoefficients = sineCoefficients.block(
+                            0, 0, maximumDegree + 1, numberOfOrders );
+
+                Eigen::Vector3d termWiseAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                            testPositions.at( i ), gravitationalParameter, referenceRadius,
+                            currentCosineCoefficients, currentSineCoefficients, sphericalHarmonicsCache,
+                            dummyMap, false, rotation );
+                Eigen::Vector3d pinesAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                            testPositions.at( i ), gravitationalParameter, referenceRadius,
+                            currentCosineCoefficients, currentSineCoefficients, pinesCache, rotation );
+
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( termWiseAcceleration, pinesAcceleration, 1.0E-12 );
+            }
+        }
+    }
+
+    // Check that an insufficiently large cache is detected
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomSphericalHarmonicCoefficients( 10, cosineCoefficients, sineCoefficients );
+        PinesSphericalHarmonicsCache pinesCache( 5, 5 );
+        BOOST_CHECK_THROW( computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                               testPositions.at( 0 ), gravitationalParameter, referenceRadius,
+                               cosineCoefficients, sineCoefficients, pinesCache ), std::runtime_error );
+    }
+}
+
+//! Check Pines acceleration and its partials on, and close to, the polar axis
+BOOST_AUTO_TEST_CASE( testPinesSphericalHarmonicAccelerationAtPole )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+    const int maximumDegree = 50;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+    PinesSphericalHarmonicsCache pinesCache( maximumDegree, maximumDegree );
+
+    for( double polarSign : { -1.0, 1.0 } )
+    {
+        Eigen::Vector3d polarPosition = Eigen::Vector3d( 0.0, 0.0, polarSign * 1.9E6 );
+
+        // Compute acceleration and gradient exactly on polar axis
+        Eigen::Vector3d polarAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                    polarPosition, gravitationalParameter, referenceRadius,
+                    cosineCoefficients, sineCoefficients, pinesCache );
+        Eigen::Matrix3d polarGradient = computePartialDerivativeOfBodyFixedSphericalHarmonicAccelerationPines(
+                    gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients, pinesCache );
+
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_EQUAL( std::isfinite( polarAcceleration( i ) ), true );
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_EQUAL( std::isfinite( polarGradient( i, j ) ), true );
+            }
+        }
+
+        // Compare to term-wise evaluation close to polar axis
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+        std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+        Eigen::Vector3d nearPolarPosition = polarPosition + Eigen::Vector3d( 100.0, 100.0, 0.0 );
+        Eigen::Vector3d termWiseAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                    nearPolarPosition, gravitationalParameter, referenceRadius,
+                    cosineCoefficients, sineCoefficients, sphericalHarmonicsCache, dummyMap );
+        Eigen::Vector3d nearPolarAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                    nearPolarPosition, gravitationalParameter, referenceRadius,
+                    cosineCoefficients, sineCoefficients, pinesCache );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( termWiseAcceleration, nearPolarAcceleration, 1.0E-8 );
+
+        // Compare gradient on polar axis to numerical derivative of acceleration
+        Eigen::Matrix3d numericalGradient;
+        const double positionPerturbation = 1.0;
+        for( int j = 0; j < 3; j++ )
+        {
+            Eigen::Vector3d perturbedPosition = polarPosition;
+            perturbedPosition( j ) += positionPerturbation;
+            Eigen::Vector3d upPerturbedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                        perturbedPosition, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, pinesCache );
+            perturbedPosition( j ) -= 2.0 * positionPerturbation;
+            Eigen::Vector3d downPerturbedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                        perturbedPosition, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, pinesCache );
+            numericalGradient.block( 0, j, 3, 1 ) =
+                    ( upPerturbedAcceleration - downPerturbedAcceleration ) / ( 2.0 * positionPerturbation );
+        }
+
+        // Several entries of the gradient vanish on the polar axis, so compare relative to norm of gradient
+        BOOST_CHECK_SMALL( ( polarGradient - numericalGradient ).norm( ) / polarGradient.norm( ), 1.0E-6 );
+    }
+}
+
+//! Compare Pines gravity gradient and coefficient partials to numerical derivatives
+BOOST_AUTO_TEST_CASE( testPinesSphericalHarmonicPartials )
+{
+    const double gravitationalParameter = 3.986004418e14;
+    const double referenceRadius = 6378137.0;
+    const int maximumDegree = 30;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+    PinesSphericalHarmonicsCache pinesCache( maximumDegree, maximumDegree );
+
+    const Eigen::Matrix3d rotation = Eigen::Matrix3d(
+                Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) *
+                Eigen::AngleAxisd( -0.1, Eigen::Vector3d::UnitX( ) ) );
+
+    std::vector< Eigen::Vector3d > testPositions;
+    testPositions.push_back( ( Eigen::Vector3d( ) << 7.0E6, 8.0E6, 9.0E6 ).finished( ) );
+    testPositions.push_back( ( Eigen::Vector3d( ) << -6.5E6, 1.0E6, -0.5E6 ).finished( ) );
+
+    for( unsigned int i = 0; i < testPositions.size( ); i++ )
+    {
+        // Compare gravity gradient to numerical derivative of acceleration
+        computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                    testPositions.at( i ), gravitationalParameter, referenceRadius,
+                    cosineCoefficients, sineCoefficients, pinesCache );
+        Eigen::Matrix3d analyticalGradient = computePartialDerivativeOfBodyFixedSphericalHarmonicAccelerationPines(
+                    gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients, pinesCache );
+
+        Eigen::Matrix3d numericalGradient;
+        const double positionPerturbation = 10.0;
+        for( int j = 0; j < 3; j++ )
+        {
+            Eigen::Vector3d perturbedPosition = testPositions.at( i );
+            perturbedPosition( j ) += positionPerturbation;
+            Eigen::Vector3d upPerturbedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                        perturbedPosition, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, pinesCache );
+            perturbedPosition( j ) -= 2.0 * positionPerturbation;
+            Eigen::Vector3d downPerturbedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                        perturbedPosition, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, pinesCache );
+            numericalGradient.block( 0, j, 3, 1 ) =
+                    ( upPerturbedAcceleration - downPerturbedAcceleration ) / ( 2.0 * positionPerturbation );
+        }
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( analyticalGradient, numericalGradient, 1.0E-6 );
+
+        // Compare coefficient partials to difference of accelerations (acceleration is linear in coefficients)
+        std::vector< std::pair< int, int > > blockIndices;
+        for( int degree = 2; degree <= 6; degree++ )
+        {
+            for( int order = 0; order <= degree; order++ )
+            {
+                blockIndices.push_back( std::make_pair( degree, order ) );
+            }
+        }
+
+        pinesCache.update( testPositions.at( i ), referenceRadius );
+        Eigen::MatrixXd cosinePartials, sinePartials;
+        computeSphericalHarmonicGravityWrtCoefficientsPines(
+                    gravitationalParameter, referenceRadius, pinesCache, blockIndices, false, rotation, cosinePartials,
+                    maximumDegree, maximumDegree );
+        computeSphericalHarmonicGravityWrtCoefficientsPines(
+                    gravitationalParameter, referenceRadius, pinesCache, blockIndices, true, rotation, sinePartials,
+                    maximumDegree, maximumDegree );
+
+        for( unsigned int j = 0; j < blockIndices.size( ); j++ )
+        {
+            Eigen::MatrixXd unitCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+            Eigen::MatrixXd zeroCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+            unitCoefficients( blockIndices.at( j ).first, blockIndices.at( j ).second ) = 1.0;
+
+            Eigen::Vector3d expectedCosinePartial = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                        testPositions.at( i ), gravitationalParameter, referenceRadius,
+                        unitCoefficients, zeroCoefficients, pinesCache, rotation );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedCosinePartial, cosinePartials.block( 0, j, 3, 1 ), 1.0E-12 );
+
+            if( blockIndices.at( j ).second > 0 )
+            {
+                Eigen::Vector3d expectedSinePartial = computeGeodesyNormalizedGravitationalAccelerationSumPines(
+                            testPositions.at( i ), gravitationalParameter, referenceRadius,
+                            zeroCoefficients, unitCoefficients, pinesCache, rotation );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedSinePartial, sinePartials.block( 0, j, 3, 1 ), 1.0E-12 );
+            }
+            else
+            {
+                BOOST_CHECK_SMALL( sinePartials.block( 0, j, 3, 1 ).norm( ), std::numeric_limits< double >::epsilon( ) );
+            }
+        }
+    }
+}
+
+//! Check that Pines evaluation is used by acceleration model when selected
+BOOST_AUTO_TEST_CASE( testPinesSphericalHarmonicAccelerationModel )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+    const int maximumDegree = 40;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+
+    Eigen::Vector3d position = Eigen::Vector3d( 0.4E6, -1.1E6, 1.7E6 );
+    Eigen::Quaterniond rotation = Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) );
+
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > termWiseModel =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients,
+                [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                [ & ]( ){ return rotation; } );
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > pinesModel =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients,
+                [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                [ & ]( ){ return rotation; } );
+    pinesModel->setEvaluationAlgorithm( pines_spherical_harmonics_evaluation );
+
+    BOOST_CHECK_EQUAL( termWiseModel->getEvaluationAlgorithm( ), term_wise_spherical_harmonics_evaluation );
+    BOOST_CHECK_EQUAL( pinesModel->getEvaluationAlgorithm( ), pines_spherical_harmonics_evaluation );
+    BOOST_CHECK_EQUAL( termWiseModel->getPinesCache( ) == nullptr, true );
+    BOOST_CHECK_EQUAL( pinesModel->getPinesCache( ) == nullptr, false );
+
+    termWiseModel->updateMembers( 0.0 );
+    pinesModel->updateMembers( 0.0 );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( termWiseModel->getAcceleration( ), pinesModel->getAcceleration( ), 1.0E-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -16,6 +16,7 @@
 #define BOOST_TEST_MAIN
 
 #include <limits>
+#include <thread>
 
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
@@ -28,6 +29,55 @@ namespace tudat
 namespace unit_tests
 {
 
+//! Function to create a triaxial ellipsoid shape model, with vertices on a latitude-longitude grid.
+void createEllipsoidShapeModel(
+        const double semiAxisX, const double semiAxisY, const double semiAxisZ,
+        const int numberOfLatitudeRings, const int numberOfLongitudes,
+        Eigen::MatrixXd& verticesCoordinates, Eigen::MatrixXi& verticesDefiningEachFacet )
+{
+    const int numberOfVertices = 2 + numberOfLatitudeRings * numberOfLongitudes;
+    const int southPole = numberOfVertices - 1;
+
+    verticesCoordinates.resize( numberOfVertices, 3 );
+    verticesCoordinates.row( 0 ) << 0.0, 0.0, semiAxisZ;
+    verticesCoordinates.row( southPole ) << 0.0, 0.0, -semiAxisZ;
+    for( int ring = 0; ring < numberOfLatitudeRings; ring++ )
+    {
+        const double colatitude = mathematical_constants::PI * ( ring + 1 ) / ( numberOfLatitudeRings + 1 );
+        for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+        {
+            // Slightly shift longitudes of consecutive rings, so that the facets are not symmetric
+            const double longitude = 2.0 * mathematical_constants::PI * ( longitudeIndex + 0.25 * ( ring % 2 ) ) /
+                    numberOfLongitudes;
+            verticesCoordinates.row( 1 + ring * numberOfLongitudes + longitudeIndex ) <<
+                semiAxisX * std::sin( colatitude ) * std::cos( longitude ),
+                semiAxisY * std::sin( colatitude ) * std::sin( longitude ),
+                semiAxisZ * std::cos( colatitude );
+        }
+    }
+
+    // Define facets, with vertices in counterclockwise order when seen from outside
+    verticesDefiningEachFacet.resize( 2 * ( numberOfVertices - 2 ), 3 );
+    int facet = 0;
+    for( int longitudeIndex = 0; longitudeIndex < numberOfLongitudes; longitudeIndex++ )
+    {
+        const int nextLongitudeIndex = ( longitudeIndex + 1 ) % numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) << 0, 1 + longitudeIndex, 1 + nextLongitudeIndex;
+        for( int ring = 0; ring < numberOfLatitudeRings - 1; ring++ )
+        {
+            const int upperVertex = 1 + ring * numberOfLongitudes + longitudeIndex;
+            const int upperNextVertex = 1 + ring * numberOfLongitudes + nextLongitudeIndex;
+            const int lowerVertex = upperVertex + numberOfLongitudes;
+            const int lowerNextVertex = upperNextVertex + numberOfLongitudes;
+            verticesDefiningEachFacet.row( facet++ ) << upperVertex, lowerVertex, lowerNextVertex;
+            verticesDefiningEachFacet.row( facet++ ) << upperVertex, lowerNextVertex, upperNextVertex;
+        }
+        const int lastRingOffset = 1 + ( numberOfLatitudeRings - 1 ) * numberOfLongitudes;
+        verticesDefiningEachFacet.row( facet++ ) <<
+            lastRingOffset + longitudeIndex, southPole, lastRingOffset + nextLongitudeIndex;
+    }
+}
+
 //! Test the functionality of the polyhedron gravity field class.
 BOOST_AUTO_TEST_SUITE( test_polyhedron_gravity_field )
 
@@ -238,6 +288,125 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
     }
 }
 
+//! Test the structure-of-arrays (and multithreaded) evaluation of the gravity field against the per-term functions
+BOOST_AUTO_TEST_CASE( testStructureOfArraysEvaluation )
+{
+    // Create irregular shape model
+    Eigen::MatrixXd verticesCoordinates;
+    Eigen::MatrixXi verticesDefiningEachFacet;
+    createEllipsoidShapeModel( 1200.0, 900.0, 700.0, 19, 37, verticesCoordinates, verticesDefiningEachFacet );
+
+    const double gravitationalParameter = 1.0E-1;
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+            gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    const double gravitationalConstantTimesDensity = gravitationalParameter / gravityField.getVolume( );
+
+    // Check consistency of shape model
+    BOOST_CHECK_CLOSE_FRACTION( gravityField.getVolume( ), 4.0 / 3.0 * mathematical_constants::PI * 1200.0 * 900.0 * 700.0,
+                                0.02 );
+    BOOST_CHECK_EQUAL( gravityField.getVerticesDefiningEachEdge( ).rows( ), 3 * verticesDefiningEachFacet.rows( ) / 2 );
+
+    std::vector< Eigen::Vector3d > testPositions = {
+        ( Eigen::Vector3d( ) << 5000.0, -2000.0, 1000.0 ).finished( ),
+        ( Eigen::Vector3d( ) << 1000.0, 800.0, -600.0 ).finished( ),
+        ( Eigen::Vector3d( ) << -50.0, 1000.0, 30.0 ).finished( ),
+        ( Eigen::Vector3d( ) << 100.0, -200.0, 300.0 ).finished( ) };
+
+    for( unsigned int numberOfThreads: { 1, 2, 3, 8 } )
+    {
+        gravityField.setNumberOfThreads( numberOfThreads );
+        for( unsigned int i = 0; i < testPositions.size( ); i++ )
+        {
+            // Compute values with per-term functions
+            Eigen::MatrixXd relativeVerticesCoordinates;
+            Eigen::VectorXd perFacetFactor, perEdgeFactor;
+            basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                        relativeVerticesCoordinates, testPositions.at( i ), verticesCoordinates );
+            basic_mathematics::calculatePolyhedronPerFacetFactor(
+                        perFacetFactor, relativeVerticesCoordinates, verticesDefiningEachFacet );
+            basic_mathematics::calculatePolyhedronPerEdgeFactor(
+                        perEdgeFactor, relativeVerticesCoordinates, gravityField.getVerticesDefiningEachEdge( ) );
+
+            double expectedPotential = basic_mathematics::calculatePolyhedronGravitationalPotential(
+                        gravitationalConstantTimesDensity, relativeVerticesCoordinates, verticesDefiningEachFacet,
+                        gravityField.getVerticesDefiningEachEdge( ), gravityField.getFacetDyads( ),
+                        gravityField.getEdgeDyads( ), perFacetFactor, perEdgeFactor );
+            Eigen::Vector3d expectedGradient = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
+                        gravitationalConstantTimesDensity, relativeVerticesCoordinates, verticesDefiningEachFacet,
+                        gravityField.getVerticesDefiningEachEdge( ), gravityField.getFacetDyads( ),
+                        gravityField.getEdgeDyads( ), perFacetFactor, perEdgeFactor );
+            Eigen::Matrix3d expectedHessian = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
+                        gravitationalConstantTimesDensity, gravityField.getFacetDyads( ),
+                        gravityField.getEdgeDyads( ), perFacetFactor, perEdgeFactor );
+            double expectedLaplacian = basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
+                        gravitationalConstantTimesDensity, perFacetFactor );
+
+            // Compare with values from structure-of-arrays evaluation. The vectors to the edges and facets are taken to
+            // different points on the edges/facets, so results are only equal up to rounding errors
+            BOOST_CHECK_CLOSE_FRACTION( gravityField.getGravitationalPotential( testPositions.at( i ) ),
+                                        expectedPotential, 1.0E-12 );
+            BOOST_CHECK_SMALL( ( gravityField.getGradientOfPotential( testPositions.at( i ) ) - expectedGradient ).norm( ),
+                               1.0E-12 * expectedGradient.norm( ) );
+            BOOST_CHECK_SMALL( ( gravityField.getHessianOfPotential( testPositions.at( i ) ) - expectedHessian ).norm( ),
+                               1.0E-12 * expectedHessian.norm( ) );
+            BOOST_CHECK_SMALL( gravityField.getLaplacianOfPotential( testPositions.at( i ) ) - expectedLaplacian,
+                               1.0E-12 * gravitationalConstantTimesDensity );
+        }
+    }
+
+    // Check laplacian for points inside and outside the polyhedron
+    BOOST_CHECK_SMALL( gravityField.getLaplacianOfPotential( testPositions.at( 0 ) ), 1.0E-12 * gravitationalConstantTimesDensity );
+    BOOST_CHECK_CLOSE_FRACTION( gravityField.getLaplacianOfPotential( testPositions.at( 3 ) ),
+                                -4.0 * mathematical_constants::PI * gravitationalConstantTimesDensity, 1.0E-12 );
+}
+
+//! Test multi-threaded evaluation of the gravity field of a shape model with 100000 facets.
+BOOST_AUTO_TEST_CASE( testLargeShapeModelEvaluation )
+{
+    // Create shape model with 100000 facets
+    Eigen::MatrixXd verticesCoordinates;
+    Eigen::MatrixXi verticesDefiningEachFacet;
+    createEllipsoidShapeModel( 16.0E3, 10.0E3, 8.0E3, 200, 250, verticesCoordinates, verticesDefiningEachFacet );
+    BOOST_CHECK_EQUAL( verticesDefiningEachFacet.rows( ), 100000 );
+
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+            4.46E5, verticesCoordinates, verticesDefiningEachFacet );
+
+    const unsigned int numberOfEvaluations = 20;
+    const unsigned int maximumNumberOfThreads = std::max( 2u, std::thread::hardware_concurrency( ) );
+    Eigen::Vector3d singleThreadGradient = Eigen::Vector3d::Zero( );
+    for( unsigned int numberOfThreads: { 1u, maximumNumberOfThreads } )
+    {
+        gravityField.setNumberOfThreads( numberOfThreads );
+        BOOST_CHECK_EQUAL( gravityField.getNumberOfActiveThreads( ), std::min( numberOfThreads, 20u ) );
+
+        // Evaluate gradient at different positions (so that no cached values are used)
+        Eigen::Vector3d gradientSum = Eigen::Vector3d::Zero( );
+        for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+        {
+            gradientSum += gravityField.getGradientOfPotential(
+                        ( Eigen::Vector3d( ) << 20.0E3 + 100.0 * i, 5.0E3, -3.0E3 ).finished( ) );
+        }
+
+        // Check that threaded evaluation is consistent with single-threaded evaluation
+        if( numberOfThreads == 1 )
+        {
+            singleThreadGradient = gradientSum;
+        }
+        else
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( singleThreadGradient, gradientSum, 1.0E-12 );
+        }
+    }
+
+    // Check that threads are not used for shape models with too few facets per thread
+    createEllipsoidShapeModel( 16.0E3, 10.0E3, 8.0E3, 20, 25, verticesCoordinates, verticesDefiningEachFacet );
+    gravitation::PolyhedronGravityField smallGravityField = gravitation::PolyhedronGravityField(
+            4.46E5, verticesCoordinates, verticesDefiningEachFacet );
+    smallGravityField.setNumberOfThreads( 8 );
+    BOOST_CHECK_EQUAL( smallGravityField.getNumberOfActiveThreads( ), 1 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace tudat
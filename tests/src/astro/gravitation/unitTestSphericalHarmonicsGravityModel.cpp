@@ -342,6 +342,87 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalPotentialWrapperClass
     BOOST_CHECK_EQUAL( expectedPotential, potential );
 }
 
+// Test altitude-adaptive truncation of spherical harmonic expansion
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationAdaptiveTruncation )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 4.9028E12;
+    const double planetaryRadius = 1.738E6;
+    const int maximumDegree = 150;
+
+    // Generate random coefficients with Kaula-type power spectrum
+    std::srand( 42 );
+    const Eigen::MatrixXd randomCosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    const Eigen::MatrixXd randomSineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        const double kaulaScaling = 1.0E-4 / static_cast< double >( degree * degree );
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = kaulaScaling * randomCosineCoefficients( degree, order );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = kaulaScaling * randomSineCoefficients( degree, order );
+            }
+        }
+    }
+
+    const double truncationTolerance = 1.0E-12;
+
+    Eigen::Vector3d position;
+    SphericalHarmonicsGravitationalAccelerationModelPointer fullGravity
+            = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    SphericalHarmonicsGravitationalAccelerationModelPointer truncatedGravity
+            = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    truncatedGravity->setDegreeTruncationTolerance( truncationTolerance );
+    BOOST_CHECK_EQUAL( truncatedGravity->getDegreeTruncationTolerance( ), truncationTolerance );
+
+    // Evaluate acceleration at increasing distance, and check truncation degree and accuracy
+    int previousTruncationDegree = maximumDegree + 1;
+    const Eigen::Vector3d unitVector = Eigen::Vector3d( 0.3, -0.5, 0.7 ).normalized( );
+    for( double radiusRatio : { 1.02, 1.1, 1.5, 3.0, 10.0, 100.0 } )
+    {
+        position = radiusRatio * planetaryRadius * unitVector;
+        fullGravity->updateMembers( radiusRatio );
+        truncatedGravity->updateMembers( radiusRatio );
+
+        const int truncationDegree = truncatedGravity->getCurrentTruncationDegree( );
+        BOOST_CHECK_EQUAL( fullGravity->getCurrentTruncationDegree( ), maximumDegree );
+        BOOST_CHECK_EQUAL( truncatedGravity->getCurrentTruncationOrder( ), truncationDegree );
+        BOOST_CHECK( truncationDegree <= previousTruncationDegree );
+        BOOST_CHECK( truncationDegree <= maximumDegree );
+        previousTruncationDegree = truncationDegree;
+
+        // Check that truncation error is below tolerance (w.r.t. point-mass acceleration)
+        const double pointMassAcceleration = gravitationalParameter / position.squaredNorm( );
+        BOOST_CHECK_SMALL( ( fullGravity->getAcceleration( ) - truncatedGravity->getAcceleration( ) ).norm( ) /
+                           pointMassAcceleration, truncationTolerance );
+        if( radiusRatio < 1.05 )
+        {
+            BOOST_CHECK_EQUAL( truncationDegree, maximumDegree );
+        }
+        else if( radiusRatio > 5.0 )
+        {
+            BOOST_CHECK( truncationDegree < maximumDegree / 4 );
+        }
+    }
+
+    // Check truncation degree in limiting cases
+    Eigen::VectorXd degreeContributions;
+    const Eigen::VectorXd degreeAmplitudes = computeDegreeAmplitudeSpectrum( cosineCoefficients, sineCoefficients );
+    BOOST_CHECK_EQUAL( computeAdaptiveTruncationDegree( degreeAmplitudes, 1.0, 0.0, degreeContributions ), maximumDegree );
+    BOOST_CHECK_EQUAL( computeAdaptiveTruncationDegree( degreeAmplitudes, 1.0E-3, 1.0, degreeContributions ), 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,178 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityModel.h"
+#include "tudat/astro/gravitation/vectorizedSphericalHarmonicsGravity.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::gravitation;
+
+//! Function to generate a random, geodesy-normalized, spherical harmonic gravity field with a Kaula-type power spectrum
+void getRandomSphericalHarmonicCoefficients(
+        const int maximumDegree, Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
+{
+    std::srand( 42 );
+    cosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        double degreeScaling = 1.0E-5 / std::max( 1.0, static_cast< double >( degree * degree ) );
+        for( int order = 0; order <= maximumDegree; order++ )
+        {
+            if( order > degree )
+            {
+                cosineCoefficients( degree, order ) = 0.0;
+                sineCoefficients( degree, order ) = 0.0;
+            }
+            else
+            {
+                cosineCoefficients( degree, order ) *= degreeScaling;
+                sineCoefficients( degree, order ) *= degreeScaling;
+            }
+        }
+        sineCoefficients( degree, 0 ) = 0.0;
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 1, 0 ) = 0.0;
+    cosineCoefficients( 1, 1 ) = 0.0;
+    sineCoefficients( 1, 1 ) = 0.0;
+}
+
+BOOST_AUTO_TEST_SUITE( test_vectorized_spherical_harmonics_gravity )
+
+//! Compare column-wise evaluation to term-wise evaluation of spherical harmonic acceleration
+BOOST_AUTO_TEST_CASE( testColumnWiseSphericalHarmonicAcceleration )
+{
+    const double gravitationalParameter = 4.9028E12;
+    const double referenceRadius = 1.738E6;
+
+    const Eigen::Matrix3d rotation = Eigen::Matrix3d(
+                Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) *
+                Eigen::AngleAxisd( -0.1, Eigen::Vector3d::UnitX( ) ) );
+
+    std::vector< Eigen::Vector3d > testPositions;
+    testPositions.push_back( ( Eigen::Vector3d( ) << 1.9E6, -0.7E6, 1.1E6 ).finished( ) );
+    testPositions.push_back( ( Eigen::Vector3d( ) << -1.2E6, -1.3E6, -0.4E6 ).finished( ) );
+    testPositions.push_back( ( Eigen::Vector3d( ) << 0.3E6, 0.1E6, 2.1E6 ).finished( ) );
+    testPositions.push_back( ( Eigen::Vector3d( ) << 8.0E6, 2.0E6, -3.0E6 ).finished( ) );
+
+    for( int maximumDegree : { 2, 20, 100, 360 } )
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+        ColumnWiseSphericalHarmonicsCache columnWiseCache( maximumDegree, maximumDegree );
+        std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+
+        for( unsigned int i = 0; i < testPositions.size( ); i++ )
+        {
+            // Test full field, and truncated field with order lower than degree
+            for( int test = 0; test < 2; test++ )
+            {
+                int numberOfOrders = ( test == 0 ) ? maximumDegree + 1 : ( maximumDegree / 2 + 1 );
+                Eigen::MatrixXd currentCosineCoefficients = cosineCoefficients.block(
+                            0, 0, maximumDegree + 1, numberOfOrders );
+                Eigen::MatrixXd currentSineCoefficients = sineCoefficients.block(
+                            0, 0, maximumDegree + 1, numberOfOrders );
+
+                Eigen::Vector3d termWiseAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                            testPositions.at( i ), gravitationalParameter, referenceRadius,
+                            currentCosineCoefficients, currentSineCoefficients, sphericalHarmonicsCache,
+                            dummyMap, false, rotation );
+                Eigen::Vector3d columnWiseAcceleration = computeGeodesyNormalizedGravitationalAccelerationSumColumnWise(
+                            testPositions.at( i ), gravitationalParameter, referenceRadius,
+                            currentCosineCoefficients, currentSineCoefficients, columnWiseCache, rotation );
+
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( termWiseAcceleration, columnWiseAcceleration, 1.0E-12 );
+            }
+        }
+    }
+
+    // Check that insufficient cache size is detected
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomSphericalHarmonicCoefficients( 10, cosineCoefficients, sineCoefficients );
+        ColumnWiseSphericalHarmonicsCache columnWiseCache( 5, 5 );
+        BOOST_CHECK_THROW( computeGeodesyNormalizedGravitationalAccelerationSumColumnWise(
+                               testPositions.at( 0 ), gravitationalParameter, referenceRadius,
+                               cosineCoefficients, sineCoefficients, columnWiseCache ), std::runtime_error );
+    }
+}
+
+//! Test selection of evaluation algorithm in acceleration model
+BOOST_AUTO_TEST_CASE( testSphericalHarmonicModelEvaluationAlgorithm )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+    const int maximumDegree = 50;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+
+    Eigen::Vector3d position = ( Eigen::Vector3d( ) << 7.0E6, 8.0E6, 9.0E6 ).finished( );
+    Eigen::Quaterniond rotation = Eigen::Quaterniond(
+                Eigen::AngleAxisd( 1.3, Eigen::Vector3d::UnitZ( ) ) );
+
+    std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > > accelerationModels;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        accelerationModels.push_back(
+                    std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                        [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients,
+                        [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                        [ & ]( ){ return rotation; } ) );
+    }
+    accelerationModels.at( 1 )->setEvaluationAlgorithm( column_wise_spherical_harmonics_evaluation );
+    BOOST_CHECK_EQUAL( accelerationModels.at( 0 )->getEvaluationAlgorithm( ), term_wise_spherical_harmonics_evaluation );
+    BOOST_CHECK_EQUAL( accelerationModels.at( 1 )->getEvaluationAlgorithm( ), column_wise_spherical_harmonics_evaluation );
+
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        accelerationModels.at( i )->updateMembers( 0.0 );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accelerationModels.at( 0 )->getAcceleration( ),
+                                       accelerationModels.at( 1 )->getAcceleration( ), 1.0E-13 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accelerationModels.at( 0 )->getAccelerationInBodyFixedFrame( ),
+                                       accelerationModels.at( 1 )->getAccelerationInBodyFixedFrame( ), 1.0E-13 );
+
+    // Check alternative coefficients interface
+    Eigen::MatrixXd alternativeCosineCoefficients = cosineCoefficients.block( 0, 0, 21, 21 );
+    Eigen::MatrixXd alternativeSineCoefficients = sineCoefficients.block( 0, 0, 21, 21 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                accelerationModels.at( 0 )->getAccelerationWithAlternativeCoefficients(
+                    alternativeCosineCoefficients, alternativeSineCoefficients ),
+                accelerationModels.at( 1 )->getAccelerationWithAlternativeCoefficients(
+                    alternativeCosineCoefficients, alternativeSineCoefficients ), 1.0E-13 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,357 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/simulation/estimation_setup/columnarObservations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+
+BOOST_AUTO_TEST_SUITE( test_columnar_observations )
+
+//! Function to create an observation collection with several observable types, link ends, and (optional) dependent
+//! variables and ancillary settings
+template< typename TimeType >
+std::shared_ptr< ObservationCollection< double, TimeType > > createTestObservationCollection(
+        std::shared_ptr< ObservationAncilliarySimulationSettings >& ancillarySettings )
+{
+    LinkEnds firstLinkEnds;
+    firstLinkEnds[ transmitter ] = LinkEndId( "Earth", "Station1" );
+    firstLinkEnds[ receiver ] = LinkEndId( "Spacecraft", "" );
+
+    LinkEnds secondLinkEnds;
+    secondLinkEnds[ transmitter ] = LinkEndId( "Earth", "Station2" );
+    secondLinkEnds[ receiver ] = LinkEndId( "Spacecraft", "" );
+
+    ancillarySettings = std::make_shared< ObservationAncilliarySimulationSettings >( );
+    ancillarySettings->setAncilliaryDoubleData( doppler_integration_time, 60.0 );
+    ancillarySettings->setAncilliaryDoubleVectorData( link_ends_delays, std::vector< double >{ 1.0E-3, 2.0E-3 } );
+
+    std::vector< std::shared_ptr< SingleObservationSet< double, TimeType > > > observationSets;
+    for( unsigned int set = 0; set < 4; set++ )
+    {
+        ObservableType observableType = ( set < 3 ) ? one_way_range : angular_position;
+        LinkEnds linkEnds = ( set == 1 ) ? secondLinkEnds : firstLinkEnds;
+        int observableSize = getObservableSize( observableType );
+
+        std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > > observations;
+        std::vector< TimeType > times;
+        std::vector< Eigen::VectorXd > dependentVariables;
+        for( unsigned int i = 0; i < 5 + set; i++ )
+        {
+            observations.push_back( Eigen::VectorXd::Constant( observableSize, 1.0E3 * set + i ) +
+                                    Eigen::VectorXd::LinSpaced( observableSize, 0.0, 0.5 ) );
+            times.push_back( TimeType( 1.0E4 * set + 60.0 * i + 0.125 ) );
+            if( set == 2 )
+            {
+                dependentVariables.push_back( Eigen::Vector3d( i, 2.0 * i, 3.0 * i ) );
+            }
+        }
+        observationSets.push_back( std::make_shared< SingleObservationSet< double, TimeType > >(
+                                       observableType, linkEnds, observations, times, receiver, dependentVariables,
+                                       nullptr, ( set == 0 || set == 2 ) ? ancillarySettings : nullptr ) );
+    }
+    return std::make_shared< ObservationCollection< double, TimeType > >( observationSets );
+}
+
+//! Function to check that a columnar collection contains the same data as an observation collection
+template< typename TimeType >
+void checkColumnarObservationCollection(
+        const std::shared_ptr< ObservationCollection< double, TimeType > > observationCollection,
+        const std::shared_ptr< ColumnarObservationCollection< double, TimeType > > columnarCollection,
+        const Eigen::VectorXd& expectedWeights )
+{
+    // Check full columns
+    BOOST_CHECK_EQUAL( columnarCollection->getNumberOfSets( ), 4 );
+    BOOST_CHECK_EQUAL( columnarCollection->getNumberOfObservations( ), 26 );
+    BOOST_CHECK_EQUAL( columnarCollection->getNumberOfValues( ), observationCollection->getTotalObservableSize( ) );
+    BOOST_CHECK_EQUAL( ( columnarCollection->getObservationVector( ) -
+                         observationCollection->getObservationVectorReference( ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( columnarCollection->getWeightsVector( ) - expectedWeights ).norm( ), 0.0 );
+
+    // Check slices per observable type and link ends
+    for( auto observableIterator : observationCollection->getObservationsReference( ) )
+    {
+        for( auto linkEndIterator : observableIterator.second )
+        {
+            ColumnarObservationSlice< double, TimeType > slice = columnarCollection->getObservableSlice(
+                        observableIterator.first, linkEndIterator.first );
+            std::pair< Eigen::VectorXd, std::vector< TimeType > > expectedObservationsAndTimes =
+                    observationCollection->getSingleLinkObservationsAndTimes(
+                        observableIterator.first, linkEndIterator.first );
+            BOOST_CHECK_EQUAL( ( slice.getObservationVector( ) - expectedObservationsAndTimes.first ).norm( ), 0.0 );
+
+            int observableSize = getObservableSize( observableIterator.first );
+            BOOST_CHECK_EQUAL( slice.getNumberOfObservations( ) * observableSize, slice.getNumberOfValues( ) );
+            for( int64_t i = 0; i < slice.getNumberOfObservations( ); i++ )
+            {
+                BOOST_CHECK_EQUAL( slice.getTime( i ) == expectedObservationsAndTimes.second.at( i * observableSize ), true );
+                BOOST_CHECK_EQUAL( columnarCollection->getLinkEndsList( ).at( slice.getLinkEndIds( )( i ) ) ==
+                                   linkEndIterator.first, true );
+            }
+        }
+    }
+
+    // Check that slice of single observable type spans all its link ends
+    BOOST_CHECK_EQUAL( columnarCollection->getObservableSlice( one_way_range ).getNumberOfObservations( ), 18 );
+    BOOST_CHECK_EQUAL( columnarCollection->getObservableSlice( angular_position ).getNumberOfValues( ), 16 );
+
+    // Check dependent variables and ancillary settings of each set
+    BOOST_CHECK_EQUAL( columnarCollection->getAncillarySettingsList( ).size( ), 1 );
+    for( int64_t i = 0; i < columnarCollection->getNumberOfSets( ); i++ )
+    {
+        const ColumnarObservationSetEntry& setEntry = columnarCollection->getSetEntry( i );
+        if( setEntry.dependentVariableSize_ > 0 )
+        {
+            BOOST_CHECK_EQUAL( setEntry.dependentVariableSize_, 3 );
+            Eigen::MatrixXd dependentVariables = columnarCollection->getDependentVariables( i );
+            for( int j = 0; j < dependentVariables.rows( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( dependentVariables( j, 2 ), 3.0 * j );
+            }
+        }
+        if( setEntry.ancillarySettingsId_ >= 0 )
+        {
+            std::shared_ptr< ObservationAncilliarySimulationSettings > ancillarySettings =
+                    columnarCollection->getAncillarySettingsList( ).at( setEntry.ancillarySettingsId_ );
+            BOOST_CHECK_EQUAL( ancillarySettings->getAncilliaryDoubleData( doppler_integration_time ), 60.0 );
+            BOOST_CHECK_EQUAL( ancillarySettings->getAncilliaryDoubleVectorData( link_ends_delays ).at( 1 ), 2.0E-3 );
+        }
+    }
+
+    // Check conversion back to observation collection
+    std::shared_ptr< ObservationCollection< double, TimeType > > recreatedCollection =
+            columnarCollection->createObservationCollection( );
+    BOOST_CHECK_EQUAL( ( recreatedCollection->getObservationVectorReference( ) -
+                         observationCollection->getObservationVectorReference( ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( recreatedCollection->getConcatenatedTimeVector( ) == observationCollection->getConcatenatedTimeVector( ),
+                       true );
+    BOOST_CHECK_EQUAL( recreatedCollection->getConcatenatedLinkEndIds( ) == observationCollection->getConcatenatedLinkEndIds( ),
+                       true );
+    BOOST_CHECK_EQUAL( recreatedCollection->getConcatenatedLinkEndIdNames( ) ==
+                       observationCollection->getConcatenatedLinkEndIdNames( ), true );
+}
+
+template< typename TimeType >
+void testColumnarObservationCollection( const std::string& fileName )
+{
+    std::shared_ptr< ObservationAncilliarySimulationSettings > ancillarySettings;
+    std::shared_ptr< ObservationCollection< double, TimeType > > observationCollection =
+            createTestObservationCollection< TimeType >( ancillarySettings );
+
+    // Check columnar collection created in memory
+    Eigen::VectorXd weights = Eigen::VectorXd::LinSpaced( observationCollection->getTotalObservableSize( ), 1.0, 2.0 );
+    std::shared_ptr< ColumnarObservationCollection< double, TimeType > > columnarCollection =
+            std::make_shared< ColumnarObservationCollection< double, TimeType > >( observationCollection, weights );
+    BOOST_CHECK_EQUAL( columnarCollection->isMemoryMapped( ), false );
+    checkColumnarObservationCollection( observationCollection, columnarCollection, weights );
+
+    // Check columnar collection loaded from (memory-mapped) file
+    columnarCollection->writeToFile( fileName );
+    std::shared_ptr< ColumnarObservationCollection< double, TimeType > > loadedCollection =
+            loadColumnarObservationCollection< double, TimeType >( fileName );
+    BOOST_CHECK_EQUAL( loadedCollection->isMemoryMapped( ), true );
+    checkColumnarObservationCollection( observationCollection, loadedCollection, weights );
+
+    // Check that views of file contents are not copied
+    BOOST_CHECK_EQUAL( loadedCollection->getObservableSlice( one_way_range ).getObservationVector( ).data( ),
+                       loadedCollection->getObservationVector( ).data( ) );
+
+    // Check that default weights are equal to one
+    writeObservationCollectionToFile( observationCollection, fileName );
+    Eigen::VectorXd loadedWeights = loadColumnarObservationCollection< double, TimeType >( fileName )->getWeightsVector( );
+    BOOST_CHECK_EQUAL( loadedWeights.minCoeff( ), 1.0 );
+    BOOST_CHECK_EQUAL( loadedWeights.maxCoeff( ), 1.0 );
+
+    std::remove( fileName.c_str( ) );
+}
+
+//! Test storage of observations in columnar layout, and writing/loading it to/from a (memory-mapped) binary file
+BOOST_AUTO_TEST_CASE( testColumnarObservationStorage )
+{
+    testColumnarObservationCollection< double >( "columnarObservationsTestDouble.dat" );
+    testColumnarObservationCollection< Time >( "columnarObservationsTestTime.dat" );
+}
+
+//! Test that invalid binary files are rejected
+BOOST_AUTO_TEST_CASE( testColumnarObservationFileChecks )
+{
+    std::shared_ptr< ObservationAncilliarySimulationSettings > ancillarySettings;
+    std::string fileName = "columnarObservationsTestChecks.dat";
+    writeObservationCollectionToFile( createTestObservationCollection< double >( ancillarySettings ), fileName );
+
+    // Check that file cannot be loaded with incompatible time type
+    bool exceptionIsCaught = false;
+    try
+    {
+        loadColumnarObservationCollection< double, Time >( fileName );
+    }
+    catch( const std::runtime_error& )
+    {
+        exceptionIsCaught = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionIsCaught, true );
+
+    // Read original file
+    std::string fileContents;
+    {
+        std::ifstream inputStream( fileName, std::ios::binary );
+        fileContents.assign( ( std::istreambuf_iterator< char >( inputStream ) ), std::istreambuf_iterator< char >( ) );
+    }
+    ColumnarObservationFileHeader header;
+    std::memcpy( &header, fileContents.data( ), sizeof( ColumnarObservationFileHeader ) );
+    BOOST_CHECK_EQUAL( header.numberOfSets_, 4 );
+
+    // Check that files with corrupted entries in the table of observation sets are rejected
+    for( unsigned int corruptionCase = 0; corruptionCase < 9; corruptionCase++ )
+    {
+        for( unsigned int setIndex = 0; setIndex < header.numberOfSets_; setIndex++ )
+        {
+            std::string corruptedFileContents = fileContents;
+            ColumnarObservationSetEntry setEntry;
+            char* setEntryData = &corruptedFileContents[ 0 ] + header.setTableOffset_ +
+                    setIndex * sizeof( ColumnarObservationSetEntry );
+            std::memcpy( &setEntry, setEntryData, sizeof( ColumnarObservationSetEntry ) );
+            switch( corruptionCase )
+            {
+            case 0:
+                setEntry.firstValue_ += 1;
+                break;
+            case 1:
+                setEntry.firstObservation_ -= 1;
+                break;
+            case 2:
+                setEntry.firstDependentVariableValue_ += 1000000;
+                break;
+            case 3:
+                setEntry.numberOfObservations_ += 1;
+                break;
+            case 4:
+                setEntry.numberOfObservations_ = std::numeric_limits< int64_t >::max( ) / 2;
+                break;
+            case 5:
+                setEntry.observableType_ = 1000;
+                break;
+            case 6:
+                setEntry.observableSize_ += 1;
+                break;
+            case 7:
+                setEntry.dependentVariableSize_ = -1;
+                break;
+            case 8:
+                setEntry.referenceLinkEnd_ = 1000;
+                break;
+            }
+            std::memcpy( setEntryData, &setEntry, sizeof( ColumnarObservationSetEntry ) );
+            {
+                std::ofstream outputStream( fileName, std::ios::binary | std::ios::trunc );
+                outputStream.write( corruptedFileContents.data( ), corruptedFileContents.size( ) );
+            }
+
+            exceptionIsCaught = false;
+            try
+            {
+                loadColumnarObservationCollection< double, double >( fileName );
+            }
+            catch( const std::runtime_error& )
+            {
+                exceptionIsCaught = true;
+            }
+            BOOST_CHECK_EQUAL( exceptionIsCaught, true );
+        }
+    }
+
+    // Check that files with misaligned or out-of-range data columns in the header are rejected
+    for( unsigned int corruptionCase = 0; corruptionCase < 4; corruptionCase++ )
+    {
+        ColumnarObservationFileHeader corruptedHeader = header;
+        switch( corruptionCase )
+        {
+        case 0:
+            corruptedHeader.valuesOffset_ += 1;
+            break;
+        case 1:
+            corruptedHeader.linkEndIdsOffset_ += 2;
+            break;
+        case 2:
+            corruptedHeader.timesOffset_ = fileContents.size( );
+            break;
+        case 3:
+            corruptedHeader.weightsOffset_ = fileContents.size( ) - sizeof( double );
+            break;
+        }
+        std::string corruptedFileContents = fileContents;
+        std::memcpy( &corruptedFileContents[ 0 ], &corruptedHeader, sizeof( ColumnarObservationFileHeader ) );
+        {
+            std::ofstream outputStream( fileName, std::ios::binary | std::ios::trunc );
+            outputStream.write( corruptedFileContents.data( ), corruptedFileContents.size( ) );
+        }
+
+        exceptionIsCaught = false;
+        try
+        {
+            loadColumnarObservationCollection< double, double >( fileName );
+        }
+        catch( const std::runtime_error& )
+        {
+            exceptionIsCaught = true;
+        }
+        BOOST_CHECK_EQUAL( exceptionIsCaught, true );
+    }
+
+    // Check that restored file is accepted
+    {
+        std::ofstream outputStream( fileName, std::ios::binary | std::ios::trunc );
+        outputStream.write( fileContents.data( ), fileContents.size( ) );
+    }
+    std::shared_ptr< ColumnarObservationCollection< double, double > > restoredCollection =
+            loadColumnarObservationCollection< double, double >( fileName );
+    BOOST_CHECK_EQUAL( restoredCollection->getNumberOfSets( ), 4 );
+
+    // Check that truncated file is rejected
+    {
+        std::ofstream outputStream( fileName, std::ios::binary | std::ios::trunc );
+        outputStream.write( fileContents.data( ), fileContents.size( ) / 2 );
+    }
+    exceptionIsCaught = false;
+    try
+    {
+        loadColumnarObservationCollection< double, double >( fileName );
+    }
+    catch( const std::runtime_error& )
+    {
+        exceptionIsCaught = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionIsCaught, true );
+
+    std::remove( fileName.c_str( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
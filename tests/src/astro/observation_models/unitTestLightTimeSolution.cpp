@@ -233,6 +233,138 @@ BOOST_AUTO_TEST_CASE( testLightWithSpice )
                                 1E-14 );
 }
 
+//! Test light-time calculation for list of times, using preceding solutions as initial guess
+BOOST_AUTO_TEST_CASE( testBatchLightTimeSolution )
+{
+    // Define (analytical) circular motion of transmitter and receiver
+    auto getCircularState = [ ]( const double time, const double radius, const double meanMotion, const double phase )
+    {
+        Eigen::Vector6d state;
+        state << radius * std::cos( meanMotion * time + phase ), radius * std::sin( meanMotion * time + phase ), 0.0,
+                -radius * meanMotion * std::sin( meanMotion * time + phase ),
+                radius * meanMotion * std::cos( meanMotion * time + phase ), 0.0;
+        return state;
+    };
+    std::function< Eigen::Vector6d( const double ) > transmitterStateFunction =
+            std::bind( getCircularState, std::placeholders::_1, 7.0E6, 2.0 * mathematical_constants::PI / 5400.0, 0.0 );
+    std::function< Eigen::Vector6d( const double ) > receiverStateFunction =
+            std::bind( getCircularState, std::placeholders::_1, 3.8E8, 2.0 * mathematical_constants::PI / 2.36E6, 1.0 );
+
+    // Define light-time correction (with realistic sensitivity to link end times)
+    std::vector< LightTimeCorrectionFunctionSingleLeg > lightTimeCorrections;
+    lightTimeCorrections.push_back( &getPositionDifferenceLightTimeCorrection );
+
+    // Define times: two passes at 1 s cadence, with a duplicate time
+    std::vector< double > times;
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        times.push_back( 1.0E6 + static_cast< double >( i ) );
+    }
+    times.push_back( times.back( ) );
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        times.push_back( 1.1E6 + static_cast< double >( i ) );
+    }
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        bool isTimeAtReception = ( testCase == 0 );
+
+        std::shared_ptr< LightTimeCalculator< > > lightTimeCalculator = std::make_shared< LightTimeCalculator< > >(
+                    transmitterStateFunction, receiverStateFunction, lightTimeCorrections,
+                    std::make_shared< LightTimeConvergenceCriteria >( true ) );
+
+        // Compute light times for all times at once
+        std::vector< Eigen::Vector6d > batchReceiverStates, batchTransmitterStates;
+        std::vector< double > batchLightTimes = lightTimeCalculator->calculateLightTimesWithLinkEndsStates(
+                    batchReceiverStates, batchTransmitterStates, times, isTimeAtReception );
+        unsigned int numberOfBatchIterations = lightTimeCalculator->getNumberOfBatchIterations( );
+
+        // Create calculator with stricter tolerance, to compute reference light times one by one
+        std::shared_ptr< LightTimeCalculator< > > referenceLightTimeCalculator = std::make_shared< LightTimeCalculator< > >(
+                    transmitterStateFunction, receiverStateFunction, lightTimeCorrections,
+                    std::make_shared< LightTimeConvergenceCriteria >( true, 50, 1.0E-15 ) );
+
+        // Compare against light times computed one by one (within default tolerance of 1.0E-12)
+        BOOST_CHECK_EQUAL( batchLightTimes.size( ), times.size( ) );
+        unsigned int numberOfSingleIterations = 0;
+        Eigen::Vector6d receiverState, transmitterState;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            lightTimeCalculator->calculateLightTimeWithLinkEndsStates(
+                        receiverState, transmitterState, times.at( i ), isTimeAtReception );
+            numberOfSingleIterations += lightTimeCalculator->getNumberOfIterations( );
+
+            double referenceLightTime = referenceLightTimeCalculator->calculateLightTimeWithLinkEndsStates(
+                        receiverState, transmitterState, times.at( i ), isTimeAtReception );
+            BOOST_CHECK_CLOSE_FRACTION( referenceLightTime, batchLightTimes.at( i ), 5.0E-12 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( receiverState, batchReceiverStates.at( i ), 1.0E-12 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( transmitterState, batchTransmitterStates.at( i ), 1.0E-12 );
+        }
+
+        // Check that initial guess from preceding solutions reduces number of iterations (to about one per epoch)
+        BOOST_CHECK( numberOfBatchIterations < numberOfSingleIterations );
+        BOOST_CHECK( numberOfBatchIterations < times.size( ) + 10 );
+
+        // Recompute light times, with states at fixed link end provided as input, and check that these states are
+        // not recomputed, and that results are identical
+        unsigned int numberOfFixedLinkEndEvaluations = 0;
+        std::function< Eigen::Vector6d( const double ) > countedTransmitterStateFunction = transmitterStateFunction;
+        std::function< Eigen::Vector6d( const double ) > countedReceiverStateFunction = receiverStateFunction;
+        if( isTimeAtReception )
+        {
+            countedReceiverStateFunction = [ & ]( const double time )
+            {
+                numberOfFixedLinkEndEvaluations++;
+                return receiverStateFunction( time );
+            };
+        }
+        else
+        {
+            countedTransmitterStateFunction = [ & ]( const double time )
+            {
+                numberOfFixedLinkEndEvaluations++;
+                return transmitterStateFunction( time );
+            };
+        }
+        std::shared_ptr< LightTimeCalculator< > > countingLightTimeCalculator = std::make_shared< LightTimeCalculator< > >(
+                    countedTransmitterStateFunction, countedReceiverStateFunction, lightTimeCorrections,
+                    std::make_shared< LightTimeConvergenceCriteria >( true ) );
+
+        std::vector< Eigen::Vector6d > reusedReceiverStates, reusedTransmitterStates;
+        std::vector< double > reusedLightTimes = countingLightTimeCalculator->calculateLightTimesWithLinkEndsStates(
+                    reusedReceiverStates, reusedTransmitterStates, times, isTimeAtReception, nullptr,
+                    isTimeAtReception ? batchReceiverStates : batchTransmitterStates );
+
+        BOOST_CHECK_EQUAL( numberOfFixedLinkEndEvaluations, 0 );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( reusedLightTimes.at( i ), batchLightTimes.at( i ) );
+            for( unsigned int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_EQUAL( reusedReceiverStates.at( i )( j ), batchReceiverStates.at( i )( j ) );
+                BOOST_CHECK_EQUAL( reusedTransmitterStates.at( i )( j ), batchTransmitterStates.at( i )( j ) );
+            }
+        }
+    }
+
+    // Check that unsorted times are rejected
+    std::shared_ptr< LightTimeCalculator< > > lightTimeCalculator = std::make_shared< LightTimeCalculator< > >(
+                transmitterStateFunction, receiverStateFunction );
+    std::vector< Eigen::Vector6d > receiverStates, transmitterStates;
+    bool exceptionIsCaught = false;
+    try
+    {
+        lightTimeCalculator->calculateLightTimesWithLinkEndsStates(
+                    receiverStates, transmitterStates, { 1.0E6, 1.0E6 + 2.0, 1.0E6 + 1.0 } );
+    }
+    catch( const std::runtime_error& )
+    {
+        exceptionIsCaught = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionIsCaught, true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -252,6 +252,90 @@ BOOST_AUTO_TEST_CASE( testOneWayRangeModel )
 
 }
 
+//! Test that computing a list of one-way range observables at once reproduces the one-by-one computation
+BOOST_AUTO_TEST_CASE( testOneWayRangeModelObservationSet )
+{
+    // Define (analytical) circular motion of transmitter and receiver
+    auto getCircularState = [ ]( const double time, const double radius, const double meanMotion, const double phase )
+    {
+        Eigen::Vector6d state;
+        state << radius * std::cos( meanMotion * time + phase ), radius * std::sin( meanMotion * time + phase ), 0.0,
+                -radius * meanMotion * std::sin( meanMotion * time + phase ),
+                radius * meanMotion * std::cos( meanMotion * time + phase ), 0.0;
+        return state;
+    };
+    std::function< Eigen::Vector6d( const double ) > transmitterStateFunction =
+            std::bind( getCircularState, std::placeholders::_1, 7.0E6, 2.0 * mathematical_constants::PI / 5400.0, 0.0 );
+    std::function< Eigen::Vector6d( const double ) > receiverStateFunction =
+            std::bind( getCircularState, std::placeholders::_1, 3.8E8, 2.0 * mathematical_constants::PI / 2.36E6, 1.0 );
+
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = LinkEndId( "Vehicle", "" );
+    linkEnds[ receiver ] = LinkEndId( "Moon", "" );
+
+    // Define times at 10 s cadence, with a duplicate time and a gap
+    std::vector< double > observationTimes;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        observationTimes.push_back( 1.0E6 + 10.0 * static_cast< double >( i ) );
+    }
+    observationTimes.push_back( observationTimes.back( ) );
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        observationTimes.push_back( 1.1E6 + 10.0 * static_cast< double >( i ) );
+    }
+    std::vector< double > unsortedObservationTimes = observationTimes;
+    std::swap( unsortedObservationTimes.at( 10 ), unsortedObservationTimes.at( 150 ) );
+
+    for( unsigned int testCase = 0; testCase < 4; testCase++ )
+    {
+        // Create observation model, with observation bias for test cases 2 and 3
+        std::shared_ptr< ObservationBias< 1 > > observationBias;
+        if( testCase > 1 )
+        {
+            observationBias = std::make_shared< ConstantObservationBias< 1 > >( ( Eigen::Vector1d( ) << 10.0 ).finished( ) );
+        }
+        std::shared_ptr< OneWayRangeObservationModel< > > observationModel = std::make_shared< OneWayRangeObservationModel< > >(
+                    linkEnds, std::make_shared< LightTimeCalculator< > >(
+                        transmitterStateFunction, receiverStateFunction,
+                        std::vector< std::shared_ptr< LightTimeCorrection > >( ),
+                        std::make_shared< LightTimeConvergenceCriteria >( false, 50, 1.0E-15 ) ),
+                    observationBias );
+        LinkEndType referenceLinkEnd = ( testCase % 2 == 0 ) ? receiver : transmitter;
+
+        // Compute observations (for sorted and unsorted times) at once
+        for( unsigned int timesCase = 0; timesCase < 2; timesCase++ )
+        {
+            const std::vector< double >& currentTimes = ( timesCase == 0 ) ? observationTimes : unsortedObservationTimes;
+
+            std::vector< Eigen::Matrix< double, 1, 1 > > observations;
+            std::vector< std::vector< double > > linkEndTimes;
+            std::vector< std::vector< Eigen::Vector6d > > linkEndStates;
+            observationModel->computeObservationSetWithLinkEndData(
+                        currentTimes, referenceLinkEnd, observations, linkEndTimes, linkEndStates );
+
+            // Compare against observations computed one by one
+            BOOST_CHECK_EQUAL( observations.size( ), currentTimes.size( ) );
+            std::vector< double > singleLinkEndTimes;
+            std::vector< Eigen::Vector6d > singleLinkEndStates;
+            for( unsigned int i = 0; i < currentTimes.size( ); i++ )
+            {
+                Eigen::Matrix< double, 1, 1 > singleObservation = observationModel->computeObservationsWithLinkEndData(
+                            currentTimes.at( i ), referenceLinkEnd, singleLinkEndTimes, singleLinkEndStates );
+                BOOST_CHECK_CLOSE_FRACTION( singleObservation( 0 ), observations.at( i )( 0 ), 1.0E-14 );
+
+                BOOST_CHECK_EQUAL( linkEndTimes.at( i ).size( ), 2 );
+                BOOST_CHECK_EQUAL( linkEndStates.at( i ).size( ), 2 );
+                for( unsigned int j = 0; j < 2; j++ )
+                {
+                    BOOST_CHECK_SMALL( singleLinkEndTimes.at( j ) - linkEndTimes.at( i ).at( j ), 1.0E-9 );
+                    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( singleLinkEndStates.at( j ), linkEndStates.at( i ).at( j ), 1.0E-12 );
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
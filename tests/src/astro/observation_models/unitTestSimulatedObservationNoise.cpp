@@ -398,6 +398,133 @@ BOOST_AUTO_TEST_CASE( testObservationNoiseModels )
         }
 }
 
+//! Test whether parallel simulation of noisy observations reproduces serial simulation
+BOOST_AUTO_TEST_CASE( testParallelObservationSimulation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Specify initial time
+    double initialEphemerisTime = double( 1.0E7 );
+    double finalEphemerisTime = double( 1.0E7 + 3.0 * physical_constants::JULIAN_DAY );
+
+    // Define function to create bodies (called once for each additional thread)
+    std::vector< std::string > groundStationNames = { "Station1", "Station2", "Station3" };
+    std::function< SystemOfBodies( ) > createBodies = [ & ]( )
+    {
+        BodyListSettings bodySettings =
+                getDefaultBodySettings( { "Earth", "Moon" }, initialEphemerisTime - 3600.0, finalEphemerisTime + 3600.0 );
+        bodySettings.at( "Earth" )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                    "ECLIPJ2000", "IAU_Earth",
+                    spice_interface::computeRotationQuaternionBetweenFrames(
+                        "ECLIPJ2000", "IAU_Earth", initialEphemerisTime ),
+                    initialEphemerisTime, 2.0 * mathematical_constants::PI /
+                    ( physical_constants::JULIAN_DAY ) );
+        SystemOfBodies createdBodies = createSystemOfBodies( bodySettings );
+
+        createGroundStation( createdBodies.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ), geodetic_position );
+        createGroundStation( createdBodies.at( "Earth" ), "Station2", ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ), geodetic_position );
+        createGroundStation( createdBodies.at( "Earth" ), "Station3", ( Eigen::Vector3d( ) << 0.0, 0.05, 4.0 ).finished( ), geodetic_position );
+        return createdBodies;
+    };
+    SystemOfBodies bodies = createBodies( );
+
+    // Define observation settings for range, Doppler and angular position, to and from each ground station
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    std::vector< LinkEnds > linkEndsList;
+    for( unsigned int i = 0; i < groundStationNames.size( ); i++ )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ transmitter ] = LinkEndId( "Earth", groundStationNames.at( i ) );
+        linkEnds[ receiver ] = LinkEndId( "Moon", "" );
+        linkEndsList.push_back( linkEnds );
+
+        linkEnds[ receiver ] = LinkEndId( "Earth", groundStationNames.at( i ) );
+        linkEnds[ transmitter ] = LinkEndId( "Moon", "" );
+        linkEndsList.push_back( linkEnds );
+    }
+    std::vector< ObservableType > observableTypes = { one_way_range, one_way_doppler, angular_position };
+    for( unsigned int i = 0; i < observableTypes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < linkEndsList.size( ); j++ )
+        {
+            observationSettingsList.push_back( std::make_shared< ObservationModelSettings >(
+                                                   observableTypes.at( i ), linkEndsList.at( j ) ) );
+        }
+    }
+    std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > >  observationSimulators =
+            createObservationSimulators( observationSettingsList, bodies );
+
+    // Define observation times
+    std::vector< double > baseTimeList;
+    for( unsigned int i = 0; i < 5000; i++ )
+    {
+        baseTimeList.push_back( initialEphemerisTime + 1000.0 + static_cast< double >( i ) * 50.0 );
+    }
+
+    // Define settings for simulation, with elevation angle viability and range dependent variable
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > measurementSimulationInput;
+    for( unsigned int i = 0; i < observationSettingsList.size( ); i++ )
+    {
+        measurementSimulationInput.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        observationSettingsList.at( i )->observableType_,
+                        observationSettingsList.at( i )->linkEnds_, baseTimeList, receiver ) );
+    }
+    addViabilityToObservationSimulationSettings(
+                measurementSimulationInput,
+                { elevationAngleViabilitySettings( std::make_pair( "Earth", "" ), 5.0 * mathematical_constants::PI / 180.0 ) } );
+    addDependentVariablesToObservationSimulationSettings(
+                measurementSimulationInput,
+                { std::make_shared< InterlinkObservationDependentVariableSettings >( target_range, receiver, transmitter ) },
+                bodies );
+
+    // Simulate observations serially and in parallel, using identical noise seeds for each link
+    int initialNoiseSeed = noiseSeed;
+    addGaussianNoiseFunctionToObservationSimulationSettings( measurementSimulationInput, 2.0 );
+    std::shared_ptr< ObservationCollection< > > serialObservations = simulateObservations< double, double >(
+                measurementSimulationInput, observationSimulators, bodies );
+
+    noiseSeed = initialNoiseSeed;
+    addGaussianNoiseFunctionToObservationSimulationSettings( measurementSimulationInput, 2.0 );
+    std::shared_ptr< ObservationCollection< > > parallelObservations = simulateObservationsInParallel< double, double >(
+                measurementSimulationInput, observationSimulators, bodies, observationSettingsList, createBodies, 3 );
+
+    // Check that observations, times and dependent variables are identical, and that some observations are rejected
+    BOOST_CHECK_EQUAL( serialObservations->getTotalObservableSize( ), parallelObservations->getTotalObservableSize( ) );
+    BOOST_CHECK( serialObservations->getTotalObservableSize( ) > 0 );
+    BOOST_CHECK( serialObservations->getTotalObservableSize( ) < static_cast< int >( 24 * baseTimeList.size( ) ) );
+    for( unsigned int i = 0; i < measurementSimulationInput.size( ); i++ )
+    {
+        ObservableType currentObservable = measurementSimulationInput.at( i )->getObservableType( );
+        LinkEnds currentLinkEnds = measurementSimulationInput.at( i )->getLinkEnds( ).linkEnds_;
+
+        std::shared_ptr< SingleObservationSet< double, double > > serialSet =
+                serialObservations->getObservations( ).at( currentObservable ).at( currentLinkEnds ).at( 0 );
+        std::shared_ptr< SingleObservationSet< double, double > > parallelSet =
+                parallelObservations->getObservations( ).at( currentObservable ).at( currentLinkEnds ).at( 0 );
+
+        BOOST_CHECK_EQUAL( serialSet->getNumberOfObservables( ), parallelSet->getNumberOfObservables( ) );
+        BOOST_CHECK_EQUAL( serialSet->getDependentVariableCalculator( ), parallelSet->getDependentVariableCalculator( ) );
+
+        std::vector< double > serialTimes = serialSet->getObservationTimes( );
+        std::vector< double > parallelTimes = parallelSet->getObservationTimes( );
+        std::vector< Eigen::VectorXd > serialValues = serialSet->getObservations( );
+        std::vector< Eigen::VectorXd > parallelValues = parallelSet->getObservations( );
+        std::vector< Eigen::VectorXd > serialDependentVariables = serialSet->getObservationsDependentVariables( );
+        std::vector< Eigen::VectorXd > parallelDependentVariables = parallelSet->getObservationsDependentVariables( );
+        for( unsigned int j = 0; j < serialTimes.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( serialTimes.at( j ), parallelTimes.at( j ) );
+            for( int k = 0; k < serialValues.at( j ).rows( ); k++ )
+            {
+                BOOST_CHECK_EQUAL( serialValues.at( j )( k ), parallelValues.at( j )( k ) );
+            }
+            BOOST_CHECK_EQUAL( serialDependentVariables.at( j )( 0 ), parallelDependentVariables.at( j )( 0 ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -401,6 +401,178 @@ BOOST_AUTO_TEST_CASE( testSphericalHarmonicPartials )
                 totalGradientCartesianPartial, numericalTotalSphericalGradient, 1.0E-6 );
 }
 
+//! Compare partials computed using Pines formulation to those computed using spherical formulation
+BOOST_AUTO_TEST_CASE( testPinesSphericalHarmonicPartials )
+{
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+    const int maximumDegree = 8;
+
+    std::srand( 42 );
+    Eigen::MatrixXd cosineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        sineCoefficients( degree, 0 ) = 0.0;
+        for( int order = degree + 1; order <= maximumDegree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 0.0;
+            sineCoefficients( degree, order ) = 0.0;
+        }
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+
+    const Eigen::Matrix3d bodyFixedToIntegrationFrame = Eigen::Matrix3d(
+                Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) * Eigen::AngleAxisd( -0.1, Eigen::Vector3d::UnitX( ) ) );
+
+    std::vector< std::pair< int, int > > blockIndices;
+    for( int degree = 2; degree <= maximumDegree + 2; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            blockIndices.push_back( std::make_pair( degree, order ) );
+        }
+    }
+
+    std::vector< Eigen::Vector3d > testPositions;
+    testPositions.push_back( Eigen::Vector3d( 7.0e6, 8.0e6, 9.0e6 ) );
+    testPositions.push_back( Eigen::Vector3d( -2.0e6, 6.0e6, -3.0e6 ) );
+
+    for( unsigned int i = 0; i < testPositions.size( ); i++ )
+    {
+        Eigen::Vector3d position = testPositions.at( i );
+        Eigen::Vector3d sphericalPosition = coordinate_conversions::convertCartesianToSpherical( position );
+        sphericalPosition( 1 ) = mathematical_constants::PI / 2.0 - sphericalPosition( 1 );
+
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache
+                = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 3, maximumDegree + 3 );
+        sphericalHarmonicsCache->getLegendreCache( )->setComputeSecondDerivatives( 1 );
+        sphericalHarmonicsCache->update(
+                    sphericalPosition( 0 ), std::sin( sphericalPosition( 1 ) ), sphericalPosition( 2 ), planetaryRadius );
+
+        gravitation::PinesSphericalHarmonicsCache pinesCache( maximumDegree, maximumDegree );
+        pinesCache.update( position, planetaryRadius );
+
+        // Compare partials w.r.t. position
+        Eigen::Matrix3d sphericalPositionPartial = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                    position, planetaryRadius, gravitationalParameter, cosineCoefficients, sineCoefficients,
+                    sphericalHarmonicsCache );
+        Eigen::Matrix3d pinesPositionPartial = computePartialDerivativeOfBodyFixedSphericalHarmonicAccelerationPines(
+                    gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients, pinesCache );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sphericalPositionPartial, pinesPositionPartial, 1.0E-12 );
+
+        // Compare partials w.r.t. coefficients (including coefficients beyond maximum degree of acceleration)
+        Eigen::MatrixXd sphericalCoefficientPartials = Eigen::MatrixXd::Zero( 3, blockIndices.size( ) );
+        Eigen::MatrixXd pinesCoefficientPartials;
+        for( int useSine = 0; useSine < 2; useSine++ )
+        {
+            if( useSine == 0 )
+            {
+                calculateSphericalHarmonicGravityWrtCCoefficients(
+                            sphericalPosition, planetaryRadius, gravitationalParameter, sphericalHarmonicsCache,
+                            blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix( position ),
+                            bodyFixedToIntegrationFrame, sphericalCoefficientPartials, maximumDegree, maximumDegree );
+            }
+            else
+            {
+                calculateSphericalHarmonicGravityWrtSCoefficients(
+                            sphericalPosition, planetaryRadius, gravitationalParameter, sphericalHarmonicsCache,
+                            blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix( position ),
+                            bodyFixedToIntegrationFrame, sphericalCoefficientPartials, maximumDegree, maximumDegree );
+            }
+            computeSphericalHarmonicGravityWrtCoefficientsPines(
+                        gravitationalParameter, planetaryRadius, pinesCache, blockIndices, useSine == 1,
+                        bodyFixedToIntegrationFrame, pinesCoefficientPartials, maximumDegree, maximumDegree );
+
+            for( unsigned int j = 0; j < blockIndices.size( ); j++ )
+            {
+                if( blockIndices.at( j ).first > maximumDegree || ( useSine == 1 && blockIndices.at( j ).second == 0 ) )
+                {
+                    BOOST_CHECK_SMALL( pinesCoefficientPartials.block( 0, j, 3, 1 ).norm( ), 1.0E-20 );
+                }
+                else
+                {
+                    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                                sphericalCoefficientPartials.block( 0, j, 3, 1 ),
+                                pinesCoefficientPartials.block( 0, j, 3, 1 ), 1.0E-12 );
+                }
+            }
+        }
+    }
+}
+
+//! Check that partial uses the current Pines cache of the acceleration model when the evaluation algorithm is changed
+BOOST_AUTO_TEST_CASE( testPinesSphericalHarmonicPartialWithAlgorithmSwitch )
+{
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+    const int maximumDegree = 8;
+
+    std::srand( 42 );
+    Eigen::MatrixXd cosineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( maximumDegree + 1, maximumDegree + 1 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        sineCoefficients( degree, 0 ) = 0.0;
+        for( int order = degree + 1; order <= maximumDegree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 0.0;
+            sineCoefficients( degree, order ) = 0.0;
+        }
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+
+    Eigen::Vector3d position = Eigen::Vector3d( 7.0e6, 8.0e6, 9.0e6 );
+    Eigen::Quaterniond rotation = Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) );
+
+    // Create term-wise reference model and partial, and model for which algorithm is switched after creating partial
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > referenceModel =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients,
+                [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                [ & ]( ){ return rotation; } );
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > switchedModel =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = position; }, gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients,
+                [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                [ & ]( ){ return rotation; } );
+    std::shared_ptr< SphericalHarmonicsGravityPartial > referencePartial =
+            std::make_shared< SphericalHarmonicsGravityPartial >( "Vehicle", "Earth", referenceModel );
+    std::shared_ptr< SphericalHarmonicsGravityPartial > switchedPartial =
+            std::make_shared< SphericalHarmonicsGravityPartial >( "Vehicle", "Earth", switchedModel );
+
+    // Switch from term-wise to Pines, to column-wise and back to Pines evaluation
+    std::vector< SphericalHarmonicsEvaluationAlgorithm > evaluationAlgorithms =
+    { pines_spherical_harmonics_evaluation, column_wise_spherical_harmonics_evaluation,
+      pines_spherical_harmonics_evaluation };
+    for( unsigned int i = 0; i < evaluationAlgorithms.size( ); i++ )
+    {
+        switchedModel->setEvaluationAlgorithm( evaluationAlgorithms.at( i ) );
+        BOOST_CHECK_EQUAL( ( switchedModel->getPinesCache( ) != nullptr ),
+                           ( evaluationAlgorithms.at( i ) == pines_spherical_harmonics_evaluation ) );
+
+        position += Eigen::Vector3d( 1.0E5, -2.0E5, 3.0E5 );
+        double currentTime = static_cast< double >( i );
+        referencePartial->update( currentTime );
+        switchedPartial->update( currentTime );
+
+        // Check that Pines cache of acceleration model is updated to current position
+        if( switchedModel->getPinesCache( ) != nullptr )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( switchedModel->getPinesCache( )->getCurrentRadius( ), position.norm( ),
+                                        std::numeric_limits< double >::epsilon( ) );
+        }
+
+        Eigen::MatrixXd referencePositionPartial = Eigen::MatrixXd::Zero( 3, 3 );
+        Eigen::MatrixXd switchedPositionPartial = Eigen::MatrixXd::Zero( 3, 3 );
+        referencePartial->wrtPositionOfAcceleratedBody( referencePositionPartial.block( 0, 0, 3, 3 ) );
+        switchedPartial->wrtPositionOfAcceleratedBody( switchedPositionPartial.block( 0, 0, 3, 3 ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( referencePositionPartial, switchedPositionPartial, 1.0E-12 );
+    }
+}
+
 //! Function to get tidal deformation model for Earth
 std::vector< std::shared_ptr< GravityFieldVariationSettings > > getEarthGravityFieldVariationSettings( )
 {
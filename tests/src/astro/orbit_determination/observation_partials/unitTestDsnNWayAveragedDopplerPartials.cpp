@@ -182,6 +182,168 @@ BOOST_AUTO_TEST_CASE( testDsnNWayAveragedDopplerPartials )
     }
 }
 
+//! Test that sharing light-time solutions and partials between back-to-back count intervals reproduces direct evaluation
+BOOST_AUTO_TEST_CASE( testDsnNWayAveragedDopplerIntervalChaining )
+{
+    // Define and create ground stations.
+    std::vector< std::pair< std::string, std::string > > groundStations;
+    groundStations.resize( 2 );
+    groundStations[ 0 ] = std::make_pair( "Earth", "DSS-55" );
+    groundStations[ 1 ] = std::make_pair( "Mars", "MSL" );
+
+    double initialEphemerisTime = 544845633.0;
+    double finalEphemerisTime = 544869060.0;
+    double stateEvaluationTime = initialEphemerisTime + 8.0e3;
+
+    // Create environment
+    std::shared_ptr< OdfRawFileContents > rawOdfFileContents =
+            std::make_shared< OdfRawFileContents >( tudat::paths::getTudatTestDataPath( ) + "mromagr2017_097_1335xmmmv1.odf" );
+    SystemOfBodies bodies = setupEnvironment( groundStations, initialEphemerisTime,
+                                              finalEphemerisTime, stateEvaluationTime, false );
+    std::shared_ptr< ProcessedOdfFileContents > processedOdfFileContents =
+        std::make_shared< ProcessedOdfFileContents >( rawOdfFileContents, "MSL", true );
+    setTransmittingFrequenciesInGroundStations( processedOdfFileContents, bodies.getBody( "Earth" ) );
+    std::shared_ptr< system_models::VehicleSystems > vehicleSystems = std::make_shared< system_models::VehicleSystems >( );
+    vehicleSystems->setTransponderTurnaroundRatio( &getDsnDefaultTurnaroundRatios );
+    bodies.getBody( "Mars" )->getGroundStation( "MSL" )->setVehicleSystems( vehicleSystems );
+
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = groundStations[ 0 ];
+    linkEnds[ retransmitter ] = groundStations[ 1 ];
+    linkEnds[ receiver ] = groundStations[ 0 ];
+
+    // Create observation models and partials without (test 0) and with (test 1) interval chaining
+    std::vector< std::shared_ptr< LightTimeCorrectionSettings > > lightTimeCorrectionsList;
+    lightTimeCorrectionsList.push_back(
+                std::make_shared< FirstOrderRelativisticLightTimeCorrectionSettings >( std::vector< std::string >{ "Earth" } ) );
+    std::shared_ptr< EstimatableParameterSet< double > > fullEstimatableParameterSet =
+            createEstimatableParameters( bodies, stateEvaluationTime );
+
+    std::shared_ptr< ObservationModel< 1, double, Time > > observationModels[ 2 ];
+    std::pair< std::map< std::pair< int, int >, std::shared_ptr< ObservationPartial< 1 > > >,
+            std::shared_ptr< PositionPartialScaling > > partialSets[ 2 ];
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        observationModels[ test ] = observation_models::ObservationModelCreator< 1, double, Time >::createObservationModel(
+                    dsnNWayAveragedDopplerObservationSettings(
+                        linkEnds, lightTimeCorrectionsList, nullptr, std::make_shared< LightTimeConvergenceCriteria >( ),
+                        test == 1 ), bodies );
+        partialSets[ test ] = ObservationPartialCreator< 1, double, Time >::createObservationPartials(
+                    observationModels[ test ], bodies, fullEstimatableParameterSet );
+
+        // Check that partial cache is only created if interval chaining is used
+        for( auto it : partialSets[ test ].first )
+        {
+            std::shared_ptr< DifferencedObservablePartial< 1 > > differencedPartial =
+                    std::dynamic_pointer_cast< DifferencedObservablePartial< 1 > >( it.second );
+            if( differencedPartial != nullptr )
+            {
+                std::shared_ptr< NWayRangePartial > startPartial =
+                        std::dynamic_pointer_cast< NWayRangePartial >( differencedPartial->getFirstPartial( ) );
+                std::shared_ptr< NWayRangePartial > endPartial =
+                        std::dynamic_pointer_cast< NWayRangePartial >( differencedPartial->getSecondPartial( ) );
+                if( startPartial != nullptr && endPartial != nullptr )
+                {
+                    BOOST_CHECK_EQUAL( ( startPartial->getPartialCache( ) != nullptr ), ( test == 1 ) );
+                    BOOST_CHECK( startPartial->getPartialCache( ) == endPartial->getPartialCache( ) );
+                }
+            }
+        }
+    }
+    std::shared_ptr< DsnNWayAveragedDopplerObservationModel< double, Time > > defaultDopplerModel =
+            std::dynamic_pointer_cast< DsnNWayAveragedDopplerObservationModel< double, Time > >( observationModels[ 0 ] );
+    std::shared_ptr< DsnNWayAveragedDopplerObservationModel< double, Time > > dopplerModel =
+            std::dynamic_pointer_cast< DsnNWayAveragedDopplerObservationModel< double, Time > >( observationModels[ 1 ] );
+    BOOST_CHECK_EQUAL( defaultDopplerModel->getUseIntervalChaining( ), false );
+    BOOST_CHECK_EQUAL( dopplerModel->getUseIntervalChaining( ), true );
+
+    // Define back-to-back count intervals
+    double integrationTime = 60.0;
+    std::shared_ptr< ObservationAncilliarySimulationSettings > ancillarySettings =
+            getDsnNWayAveragedDopplerAncillarySettings(
+                std::vector< FrequencyBands >{ x_band, x_band }, x_band, 7.0e9, integrationTime,
+                getRetransmissionDelays( initialEphemerisTime, 1 ) );
+    std::vector< Time > observationTimes;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        observationTimes.push_back( Time( stateEvaluationTime ) + static_cast< double >( i ) * integrationTime );
+    }
+
+    // Compute observations and partials without (test 0) and with (test 1) interval chaining
+    typedef std::vector< std::pair< Eigen::Matrix< double, 1, Eigen::Dynamic >, double > > ObservationPartialReturnType;
+    std::vector< Eigen::VectorXd > observations[ 2 ];
+    std::vector< std::vector< ObservationPartialReturnType > > partials[ 2 ];
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+        {
+            std::vector< Eigen::Vector6d > vectorOfStates;
+            std::vector< double > vectorOfTimes;
+            observations[ test ].push_back( observationModels[ test ]->computeObservationsWithLinkEndData(
+                        observationTimes.at( i ), receiver, vectorOfTimes, vectorOfStates, ancillarySettings ) );
+
+            partialSets[ test ].second->update( vectorOfStates, vectorOfTimes, receiver, observations[ test ].back( ) );
+            partials[ test ].push_back( calculateAnalyticalPartials< 1 >(
+                        partialSets[ test ].first, vectorOfStates, vectorOfTimes, receiver, ancillarySettings,
+                        observations[ test ].back( ) ) );
+        }
+    }
+
+    // Check that all interval start legs (except the first) were reused, and that results are unchanged
+    BOOST_CHECK_EQUAL( dopplerModel->getNumberOfReusedIntervalLegs( ), observationTimes.size( ) - 1 );
+
+    // Check that the partials of all interval start legs (except the first) were reused
+    for( auto it : partialSets[ 1 ].first )
+    {
+        std::shared_ptr< DifferencedObservablePartial< 1 > > differencedPartial =
+                std::dynamic_pointer_cast< DifferencedObservablePartial< 1 > >( it.second );
+        if( differencedPartial != nullptr &&
+                std::dynamic_pointer_cast< NWayRangePartial >( differencedPartial->getFirstPartial( ) ) != nullptr )
+        {
+            std::shared_ptr< NWayRangePartialCache > partialCache =
+                    std::dynamic_pointer_cast< NWayRangePartial >( differencedPartial->getFirstPartial( ) )->getPartialCache( );
+            BOOST_CHECK_EQUAL( partialCache->numberOfReusedPartials_, observationTimes.size( ) - 1 );
+
+            // Check that resetting the cache prevents reuse (e.g. after a parameter update)
+            BOOST_CHECK_EQUAL( partialCache->isSet_, true );
+            differencedPartial->resetPartialCache( );
+            BOOST_CHECK_EQUAL( partialCache->isSet_, false );
+        }
+    }
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( observations[ 0 ].at( i ), observations[ 1 ].at( i ), 1.0E-12 );
+        BOOST_CHECK_EQUAL( partials[ 0 ].at( i ).size( ), partials[ 1 ].at( i ).size( ) );
+        for( unsigned int j = 0; j < partials[ 0 ].at( i ).size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( partials[ 0 ].at( i ).at( j ).size( ), partials[ 1 ].at( i ).at( j ).size( ) );
+            for( unsigned int k = 0; k < partials[ 0 ].at( i ).at( j ).size( ); k++ )
+            {
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( partials[ 0 ].at( i ).at( j ).at( k ).first,
+                                                   partials[ 1 ].at( i ).at( j ).at( k ).first, 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( partials[ 0 ].at( i ).at( j ).at( k ).second,
+                                            partials[ 1 ].at( i ).at( j ).at( k ).second, 1.0E-15 );
+            }
+        }
+    }
+
+    // Check that an interval starting close to, but not exactly at, the end of the previous interval is not chained, and
+    // that its observable is computed over the requested interval
+    unsigned int numberOfReusedIntervalLegs = dopplerModel->getNumberOfReusedIntervalLegs( );
+    Time offsetObservationTime = observationTimes.back( ) + integrationTime + 1.0E-3;
+    std::vector< Eigen::VectorXd > offsetObservations;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::vector< Eigen::Vector6d > vectorOfStates;
+        std::vector< double > vectorOfTimes;
+        offsetObservations.push_back( observationModels[ test ]->computeObservationsWithLinkEndData(
+                    offsetObservationTime, receiver, vectorOfTimes, vectorOfStates, ancillarySettings ) );
+        BOOST_CHECK_CLOSE_FRACTION( vectorOfTimes.at( 3 ),
+                                    static_cast< double >( offsetObservationTime - integrationTime / 2.0 ), 1.0E-15 );
+    }
+    BOOST_CHECK_EQUAL( dopplerModel->getNumberOfReusedIntervalLegs( ), numberOfReusedIntervalLegs );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( offsetObservations.at( 0 ), offsetObservations.at( 1 ), 1.0E-12 );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -23,6 +23,7 @@
 #include "tudat/simulation/estimation_setup/createEstimatableParameters.h"
 #include "tudat/simulation/estimation_setup/createLightTimeCorrectionPartials.h"
 #include "tudat/simulation/estimation_setup/createDirectObservationPartials.h"
+#include "tudat/simulation/estimation_setup/createObservationManager.h"
 #include "tudat/astro/orbit_determination/observation_partials/firstOrderRelativisticPartial.h"
 #include "tudat/support/observationPartialTestFunctions.h"
 
@@ -256,6 +257,82 @@ BOOST_AUTO_TEST_CASE( testOneWayRangePartialsWrtLightTimeParameters )
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE( testOneWayRangePartialsWrtLightTimeParametersOverObservationSet )
+{
+    // Define and create ground stations.
+    std::vector< std::pair< std::string, std::string > > groundStations;
+    groundStations.resize( 2 );
+    groundStations[ 0 ] = std::make_pair( "Earth", "Graz" );
+    groundStations[ 1 ] = std::make_pair( "Mars", "MSL" );
+
+    // Create environment
+    SystemOfBodies bodies = setupEnvironment( groundStations, 1.0E7, 1.2E7, 1.1E7 );
+
+    // Set link ends for observation model
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = groundStations[ 1 ];
+    linkEnds[ receiver ] = groundStations[ 0 ];
+
+    // Define one-way range model settings with first-order relativistic correction
+    std::vector< std::shared_ptr< LightTimeCorrectionSettings > > lightTimeCorrections;
+    std::vector< std::string > perturbingBodyList = { "Sun" };
+    lightTimeCorrections.push_back( std::make_shared< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                                        perturbingBodyList ) );
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    observationSettingsList.push_back( std::make_shared< ObservationModelSettings >(
+                                           one_way_range, linkEnds, lightTimeCorrections ) );
+
+    // Create parameter objects.
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Sun", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "global_metric", ppn_parameter_gamma ) );
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate< double >( parameterNames, bodies );
+    std::vector< std::shared_ptr< EstimatableParameter< double > > > doubleParameterVector =
+            parametersToEstimate->getEstimatedDoubleParameters( );
+
+    // Create observation manager (no initial states are estimated, so no state transition matrices are evaluated)
+    std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface =
+            std::make_shared< propagators::SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                nullptr, nullptr, 0, doubleParameterVector.size( ), std::vector< std::pair< int, int > >( ) );
+    std::shared_ptr< ObservationManager< 1, double, double > > observationManager =
+            std::dynamic_pointer_cast< ObservationManager< 1, double, double > >(
+                createObservationManager< 1, double, double >(
+                    one_way_range, observationSettingsList, bodies, parametersToEstimate, stateTransitionMatrixInterface ) );
+
+    // Compute observations and partials over a set of epochs, for which the light-time corrections differ
+    std::vector< double > observationTimes;
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        observationTimes.push_back( 1.1E7 + static_cast< double >( i ) * 7200.0 );
+    }
+    Eigen::VectorXd observations;
+    Eigen::MatrixXd partials;
+    observationManager->computeObservationsWithPartials(
+                observationTimes, linkEnds, receiver, nullptr, observations, partials );
+
+    BOOST_CHECK_EQUAL( partials.rows( ), static_cast< int >( observationTimes.size( ) ) );
+    BOOST_CHECK_EQUAL( partials.cols( ), static_cast< int >( doubleParameterVector.size( ) ) );
+
+    // Compare partials at each epoch to numerical partials
+    std::function< Eigen::VectorXd( const double ) > observationFunction = std::bind(
+                &ObservationModel< 1, double, double >::computeObservations,
+                observationManager->getObservationModel( linkEnds ), std::placeholders::_1, receiver, nullptr );
+    std::vector< double > parameterPerturbations = { 1.0E16, 1.0E-2 };
+    std::vector< std::function< void( ) > > updateFunctionList = { emptyVoidFunction, emptyVoidFunction };
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        std::vector< Eigen::VectorXd > numericalPartialsWrtDoubleParameters = calculateNumericalPartialsWrtDoubleParameters(
+                    doubleParameterVector, updateFunctionList, parameterPerturbations, observationFunction,
+                    observationTimes.at( i ) );
+        for( unsigned int j = 0; j < doubleParameterVector.size( ); j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( partials( i, j ), numericalPartialsWrtDoubleParameters.at( j ).x( ), 1.0E-4 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
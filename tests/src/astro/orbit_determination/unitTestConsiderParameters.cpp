@@ -347,6 +347,51 @@ BOOST_AUTO_TEST_CASE( testConsiderParameters )
     // Check consistency
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( updatedParameters, computedUpdatedParameters, 1.0e-12 );
 
+    // Repeat covariance analysis and estimation, accumulating normal equations per (small) block of observations
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        bool saveDesignMatrix = ( test == 0 );
+        parameters->resetParameterValues( nominalParameters );
+        orbitDeterminationManager.resetParameterEstimate( nominalParameters );
+
+        std::shared_ptr< EstimationInput< double, double  > > accumulatedEstimationInput = std::make_shared< EstimationInput< double, double > >(
+                observationsAndTimes, Eigen::MatrixXd::Zero( 0, 0 ), std::make_shared< EstimationConvergenceChecker >( 1 ), considerCovariance, considerParametersDeviations );
+        accumulatedEstimationInput->defineEstimationSettings( true, true, saveDesignMatrix );
+        accumulatedEstimationInput->setNormalEquationsAccumulation( true, 7 );
+        std::shared_ptr< CovarianceAnalysisInput< double, double  > > accumulatedCovarianceInput = std::make_shared< CovarianceAnalysisInput< double, double > >(
+                observationsAndTimes, Eigen::MatrixXd::Zero( 0, 0 ), considerCovariance );
+        accumulatedCovarianceInput->defineCovarianceSettings( true, true, saveDesignMatrix );
+        accumulatedCovarianceInput->setNormalEquationsAccumulation( true, 7 );
+
+        std::shared_ptr< CovarianceAnalysisOutput< double, double> > accumulatedCovarianceOutput =
+                orbitDeterminationManager.computeCovariance( accumulatedCovarianceInput );
+        std::shared_ptr< EstimationOutput< double, double > > accumulatedEstimationOutput =
+                orbitDeterminationManager.estimateParameters( accumulatedEstimationInput );
+
+        // Check that normalization, covariance (including consider parameters), residuals and parameter update are unchanged
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedCovarianceOutput->designMatrixTransformationDiagonal_,
+                                           covarianceOutput->designMatrixTransformationDiagonal_, 1.0e-15 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedCovarianceOutput->considerNormalizationFactors_,
+                                           covarianceOutput->considerNormalizationFactors_, 1.0e-15 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedCovarianceOutput->unnormalizedCovarianceMatrix_,
+                                           covarianceOutput->unnormalizedCovarianceMatrix_, 1.0e-11 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedCovarianceOutput->unnormalizedCovarianceWithConsiderParameters_,
+                                           covarianceOutput->unnormalizedCovarianceWithConsiderParameters_, 1.0e-11 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedEstimationOutput->residuals_, estimationOutput->residuals_, 1.0e-12 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedEstimationOutput->parameterHistory_.at( 1 ), updatedParameters, 1.0e-12 );
+
+        // Check that design matrix is only stored when requested
+        if( saveDesignMatrix )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedEstimationOutput->getNormalizedDesignMatrix( ),
+                                               estimationOutput->getNormalizedDesignMatrix( ), 1.0e-15 );
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL( accumulatedEstimationOutput->getNormalizedDesignMatrix( ).rows( ), 0 );
+            BOOST_CHECK_EQUAL( accumulatedCovarianceOutput->getNormalizedDesignMatrix( ).rows( ), 0 );
+        }
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
@@ -52,7 +52,12 @@ using namespace tudat::basic_astrodynamics;
 
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeParameterEstimation(
-        const int linkArcs )
+        const int linkArcs,
+        Eigen::MatrixXd& designMatrix,
+        Eigen::VectorXd& initialResiduals,
+        const bool reduceArcWiseParameters = false,
+        const unsigned int numberOfObservationThreads = 1,
+        const bool estimateTimeBias = false )
 {
     //Load spice kernels.f
     std::string kernelsPath = paths::getSpiceKernelPath( );
@@ -74,27 +79,31 @@ Eigen::VectorXd  executeParameterEstimation(
 
     double buffer = 10.0 * maximumTimeStep;
 
-    BodyListSettings bodySettings =
-            getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
-    bodySettings.at( "Earth" )->ephemerisSettings->resetMakeMultiArcEphemeris( true );
-    bodySettings.at( "Moon" )->ephemerisSettings->resetFrameOrigin( "Sun" );
-    bodySettings.at( "Mars" )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
-                "ECLIPJ2000", "IAU_Mars",
-                spice_interface::computeRotationQuaternionBetweenFrames(
-                    "ECLIPJ2000", "IAU_Mars", initialEphemerisTime ),
-                initialEphemerisTime, 2.0 * mathematical_constants::PI /
-                ( physical_constants::JULIAN_DAY + 40.0 * 60.0 ) );
-    SystemOfBodies bodies = createSystemOfBodies< ObservationScalarType, TimeType >( bodySettings );
-
-    
-
-    // Create ground stations
+    // Create bodies and ground stations (in function, so that independent copies can be made for parallel observation evaluation)
+    std::function< SystemOfBodies( ) > createBodies = [ & ]( )
+    {
+        BodyListSettings bodySettings =
+                getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+        bodySettings.at( "Earth" )->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+        bodySettings.at( "Moon" )->ephemerisSettings->resetFrameOrigin( "Sun" );
+        bodySettings.at( "Mars" )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                    "ECLIPJ2000", "IAU_Mars",
+                    spice_interface::computeRotationQuaternionBetweenFrames(
+                        "ECLIPJ2000", "IAU_Mars", initialEphemerisTime ),
+                    initialEphemerisTime, 2.0 * mathematical_constants::PI /
+                    ( physical_constants::JULIAN_DAY + 40.0 * 60.0 ) );
+        SystemOfBodies createdBodies = createSystemOfBodies< ObservationScalarType, TimeType >( bodySettings );
+
+        createGroundStation( createdBodies.at( "Mars" ), "MarsStation", ( Eigen::Vector3d( ) << 100.0, 0.5, 2.1 ).finished( ),
+                             coordinate_conversions::geodetic_position );
+        return createdBodies;
+    };
+    SystemOfBodies bodies = createBodies( );
+
+    // Define ground stations
     std::pair< std::string, std::string > grazStation = std::pair< std::string, std::string >( "Earth", "" );
     std::pair< std::string, std::string > mslStation = std::pair< std::string, std::string >( "Mars", "MarsStation" );
 
-    createGroundStation( bodies.at( "Mars" ), "MarsStation", ( Eigen::Vector3d( ) << 100.0, 0.5, 2.1 ).finished( ),
-                         coordinate_conversions::geodetic_position );
-
     std::vector< std::pair< std::string, std::string > > groundStations;
     groundStations.push_back( grazStation );
     groundStations.push_back( mslStation );
@@ -154,6 +163,14 @@ Eigen::VectorXd  executeParameterEstimation(
     std::shared_ptr< IntegratorSettings< TimeType > > integratorSettings =
         rungeKutta4Settings< TimeType >( 3600.0 );
 
+    // Save acceleration of Earth if a time bias is estimated (required for the partials w.r.t. the time bias)
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    if( estimateTimeBias )
+    {
+        dependentVariables.push_back( std::make_shared< SingleDependentVariableSaveSettings >(
+                                          total_acceleration_dependent_variable, "Earth" ) );
+    }
+
     std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > > propagatorSettingsList;
     for( unsigned int i = 0; i < integrationArcStartTimes.size( ); i++ )
     {
@@ -166,7 +183,7 @@ Eigen::VectorXd  executeParameterEstimation(
                       currentInitialState,
                       integrationArcStartTimes.at( i ),
                       integratorSettings,
-                      propagationTimeTerminationSettings( integrationArcEndTimes.at( i ) ) ) );
+                      propagationTimeTerminationSettings( integrationArcEndTimes.at( i ) ), cowell, dependentVariables ) );
     }
     std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings =
             std::make_shared< MultiArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettingsList, linkArcs );
@@ -181,6 +198,14 @@ Eigen::VectorXd  executeParameterEstimation(
                               ( "Mars", constant_rotation_rate ) );
     parameterNames.push_back(  std::make_shared< EstimatableParameterSettings >
                                ( "Mars", rotation_pole_position ) );
+    if( estimateTimeBias )
+    {
+        LinkEnds timeBiasLinkEnds;
+        timeBiasLinkEnds[ transmitter ] = LinkEndId( grazStation );
+        timeBiasLinkEnds[ receiver ] = LinkEndId( mslStation );
+        parameterNames.push_back( std::make_shared< ConstantTimeBiasEstimatableParameterSettings >(
+                                      timeBiasLinkEnds, one_way_range, receiver ) );
+    }
 
     std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate =
             createParametersToEstimate< StateScalarType >( parameterNames, bodies );
@@ -195,9 +220,16 @@ Eigen::VectorXd  executeParameterEstimation(
     linkEnds2[ 1 ][ receiver ] = grazStation;
     linkEnds2[ 1 ][ transmitter ] = mslStation;
 
+    std::shared_ptr< ObservationBiasSettings > biasSettings;
+    if( estimateTimeBias )
+    {
+        biasSettings = std::make_shared< ConstantTimeBiasSettings >( 0.0, receiver );
+    }
+
     std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
     observationSettingsList.push_back( std::make_shared< ObservationModelSettings >(
-                                       one_way_range, linkEnds2[ 0 ] ) );
+                                       one_way_range, linkEnds2[ 0 ], std::shared_ptr< LightTimeCorrectionSettings >( ),
+                                       biasSettings ) );
     observationSettingsList.push_back( std::make_shared< ObservationModelSettings >(
                                        one_way_range, linkEnds2[ 1 ] ) );
 
@@ -207,6 +239,14 @@ Eigen::VectorXd  executeParameterEstimation(
             OrbitDeterminationManager< ObservationScalarType, TimeType >(
                 bodies, parametersToEstimate,
                 observationSettingsList, propagatorSettings );
+    if( numberOfObservationThreads > 1 )
+    {
+        orbitDeterminationManager.setParallelObservationEvaluation(
+                    numberOfObservationThreads, createBodies, [ & ]( const SystemOfBodies& threadBodies )
+        {
+            return createParametersToEstimate< StateScalarType >( parameterNames, threadBodies );
+        } );
+    }
 
     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > initialParameterEstimate =
             parametersToEstimate->template getFullParameterValues< StateScalarType >( );
@@ -266,6 +306,11 @@ Eigen::VectorXd  executeParameterEstimation(
     std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > covarianceInput =
             std::make_shared< CovarianceAnalysisInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes );
+    if( reduceArcWiseParameters )
+    {
+        estimationInput->setNormalEquationsAccumulation( true, 1000, true );
+        covarianceInput->setNormalEquationsAccumulation( true, 1000, true );
+    }
 
     std::shared_ptr< EstimationOutput< StateScalarType, TimeType > > estimationOutput = orbitDeterminationManager.estimateParameters(
                 estimationInput );
@@ -277,18 +322,27 @@ Eigen::VectorXd  executeParameterEstimation(
 
     compareEstimationAndCovarianceResults( estimationOutput, covarianceOutput );
 
+    designMatrix = estimationOutput->getUnnormalizedDesignMatrix( );
+    initialResiduals = estimationOutput->residualHistory_.at( 0 );
+
     return ( finalParameters - truthParameters ).template cast< double >( );
 }
 
 
 BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
 {
-    // Execute test for linked arcs and separate arcs.
-    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    // Execute test for linked arcs and separate arcs, for separate arcs with arc initial states reduced per arc, and for
+    // separate arcs with observations and partials computed on multiple threads
+    Eigen::VectorXd serialParameterError, serialInitialResiduals;
+    Eigen::MatrixXd serialDesignMatrix;
+    for( unsigned int testCase = 0; testCase < 4; testCase++ )
     {
+        Eigen::MatrixXd designMatrix;
+        Eigen::VectorXd initialResiduals;
+        unsigned int numberOfObservationThreads = ( testCase == 3 ) ? 3 : 1;
 #if( TUDAT_BUILD_WITH_EXTENDED_PRECISION_PROPAGATION_TOOLS )
         Eigen::VectorXd parameterError = executeParameterEstimation< long double, tudat::Time, long double >(
-                    testCase );
+                    testCase % 2, designMatrix, initialResiduals, testCase == 2, numberOfObservationThreads );
         int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
 
         std::cout <<"Estimation error: "<< parameterError.transpose( ) << std::endl;
@@ -306,7 +360,7 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
         BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 1 ) ), 1.0E-12 );
 #else
         Eigen::VectorXd parameterError = executeParameterEstimation< double, double, double >(
-                    testCase );
+                    testCase % 2, designMatrix, initialResiduals, testCase == 2, numberOfObservationThreads );
         int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
 
         std::cout << parameterError.transpose( ) << std::endl;
@@ -323,10 +377,77 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
         BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 2 ) ), 1.0E-9 );
         BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 1 ) ), 1.0E-9 );
 #endif
+
+        // Check that parallel computation of observations and partials reproduces serial result. As each row of the
+        // design matrix and residuals is computed by the same (deterministic) models, only rounding-level differences
+        // are allowed, so that any misplaced or unsynchronized row is detected.
+        if( testCase == 1 )
+        {
+            serialParameterError = parameterError;
+            serialDesignMatrix = designMatrix;
+            serialInitialResiduals = initialResiduals;
+        }
+        else if( testCase == 3 )
+        {
+            BOOST_CHECK_EQUAL( designMatrix.rows( ), serialDesignMatrix.rows( ) );
+            BOOST_CHECK_EQUAL( designMatrix.cols( ), serialDesignMatrix.cols( ) );
+            BOOST_CHECK_EQUAL( initialResiduals.rows( ), serialInitialResiduals.rows( ) );
+            if( designMatrix.rows( ) == serialDesignMatrix.rows( ) && designMatrix.cols( ) == serialDesignMatrix.cols( ) &&
+                    initialResiduals.rows( ) == serialInitialResiduals.rows( ) )
+            {
+                for( int j = 0; j < serialDesignMatrix.cols( ); j++ )
+                {
+                    BOOST_CHECK_SMALL( ( designMatrix.col( j ) - serialDesignMatrix.col( j ) ).cwiseAbs( ).maxCoeff( ),
+                                       1.0E-12 * serialDesignMatrix.col( j ).cwiseAbs( ).maxCoeff( ) );
+                }
+                BOOST_CHECK_SMALL( ( initialResiduals - serialInitialResiduals ).cwiseAbs( ).maxCoeff( ),
+                                   1.0E-12 * serialInitialResiduals.cwiseAbs( ).maxCoeff( ) );
+            }
+
+            for( int i = 0; i < parameterError.rows( ); i++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( parameterError( i ) - serialParameterError( i ) ),
+                                   1.0E-3 * std::fabs( serialParameterError( i ) ) + 1.0E-20 );
+            }
+        }
     }
 
 }
 
+BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimationParallelWithTimeBias )
+{
+    // Estimate a time bias, for which the partials use the propagated dependent variables, and check that parallel
+    // computation of observations and partials reproduces the serial result
+    std::vector< Eigen::MatrixXd > designMatrices( 2 );
+    std::vector< Eigen::VectorXd > initialResiduals( 2 );
+    std::vector< unsigned int > numberOfObservationThreads = { 1, 3 };
+    for( unsigned int testCase = 0; testCase < numberOfObservationThreads.size( ); testCase++ )
+    {
+        executeParameterEstimation< double, double, double >(
+                    false, designMatrices.at( testCase ), initialResiduals.at( testCase ), false,
+                    numberOfObservationThreads.at( testCase ), true );
+    }
+
+    // Check that partials w.r.t. time bias (last parameter) are computed
+    BOOST_CHECK_GT( designMatrices.at( 0 ).col( designMatrices.at( 0 ).cols( ) - 1 ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    BOOST_CHECK_EQUAL( designMatrices.at( 1 ).rows( ), designMatrices.at( 0 ).rows( ) );
+    BOOST_CHECK_EQUAL( designMatrices.at( 1 ).cols( ), designMatrices.at( 0 ).cols( ) );
+    BOOST_CHECK_EQUAL( initialResiduals.at( 1 ).rows( ), initialResiduals.at( 0 ).rows( ) );
+    if( designMatrices.at( 1 ).rows( ) == designMatrices.at( 0 ).rows( ) &&
+            designMatrices.at( 1 ).cols( ) == designMatrices.at( 0 ).cols( ) &&
+            initialResiduals.at( 1 ).rows( ) == initialResiduals.at( 0 ).rows( ) )
+    {
+        for( int j = 0; j < designMatrices.at( 0 ).cols( ); j++ )
+        {
+            BOOST_CHECK_SMALL( ( designMatrices.at( 1 ).col( j ) - designMatrices.at( 0 ).col( j ) ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-12 * designMatrices.at( 0 ).col( j ).cwiseAbs( ).maxCoeff( ) );
+        }
+        BOOST_CHECK_SMALL( ( initialResiduals.at( 1 ) - initialResiduals.at( 0 ) ).cwiseAbs( ).maxCoeff( ),
+                           1.0E-12 * initialResiduals.at( 0 ).cwiseAbs( ).maxCoeff( ) );
+    }
+}
+
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeMultiBodyMultiArcParameterEstimation( )
 {
@@ -423,6 +423,195 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
     }
 }
 
+//! Function to create the bodies for the test of concurrent multi-arc propagation
+SystemOfBodies createParallelPropagationTestBodies( )
+{
+    std::vector< std::string > bodyNames = { "Earth", "Sun", "Moon", "Mars" };
+    BodyListSettings bodySettings = getDefaultBodySettings( bodyNames, 1.0E7 - 3.6E4, 1.5E7 + 3.6E4 );
+    bodySettings.at( "Moon" )->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings.at( "Earth" )->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    return createSystemOfBodies( bodySettings );
+}
+
+//! Function to create the multi-arc propagator settings for the test of concurrent multi-arc propagation, using given
+//! integrator settings for each arc
+std::shared_ptr< MultiArcPropagatorSettings< > > createParallelPropagationTestPropagatorSettings(
+        const SystemOfBodies& bodies,
+        const std::function< std::shared_ptr< IntegratorSettings< > >( const double ) > integratorSettingsFunction )
+{
+    std::vector< std::string > bodiesToIntegrate = { "Moon", "Earth" };
+    std::vector< std::string > centralBodies = { "Earth", "Sun" };
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Earth" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Earth" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< > > > propagatorSettingsList;
+    for( unsigned int i = 0; i < 9; i++ )
+    {
+        double arcStartTime = 1.0E7 + 5.0E5 * static_cast< double >( i );
+        propagatorSettingsList.push_back(
+                    translationalStatePropagatorSettings< >(
+                        centralBodies, accelerationModelMap, bodiesToIntegrate,
+                        getInitialStatesOfBodies( bodiesToIntegrate, centralBodies, bodies, arcStartTime ),
+                        arcStartTime, integratorSettingsFunction( arcStartTime ),
+                        propagationTimeTerminationSettings( arcStartTime + 5.0E5 ) ) );
+    }
+    return std::make_shared< MultiArcPropagatorSettings< > >( propagatorSettingsList );
+}
+
+//! Function to create the multi-arc propagator settings for the test of concurrent multi-arc propagation (fixed step)
+std::shared_ptr< MultiArcPropagatorSettings< > > createParallelPropagationTestPropagatorSettings(
+        const SystemOfBodies& bodies )
+{
+    return createParallelPropagationTestPropagatorSettings(
+                bodies, [ ]( const double arcStartTime )
+    {
+        return std::make_shared< IntegratorSettings< > >( rungeKutta4, arcStartTime, 1800.0 );
+    } );
+}
+
+//! Function to create the multi-arc propagator settings for the test of concurrent multi-arc propagation (variable step)
+std::shared_ptr< MultiArcPropagatorSettings< > > createParallelPropagationTestVariableStepPropagatorSettings(
+        const SystemOfBodies& bodies )
+{
+    return createParallelPropagationTestPropagatorSettings(
+                bodies, [ ]( const double )
+    {
+        return rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                    1800.0, rungeKuttaFeagin108, 1.0, 1.0E5, 1.0E-12, 1.0E-12 );
+    } );
+}
+
+//! Function to create the parameters for the test of concurrent multi-arc propagation
+std::shared_ptr< EstimatableParameterSet< double > > createParallelPropagationTestParameters(
+        const SystemOfBodies& bodies,
+        const std::shared_ptr< MultiArcPropagatorSettings< > > propagatorSettings )
+{
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+            getInitialMultiArcParameterSettings< >( propagatorSettings, bodies, propagatorSettings->getArcStartTimes( ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Moon", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    return createParametersToEstimate< double, double >( parameterNames, bodies, propagatorSettings );
+}
+
+//! Test whether concurrent propagation of arcs (dynamics and variational equations) reproduces the sequential propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcVariationalEquations )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::vector< Eigen::MatrixXd > > stateTransitionMatrices;
+    std::vector< std::vector< Eigen::VectorXd > > propagatedStates;
+    std::vector< unsigned int > numberOfThreadsList = { 0, 1, 2, 4 };
+    for( unsigned int test = 0; test < numberOfThreadsList.size( ); test++ )
+    {
+        SystemOfBodies bodies = createParallelPropagationTestBodies( );
+        std::shared_ptr< MultiArcPropagatorSettings< > > propagatorSettings =
+                createParallelPropagationTestPropagatorSettings( bodies );
+        std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+                createParallelPropagationTestParameters( bodies, propagatorSettings );
+
+        // Perturb gravitational parameters, to check whether parameter values are transferred to all threads
+        Eigen::VectorXd parameterVector = parametersToEstimate->getFullParameterValues< double >( );
+        parameterVector.tail( 2 ) *= ( 1.0 + 1.0E-6 );
+        parametersToEstimate->resetParameterValues( parameterVector );
+
+        MultiArcVariationalEquationsSolver< > variationalEquationsSolver(
+                    bodies, propagatorSettings, parametersToEstimate );
+        if( numberOfThreadsList.at( test ) > 0 )
+        {
+            variationalEquationsSolver.setParallelPropagationSettings(
+                        multiArcParallelPropagationSettings< double, double >(
+                            numberOfThreadsList.at( test ), &createParallelPropagationTestBodies,
+                            [ ]( const SystemOfBodies& threadBodies )
+                            { return createParallelPropagationTestPropagatorSettings( threadBodies ); } ),
+                        &createParallelPropagationTestParameters );
+        }
+        variationalEquationsSolver.integrateVariationalAndDynamicalEquations( propagatorSettings->getInitialStateList( ), true );
+
+        // Retrieve state transition matrices and states near end of each arc
+        stateTransitionMatrices.push_back( std::vector< Eigen::MatrixXd >( ) );
+        propagatedStates.push_back( std::vector< Eigen::VectorXd >( ) );
+        std::vector< std::shared_ptr< SingleArcVariationalSimulationResults< > > > arcResults =
+                variationalEquationsSolver.getMultiArcVariationalPropagationResults( )->getSingleArcResults( );
+        BOOST_CHECK_EQUAL( arcResults.size( ), 9 );
+        for( unsigned int arc = 0; arc < arcResults.size( ); arc++ )
+        {
+            double testEpoch = 1.0E7 + 5.0E5 * static_cast< double >( arc + 1 ) - 2.0E4;
+            stateTransitionMatrices.back( ).push_back(
+                        variationalEquationsSolver.getStateTransitionMatrixInterface( )->
+                        getCombinedStateTransitionAndSensitivityMatrix( testEpoch ) );
+            propagatedStates.back( ).push_back(
+                        arcResults.at( arc )->getDynamicsResults( )->getEquationsOfMotionNumericalSolution( ).rbegin( )->second );
+        }
+    }
+
+    // Check that all concurrent propagations are identical to the sequential one
+    for( unsigned int test = 1; test < numberOfThreadsList.size( ); test++ )
+    {
+        for( unsigned int arc = 0; arc < stateTransitionMatrices.at( 0 ).size( ); arc++ )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( stateTransitionMatrices.at( test ).at( arc ),
+                                               stateTransitionMatrices.at( 0 ).at( arc ),
+                                               std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( propagatedStates.at( test ).at( arc ),
+                                               propagatedStates.at( 0 ).at( arc ),
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+}
+
+
+//! Test whether concurrent propagation of arcs is safe when the (variable step-size) integrator coefficients are first
+//! retrieved by the worker threads
+BOOST_AUTO_TEST_CASE( testParallelMultiArcPropagationWithUnusedVariableStepIntegrator )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Propagate concurrently first, so that the Runge-Kutta-Feagin 10(8) coefficients (not used elsewhere in this
+    // test) are first created by the worker threads
+    std::vector< std::vector< Eigen::VectorXd > > propagatedStates;
+    std::vector< unsigned int > numberOfThreadsList = { 4, 0 };
+    for( unsigned int test = 0; test < numberOfThreadsList.size( ); test++ )
+    {
+        SystemOfBodies bodies = createParallelPropagationTestBodies( );
+        std::shared_ptr< MultiArcPropagatorSettings< > > propagatorSettings =
+                createParallelPropagationTestVariableStepPropagatorSettings( bodies );
+
+        MultiArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings, false );
+        if( numberOfThreadsList.at( test ) > 0 )
+        {
+            dynamicsSimulator.setParallelPropagationSettings(
+                        multiArcParallelPropagationSettings< double, double >(
+                            numberOfThreadsList.at( test ), &createParallelPropagationTestBodies,
+                            &createParallelPropagationTestVariableStepPropagatorSettings ) );
+        }
+        dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+
+        propagatedStates.push_back( std::vector< Eigen::VectorXd >( ) );
+        std::vector< std::shared_ptr< SingleArcSimulationResults< > > > arcResults =
+                dynamicsSimulator.getMultiArcPropagationResults( )->getSingleArcResults( );
+        BOOST_CHECK_EQUAL( arcResults.size( ), 9 );
+        for( unsigned int arc = 0; arc < arcResults.size( ); arc++ )
+        {
+            BOOST_CHECK_EQUAL( arcResults.at( arc )->integrationCompletedSuccessfully( ), true );
+            propagatedStates.back( ).push_back(
+                        arcResults.at( arc )->getEquationsOfMotionNumericalSolution( ).rbegin( )->second );
+        }
+    }
+
+    // Check that the concurrent propagation is identical to the sequential one
+    for( unsigned int arc = 0; arc < propagatedStates.at( 0 ).size( ); arc++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( propagatedStates.at( 0 ).at( arc ),
+                                           propagatedStates.at( 1 ).at( arc ),
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
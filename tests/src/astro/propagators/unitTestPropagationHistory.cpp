@@ -0,0 +1,158 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/propagators/propagationHistory.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_history )
+
+//! Test appending, overwriting and removing entries, and zero-copy access to the values
+BOOST_AUTO_TEST_CASE( testPropagationHistoryStorage )
+{
+    // Create history with small chunk size, so that storage is grown several times
+    PropagationHistory< double, double > history( 0, 0, 4 );
+    BOOST_CHECK_EQUAL( history.empty( ), true );
+
+    // Add entries (in order of decreasing time, as for a backwards propagation)
+    for( unsigned int i = 0; i < 25; i++ )
+    {
+        history.append( -static_cast< double >( i ), Eigen::Vector3d::Constant( static_cast< double >( i ) ) );
+    }
+    BOOST_CHECK_EQUAL( history.size( ), 25 );
+    BOOST_CHECK_EQUAL( history.getEntryRows( ), 3 );
+    BOOST_CHECK_EQUAL( history.getEntryColumns( ), 1 );
+
+    // Overwrite last entry
+    history.append( -24.0, Eigen::Vector3d( 1.0, 2.0, 3.0 ) );
+    BOOST_CHECK_EQUAL( history.size( ), 25 );
+    BOOST_CHECK_EQUAL( history.getLastValue( )( 2, 0 ), 3.0 );
+
+    // Remove last entry
+    history.removeLastEntry( );
+    BOOST_CHECK_EQUAL( history.size( ), 24 );
+    BOOST_CHECK_EQUAL( history.getLastTime( ), -23.0 );
+
+    // Check that entry of incorrect size is rejected
+    bool exceptionIsCaught = false;
+    try
+    {
+        history.append( 1.0, Eigen::Vector2d::Zero( ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        exceptionIsCaught = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionIsCaught, true );
+
+    // Check full value matrix (one row per entry), and that it is a view of the single entries
+    Eigen::Map< const PropagationHistory< double, double >::ValueMatrix > values = history.getValues( );
+    BOOST_CHECK_EQUAL( values.rows( ), 24 );
+    BOOST_CHECK_EQUAL( values.cols( ), 3 );
+    for( unsigned int i = 0; i < history.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( history.getTime( i ), -static_cast< double >( i ) );
+        BOOST_CHECK_EQUAL( history.getValue( i ).data( ), values.row( i ).data( ) );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( values( i, j ), static_cast< double >( i ) );
+        }
+    }
+
+    history.clear( );
+    BOOST_CHECK_EQUAL( history.empty( ), true );
+    BOOST_CHECK_EQUAL( history.getEntrySize( ), 3 );
+}
+
+//! Test conversion between history and map-based interface
+BOOST_AUTO_TEST_CASE( testPropagationHistoryMapConversion )
+{
+    // Create history with matrix entries
+    PropagationHistory< double, double > matrixHistory;
+    for( int i = 10; i >= 0; i-- )
+    {
+        Eigen::Matrix< double, 2, 3 > entry;
+        entry << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+        matrixHistory.append( static_cast< double >( i ), static_cast< double >( i ) * entry );
+    }
+
+    // Check that map is ordered in time, and has correct entries
+    std::map< double, Eigen::MatrixXd > matrixMap = matrixHistory.createMap< Eigen::MatrixXd >( );
+    BOOST_CHECK_EQUAL( matrixMap.size( ), 11 );
+    BOOST_CHECK_EQUAL( matrixMap.begin( )->first, 0.0 );
+    BOOST_CHECK_EQUAL( matrixMap.rbegin( )->first, 10.0 );
+    for( auto mapIterator: matrixMap )
+    {
+        BOOST_CHECK_EQUAL( mapIterator.second.rows( ), 2 );
+        BOOST_CHECK_EQUAL( mapIterator.second.cols( ), 3 );
+        BOOST_CHECK_EQUAL( mapIterator.second( 1, 0 ), 4.0 * mapIterator.first );
+        BOOST_CHECK_EQUAL( mapIterator.second( 0, 2 ), 3.0 * mapIterator.first );
+    }
+
+    // Check that history recreated from map is identical (up to ordering)
+    PropagationHistory< double, double > recreatedHistory;
+    recreatedHistory.appendMap( matrixMap );
+    BOOST_CHECK_EQUAL( recreatedHistory.size( ), matrixHistory.size( ) );
+    for( unsigned int i = 0; i < recreatedHistory.size( ); i++ )
+    {
+        unsigned int reverseIndex = matrixHistory.size( ) - 1 - i;
+        BOOST_CHECK_EQUAL( recreatedHistory.getTime( i ), matrixHistory.getTime( reverseIndex ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( recreatedHistory.getValue( i ), matrixHistory.getValue( reverseIndex ),
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check conversion of scalar history
+    PropagationHistory< double, double > scalarHistory;
+    std::map< double, double > scalarMap;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        scalarMap[ 0.1 * i ] = std::sqrt( static_cast< double >( i ) );
+    }
+    scalarHistory.appendMap( scalarMap );
+    BOOST_CHECK_EQUAL( scalarHistory.getEntrySize( ), 1 );
+    std::map< double, double > recreatedScalarMap = scalarHistory.createScalarMap( );
+    BOOST_CHECK_EQUAL( recreatedScalarMap.size( ), scalarMap.size( ) );
+    for( auto mapIterator: scalarMap )
+    {
+        BOOST_CHECK_EQUAL( recreatedScalarMap.at( mapIterator.first ), mapIterator.second );
+    }
+
+    // Check that scalar map cannot be created from vector history
+    bool exceptionIsCaught = false;
+    try
+    {
+        matrixHistory.createScalarMap( );
+    }
+    catch( const std::runtime_error& )
+    {
+        exceptionIsCaught = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionIsCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
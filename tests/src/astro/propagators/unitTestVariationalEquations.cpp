@@ -1252,6 +1252,424 @@ BOOST_AUTO_TEST_CASE( testMassRateVariationalEquations )
 
 }
 
+//! Test compact storage and interpolation of state transition and sensitivity matrices, by comparing to the interpolators
+BOOST_AUTO_TEST_CASE( testCompactStateTransitionMatrixHistory )
+{
+    const int stateTransitionMatrixSize = 12;
+    const int sensitivityMatrixSize = 3;
+    const int numberOfEpochs = 200;
+    const double timeStep = 60.0;
+
+    // Create smooth synthetic matrix histories, with non-uniform time steps
+    std::map< double, Eigen::MatrixXd > stateTransitionSolution;
+    std::map< double, Eigen::MatrixXd > sensitivitySolution;
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        double currentTime = 1.0E5 + timeStep * ( i + 0.3 * std::sin( static_cast< double >( i ) ) );
+        Eigen::MatrixXd currentStateTransitionMatrix = Eigen::MatrixXd( stateTransitionMatrixSize, stateTransitionMatrixSize );
+        Eigen::MatrixXd currentSensitivityMatrix = Eigen::MatrixXd( stateTransitionMatrixSize, sensitivityMatrixSize );
+        for( int j = 0; j < stateTransitionMatrixSize; j++ )
+        {
+            for( int k = 0; k < stateTransitionMatrixSize; k++ )
+            {
+                currentStateTransitionMatrix( j, k ) = std::sin( 1.0E-4 * ( j + 1 ) * currentTime + k );
+            }
+            for( int k = 0; k < sensitivityMatrixSize; k++ )
+            {
+                currentSensitivityMatrix( j, k ) = 1.0E3 * std::cos( 2.0E-4 * ( k + 1 ) * currentTime + j );
+            }
+        }
+        stateTransitionSolution[ currentTime ] = currentStateTransitionMatrix;
+        sensitivitySolution[ currentTime ] = currentSensitivityMatrix;
+    }
+
+    std::vector< std::pair< int, int > > statePartialAdditionIndices = { std::make_pair( 0, 6 ) };
+
+    // Create interface using Lagrange interpolators (without clearing the solution)
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > stateTransitionMatrixInterpolator;
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > sensitivityMatrixInterpolator;
+    createStateTransitionAndSensitivityMatrixInterpolator(
+                stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator,
+                stateTransitionSolution, sensitivitySolution, false );
+    SingleArcCombinedStateTransitionAndSensitivityMatrixInterface interpolatorInterface(
+                stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator,
+                stateTransitionMatrixSize, stateTransitionMatrixSize + sensitivityMatrixSize, statePartialAdditionIndices );
+
+    // Create interfaces using compact matrix histories, in double and single precision
+    std::shared_ptr< CompactStateTransitionMatrixHistory > compactMatrixHistory =
+            std::make_shared< CompactStateTransitionMatrixHistory >( stateTransitionSolution, sensitivitySolution );
+    std::shared_ptr< CompactStateTransitionMatrixHistory > singlePrecisionCompactMatrixHistory =
+            std::make_shared< CompactStateTransitionMatrixHistory >( stateTransitionSolution, sensitivitySolution, 4, true );
+    SingleArcCombinedStateTransitionAndSensitivityMatrixInterface compactInterface(
+                compactMatrixHistory, stateTransitionMatrixSize, stateTransitionMatrixSize + sensitivityMatrixSize,
+                statePartialAdditionIndices );
+    SingleArcCombinedStateTransitionAndSensitivityMatrixInterface singlePrecisionCompactInterface(
+                singlePrecisionCompactMatrixHistory, stateTransitionMatrixSize, stateTransitionMatrixSize + sensitivityMatrixSize,
+                statePartialAdditionIndices );
+
+    BOOST_CHECK_EQUAL( compactMatrixHistory->getMatrixDataSize( ),
+                       sizeof( double ) * numberOfEpochs * stateTransitionMatrixSize * ( stateTransitionMatrixSize + sensitivityMatrixSize ) );
+    BOOST_CHECK_EQUAL( singlePrecisionCompactMatrixHistory->getMatrixDataSize( ),
+                       numberOfEpochs * stateTransitionMatrixSize * (
+                           sizeof( double ) * stateTransitionMatrixSize + sizeof( float ) * sensitivityMatrixSize ) );
+
+    // Compare interpolated matrices away from boundaries (where interpolator uses cubic spline), including at data points
+    std::vector< double > evaluationTimes;
+    std::vector< double > dataTimes = compactMatrixHistory->getTimes( );
+    for( int i = 2; i < numberOfEpochs - 3; i++ )
+    {
+        evaluationTimes.push_back( dataTimes.at( i ) );
+        evaluationTimes.push_back( dataTimes.at( i ) + 0.37 * ( dataTimes.at( i + 1 ) - dataTimes.at( i ) ) );
+    }
+
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        Eigen::MatrixXd interpolatorMatrix = interpolatorInterface.getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ) );
+        Eigen::MatrixXd compactMatrix = compactInterface.getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ) );
+        Eigen::MatrixXd singlePrecisionCompactMatrix =
+                singlePrecisionCompactInterface.getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ) );
+
+        for( int j = 0; j < stateTransitionMatrixSize; j++ )
+        {
+            for( int k = 0; k < stateTransitionMatrixSize + sensitivityMatrixSize; k++ )
+            {
+                double scale = ( k < stateTransitionMatrixSize ) ? 1.0 : 1.0E3;
+                BOOST_CHECK_SMALL( std::fabs( compactMatrix( j, k ) - interpolatorMatrix( j, k ) ) / scale, 1.0E-13 );
+                BOOST_CHECK_SMALL( std::fabs( singlePrecisionCompactMatrix( j, k ) - interpolatorMatrix( j, k ) ) / scale,
+                                   ( k < stateTransitionMatrixSize ) ? 1.0E-13 : 1.0E-6 );
+            }
+        }
+    }
+
+    // Check batch evaluation (including unsorted times) against single evaluations
+    std::vector< double > batchEvaluationTimes = evaluationTimes;
+    batchEvaluationTimes.push_back( evaluationTimes.at( 10 ) );
+    batchEvaluationTimes.push_back( dataTimes.at( 0 ) - 30.0 );
+    batchEvaluationTimes.push_back( dataTimes.at( numberOfEpochs - 1 ) + 30.0 );
+    std::vector< Eigen::MatrixXd > batchMatrices;
+    compactInterface.getFullCombinedStateTransitionAndSensitivityMatrices( batchEvaluationTimes, batchMatrices );
+    BOOST_CHECK_EQUAL( batchMatrices.size( ), batchEvaluationTimes.size( ) );
+    Eigen::MatrixXd referenceCompactMatrix;
+    for( unsigned int i = 0; i < batchEvaluationTimes.size( ); i++ )
+    {
+        Eigen::MatrixXd compactMatrix = compactInterface.getCombinedStateTransitionAndSensitivityMatrix( batchEvaluationTimes.at( i ) );
+        compactInterface.getCombinedStateTransitionAndSensitivityMatrix( batchEvaluationTimes.at( i ), referenceCompactMatrix );
+        for( int j = 0; j < stateTransitionMatrixSize; j++ )
+        {
+            for( int k = 0; k < stateTransitionMatrixSize + sensitivityMatrixSize; k++ )
+            {
+                BOOST_CHECK_EQUAL( batchMatrices.at( i )( j, k ), compactMatrix( j, k ) );
+                BOOST_CHECK_EQUAL( referenceCompactMatrix( j, k ), compactMatrix( j, k ) );
+            }
+        }
+    }
+
+    // Check that cubic polynomials are reproduced exactly, also near (and beyond) the boundaries
+    std::map< double, Eigen::MatrixXd > polynomialStateTransitionSolution;
+    std::map< double, Eigen::MatrixXd > polynomialSensitivitySolution;
+    for( auto it : stateTransitionSolution )
+    {
+        double normalizedTime = ( it.first - 1.0E5 ) / 1.0E4;
+        polynomialStateTransitionSolution[ it.first ] = Eigen::MatrixXd::Constant(
+                    stateTransitionMatrixSize, stateTransitionMatrixSize,
+                    1.0 - 2.0 * normalizedTime + 0.5 * normalizedTime * normalizedTime - std::pow( normalizedTime, 3 ) );
+        polynomialSensitivitySolution[ it.first ] = Eigen::MatrixXd::Zero( stateTransitionMatrixSize, 0 );
+    }
+    CompactStateTransitionMatrixHistory polynomialMatrixHistory(
+                polynomialStateTransitionSolution, polynomialSensitivitySolution );
+    Eigen::MatrixXd polynomialMatrix = Eigen::MatrixXd::Zero( stateTransitionMatrixSize, stateTransitionMatrixSize );
+    Eigen::MatrixXd emptyMatrix = Eigen::MatrixXd::Zero( stateTransitionMatrixSize, 0 );
+    std::vector< double > polynomialEvaluationTimes =
+    { dataTimes.at( 0 ) - 100.0, dataTimes.at( 0 ) + 10.0, dataTimes.at( 1 ) + 10.0,
+      dataTimes.at( numberOfEpochs - 2 ) + 10.0, dataTimes.at( numberOfEpochs - 1 ) + 100.0 };
+    for( unsigned int i = 0; i < polynomialEvaluationTimes.size( ); i++ )
+    {
+        double normalizedTime = ( polynomialEvaluationTimes.at( i ) - 1.0E5 ) / 1.0E4;
+        polynomialMatrixHistory.interpolate( polynomialEvaluationTimes.at( i ), polynomialMatrix, emptyMatrix );
+        BOOST_CHECK_SMALL( std::fabs( polynomialMatrix( 3, 4 ) - (
+                                          1.0 - 2.0 * normalizedTime + 0.5 * normalizedTime * normalizedTime - std::pow( normalizedTime, 3 ) ) ),
+                           1.0E-12 );
+    }
+
+    // Check that inconsistent input is rejected
+    std::map< double, Eigen::MatrixXd > shortSensitivitySolution = sensitivitySolution;
+    shortSensitivitySolution.erase( shortSensitivitySolution.begin( ) );
+    bool isExceptionCaught = false;
+    try
+    {
+        CompactStateTransitionMatrixHistory invalidMatrixHistory( stateTransitionSolution, shortSensitivitySolution );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test use of compact matrix history through the single-arc variational equations solver, by comparing to the matrix
+//! history and interpolators of a solver using the default settings
+BOOST_AUTO_TEST_CASE( testCompactStateTransitionMatrixHistoryInSolver )
+{
+    double initialEphemerisTime = 0.0;
+    double finalEphemerisTime = 3.0 * 3600.0;
+    double earthGravitationalParameter = 3.986004418E14;
+
+    // Create Earth (with constant state and point-mass gravity field) and vehicle
+    SystemOfBodies bodies = SystemOfBodies( "Earth", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            [ = ]( ){ return Eigen::Vector6d::Zero( ); } ) );
+    bodies.at( "Earth" )->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+    bodies.createEmptyBody( "Vehicle" );
+
+    // Set accelerations on Vehicle that are to be taken into account.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >(
+                                                         basic_astrodynamics::point_mass_gravity ) );
+    std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    // Set initial state
+    Eigen::Vector6d vehicleInitialStateInKeplerianElements;
+    vehicleInitialStateInKeplerianElements( semiMajorAxisIndex ) = 7500.0E3;
+    vehicleInitialStateInKeplerianElements( eccentricityIndex ) = 0.1;
+    vehicleInitialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 85.3 );
+    vehicleInitialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 235.7 );
+    vehicleInitialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+    vehicleInitialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 139.87 );
+    Eigen::VectorXd initialState = convertKeplerianToCartesianElements(
+                vehicleInitialStateInKeplerianElements, earthGravitationalParameter );
+
+    std::map< double, Eigen::MatrixXd > referenceStateTransitionSolution;
+    std::map< double, Eigen::MatrixXd > referenceSensitivitySolution;
+    std::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > referenceInterface;
+    for( unsigned int useCompactHistory = 0; useCompactHistory < 2; useCompactHistory++ )
+    {
+        // Create propagator settings (without clearing numerical solution)
+        std::shared_ptr< TranslationalStatePropagatorSettings< double, double > > propagatorSettings =
+                translationalStatePropagatorSettings< double, double >(
+                    centralBodies, accelerationModelMap, bodiesToIntegrate, initialState, initialEphemerisTime,
+                    std::make_shared< IntegratorSettings< double > >( rungeKutta4, initialEphemerisTime, 30.0 ),
+                    propagationTimeTerminationSettings( finalEphemerisTime ) );
+        propagatorSettings->getOutputSettings( )->setClearNumericalSolutions( false );
+
+        // Define parameters.
+        std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+                getInitialStateParameterSettings< double >( propagatorSettings, bodies );
+        parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+                createParametersToEstimate( parameterNames, bodies );
+
+        // Propagate variational equations
+        SingleArcVariationalEquationsSolver< double, double > variationalEquationsSolver(
+                    bodies, propagatorSettings, parametersToEstimate, true, false );
+        variationalEquationsSolver.setCompactMatrixHistorySettings( useCompactHistory );
+        variationalEquationsSolver.integrateVariationalAndDynamicalEquations( propagatorSettings->getInitialStates( ), true );
+
+        std::shared_ptr< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface =
+                std::dynamic_pointer_cast< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
+                    variationalEquationsSolver.getStateTransitionMatrixInterface( ) );
+        std::shared_ptr< SingleArcVariationalSimulationResults< double, double > > variationalResults =
+                variationalEquationsSolver.getSingleArcVariationalPropagationResults( );
+
+        if( !useCompactHistory )
+        {
+            // Retrieve matrix history and interface that use default settings
+            BOOST_CHECK_EQUAL( stateTransitionInterface->getCompactMatrixHistory( ) == nullptr, true );
+            referenceStateTransitionSolution = variationalResults->getStateTransitionSolution( );
+            referenceSensitivitySolution = variationalResults->getSensitivitySolution( );
+            referenceInterface = stateTransitionInterface;
+            BOOST_CHECK_EQUAL( referenceStateTransitionSolution.size( ) > 0, true );
+        }
+        else
+        {
+            // Check that matrix history is only stored in compact history
+            BOOST_CHECK_EQUAL( stateTransitionInterface->getCompactMatrixHistory( ) != nullptr, true );
+            BOOST_CHECK_EQUAL( variationalResults->getStateTransitionSolution( ).size( ), 0 );
+            BOOST_CHECK_EQUAL( variationalResults->getSensitivitySolution( ).size( ), 0 );
+
+            std::vector< double > dataTimes = stateTransitionInterface->getCompactMatrixHistory( )->getTimes( );
+            BOOST_CHECK_EQUAL( dataTimes.size( ), referenceStateTransitionSolution.size( ) );
+
+            // Compare at data points with map of reference solution, and in between data points with reference interface,
+            // using single, by-reference and batch evaluation
+            std::vector< double > evaluationTimes;
+            for( unsigned int i = 2; i < dataTimes.size( ) - 3; i++ )
+            {
+                evaluationTimes.push_back( dataTimes.at( i ) );
+                evaluationTimes.push_back( dataTimes.at( i ) + 0.37 * ( dataTimes.at( i + 1 ) - dataTimes.at( i ) ) );
+            }
+
+            std::vector< Eigen::MatrixXd > batchMatrices;
+            stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrices( evaluationTimes, batchMatrices, false );
+            Eigen::MatrixXd compactMatrixByReference;
+            for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+            {
+                Eigen::MatrixXd compactMatrix =
+                        stateTransitionInterface->getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ), false );
+                stateTransitionInterface->getFullCombinedStateTransitionAndSensitivityMatrix(
+                            evaluationTimes.at( i ), compactMatrixByReference, false );
+                Eigen::MatrixXd referenceMatrix =
+                        referenceInterface->getCombinedStateTransitionAndSensitivityMatrix( evaluationTimes.at( i ), false );
+
+                if( i % 2 == 0 )
+                {
+                    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                                compactMatrix.block( 0, 0, 6, 6 ),
+                                referenceStateTransitionSolution.at( evaluationTimes.at( i ) ), 1.0E-14 );
+                    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                                compactMatrix.block( 0, 6, 6, 1 ),
+                                referenceSensitivitySolution.at( evaluationTimes.at( i ) ), 1.0E-14 );
+                }
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( compactMatrix, referenceMatrix, 1.0E-10 );
+
+                for( int j = 0; j < 6; j++ )
+                {
+                    for( int k = 0; k < 7; k++ )
+                    {
+                        BOOST_CHECK_EQUAL( compactMatrixByReference( j, k ), compactMatrix( j, k ) );
+                        BOOST_CHECK_EQUAL( batchMatrices.at( i )( j, k ), compactMatrix( j, k ) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//! Test block-wise evaluation of product of state partial matrix and state transition/sensitivity matrices, by comparing
+//! to dense product, for structure of three translational and one rotational propagated body
+BOOST_AUTO_TEST_CASE( testVariationalMatrixProductBlocks )
+{
+    const int numberOfTranslationalBodies = 3;
+    const int matrixSize = 6 * numberOfTranslationalBodies + 7;
+    const int rotationalStartIndex = 6 * numberOfTranslationalBodies;
+    const int numberOfParameterValues = matrixSize + 4;
+
+    // Set blocks of rows (as in VariationalEquations), and structure of state partial matrix
+    std::vector< VariationalMatrixProductBlock > rowBlocks;
+    Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic > nonZeroEntries =
+            Eigen::Matrix< bool, Eigen::Dynamic, Eigen::Dynamic >::Constant( matrixSize, matrixSize, false );
+    for( int i = 0; i < numberOfTranslationalBodies; i++ )
+    {
+        rowBlocks.push_back( VariationalMatrixProductBlock( 6 * i, 3 ) );
+        rowBlocks.back( ).identityStartColumn_ = 6 * i + 3;
+        rowBlocks.push_back( VariationalMatrixProductBlock( 6 * i + 3, 3 ) );
+
+        // Kinematic rows: derivative of position w.r.t. velocity
+        nonZeroEntries.block( 6 * i, 6 * i + 3, 3, 3 ).diagonal( ).setConstant( true );
+
+        // Dynamic rows: accelerations depend on positions of all bodies, own velocity and rotational state
+        for( int j = 0; j < numberOfTranslationalBodies; j++ )
+        {
+            nonZeroEntries.block( 6 * i + 3, 6 * j, 3, 3 ).setConstant( true );
+        }
+        nonZeroEntries.block( 6 * i + 3, 6 * i + 3, 3, 3 ).setConstant( true );
+        nonZeroEntries.block( 6 * i + 3, rotationalStartIndex, 3, 4 ).setConstant( true );
+    }
+
+    // Add non-identity partial to kinematic rows of final translational body
+    nonZeroEntries( 6 * ( numberOfTranslationalBodies - 1 ), 0 ) = true;
+
+    rowBlocks.push_back( VariationalMatrixProductBlock( rotationalStartIndex, 4 ) );
+    rowBlocks.push_back( VariationalMatrixProductBlock( rotationalStartIndex + 4, 3 ) );
+    nonZeroEntries.block( rotationalStartIndex, rotationalStartIndex, 4, 7 ).setConstant( true );
+    nonZeroEntries.block( rotationalStartIndex + 4, rotationalStartIndex, 3, 7 ).setConstant( true );
+    nonZeroEntries.block( rotationalStartIndex + 4, 0, 3, 3 ).setConstant( true );
+
+    // Create state partial matrix with random values for all structurally non-zero entries
+    std::srand( 42 );
+    Eigen::MatrixXd statePartialMatrix = Eigen::MatrixXd::Random( matrixSize, matrixSize );
+    for( int i = 0; i < matrixSize; i++ )
+    {
+        for( int j = 0; j < matrixSize; j++ )
+        {
+            if( !nonZeroEntries( i, j ) )
+            {
+                statePartialMatrix( i, j ) = 0.0;
+            }
+        }
+    }
+    for( int i = 0; i < numberOfTranslationalBodies - 1; i++ )
+    {
+        statePartialMatrix.block( 6 * i, 6 * i + 3, 3, 3 ).setIdentity( );
+    }
+    Eigen::MatrixXd stateTransitionAndSensitivityMatrices = Eigen::MatrixXd::Random( matrixSize, numberOfParameterValues );
+    Eigen::MatrixXd denseProduct = statePartialMatrix * stateTransitionAndSensitivityMatrices;
+
+    // Check structure of product blocks
+    std::vector< VariationalMatrixProductBlock > productBlocks =
+            createVariationalMatrixProductBlocks( rowBlocks, nonZeroEntries );
+    BOOST_CHECK_EQUAL( productBlocks.size( ), rowBlocks.size( ) );
+    for( int i = 0; i < numberOfTranslationalBodies; i++ )
+    {
+        if( i < numberOfTranslationalBodies - 1 )
+        {
+            // Identity block is retained, and rows are copied
+            BOOST_CHECK_EQUAL( productBlocks.at( 2 * i ).identityStartColumn_, 6 * i + 3 );
+        }
+        else
+        {
+            // Identity block is rejected when other partials are present
+            BOOST_CHECK_EQUAL( productBlocks.at( 2 * i ).identityStartColumn_, -1 );
+            BOOST_CHECK_EQUAL( productBlocks.at( 2 * i ).nonZeroColumnRanges_.size( ), 2 );
+        }
+    }
+
+    // Adjacent columns (position and velocity of first body, position of second body) are merged into a single range,
+    // followed by position of third body and rotational state
+    BOOST_CHECK_EQUAL( productBlocks.at( 1 ).nonZeroColumnRanges_.size( ), 3 );
+    BOOST_CHECK_EQUAL( productBlocks.at( 1 ).nonZeroColumnRanges_.at( 0 ).first, 0 );
+    BOOST_CHECK_EQUAL( productBlocks.at( 1 ).nonZeroColumnRanges_.at( 0 ).second, 9 );
+    BOOST_CHECK_EQUAL( productBlocks.at( 1 ).nonZeroColumnRanges_.at( 1 ).first, 12 );
+    BOOST_CHECK_EQUAL( productBlocks.at( 1 ).nonZeroColumnRanges_.at( 1 ).second, 3 );
+    BOOST_CHECK_EQUAL( productBlocks.at( 1 ).nonZeroColumnRanges_.at( 2 ).first, rotationalStartIndex );
+    BOOST_CHECK_EQUAL( productBlocks.at( 1 ).nonZeroColumnRanges_.at( 2 ).second, 4 );
+
+    // Check that inconsistent blocks of rows (overlapping, or not covering all rows) result in single dense block
+    std::vector< std::vector< VariationalMatrixProductBlock > > inconsistentRowBlocks;
+    inconsistentRowBlocks.push_back( rowBlocks );
+    inconsistentRowBlocks.back( ).pop_back( );
+    inconsistentRowBlocks.push_back( rowBlocks );
+    inconsistentRowBlocks.back( ).push_back( VariationalMatrixProductBlock( 2, 3 ) );
+    inconsistentRowBlocks.push_back( rowBlocks );
+    inconsistentRowBlocks.back( ).back( ).numberOfRows_ = 4;
+
+    std::vector< std::vector< VariationalMatrixProductBlock > > productBlocksToTest = { productBlocks };
+    for( unsigned int i = 0; i < inconsistentRowBlocks.size( ); i++ )
+    {
+        productBlocksToTest.push_back( createVariationalMatrixProductBlocks( inconsistentRowBlocks.at( i ), nonZeroEntries ) );
+        BOOST_CHECK_EQUAL( productBlocksToTest.back( ).size( ), 1 );
+        BOOST_CHECK_EQUAL( productBlocksToTest.back( ).at( 0 ).numberOfRows_, matrixSize );
+        BOOST_CHECK_EQUAL( productBlocksToTest.back( ).at( 0 ).nonZeroColumnRanges_.size( ), 1 );
+    }
+
+    // Compare block-wise and dense product
+    for( unsigned int i = 0; i < productBlocksToTest.size( ); i++ )
+    {
+        Eigen::MatrixXd blockProduct = Eigen::MatrixXd::Constant( matrixSize, numberOfParameterValues, TUDAT_NAN );
+        multiplyStatePartialMatrixFromProductBlocks< double >(
+                    productBlocksToTest.at( i ), statePartialMatrix, stateTransitionAndSensitivityMatrices,
+                    blockProduct.block( 0, 0, matrixSize, numberOfParameterValues ) );
+        for( int j = 0; j < matrixSize; j++ )
+        {
+            for( int k = 0; k < numberOfParameterValues; k++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( blockProduct( j, k ) - denseProduct( j, k ) ), 1.0E-14 * matrixSize );
+            }
+        }
+
+        // Rows computed from identity block are copied exactly
+        if( i == 0 )
+        {
+            BOOST_CHECK( blockProduct.block( 0, 0, 3, numberOfParameterValues ) ==
+                         stateTransitionAndSensitivityMatrices.block( 3, 0, 3, numberOfParameterValues ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,613 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <set>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Geometry>
+
+#include "tudat/astro/ephemerides/nativeSpiceEphemeris.h"
+#include "tudat/basics/testMacros.h"
+#include "tudat/interface/spice/spiceInterface.h"
+#include "tudat/io/memoryMappedFile.h"
+#include "tudat/io/spiceKernelReader.h"
+#include "tudat/paths.hpp"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace input_output;
+
+//! Segment that is to be written to a test DAF file
+struct TestDafSegment
+{
+    std::vector< int > integerComponents;
+    double startEpoch;
+    double endEpoch;
+    std::vector< double > data;
+};
+
+//! Function to write a (single summary record) SPK or binary PCK file, for testing
+void writeTestDafFile( const std::string& fileName, const bool isPck, const std::vector< TestDafSegment >& segments )
+{
+    const int recordSize = 1024;
+    const int numberOfIntegerComponents = isPck ? 5 : 6;
+
+    // Segment data starts after file record, summary record and name record
+    std::vector< char > fileData( 3 * recordSize, ' ' );
+    std::vector< double > segmentData;
+    int currentAddress = 3 * recordSize / 8 + 1;
+
+    std::vector< char > summaryRecord( recordSize, 0 );
+    double summaryControl[ 3 ] = { 0.0, 0.0, static_cast< double >( segments.size( ) ) };
+    std::memcpy( summaryRecord.data( ), summaryControl, sizeof( summaryControl ) );
+    for( unsigned int i = 0; i < segments.size( ); i++ )
+    {
+        char* summary = summaryRecord.data( ) + ( 3 + i * 5 ) * 8;
+        double epochs[ 2 ] = { segments.at( i ).startEpoch, segments.at( i ).endEpoch };
+        std::memcpy( summary, epochs, sizeof( epochs ) );
+
+        std::vector< int32_t > integers( segments.at( i ).integerComponents.begin( ),
+                                         segments.at( i ).integerComponents.end( ) );
+        integers.push_back( currentAddress );
+        integers.push_back( currentAddress + segments.at( i ).data.size( ) - 1 );
+        BOOST_CHECK_EQUAL( integers.size( ), numberOfIntegerComponents );
+        std::memcpy( summary + 16, integers.data( ), integers.size( ) * sizeof( int32_t ) );
+
+        segmentData.insert( segmentData.end( ), segments.at( i ).data.begin( ), segments.at( i ).data.end( ) );
+        currentAddress += segments.at( i ).data.size( );
+    }
+    std::memcpy( fileData.data( ) + recordSize, summaryRecord.data( ), recordSize );
+
+    // Create file record
+    const uint16_t endiannessTest = 1;
+    const bool isLittleEndianMachine = ( *reinterpret_cast< const unsigned char* >( &endiannessTest ) == 1 );
+    std::memcpy( fileData.data( ), isPck ? "DAF/PCK " : "DAF/SPK ", 8 );
+    int32_t fileRecordIntegers[ 2 ] = { 2, numberOfIntegerComponents };
+    std::memcpy( fileData.data( ) + 8, fileRecordIntegers, 8 );
+    int32_t recordPointers[ 3 ] = { 2, 2, currentAddress };
+    std::memcpy( fileData.data( ) + 76, recordPointers, 12 );
+    std::memcpy( fileData.data( ) + 88, isLittleEndianMachine ? "LTL-IEEE" : "BIG-IEEE", 8 );
+
+    std::ofstream fileStream( fileName, std::ios::binary );
+    fileStream.write( fileData.data( ), fileData.size( ) );
+    fileStream.write( reinterpret_cast< const char* >( segmentData.data( ) ), segmentData.size( ) * sizeof( double ) );
+}
+
+//! Function to evaluate a cubic Chebyshev series and its derivative w.r.t. the normalized time directly
+Eigen::Vector2d evaluateCubicChebyshevSeries( const double* coefficients, const double normalizedTime )
+{
+    const double s = normalizedTime;
+    return ( Eigen::Vector2d( ) <<
+             coefficients[ 0 ] + coefficients[ 1 ] * s + coefficients[ 2 ] * ( 2.0 * s * s - 1.0 ) +
+             coefficients[ 3 ] * ( 4.0 * s * s * s - 3.0 * s ),
+             coefficients[ 1 ] + coefficients[ 2 ] * 4.0 * s + coefficients[ 3 ] * ( 12.0 * s * s - 3.0 ) ).finished( );
+}
+
+//! Function to create a type 2 or 3 segment, with cubic Chebyshev polynomials with coefficients depending on the record
+TestDafSegment createChebyshevSegment( const std::vector< int >& integerComponents, const int dataType,
+                                       const double initialEpoch, const double intervalLength, const int numberOfRecords )
+{
+    const int numberOfComponents = ( dataType == 2 ) ? 3 : 6;
+    TestDafSegment segment;
+    segment.integerComponents = integerComponents;
+    segment.startEpoch = initialEpoch;
+    segment.endEpoch = initialEpoch + numberOfRecords * intervalLength;
+    for( int i = 0; i < numberOfRecords; i++ )
+    {
+        segment.data.push_back( initialEpoch + ( i + 0.5 ) * intervalLength );
+        segment.data.push_back( 0.5 * intervalLength );
+        for( int j = 0; j < numberOfComponents * 4; j++ )
+        {
+            segment.data.push_back( 0.1 * ( j + 1 ) * ( i + 1 ) * ( ( j % 3 == 0 ) ? -1.0 : 1.0 ) );
+        }
+    }
+    segment.data.push_back( initialEpoch );
+    segment.data.push_back( intervalLength );
+    segment.data.push_back( 2 + numberOfComponents * 4 );
+    segment.data.push_back( numberOfRecords );
+    return segment;
+}
+
+//! Polynomial motion used to create type 13 and 21 test segments
+Eigen::Vector6d getPolynomialTestState( const double time )
+{
+    const double t = time / 1.0E4;
+    Eigen::Vector6d state;
+    for( int i = 0; i < 3; i++ )
+    {
+        state( i ) = 1.0E3 * ( i + 1 ) + 2.0 * t - 0.3 * ( i + 1 ) * t * t + 0.05 * t * t * t;
+        state( i + 3 ) = ( 2.0 - 0.6 * ( i + 1 ) * t + 0.15 * t * t ) / 1.0E4;
+    }
+    return state;
+}
+
+//! Function to compare all SPK segments of supported type in a kernel file with their evaluation by CSPICE (spkpvn_c)
+/*!
+ *  Function to compare all SPK segments of supported type in a kernel file with their evaluation by CSPICE. The
+ *  segments are enumerated using the CSPICE DAF routines, and each segment is evaluated both natively and by spkpvn_c
+ *  (which evaluates a single segment), at its boundaries and at a number of epochs inside it.
+ *  \param fileName Name of the SPK file
+ *  \param comparedTypes Segment types that were compared (types are added to this set)
+ *  \return Number of compared segments
+ */
+int compareSpkSegmentsWithSpice( const std::string& fileName, std::set< int >& comparedTypes )
+{
+    MemoryMappedFile kernelFile( fileName );
+
+    SpiceInt handle;
+    dafopr_c( fileName.c_str( ), &handle );
+    dafbfs_c( handle );
+
+    int numberOfComparedSegments = 0;
+    SpiceBoolean segmentFound;
+    daffna_c( &segmentFound );
+    while( segmentFound )
+    {
+        SpiceDouble descriptor[ 5 ];
+        SpiceDouble doubleComponents[ 2 ];
+        SpiceInt integerComponents[ 6 ];
+        dafgs_c( descriptor );
+        dafus_c( descriptor, 2, 6, doubleComponents, integerComponents );
+
+        const int dataType = integerComponents[ 3 ];
+        if( dataType == 1 || dataType == 2 || dataType == 3 || dataType == 13 || dataType == 21 )
+        {
+            SpiceKernelSegment segment(
+                        kernelFile.getData( ), fileName, false, integerComponents[ 0 ], integerComponents[ 1 ],
+                        integerComponents[ 2 ], dataType, doubleComponents[ 0 ], doubleComponents[ 1 ],
+                        integerComponents[ 4 ], integerComponents[ 5 ] );
+
+            const int numberOfTestEpochs = 25;
+            for( int i = 0; i <= numberOfTestEpochs; i++ )
+            {
+                double testEpoch = doubleComponents[ 0 ] + ( doubleComponents[ 1 ] - doubleComponents[ 0 ] ) *
+                        static_cast< double >( i ) / static_cast< double >( numberOfTestEpochs );
+                if( i > 0 && i < numberOfTestEpochs )
+                {
+                    testEpoch += 0.3183 * ( doubleComponents[ 1 ] - doubleComponents[ 0 ] ) / numberOfTestEpochs;
+                }
+
+                Eigen::Vector6d nativeState;
+                segment.evaluate( testEpoch, nativeState.data( ) );
+
+                SpiceInt spiceFrameId, spiceCenterId;
+                Eigen::Vector6d spiceState;
+                spkpvn_c( handle, descriptor, testEpoch, &spiceFrameId, spiceState.data( ), &spiceCenterId );
+                BOOST_CHECK_EQUAL( spiceFrameId, segment.getFrameId( ) );
+                BOOST_CHECK_EQUAL( spiceCenterId, segment.getCenterId( ) );
+
+                // Check agreement to round-off
+                BOOST_CHECK_SMALL( ( nativeState - spiceState ).segment( 0, 3 ).norm( ),
+                                   1.0E-14 * spiceState.segment( 0, 3 ).norm( ) );
+                BOOST_CHECK_SMALL( ( nativeState - spiceState ).segment( 3, 3 ).norm( ),
+                                   1.0E-13 * spiceState.segment( 3, 3 ).norm( ) );
+            }
+            comparedTypes.insert( dataType );
+            numberOfComparedSegments++;
+        }
+        daffna_c( &segmentFound );
+    }
+    dafcls_c( handle );
+
+    return numberOfComparedSegments;
+}
+
+BOOST_AUTO_TEST_SUITE( test_native_spice_kernels )
+
+//! Test evaluation of all supported segment types against the analytical functions from which they were created
+BOOST_AUTO_TEST_CASE( testNativeSpiceKernelSegmentTypes )
+{
+    const std::string spkFileName = "nativeSpiceKernelTest.bsp";
+    const std::string pckFileName = "nativeSpiceKernelTest.bpc";
+
+    std::vector< TestDafSegment > spkSegments;
+
+    // Type 2 segment for body 1001 w.r.t. SSB, and type 3 segment for body 1002 w.r.t. body 1001 (in ECLIPJ2000)
+    spkSegments.push_back( createChebyshevSegment( { 1001, 0, 1, 2 }, 2, -1.0E5, 2.0E4, 10 ) );
+    spkSegments.push_back( createChebyshevSegment( { 1002, 1001, 17, 3 }, 3, -1.0E5, 5.0E4, 4 ) );
+
+    // Type 13 segment (window size 4) for body 1003 w.r.t. body 1001, with unequal steps, from cubic motion
+    {
+        TestDafSegment segment;
+        segment.integerComponents = { 1003, 1001, 1, 13 };
+        std::vector< double > epochs;
+        for( int i = 0; i < 250; i++ )
+        {
+            epochs.push_back( -1.0E5 + 1000.0 * i + 300.0 * ( i % 2 ) );
+        }
+        for( unsigned int i = 0; i < epochs.size( ); i++ )
+        {
+            Eigen::Vector6d state = getPolynomialTestState( epochs.at( i ) );
+            segment.data.insert( segment.data.end( ), state.data( ), state.data( ) + 6 );
+        }
+        segment.data.insert( segment.data.end( ), epochs.begin( ), epochs.end( ) );
+        segment.data.push_back( epochs.at( 100 ) );
+        segment.data.push_back( epochs.at( 200 ) );
+        segment.data.push_back( 3.0 );
+        segment.data.push_back( epochs.size( ) );
+        segment.startEpoch = epochs.front( );
+        segment.endEpoch = epochs.back( );
+        spkSegments.push_back( segment );
+    }
+
+    // Type 21 segment for body 1004 w.r.t. body 1001, with difference lines representing cubic motion
+    {
+        TestDafSegment segment;
+        segment.integerComponents = { 1004, 1001, 1, 21 };
+        const int maximumDimension = 25;
+        const int numberOfRecords = 20;
+        std::vector< double > finalEpochs;
+        for( int i = 0; i < numberOfRecords; i++ )
+        {
+            double referenceEpoch = -1.0E5 + 1.0E4 * i;
+            double stepSize = 2.0E4;
+            Eigen::Vector6d referenceState = getPolynomialTestState( referenceEpoch );
+
+            std::vector< double > record( 4 * maximumDimension + 11, 0.0 );
+            record[ 0 ] = referenceEpoch;
+            record[ 1 ] = stepSize;
+            for( int j = 0; j < 3; j++ )
+            {
+                double t = referenceEpoch / 1.0E4;
+                record[ maximumDimension + 1 + 2 * j ] = referenceState( j );
+                record[ maximumDimension + 2 + 2 * j ] = referenceState( j + 3 );
+                record[ maximumDimension + 7 + j * maximumDimension ] = ( -0.6 * ( j + 1 ) + 0.3 * t ) / 1.0E8;
+                record[ maximumDimension + 8 + j * maximumDimension ] = 0.3 / 1.0E12 * stepSize;
+                record[ 4 * maximumDimension + 8 + j ] = 2;
+            }
+            record[ 4 * maximumDimension + 7 ] = 3;
+            segment.data.insert( segment.data.end( ), record.begin( ), record.end( ) );
+            finalEpochs.push_back( referenceEpoch + 1.0E4 );
+        }
+        segment.data.insert( segment.data.end( ), finalEpochs.begin( ), finalEpochs.end( ) );
+        segment.data.push_back( maximumDimension );
+        segment.data.push_back( numberOfRecords );
+        segment.startEpoch = -1.0E5;
+        segment.endEpoch = finalEpochs.back( );
+        spkSegments.push_back( segment );
+    }
+
+    // Type 2 segments with overlapping coverage for body 1005; the second (later) segment has priority
+    spkSegments.push_back( createChebyshevSegment( { 1005, 0, 1, 2 }, 2, -1.0E5, 2.0E4, 10 ) );
+    spkSegments.push_back( createChebyshevSegment( { 1005, 0, 1, 2 }, 2, -5.0E4, 1.0E4, 5 ) );
+    writeTestDafFile( spkFileName, false, spkSegments );
+
+    // Type 2 PCK segment for frame class 3000 w.r.t. J2000
+    std::vector< TestDafSegment > pckSegments;
+    pckSegments.push_back( createChebyshevSegment( { 3000, 1, 2 }, 2, -1.0E5, 2.0E4, 10 ) );
+    writeTestDafFile( pckFileName, true, pckSegments );
+
+    std::shared_ptr< SpiceKernelCollection > kernels = std::make_shared< SpiceKernelCollection >(
+                std::vector< std::string >( { spkFileName, pckFileName } ) );
+    BOOST_CHECK_EQUAL( kernels->getKernelFiles( ).at( 0 )->getSegments( ).size( ), 6 );
+    BOOST_CHECK_EQUAL( kernels->getKernelFiles( ).at( 1 )->isOrientationKernel( ), true );
+    BOOST_CHECK_EQUAL( kernels->hasEphemerisData( 1004 ), true );
+    BOOST_CHECK_EQUAL( kernels->hasEphemerisData( 1006 ), false );
+    BOOST_CHECK_EQUAL( kernels->hasOrientationData( 3000 ), true );
+
+    const Eigen::Matrix3d eclipticToJ2000 = getRotationFromJ2000ToSpiceInertialFrame( spiceEclipJ2000FrameId ).transpose( );
+    for( int k = 0; k < 37; k++ )
+    {
+        const double testTime = -9.9E4 + 5.3E3 * k;
+
+        // Check type 2 segment
+        Eigen::Vector6d state1001 = kernels->getCartesianState( 1001, 0, testTime );
+        {
+            const TestDafSegment& segment = spkSegments.at( 0 );
+            int recordIndex = std::min( static_cast< int >( ( testTime + 1.0E5 ) / 2.0E4 ), 9 );
+            const double* record = segment.data.data( ) + recordIndex * 14;
+            for( int i = 0; i < 3; i++ )
+            {
+                Eigen::Vector2d expected = evaluateCubicChebyshevSeries(
+                            record + 2 + 4 * i, ( testTime - record[ 0 ] ) / record[ 1 ] );
+                BOOST_CHECK_SMALL( state1001( i ) - expected( 0 ), 1.0E-13 * std::fabs( expected( 0 ) ) + 1.0E-14 );
+                BOOST_CHECK_SMALL( state1001( i + 3 ) - expected( 1 ) / record[ 1 ],
+                                   1.0E-13 * std::fabs( expected( 1 ) / record[ 1 ] ) + 1.0E-18 );
+            }
+        }
+
+        // Check type 3 segment (in ECLIPJ2000 frame), relative to its center
+        Eigen::Vector6d state1002 = kernels->getCartesianState( 1002, 1001, testTime, spiceEclipJ2000FrameId );
+        {
+            const TestDafSegment& segment = spkSegments.at( 1 );
+            int recordIndex = std::min( static_cast< int >( ( testTime + 1.0E5 ) / 5.0E4 ), 3 );
+            const double* record = segment.data.data( ) + recordIndex * 26;
+            for( int i = 0; i < 6; i++ )
+            {
+                Eigen::Vector2d expected = evaluateCubicChebyshevSeries(
+                            record + 2 + 4 * i, ( testTime - record[ 0 ] ) / record[ 1 ] );
+                BOOST_CHECK_SMALL( state1002( i ) - expected( 0 ), 1.0E-13 * std::fabs( expected( 0 ) ) + 1.0E-14 );
+            }
+        }
+
+        // Check state w.r.t. SSB in J2000, combining type 2 and 3 segments
+        Eigen::Vector6d state1002FromBarycenter = kernels->getCartesianState( 1002, 0, testTime );
+        Eigen::Vector6d expectedState1002FromBarycenter = state1001;
+        expectedState1002FromBarycenter.segment( 0, 3 ) += eclipticToJ2000 * state1002.segment( 0, 3 );
+        expectedState1002FromBarycenter.segment( 3, 3 ) += eclipticToJ2000 * state1002.segment( 3, 3 );
+        BOOST_CHECK_SMALL( ( state1002FromBarycenter - expectedState1002FromBarycenter ).segment( 0, 3 ).norm( ),
+                           1.0E-14 * expectedState1002FromBarycenter.segment( 0, 3 ).norm( ) );
+        BOOST_CHECK_SMALL( ( state1002FromBarycenter - expectedState1002FromBarycenter ).segment( 3, 3 ).norm( ),
+                           1.0E-14 * expectedState1002FromBarycenter.segment( 3, 3 ).norm( ) );
+
+        // Check type 13 and 21 segments, which reproduce cubic motion exactly
+        Eigen::Vector6d expectedPolynomialState = getPolynomialTestState( testTime );
+        Eigen::Vector6d state1003 = kernels->getCartesianState( 1003, 1001, testTime );
+        Eigen::Vector6d state1004 = kernels->getCartesianState( 1004, 1001, testTime );
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( state1003( i ) - expectedPolynomialState( i ), 1.0E-11 );
+            BOOST_CHECK_SMALL( state1004( i ) - expectedPolynomialState( i ), 1.0E-11 );
+            BOOST_CHECK_SMALL( state1003( i + 3 ) - expectedPolynomialState( i + 3 ), 1.0E-14 );
+            BOOST_CHECK_SMALL( state1004( i + 3 ) - expectedPolynomialState( i + 3 ), 1.0E-14 );
+        }
+
+        // Check relative state of bodies with common center
+        Eigen::Vector6d state1003From1004 = kernels->getCartesianState( 1003, 1004, testTime );
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( state1003From1004( i ), 1.0E-11 );
+            BOOST_CHECK_SMALL( state1003From1004( i + 3 ), 1.0E-14 );
+        }
+
+        // Check segment priority
+        const TestDafSegment& prioritySegment = ( testTime >= -5.0E4 && testTime <= 0.0 ) ?
+                    spkSegments.at( 5 ) : spkSegments.at( 4 );
+        double recordLength = ( testTime >= -5.0E4 && testTime <= 0.0 ) ? 1.0E4 : 2.0E4;
+        double segmentStart = ( testTime >= -5.0E4 && testTime <= 0.0 ) ? -5.0E4 : -1.0E5;
+        int recordIndex = std::min( static_cast< int >( ( testTime - segmentStart ) / recordLength ),
+                                    static_cast< int >( prioritySegment.data.back( ) ) - 1 );
+        const double* record = prioritySegment.data.data( ) + recordIndex * 14;
+        BOOST_CHECK_CLOSE_FRACTION(
+                    kernels->getCartesianState( 1005, 0, testTime )( 0 ),
+                    evaluateCubicChebyshevSeries( record + 2, ( testTime - record[ 0 ] ) / record[ 1 ] )( 0 ), 1.0E-13 );
+
+        // Check orientation, as [w]_3 [delta]_1 [phi]_3 rotation of Chebyshev Euler angles
+        Eigen::Matrix3d rotationToFrame, rotationToFrameDerivative;
+        kernels->getRotationToBodyFixedFrame( 3000, testTime, rotationToFrame, rotationToFrameDerivative );
+        {
+            const TestDafSegment& segment = pckSegments.at( 0 );
+            int recordIndex = std::min( static_cast< int >( ( testTime + 1.0E5 ) / 2.0E4 ), 9 );
+            const double* record = segment.data.data( ) + recordIndex * 14;
+            double angles[ 3 ];
+            for( int i = 0; i < 3; i++ )
+            {
+                angles[ i ] = evaluateCubicChebyshevSeries( record + 2 + 4 * i, ( testTime - record[ 0 ] ) / record[ 1 ] )( 0 );
+            }
+            Eigen::Matrix3d expectedRotation =
+                    ( Eigen::AngleAxisd( -angles[ 2 ], Eigen::Vector3d::UnitZ( ) ) *
+                    Eigen::AngleAxisd( -angles[ 1 ], Eigen::Vector3d::UnitX( ) ) *
+                    Eigen::AngleAxisd( -angles[ 0 ], Eigen::Vector3d::UnitZ( ) ) ).toRotationMatrix( );
+            BOOST_CHECK_SMALL( ( rotationToFrame - expectedRotation ).norm( ), 5.0E-14 );
+        }
+
+        // Check orientation derivative with finite differences (away from record boundaries)
+        if( std::fabs( std::remainder( testTime, 2.0E4 ) ) > 100.0 )
+        {
+            Eigen::Matrix3d upperRotation, lowerRotation, dummyDerivative;
+            const double timeStep = 0.01;
+            kernels->getRotationToBodyFixedFrame( 3000, testTime + timeStep, upperRotation, dummyDerivative );
+            kernels->getRotationToBodyFixedFrame( 3000, testTime - timeStep, lowerRotation, dummyDerivative );
+            Eigen::Matrix3d numericalDerivative = ( upperRotation - lowerRotation ) / ( 2.0 * timeStep );
+            for( int i = 0; i < 3; i++ )
+            {
+                for( int j = 0; j < 3; j++ )
+                {
+                    BOOST_CHECK_SMALL( rotationToFrameDerivative( i, j ) - numericalDerivative( i, j ), 1.0E-10 );
+                }
+            }
+        }
+    }
+
+    // Check error for epochs outside coverage, and bodies without data
+    BOOST_CHECK_THROW( kernels->getCartesianState( 1001, 0, -1.1E5 ), std::runtime_error );
+    BOOST_CHECK_THROW( kernels->getCartesianState( 1006, 0, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( kernels->getCartesianState( 1001, 0, 0.0, 2 ), std::runtime_error );
+
+    // Check ephemeris and rotational ephemeris classes
+    ephemerides::NativeSpiceEphemeris ephemeris( kernels, 1002, 0, "SSB", "J2000" );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( ephemeris.getCartesianState( 1.0E3 ),
+                                       ( 1000.0 * kernels->getCartesianState( 1002, 0, 1.0E3 ) ), 1.0E-15 );
+    ephemerides::NativeSpiceRotationalEphemeris rotationalEphemeris( kernels, 3000, "ECLIPJ2000", "ITRF93" );
+    Eigen::Matrix3d rotationToFrame, rotationToFrameDerivative;
+    kernels->getRotationToBodyFixedFrame( 3000, 1.0E3, rotationToFrame, rotationToFrameDerivative );
+    BOOST_CHECK_SMALL( ( Eigen::Matrix3d( rotationalEphemeris.getRotationToTargetFrame( 1.0E3 ) ) -
+                         rotationToFrame * eclipticToJ2000 ).norm( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( rotationalEphemeris.getDerivativeOfRotationToBaseFrame( 1.0E3 ) -
+                         ( rotationToFrameDerivative * eclipticToJ2000 ).transpose( ) ).norm( ),
+                       1.0E-14 * rotationToFrameDerivative.norm( ) );
+
+    // Check concurrent evaluation from multiple threads
+    const int numberOfThreads = 4;
+    const int numberOfEvaluations = 1000;
+    std::vector< std::vector< Eigen::Vector6d > > threadStates(
+                numberOfThreads, std::vector< Eigen::Vector6d >( numberOfEvaluations ) );
+    std::vector< std::thread > threads;
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        threads.push_back( std::thread( [ & ]( const int threadIndex )
+        {
+            for( int j = 0; j < numberOfEvaluations; j++ )
+            {
+                threadStates[ threadIndex ][ j ] = kernels->getCartesianState( 1002 + j % 3, 0, -9.0E4 + 170.0 * j );
+            }
+        }, i ) );
+    }
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        threads.at( i ).join( );
+    }
+    for( int j = 0; j < numberOfEvaluations; j++ )
+    {
+        Eigen::Vector6d serialState = kernels->getCartesianState( 1002 + j % 3, 0, -9.0E4 + 170.0 * j );
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            BOOST_CHECK_EQUAL( ( threadStates[ i ][ j ] - serialState ).norm( ), 0.0 );
+        }
+    }
+
+    // Check that collections are shared
+    BOOST_CHECK_EQUAL( getSpiceKernelCollection( { spkFileName } ) == getSpiceKernelCollection( { spkFileName } ), true );
+
+    kernels.reset( );
+    std::remove( spkFileName.c_str( ) );
+    std::remove( pckFileName.c_str( ) );
+}
+
+//! Test native kernel reader against spkezr_c, using the standard planetary ephemeris kernel
+BOOST_AUTO_TEST_CASE( testNativeSpiceKernelsAgainstSpice )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::shared_ptr< SpiceKernelCollection > kernels = getSpiceKernelCollection(
+                { paths::getSpiceKernelPath( ) + "/inpop19a_TDB_m100_p100_spice.bsp" } );
+
+    std::vector< std::pair< std::string, std::string > > bodyPairs =
+    { { "Earth", "SSB" }, { "Moon", "Earth" }, { "Mars Barycenter", "Sun" }, { "Jupiter Barycenter", "Earth" } };
+    std::vector< std::string > frames = { "J2000", "ECLIPJ2000" };
+
+    for( unsigned int i = 0; i < bodyPairs.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < frames.size( ); j++ )
+        {
+            ephemerides::NativeSpiceEphemeris ephemeris(
+                        kernels,
+                        spice_interface::getSpkBodyIdFromName( bodyPairs.at( i ).first ),
+                        spice_interface::getSpkBodyIdFromName( bodyPairs.at( i ).second ),
+                        bodyPairs.at( i ).second, frames.at( j ) );
+            for( int k = 0; k < 20; k++ )
+            {
+                double testTime = -1.0E9 + 1.0E8 * k + 12345.6789 * k * k;
+                Eigen::Vector6d nativeState = ephemeris.getCartesianState( testTime );
+                Eigen::Vector6d spiceState = spice_interface::getBodyCartesianStateAtEpoch(
+                            bodyPairs.at( i ).first, bodyPairs.at( i ).second, frames.at( j ), "NONE", testTime );
+
+                // Check agreement to round-off
+                BOOST_CHECK_SMALL( ( nativeState - spiceState ).segment( 0, 3 ).norm( ),
+                                   1.0E-14 * spiceState.segment( 0, 3 ).norm( ) );
+                BOOST_CHECK_SMALL( ( nativeState - spiceState ).segment( 3, 3 ).norm( ),
+                                   1.0E-13 * spiceState.segment( 3, 3 ).norm( ) );
+            }
+        }
+    }
+}
+
+//! Test native evaluation of the individual segments of SPK kernels against spkpvn_c, using kernels from the test data
+BOOST_AUTO_TEST_CASE( testNativeSpiceKernelSegmentsAgainstSpice )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::set< int > comparedTypes;
+    std::vector< std::string > kernelFiles =
+    { paths::getSpiceKernelPath( ) + "/inpop19a_TDB_m100_p100_spice.bsp",
+      paths::getSpiceKernelPath( ) + "/codes_300ast_20100725.bsp",
+      paths::getSpiceKernelPath( ) + "/NOE-4-2020.bsp",
+      paths::getSpiceKernelPath( ) + "/juice_mat_crema_4_0_20220601_20330626_v01.bsp",
+      paths::getTudatTestDataPath( ) + "/grail_shortened.bsp",
+      paths::getTudatTestDataPath( ) + "/dsn_n_way_doppler_observation_model/mgs_map1_ipng_mgs95j.bsp" };
+    for( unsigned int i = 0; i < kernelFiles.size( ); i++ )
+    {
+        int numberOfComparedSegments = compareSpkSegmentsWithSpice( kernelFiles.at( i ), comparedTypes );
+        BOOST_TEST_MESSAGE( "Compared " + std::to_string( numberOfComparedSegments ) + " segments of " +
+                            kernelFiles.at( i ) );
+    }
+
+    // Create type 13 kernel with CSPICE (from states of the Moon w.r.t. the Earth, at unequal steps), so that the
+    // native reader is checked on a file that was not created by the writer in this test
+    const std::string spkFileName = "nativeSpiceKernelCspiceTest.bsp";
+    std::remove( spkFileName.c_str( ) );
+    std::vector< double > epochs;
+    std::vector< double > states;
+    for( int i = 0; i < 240; i++ )
+    {
+        double epoch = 1.0E8 + 3600.0 * i + 600.0 * std::sin( 0.7 * i );
+        Eigen::Vector6d moonState = spice_interface::getBodyCartesianStateAtEpoch(
+                    "Moon", "Earth", "J2000", "NONE", epoch ) / 1.0E3;
+        epochs.push_back( epoch );
+        states.insert( states.end( ), moonState.data( ), moonState.data( ) + 6 );
+    }
+
+    SpiceInt handle;
+    spkopn_c( spkFileName.c_str( ), "Native reader test", 0, &handle );
+    spkw13_c( handle, 301, 399, "J2000", epochs.front( ), epochs.back( ), "Type 13 test", 7, epochs.size( ),
+              reinterpret_cast< const SpiceDouble( * )[ 6 ] >( states.data( ) ), epochs.data( ) );
+    spkcls_c( handle );
+
+    BOOST_CHECK_EQUAL( compareSpkSegmentsWithSpice( spkFileName, comparedTypes ), 1 );
+    std::remove( spkFileName.c_str( ) );
+
+    // Check that at least Chebyshev and Hermite segments have been compared
+    BOOST_CHECK( comparedTypes.count( 2 ) > 0 || comparedTypes.count( 3 ) > 0 );
+    BOOST_CHECK( comparedTypes.count( 13 ) > 0 );
+    for( const int dataType : comparedTypes )
+    {
+        BOOST_TEST_MESSAGE( "Compared SPK segments of type " + std::to_string( dataType ) + " with CSPICE" );
+    }
+}
+
+//! Test native evaluation of binary PCK kernel against sxform_c, using the high-precision Earth orientation kernel
+BOOST_AUTO_TEST_CASE( testNativePckKernelAgainstSpice )
+{
+    const std::string pckFileName = paths::getSpiceKernelPath( ) + "/earth_latest_high_prec.bpc";
+    spice_interface::loadStandardSpiceKernels( );
+    spice_interface::loadSpiceKernelInTudat( pckFileName );
+
+    std::shared_ptr< SpiceKernelCollection > kernels = getSpiceKernelCollection( { pckFileName } );
+    BOOST_CHECK( kernels->hasOrientationData( 3000 ) );
+
+    std::vector< std::pair< std::string, int > > frames = { { "J2000", spiceJ2000FrameId },
+                                                            { "ECLIPJ2000", spiceEclipJ2000FrameId } };
+    for( unsigned int i = 0; i < frames.size( ); i++ )
+    {
+        for( int j = 0; j < 20; j++ )
+        {
+            double testTime = 1.0E8 + 2.5E7 * j + 1234.5678 * j * j;
+
+            Eigen::Matrix3d nativeRotation, nativeRotationDerivative;
+            kernels->getRotationToBodyFixedFrame( 3000, testTime, nativeRotation, nativeRotationDerivative,
+                                                  frames.at( i ).second );
+
+            SpiceDouble stateTransformation[ 6 ][ 6 ];
+            sxform_c( frames.at( i ).first.c_str( ), "ITRF93", testTime, stateTransformation );
+            Eigen::Matrix3d spiceRotation, spiceRotationDerivative;
+            for( int k = 0; k < 3; k++ )
+            {
+                for( int l = 0; l < 3; l++ )
+                {
+                    spiceRotation( k, l ) = stateTransformation[ k ][ l ];
+                    spiceRotationDerivative( k, l ) = stateTransformation[ k + 3 ][ l ];
+                }
+            }
+
+            // Check agreement to round-off
+            BOOST_CHECK_SMALL( ( nativeRotation - spiceRotation ).norm( ), 1.0E-14 );
+            BOOST_CHECK_SMALL( ( nativeRotationDerivative - spiceRotationDerivative ).norm( ),
+                               1.0E-13 * spiceRotationDerivative.norm( ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
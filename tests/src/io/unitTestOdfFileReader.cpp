@@ -309,6 +309,153 @@ BOOST_AUTO_TEST_CASE( testProcessMultipleOdfFile )
 
 }
 
+BOOST_AUTO_TEST_CASE( testColumnarOdfFileReader )
+{
+    // Read same file as raw and columnar ODF contents
+    std::string file = tudat::paths::getTudatTestDataPath( )  + "/odf07155.odf";
+    std::shared_ptr< input_output::OdfRawFileContents > rawOdfContents =
+            std::make_shared< input_output::OdfRawFileContents >( file );
+    std::shared_ptr< input_output::OdfColumnarFileContents > columnarOdfContents =
+            std::make_shared< input_output::OdfColumnarFileContents >( file );
+
+    // Check file label and identifier group
+    BOOST_CHECK_EQUAL ( columnarOdfContents->systemId_, rawOdfContents->systemId_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->programId_, rawOdfContents->programId_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->spacecraftId_, rawOdfContents->spacecraftId_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->fileCreationDate_, rawOdfContents->fileCreationDate_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->fileCreationTime_, rawOdfContents->fileCreationTime_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->fileReferenceDate_, rawOdfContents->fileReferenceDate_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->fileReferenceTime_, rawOdfContents->fileReferenceTime_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->identifierGroupStringA_, rawOdfContents->identifierGroupStringA_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->identifierGroupStringB_, rawOdfContents->identifierGroupStringB_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->identifierGroupStringC_, rawOdfContents->identifierGroupStringC_ );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->eofHeaderFound_, rawOdfContents->eofHeaderFound_ );
+
+    // Check orbit data
+    std::vector< std::shared_ptr< input_output::OdfDataBlock > > dataBlocks = rawOdfContents->getDataBlocks( );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->getNumberOfDataRecords( ), dataBlocks.size( ) );
+    for ( unsigned int i = 0; i < dataBlocks.size( ); ++i )
+    {
+        std::shared_ptr< input_output::OdfCommonDataBlock > commonDataBlock = dataBlocks.at( i )->getCommonDataBlock( );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->observableTimes_.at( i ), commonDataBlock->getObservableTime( ) );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->observableValues_.at( i ), commonDataBlock->getObservableValue( ) );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->receivingStationDownlinkDelays_.at( i ),
+                            commonDataBlock->getReceivingStationDownlinkDelay( ) );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->receivingStationIds_.at( i ), commonDataBlock->receivingStationId_ );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->transmittingStationIds_.at( i ), commonDataBlock->transmittingStationId_ );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->transmittingStationNetworkIds_.at( i ),
+                            commonDataBlock->transmittingStationNetworkId_ );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->dataTypes_.at( i ), commonDataBlock->dataType_ );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->downlinkBandIds_.at( i ), commonDataBlock->downlinkBandId_ );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->uplinkBandIds_.at( i ), commonDataBlock->uplinkBandId_ );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->referenceBandIds_.at( i ), commonDataBlock->referenceBandId_ );
+        BOOST_CHECK_EQUAL ( columnarOdfContents->validities_.at( i ), commonDataBlock->validity_ );
+
+        std::shared_ptr< input_output::OdfDopplerDataBlock > dopplerDataBlock =
+                std::dynamic_pointer_cast< input_output::OdfDopplerDataBlock >(
+                        dataBlocks.at( i )->getObservableSpecificDataBlock( ) );
+        if ( dopplerDataBlock != nullptr )
+        {
+            BOOST_CHECK_EQUAL ( columnarOdfContents->receiverChannels_.at( i ), dopplerDataBlock->getReceiverChannel( ) );
+            BOOST_CHECK_EQUAL ( columnarOdfContents->spacecraftIds_.at( i ), dopplerDataBlock->getSpacecraftId( ) );
+            BOOST_CHECK_EQUAL ( columnarOdfContents->receiverExciterFlags_.at( i ), dopplerDataBlock->getReceiverExciterFlag( ) );
+            BOOST_CHECK_EQUAL ( columnarOdfContents->referenceFrequencies_.at( i ), dopplerDataBlock->getReferenceFrequency( ) );
+            BOOST_CHECK_EQUAL ( columnarOdfContents->compressionTimes_.at( i ), dopplerDataBlock->getCompressionTime( ) );
+            BOOST_CHECK_EQUAL ( columnarOdfContents->transmittingStationUplinkDelays_.at( i ),
+                                dopplerDataBlock->getTransmittingStationUplinkDelay( ) );
+        }
+    }
+
+    // Check ramp data
+    std::map< int, std::vector< std::shared_ptr< input_output::OdfRampBlock > > > rampBlocks = rawOdfContents->getRampBlocks( );
+    BOOST_CHECK_EQUAL ( columnarOdfContents->rampData_.size( ), rampBlocks.size( ) );
+    for ( auto it = rampBlocks.begin( ); it != rampBlocks.end( ); ++it )
+    {
+        const input_output::OdfRampColumns& rampData = columnarOdfContents->rampData_.at( it->first );
+        BOOST_CHECK_EQUAL ( rampData.rampStartTimes_.size( ), it->second.size( ) );
+        for ( unsigned int j = 0; j < it->second.size( ); ++j )
+        {
+            BOOST_CHECK_EQUAL ( rampData.rampStartTimes_.at( j ), it->second.at( j )->getRampStartTime( ) );
+            BOOST_CHECK_EQUAL ( rampData.rampEndTimes_.at( j ), it->second.at( j )->getRampEndTime( ) );
+            BOOST_CHECK_EQUAL ( rampData.rampRates_.at( j ), it->second.at( j )->getRampRate( ) );
+            BOOST_CHECK_EQUAL ( rampData.rampStartFrequencies_.at( j ), it->second.at( j )->getRampStartFrequency( ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testProcessColumnarOdfFiles )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::string spacecraftName = "MRO";
+    std::vector< std::string > odfFileNames = {
+            tudat::paths::getTudatTestDataPath( )  + "/mromagr2017_098_1555xmmmv1.odf",
+            tudat::paths::getTudatTestDataPath( )  + "/mromagr2017_097_1335xmmmv1.odf" };
+
+    // Process ODF files from raw and (in parallel read) columnar contents
+    std::vector< std::shared_ptr< input_output::OdfRawFileContents > > rawOdfDataVector;
+    for ( unsigned int i = 0; i < odfFileNames.size( ); ++i )
+    {
+        rawOdfDataVector.push_back( std::make_shared< input_output::OdfRawFileContents >( odfFileNames.at( i ) ) );
+    }
+    std::shared_ptr< observation_models::ProcessedOdfFileContents > processedOdfFileContents =
+            observation_models::processOdfData( rawOdfDataVector, spacecraftName, false );
+    std::shared_ptr< observation_models::ProcessedOdfFileContents > processedColumnarOdfFileContents =
+            observation_models::processColumnarOdfData( odfFileNames, spacecraftName, 2, false );
+    BOOST_CHECK_EQUAL ( processedColumnarOdfFileContents->getColumnarOdfData( ).size( ), 2 );
+
+    // Check processed data
+    BOOST_CHECK_EQUAL ( processedColumnarOdfFileContents->getStartAndEndTime( ).first,
+                        processedOdfFileContents->getStartAndEndTime( ).first );
+    BOOST_CHECK_EQUAL ( processedColumnarOdfFileContents->getStartAndEndTime( ).second,
+                        processedOdfFileContents->getStartAndEndTime( ).second );
+    BOOST_CHECK_EQUAL ( processedColumnarOdfFileContents->getIgnoredRawOdfObservableTypes( ) ==
+                        processedOdfFileContents->getIgnoredRawOdfObservableTypes( ), true );
+    BOOST_CHECK_EQUAL ( processedColumnarOdfFileContents->getIgnoredGroundStations( ) ==
+                        processedOdfFileContents->getIgnoredGroundStations( ), true );
+    BOOST_CHECK_EQUAL ( processedColumnarOdfFileContents->getRampInterpolators( ).size( ),
+                        processedOdfFileContents->getRampInterpolators( ).size( ) );
+
+    const std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds,
+        std::shared_ptr< observation_models::ProcessedOdfFileSingleLinkData > > >& processedDataBlocks =
+            processedOdfFileContents->getProcessedDataBlocks( );
+    const std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds,
+        std::shared_ptr< observation_models::ProcessedOdfFileSingleLinkData > > >& processedColumnarDataBlocks =
+            processedColumnarOdfFileContents->getProcessedDataBlocks( );
+    BOOST_CHECK_EQUAL ( processedColumnarDataBlocks.size( ), processedDataBlocks.size( ) );
+    for ( auto observableIt = processedDataBlocks.begin( ); observableIt != processedDataBlocks.end( ); ++observableIt )
+    {
+        BOOST_CHECK_EQUAL ( processedColumnarDataBlocks.at( observableIt->first ).size( ), observableIt->second.size( ) );
+        for ( auto linkEndIt = observableIt->second.begin( ); linkEndIt != observableIt->second.end( ); ++linkEndIt )
+        {
+            std::shared_ptr< observation_models::ProcessedOdfFileDopplerData > dopplerData =
+                    std::dynamic_pointer_cast< observation_models::ProcessedOdfFileDopplerData >( linkEndIt->second );
+            std::shared_ptr< observation_models::ProcessedOdfFileDopplerData > columnarDopplerData =
+                    std::dynamic_pointer_cast< observation_models::ProcessedOdfFileDopplerData >(
+                            processedColumnarDataBlocks.at( observableIt->first ).at( linkEndIt->first ) );
+
+            BOOST_CHECK_EQUAL ( columnarDopplerData->processedObservationTimes_ == dopplerData->processedObservationTimes_, true );
+            BOOST_CHECK_EQUAL ( columnarDopplerData->observableValues_ == dopplerData->observableValues_, true );
+            BOOST_CHECK_EQUAL ( columnarDopplerData->referenceFrequencies_ == dopplerData->referenceFrequencies_, true );
+            BOOST_CHECK_EQUAL ( columnarDopplerData->countInterval_ == dopplerData->countInterval_, true );
+            BOOST_CHECK_EQUAL ( columnarDopplerData->receiverRampingFlags_ == dopplerData->receiverRampingFlags_, true );
+            BOOST_CHECK_EQUAL ( columnarDopplerData->originFiles_ == dopplerData->originFiles_, true );
+        }
+    }
+
+    // Check observation collections created from both processed data objects
+    std::shared_ptr< observation_models::ObservationCollection< double, double > > observationCollection =
+            observation_models::createOdfObservedObservationCollection< double, double >( processedOdfFileContents );
+    std::shared_ptr< observation_models::ObservationCollection< double, double > > columnarObservationCollection =
+            observation_models::createOdfObservedObservationCollection< double, double >( processedColumnarOdfFileContents );
+    BOOST_CHECK_EQUAL ( columnarObservationCollection->getObservationVector( ) ==
+                        observationCollection->getObservationVector( ), true );
+    BOOST_CHECK_EQUAL ( columnarObservationCollection->getConcatenatedTimeVector( ) ==
+                        observationCollection->getConcatenatedTimeVector( ), true );
+    BOOST_CHECK_EQUAL ( columnarObservationCollection->getObservationSetStartAndSize( ) ==
+                        observationCollection->getObservationSetStartAndSize( ), true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
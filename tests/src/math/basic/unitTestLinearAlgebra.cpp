@@ -12,12 +12,14 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "tudat/math/basic/leastSquaresEstimation.h"
 #include "tudat/math/basic/linearAlgebra.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
@@ -306,6 +308,166 @@ BOOST_AUTO_TEST_CASE( testRotationMatrixDerivatives )
     }
 }
 
+//! Test whether solution of block-arrow normal equations (local parameters reduced, then back-substituted) matches a
+//! direct solution of the full normal equations, for a multi-arc problem
+BOOST_AUTO_TEST_CASE( testBlockArrowNormalEquations )
+{
+    using namespace tudat::linear_algebra;
+
+    std::srand( 42 );
+
+    // Define multi-arc problem: 3 global parameters, 6 local parameters per arc (with interleaved parameter indices)
+    const int numberOfArcs = 4;
+    const int numberOfLocalParametersPerArc = 6;
+    const int numberOfObservationsPerArc = 50;
+    const int numberOfGlobalObservations = 10;
+    std::vector< int > globalParameterIndices = { 0, 13, 26 };
+    const int numberOfGlobalParameters = globalParameterIndices.size( );
+    const int numberOfParameters = numberOfGlobalParameters + numberOfArcs * numberOfLocalParametersPerArc;
+
+    std::vector< std::vector< int > > localParameterIndices( numberOfArcs );
+    int currentArc = 0;
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        if( std::find( globalParameterIndices.begin( ), globalParameterIndices.end( ), i ) == globalParameterIndices.end( ) )
+        {
+            localParameterIndices.at( currentArc ).push_back( i );
+            if( static_cast< int >( localParameterIndices.at( currentArc ).size( ) ) == numberOfLocalParametersPerArc )
+            {
+                currentArc++;
+            }
+        }
+    }
+
+    // Create partials (each observation depends on global parameters, and on local parameters of its own arc only),
+    // residuals and weights
+    const int numberOfObservations = numberOfArcs * numberOfObservationsPerArc + numberOfGlobalObservations;
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        for( int j = 0; j < numberOfGlobalParameters; j++ )
+        {
+            designMatrix( i, globalParameterIndices.at( j ) ) = Eigen::MatrixXd::Random( 1, 1 )( 0, 0 );
+        }
+
+        if( i < numberOfArcs * numberOfObservationsPerArc )
+        {
+            const std::vector< int >& currentLocalIndices = localParameterIndices.at( i / numberOfObservationsPerArc );
+            for( unsigned int j = 0; j < currentLocalIndices.size( ); j++ )
+            {
+                designMatrix( i, currentLocalIndices.at( j ) ) = Eigen::MatrixXd::Random( 1, 1 )( 0, 0 );
+            }
+        }
+    }
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( numberOfObservations, 2.0 ) +
+            Eigen::VectorXd::Random( numberOfObservations );
+
+    // Define a priori information, including coupling between local and global parameters
+    Eigen::MatrixXd inverseAPrioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        inverseAPrioriCovariance( i, i ) = 0.1 + 0.01 * i;
+    }
+    inverseAPrioriCovariance( localParameterIndices.at( 1 ).at( 2 ), globalParameterIndices.at( 1 ) ) = 0.02;
+    inverseAPrioriCovariance( globalParameterIndices.at( 1 ), localParameterIndices.at( 1 ).at( 2 ) ) = 0.02;
+
+    // Accumulate block-arrow normal equations in blocks of observations (not aligned with arcs), and solve
+    BlockArrowNormalEquationsAccumulator blockArrowNormalEquations( numberOfParameters, localParameterIndices );
+    const int blockSize = 35;
+    for( int i = 0; i < numberOfObservations; i += blockSize )
+    {
+        int currentBlockSize = std::min( blockSize, numberOfObservations - i );
+        blockArrowNormalEquations.addObservations(
+                    designMatrix.middleRows( i, currentBlockSize ), residuals.segment( i, currentBlockSize ),
+                    weights.segment( i, currentBlockSize ) );
+    }
+    Eigen::VectorXd blockArrowSolution = blockArrowNormalEquations.solve( inverseAPrioriCovariance );
+
+    // Solve full normal equations directly
+    Eigen::MatrixXd fullNormalMatrix =
+            designMatrix.transpose( ) * weights.asDiagonal( ) * designMatrix + inverseAPrioriCovariance;
+    Eigen::VectorXd fullRightHandSide = designMatrix.transpose( ) * weights.asDiagonal( ) * residuals;
+    Eigen::VectorXd fullSolution = fullNormalMatrix.ldlt( ).solve( fullRightHandSide );
+    Eigen::MatrixXd fullCovariance = fullNormalMatrix.inverse( );
+
+    // Compare solution for global parameters, and local parameters recovered by back-substitution
+    BOOST_CHECK_SMALL( ( blockArrowSolution - fullSolution ).norm( ) / fullSolution.norm( ), 1.0E-12 );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( blockArrowSolution( i ), fullSolution( i ), 1.0E-10 );
+    }
+
+    // Compare covariance computed from accumulated normal matrix with that of full normal equations
+    Eigen::MatrixXd blockArrowCovariance =
+            ( blockArrowNormalEquations.getNormalMatrix( ) + inverseAPrioriCovariance ).inverse( );
+    BOOST_CHECK_SMALL( ( blockArrowCovariance - fullCovariance ).norm( ) / fullCovariance.norm( ), 1.0E-12 );
+
+    // Compare covariance of global parameters from reduced (Schur complement) normal matrix, and covariance of local
+    // parameters recovered by back-substitution, with the corresponding blocks of the full covariance
+    Eigen::MatrixXd accumulatedNormalMatrix = blockArrowNormalEquations.getNormalMatrix( ) + inverseAPrioriCovariance;
+    Eigen::MatrixXd reducedGlobalMatrix = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        for( int j = 0; j < numberOfGlobalParameters; j++ )
+        {
+            reducedGlobalMatrix( i, j ) = accumulatedNormalMatrix(
+                        globalParameterIndices.at( i ), globalParameterIndices.at( j ) );
+        }
+    }
+
+    std::vector< Eigen::MatrixXd > localMatrices( numberOfArcs ), localGlobalMatrices( numberOfArcs );
+    for( int k = 0; k < numberOfArcs; k++ )
+    {
+        localMatrices.at( k ).resize( numberOfLocalParametersPerArc, numberOfLocalParametersPerArc );
+        localGlobalMatrices.at( k ).resize( numberOfLocalParametersPerArc, numberOfGlobalParameters );
+        for( int i = 0; i < numberOfLocalParametersPerArc; i++ )
+        {
+            for( int j = 0; j < numberOfLocalParametersPerArc; j++ )
+            {
+                localMatrices.at( k )( i, j ) = accumulatedNormalMatrix(
+                            localParameterIndices.at( k ).at( i ), localParameterIndices.at( k ).at( j ) );
+            }
+            for( int j = 0; j < numberOfGlobalParameters; j++ )
+            {
+                localGlobalMatrices.at( k )( i, j ) = accumulatedNormalMatrix(
+                            localParameterIndices.at( k ).at( i ), globalParameterIndices.at( j ) );
+            }
+        }
+        reducedGlobalMatrix -= localGlobalMatrices.at( k ).transpose( ) *
+                localMatrices.at( k ).ldlt( ).solve( localGlobalMatrices.at( k ) );
+    }
+    Eigen::MatrixXd globalCovariance = reducedGlobalMatrix.inverse( );
+
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        for( int j = 0; j < numberOfGlobalParameters; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION(
+                        globalCovariance( i, j ),
+                        fullCovariance( globalParameterIndices.at( i ), globalParameterIndices.at( j ) ), 1.0E-10 );
+        }
+    }
+
+    for( int k = 0; k < numberOfArcs; k++ )
+    {
+        // C_ll = N_ll^-1 + N_ll^-1 N_lg C_gg N_lg^T N_ll^-1
+        Eigen::MatrixXd inverseLocalMatrix = localMatrices.at( k ).inverse( );
+        Eigen::MatrixXd localCovariance = inverseLocalMatrix + inverseLocalMatrix * localGlobalMatrices.at( k ) *
+                globalCovariance * localGlobalMatrices.at( k ).transpose( ) * inverseLocalMatrix;
+        for( int i = 0; i < numberOfLocalParametersPerArc; i++ )
+        {
+            for( int j = 0; j < numberOfLocalParametersPerArc; j++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION(
+                            localCovariance( i, j ),
+                            fullCovariance( localParameterIndices.at( k ).at( i ), localParameterIndices.at( k ).at( j ) ),
+                            1.0E-10 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
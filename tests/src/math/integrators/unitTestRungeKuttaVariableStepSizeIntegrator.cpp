@@ -35,9 +35,12 @@
 #include "tudat/basics/testMacros.h"
 #include "tudat/math/integrators/numericalIntegratorTestFunctions.h"
 
+#include <functional>
 #include <limits>
+#include <map>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 namespace tudat
 {
@@ -315,6 +318,153 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Function to compute the state derivative of a Kepler orbit (unit gravitational parameter), in two dimensions.
+Eigen::VectorXd computeKeplerStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 4 );
+    stateDerivative.segment( 0, 2 ) = state.segment( 2, 2 );
+    stateDerivative.segment( 2, 2 ) = -state.segment( 0, 2 ) / std::pow( state.segment( 0, 2 ).norm( ), 3 );
+    return stateDerivative;
+}
+
+//! Test dense output (continuous extension) of the integrator, using a circular Kepler orbit.
+BOOST_AUTO_TEST_CASE( testDenseOutput )
+{
+    using namespace numerical_integrators;
+
+    // Define analytical solution of circular orbit (unit radius and gravitational parameter).
+    std::function< Eigen::VectorXd( const double ) > analyticalSolution = [ ]( const double time )
+    {
+        return ( Eigen::VectorXd( 4 ) << std::cos( time ), std::sin( time ),
+                 -std::sin( time ), std::cos( time ) ).finished( );
+    };
+
+    // Check that dense output can not be switched on for coefficient sets without a continuous extension
+    std::vector< CoefficientSets > coefficientSetsWithoutDenseOutput =
+    { rungeKuttaFehlberg45, rungeKuttaFehlberg78, rungeKutta87DormandPrince, rungeKuttaVerner89 };
+    for( unsigned int i = 0; i < coefficientSetsWithoutDenseOutput.size( ); i++ )
+    {
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( coefficientSetsWithoutDenseOutput.at( i ) ),
+                    &computeKeplerStateDerivative, 0.0, analyticalSolution( 0.0 ), 1.0E-4, 1.0, 0.1, 1.0E-12, 1.0E-12 );
+        BOOST_CHECK_THROW( integrator.setUseDenseOutput( true ), std::runtime_error );
+    }
+
+    // Check that dense output is not available if not switched on
+    {
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( rungeKutta85DormandPrince ), &computeKeplerStateDerivative,
+                    0.0, analyticalSolution( 0.0 ), 1.0E-4, 1.0, 0.1, 1.0E-12, 1.0E-12 );
+        integrator.performIntegrationStep( 0.1 );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+        BOOST_CHECK_THROW( integrator.getDenseOutputState( 0.05 ), std::runtime_error );
+    }
+
+    // Compute interpolation error in middle of step for two step sizes
+    std::vector< double > stepSizes = { 0.4, 0.2 };
+    std::vector< double > interpolationErrors;
+    for( unsigned int j = 0; j < stepSizes.size( ); j++ )
+    {
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( rungeKutta85DormandPrince ), &computeKeplerStateDerivative,
+                    0.0, analyticalSolution( 0.0 ), 1.0E-4, 1.0, stepSizes.at( j ), 1.0E-12, 1.0E-12 );
+        integrator.setStepSizeControl( false );
+        integrator.setUseDenseOutput( true );
+
+        // Check order of the dense output (DOP853 interpolant is of order 7, the integrator of order 8)
+        BOOST_CHECK_EQUAL( integrator.getDenseOutputOrder( ), 7 );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputOfIntegratorOrder( ), false );
+
+        // Take two steps, and check that dense output is done in last step
+        integrator.performIntegrationStep( stepSizes.at( j ) );
+        integrator.performIntegrationStep( stepSizes.at( j ) );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+
+        // Check that start and end of step are recovered (to within rounding errors of the dense output coefficients)
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    integrator.getDenseOutputState( stepSizes.at( j ) ), integrator.getPreviousState( ), 1.0E-15 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    integrator.getDenseOutputState( 2.0 * stepSizes.at( j ) ), integrator.getCurrentState( ), 1.0E-13 );
+        BOOST_CHECK_THROW( integrator.getDenseOutputState( 0.5 * stepSizes.at( j ) ), std::runtime_error );
+
+        // Compute interpolation error w.r.t. state propagated from start of step by analytical solution
+        const double interpolationTime = 1.5 * stepSizes.at( j );
+        interpolationErrors.push_back(
+                    ( integrator.getDenseOutputState( interpolationTime ) - integrator.getPreviousState( ) -
+                      ( analyticalSolution( interpolationTime ) - analyticalSolution( stepSizes.at( j ) ) ) ).norm( ) );
+
+        // Check that dense output remains available after rollback
+        integrator.rollbackToPreviousState( );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+
+        // Check that dense output is invalidated by modification of state
+        integrator.modifyCurrentState( analyticalSolution( stepSizes.at( j ) ) );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+    }
+
+    // Check that local interpolation error scales (at least) as h^8, for the 7th order dense output
+    BOOST_CHECK_GT( interpolationErrors.at( 0 ) / interpolationErrors.at( 1 ), 0.5 * std::pow( 2.0, 8 ) );
+}
+
+//! Test integration to output epochs using the dense output, by comparing to a tight-tolerance reference integration
+//! that takes steps to each of the output epochs.
+BOOST_AUTO_TEST_CASE( testDenseOutputAtOutputEpochs )
+{
+    using namespace numerical_integrators;
+
+    // Define eccentric orbit (unit semi-major axis and gravitational parameter, eccentricity 0.6), starting at periapsis
+    const double eccentricity = 0.6;
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 4 ) <<
+                                           1.0 - eccentricity, 0.0, 0.0,
+                                           std::sqrt( ( 1.0 + eccentricity ) / ( 1.0 - eccentricity ) ) ).finished( );
+
+    // Define output epochs on fixed grid (over about 1.5 orbits), unsorted to check the sorting of the epochs
+    std::vector< double > outputEpochs;
+    for( unsigned int i = 0; i <= 200; i++ )
+    {
+        outputEpochs.push_back( static_cast< double >( ( 37 * i ) % 201 ) / 20.0 );
+    }
+
+    // Integrate to output epochs from dense output
+    RungeKuttaVariableStepSizeIntegratorXd integrator(
+                RungeKuttaCoefficients::get( rungeKutta85DormandPrince ), &computeKeplerStateDerivative,
+                0.0, initialState, 1.0E-6, 10.0, 0.01, 1.0E-11, 1.0E-11 );
+    integrator.setUseDenseOutput( true );
+    std::map< double, Eigen::VectorXd > denseOutputStates = integrator.integrateToOutputEpochs( outputEpochs, 0.01 );
+
+    // Check that last step ends at last output epoch
+    BOOST_CHECK_EQUAL( denseOutputStates.size( ), outputEpochs.size( ) );
+    BOOST_CHECK_CLOSE_FRACTION( integrator.getCurrentIndependentVariable( ), 10.0, 1.0E-15 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( denseOutputStates.at( 10.0 ), integrator.getCurrentState( ), 1.0E-15 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( denseOutputStates.at( 0.0 ), initialState, 1.0E-15 );
+
+    // Check that (most of the) steps are larger than the spacing of the output epochs
+    BOOST_CHECK_GT( std::fabs( integrator.getCurrentIndependentVariable( ) -
+                               integrator.getPreviousIndependentVariable( ) ), 0.05 );
+
+    // Integrate with tight tolerances to each output epoch
+    RungeKuttaVariableStepSizeIntegratorXd referenceIntegrator(
+                RungeKuttaCoefficients::get( rungeKuttaFehlberg78 ), &computeKeplerStateDerivative,
+                0.0, initialState, 1.0E-6, 0.05, 0.01, 1.0E-14, 1.0E-14 );
+    double maximumDifference = 0.0;
+    for( auto stateIterator: denseOutputStates )
+    {
+        Eigen::VectorXd referenceState = referenceIntegrator.integrateTo(
+                    stateIterator.first, referenceIntegrator.getNextStepSize( ), 1.0E-12 );
+        maximumDifference = std::max( maximumDifference, ( stateIterator.second - referenceState ).cwiseAbs( ).maxCoeff( ) );
+    }
+
+    // Check that dense output is consistent with the integration tolerances
+    BOOST_CHECK_SMALL( maximumDifference, 1.0E-8 );
+
+    // Check that output epochs before the current independent variable are rejected, and that dense output must be on
+    BOOST_CHECK_THROW( integrator.integrateToOutputEpochs( { 5.0, 11.0 }, 0.01 ), std::runtime_error );
+    RungeKuttaVariableStepSizeIntegratorXd integratorWithoutDenseOutput(
+                RungeKuttaCoefficients::get( rungeKutta85DormandPrince ), &computeKeplerStateDerivative,
+                0.0, initialState, 1.0E-6, 10.0, 0.01, 1.0E-11, 1.0E-11 );
+    BOOST_CHECK_THROW( integratorWithoutDenseOutput.integrateToOutputEpochs( { 1.0, 2.0 }, 0.01 ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
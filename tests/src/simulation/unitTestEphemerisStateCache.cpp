@@ -0,0 +1,261 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
+#include "tudat/basics/testMacros.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/environment_setup/createGroundStations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+using namespace tudat::ephemerides;
+
+BOOST_AUTO_TEST_SUITE( test_ephemeris_state_cache )
+
+//! Function to create a system of bodies with Earth (w.r.t. Sun), Sun (w.r.t. SSB) and Moon (w.r.t. Earth)
+SystemOfBodies createTestBodies( const std::string& globalFrameOrigin )
+{
+    SystemOfBodies bodies = SystemOfBodies( globalFrameOrigin, "ECLIPJ2000" );
+    bodies.createEmptyBody( "Sun", false );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.createEmptyBody( "Moon", false );
+
+    bodies.at( "Sun" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                          ( Eigen::Vector6d( ) << 1.0E9, 0.1, 0.1, 0.2, 0.3, 0.4 ).finished( ),
+                                          0.0, 1.0E20, "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                            ( Eigen::Vector6d( ) << 1.5E11, 0.0167, 0.01, 1.0, 2.0, 3.0 ).finished( ),
+                                            0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" ) );
+    bodies.at( "Moon" )->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                           ( Eigen::Vector6d( ) << 3.84E8, 0.055, 0.09, 0.5, 1.5, 2.5 ).finished( ),
+                                           0.0, 4.0E14, "Earth", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setRotationalEphemeris( std::make_shared< SimpleRotationalEphemeris >(
+                                                      0.2, 1.1, 0.4, 7.29E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+    bodies.processBodyFrameDefinitions( );
+    return bodies;
+}
+
+//! Test whether lookups are cached only within a stage, and give results identical to the ephemerides
+BOOST_AUTO_TEST_CASE( testEphemerisStateCacheHitsAndInvalidation )
+{
+    SystemOfBodies bodies = createTestBodies( "SSB" );
+    std::shared_ptr< Body > earth = bodies.at( "Earth" );
+    std::shared_ptr< Ephemeris > earthEphemeris = earth->getEphemeris( );
+
+    double testTime = 1.0E6;
+    Eigen::Vector6d directState = earthEphemeris->getCartesianState( testTime );
+
+    // Check that no lookups are cached outside of a stage
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime ) -
+                             directState ).norm( ), 0.0 );
+    }
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateMisses_, 3 );
+
+    // Check that repeated lookups at the same time are retrieved from the cache within a stage
+    bodies.resetEphemerisCacheStatistics( );
+    bodies.startEphemerisStateCacheStage( );
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime ) -
+                             directState ).norm( ), 0.0 );
+    }
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 3 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateMisses_, 1 );
+    BOOST_CHECK_CLOSE_FRACTION( earth->getEphemerisCacheStatistics( ).getStateHitRate( ), 0.75,
+                                std::numeric_limits< double >::epsilon( ) );
+
+    // Check that long double and double states are cached separately, with long double state identical to ephemeris
+    Eigen::Matrix< long double, 6, 1 > directLongState =
+            earthEphemeris->getTemplatedStateFromEphemeris< long double, double >( testTime );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( earth->getStateInEphemerisFrameFromEphemeris< long double, double >( testTime ) -
+                             directLongState ).norm( ), 0.0L );
+    }
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 4 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateMisses_, 2 );
+
+    // Check that a lookup at a different time is not retrieved from the cache
+    BOOST_CHECK_EQUAL( ( earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime + 1.0 ) -
+                         earthEphemeris->getCartesianState( testTime + 1.0 ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateMisses_, 3 );
+
+    // Check that starting a new stage invalidates the cache
+    bodies.startEphemerisStateCacheStage( );
+    earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime + 1.0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateMisses_, 4 );
+    earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime + 1.0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 5 );
+
+    // Check that invalidating the cache stops caching, so that a modified ephemeris is used directly
+    bodies.invalidateEphemerisStateCache( );
+    std::shared_ptr< Ephemeris > newEarthEphemeris = std::make_shared< KeplerEphemeris >(
+                ( Eigen::Vector6d( ) << 1.6E11, 0.0167, 0.01, 1.0, 2.0, 3.0 ).finished( ),
+                0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" );
+    earth->setEphemeris( newEarthEphemeris );
+    BOOST_CHECK_EQUAL( ( earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime + 1.0 ) -
+                         newEarthEphemeris->getCartesianState( testTime + 1.0 ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 5 );
+
+    // Check that resetting the ephemeris during a stage invalidates the cache of the body
+    bodies.startEphemerisStateCacheStage( );
+    earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime );
+    earth->setEphemeris( earthEphemeris );
+    BOOST_CHECK_EQUAL( ( earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime ) -
+                         directState ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 5 );
+
+    // Check that disabling the cache passes all lookups to the ephemerides
+    bodies.setIsEphemerisStateCacheEnabled( false );
+    bodies.startEphemerisStateCacheStage( );
+    bodies.resetEphemerisCacheStatistics( );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime );
+    }
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateMisses_, 3 );
+}
+
+//! Test caching of rotations, and of ephemerides that may not be cached
+BOOST_AUTO_TEST_CASE( testEphemerisStateCacheRotations )
+{
+    SystemOfBodies bodies = createTestBodies( "SSB" );
+    std::shared_ptr< Body > earth = bodies.at( "Earth" );
+    std::shared_ptr< RotationalEphemeris > earthRotationModel = earth->getRotationalEphemeris( );
+
+    double testTime = 2.0E6;
+    Eigen::Quaterniond directRotation = earthRotationModel->getRotationToTargetFrame( testTime );
+    Eigen::Quaterniond directFullRotation;
+    Eigen::Matrix3d directRotationDerivative;
+    Eigen::Vector3d directAngularVelocity;
+    earthRotationModel->getFullRotationalQuantitiesToTargetFrame(
+                directFullRotation, directRotationDerivative, directAngularVelocity, testTime );
+
+    bodies.startEphemerisStateCacheStage( );
+
+    // Retrieve rotation only, then full rotational state (which requires a new computation), then both from cache
+    BOOST_CHECK_EQUAL( ( earth->getRotationToLocalFrameFromEphemeris( testTime ).toRotationMatrix( ) -
+                         directRotation.toRotationMatrix( ) ).norm( ), 0.0 );
+    earth->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+    earth->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+    BOOST_CHECK_EQUAL( ( earth->getRotationToLocalFrameFromEphemeris( testTime ).toRotationMatrix( ) -
+                         directRotation.toRotationMatrix( ) ).norm( ), 0.0 );
+    earth->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+
+    BOOST_CHECK_EQUAL( ( earth->getCurrentRotationToLocalFrame( ).toRotationMatrix( ) -
+                         directRotation.toRotationMatrix( ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( earth->getCurrentRotationMatrixDerivativeToLocalFrame( ) - directRotationDerivative ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( earth->getCurrentAngularVelocityVectorInGlobalFrame( ) - directAngularVelocity ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).rotationMisses_, 2 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).rotationHits_, 3 );
+
+    // Check that an ephemeris defined by a function is never cached
+    Eigen::Vector6d constantState = Eigen::Vector6d::Constant( 1.0E3 );
+    earth->setEphemeris( std::make_shared< ConstantEphemeris >( [ & ]( ){ return constantState; }, "Sun", "ECLIPJ2000" ) );
+    earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime );
+    constantState *= 2.0;
+    BOOST_CHECK_EQUAL( ( earth->getStateInEphemerisFrameFromEphemeris< double, double >( testTime ) -
+                         constantState ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateHits_, 0 );
+    BOOST_CHECK_EQUAL( earth->getEphemerisCacheStatistics( ).stateMisses_, 2 );
+}
+
+//! Test whether states of bodies w.r.t. a non-barycentric global frame origin are identical with and without cache
+BOOST_AUTO_TEST_CASE( testEphemerisStateCacheGlobalFrameOrigin )
+{
+    SystemOfBodies bodies = createTestBodies( "Earth" );
+
+    std::vector< double > testTimes = { 0.0, 1.0E5, 1.0E5, 3.0E6 };
+    std::map< std::string, std::vector< Eigen::Vector6d > > uncachedStates;
+    for( int useCache = 0; useCache < 2; useCache++ )
+    {
+        bodies.setIsEphemerisStateCacheEnabled( useCache == 1 );
+        bodies.resetEphemerisCacheStatistics( );
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            // Emulate start of state derivative evaluation
+            bodies.startEphemerisStateCacheStage( );
+            for( auto bodyIterator : bodies.getMap( ) )
+            {
+                bodyIterator.second->recomputeStateOnNextCall( );
+            }
+
+            for( std::string bodyName : { "Sun", "Moon", "Earth" } )
+            {
+                Eigen::Vector6d currentState =
+                        bodies.at( bodyName )->getStateInBaseFrameFromEphemeris< double, double >( testTimes.at( i ) );
+                if( useCache == 0 )
+                {
+                    uncachedStates[ bodyName ].push_back( currentState );
+                }
+                else
+                {
+                    BOOST_CHECK_EQUAL( ( currentState - uncachedStates.at( bodyName ).at( i ) ).norm( ), 0.0 );
+                }
+            }
+        }
+
+        // Check that states of Earth and Sun are reused when computing barycentric state of global frame origin
+        EphemerisCacheStatistics totalStatistics = bodies.getTotalEphemerisCacheStatistics( );
+        if( useCache == 0 )
+        {
+            BOOST_CHECK_EQUAL( totalStatistics.stateHits_, 0 );
+        }
+        else
+        {
+            BOOST_CHECK( totalStatistics.stateHits_ > 0 );
+        }
+    }
+}
+
+//! Test whether functions retrieving (cached) states from bodies do not keep these bodies alive
+BOOST_AUTO_TEST_CASE( testEphemerisStateCacheBodyLifetime )
+{
+    std::map< std::string, std::weak_ptr< Body > > weakBodies;
+    {
+        SystemOfBodies bodies = createTestBodies( "Earth" );
+        bodies.at( "Earth" )->setShapeModel( std::make_shared< basic_astrodynamics::SphericalBodyShapeModel >( 6.378E6 ) );
+        createGroundStation( bodies.at( "Earth" ), "Station", Eigen::Vector3d( 6.4E6, 0.0, 0.0 ) );
+        for( auto bodyIterator : bodies.getMap( ) )
+        {
+            weakBodies[ bodyIterator.first ] = bodyIterator.second;
+        }
+    }
+
+    // Check that all bodies are destroyed with the system of bodies
+    for( auto bodyIterator : weakBodies )
+    {
+        BOOST_CHECK_EQUAL( bodyIterator.second.expired( ), true );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat